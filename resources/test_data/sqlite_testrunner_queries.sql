@@ -152,6 +152,17 @@ SELECT * FROM mixed_null ORDER BY b;
 -- LIMIT
 SELECT * FROM mixed LIMIT 77;
 SELECT b FROM mixed LIMIT 10;
+SELECT id, a, b FROM mixed ORDER BY id DESC LIMIT 5;
+SELECT id, b FROM mixed ORDER BY b, id LIMIT 12;
+
+-- WINDOW FUNCTIONS
+SELECT id, ROW_NUMBER() OVER (PARTITION BY a ORDER BY id) AS rn FROM mixed;
+SELECT id, RANK() OVER (PARTITION BY a ORDER BY b) AS r, DENSE_RANK() OVER (PARTITION BY a ORDER BY b) AS dr FROM mixed;
+SELECT id, SUM(b) OVER (PARTITION BY a ORDER BY id) AS running_sum FROM mixed;
+SELECT id, COUNT(*) OVER (PARTITION BY a) AS partition_size FROM mixed;
+SELECT id, MAX(b) OVER (PARTITION BY a ORDER BY id ROWS BETWEEN 3 PRECEDING AND CURRENT ROW) AS m FROM mixed;
+SELECT id, AVG(c) OVER (ORDER BY id ROWS BETWEEN 2 PRECEDING AND 2 FOLLOWING) AS moving_avg FROM mixed;
+SELECT id, MIN(b) OVER (PARTITION BY a ORDER BY id ROWS BETWEEN 1 FOLLOWING AND 2 FOLLOWING) AS m FROM mixed;
 
 -- PRODUCT
 SELECT "right".b FROM mixed AS "left", mixed_null AS "right" WHERE "left".a = "right".a AND "left".b = 2;
@@ -474,6 +485,15 @@ SELECT * FROM id_int_int_int_100 AS r WHERE NOT EXISTS (SELECT a FROM id_int_int
 SELECT * FROM id_int_int_int_100 WHERE EXISTS (SELECT a FROM id_int_int_int_50 WHERE EXISTS (SELECT b FROM mixed))
 SELECT * FROM id_int_int_int_100 AS r WHERE EXISTS (SELECT s.a FROM id_int_int_int_50 AS s WHERE s.b = r.b AND s.c < r.c)
 
+-- Set operations (sqlite does not support INTERSECT ALL and EXCEPT ALL)
+SELECT a, b FROM mixed UNION SELECT a, b FROM mixed_null;
+SELECT a, b FROM mixed UNION ALL SELECT a, b FROM mixed_null;
+SELECT b, c FROM mixed_null UNION SELECT b, c FROM mixed_null WHERE b > 50;
+SELECT a FROM id_int_int_int_100 INTERSECT SELECT a FROM id_int_int_int_50;
+SELECT b, c FROM mixed_null INTERSECT SELECT b, c FROM mixed_null WHERE b IS NULL OR b < 30;
+SELECT a FROM id_int_int_int_100 EXCEPT SELECT a FROM id_int_int_int_50;
+SELECT b FROM mixed_null EXCEPT SELECT b FROM mixed WHERE b > 50;
+
 -- TRANSACTIONS
 BEGIN; INSERT INTO mixed VALUES (999, 'a', 42, 123.456, 'qwer'); SELECT * FROM mixed; ROLLBACK; SELECT * FROM mixed;
 BEGIN; INSERT INTO mixed VALUES (999, 'a', 42, 123.456, 'qwer'); SELECT * FROM mixed; COMMIT; SELECT * FROM mixed;
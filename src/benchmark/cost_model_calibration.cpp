@@ -0,0 +1,190 @@
+#include <algorithm>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "cxxopts.hpp"
+#include "magic_enum.hpp"
+
+#include "cost_estimation/calibrated_cost_model.hpp"
+#include "expression/expression_functional.hpp"
+#include "hyrise.hpp"
+#include "operators/aggregate_hash.hpp"
+#include "operators/get_table.hpp"
+#include "operators/join_hash.hpp"
+#include "operators/join_nested_loop.hpp"
+#include "operators/join_sort_merge.hpp"
+#include "operators/product.hpp"
+#include "operators/projection.hpp"
+#include "operators/sort.hpp"
+#include "operators/table_scan.hpp"
+#include "scheduler/operator_task.hpp"
+#include "synthetic_table_generator.hpp"
+#include "utils/timer.hpp"
+
+/**
+ * Calibrates the CalibratedCostModel on the machine it runs on. For synthetic tables of different sizes and encodings,
+ * TableScans, joins, sorts, aggregates, and projections are executed. Their runtimes are recorded in the operators'
+ * OperatorPerformanceData, which the cost model is fitted to. The resulting file can be passed to the benchmarks via
+ * --cost_model.
+ */
+
+namespace {
+
+using namespace hyrise;  // NOLINT
+using namespace expression_functional;  // NOLINT(build/namespaces)
+
+// Products and nested loop joins are only executed up to this number of input row pairs to keep the calibration short.
+constexpr auto MAX_INPUT_ROW_PAIRS = size_t{50'000'000};
+
+const auto SCAN_ENCODING_TYPES = std::vector<EncodingType>{EncodingType::Unencoded, EncodingType::Dictionary,
+                                                           EncodingType::RunLength, EncodingType::FrameOfReference,
+                                                           EncodingType::LZ4};
+
+std::string table_name(const EncodingType encoding_type, const size_t row_count) {
+  return "calibration_" + std::string{magic_enum::enum_name(encoding_type)} + "_" + std::to_string(row_count);
+}
+
+// Creates a table with the columns `a` (about `row_count` distinct values) and `b` (100 distinct values).
+void generate_table(const EncodingType encoding_type, const size_t row_count) {
+  const auto encoding_spec = SegmentEncodingSpec{encoding_type};
+  const auto column_specifications = std::vector<ColumnSpecification>{
+      ColumnSpecification{ColumnDataDistribution::make_uniform_config(0.0, static_cast<double>(row_count)),
+                          DataType::Int, encoding_spec, "a"},
+      ColumnSpecification{ColumnDataDistribution::make_uniform_config(0.0, 100.0), DataType::Int, encoding_spec, "b"}};
+
+  // The StorageManager requires MVCC data.
+  const auto table = SyntheticTableGenerator::generate_table(column_specifications, row_count, Chunk::DEFAULT_SIZE,
+                                                             UseMvcc::Yes);
+  Hyrise::get().storage_manager.add_table(table_name(encoding_type, row_count), table);
+}
+
+void execute_and_collect_samples(const std::shared_ptr<AbstractOperator>& pqp,
+                                 std::vector<CostModelSample>& samples) {
+  const auto& [tasks, root_operator_task] = OperatorTask::make_tasks_from_operator(pqp);
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(tasks);
+
+  const auto pqp_samples = CalibratedCostModel::collect_samples(pqp);
+  samples.insert(samples.end(), pqp_samples.begin(), pqp_samples.end());
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  auto cli_options = cxxopts::Options{"./hyriseCostModelCalibration",
+                                      "Calibrates the cost model used for join ordering and join operator selection."};
+
+  // clang-format off
+  cli_options.add_options()
+    ("help", "Display this help and exit") // NOLINT
+    ("o,output", "File that the calibrated cost model is written to", cxxopts::value<std::string>()->default_value("cost_model.json"))  // NOLINT(whitespace/line_length)
+    ("rows", "Row count of the largest calibration table", cxxopts::value<size_t>()->default_value("1000000"))  // NOLINT(whitespace/line_length)
+    ("r,runs", "Number of times that each calibration query is executed", cxxopts::value<size_t>()->default_value("3"));  // NOLINT(whitespace/line_length)
+  // clang-format on
+
+  const auto parse_result = cli_options.parse(argc, argv);
+  if (parse_result.count("help")) {
+    std::cout << cli_options.help() << std::endl;
+    return 0;
+  }
+
+  const auto output_file_path = parse_result["output"].as<std::string>();
+  const auto max_row_count = parse_result["rows"].as<size_t>();
+  const auto runs = parse_result["runs"].as<size_t>();
+  Assert(max_row_count >= 1'000, "Calibration requires at least 1,000 rows.");
+  Assert(runs > 0, "Calibration requires at least one run.");
+
+  auto row_counts = std::vector<size_t>{};
+  for (auto row_count = size_t{1'000}; row_count <= max_row_count; row_count *= 10) {
+    row_counts.emplace_back(row_count);
+  }
+
+  auto timer = Timer{};
+  std::cout << "- Generating calibration tables" << std::endl;
+  for (const auto encoding_type : SCAN_ENCODING_TYPES) {
+    for (const auto row_count : row_counts) {
+      generate_table(encoding_type, row_count);
+    }
+  }
+  std::cout << "- Tables generated (" << timer.lap_formatted() << ")" << std::endl;
+
+  const auto column_a = pqp_column_(ColumnID{0}, DataType::Int, false, "a");
+  const auto column_b = pqp_column_(ColumnID{1}, DataType::Int, false, "b");
+  const auto join_predicate = OperatorJoinPredicate{{ColumnID{0}, ColumnID{0}}, PredicateCondition::Equals};
+
+  auto samples = std::vector<CostModelSample>{};
+  for (auto run = size_t{0}; run < runs; ++run) {
+    std::cout << "- Run " << run + 1 << " of " << runs << std::endl;
+
+    // TableScans with different selectivities are executed on each encoding.
+    for (const auto encoding_type : SCAN_ENCODING_TYPES) {
+      for (const auto row_count : row_counts) {
+        for (const auto selectivity : {0.01, 0.1, 0.5, 0.9}) {
+          const auto get_table = std::make_shared<GetTable>(table_name(encoding_type, row_count));
+          const auto value = static_cast<int32_t>(selectivity * static_cast<double>(row_count));
+          execute_and_collect_samples(std::make_shared<TableScan>(get_table, less_than_(column_a, value)), samples);
+        }
+      }
+    }
+
+    // The remaining operators do not depend on the encoding, apart from the materialization of their inputs.
+    for (const auto row_count : row_counts) {
+      const auto name = table_name(EncodingType::Dictionary, row_count);
+
+      execute_and_collect_samples(
+          std::make_shared<Sort>(std::make_shared<GetTable>(name),
+                                 std::vector<SortColumnDefinition>{SortColumnDefinition{ColumnID{0}}}),
+          samples);
+
+      execute_and_collect_samples(
+          std::make_shared<AggregateHash>(std::make_shared<GetTable>(name),
+                                          std::vector<std::shared_ptr<WindowFunctionExpression>>{sum_(column_a)},
+                                          std::vector<ColumnID>{ColumnID{1}}),
+          samples);
+
+      execute_and_collect_samples(
+          std::make_shared<Projection>(std::make_shared<GetTable>(name), expression_vector(add_(column_a, column_b))),
+          samples);
+    }
+
+    for (const auto left_row_count : row_counts) {
+      for (const auto right_row_count : row_counts) {
+        const auto left_name = table_name(EncodingType::Dictionary, left_row_count);
+        const auto right_name = table_name(EncodingType::Dictionary, right_row_count);
+
+        execute_and_collect_samples(
+            std::make_shared<JoinHash>(std::make_shared<GetTable>(left_name), std::make_shared<GetTable>(right_name),
+                                       JoinMode::Inner, join_predicate),
+            samples);
+
+        execute_and_collect_samples(
+            std::make_shared<JoinSortMerge>(std::make_shared<GetTable>(left_name),
+                                            std::make_shared<GetTable>(right_name), JoinMode::Inner, join_predicate),
+            samples);
+
+        if (left_row_count * right_row_count > MAX_INPUT_ROW_PAIRS) {
+          continue;
+        }
+
+        execute_and_collect_samples(
+            std::make_shared<JoinNestedLoop>(std::make_shared<GetTable>(left_name),
+                                             std::make_shared<GetTable>(right_name), JoinMode::Inner, join_predicate),
+            samples);
+
+        execute_and_collect_samples(
+            std::make_shared<Product>(std::make_shared<GetTable>(left_name), std::make_shared<GetTable>(right_name)),
+            samples);
+      }
+    }
+
+    std::cout << "- Run finished (" << timer.lap_formatted() << ")" << std::endl;
+  }
+
+  const auto cost_model = CalibratedCostModel::fit(samples);
+  cost_model.save(output_file_path);
+  std::cout << "- Fitted the cost model to " << samples.size() << " samples and wrote it to " << output_file_path
+            << std::endl;
+
+  return 0;
+}
@@ -4,16 +4,46 @@
 #include "../micro_benchmark_basic_fixture.hpp"
 #include "benchmark/benchmark.h"
 #include "expression/expression_functional.hpp"
+#include "hyrise.hpp"
 #include "operators/aggregate_hash.hpp"
 #include "operators/aggregate_sort.hpp"
 #include "operators/sort.hpp"
 #include "operators/table_wrapper.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "synthetic_table_generator.hpp"
 #include "types.hpp"
 
-namespace hyrise {
+namespace {
 
+using namespace hyrise;  // NOLINT(build/namespaces)
 using namespace expression_functional;  // NOLINT(build/namespaces)
 
+// Aggregates a table of two million rows with about one million groups, which do not fit into the CPU caches.
+void aggregate_hash_high_cardinality(benchmark::State& state, const AggregateHash::ExecutionMode execution_mode) {
+  Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+
+  const auto column_specification = ColumnSpecification{
+      ColumnDataDistribution::make_uniform_config(0.0, 1'000'000.0), DataType::Int, SegmentEncodingSpec{}};
+  const auto table = SyntheticTableGenerator::generate_table({2, column_specification}, 2'000'000);
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->never_clear_output();
+  table_wrapper->execute();
+
+  const auto aggregates = std::vector<std::shared_ptr<WindowFunctionExpression>>{
+      sum_(pqp_column_(ColumnID{1}, DataType::Int, false, "b")),
+      count_(pqp_column_(INVALID_COLUMN_ID, DataType::Long, false, "*"))};
+  const auto groupby = std::vector<ColumnID>{ColumnID{0}, ColumnID{1}};
+
+  for (auto _ : state) {
+    const auto aggregate = std::make_shared<AggregateHash>(table_wrapper, aggregates, groupby, execution_mode);
+    aggregate->execute();
+  }
+}
+
+}  // namespace
+
+namespace hyrise {
+
 BENCHMARK_F(MicroBenchmarkBasicFixture, BM_AggregateHash)(benchmark::State& state) {
   _clear_cache();
 
@@ -30,6 +60,33 @@ BENCHMARK_F(MicroBenchmarkBasicFixture, BM_AggregateHash)(benchmark::State& stat
   }
 }
 
+BENCHMARK_F(MicroBenchmarkBasicFixture, BM_AggregateHashParallel)(benchmark::State& state) {
+  _clear_cache();
+  Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+
+  auto aggregates = std::vector<std::shared_ptr<WindowFunctionExpression>>{
+      std::static_pointer_cast<WindowFunctionExpression>(min_(pqp_column_(ColumnID{1}, DataType::Int, false, "b")))};
+
+  std::vector<ColumnID> groupby = {ColumnID{0} /* "a" */};
+
+  auto warm_up =
+      std::make_shared<AggregateHash>(_table_wrapper_a, aggregates, groupby, AggregateHash::ExecutionMode::Parallel);
+  warm_up->execute();
+  for (auto _ : state) {
+    auto aggregate =
+        std::make_shared<AggregateHash>(_table_wrapper_a, aggregates, groupby, AggregateHash::ExecutionMode::Parallel);
+    aggregate->execute();
+  }
+}
+
+BENCHMARK_F(MicroBenchmarkBasicFixture, BM_AggregateHashHighCardinality)(benchmark::State& state) {
+  aggregate_hash_high_cardinality(state, AggregateHash::ExecutionMode::Sequential);
+}
+
+BENCHMARK_F(MicroBenchmarkBasicFixture, BM_AggregateHashHighCardinalityParallel)(benchmark::State& state) {
+  aggregate_hash_high_cardinality(state, AggregateHash::ExecutionMode::Parallel);
+}
+
 BENCHMARK_F(MicroBenchmarkBasicFixture, BM_AggregateSortNotSortedNoGroupBy)(benchmark::State& state) {
   _clear_cache();
 
@@ -4,14 +4,57 @@
 #include "benchmark/benchmark.h"
 #include "expression/expression_functional.hpp"
 #include "operators/table_scan.hpp"
+#include "operators/table_scan/value_id_scan_kernels.hpp"
 #include "operators/table_wrapper.hpp"
+#include "storage/chunk_encoder.hpp"
 #include "storage/table.hpp"
+#include "storage/vector_compression/vector_compression.hpp"
 #include "utils/load_table.hpp"
 
 namespace hyrise {
 
 using namespace expression_functional;  // NOLINT(build/namespaces)
 
+namespace {
+
+constexpr auto ENCODED_TABLE_ROW_COUNT = uint32_t{1'000'000};
+constexpr auto ENCODED_TABLE_DISTINCT_VALUE_COUNT = uint32_t{1'000};
+
+// Value IDs are spread over the chunk so that matches and non-matches alternate irregularly.
+uint32_t scattered_value(const uint32_t row_id, const uint32_t distinct_value_count) {
+  return static_cast<uint32_t>((uint64_t{row_id} * 7'919) % distinct_value_count);
+}
+
+// Creates a table with a single, nullable int column with 1'000 distinct values, every 100th of which is NULL.
+std::shared_ptr<TableWrapper> create_encoded_table_wrapper(const SegmentEncodingSpec& encoding_spec) {
+  const auto column_definitions = TableColumnDefinitions{{"a", DataType::Int, true}};
+  const auto table = std::make_shared<Table>(column_definitions, TableType::Data);
+
+  auto row_id = uint32_t{0};
+  while (row_id < ENCODED_TABLE_ROW_COUNT) {
+    const auto chunk_size = std::min(static_cast<uint32_t>(Chunk::DEFAULT_SIZE), ENCODED_TABLE_ROW_COUNT - row_id);
+    auto values = pmr_vector<int32_t>(chunk_size);
+    auto null_values = pmr_vector<bool>(chunk_size);
+    for (auto chunk_offset = uint32_t{0}; chunk_offset < chunk_size; ++chunk_offset, ++row_id) {
+      values[chunk_offset] = static_cast<int32_t>(scattered_value(row_id, ENCODED_TABLE_DISTINCT_VALUE_COUNT));
+      null_values[chunk_offset] = row_id % 100 == 0;
+    }
+    table->append_chunk({std::make_shared<ValueSegment<int32_t>>(std::move(values), std::move(null_values))});
+    table->last_chunk()->finalize();
+  }
+
+  if (encoding_spec.encoding_type != EncodingType::Unencoded) {
+    ChunkEncoder::encode_all_chunks(table, encoding_spec);
+  }
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->never_clear_output();
+  table_wrapper->execute();
+  return table_wrapper;
+}
+
+}  // namespace
+
 void benchmark_tablescan_impl(benchmark::State& state, const std::shared_ptr<const AbstractOperator> in,
                               ColumnID left_column_id, const PredicateCondition predicate_condition,
                               const AllParameterVariant right_parameter) {
@@ -57,6 +100,86 @@ BENCHMARK_F(MicroBenchmarkBasicFixture, BM_TableScanVariable_OnDict)(benchmark::
   benchmark_tablescan_impl(state, _table_dict_wrapper, ColumnID{0}, PredicateCondition::GreaterThanEquals, ColumnID{1});
 }
 
+// Scans (a < 500), which matches about half of the rows, on differently encoded segments. For dictionary segments,
+// the scan is executed by the SIMD kernels of value_id_scan_kernels.hpp, see BM_ValueIDScanKernel for a comparison of
+// the instruction sets.
+void BM_TableScanEncoded(benchmark::State& state, const SegmentEncodingSpec encoding_spec) {
+  const auto table_wrapper = create_encoded_table_wrapper(encoding_spec);
+  micro_benchmark_clear_cache();
+  benchmark_tablescan_impl(state, table_wrapper, ColumnID{0}, PredicateCondition::LessThan,
+                           static_cast<int32_t>(ENCODED_TABLE_DISTINCT_VALUE_COUNT / 2));
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * ENCODED_TABLE_ROW_COUNT);
+}
+
+BENCHMARK_CAPTURE(BM_TableScanEncoded, Unencoded, SegmentEncodingSpec{EncodingType::Unencoded});
+BENCHMARK_CAPTURE(BM_TableScanEncoded, DictionaryFixedWidthInteger,
+                  SegmentEncodingSpec{EncodingType::Dictionary, VectorCompressionType::FixedWidthInteger});
+BENCHMARK_CAPTURE(BM_TableScanEncoded, DictionaryBitPacking,
+                  SegmentEncodingSpec{EncodingType::Dictionary, VectorCompressionType::BitPacking});
+BENCHMARK_CAPTURE(BM_TableScanEncoded, FrameOfReference, SegmentEncodingSpec{EncodingType::FrameOfReference});
+BENCHMARK_CAPTURE(BM_TableScanEncoded, RunLength, SegmentEncodingSpec{EncodingType::RunLength});
+BENCHMARK_CAPTURE(BM_TableScanEncoded, LZ4, SegmentEncodingSpec{EncodingType::LZ4});
+
+// Scans the attribute vector of a single chunk for half of its value IDs. The argument is the number of distinct
+// values, which determines the width of FixedWidthInteger vectors (1, 2, or 4 bytes) and BitPacking vectors.
+void BM_ValueIDScanKernel(benchmark::State& state, const VectorCompressionType vector_compression_type,
+                          const ScanKernelInstructionSet instruction_set) {
+  if (instruction_set > supported_scan_kernel_instruction_set()) {
+    state.SkipWithError("Instruction set is not supported by the CPU");
+    return;
+  }
+
+  const auto distinct_value_count = static_cast<uint32_t>(state.range(0));
+  const auto row_count = static_cast<uint32_t>(Chunk::DEFAULT_SIZE);
+  auto value_ids = pmr_vector<uint32_t>(row_count);
+  for (auto row_id = uint32_t{0}; row_id < row_count; ++row_id) {
+    value_ids[row_id] = scattered_value(row_id, distinct_value_count);
+  }
+  const auto attribute_vector =
+      compress_vector(value_ids, vector_compression_type, {}, UncompressedVectorInfo{distinct_value_count});
+
+  auto matches = RowIDPosList{};
+  matches.reserve(row_count);
+  for (auto _ : state) {
+    matches.clear();
+    scan_value_id_range(*attribute_vector, ValueID{0}, ValueID{distinct_value_count / 2}, false,
+                        ValueID{distinct_value_count}, ChunkID{0}, matches, instruction_set);
+    benchmark::DoNotOptimize(matches.data());
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * row_count);
+}
+
+BENCHMARK_CAPTURE(BM_ValueIDScanKernel, FixedWidthInteger_Scalar, VectorCompressionType::FixedWidthInteger,
+                  ScanKernelInstructionSet::Scalar)
+    ->Arg(100)
+    ->Arg(10'000)
+    ->Arg(100'000);
+BENCHMARK_CAPTURE(BM_ValueIDScanKernel, FixedWidthInteger_AVX2, VectorCompressionType::FixedWidthInteger,
+                  ScanKernelInstructionSet::AVX2)
+    ->Arg(100)
+    ->Arg(10'000)
+    ->Arg(100'000);
+BENCHMARK_CAPTURE(BM_ValueIDScanKernel, FixedWidthInteger_AVX512, VectorCompressionType::FixedWidthInteger,
+                  ScanKernelInstructionSet::AVX512)
+    ->Arg(100)
+    ->Arg(10'000)
+    ->Arg(100'000);
+BENCHMARK_CAPTURE(BM_ValueIDScanKernel, BitPacking_Scalar, VectorCompressionType::BitPacking,
+                  ScanKernelInstructionSet::Scalar)
+    ->Arg(100)
+    ->Arg(10'000)
+    ->Arg(100'000);
+BENCHMARK_CAPTURE(BM_ValueIDScanKernel, BitPacking_AVX2, VectorCompressionType::BitPacking,
+                  ScanKernelInstructionSet::AVX2)
+    ->Arg(100)
+    ->Arg(10'000)
+    ->Arg(100'000);
+BENCHMARK_CAPTURE(BM_ValueIDScanKernel, BitPacking_AVX512, VectorCompressionType::BitPacking,
+                  ScanKernelInstructionSet::AVX512)
+    ->Arg(100)
+    ->Arg(10'000)
+    ->Arg(100'000);
+
 BENCHMARK_F(MicroBenchmarkBasicFixture, BM_TableScan_Like)(benchmark::State& state) {
   const auto lineitem_table = load_table("resources/test_data/tbl/tpch/sf-0.001/lineitem.tbl");
 
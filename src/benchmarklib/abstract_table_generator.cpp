@@ -9,6 +9,7 @@
 #include "operators/table_wrapper.hpp"
 #include "scheduler/job_task.hpp"
 #include "scheduler/node_queue_scheduler.hpp"
+#include "storage/index/adaptive_radix_tree/primary_key_index.hpp"
 #include "storage/index/group_key/composite_group_key_index.hpp"
 #include "storage/index/group_key/group_key_index.hpp"
 #include "storage/index/partial_hash/partial_hash_index.hpp"
@@ -375,9 +376,30 @@ void AbstractTableGenerator::_create_table_indexes(
     std::unordered_map<std::string, BenchmarkTableInfo>& table_info_by_name) {
   auto timer = Timer{};
   std::cout << "- Creating table indexes" << std::endl;
+
+  // Primary key indexes are maintained by Insert operators and used for point lookups (e.g., in TPC-C).
+  for (const auto& [table_name, table_info] : table_info_by_name) {
+    const auto& table = table_info.table;
+    for (const auto& key_constraint : table->soft_key_constraints()) {
+      const auto& columns = key_constraint.columns();
+      if (key_constraint.key_type() != KeyConstraintType::PRIMARY_KEY ||
+          std::any_of(columns.cbegin(), columns.cend(), [&](const auto column_id) {
+            return table->column_is_nullable(column_id);
+          })) {
+        continue;
+      }
+
+      std::cout << "-  Creating a primary key index on table " << table_name << " " << std::flush;
+      auto per_table_index_timer = Timer{};
+      table->create_primary_key_index();
+      std::cout << "(" << per_table_index_timer.lap_formatted() << ")" << std::endl;
+    }
+  }
+
   const auto& indexes_by_table = _indexes_by_table();
   if (indexes_by_table.empty()) {
     std::cout << "-  No indexes defined by benchmark" << std::endl;
+    metrics.table_index_duration = timer.lap();
     return;
   }
   for (const auto& [table_name, indexes] : indexes_by_table) {
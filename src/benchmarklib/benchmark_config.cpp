@@ -11,7 +11,9 @@ BenchmarkConfig::BenchmarkConfig(const BenchmarkMode init_benchmark_mode, const
                                  const uint32_t init_data_preparation_cores, const uint32_t init_clients,
                                  const bool init_enable_visualization, const bool init_verify,
                                  const bool init_cache_binary_tables, const bool init_metrics,
-                                 const std::vector<std::string>& init_plugins)
+                                 const std::vector<std::string>& init_plugins,
+                                 const std::optional<std::string>& init_cost_model_file_path,
+                                 const bool init_chunk_pipelines, const bool init_work_stealing)
     : benchmark_mode(init_benchmark_mode),
       chunk_size(init_chunk_size),
       encoding_config(init_encoding_config),
@@ -29,7 +31,10 @@ BenchmarkConfig::BenchmarkConfig(const BenchmarkMode init_benchmark_mode, const
       verify(init_verify),
       cache_binary_tables(init_cache_binary_tables),
       metrics(init_metrics),
-      plugins(init_plugins) {}
+      plugins(init_plugins),
+      cost_model_file_path(init_cost_model_file_path),
+      chunk_pipelines(init_chunk_pipelines),
+      work_stealing(init_work_stealing) {}
 
 BenchmarkConfig BenchmarkConfig::get_default_config() {
   return BenchmarkConfig{};
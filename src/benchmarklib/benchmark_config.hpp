@@ -26,7 +26,9 @@ class BenchmarkConfig {
                   const bool init_enable_scheduler, const uint32_t init_cores,
                   const uint32_t init_data_preparation_cores, const uint32_t init_clients,
                   const bool init_enable_visualization, const bool init_verify, const bool init_cache_binary_tables,
-                  const bool init_metrics, const std::vector<std::string>& init_plugins);
+                  const bool init_metrics, const std::vector<std::string>& init_plugins,
+                  const std::optional<std::string>& init_cost_model_file_path, const bool init_chunk_pipelines,
+                  const bool init_work_stealing);
 
   static BenchmarkConfig get_default_config();
 
@@ -48,6 +50,12 @@ class BenchmarkConfig {
   bool cache_binary_tables = false;  // Defaults to false for internal use, but the CLI sets it to true by default
   bool metrics = false;
   std::vector<std::string> plugins{};
+  // Calibrated cost model (see hyriseCostModelCalibration) used for join ordering and join operator selection.
+  std::optional<std::string> cost_model_file_path = std::nullopt;
+  // Fuse chains of Validate, TableScan, and Projection operators into ChunkPipelines (see LQPTranslator).
+  bool chunk_pipelines = false;
+  // Run the NodeQueueScheduler in the NodeQueueSchedulerMode::WorkStealingDeques mode (if the scheduler is active).
+  bool work_stealing = false;
 
  private:
   BenchmarkConfig() = default;
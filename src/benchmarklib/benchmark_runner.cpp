@@ -12,6 +12,7 @@
 #include "cxxopts.hpp"
 
 #include "benchmark_config.hpp"
+#include "cost_estimation/calibrated_cost_model.hpp"
 #include "hyrise.hpp"
 #include "scheduler/job_task.hpp"
 #include "sql/sql_pipeline_builder.hpp"
@@ -35,6 +36,12 @@ BenchmarkRunner::BenchmarkRunner(const BenchmarkConfig& config,
   Hyrise::get().default_pqp_cache = std::make_shared<SQLPhysicalPlanCache>();
   Hyrise::get().default_lqp_cache = std::make_shared<SQLLogicalPlanCache>();
 
+  if (config.cost_model_file_path) {
+    Hyrise::get().cost_model =
+        std::make_shared<const CalibratedCostModel>(CalibratedCostModel::load(*config.cost_model_file_path));
+  }
+  Hyrise::get().use_chunk_pipelines = config.chunk_pipelines;
+
   // Initialise the scheduler if the benchmark was requested to run multi-threaded.
   if (config.enable_scheduler) {
     Hyrise::get().topology.use_default_topology(config.cores);
@@ -48,7 +55,8 @@ BenchmarkRunner::BenchmarkRunner(const BenchmarkConfig& config,
     }
     _context.push_back({"utilized_cores_per_numa_node", numa_cores_per_node});
 
-    const auto scheduler = std::make_shared<NodeQueueScheduler>();
+    const auto scheduler = std::make_shared<NodeQueueScheduler>(
+        config.work_stealing ? NodeQueueSchedulerMode::WorkStealingDeques : NodeQueueSchedulerMode::SharedNodeQueues);
     Hyrise::get().set_scheduler(scheduler);
   }
 
@@ -414,10 +422,15 @@ nlohmann::json BenchmarkRunner::_create_report() const {
       for (const auto& run_result : runs) {
         // Convert the SQLPipelineMetrics for each run of the BenchmarkItem into JSON.
         auto all_pipeline_metrics_json = nlohmann::json::array();
+        // Planning (i.e., parsing, SQL translation, optimization, and LQP translation) is reported separately from the
+        // execution so that the effects of the optimizer on the planning time and on the execution time can be told
+        // apart.
+        auto planning_duration = std::chrono::nanoseconds{0};
         // metrics can be empty if _config.metrics is false.
         for (const auto& pipeline_metrics : run_result.metrics) {
           auto pipeline_metrics_json = nlohmann::json{{"parse_duration", pipeline_metrics.parse_time_nanos.count()},
                                                       {"statements", nlohmann::json::array()}};
+          planning_duration += pipeline_metrics.parse_time_nanos;
 
           for (const auto& sql_statement_metrics : pipeline_metrics.statement_metrics) {
             nlohmann::json rule_metrics_json;
@@ -425,11 +438,17 @@ nlohmann::json BenchmarkRunner::_create_report() const {
               rule_metrics_json[rule_duration.rule_name] += rule_duration.duration.count();
             }
 
+            const auto statement_planning_duration = sql_statement_metrics->sql_translation_duration +
+                                                     sql_statement_metrics->optimization_duration +
+                                                     sql_statement_metrics->lqp_translation_duration;
+            planning_duration += statement_planning_duration;
+
             auto sql_statement_metrics_json =
                 nlohmann::json{{"sql_translation_duration", sql_statement_metrics->sql_translation_duration.count()},
                                {"optimization_duration", sql_statement_metrics->optimization_duration.count()},
                                {"optimizer_rule_durations", rule_metrics_json},
                                {"lqp_translation_duration", sql_statement_metrics->lqp_translation_duration.count()},
+                               {"planning_duration", statement_planning_duration.count()},
                                {"plan_execution_duration", sql_statement_metrics->plan_execution_duration.count()},
                                {"query_plan_cache_hit", sql_statement_metrics->query_plan_cache_hit}};
 
@@ -439,9 +458,13 @@ nlohmann::json BenchmarkRunner::_create_report() const {
           all_pipeline_metrics_json.push_back(pipeline_metrics_json);
         }
 
-        runs_json.push_back(nlohmann::json{{"begin", run_result.begin.count()},
-                                           {"duration", run_result.duration.count()},
-                                           {"metrics", all_pipeline_metrics_json}});
+        auto run_json = nlohmann::json{{"begin", run_result.begin.count()},
+                                       {"duration", run_result.duration.count()},
+                                       {"metrics", all_pipeline_metrics_json}};
+        if (!run_result.metrics.empty()) {
+          run_json["planning_duration"] = planning_duration.count();
+        }
+        runs_json.push_back(run_json);
       }
       return runs_json;
     };
@@ -533,13 +556,16 @@ cxxopts::Options BenchmarkRunner::get_basic_cli_options(const std::string& bench
     ("p,plugins", "Specify plugins to be loaded and execute their pre-/post-benchmark hooks (comma-separated paths to shared libraries w/o whitespaces)", cxxopts::value<std::string>()->default_value(""))  // NOLINT(whitespace/line_length)
     ("compression", "Specify vector compression as a string. Options: " + compression_strings_option, cxxopts::value<std::string>()->default_value(""))  // NOLINT(whitespace/line_length)
     ("chunk_indexes", "Create chunk indexes (separate index per chunk; columns defined by benchmark)", cxxopts::value<bool>()->default_value("false"))  // NOLINT(whitespace/line_length)
-    ("table_indexes", "Create table indexes (index per table column; columns defined by benchmark)", cxxopts::value<bool>()->default_value("false"))  // NOLINT(whitespace/line_length)
+    ("table_indexes", "Create table indexes (index per table column; columns defined by benchmark) and primary key indexes", cxxopts::value<bool>()->default_value("false"))  // NOLINT(whitespace/line_length)
     ("scheduler", "Enable or disable the scheduler", cxxopts::value<bool>()->default_value("false"))
     ("cores", "Specify the number of cores used by the scheduler (if active). 0 means all available cores", cxxopts::value<uint32_t>()->default_value("0"))  // NOLINT(whitespace/line_length)
+    ("work_stealing", "Give each scheduler worker a local task deque that idle workers steal from (if the scheduler is active)", cxxopts::value<bool>()->default_value("false"))  // NOLINT(whitespace/line_length)
     ("clients", "Specify how many items should run in parallel if the scheduler is active", cxxopts::value<uint32_t>()->default_value("1"))  // NOLINT(whitespace/line_length)
     ("visualize", "Create a visualization image of one LQP and PQP for each query, do not properly run the benchmark", cxxopts::value<bool>()->default_value("false"))  // NOLINT(whitespace/line_length)
     ("verify", "Verify each query by comparing it with the SQLite result", cxxopts::value<bool>()->default_value("false"))  // NOLINT(whitespace/line_length)
     ("dont_cache_binary_tables", "Do not cache tables as binary files for faster loading on subsequent runs", cxxopts::value<bool>()->default_value("false"))  // NOLINT(whitespace/line_length)
+    ("cost_model", "Calibrated cost model file (see hyriseCostModelCalibration) used for join ordering and join operator selection", cxxopts::value<std::string>()->default_value(""))  // NOLINT(whitespace/line_length)
+    ("chunk_pipelines", "Fuse chains of Validate, TableScan, and Projection operators into pipelines that process the input morsel by morsel", cxxopts::value<bool>()->default_value("false"))  // NOLINT(whitespace/line_length)
     ("metrics", "Track more metrics (steps in SQL pipeline, system utilization, etc.) and add them to the output JSON (see -o)", cxxopts::value<bool>()->default_value("false"))  // NOLINT(whitespace/line_length)
     // This option is only advised when the underlying system's memory capacity is overleaded by the preparation phase.
     ("data_preparation_cores", "Specify the number of cores used by the scheduler for data preparation, i.e., sorting and encoding tables and generating table statistics. 0 means all available cores.", cxxopts::value<uint32_t>()->default_value("0"));  // NOLINT(whitespace/line_length)
@@ -577,10 +603,13 @@ nlohmann::json BenchmarkRunner::create_context(const BenchmarkConfig& config) {
                         {"max_duration", config.max_duration.count()},
                         {"warmup_duration", config.warmup_duration.count()},
                         {"using_scheduler", config.enable_scheduler},
+                        {"work_stealing", config.work_stealing},
                         {"cores", config.cores},
                         {"clients", config.clients},
                         {"data_preparation_cores", config.data_preparation_cores},
                         {"verify", config.verify},
+                        {"cost_model", config.cost_model_file_path.value_or("")},
+                        {"chunk_pipelines", config.chunk_pipelines},
                         {"time_unit", "ns"},
                         {"GIT-HASH", GIT_HEAD_SHA1 + std::string(GIT_IS_DIRTY ? "-dirty" : "")}};
 }
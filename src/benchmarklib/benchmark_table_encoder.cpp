@@ -62,6 +62,38 @@ bool BenchmarkTableEncoder::encode(const std::string& table_name, const std::sha
   /**
    * 1. Build the ChunkEncodingSpec, i.e. the Encoding to be used
    */
+  const auto chunk_encoding_spec = BenchmarkTableEncoder::chunk_encoding_spec(table_name, table, encoding_config);
+
+  /**
+   * 2. Actually encode chunks
+   */
+  auto encoding_performed = std::atomic_bool{false};
+  const auto column_data_types = table->column_data_types();
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(table->chunk_count());
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+    const auto encode = [&, chunk_id]() {
+      const auto chunk = table->get_chunk(ChunkID{chunk_id});
+      Assert(chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
+      if (!is_chunk_encoding_spec_satisfied(chunk_encoding_spec, get_chunk_encoding_spec(*chunk))) {
+        ChunkEncoder::encode_chunk(chunk, column_data_types, chunk_encoding_spec);
+        encoding_performed = true;
+      }
+    };
+    jobs.emplace_back(std::make_shared<JobTask>(encode));
+  }
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+
+  generate_chunk_pruning_statistics(table);
+
+  return encoding_performed;
+}
+
+ChunkEncodingSpec BenchmarkTableEncoder::chunk_encoding_spec(const std::string& table_name,
+                                                             const std::shared_ptr<Table>& table,
+                                                             const EncodingConfig& encoding_config) {
   const auto& type_mapping = encoding_config.type_encoding_mapping;
   const auto& custom_mapping = encoding_config.custom_encoding_mapping;
 
@@ -108,31 +140,7 @@ bool BenchmarkTableEncoder::encode(const std::string& table_name, const std::sha
     }
   }
 
-  /**
-   * 2. Actually encode chunks
-   */
-  auto encoding_performed = std::atomic_bool{false};
-  const auto column_data_types = table->column_data_types();
-
-  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
-  jobs.reserve(table->chunk_count());
-
-  for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
-    const auto encode = [&, chunk_id]() {
-      const auto chunk = table->get_chunk(ChunkID{chunk_id});
-      Assert(chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
-      if (!is_chunk_encoding_spec_satisfied(chunk_encoding_spec, get_chunk_encoding_spec(*chunk))) {
-        ChunkEncoder::encode_chunk(chunk, column_data_types, chunk_encoding_spec);
-        encoding_performed = true;
-      }
-    };
-    jobs.emplace_back(std::make_shared<JobTask>(encode));
-  }
-  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
-
-  generate_chunk_pruning_statistics(table);
-
-  return encoding_performed;
+  return chunk_encoding_spec;
 }
 
 }  // namespace hyrise
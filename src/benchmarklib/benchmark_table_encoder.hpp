@@ -3,6 +3,8 @@
 #include <memory>
 #include <string>
 
+#include "storage/encoding_type.hpp"
+
 namespace hyrise {
 
 class EncodingConfig;
@@ -14,6 +16,11 @@ class BenchmarkTableEncoder {
   //              false, if the @param table was already encoded as required by @param encoding_config
   static bool encode(const std::string& table_name, const std::shared_ptr<Table>& table,
                      const EncodingConfig& encoding_config);
+
+  // @return      the encoding for each column of @param table as specified by @param encoding_config. Columns whose
+  //              data type is not supported by the default encoding are left Unencoded.
+  static ChunkEncodingSpec chunk_encoding_spec(const std::string& table_name, const std::shared_ptr<Table>& table,
+                                               const EncodingConfig& encoding_config);
 };
 
 }  // namespace hyrise
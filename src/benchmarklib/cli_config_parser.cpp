@@ -152,6 +152,26 @@ BenchmarkConfig CLIConfigParser::parse_cli_options(const cxxopts::ParseResult& p
     boost::split(plugins, comma_separated_plugins, boost::is_any_of(","), boost::token_compress_on);
   }
 
+  auto cost_model_file_path = std::optional<std::string>{};
+  const auto cost_model_file_string = parse_result["cost_model"].as<std::string>();
+  if (!cost_model_file_string.empty()) {
+    std::cout << "- Using the calibrated cost model from " << cost_model_file_string << std::endl;
+    cost_model_file_path = cost_model_file_string;
+  } else {
+    std::cout << "- Using the logical cost model" << std::endl;
+  }
+
+  const auto chunk_pipelines = parse_result["chunk_pipelines"].as<bool>();
+  if (chunk_pipelines) {
+    std::cout << "- Fusing chunk-local operators into chunk pipelines" << std::endl;
+  }
+
+  const auto work_stealing = parse_result["work_stealing"].as<bool>();
+  if (work_stealing) {
+    Assert(enable_scheduler, "--work_stealing only makes sense when the scheduler is enabled.");
+    std::cout << "- Scheduler workers steal tasks from each other's deques" << std::endl;
+  }
+
   return BenchmarkConfig{benchmark_mode,
                          chunk_size,
                          *encoding_config,
@@ -169,7 +189,10 @@ BenchmarkConfig CLIConfigParser::parse_cli_options(const cxxopts::ParseResult& p
                          verify,
                          cache_binary_tables,
                          metrics,
-                         plugins};
+                         plugins,
+                         cost_model_file_path,
+                         chunk_pipelines,
+                         work_stealing};
 }
 
 EncodingConfig CLIConfigParser::parse_encoding_config(const std::string& encoding_file_str) {
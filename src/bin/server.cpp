@@ -1,3 +1,7 @@
+#include <chrono>
+#include <memory>
+#include <optional>
+
 #include "cxxopts.hpp"
 
 #include <boost/algorithm/string.hpp>
@@ -5,6 +9,8 @@
 
 #include "benchmark_config.hpp"
 #include "cli_config_parser.hpp"
+#include "hyrise.hpp"
+#include "import_export/binary/checkpoint_manager.hpp"
 #include "server/server.hpp"
 #include "tpcc/tpcc_table_generator.hpp"
 #include "tpcds/tpcds_table_generator.hpp"
@@ -60,7 +66,15 @@ cxxopts::Options get_server_cli_options() {
                        "at server start (e.g., \"TPC-C:5\", \"TPC-DS:5\", or \"TPC-H:10\"). Supported are TPC-C, "
                        "TPC-DS, and TPC-H. The sizing factor determines the scale factor in TPC-DS and TPC-H, and the "
                        "warehouse count in TPC-C.", cxxopts::value<std::string>()) // NOLINT
+    ("write_ahead_log", "Optional: path of the write-ahead log. Committed changes are logged to this file. If it already "
+                        "exists, it is replayed onto the tables (e.g., those generated via benchmark_data) at server "
+                        "start.", cxxopts::value<std::string>()) // NOLINT
+    ("checkpoint_directory", "Optional: directory of checkpoints. If it contains a checkpoint, its tables are loaded at "
+                             "server start instead of generating benchmark_data, and the write_ahead_log is replayed "
+                             "onto them. New checkpoints are written to it every checkpoint_interval seconds.", cxxopts::value<std::string>()) // NOLINT
+    ("checkpoint_interval", "Seconds between two checkpoints if a checkpoint_directory is given (0 disables periodic checkpoints)", cxxopts::value<uint32_t>()->default_value("300")) // NOLINT
     ("execution_info", "Send execution information after statement execution", cxxopts::value<bool>()->default_value("false")) // NOLINT
+    ("work_stealing", "Give each scheduler worker a local task deque that idle workers steal from", cxxopts::value<bool>()->default_value("false")) // NOLINT
     ;  // NOLINT
   // clang-format on
 
@@ -85,19 +99,52 @@ int main(int argc, char* argv[]) {
     * We do not plan on exposing other parameters, such as the encoding or the chunk size via this facility. You can
     * change the modify the config object as needed.
     */
-  if (parsed_options.count("benchmark_data")) {
+  auto checkpoint_commit_id = std::optional<hyrise::CommitID>{};
+  if (parsed_options.count("checkpoint_directory")) {
+    const auto checkpoint_directory = parsed_options["checkpoint_directory"].as<std::string>();
+    checkpoint_commit_id = hyrise::CheckpointManager::load_checkpoint(checkpoint_directory);
+    if (checkpoint_commit_id) {
+      std::cout << "Loaded checkpoint of commit ID " << *checkpoint_commit_id << " from " << checkpoint_directory
+                << std::endl;
+    }
+  }
+
+  // The tables of a checkpoint already contain the benchmark data that was generated before.
+  if (parsed_options.count("benchmark_data") && !checkpoint_commit_id) {
     generate_benchmark_data(parsed_options["benchmark_data"].as<std::string>());
   }
 
+  // Recovery has to happen after the tables have been loaded, as the log only contains changes to them. Transactions
+  // that are part of the checkpoint are skipped.
+  if (parsed_options.count("write_ahead_log")) {
+    const auto log_path = parsed_options["write_ahead_log"].as<std::string>();
+    const auto replayed_transaction_count = hyrise::Hyrise::get().write_ahead_log.open(log_path);
+    std::cout << "Replayed " << replayed_transaction_count << " transactions from " << log_path << std::endl;
+  }
+
+  // Checkpoints truncate the write-ahead log, so that the recovery only has to replay the transactions that committed
+  // after the last checkpoint.
+  auto checkpoint_manager = std::unique_ptr<hyrise::CheckpointManager>{};
+  const auto checkpoint_interval = parsed_options["checkpoint_interval"].as<uint32_t>();
+  if (parsed_options.count("checkpoint_directory") && checkpoint_interval > 0) {
+    checkpoint_manager =
+        std::make_unique<hyrise::CheckpointManager>(parsed_options["checkpoint_directory"].as<std::string>());
+    checkpoint_manager->start_periodic_checkpoints(std::chrono::seconds{checkpoint_interval});
+  }
+
   const auto execution_info = parsed_options["execution_info"].as<bool>();
   const auto port = parsed_options["port"].as<uint16_t>();
+  const auto work_stealing = parsed_options["work_stealing"].as<bool>();
+  const auto scheduler_mode = work_stealing ? hyrise::NodeQueueSchedulerMode::WorkStealingDeques
+                                            : hyrise::NodeQueueSchedulerMode::SharedNodeQueues;
 
   boost::system::error_code error;
   const auto address = boost::asio::ip::make_address(parsed_options["address"].as<std::string>(), error);
 
   Assert(!error, "Not a valid IPv4 address: " + parsed_options["address"].as<std::string>() + ", terminating...");
 
-  auto server = hyrise::Server{address, port, static_cast<hyrise::SendExecutionInfo>(execution_info)};
+  auto server =
+      hyrise::Server{address, port, static_cast<hyrise::SendExecutionInfo>(execution_info), scheduler_mode};
   server.run();
 
   return 0;
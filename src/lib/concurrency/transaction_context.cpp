@@ -103,6 +103,16 @@ void TransactionContext::commit_async(const std::function<void(TransactionID)>&
     op->commit_records(commit_id());
   }
 
+  // With logging enabled, the transaction becomes pending (and eventually visible) only once the flush thread of the
+  // WriteAheadLog has made its records durable. Commits of concurrent transactions share a single flush.
+  auto& write_ahead_log = Hyrise::get().write_ahead_log;
+  if (write_ahead_log.is_enabled()) {
+    write_ahead_log.log_commit(commit_id(), [context = shared_from_this(), callback]() {
+      context->_mark_as_pending_and_try_commit(callback);
+    });
+    return;
+  }
+
   _mark_as_pending_and_try_commit(callback);
 }
 
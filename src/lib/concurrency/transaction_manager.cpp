@@ -34,6 +34,17 @@ std::shared_ptr<TransactionContext> TransactionManager::new_transaction_context(
   return std::make_shared<TransactionContext>(TransactionID{_next_transaction_id++}, snapshot_commit_id, auto_commit);
 }
 
+void TransactionManager::_set_last_commit_id(const CommitID commit_id) {
+  {
+    const auto lock = std::lock_guard<std::mutex>{_active_snapshot_commit_ids_mutex};
+    Assert(_active_snapshot_commit_ids.empty(), "Cannot set the last commit ID while transactions are active.");
+  }
+  Assert(commit_id >= _last_commit_id, "Commit IDs must not decrease.");
+
+  _last_commit_id = commit_id;
+  std::atomic_store(&_last_commit_context, std::make_shared<CommitContext>(commit_id));
+}
+
 void TransactionManager::_register_transaction(const CommitID snapshot_commit_id) {
   const auto lock = std::lock_guard<std::mutex>{_active_snapshot_commit_ids_mutex};
   _active_snapshot_commit_ids.insert(snapshot_commit_id);
@@ -70,14 +70,20 @@ class TransactionManager : public Noncopyable {
   TransactionManager();
   ~TransactionManager();
 
+  friend class CheckpointManager;
   friend class Hyrise;
   friend class TransactionContext;
+  friend class WriteAheadLog;
 
   TransactionManager& operator=(TransactionManager&& transaction_manager) noexcept;
 
   std::shared_ptr<CommitContext> _new_commit_context();
   void _try_increment_last_commit_id(const std::shared_ptr<CommitContext>& context);
 
+  // Used by the WriteAheadLog and the CheckpointManager after recovery so that new transactions continue after the
+  // recovered commit IDs. Must not be called while transactions are active.
+  void _set_last_commit_id(const CommitID commit_id);
+
   /**
    * The TransactionManager keeps track of issued snapshot-commit-ids,
    * which are in use by unfinished transactions.
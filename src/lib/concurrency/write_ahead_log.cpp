@@ -0,0 +1,593 @@
+#include "write_ahead_log.hpp"
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <boost/crc.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <set>
+
+#include "hyrise.hpp"
+#include "resolve_type.hpp"
+#include "storage/pos_lists/abstract_pos_list.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace hyrise;  // NOLINT
+
+// Every record starts with its payload size and the CRC32 checksum of the payload.
+constexpr auto FRAME_HEADER_SIZE = sizeof(uint32_t) + sizeof(uint32_t);
+
+uint32_t checksum(const char* data, const size_t size) {
+  auto crc = boost::crc_32_type{};
+  crc.process_bytes(data, size);
+  return crc.checksum();
+}
+
+class RecordWriter {
+ public:
+  RecordWriter(const WriteAheadLog::RecordType record_type, const CommitID commit_id) : _bytes(FRAME_HEADER_SIZE) {
+    write(record_type);
+    write(commit_id);
+  }
+
+  template <typename T>
+  void write(const T& value) {
+    if constexpr (std::is_same_v<T, pmr_string> || std::is_same_v<T, std::string>) {
+      write(static_cast<uint32_t>(value.size()));
+      _bytes.insert(_bytes.end(), value.begin(), value.end());
+    } else {
+      static_assert(std::is_trivially_copyable_v<T>, "Only trivially copyable types can be written as raw bytes.");
+      const auto* const begin = reinterpret_cast<const char*>(&value);
+      _bytes.insert(_bytes.end(), begin, begin + sizeof(T));
+    }
+  }
+
+  // Fills in the frame header and returns the record.
+  std::vector<char> finish() && {
+    const auto payload_size = static_cast<uint32_t>(_bytes.size() - FRAME_HEADER_SIZE);
+    const auto payload_checksum = checksum(_bytes.data() + FRAME_HEADER_SIZE, payload_size);
+    std::memcpy(_bytes.data(), &payload_size, sizeof(uint32_t));
+    std::memcpy(_bytes.data() + sizeof(uint32_t), &payload_checksum, sizeof(uint32_t));
+    return std::move(_bytes);
+  }
+
+ private:
+  std::vector<char> _bytes;
+};
+
+class RecordReader {
+ public:
+  RecordReader(const char* data, const size_t size) : _data(data), _remaining(size) {}
+
+  template <typename T>
+  T read() {
+    if constexpr (std::is_same_v<T, pmr_string> || std::is_same_v<T, std::string>) {
+      const auto size = read<uint32_t>();
+      Assert(size <= _remaining, "Malformed log record.");
+      auto value = T{_data, size};
+      _data += size;
+      _remaining -= size;
+      return value;
+    } else {
+      Assert(sizeof(T) <= _remaining, "Malformed log record.");
+      auto value = T{};
+      std::memcpy(&value, _data, sizeof(T));
+      _data += sizeof(T);
+      _remaining -= sizeof(T);
+      return value;
+    }
+  }
+
+ private:
+  const char* _data;
+  size_t _remaining;
+};
+
+// Decoded redo record. Commit records only mark their commit ID as committed and are not stored.
+struct RedoRecord {
+  WriteAheadLog::RecordType type;
+  std::string table_name;
+  RowID first_row_id;
+  std::vector<std::vector<AllTypeVariant>> rows;
+  std::vector<RowID> deleted_row_ids;
+};
+
+RedoRecord decode_insert(RecordReader& reader) {
+  auto record = RedoRecord{WriteAheadLog::RecordType::Insert, reader.read<std::string>(), NULL_ROW_ID, {}, {}};
+  record.first_row_id.chunk_id = reader.read<ChunkID>();
+  record.first_row_id.chunk_offset = reader.read<ChunkOffset>();
+  const auto row_count = reader.read<uint32_t>();
+  const auto column_count = reader.read<uint16_t>();
+
+  record.rows.resize(row_count, std::vector<AllTypeVariant>(column_count));
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    resolve_data_type(reader.read<DataType>(), [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+      for (auto& row : record.rows) {
+        if (reader.read<bool>()) {
+          row[column_id] = NULL_VALUE;
+        } else {
+          row[column_id] = reader.read<ColumnDataType>();
+        }
+      }
+    });
+  }
+  return record;
+}
+
+RedoRecord decode_delete(RecordReader& reader) {
+  auto record = RedoRecord{WriteAheadLog::RecordType::Delete, reader.read<std::string>(), NULL_ROW_ID, {}, {}};
+  const auto row_count = reader.read<uint32_t>();
+  record.deleted_row_ids.resize(row_count);
+  for (auto& row_id : record.deleted_row_ids) {
+    row_id.chunk_id = reader.read<ChunkID>();
+    row_id.chunk_offset = reader.read<ChunkOffset>();
+  }
+  return record;
+}
+
+std::vector<char> read_log(const std::filesystem::path& path) {
+  auto file = std::ifstream{path, std::ios::binary};
+  Assert(file.is_open(), "Cannot read write-ahead log " + path.string());
+  return std::vector<char>{std::istreambuf_iterator<char>{file}, std::istreambuf_iterator<char>{}};
+}
+
+struct Frame {
+  size_t offset;
+  size_t size;
+  WriteAheadLog::RecordType record_type;
+  CommitID commit_id;
+};
+
+// Returns the valid frames of the log. A frame that exceeds the log or whose checksum does not match (i.e., the torn
+// write of the last flush before a crash) and everything after it is ignored.
+std::vector<Frame> read_frames(const std::vector<char>& log) {
+  auto frames = std::vector<Frame>{};
+  auto offset = size_t{0};
+  while (offset + FRAME_HEADER_SIZE <= log.size()) {
+    auto payload_size = uint32_t{};
+    auto payload_checksum = uint32_t{};
+    std::memcpy(&payload_size, log.data() + offset, sizeof(uint32_t));
+    std::memcpy(&payload_checksum, log.data() + offset + sizeof(uint32_t), sizeof(uint32_t));
+
+    const auto* const payload = log.data() + offset + FRAME_HEADER_SIZE;
+    if (offset + FRAME_HEADER_SIZE + payload_size > log.size() || checksum(payload, payload_size) != payload_checksum) {
+      break;
+    }
+
+    auto reader = RecordReader{payload, payload_size};
+    const auto record_type = reader.read<WriteAheadLog::RecordType>();
+    const auto commit_id = reader.read<CommitID>();
+    frames.emplace_back(Frame{offset, FRAME_HEADER_SIZE + payload_size, record_type, commit_id});
+    offset += FRAME_HEADER_SIZE + payload_size;
+  }
+  return frames;
+}
+
+// Atomically replaces the log at `path` with the given frames of `log`.
+void rewrite_log(const std::filesystem::path& path, const std::vector<char>& log, const std::vector<Frame>& frames) {
+  auto temporary_path = path;
+  temporary_path += ".tmp";
+  {
+    auto temporary_file = std::ofstream{temporary_path, std::ios::binary | std::ios::trunc};
+    for (const auto& frame : frames) {
+      temporary_file.write(log.data() + frame.offset, static_cast<std::streamsize>(frame.size));
+    }
+    Assert(temporary_file.good(), "Cannot write " + temporary_path.string());
+  }
+
+  const auto file_descriptor = ::open(temporary_path.c_str(), O_RDONLY);
+  Assert(file_descriptor >= 0 && ::fsync(file_descriptor) == 0, "Cannot sync " + temporary_path.string());
+  ::close(file_descriptor);
+  std::filesystem::rename(temporary_path, path);
+}
+
+// Rows that were added in front of replayed rows to restore their positions. See replay_insert().
+using PaddingRows = std::vector<std::pair<std::shared_ptr<Chunk>, ChunkOffset>>;
+
+void replay_insert(const RedoRecord& record, const CommitID commit_id, PaddingRows& padding_rows) {
+  auto& storage_manager = Hyrise::get().storage_manager;
+  Assert(storage_manager.has_table(record.table_name), "Cannot replay insert into unknown table " + record.table_name);
+  const auto table = storage_manager.get_table(record.table_name);
+  Assert(table->uses_mvcc() == UseMvcc::Yes, "Cannot replay inserts into tables without MVCC data.");
+
+  const auto chunk_id = record.first_row_id.chunk_id;
+  while (table->chunk_count() <= chunk_id) {
+    table->append_mutable_chunk();
+  }
+  const auto chunk = table->get_chunk(chunk_id);
+  const auto& mvcc_data = chunk->mvcc_data();
+  auto chunk_offset = record.first_row_id.chunk_offset;
+  auto row_iter = record.rows.begin();
+
+  // The rows might already exist but not be committed yet: a checkpoint written by the CheckpointManager might contain
+  // the rows of transactions that committed after its snapshot, and transactions that committed earlier might have
+  // added padding rows at their positions (see below). We only have to commit them. Their values might be incomplete
+  // or missing, so they are overwritten if the chunk is still mutable.
+  for (; row_iter != record.rows.end() && chunk_offset < chunk->size(); ++row_iter, ++chunk_offset) {
+    Assert(mvcc_data->get_begin_cid(chunk_offset) == MvccData::MAX_COMMIT_ID,
+           "Log does not match the table: row was already committed.");
+
+    if (chunk->is_mutable()) {
+      for (auto column_id = ColumnID{0}; column_id < table->column_count(); ++column_id) {
+        resolve_data_type(table->column_data_type(column_id), [&](const auto data_type_t) {
+          using ColumnDataType = typename decltype(data_type_t)::type;
+          auto& value_segment = static_cast<ValueSegment<ColumnDataType>&>(*chunk->get_segment(column_id));
+          const auto& value = (*row_iter)[column_id];
+          if (variant_is_null(value)) {
+            value_segment.set_null_value(chunk_offset);
+          } else {
+            value_segment.values()[chunk_offset] = boost::get<ColumnDataType>(value);
+          }
+        });
+      }
+    }
+
+    mvcc_data->set_begin_cid(chunk_offset, commit_id);
+  }
+
+  if (row_iter == record.rows.end()) {
+    return;
+  }
+  Assert(chunk->is_mutable(), "Log does not match the table: rows were inserted into an immutable chunk.");
+
+  // Rows in front of the logged ones belong to transactions that commit later (transactions do not necessarily commit
+  // in the order in which they inserted their rows), that have been rolled back, or that are not part of the replayed
+  // prefix. We add padding rows as not yet committed, so that all RowIDs match the logged ones. Later records fill
+  // them. Padding rows that are still unclaimed at the end of the recovery are invalidated.
+  const auto column_count = table->column_count();
+  auto invalid_row = std::vector<AllTypeVariant>(column_count);
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    if (table->column_is_nullable(column_id)) {
+      invalid_row[column_id] = NULL_VALUE;
+      continue;
+    }
+
+    resolve_data_type(table->column_data_type(column_id), [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+      invalid_row[column_id] = ColumnDataType{};
+    });
+  }
+
+  while (chunk->size() < chunk_offset) {
+    const auto padding_chunk_offset = chunk->size();
+    chunk->append(invalid_row);
+    mvcc_data->set_begin_cid(padding_chunk_offset, MvccData::MAX_COMMIT_ID);
+    padding_rows.emplace_back(chunk, padding_chunk_offset);
+  }
+
+  for (; row_iter != record.rows.end(); ++row_iter, ++chunk_offset) {
+    chunk->append(*row_iter);
+    mvcc_data->set_begin_cid(chunk_offset, commit_id);
+  }
+}
+
+void invalidate_unclaimed_padding_rows(const PaddingRows& padding_rows) {
+  for (const auto& [chunk, chunk_offset] : padding_rows) {
+    const auto& mvcc_data = chunk->mvcc_data();
+    if (mvcc_data->get_begin_cid(chunk_offset) != MvccData::MAX_COMMIT_ID) {
+      continue;
+    }
+
+    mvcc_data->set_begin_cid(chunk_offset, CommitID{0});
+    mvcc_data->set_end_cid(chunk_offset, CommitID{0});
+    chunk->increase_invalid_row_count(ChunkOffset{1});
+  }
+}
+
+void replay_delete(const RedoRecord& record, const CommitID commit_id) {
+  auto& storage_manager = Hyrise::get().storage_manager;
+  Assert(storage_manager.has_table(record.table_name), "Cannot replay delete from unknown table " + record.table_name);
+  const auto table = storage_manager.get_table(record.table_name);
+
+  for (const auto& row_id : record.deleted_row_ids) {
+    Assert(row_id.chunk_id < table->chunk_count(), "Log does not match the table: deleted row does not exist.");
+    const auto chunk = table->get_chunk(row_id.chunk_id);
+    Assert(row_id.chunk_offset < chunk->size(), "Log does not match the table: deleted row does not exist.");
+
+    chunk->mvcc_data()->set_end_cid(row_id.chunk_offset, commit_id);
+    chunk->increase_invalid_row_count(ChunkOffset{1});
+  }
+}
+
+}  // namespace
+
+namespace hyrise {
+
+WriteAheadLog::~WriteAheadLog() {
+  close();
+}
+
+WriteAheadLog& WriteAheadLog::operator=(WriteAheadLog&& write_ahead_log) noexcept {
+  // Only used by Hyrise::reset(), where the new log has not been opened yet.
+  DebugAssert(!write_ahead_log.is_enabled(), "Cannot move an open WriteAheadLog.");
+  close();
+  return *this;
+}
+
+size_t WriteAheadLog::open(const std::filesystem::path& path) {
+  Assert(!is_enabled(), "WriteAheadLog is already open.");
+
+  const auto replayed_transaction_count = _recover(path);
+
+  _path = path;
+  _file_descriptor = ::open(path.c_str(), O_WRONLY | O_CREAT | O_APPEND, 0644);
+  Assert(_file_descriptor >= 0, "Cannot open write-ahead log " + path.string() + ": " + std::strerror(errno));
+
+  _shutdown = false;
+  _flush_thread = std::thread{&WriteAheadLog::_flush_loop, this};
+  _enabled = true;
+
+  return replayed_transaction_count;
+}
+
+void WriteAheadLog::close() {
+  if (!_enabled.exchange(false)) {
+    return;
+  }
+
+  {
+    const auto lock = std::lock_guard<std::mutex>{_mutex};
+    _shutdown = true;
+  }
+  _condition.notify_one();
+  _flush_thread.join();
+
+  ::close(_file_descriptor);
+  _file_descriptor = -1;
+}
+
+bool WriteAheadLog::is_enabled() const {
+  return _enabled;
+}
+
+void WriteAheadLog::truncate(const CommitID commit_id) {
+  Assert(is_enabled(), "Cannot truncate a closed WriteAheadLog.");
+
+  // Blocks the flush thread while the file is replaced. Records that were already written are part of the file we
+  // read, records that are appended meanwhile wait in the buffer.
+  const auto lock = std::lock_guard<std::mutex>{_file_mutex};
+
+  const auto log = read_log(_path);
+  const auto frames = read_frames(log);
+  auto kept_frames = std::vector<Frame>{};
+  std::copy_if(frames.begin(), frames.end(), std::back_inserter(kept_frames),
+               [&](const auto& frame) { return frame.commit_id > commit_id; });
+  if (kept_frames.size() == frames.size()) {
+    return;
+  }
+
+  rewrite_log(_path, log, kept_frames);
+
+  ::close(_file_descriptor);
+  _file_descriptor = ::open(_path.c_str(), O_WRONLY | O_APPEND);
+  Assert(_file_descriptor >= 0, "Cannot open write-ahead log " + _path.string() + ": " + std::strerror(errno));
+}
+
+void WriteAheadLog::log_insert(const CommitID commit_id, const std::string& table_name,
+                               const std::shared_ptr<const Table>& table, const ChunkID chunk_id,
+                               const ChunkOffset begin_chunk_offset, const ChunkOffset end_chunk_offset) {
+  auto writer = RecordWriter{RecordType::Insert, commit_id};
+  writer.write(table_name);
+  writer.write(chunk_id);
+  writer.write(begin_chunk_offset);
+  writer.write(static_cast<uint32_t>(end_chunk_offset - begin_chunk_offset));
+
+  const auto chunk = table->get_chunk(chunk_id);
+  const auto column_count = static_cast<uint16_t>(table->column_count());
+  writer.write(column_count);
+
+  // Values are stored column by column, as this allows us to resolve each segment's type only once.
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    const auto data_type = table->column_data_type(column_id);
+    writer.write(data_type);
+
+    resolve_data_type(data_type, [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+      const auto value_segment =
+          std::dynamic_pointer_cast<const ValueSegment<ColumnDataType>>(chunk->get_segment(column_id));
+      Assert(value_segment, "Inserted rows are expected to be stored in ValueSegments.");
+
+      const auto& values = value_segment->values();
+      for (auto chunk_offset = begin_chunk_offset; chunk_offset < end_chunk_offset; ++chunk_offset) {
+        const auto is_null = value_segment->is_null(chunk_offset);
+        writer.write(is_null);
+        if (!is_null) {
+          writer.write(values[chunk_offset]);
+        }
+      }
+    });
+  }
+
+  _append(std::move(writer).finish());
+}
+
+void WriteAheadLog::log_delete(const CommitID commit_id, const std::shared_ptr<const Table>& table,
+                               const AbstractPosList& row_ids) {
+  auto writer = RecordWriter{RecordType::Delete, commit_id};
+  writer.write(_table_name(table));
+  writer.write(static_cast<uint32_t>(row_ids.size()));
+  for (const auto& row_id : row_ids) {
+    writer.write(row_id.chunk_id);
+    writer.write(row_id.chunk_offset);
+  }
+
+  _append(std::move(writer).finish());
+}
+
+void WriteAheadLog::log_commit(const CommitID commit_id, std::function<void()>&& on_durable) {
+  _append(RecordWriter{RecordType::Commit, commit_id}.finish(), std::move(on_durable));
+}
+
+void WriteAheadLog::_append(std::vector<char>&& record, std::function<void()>&& on_durable) {
+  // Only commits have to wait for the flush. Other records are written together with the next commit record.
+  const auto is_commit = static_cast<bool>(on_durable);
+  {
+    const auto lock = std::lock_guard<std::mutex>{_mutex};
+    if (_buffer.empty()) {
+      _buffer = std::move(record);
+    } else {
+      _buffer.insert(_buffer.end(), record.begin(), record.end());
+    }
+
+    if (on_durable) {
+      _callbacks.emplace_back(std::move(on_durable));
+    }
+  }
+
+  if (is_commit) {
+    _condition.notify_one();
+  }
+}
+
+void WriteAheadLog::_flush_loop() {
+  auto buffer = std::vector<char>{};
+  auto callbacks = std::vector<std::function<void()>>{};
+
+  while (true) {
+    {
+      auto lock = std::unique_lock<std::mutex>{_mutex};
+      _condition.wait(lock, [&] { return !_callbacks.empty() || _shutdown; });
+      if (_shutdown && _buffer.empty()) {
+        return;
+      }
+
+      // Everything that was appended so far is flushed together (group commit). New records are collected in the
+      // (now empty) buffer while we are waiting for the disk.
+      std::swap(buffer, _buffer);
+      std::swap(callbacks, _callbacks);
+    }
+
+    {
+      // truncate() might replace the file meanwhile.
+      const auto file_lock = std::lock_guard<std::mutex>{_file_mutex};
+      auto bytes_written = size_t{0};
+      while (bytes_written < buffer.size()) {
+        const auto result = ::write(_file_descriptor, buffer.data() + bytes_written, buffer.size() - bytes_written);
+        Assert(result >= 0 || errno == EINTR,
+               std::string{"Writing the write-ahead log failed: "} + std::strerror(errno));
+        bytes_written += std::max(result, ssize_t{0});
+      }
+      const auto sync_result = ::fdatasync(_file_descriptor);
+      Assert(sync_result == 0, std::string{"Syncing the write-ahead log failed: "} + std::strerror(errno));
+    }
+
+    for (const auto& callback : callbacks) {
+      callback();
+    }
+
+    buffer.clear();
+    callbacks.clear();
+  }
+}
+
+std::string WriteAheadLog::_table_name(const std::shared_ptr<const Table>& table) {
+  const auto& storage_manager = Hyrise::get().storage_manager;
+  const auto lock = std::lock_guard<std::mutex>{_table_names_mutex};
+
+  // Tables might have been dropped or replaced since the cache was built.
+  const auto cached_name = _table_names.find(table.get());
+  if (cached_name != _table_names.end() && storage_manager.has_table(cached_name->second) &&
+      storage_manager.get_table(cached_name->second) == table) {
+    return cached_name->second;
+  }
+
+  _table_names.clear();
+  for (const auto& [name, stored_table] : storage_manager.tables()) {
+    _table_names.emplace(stored_table.get(), name);
+  }
+
+  const auto name = _table_names.find(table.get());
+  Assert(name != _table_names.end(), "Logged table is not part of the StorageManager.");
+  return name->second;
+}
+
+size_t WriteAheadLog::_recover(const std::filesystem::path& path) {
+  if (!std::filesystem::exists(path)) {
+    return 0;
+  }
+
+  const auto log = read_log(path);
+  const auto frames = read_frames(log);
+
+  auto records_by_commit_id = std::map<CommitID, std::vector<RedoRecord>>{};
+  auto committed_commit_ids = std::set<CommitID>{};
+  for (const auto& frame : frames) {
+    const auto payload_size = frame.size - FRAME_HEADER_SIZE;
+    auto reader = RecordReader{log.data() + frame.offset + FRAME_HEADER_SIZE, payload_size};
+    reader.read<RecordType>();
+    reader.read<CommitID>();
+    switch (frame.record_type) {
+      case RecordType::Insert:
+        records_by_commit_id[frame.commit_id].emplace_back(decode_insert(reader));
+        break;
+      case RecordType::Delete:
+        records_by_commit_id[frame.commit_id].emplace_back(decode_delete(reader));
+        break;
+      case RecordType::Commit:
+        committed_commit_ids.emplace(frame.commit_id);
+        break;
+    }
+  }
+
+  // Transactions up to the last commit ID are already part of the loaded tables (e.g., the checkpoint).
+  auto& transaction_manager = Hyrise::get().transaction_manager;
+  auto last_replayed_commit_id = transaction_manager.last_commit_id();
+  auto replayed_transaction_count = size_t{0};
+  auto padding_rows = PaddingRows{};
+
+  for (auto commit_id_iter = committed_commit_ids.upper_bound(last_replayed_commit_id);
+       commit_id_iter != committed_commit_ids.end(); ++commit_id_iter) {
+    const auto commit_id = *commit_id_iter;
+    // This also applies to the first replayed transaction: if the log does not continue right after the loaded
+    // tables, the missing transactions cannot be restored.
+    if (commit_id != last_replayed_commit_id + 1) {
+      Hyrise::get().log_manager.add_message("WriteAheadLog",
+                                            "Stopped recovery at missing commit ID " +
+                                                std::to_string(last_replayed_commit_id + 1) + ".",
+                                            LogLevel::Warning);
+      break;
+    }
+
+    for (const auto& record : records_by_commit_id[commit_id]) {
+      if (record.type == RecordType::Insert) {
+        replay_insert(record, commit_id, padding_rows);
+      } else {
+        replay_delete(record, commit_id);
+      }
+    }
+
+    last_replayed_commit_id = commit_id;
+    ++replayed_transaction_count;
+  }
+
+  invalidate_unclaimed_padding_rows(padding_rows);
+
+  if (replayed_transaction_count > 0) {
+    transaction_manager._set_last_commit_id(last_replayed_commit_id);
+  }
+
+  // Records of transactions that were not replayed (i.e., that never became visible) and torn writes are removed from
+  // the log. Otherwise, they would be mistaken for records of new transactions that reuse their commit IDs.
+  const auto valid_size = frames.empty() ? size_t{0} : frames.back().offset + frames.back().size;
+  const auto is_discarded = [&](const auto& frame) { return frame.commit_id > last_replayed_commit_id; };
+  if (valid_size < log.size() || std::any_of(frames.begin(), frames.end(), is_discarded)) {
+    auto kept_frames = std::vector<Frame>{};
+    std::copy_if(frames.begin(), frames.end(), std::back_inserter(kept_frames),
+                 [&](const auto& frame) { return !is_discarded(frame); });
+    rewrite_log(path, log, kept_frames);
+  }
+
+  return replayed_transaction_count;
+}
+
+}  // namespace hyrise
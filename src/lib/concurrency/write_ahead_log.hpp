@@ -0,0 +1,111 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "types.hpp"
+
+namespace hyrise {
+
+class AbstractPosList;
+class Table;
+
+/**
+ * Redo log that makes committed inserts and deletes durable. It is disabled by default and enabled by open(), which
+ * first replays the existing log onto the tables in the StorageManager (i.e., the tables loaded from the last
+ * checkpoint) and then appends all further commits to the same file.
+ *
+ * Logging works as follows:
+ *   (i)   While committing, Insert and Delete append redo records to an in-memory buffer (see commit_records). Inserts
+ *         log the physical position and the values of the new rows, deletes log the RowIDs of the removed rows. As
+ *         Update is implemented as Delete + Insert, it does not need records of its own.
+ *   (ii)  The TransactionContext appends a commit record and hands over a callback that marks the transaction as
+ *         pending. The transaction is thus not visible to others before its records are durable.
+ *   (iii) A single flush thread writes the buffer to disk and calls fdatasync. All commits that arrive while a flush
+ *         is in progress are collected and made durable by the next flush (group commit), so the cost of the sync is
+ *         amortized over concurrent transactions.
+ *
+ * Each record is framed by its size and a CRC32 checksum, so that a record that was only partially written before a
+ * crash is detected and ignored during recovery. Recovery applies the committed transactions in the order of their
+ * commit IDs and stops at the first missing commit ID. Later transactions have never been visible, as commit IDs are
+ * made visible in order. Inserted rows are replayed at the positions they had originally. As transactions do not
+ * necessarily commit in the order in which they inserted, positions of rows that are inserted by later transactions
+ * are reserved until these transactions are replayed. Positions that are never claimed (e.g., by rolled-back
+ * transactions) are invalidated at the end of the recovery.
+ *
+ * After a checkpoint has been written, truncate() removes the records that are part of it, so the log does not grow
+ * without bounds.
+ *
+ * Limitations: DDL statements (e.g., CREATE TABLE) are not logged. As rows are replayed at their original positions,
+ * the tables have to have the chunk layout of the checkpoint (see CheckpointManager).
+ */
+class WriteAheadLog : public Noncopyable {
+ public:
+  enum class RecordType : uint8_t { Insert, Delete, Commit };
+
+  ~WriteAheadLog();
+
+  // Replays the log at `path` (if it exists) and starts logging to it. Returns the number of replayed transactions.
+  size_t open(const std::filesystem::path& path);
+
+  // Flushes all pending records and stops logging.
+  void close();
+
+  bool is_enabled() const;
+
+  // Removes the records of all transactions up to (and including) `commit_id` from the log. Called once a checkpoint
+  // that contains these transactions has been written.
+  void truncate(const CommitID commit_id);
+
+  // Appends the values of the rows [begin_chunk_offset, end_chunk_offset) of the given chunk to the log.
+  void log_insert(const CommitID commit_id, const std::string& table_name, const std::shared_ptr<const Table>& table,
+                  const ChunkID chunk_id, const ChunkOffset begin_chunk_offset, const ChunkOffset end_chunk_offset);
+
+  void log_delete(const CommitID commit_id, const std::shared_ptr<const Table>& table, const AbstractPosList& row_ids);
+
+  // Appends a commit record. The callback is executed (by the flush thread) as soon as the record is durable.
+  void log_commit(const CommitID commit_id, std::function<void()>&& on_durable);
+
+ protected:
+  friend class Hyrise;
+  friend class WriteAheadLogTest;
+
+  WriteAheadLog() = default;
+  WriteAheadLog& operator=(WriteAheadLog&& write_ahead_log) noexcept;
+
+  void _append(std::vector<char>&& record, std::function<void()>&& on_durable = nullptr);
+  void _flush_loop();
+
+  // Delete only knows the pointer of the table, but the log has to store its name.
+  std::string _table_name(const std::shared_ptr<const Table>& table);
+
+  // Replays the committed transactions of the log and returns their number. The file is truncated to the last valid
+  // record, so that new records are not appended after garbage.
+  static size_t _recover(const std::filesystem::path& path);
+
+  std::atomic_bool _enabled{false};
+  std::filesystem::path _path;
+  int _file_descriptor{-1};
+  // Protects the file (descriptor) against concurrent flushes and truncations.
+  std::mutex _file_mutex;
+  std::thread _flush_thread;
+
+  std::mutex _mutex;
+  std::condition_variable _condition;
+  bool _shutdown{false};
+  std::vector<char> _buffer;
+  std::vector<std::function<void()>> _callbacks;
+
+  std::mutex _table_names_mutex;
+  std::unordered_map<const Table*, std::string> _table_names;
+};
+
+}  // namespace hyrise
@@ -0,0 +1,401 @@
+#include "calibrated_cost_model.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "magic_enum.hpp"
+#include "nlohmann/json.hpp"
+
+#include "expression/expression_utils.hpp"
+#include "expression/pqp_column_expression.hpp"
+#include "hyrise.hpp"
+#include "operators/get_table.hpp"
+#include "operators/pqp_utils.hpp"
+#include "operators/table_scan.hpp"
+#include "storage/segment_encoding_utils.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace hyrise;  // NOLINT
+
+using Features = std::array<double, CostModelCoefficients::FEATURE_COUNT>;
+
+// Follows the scanned column of a TableScan down to the GetTable that it stems from. Only TableScans and Validates
+// are passed, as they do not change the column order.
+std::optional<EncodingType> scanned_encoding_type(const TableScan& table_scan) {
+  auto column_id = std::optional<ColumnID>{};
+  visit_expression(table_scan.predicate(), [&](const auto& expression) {
+    if (column_id) {
+      return ExpressionVisitation::DoNotVisitArguments;
+    }
+
+    if (const auto pqp_column_expression = std::dynamic_pointer_cast<PQPColumnExpression>(expression)) {
+      column_id = pqp_column_expression->column_id;
+      return ExpressionVisitation::DoNotVisitArguments;
+    }
+    return ExpressionVisitation::VisitArguments;
+  });
+
+  if (!column_id) {
+    return std::nullopt;
+  }
+
+  auto input = table_scan.left_input();
+  while (input && (input->type() == OperatorType::TableScan || input->type() == OperatorType::Validate)) {
+    input = input->left_input();
+  }
+
+  if (!input || input->type() != OperatorType::GetTable) {
+    return std::nullopt;
+  }
+
+  const auto& get_table = static_cast<const GetTable&>(*input);
+  auto stored_column_id = *column_id;
+  for (const auto pruned_column_id : get_table.pruned_column_ids()) {
+    if (pruned_column_id <= stored_column_id) {
+      ++stored_column_id;
+    }
+  }
+
+  return CalibratedCostModel::stored_column_encoding_type(get_table.table_name(), stored_column_id);
+}
+
+// Solves the least squares problem for the features marked as active using the normal equations. A small ridge term
+// keeps the system solvable if features are correlated.
+std::array<double, CostModelCoefficients::FEATURE_COUNT> solve_least_squares(
+    const std::vector<Features>& features, const std::vector<double>& runtimes,
+    const std::array<bool, CostModelCoefficients::FEATURE_COUNT>& active_features) {
+  constexpr auto FEATURE_COUNT = CostModelCoefficients::FEATURE_COUNT;
+
+  auto active_feature_indices = std::vector<size_t>{};
+  for (auto feature_idx = size_t{0}; feature_idx < FEATURE_COUNT; ++feature_idx) {
+    if (active_features[feature_idx]) {
+      active_feature_indices.emplace_back(feature_idx);
+    }
+  }
+
+  const auto dimension = active_feature_indices.size();
+  auto matrix = std::vector<std::vector<double>>(dimension, std::vector<double>(dimension + 1, 0.0));
+  const auto sample_count = features.size();
+  for (auto sample_idx = size_t{0}; sample_idx < sample_count; ++sample_idx) {
+    for (auto row = size_t{0}; row < dimension; ++row) {
+      const auto row_feature = features[sample_idx][active_feature_indices[row]];
+      for (auto column = size_t{0}; column < dimension; ++column) {
+        matrix[row][column] += row_feature * features[sample_idx][active_feature_indices[column]];
+      }
+      matrix[row][dimension] += row_feature * runtimes[sample_idx];
+    }
+  }
+
+  for (auto row = size_t{0}; row < dimension; ++row) {
+    matrix[row][row] *= 1.0 + 1e-9;
+  }
+
+  // Gaussian elimination with partial pivoting.
+  for (auto pivot = size_t{0}; pivot < dimension; ++pivot) {
+    auto max_row = pivot;
+    for (auto row = pivot + 1; row < dimension; ++row) {
+      if (std::abs(matrix[row][pivot]) > std::abs(matrix[max_row][pivot])) {
+        max_row = row;
+      }
+    }
+    std::swap(matrix[pivot], matrix[max_row]);
+
+    if (matrix[pivot][pivot] == 0.0) {
+      continue;
+    }
+
+    for (auto row = pivot + 1; row < dimension; ++row) {
+      const auto factor = matrix[row][pivot] / matrix[pivot][pivot];
+      for (auto column = pivot; column <= dimension; ++column) {
+        matrix[row][column] -= factor * matrix[pivot][column];
+      }
+    }
+  }
+
+  auto solution = std::vector<double>(dimension, 0.0);
+  for (auto reverse_row = size_t{0}; reverse_row < dimension; ++reverse_row) {
+    const auto row = dimension - reverse_row - 1;
+    if (matrix[row][row] == 0.0) {
+      continue;
+    }
+
+    auto value = matrix[row][dimension];
+    for (auto column = row + 1; column < dimension; ++column) {
+      value -= matrix[row][column] * solution[column];
+    }
+    solution[row] = value / matrix[row][row];
+  }
+
+  auto coefficients = std::array<double, FEATURE_COUNT>{};
+  for (auto row = size_t{0}; row < dimension; ++row) {
+    coefficients[active_feature_indices[row]] = solution[row];
+  }
+  return coefficients;
+}
+
+// Non-negative least squares by repeatedly dropping the features with negative coefficients.
+CostModelCoefficients fit_coefficients(const std::vector<const CostModelSample*>& samples) {
+  constexpr auto FEATURE_COUNT = CostModelCoefficients::FEATURE_COUNT;
+
+  auto features = std::vector<Features>{};
+  auto runtimes = std::vector<double>{};
+  features.reserve(samples.size());
+  runtimes.reserve(samples.size());
+  for (const auto* sample : samples) {
+    features.emplace_back(CostModelCoefficients::features(sample->row_counts));
+    runtimes.emplace_back(static_cast<double>(sample->runtime.count()));
+  }
+
+  // Features that are zero for all samples (e.g., the right input row count of a TableScan) cannot be fitted.
+  auto active_features = std::array<bool, FEATURE_COUNT>{};
+  for (auto feature_idx = size_t{0}; feature_idx < FEATURE_COUNT; ++feature_idx) {
+    active_features[feature_idx] = std::any_of(features.begin(), features.end(), [&](const auto& sample_features) {
+      return sample_features[feature_idx] != 0.0;
+    });
+  }
+
+  auto values = std::array<double, FEATURE_COUNT>{};
+  for (auto iteration = size_t{0}; iteration < FEATURE_COUNT; ++iteration) {
+    values = solve_least_squares(features, runtimes, active_features);
+
+    auto all_non_negative = true;
+    for (auto feature_idx = size_t{0}; feature_idx < FEATURE_COUNT; ++feature_idx) {
+      if (values[feature_idx] < 0.0) {
+        active_features[feature_idx] = false;
+        values[feature_idx] = 0.0;
+        all_non_negative = false;
+      }
+    }
+
+    if (all_non_negative) {
+      break;
+    }
+  }
+
+  return CostModelCoefficients{values[0], values[1], values[2], values[3], values[4], values[5]};
+}
+
+nlohmann::json coefficients_to_json(const CostModelCoefficients& coefficients) {
+  return nlohmann::json{{"constant", coefficients.constant},
+                        {"left_input_row", coefficients.left_input_row},
+                        {"right_input_row", coefficients.right_input_row},
+                        {"output_row", coefficients.output_row},
+                        {"input_row_pair", coefficients.input_row_pair},
+                        {"sorted_input_row", coefficients.sorted_input_row}};
+}
+
+CostModelCoefficients coefficients_from_json(const nlohmann::json& json) {
+  auto coefficients = CostModelCoefficients{};
+  coefficients.constant = json.value("constant", 0.0);
+  coefficients.left_input_row = json.value("left_input_row", 0.0);
+  coefficients.right_input_row = json.value("right_input_row", 0.0);
+  coefficients.output_row = json.value("output_row", 0.0);
+  coefficients.input_row_pair = json.value("input_row_pair", 0.0);
+  coefficients.sorted_input_row = json.value("sorted_input_row", 0.0);
+  return coefficients;
+}
+
+}  // namespace
+
+namespace hyrise {
+
+std::array<double, CostModelCoefficients::FEATURE_COUNT> CostModelCoefficients::features(
+    const CostModelRowCounts& row_counts) {
+  const auto sorted_rows = [](const double row_count) {
+    return row_count > 1.0 ? row_count * std::log2(row_count) : 0.0;
+  };
+
+  return {1.0,
+          row_counts.left_input,
+          row_counts.right_input,
+          row_counts.output,
+          row_counts.left_input * row_counts.right_input,
+          sorted_rows(row_counts.left_input) + sorted_rows(row_counts.right_input)};
+}
+
+Cost CostModelCoefficients::estimate(const CostModelRowCounts& row_counts) const {
+  const auto row_count_features = features(row_counts);
+  const auto cost = constant * row_count_features[0] + left_input_row * row_count_features[1] +
+                    right_input_row * row_count_features[2] + output_row * row_count_features[3] +
+                    input_row_pair * row_count_features[4] + sorted_input_row * row_count_features[5];
+  return static_cast<Cost>(cost);
+}
+
+bool operator==(const CostModelCoefficients& lhs, const CostModelCoefficients& rhs) {
+  return lhs.constant == rhs.constant && lhs.left_input_row == rhs.left_input_row &&
+         lhs.right_input_row == rhs.right_input_row && lhs.output_row == rhs.output_row &&
+         lhs.input_row_pair == rhs.input_row_pair && lhs.sorted_input_row == rhs.sorted_input_row;
+}
+
+std::vector<CostModelSample> CalibratedCostModel::collect_samples(const std::shared_ptr<const AbstractOperator>& pqp) {
+  auto samples = std::vector<CostModelSample>{};
+
+  visit_pqp(pqp, [&](const auto& op) {
+    const auto& performance_data = *op->performance_data;
+    if (op->type() == OperatorType::ChunkPipeline || !op->executed() || !performance_data.has_output) {
+      return PQPVisitation::VisitInputs;
+    }
+
+    auto row_counts = CostModelRowCounts{};
+    row_counts.output = static_cast<double>(performance_data.output_row_count);
+    if (op->left_input()) {
+      row_counts.left_input = static_cast<double>(op->left_input()->performance_data->output_row_count);
+    }
+    if (op->right_input()) {
+      row_counts.right_input = static_cast<double>(op->right_input()->performance_data->output_row_count);
+    }
+
+    auto encoding_type = std::optional<EncodingType>{};
+    if (op->type() == OperatorType::TableScan) {
+      encoding_type = scanned_encoding_type(static_cast<const TableScan&>(*op));
+    }
+
+    samples.emplace_back(CostModelSample{op->type(), encoding_type, row_counts, performance_data.walltime});
+    return PQPVisitation::VisitInputs;
+  });
+
+  return samples;
+}
+
+CalibratedCostModel CalibratedCostModel::fit(const std::vector<CostModelSample>& samples) {
+  auto cost_model = CalibratedCostModel{};
+
+  auto samples_by_key = std::map<std::pair<OperatorType, std::optional<EncodingType>>,
+                                 std::vector<const CostModelSample*>>{};
+  auto total_runtime = 0.0;
+  auto total_row_count = 0.0;
+  for (const auto& sample : samples) {
+    samples_by_key[{sample.operator_type, std::nullopt}].emplace_back(&sample);
+    if (sample.encoding_type) {
+      samples_by_key[{sample.operator_type, sample.encoding_type}].emplace_back(&sample);
+    }
+
+    total_runtime += static_cast<double>(sample.runtime.count());
+    total_row_count += sample.row_counts.left_input + sample.row_counts.right_input + sample.row_counts.output;
+  }
+
+  for (const auto& [key, key_samples] : samples_by_key) {
+    cost_model.set_coefficients(key.first, key.second, fit_coefficients(key_samples));
+  }
+
+  if (total_row_count > 0.0) {
+    cost_model.fallback_nanoseconds_per_row = total_runtime / total_row_count;
+  }
+
+  return cost_model;
+}
+
+CalibratedCostModel CalibratedCostModel::load(const std::string& file_name) {
+  auto file = std::ifstream{file_name};
+  Assert(file.good(), "Cost model file does not exist: " + file_name);
+
+  auto json = nlohmann::json{};
+  file >> json;
+
+  auto cost_model = CalibratedCostModel{};
+  cost_model.fallback_nanoseconds_per_row = json.value("fallback_nanoseconds_per_row", 1.0);
+
+  for (const auto& operator_json : json.at("operators")) {
+    const auto operator_type_name = operator_json.at("operator_type").get<std::string>();
+    const auto operator_type = magic_enum::enum_cast<OperatorType>(operator_type_name);
+    AssertInput(operator_type, "Unknown operator type in cost model: " + operator_type_name);
+
+    auto encoding_type = std::optional<EncodingType>{};
+    if (operator_json.contains("encoding_type")) {
+      const auto encoding_type_name = operator_json.at("encoding_type").get<std::string>();
+      encoding_type = magic_enum::enum_cast<EncodingType>(encoding_type_name);
+      AssertInput(encoding_type, "Unknown encoding type in cost model: " + encoding_type_name);
+    }
+
+    const auto coefficients = coefficients_from_json(operator_json.at("coefficients"));
+    cost_model.set_coefficients(*operator_type, encoding_type, coefficients);
+  }
+
+  return cost_model;
+}
+
+void CalibratedCostModel::save(const std::string& file_name) const {
+  auto operators_json = nlohmann::json::array();
+  for (const auto& [key, coefficients] : _coefficients) {
+    auto operator_json = nlohmann::json{{"operator_type", magic_enum::enum_name(key.first)},
+                                        {"coefficients", coefficients_to_json(coefficients)}};
+    if (key.second) {
+      operator_json["encoding_type"] = magic_enum::enum_name(*key.second);
+    }
+    operators_json.push_back(operator_json);
+  }
+
+  const auto json =
+      nlohmann::json{{"fallback_nanoseconds_per_row", fallback_nanoseconds_per_row}, {"operators", operators_json}};
+
+  auto file = std::ofstream{file_name};
+  Assert(file.good(), "Cannot write cost model file: " + file_name);
+  file << json.dump(2) << '\n';
+}
+
+Cost CalibratedCostModel::estimate_cost(const OperatorType operator_type,
+                                        const std::optional<EncodingType>& encoding_type,
+                                        const CostModelRowCounts& row_counts) const {
+  if (encoding_type) {
+    const auto encoding_iter = _coefficients.find({operator_type, encoding_type});
+    if (encoding_iter != _coefficients.end()) {
+      return encoding_iter->second.estimate(row_counts);
+    }
+  }
+
+  const auto operator_iter = _coefficients.find({operator_type, std::nullopt});
+  if (operator_iter != _coefficients.end()) {
+    return operator_iter->second.estimate(row_counts);
+  }
+
+  return estimate_fallback_cost(row_counts);
+}
+
+Cost CalibratedCostModel::estimate_fallback_cost(const CostModelRowCounts& row_counts) const {
+  return static_cast<Cost>(fallback_nanoseconds_per_row *
+                           (row_counts.left_input + row_counts.right_input + row_counts.output));
+}
+
+bool CalibratedCostModel::has_coefficients(const OperatorType operator_type,
+                                           const std::optional<EncodingType>& encoding_type) const {
+  return _coefficients.contains({operator_type, encoding_type});
+}
+
+void CalibratedCostModel::set_coefficients(const OperatorType operator_type,
+                                           const std::optional<EncodingType>& encoding_type,
+                                           const CostModelCoefficients& coefficients) {
+  _coefficients.insert_or_assign({operator_type, encoding_type}, coefficients);
+}
+
+std::optional<EncodingType> CalibratedCostModel::stored_column_encoding_type(const std::string& table_name,
+                                                                              const ColumnID column_id) {
+  const auto& storage_manager = Hyrise::get().storage_manager;
+  if (!storage_manager.has_table(table_name)) {
+    return std::nullopt;
+  }
+
+  // Tables are usually encoded uniformly, so we look at the first chunk only.
+  const auto table = storage_manager.get_table(table_name);
+  if (table->chunk_count() == 0 || column_id >= table->column_count()) {
+    return std::nullopt;
+  }
+
+  const auto chunk = table->get_chunk(ChunkID{0});
+  if (!chunk) {
+    return std::nullopt;
+  }
+
+  return get_segment_encoding_spec(chunk->get_segment(column_id)).encoding_type;
+}
+
+}  // namespace hyrise
@@ -0,0 +1,107 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "operators/abstract_operator.hpp"
+#include "storage/encoding_type.hpp"
+#include "types.hpp"
+
+namespace hyrise {
+
+// Row counts of an operator's inputs and output, either measured during execution or estimated for an LQP node.
+struct CostModelRowCounts {
+  double left_input{0.0};
+  double right_input{0.0};
+  double output{0.0};
+};
+
+/**
+ * Coefficients of a linear cost function, in nanoseconds per unit of the respective feature. Besides the row counts,
+ * two features account for operators whose runtime does not grow linearly with their input: `input_row_pair` is the
+ * product of both input row counts (e.g., JoinNestedLoop or Product), `sorted_input_row` is n * log2(n), summed for
+ * both inputs (e.g., Sort or JoinSortMerge).
+ */
+struct CostModelCoefficients {
+  static constexpr auto FEATURE_COUNT = size_t{6};
+
+  static std::array<double, FEATURE_COUNT> features(const CostModelRowCounts& row_counts);
+
+  Cost estimate(const CostModelRowCounts& row_counts) const;
+
+  double constant{0.0};
+  double left_input_row{0.0};
+  double right_input_row{0.0};
+  double output_row{0.0};
+  double input_row_pair{0.0};
+  double sorted_input_row{0.0};
+};
+
+bool operator==(const CostModelCoefficients& lhs, const CostModelCoefficients& rhs);
+
+// The runtime of an executed operator. The encoding type is only set for TableScans on a single encoded column.
+struct CostModelSample {
+  OperatorType operator_type;
+  std::optional<EncodingType> encoding_type;
+  CostModelRowCounts row_counts;
+  std::chrono::nanoseconds runtime;
+};
+
+/**
+ * Cost model whose coefficients are calibrated on the hardware that Hyrise runs on. It is fitted to the runtimes of
+ * executed operators, which are recorded in their OperatorPerformanceData, and stored as a JSON file. The
+ * hyriseCostModelCalibration binary runs a set of calibration queries and writes such a file.
+ *
+ * Coefficients are kept per operator type and, for TableScans, per encoding type of the scanned column. Operators
+ * without calibrated coefficients are costed with the average runtime per processed row.
+ */
+class CalibratedCostModel {
+ public:
+  /**
+   * Returns a sample for each executed operator of @param pqp. ChunkPipelines are skipped, as their runtime comprises
+   * several fused operators.
+   */
+  static std::vector<CostModelSample> collect_samples(const std::shared_ptr<const AbstractOperator>& pqp);
+
+  /**
+   * Fits coefficients for each operator type (and each encoding type for TableScans) using a least squares
+   * regression. Coefficients are non-negative, so that costs grow with the row counts.
+   */
+  static CalibratedCostModel fit(const std::vector<CostModelSample>& samples);
+
+  static CalibratedCostModel load(const std::string& file_name);
+  void save(const std::string& file_name) const;
+
+  /**
+   * @return the estimated runtime in nanoseconds. If no coefficients for the @param encoding_type are known, those
+   *         for all encodings are used. If the @param operator_type is not calibrated, the fallback cost is used.
+   */
+  Cost estimate_cost(const OperatorType operator_type, const std::optional<EncodingType>& encoding_type,
+                     const CostModelRowCounts& row_counts) const;
+
+  // @return the estimated runtime in nanoseconds for operators without calibrated coefficients.
+  Cost estimate_fallback_cost(const CostModelRowCounts& row_counts) const;
+
+  bool has_coefficients(const OperatorType operator_type,
+                        const std::optional<EncodingType>& encoding_type = std::nullopt) const;
+  void set_coefficients(const OperatorType operator_type, const std::optional<EncodingType>& encoding_type,
+                        const CostModelCoefficients& coefficients);
+
+  // Returns the encoding type of the column @param column_id of a stored table or std::nullopt if it is unknown.
+  static std::optional<EncodingType> stored_column_encoding_type(const std::string& table_name,
+                                                                 const ColumnID column_id);
+
+  // Used for operators without calibrated coefficients.
+  double fallback_nanoseconds_per_row{1.0};
+
+ private:
+  std::map<std::pair<OperatorType, std::optional<EncodingType>>, CostModelCoefficients> _coefficients;
+};
+
+}  // namespace hyrise
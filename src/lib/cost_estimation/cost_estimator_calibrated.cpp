@@ -0,0 +1,182 @@
+#include "cost_estimator_calibrated.hpp"
+
+#include <memory>
+#include <optional>
+#include <utility>
+
+#include "expression/expression_utils.hpp"
+#include "expression/lqp_column_expression.hpp"
+#include "logical_query_plan/abstract_lqp_node.hpp"
+#include "logical_query_plan/join_node.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "logical_query_plan/union_node.hpp"
+#include "operators/join_hash.hpp"
+#include "operators/join_nested_loop.hpp"
+#include "operators/join_sort_merge.hpp"
+#include "operators/operator_join_predicate.hpp"
+#include "statistics/abstract_cardinality_estimator.hpp"
+#include "utils/assert.hpp"
+
+namespace hyrise {
+
+CostEstimatorCalibrated::CostEstimatorCalibrated(
+    const std::shared_ptr<AbstractCardinalityEstimator>& init_cardinality_estimator,
+    const std::shared_ptr<const CalibratedCostModel>& init_cost_model)
+    : AbstractCostEstimator(init_cardinality_estimator), cost_model(init_cost_model) {
+  Assert(cost_model, "CostEstimatorCalibrated requires a cost model.");
+}
+
+std::shared_ptr<AbstractCostEstimator> CostEstimatorCalibrated::new_instance() const {
+  return std::make_shared<CostEstimatorCalibrated>(cardinality_estimator->new_instance(), cost_model);
+}
+
+Cost CostEstimatorCalibrated::estimate_node_cost(const std::shared_ptr<AbstractLQPNode>& node) const {
+  const auto row_counts = _estimate_row_counts(node);
+
+  switch (node->type) {
+    case LQPNodeType::Join: {
+      const auto join_node = std::static_pointer_cast<JoinNode>(node);
+      if (join_node->join_mode == JoinMode::Cross) {
+        return cost_model->estimate_cost(OperatorType::Product, std::nullopt, row_counts);
+      }
+
+      if (join_node->index_side) {
+        return cost_model->estimate_cost(OperatorType::JoinIndex, std::nullopt, row_counts);
+      }
+
+      return cheapest_join_operator(join_node).second;
+    }
+
+    case LQPNodeType::Predicate: {
+      const auto& predicate_node = static_cast<const PredicateNode&>(*node);
+      if (predicate_node.scan_type == ScanType::IndexScan) {
+        return cost_model->estimate_cost(OperatorType::IndexScan, std::nullopt, row_counts);
+      }
+
+      return cost_model->estimate_cost(OperatorType::TableScan, _scanned_encoding_type(predicate_node), row_counts);
+    }
+
+    case LQPNodeType::Union: {
+      switch (static_cast<const UnionNode&>(*node).set_operation_mode) {
+        case SetOperationMode::Positions:
+          return cost_model->estimate_cost(OperatorType::UnionPositions, std::nullopt, row_counts);
+        case SetOperationMode::All:
+          return cost_model->estimate_cost(OperatorType::UnionAll, std::nullopt, row_counts);
+        case SetOperationMode::Unique:
+          return cost_model->estimate_cost(OperatorType::SetOperationHash, std::nullopt, row_counts);
+      }
+      Fail("Invalid enum value");
+    }
+
+    case LQPNodeType::Intersect:
+    case LQPNodeType::Except:
+      return cost_model->estimate_cost(OperatorType::SetOperationHash, std::nullopt, row_counts);
+
+    case LQPNodeType::Aggregate:
+      return cost_model->estimate_cost(OperatorType::Aggregate, std::nullopt, row_counts);
+
+    case LQPNodeType::Alias:
+      return cost_model->estimate_cost(OperatorType::Alias, std::nullopt, row_counts);
+
+    case LQPNodeType::Limit:
+      return cost_model->estimate_cost(OperatorType::Limit, std::nullopt, row_counts);
+
+    case LQPNodeType::Projection:
+      return cost_model->estimate_cost(OperatorType::Projection, std::nullopt, row_counts);
+
+    case LQPNodeType::Sort:
+      return cost_model->estimate_cost(OperatorType::Sort, std::nullopt, row_counts);
+
+    case LQPNodeType::StoredTable:
+      return cost_model->estimate_cost(OperatorType::GetTable, std::nullopt, row_counts);
+
+    case LQPNodeType::Validate:
+      return cost_model->estimate_cost(OperatorType::Validate, std::nullopt, row_counts);
+
+    case LQPNodeType::Window:
+      return cost_model->estimate_cost(OperatorType::WindowFunction, std::nullopt, row_counts);
+
+    default:
+      return cost_model->estimate_fallback_cost(row_counts);
+  }
+}
+
+std::pair<OperatorType, Cost> CostEstimatorCalibrated::cheapest_join_operator(
+    const std::shared_ptr<JoinNode>& join_node) const {
+  const auto& join_predicates = join_node->join_predicates();
+  Assert(!join_predicates.empty(), "Expected predicated join.");
+
+  const auto row_counts = _estimate_row_counts(join_node);
+  auto cheapest_join_operator = std::make_pair(
+      OperatorType::JoinNestedLoop, cost_model->estimate_cost(OperatorType::JoinNestedLoop, std::nullopt, row_counts));
+
+  // Predicates that the join operators cannot execute (e.g., `a + 1 = b`) are only supported by JoinNestedLoop.
+  const auto primary_predicate = OperatorJoinPredicate::from_expression(*join_predicates.front(),
+                                                                        *join_node->left_input(),
+                                                                        *join_node->right_input());
+  if (!primary_predicate) {
+    return cheapest_join_operator;
+  }
+
+  const auto join_configuration =
+      JoinConfiguration{join_node->join_mode, primary_predicate->predicate_condition,
+                        join_predicates.front()->arguments[0]->data_type(),
+                        join_predicates.front()->arguments[1]->data_type(), join_predicates.size() > 1};
+
+  const auto consider_join_operator = [&](const OperatorType operator_type) {
+    const auto cost = cost_model->estimate_cost(operator_type, std::nullopt, row_counts);
+    if (cost < cheapest_join_operator.second) {
+      cheapest_join_operator = std::make_pair(operator_type, cost);
+    }
+  };
+
+  if (JoinSortMerge::supports(join_configuration)) {
+    consider_join_operator(OperatorType::JoinSortMerge);
+  }
+
+  if (JoinHash::supports(join_configuration)) {
+    consider_join_operator(OperatorType::JoinHash);
+  }
+
+  return cheapest_join_operator;
+}
+
+CostModelRowCounts CostEstimatorCalibrated::_estimate_row_counts(const std::shared_ptr<AbstractLQPNode>& node) const {
+  auto row_counts = CostModelRowCounts{};
+  row_counts.output = cardinality_estimator->estimate_cardinality(node);
+  if (node->left_input()) {
+    row_counts.left_input = cardinality_estimator->estimate_cardinality(node->left_input());
+  }
+  if (node->right_input()) {
+    row_counts.right_input = cardinality_estimator->estimate_cardinality(node->right_input());
+  }
+  return row_counts;
+}
+
+std::optional<EncodingType> CostEstimatorCalibrated::_scanned_encoding_type(const PredicateNode& predicate_node) {
+  auto encoding_type = std::optional<EncodingType>{};
+  const auto predicate = predicate_node.predicate();
+  visit_expression(predicate, [&](const auto& expression) {
+    if (encoding_type) {
+      return ExpressionVisitation::DoNotVisitArguments;
+    }
+
+    const auto column_expression = std::dynamic_pointer_cast<LQPColumnExpression>(expression);
+    if (!column_expression) {
+      return ExpressionVisitation::VisitArguments;
+    }
+
+    const auto original_node = column_expression->original_node.lock();
+    if (original_node && original_node->type == LQPNodeType::StoredTable) {
+      const auto& table_name = static_cast<const StoredTableNode&>(*original_node).table_name;
+      const auto column_id = column_expression->original_column_id;
+      encoding_type = CalibratedCostModel::stored_column_encoding_type(table_name, column_id);
+    }
+    return ExpressionVisitation::DoNotVisitArguments;
+  });
+
+  return encoding_type;
+}
+
+}  // namespace hyrise
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <memory>
+#include <utility>
+
+#include "abstract_cost_estimator.hpp"
+#include "calibrated_cost_model.hpp"
+
+namespace hyrise {
+
+class JoinNode;
+class PredicateNode;
+
+/**
+ * Cost model for the estimated runtime of the physical operators, in nanoseconds. Based on a CalibratedCostModel, it
+ * distinguishes, e.g., a JoinHash from a JoinSortMerge or a scan on a dictionary-encoded column from one on an
+ * LZ4-encoded column. Joins are costed with the cheapest join operator that can execute them, which is also the one
+ * that the LQPTranslator chooses.
+ */
+class CostEstimatorCalibrated : public AbstractCostEstimator {
+ public:
+  CostEstimatorCalibrated(const std::shared_ptr<AbstractCardinalityEstimator>& init_cardinality_estimator,
+                          const std::shared_ptr<const CalibratedCostModel>& init_cost_model);
+
+  std::shared_ptr<AbstractCostEstimator> new_instance() const override;
+
+  Cost estimate_node_cost(const std::shared_ptr<AbstractLQPNode>& node) const override;
+
+  /**
+   * @return the cheapest of JoinHash, JoinSortMerge, and JoinNestedLoop that supports the predicated @param join_node
+   *         and its estimated cost.
+   */
+  std::pair<OperatorType, Cost> cheapest_join_operator(const std::shared_ptr<JoinNode>& join_node) const;
+
+  const std::shared_ptr<const CalibratedCostModel> cost_model;
+
+ private:
+  CostModelRowCounts _estimate_row_counts(const std::shared_ptr<AbstractLQPNode>& node) const;
+
+  // The encoding of the stored column that the predicate of @param predicate_node scans, if known.
+  static std::optional<EncodingType> _scanned_encoding_type(const PredicateNode& predicate_node);
+};
+
+}  // namespace hyrise
@@ -38,11 +38,19 @@ Cost CostEstimatorLogical::estimate_node_cost(const std::shared_ptr<AbstractLQPN
         case SetOperationMode::Positions:
           return left_input_row_count * std::log(left_input_row_count) +
                  right_input_row_count * std::log(right_input_row_count);
-        default:
-          Fail("Invalid enum value");
+        case SetOperationMode::All:
+          return left_input_row_count + right_input_row_count;
+        case SetOperationMode::Unique:
+          // Both inputs are hashed (see SetOperationHash).
+          return left_input_row_count + right_input_row_count + output_row_count;
       }
+      Fail("Invalid enum value");
     }
 
+    case LQPNodeType::Intersect:
+    case LQPNodeType::Except:
+      return left_input_row_count + right_input_row_count + output_row_count;
+
     case LQPNodeType::Predicate: {
       const auto predicate_node = std::static_pointer_cast<PredicateNode>(node);
       return left_input_row_count * _get_expression_cost_multiplier(predicate_node->predicate()) + output_row_count;
@@ -0,0 +1,78 @@
+#include "correlated_subquery_result_cache.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <mutex>
+
+#include <boost/container_hash/hash.hpp>
+
+#include "storage/table.hpp"
+
+namespace hyrise {
+
+CorrelatedSubqueryResultCache::CorrelatedSubqueryResultCache(const size_t memory_budget)
+    : _memory_budget(memory_budget) {}
+
+std::shared_ptr<const Table> CorrelatedSubqueryResultCache::get(const ParameterValues& parameter_values) const {
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  const auto iter = _results.find(parameter_values);
+  if (iter == _results.end()) {
+    return nullptr;
+  }
+  return iter->second;
+}
+
+bool CorrelatedSubqueryResultCache::try_set(const ParameterValues& parameter_values,
+                                            const std::shared_ptr<const Table>& result) {
+  // Estimate the memory usage outside of the lock. Sampling is sufficient, as we only need to bound the memory usage.
+  const auto result_memory_usage = result->memory_usage(MemoryUsageCalculationMode::Sampled);
+
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  if (_memory_usage + result_memory_usage > _memory_budget) {
+    return false;
+  }
+
+  // Another ExpressionEvaluator might have cached a result for the same parameter values in the meantime.
+  const auto inserted = _results.try_emplace(parameter_values, result).second;
+  if (inserted) {
+    _memory_usage += result_memory_usage;
+  }
+  return inserted;
+}
+
+void CorrelatedSubqueryResultCache::clear() {
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  _results.clear();
+  _memory_usage = 0;
+}
+
+size_t CorrelatedSubqueryResultCache::size() const {
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  return _results.size();
+}
+
+size_t CorrelatedSubqueryResultCache::memory_usage() const {
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  return _memory_usage;
+}
+
+size_t CorrelatedSubqueryResultCache::ParameterValuesHash::operator()(const ParameterValues& parameter_values) const {
+  auto hash = size_t{0};
+  for (const auto& value : parameter_values) {
+    boost::hash_combine(hash, std::hash<AllTypeVariant>{}(value));
+  }
+  return hash;
+}
+
+bool CorrelatedSubqueryResultCache::ParameterValuesEqual::operator()(const ParameterValues& lhs,
+                                                                    const ParameterValues& rhs) const {
+  return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end(), [](const auto& lhs_value, const auto& rhs_value) {
+    // NullValue == NullValue is false (see null_value.hpp), but both NULLs lead to the same subquery result.
+    if (variant_is_null(lhs_value) || variant_is_null(rhs_value)) {
+      return variant_is_null(lhs_value) && variant_is_null(rhs_value);
+    }
+    return lhs_value == rhs_value;
+  });
+}
+
+}  // namespace hyrise
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "all_type_variant.hpp"
+
+namespace hyrise {
+
+class Table;
+
+/**
+ * Caches the results of a correlated subquery (see PQPSubqueryExpression) by the values of its correlated parameters.
+ * Outer rows often share these values (think of a lookup per nation or per part). For such rows, the subquery's PQP
+ * is deep-copied and executed only once.
+ *
+ * The cache belongs to a single PQPSubqueryExpression and thus to a single execution of a query. It is shared by the
+ * ExpressionEvaluators of all chunks (which might run concurrently) and cleared once the operator that evaluates the
+ * expression has been executed. To bound its memory consumption, results are no longer added once the estimated
+ * memory usage of the cached tables exceeds the memory budget.
+ *
+ * Unlike in SQL comparisons, NULL parameter values are considered equal: a subquery returns the same result for the
+ * same NULL parameter.
+ */
+class CorrelatedSubqueryResultCache {
+ public:
+  // Values of the subquery's parameters, in the order of PQPSubqueryExpression::parameters.
+  using ParameterValues = std::vector<AllTypeVariant>;
+
+  static constexpr auto DEFAULT_MEMORY_BUDGET = size_t{64} * 1024 * 1024;
+
+  explicit CorrelatedSubqueryResultCache(const size_t memory_budget = DEFAULT_MEMORY_BUDGET);
+
+  // Returns the cached result for the given parameter values or nullptr if there is none.
+  std::shared_ptr<const Table> get(const ParameterValues& parameter_values) const;
+
+  // Caches the result if it fits into the memory budget. Returns whether it was cached.
+  bool try_set(const ParameterValues& parameter_values, const std::shared_ptr<const Table>& result);
+
+  void clear();
+
+  size_t size() const;
+  size_t memory_usage() const;
+
+  struct ParameterValuesHash {
+    size_t operator()(const ParameterValues& parameter_values) const;
+  };
+
+  struct ParameterValuesEqual {
+    bool operator()(const ParameterValues& lhs, const ParameterValues& rhs) const;
+  };
+
+ protected:
+  const size_t _memory_budget;
+
+  mutable std::mutex _mutex;
+  std::unordered_map<ParameterValues, std::shared_ptr<const Table>, ParameterValuesHash, ParameterValuesEqual>
+      _results;
+  size_t _memory_usage{0};
+};
+
+}  // namespace hyrise
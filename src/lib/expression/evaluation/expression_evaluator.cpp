@@ -2,6 +2,7 @@
 
 #include <iterator>
 #include <type_traits>
+#include <unordered_map>
 
 #include <boost/lexical_cast.hpp>
 #include <boost/variant/apply_visitor.hpp>
@@ -944,10 +945,36 @@ std::vector<std::shared_ptr<const Table>> ExpressionEvaluator::_evaluate_subquer
     _materialize_segment_if_not_yet_materialized(parameter.second);
   }
 
-  auto results = std::vector<std::shared_ptr<const Table>>{_output_row_count};
+  // Outer rows often share their parameter values. Thus, we group the rows by their parameter values and evaluate the
+  // subquery only once per group. The results are cached in the expression, so that groups seen in other chunks of the
+  // same query do not trigger another execution either.
+  using ParameterValues = CorrelatedSubqueryResultCache::ParameterValues;
+  auto rows_by_parameter_values =
+      std::unordered_map<ParameterValues, std::vector<ChunkOffset>, CorrelatedSubqueryResultCache::ParameterValuesHash,
+                         CorrelatedSubqueryResultCache::ParameterValuesEqual>{};
 
+  const auto parameter_count = expression.parameters.size();
   for (auto chunk_offset = ChunkOffset{0}; chunk_offset < static_cast<ChunkOffset>(_output_row_count); ++chunk_offset) {
-    results[chunk_offset] = _evaluate_subquery_expression_for_row(expression, chunk_offset);
+    auto parameter_values = ParameterValues{};
+    parameter_values.reserve(parameter_count);
+    for (const auto& [parameter_id, column_id] : expression.parameters) {
+      parameter_values.emplace_back(_segment_materializations[column_id]->value_as_variant(chunk_offset));
+    }
+    rows_by_parameter_values[std::move(parameter_values)].emplace_back(chunk_offset);
+  }
+
+  auto results = std::vector<std::shared_ptr<const Table>>{_output_row_count};
+  auto& result_cache = *expression.result_cache;
+  for (const auto& [parameter_values, chunk_offsets] : rows_by_parameter_values) {
+    auto result = result_cache.get(parameter_values);
+    if (!result) {
+      result = _evaluate_subquery_expression_for_row(expression, chunk_offsets.front());
+      result_cache.try_set(parameter_values, result);
+    }
+
+    for (const auto chunk_offset : chunk_offsets) {
+      results[chunk_offset] = result;
+    }
   }
 
   return results;
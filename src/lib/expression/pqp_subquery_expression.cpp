@@ -14,11 +14,15 @@ PQPSubqueryExpression::PQPSubqueryExpression(const std::shared_ptr<AbstractOpera
     : AbstractExpression(ExpressionType::PQPSubquery, {}),
       pqp(init_pqp),
       parameters(init_parameters),
+      result_cache(std::make_shared<CorrelatedSubqueryResultCache>()),
       _data_type_info(std::in_place, data_type, nullable) {}
 
 PQPSubqueryExpression::PQPSubqueryExpression(const std::shared_ptr<AbstractOperator>& init_pqp,
                                              const Parameters& init_parameters)
-    : AbstractExpression(ExpressionType::PQPSubquery, {}), pqp(init_pqp), parameters(init_parameters) {}
+    : AbstractExpression(ExpressionType::PQPSubquery, {}),
+      pqp(init_pqp),
+      parameters(init_parameters),
+      result_cache(std::make_shared<CorrelatedSubqueryResultCache>()) {}
 
 std::shared_ptr<AbstractExpression> PQPSubqueryExpression::_on_deep_copy(
     std::unordered_map<const AbstractOperator*, std::shared_ptr<AbstractOperator>>& copied_ops) const {
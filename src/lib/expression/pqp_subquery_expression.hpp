@@ -2,6 +2,7 @@
 
 #include "abstract_expression.hpp"
 #include "all_type_variant.hpp"
+#include "evaluation/correlated_subquery_result_cache.hpp"
 
 namespace hyrise {
 
@@ -12,6 +13,8 @@ class AbstractOperator;
  * a PQP.
  *
  * The parameters of a PQPSubqueryExpression are equivalent to the correlated parameters of a nested SELECT in SQL.
+ * The results of correlated subqueries are cached by their parameter values (see CorrelatedSubqueryResultCache). As
+ * the cache is not copied, each deep copy of the expression starts with an empty cache.
  */
 class PQPSubqueryExpression : public AbstractExpression {
  public:
@@ -37,6 +40,9 @@ class PQPSubqueryExpression : public AbstractExpression {
   const std::shared_ptr<AbstractOperator> pqp;
   const Parameters parameters;
 
+  // Results of correlated subqueries by their parameter values, used by the ExpressionEvaluator.
+  const std::shared_ptr<CorrelatedSubqueryResultCache> result_cache;
+
  protected:
   bool _shallow_equals(const AbstractExpression& expression) const override;
   size_t _shallow_hash() const override;
@@ -16,7 +16,9 @@ bool ValueExpression::requires_computation() const {
 
 std::shared_ptr<AbstractExpression> ValueExpression::_on_deep_copy(
     std::unordered_map<const AbstractOperator*, std::shared_ptr<AbstractOperator>>& /*copied_ops*/) const {
-  return std::make_shared<ValueExpression>(value);
+  auto copy = std::make_shared<ValueExpression>(value);
+  copy->value_placeholder_id = value_placeholder_id;
+  return copy;
 }
 
 std::string ValueExpression::description(const DescriptionMode /*mode*/) const {
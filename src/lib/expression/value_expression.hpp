@@ -1,7 +1,10 @@
 #pragma once
 
+#include <optional>
+
 #include "abstract_expression.hpp"
 #include "all_type_variant.hpp"
+#include "sql/parameter_id_allocator.hpp"
 
 namespace hyrise {
 
@@ -20,6 +23,11 @@ class ValueExpression : public AbstractExpression {
 
   const AllTypeVariant value;
 
+  // Set if the value was extracted from a literal of a parameterized SQL statement (see extract_sql_literals()).
+  // Identifies the literal so that the optimized plan can be turned back into a plan with placeholders. It is kept by
+  // deep_copy() but ignored for equality and hashing.
+  std::optional<ValuePlaceholderID> value_placeholder_id;
+
  protected:
   bool _shallow_equals(const AbstractExpression& expression) const override;
   size_t _shallow_hash() const override;
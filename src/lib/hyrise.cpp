@@ -16,15 +16,25 @@ Hyrise::Hyrise() {
   storage_manager = StorageManager{};
   plugin_manager = PluginManager{};
   transaction_manager = TransactionManager{};
+  write_ahead_log = WriteAheadLog{};
   meta_table_manager = MetaTableManager{};
   settings_manager = SettingsManager{};
+  admission_control = AdmissionControl{};
   log_manager = LogManager{};
   topology = Topology{};
   _scheduler = std::make_shared<ImmediateExecutionScheduler>();
+
+  // Settings of Hyrise's own components are reset together with the SettingsManager and thus registered here.
+  settings_manager._add(AdmissionControl::create_max_concurrent_queries_setting());
+  for (const auto& setting : StorageManager::create_statistics_generation_settings()) {
+    settings_manager._add(setting);
+  }
 }
 
 void Hyrise::reset() {
   Hyrise::get().scheduler()->finish();
+  // Flush pending commits while the TransactionManager that they belong to still exists.
+  Hyrise::get().write_ahead_log.close();
   get() = Hyrise{};
 }
 
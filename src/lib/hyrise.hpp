@@ -3,6 +3,8 @@
 #include <boost/container/pmr/memory_resource.hpp>
 
 #include "concurrency/transaction_manager.hpp"
+#include "concurrency/write_ahead_log.hpp"
+#include "scheduler/admission_control.hpp"
 #include "scheduler/immediate_execution_scheduler.hpp"
 #include "scheduler/topology.hpp"
 #include "sql/sql_plan_cache.hpp"
@@ -17,6 +19,7 @@ namespace hyrise {
 
 class AbstractScheduler;
 class BenchmarkRunner;
+class CalibratedCostModel;
 
 // This should be the only singleton in the src/lib world. It provides a unified way of accessing components like the
 // storage manager, the transaction manager, and more. Encapsulating this in one class avoids the static initialization
@@ -43,8 +46,11 @@ class Hyrise : public Singleton<Hyrise> {
   StorageManager storage_manager;
   PluginManager plugin_manager;
   TransactionManager transaction_manager;
+  // Destroyed before the TransactionManager, as its flush thread commits transactions.
+  WriteAheadLog write_ahead_log;
   MetaTableManager meta_table_manager;
   SettingsManager settings_manager;
+  AdmissionControl admission_control;
   LogManager log_manager;
   Topology topology;
 
@@ -53,6 +59,18 @@ class Hyrise : public Singleton<Hyrise> {
   std::shared_ptr<SQLPhysicalPlanCache> default_pqp_cache;
   std::shared_ptr<SQLLogicalPlanCache> default_lqp_cache;
 
+  // Parameterized LQP cache used by the SQLPipelineBuilder if `with_parameterized_lqp_cache()` is not used. As plans
+  // cached by it are shared by statements with different literals, it is nullptr (i.e., disabled) by default.
+  std::shared_ptr<SQLParameterizedPlanCache> default_parameterized_lqp_cache;
+
+  // Calibrated cost model used by the default optimizer for join ordering and by the LQPTranslator to choose the join
+  // operators. If it is nullptr (the default), the logical cost model is used and joins are translated to the
+  // preferred operator that supports them.
+  std::shared_ptr<const CalibratedCostModel> cost_model;
+
+  // Whether the LQPTranslator fuses chains of chunk-local operators into ChunkPipelines (see LQPTranslator).
+  bool use_chunk_pipelines{false};
+
   // The BenchmarkRunner is available here so that non-benchmark components can add information to the benchmark
   // result JSON.
   std::weak_ptr<BenchmarkRunner> benchmark_runner;
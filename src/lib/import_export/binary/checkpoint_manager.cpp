@@ -0,0 +1,483 @@
+#include "checkpoint_manager.hpp"
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <fstream>
+#include <unordered_set>
+
+#include "nlohmann/json.hpp"
+
+#include "binary_parser.hpp"
+#include "binary_writer.hpp"
+#include "concurrency/transaction_context.hpp"
+#include "hyrise.hpp"
+#include "resolve_type.hpp"
+#include "scheduler/job_task.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "utils/assert.hpp"
+#include "utils/pausable_loop_thread.hpp"
+
+namespace {
+
+using namespace hyrise;  // NOLINT
+
+const auto MANIFEST_FILE_NAME = std::string{"manifest.json"};
+
+void sync_file(const std::filesystem::path& path) {
+  const auto file_descriptor = ::open(path.c_str(), O_RDONLY);
+  Assert(file_descriptor >= 0, "Cannot open " + path.string());
+  const auto result = ::fsync(file_descriptor);
+  ::close(file_descriptor);
+  Assert(result == 0, "Cannot sync " + path.string());
+}
+
+/**
+ * MVCC files have the following layout:
+ *
+ * Description                 | Type                                | Size in bytes
+ * --------------------------------------------------------------------------------------------------------
+ * Row count                   | ChunkOffset                         | 4
+ * Begin commit IDs            | CommitID array                      | Row count * 4
+ * End commit IDs              | CommitID array                      | Row count * 4
+ */
+void write_mvcc_file(const std::filesystem::path& path, const std::vector<CommitID>& begin_cids,
+                     const std::vector<CommitID>& end_cids) {
+  {
+    auto ofstream = std::ofstream{};
+    ofstream.exceptions(std::ofstream::failbit | std::ofstream::badbit);
+    ofstream.open(path, std::ios::binary);
+
+    const auto row_count = static_cast<ChunkOffset::base_type>(begin_cids.size());
+    ofstream.write(reinterpret_cast<const char*>(&row_count), sizeof(row_count));
+    ofstream.write(reinterpret_cast<const char*>(begin_cids.data()), begin_cids.size() * sizeof(CommitID));
+    ofstream.write(reinterpret_cast<const char*>(end_cids.data()), end_cids.size() * sizeof(CommitID));
+  }
+  sync_file(path);
+}
+
+std::pair<std::vector<CommitID>, std::vector<CommitID>> read_mvcc_file(const std::filesystem::path& path) {
+  auto ifstream = std::ifstream{};
+  ifstream.exceptions(std::ifstream::failbit | std::ifstream::badbit);
+  ifstream.open(path, std::ios::binary);
+
+  auto row_count = ChunkOffset::base_type{0};
+  ifstream.read(reinterpret_cast<char*>(&row_count), sizeof(row_count));
+  auto begin_cids = std::vector<CommitID>(row_count);
+  auto end_cids = std::vector<CommitID>(row_count);
+  ifstream.read(reinterpret_cast<char*>(begin_cids.data()), row_count * sizeof(CommitID));
+  ifstream.read(reinterpret_cast<char*>(end_cids.data()), row_count * sizeof(CommitID));
+  return {std::move(begin_cids), std::move(end_cids)};
+}
+
+// Copies the first `row_count` rows of a mutable chunk into new ValueSegments of the given capacity. The caller has to
+// make sure that the segments do not grow concurrently. If `begin_cids` is given, rows whose insert has not finished
+// (i.e., whose begin commit ID is MAX_COMMIT_ID) are not read, as the inserting transaction might still be writing
+// their values. They are stored as default values (or NULL) instead. If they are committed later, the WriteAheadLog
+// replays their values.
+Segments copy_value_segments(const Table& table, const Chunk& chunk, const ChunkOffset row_count,
+                             const ChunkOffset capacity, const std::vector<CommitID>& begin_cids = {}) {
+  DebugAssert(begin_cids.empty() || begin_cids.size() == row_count, "Expected a begin commit ID per row.");
+  const auto is_complete = [&](const auto chunk_offset) {
+    return begin_cids.empty() || begin_cids[chunk_offset] != MvccData::MAX_COMMIT_ID;
+  };
+
+  auto segments = Segments{};
+  const auto column_count = table.column_count();
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    resolve_data_type(table.column_data_type(column_id), [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+      const auto value_segment =
+          std::dynamic_pointer_cast<const ValueSegment<ColumnDataType>>(chunk.get_segment(column_id));
+      Assert(value_segment, "Mutable chunks are expected to consist of ValueSegments.");
+
+      const auto is_nullable = table.column_is_nullable(column_id);
+      auto values = pmr_vector<ColumnDataType>{};
+      auto null_values = pmr_vector<bool>{};
+      values.reserve(capacity);
+      if (is_nullable) {
+        null_values.reserve(capacity);
+      }
+
+      const auto& source_values = value_segment->values();
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < row_count; ++chunk_offset) {
+        if (!is_complete(chunk_offset)) {
+          values.emplace_back();
+          if (is_nullable) {
+            null_values.emplace_back(true);
+          }
+          continue;
+        }
+
+        values.emplace_back(source_values[chunk_offset]);
+        if (is_nullable) {
+          null_values.emplace_back(value_segment->null_values()[chunk_offset]);
+        }
+      }
+
+      if (!is_nullable) {
+        segments.emplace_back(std::make_shared<ValueSegment<ColumnDataType>>(std::move(values)));
+        return;
+      }
+      segments.emplace_back(std::make_shared<ValueSegment<ColumnDataType>>(std::move(values), std::move(null_values)));
+    });
+  }
+  return segments;
+}
+
+nlohmann::json chunk_checkpoint_to_json(const CheckpointManager::ChunkCheckpoint& chunk_checkpoint) {
+  if (chunk_checkpoint.is_removed) {
+    return {{"removed", true}};
+  }
+
+  return {{"removed", false},
+          {"mutable", chunk_checkpoint.is_mutable},
+          {"data_file", chunk_checkpoint.data_file},
+          {"mvcc_file", chunk_checkpoint.mvcc_file},
+          {"row_count", static_cast<ChunkOffset::base_type>(chunk_checkpoint.row_count)}};
+}
+
+}  // namespace
+
+namespace hyrise {
+
+CheckpointManager::CheckpointManager(const std::filesystem::path& directory) : _directory(directory) {
+  std::filesystem::create_directories(_directory);
+}
+
+CheckpointManager::~CheckpointManager() {
+  // Stop the background thread before the members it uses are destroyed.
+  _loop_thread.reset();
+}
+
+CommitID CheckpointManager::create_checkpoint() {
+  const auto checkpoint_lock = std::lock_guard<std::mutex>{_checkpoint_mutex};
+
+  // The read-only transaction registers its snapshot commit ID as active, which prevents the MvccDeletePlugin from
+  // removing rows that are visible to it.
+  const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  const auto snapshot_commit_id = transaction_context->snapshot_commit_id();
+
+  auto tables = std::vector<std::pair<std::string, std::shared_ptr<Table>>>{};
+  for (const auto& [table_name, table] : Hyrise::get().storage_manager.tables()) {
+    tables.emplace_back(table_name, table);
+  }
+  std::sort(tables.begin(), tables.end(), [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+
+  // The chunk count is read after the snapshot was taken. All rows that are visible to the snapshot have been inserted
+  // before, so their chunks exist.
+  auto checkpoint = std::unordered_map<std::string, std::vector<ChunkCheckpoint>>{};
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  for (const auto& [table_name, table] : tables) {
+    std::filesystem::create_directories(_directory / table_name);
+
+    const auto chunk_count = table->chunk_count();
+    auto* const chunk_checkpoints = &checkpoint[table_name];
+    chunk_checkpoints->resize(chunk_count);
+
+    const auto previous_checkpoint_iter = _last_checkpoint.find(table_name);
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      const auto* previous_chunk_checkpoint = static_cast<const ChunkCheckpoint*>(nullptr);
+      if (previous_checkpoint_iter != _last_checkpoint.end() && chunk_id < previous_checkpoint_iter->second.size()) {
+        previous_chunk_checkpoint = &previous_checkpoint_iter->second[chunk_id];
+      }
+
+      jobs.emplace_back(std::make_shared<JobTask>([&, table_name = table_name, table = table, chunk_checkpoints,
+                                                   chunk_id, previous_chunk_checkpoint]() {
+        (*chunk_checkpoints)[chunk_id] =
+            _write_chunk(table_name, table, chunk_id, snapshot_commit_id, previous_chunk_checkpoint);
+      }));
+    }
+  }
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+  transaction_context->commit();
+
+  // Write the manifest. The checkpoint is only valid once the manifest has been renamed.
+  auto manifest = nlohmann::json{{"snapshot_commit_id", static_cast<CommitID::base_type>(snapshot_commit_id)},
+                                 {"tables", nlohmann::json::object()}};
+  auto referenced_files = std::unordered_set<std::string>{};
+  for (const auto& [table_name, table] : tables) {
+    auto columns = nlohmann::json::array();
+    for (const auto& column_definition : table->column_definitions()) {
+      columns.push_back({{"name", column_definition.name},
+                         {"data_type", data_type_to_string.left.at(column_definition.data_type)},
+                         {"nullable", column_definition.nullable}});
+    }
+
+    auto chunks = nlohmann::json::array();
+    for (const auto& chunk_checkpoint : checkpoint[table_name]) {
+      chunks.push_back(chunk_checkpoint_to_json(chunk_checkpoint));
+      referenced_files.emplace((_directory / chunk_checkpoint.data_file).string());
+      referenced_files.emplace((_directory / chunk_checkpoint.mvcc_file).string());
+    }
+
+    manifest["tables"][table_name] = {{"target_chunk_size", static_cast<ChunkOffset::base_type>(
+                                                                table->target_chunk_size())},
+                                      {"columns", columns},
+                                      {"chunks", chunks}};
+  }
+
+  const auto manifest_path = _directory / MANIFEST_FILE_NAME;
+  auto temporary_manifest_path = manifest_path;
+  temporary_manifest_path += ".tmp";
+  {
+    auto manifest_file = std::ofstream{temporary_manifest_path};
+    manifest_file << manifest.dump(2);
+    Assert(manifest_file.good(), "Cannot write " + temporary_manifest_path.string());
+  }
+  sync_file(temporary_manifest_path);
+  std::filesystem::rename(temporary_manifest_path, manifest_path);
+  sync_file(_directory);
+
+  // Remove the files of previous checkpoints that are no longer needed, including those of dropped tables.
+  for (const auto& table_directory : std::filesystem::directory_iterator{_directory}) {
+    if (!table_directory.is_directory()) {
+      continue;
+    }
+
+    if (!checkpoint.contains(table_directory.path().filename().string())) {
+      std::filesystem::remove_all(table_directory.path());
+      continue;
+    }
+
+    for (const auto& file : std::filesystem::directory_iterator{table_directory.path()}) {
+      if (!referenced_files.contains(file.path().string())) {
+        std::filesystem::remove(file.path());
+      }
+    }
+  }
+
+  // The log only has to contain the transactions that committed after the snapshot.
+  auto& write_ahead_log = Hyrise::get().write_ahead_log;
+  if (write_ahead_log.is_enabled()) {
+    write_ahead_log.truncate(snapshot_commit_id);
+  }
+
+  _last_checkpoint = std::move(checkpoint);
+  return snapshot_commit_id;
+}
+
+void CheckpointManager::start_periodic_checkpoints(const std::chrono::milliseconds interval) {
+  _loop_thread = std::make_unique<PausableLoopThread>(interval, [&](size_t /*counter*/) { create_checkpoint(); });
+}
+
+CheckpointManager::ChunkCheckpoint CheckpointManager::_write_chunk(
+    const std::string& table_name, const std::shared_ptr<Table>& table, const ChunkID chunk_id,
+    const CommitID snapshot_commit_id, const ChunkCheckpoint* previous_chunk_checkpoint) const {
+  auto chunk_checkpoint = ChunkCheckpoint{};
+  const auto chunk = table->get_chunk(chunk_id);
+
+  // Empty chunks other than the last one never receive any rows, as rows are only appended to the last chunk.
+  if (!chunk || (chunk->size() == 0 && chunk_id + 1 < table->chunk_count())) {
+    chunk_checkpoint.is_removed = true;
+    return chunk_checkpoint;
+  }
+
+  chunk_checkpoint.is_mutable = chunk->is_mutable();
+  const auto& mvcc_data = chunk->mvcc_data();
+
+  // The MVCC data is read before the values. Rows whose insert has been committed or rolled back by then are
+  // completely written, so their values can be copied safely.
+  auto begin_cids = std::vector<CommitID>{};
+  auto end_cids = std::vector<CommitID>{};
+  const auto read_mvcc_data = [&]() {
+    chunk_checkpoint.row_count = chunk->size();
+    begin_cids.resize(chunk_checkpoint.row_count);
+    end_cids.resize(chunk_checkpoint.row_count);
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_checkpoint.row_count; ++chunk_offset) {
+      begin_cids[chunk_offset] = mvcc_data->get_begin_cid(chunk_offset);
+      end_cids[chunk_offset] = mvcc_data->get_end_cid(chunk_offset);
+    }
+  };
+
+  auto segments = Segments{};
+  if (chunk_checkpoint.is_mutable) {
+    // Concurrent inserts grow mutable chunks. They only do so while holding the append mutex. However, they write the
+    // values of the new rows after releasing it, so only the values of rows whose insert has finished are copied.
+    const auto append_lock = table->acquire_append_mutex();
+    read_mvcc_data();
+    segments =
+        copy_value_segments(*table, *chunk, chunk_checkpoint.row_count, chunk_checkpoint.row_count, begin_cids);
+  } else {
+    read_mvcc_data();
+    const auto column_count = table->column_count();
+    for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+      segments.emplace_back(chunk->get_segment(column_id));
+    }
+  }
+
+  chunk_checkpoint.data_complete = std::none_of(begin_cids.begin(), begin_cids.end(), [](const auto begin_cid) {
+    return begin_cid == MvccData::MAX_COMMIT_ID;
+  });
+
+  // Hide all changes after the snapshot.
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_checkpoint.row_count; ++chunk_offset) {
+    if (begin_cids[chunk_offset] > snapshot_commit_id) {
+      begin_cids[chunk_offset] = MvccData::MAX_COMMIT_ID;
+    } else {
+      ++chunk_checkpoint.committed_row_count;
+    }
+
+    if (end_cids[chunk_offset] > snapshot_commit_id) {
+      end_cids[chunk_offset] = MvccData::MAX_COMMIT_ID;
+    } else {
+      ++chunk_checkpoint.ended_row_count;
+    }
+  }
+
+  if (chunk_checkpoint.row_count == 0) {
+    return chunk_checkpoint;
+  }
+
+  const auto file_prefix = std::filesystem::path{table_name} / (std::to_string(chunk_id) + "_" +
+                                                                std::to_string(snapshot_commit_id));
+
+  const auto is_same_data = previous_chunk_checkpoint && !previous_chunk_checkpoint->is_removed &&
+                            previous_chunk_checkpoint->is_mutable == chunk_checkpoint.is_mutable &&
+                            previous_chunk_checkpoint->row_count == chunk_checkpoint.row_count &&
+                            previous_chunk_checkpoint->data_complete;
+  if (is_same_data) {
+    chunk_checkpoint.data_file = previous_chunk_checkpoint->data_file;
+    chunk_checkpoint.data_complete = true;
+  } else {
+    auto data_chunk = std::make_shared<Chunk>(segments);
+    if (!chunk_checkpoint.is_mutable) {
+      data_chunk->finalize();
+      if (!chunk->individually_sorted_by().empty()) {
+        data_chunk->set_individually_sorted_by(chunk->individually_sorted_by());
+      }
+    }
+
+    const auto data_table = Table{table->column_definitions(), TableType::Data, {data_chunk}};
+    chunk_checkpoint.data_file = file_prefix.string() + ".bin";
+    BinaryWriter::write(data_table, (_directory / chunk_checkpoint.data_file).string());
+    sync_file(_directory / chunk_checkpoint.data_file);
+  }
+
+  if (is_same_data && previous_chunk_checkpoint->committed_row_count == chunk_checkpoint.committed_row_count &&
+      previous_chunk_checkpoint->ended_row_count == chunk_checkpoint.ended_row_count) {
+    // Commit IDs only change once from MAX_COMMIT_ID (or from MAX_COMMIT_ID to 0 for rolled-back inserts). Thus,
+    // equal counts mean equal MVCC data.
+    chunk_checkpoint.mvcc_file = previous_chunk_checkpoint->mvcc_file;
+  } else {
+    chunk_checkpoint.mvcc_file = file_prefix.string() + ".mvcc";
+    write_mvcc_file(_directory / chunk_checkpoint.mvcc_file, begin_cids, end_cids);
+  }
+
+  return chunk_checkpoint;
+}
+
+std::optional<CommitID> CheckpointManager::load_checkpoint(const std::filesystem::path& directory) {
+  const auto manifest_path = directory / MANIFEST_FILE_NAME;
+  if (!std::filesystem::exists(manifest_path)) {
+    return std::nullopt;
+  }
+
+  auto manifest_file = std::ifstream{manifest_path};
+  const auto manifest = nlohmann::json::parse(manifest_file);
+  const auto snapshot_commit_id = CommitID{manifest["snapshot_commit_id"].get<CommitID::base_type>()};
+
+  for (const auto& [table_name, table_manifest] : manifest["tables"].items()) {
+    auto column_definitions = TableColumnDefinitions{};
+    for (const auto& column : table_manifest["columns"]) {
+      column_definitions.emplace_back(column["name"].get<std::string>(),
+                                      data_type_to_string.right.at(column["data_type"].get<std::string>()),
+                                      column["nullable"].get<bool>());
+    }
+
+    const auto target_chunk_size = ChunkOffset{table_manifest["target_chunk_size"].get<ChunkOffset::base_type>()};
+    const auto table = std::make_shared<Table>(column_definitions, TableType::Data, target_chunk_size, UseMvcc::Yes);
+
+    auto removed_chunk_ids = std::vector<ChunkID>{};
+    for (const auto& chunk_manifest : table_manifest["chunks"]) {
+      if (chunk_manifest["removed"].get<bool>()) {
+        // Physically deleted chunks are represented by a single invalid row until the table has been added to the
+        // StorageManager, which expects all chunks to exist. Afterwards, they are removed again.
+        removed_chunk_ids.emplace_back(table->chunk_count());
+        table->append_mutable_chunk();
+        auto invalid_row = std::vector<AllTypeVariant>{};
+        for (const auto& column_definition : column_definitions) {
+          resolve_data_type(column_definition.data_type, [&](const auto data_type_t) {
+            using ColumnDataType = typename decltype(data_type_t)::type;
+            invalid_row.emplace_back(column_definition.nullable ? NULL_VALUE : AllTypeVariant{ColumnDataType{}});
+          });
+        }
+        const auto placeholder_chunk = table->last_chunk();
+        placeholder_chunk->append(invalid_row);
+        placeholder_chunk->mvcc_data()->set_end_cid(ChunkOffset{0}, CommitID{0});
+        placeholder_chunk->increase_invalid_row_count(ChunkOffset{1});
+        placeholder_chunk->finalize();
+        continue;
+      }
+
+      const auto is_mutable = chunk_manifest["mutable"].get<bool>();
+      if (chunk_manifest["row_count"].get<ChunkOffset::base_type>() == 0) {
+        table->append_mutable_chunk();
+        continue;
+      }
+
+      const auto data_path = directory / chunk_manifest["data_file"].get<std::string>();
+      const auto data_table = BinaryParser::parse(data_path.string());
+      const auto data_chunk = data_table->get_chunk(ChunkID{0});
+      const auto row_count = data_chunk->size();
+      const auto [begin_cids, end_cids] = read_mvcc_file(directory / chunk_manifest["mvcc_file"].get<std::string>());
+      Assert(begin_cids.size() == row_count, "MVCC data does not match the chunk.");
+
+      // Mutable chunks get the full capacity, so that inserts can continue to use them.
+      auto segments = Segments{};
+      if (is_mutable) {
+        segments = copy_value_segments(*data_table, *data_chunk, row_count, target_chunk_size);
+      } else {
+        for (auto column_id = ColumnID{0}; column_id < data_table->column_count(); ++column_id) {
+          segments.emplace_back(data_chunk->get_segment(column_id));
+        }
+      }
+
+      const auto mvcc_data =
+          std::make_shared<MvccData>(is_mutable ? target_chunk_size : row_count, MvccData::MAX_COMMIT_ID);
+      auto invalid_row_count = ChunkOffset{0};
+      auto has_uncommitted_rows = false;
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < row_count; ++chunk_offset) {
+        mvcc_data->set_begin_cid(chunk_offset, begin_cids[chunk_offset]);
+        mvcc_data->set_end_cid(chunk_offset, end_cids[chunk_offset]);
+        has_uncommitted_rows |= begin_cids[chunk_offset] == MvccData::MAX_COMMIT_ID;
+        if (end_cids[chunk_offset] != MvccData::MAX_COMMIT_ID) {
+          ++invalid_row_count;
+        }
+      }
+
+      table->append_chunk(segments, mvcc_data);
+      const auto chunk = table->last_chunk();
+      chunk->increase_invalid_row_count(invalid_row_count);
+      if (is_mutable) {
+        continue;
+      }
+
+      // Rows that were inserted after the snapshot are committed when the log is replayed. Until then, we cannot know
+      // the maximum begin commit ID, so Validate has to check each row.
+      if (has_uncommitted_rows) {
+        mvcc_data->max_begin_cid = MvccData::MAX_COMMIT_ID;
+      }
+      chunk->finalize();
+      if (!data_chunk->individually_sorted_by().empty()) {
+        chunk->set_individually_sorted_by(data_chunk->individually_sorted_by());
+      }
+    }
+
+    Hyrise::get().storage_manager.add_table(table_name, table);
+    for (const auto chunk_id : removed_chunk_ids) {
+      table->remove_chunk(chunk_id);
+    }
+  }
+
+  auto& transaction_manager = Hyrise::get().transaction_manager;
+  if (snapshot_commit_id > transaction_manager.last_commit_id()) {
+    transaction_manager._set_last_commit_id(snapshot_commit_id);
+  }
+
+  return snapshot_commit_id;
+}
+
+}  // namespace hyrise
@@ -0,0 +1,91 @@
+#pragma once
+
+#include <chrono>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "types.hpp"
+
+namespace hyrise {
+
+class Chunk;
+class Table;
+struct PausableLoopThread;
+
+/**
+ * Writes consistent checkpoints of all tables in the StorageManager while transactions continue, and loads them at
+ * startup. A checkpoint contains exactly the committed state at a snapshot commit ID taken from the TransactionManager.
+ * Together with the WriteAheadLog, whose records after this commit ID are replayed onto the loaded tables, it restores
+ * the state of the database after a restart.
+ *
+ * The snapshot is taken by opening a read-only transaction, which keeps the rows visible to it from being cleaned up.
+ * Each chunk is then written with the BinaryWriter as a single-chunk table, accompanied by its MVCC data as of the
+ * snapshot: rows that were inserted or deleted by later transactions appear as not yet inserted or not yet deleted.
+ * The physical layout (ChunkIDs and ChunkOffsets) is preserved, so that the log can be replayed onto it. Mutable chunks
+ * are copied under the table's append mutex first, as concurrent inserts might grow them. Only the values of rows whose
+ * insert has finished are copied, as the values of pending inserts are written without holding the mutex.
+ *
+ * Checkpoints are incremental: the manager remembers the state of every chunk in the last checkpoint. If the number of
+ * rows did not change and all of these rows had been completely written, the previous data file is reused. If,
+ * additionally, no row was inserted or deleted as of the new snapshot, the previous MVCC file is reused as well. As
+ * finalized chunks hardly change, large databases only write the few chunks that were modified since the last
+ * checkpoint.
+ *
+ * A checkpoint becomes valid once its manifest has been renamed to manifest.json. Files of the previous checkpoint that
+ * are no longer referenced are deleted afterwards, and the WriteAheadLog (if enabled) is truncated to the transactions
+ * that committed after the snapshot.
+ *
+ * Not covered: views, prepared plans, indexes, and table constraints.
+ */
+class CheckpointManager : public Noncopyable {
+ public:
+  explicit CheckpointManager(const std::filesystem::path& directory);
+  ~CheckpointManager();
+
+  // Writes a checkpoint and returns its snapshot commit ID. Transactions are not blocked while the checkpoint is
+  // written. Chunks are written in parallel by the current scheduler.
+  CommitID create_checkpoint();
+
+  // Creates a checkpoint every `interval` in a background thread.
+  void start_periodic_checkpoints(const std::chrono::milliseconds interval);
+
+  // Loads the tables of the last checkpoint in `directory` into the StorageManager and sets the last commit ID of the
+  // TransactionManager to the snapshot commit ID of the checkpoint. Returns the snapshot commit ID or std::nullopt if
+  // no checkpoint exists. Must be called before any transaction is started.
+  static std::optional<CommitID> load_checkpoint(const std::filesystem::path& directory);
+
+  // State of a chunk as of a checkpoint. Used to decide whether its files can be reused.
+  struct ChunkCheckpoint {
+    bool is_removed{false};
+    bool is_mutable{false};
+    std::string data_file;
+    std::string mvcc_file;
+    ChunkOffset row_count{0};
+    // Whether all rows of the data file had been completely written (i.e., their inserting transaction had finished).
+    bool data_complete{false};
+    // Number of rows whose insert resp. delete had been committed or rolled back as of the snapshot.
+    ChunkOffset committed_row_count{0};
+    ChunkOffset ended_row_count{0};
+  };
+
+ protected:
+  // Writes a single chunk (or reuses the files of `previous_chunk_checkpoint`) and returns its state.
+  ChunkCheckpoint _write_chunk(const std::string& table_name, const std::shared_ptr<Table>& table,
+                               const ChunkID chunk_id, const CommitID snapshot_commit_id,
+                               const ChunkCheckpoint* previous_chunk_checkpoint) const;
+
+  const std::filesystem::path _directory;
+
+  // Only a single checkpoint is written at a time.
+  std::mutex _checkpoint_mutex;
+  std::unordered_map<std::string, std::vector<ChunkCheckpoint>> _last_checkpoint;
+
+  std::unique_ptr<PausableLoopThread> _loop_thread;
+};
+
+}  // namespace hyrise
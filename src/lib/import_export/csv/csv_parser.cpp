@@ -1,9 +1,13 @@
 #include "csv_parser.hpp"
 
+#include <algorithm>
+#include <bit>
+#include <cstring>
 #include <fstream>
 #include <list>
 #include <memory>
 #include <optional>
+#include <span>
 #include <string>
 #include <string_view>
 #include <utility>
@@ -14,14 +18,67 @@
 #include "import_export/csv/csv_meta.hpp"
 #include "resolve_type.hpp"
 #include "scheduler/job_task.hpp"
+#include "storage/chunk_encoder.hpp"
 #include "storage/table.hpp"
 #include "utils/assert.hpp"
 #include "utils/load_table.hpp"
 
+namespace {
+
+using namespace hyrise;  // NOLINT
+
+// Minimum number of bytes that a JobTask searches for field ends.
+constexpr auto MIN_BYTES_PER_FIELD_SEARCH_TASK = size_t{1'000'000};
+
+constexpr auto LOW_SEVEN_BITS = uint64_t{0x7F7F7F7F7F7F7F7F};
+constexpr auto LOWEST_BYTES = uint64_t{0x0101010101010101};
+
+// Returns a word in which the highest bit of each byte is set iff the corresponding byte of `word` equals the byte that
+// is repeated in `pattern`. Carries cannot propagate into the neighboring bytes, so the result is exact.
+uint64_t matching_bytes(const uint64_t word, const uint64_t pattern) {
+  const auto bytes = word ^ pattern;
+  return ~(((bytes & LOW_SEVEN_BITS) + LOW_SEVEN_BITS) | bytes | LOW_SEVEN_BITS);
+}
+
+// Calls `functor` with the position of every separator, delimiter, and quote in [begin, end) of `content`. Eight bytes
+// are tested at once, so that the common case of a word without any special character costs only a few instructions.
+template <typename Functor>
+void for_each_special_character(const std::string_view content, const size_t begin, const size_t end,
+                                const ParseConfig& config, const Functor& functor) {
+  const auto separators = LOWEST_BYTES * static_cast<uint8_t>(config.separator);
+  const auto delimiters = LOWEST_BYTES * static_cast<uint8_t>(config.delimiter);
+  const auto quotes = LOWEST_BYTES * static_cast<uint8_t>(config.quote);
+
+  auto position = begin;
+  for (; position + sizeof(uint64_t) <= end; position += sizeof(uint64_t)) {
+    auto word = uint64_t{};
+    std::memcpy(&word, content.data() + position, sizeof(word));
+    auto matches = matching_bytes(word, separators) | matching_bytes(word, delimiters) | matching_bytes(word, quotes);
+    while (matches) {
+      // The first character in memory is the lowest byte of the word (little endian).
+      functor(position + std::countr_zero(matches) / 8);
+      matches &= matches - 1;
+    }
+  }
+
+  for (; position < end; ++position) {
+    const auto character = content[position];
+    if (character == config.separator || character == config.delimiter || character == config.quote) {
+      functor(position);
+    }
+  }
+}
+
+}  // namespace
+
 namespace hyrise {
 
 std::shared_ptr<Table> CsvParser::parse(const std::string& filename, const ChunkOffset chunk_size,
-                                        const std::optional<CsvMeta>& csv_meta) {
+                                        const std::optional<CsvMeta>& csv_meta,
+                                        const std::optional<SegmentEncodingSpec>& encoding_spec,
+                                        const size_t block_size) {
+  Assert(block_size > 0, "Block size must be positive.");
+
   // If no meta info is given as a parameter, look for a json file
   auto meta = CsvMeta{};
   if (csv_meta) {
@@ -34,7 +91,7 @@ std::shared_ptr<Table> CsvParser::parse(const std::string& filename, const Chunk
 
   auto table = _create_table_from_meta(chunk_size, meta);
 
-  auto csvfile = std::ifstream{filename};
+  auto csvfile = std::ifstream{filename, std::ios::binary};
 
   // return empty table if input file is empty
   if (!csvfile || csvfile.peek() == EOF || csvfile.peek() == '\r' || csvfile.peek() == '\n') {
@@ -45,59 +102,89 @@ std::shared_ptr<Table> CsvParser::parse(const std::string& filename, const Chunk
     auto line = std::string{};
     std::getline(csvfile, line);
     Assert(line.find('\r') == std::string::npos, "Windows encoding is not supported, use dos2unix");
+    csvfile.seekg(0);
   }
 
-  /**
-   * Load the whole file(!) into a std::string using the, hopefully, fastest method to do so.
-   * TODO(anybody) Maybe use mmap() in the future. The current approach needs to have the entire file in RAM, mmap might
-   *               be cleverer, dunno.
-   */
-  csvfile.seekg(0, std::ios::end);
-  const auto csvfile_size = csvfile.tellg();
-  auto content = std::string(csvfile_size, ' ');
-  csvfile.seekg(0);
-  csvfile.read(content.data(), csvfile_size);
-
-  // make sure content ends with a delimiter for better row processing later
-  if (content.back() != meta.config.delimiter) {
-    content.push_back(meta.config.delimiter);
-  }
-
-  auto content_view = std::string_view{content.c_str(), content.size()};
+  const auto column_count = static_cast<size_t>(table->column_count());
+  Assert(column_count > 0, "Number of CSV fields does not match number of columns.");
+  const auto fields_per_chunk = column_count * table->target_chunk_size();
 
-  // Save chunks in list to avoid memory relocation
+  // Chunks of the block that is currently parsed. A list avoids memory relocation while the tasks fill the segments.
   auto segments_by_chunks = std::list<Segments>{};
   auto tasks = std::vector<std::shared_ptr<AbstractTask>>{};
-  auto field_ends = std::vector<size_t>{};
-  auto append_chunk_mutex = std::mutex{};
-  while (_find_fields_in_chunk(content_view, *table, field_ends, meta)) {
-    // create empty chunk
-    segments_by_chunks.emplace_back();
-    auto& segments = segments_by_chunks.back();
-
-    // Only pass the part of the string that is actually needed to the parsing task
-    auto relevant_content = std::string_view{content_view.substr(0, field_ends.back())};
-
-    // Remove processed part of the csv content
-    content_view = content_view.substr(field_ends.back() + 1);
-
-    // create and start parsing task to fill chunk
-    tasks.emplace_back(std::make_shared<JobTask>([relevant_content, field_ends, &table, &segments, &meta,
-                                                  &escaped_linebreak, &append_chunk_mutex]() {
-      _parse_into_chunk(relevant_content, field_ends, *table, segments, meta, escaped_linebreak, append_chunk_mutex);
-    }));
-    tasks.back()->schedule();
-  }
 
-  Hyrise::get().scheduler()->wait_for_tasks(tasks);
+  const auto append_parsed_chunks = [&]() {
+    Hyrise::get().scheduler()->wait_for_tasks(tasks);
+    tasks.clear();
+
+    for (auto& segments : segments_by_chunks) {
+      DebugAssert(!segments.empty(), "Empty chunks shouldn't occur when importing CSV");
+      const auto mvcc_data = std::make_shared<MvccData>(segments.front()->size(), CommitID{0});
+      table->append_chunk(segments, mvcc_data);
+      table->last_chunk()->finalize();
+    }
+    segments_by_chunks.clear();
+  };
+
+  // Rows that did not form a complete chunk in the previous block.
+  auto carry_over = std::string{};
+  auto is_last_block = false;
+  while (!is_last_block) {
+    // Read the next block after the carried-over rows. If the carried-over rows did not contain a single complete
+    // chunk, the block is at least doubled so that large rows do not cause quadratic costs.
+    const auto block = std::make_shared<std::string>(std::move(carry_over));
+    const auto carry_over_size = block->size();
+    const auto read_size = std::max(block_size, carry_over_size);
+    block->resize(carry_over_size + read_size);
+    csvfile.read(block->data() + carry_over_size, static_cast<std::streamsize>(read_size));
+    block->resize(carry_over_size + static_cast<size_t>(csvfile.gcount()));
+    is_last_block = csvfile.eof();
+
+    // make sure content ends with a delimiter for better row processing later
+    if (is_last_block && !block->empty() && block->back() != meta.config.delimiter) {
+      block->push_back(meta.config.delimiter);
+    }
+
+    const auto content = std::string_view{*block};
+    auto field_ends = std::make_shared<std::vector<size_t>>(_find_field_ends(content, meta.config));
 
-  for (auto& segments : segments_by_chunks) {
-    DebugAssert(!segments.empty(), "Empty chunks shouldn't occur when importing CSV");
-    const auto mvcc_data = std::make_shared<MvccData>(segments.front()->size(), CommitID{0});
-    table->append_chunk(segments, mvcc_data);
-    table->last_chunk()->finalize();
+    // The chunks of the previous block are appended before any chunk of this block. Afterwards, no task refers to the
+    // local variables anymore and errors can be thrown.
+    append_parsed_chunks();
+    Assert(is_last_block || csvfile, "Error while reading " + filename);
+
+    // Only complete chunks are parsed, except for the last block, which is parsed completely.
+    auto parsed_field_count = field_ends->size() / fields_per_chunk * fields_per_chunk;
+    if (is_last_block) {
+      Assert(field_ends->size() % column_count == 0, "Number of CSV fields does not match number of columns.");
+      parsed_field_count = field_ends->size();
+    }
+
+    auto start = size_t{0};
+    for (auto first_field = size_t{0}; first_field < parsed_field_count; first_field += fields_per_chunk) {
+      const auto chunk_field_ends =
+          std::span<const size_t>{*field_ends}.subspan(first_field, std::min(fields_per_chunk,
+                                                                             parsed_field_count - first_field));
+      segments_by_chunks.emplace_back();
+      auto& segments = segments_by_chunks.back();
+
+      // The tasks keep the block and the field ends alive.
+      tasks.emplace_back(std::make_shared<JobTask>([block, field_ends, content, chunk_field_ends, start, &table,
+                                                    &segments, &meta, &escaped_linebreak, &encoding_spec]() {
+        _parse_into_chunk(content, chunk_field_ends, start, *table, segments, meta, escaped_linebreak, encoding_spec);
+      }));
+      tasks.back()->schedule();
+
+      start = chunk_field_ends.back() + 1;
+    }
+
+    if (!is_last_block) {
+      carry_over = block->substr(start);
+    }
   }
 
+  append_parsed_chunks();
+
   return table;
 }
 
@@ -124,62 +211,86 @@ std::shared_ptr<Table> CsvParser::_create_table_from_meta(const ChunkOffset chun
   return std::make_shared<Table>(column_definitions, TableType::Data, chunk_size, UseMvcc::Yes);
 }
 
-bool CsvParser::_find_fields_in_chunk(std::string_view csv_content, const Table& table, std::vector<size_t>& field_ends,
-                                      const CsvMeta& meta) {
-  field_ends.clear();
-  if (csv_content.empty()) {
-    return false;
+std::vector<size_t> CsvParser::_find_field_ends(std::string_view csv_content, const ParseConfig& config) {
+  // Make sure to "toggle" in_quotes ONLY if the quotes are not part of the string (i.e. escaped)
+  const auto is_unescaped_quote = [&](const size_t position) {
+    if (csv_content[position] != config.quote) {
+      return false;
+    }
+    if (config.quote == config.escape) {
+      return true;
+    }
+    return position == 0 || csv_content[position - 1] != config.escape;
+  };
+
+  const auto task_count = std::max(size_t{1}, csv_content.size() / MIN_BYTES_PER_FIELD_SEARCH_TASK);
+  const auto bytes_per_task = csv_content.size() / task_count + 1;
+  const auto range_begin = [&](const size_t task_id) {
+    return std::min(task_id * bytes_per_task, csv_content.size());
+  };
+
+  // First pass: As the block starts at the beginning of a row, a range starts within a quoted field iff the number of
+  // unescaped quotes before it is odd.
+  auto starts_in_quotes = std::vector<BoolAsByteType>(task_count);
+  auto tasks = std::vector<std::shared_ptr<AbstractTask>>{};
+  tasks.reserve(task_count);
+  for (auto task_id = size_t{1}; task_id < task_count; ++task_id) {
+    tasks.emplace_back(std::make_shared<JobTask>([&, task_id]() {
+      auto quote_count = size_t{0};
+      for_each_special_character(csv_content, range_begin(task_id - 1), range_begin(task_id), config,
+                                 [&](const size_t position) {
+                                   quote_count += is_unescaped_quote(position);
+                                 });
+      starts_in_quotes[task_id] = quote_count % 2;
+    }));
   }
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(tasks);
 
-  auto search_for = std::string{meta.config.separator, meta.config.delimiter, meta.config.quote};
+  for (auto task_id = size_t{1}; task_id < task_count; ++task_id) {
+    starts_in_quotes[task_id] ^= starts_in_quotes[task_id - 1];
+  }
 
-  auto from = size_t{0};
-  auto rows = uint64_t{0};
-  auto field_count = uint16_t{1};
-  auto in_quotes = false;
-  while (rows < table.target_chunk_size()) {
-    // Find either of row separator, column delimiter, quote identifier
-    auto pos = csv_content.find_first_of(search_for, from);
-    if (std::string::npos == pos) {
-      break;
-    }
-    from = pos + 1;
-    const char elem = csv_content[pos];
-
-    // Make sure to "toggle" in_quotes ONLY if the quotes are not part of the string (i.e. escaped)
-    if (elem == meta.config.quote) {
-      bool quote_is_escaped = false;
-      if (meta.config.quote != meta.config.escape) {
-        quote_is_escaped = pos != 0 && csv_content[pos - 1] == meta.config.escape;
-      }
-      if (!quote_is_escaped) {
-        in_quotes = !in_quotes;
-      }
-    }
+  // Second pass: Collect the unquoted separators and delimiters of each range.
+  auto field_ends_per_task = std::vector<std::vector<size_t>>(task_count);
+  tasks.clear();
+  for (auto task_id = size_t{0}; task_id < task_count; ++task_id) {
+    tasks.emplace_back(std::make_shared<JobTask>([&, task_id]() {
+      auto& field_ends = field_ends_per_task[task_id];
+      auto in_quotes = static_cast<bool>(starts_in_quotes[task_id]);
+      for_each_special_character(csv_content, range_begin(task_id), range_begin(task_id + 1), config,
+                                 [&](const size_t position) {
+                                   if (is_unescaped_quote(position)) {
+                                     in_quotes = !in_quotes;
+                                   } else if (!in_quotes && csv_content[position] != config.quote) {
+                                     field_ends.push_back(position);
+                                   }
+                                 });
+    }));
+  }
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(tasks);
 
-    // Determine if delimiter marks end of row or is part of the (string) value
-    if (elem == meta.config.delimiter && !in_quotes) {
-      Assert(field_count == static_cast<size_t>(table.column_count()),
-             "Number of CSV fields does not match number of columns.");
-      ++rows;
-      field_count = 0;
-    }
+  if (task_count == 1) {
+    return std::move(field_ends_per_task.front());
+  }
 
-    // Determine if separator marks end of field or is part of the (string) value
-    if (in_quotes || elem == meta.config.quote) {
-      continue;
-    }
+  auto field_count = size_t{0};
+  for (const auto& field_ends : field_ends_per_task) {
+    field_count += field_ends.size();
+  }
 
-    ++field_count;
-    field_ends.push_back(pos);
+  auto field_ends = std::vector<size_t>{};
+  field_ends.reserve(field_count);
+  for (const auto& task_field_ends : field_ends_per_task) {
+    field_ends.insert(field_ends.end(), task_field_ends.cbegin(), task_field_ends.cend());
   }
 
-  return true;
+  return field_ends;
 }
 
-size_t CsvParser::_parse_into_chunk(std::string_view csv_chunk, const std::vector<size_t>& field_ends,
+size_t CsvParser::_parse_into_chunk(std::string_view csv_content, std::span<const size_t> field_ends, size_t start,
                                     const Table& table, Segments& segments, const CsvMeta& meta,
-                                    const std::string& escaped_linebreak, std::mutex& append_chunk_mutex) {
+                                    const std::string& escaped_linebreak,
+                                    const std::optional<SegmentEncodingSpec>& encoding_spec) {
   // For each csv column, create a CsvConverter which builds up a ValueSegment
   const auto column_count = table.column_count();
   const auto row_count = ChunkOffset{static_cast<ChunkOffset::base_type>(field_ends.size() / column_count)};
@@ -198,7 +309,6 @@ size_t CsvParser::_parse_into_chunk(std::string_view csv_chunk, const std::vecto
 
   Assert(field_ends.size() == static_cast<size_t>(row_count) * column_count, "Unexpected number of fields");
 
-  auto start = size_t{0};
   auto row_id = size_t{0};
   auto field_idx = size_t{0};
   auto column_id = ColumnID{0};
@@ -207,7 +317,11 @@ size_t CsvParser::_parse_into_chunk(std::string_view csv_chunk, const std::vecto
     for (; row_id < row_count; ++row_id) {
       for (column_id = ColumnID{0}; column_id < column_count; ++column_id, ++field_idx) {
         const auto end = field_ends[field_idx];
-        auto field = std::string{csv_chunk.substr(start, end - start)};
+        // Exactly the last field of each row has to end with a delimiter.
+        Assert((csv_content[end] == meta.config.delimiter) == (column_id + 1 == column_count),
+               "Number of CSV fields does not match number of columns.");
+
+        auto field = std::string{csv_content.substr(start, end - start)};
         start = end + 1;
 
         if (!meta.config.rfc_mode) {
@@ -224,11 +338,12 @@ size_t CsvParser::_parse_into_chunk(std::string_view csv_chunk, const std::vecto
   }
 
   // Transform the field_offsets to segments and add segments to chunk.
-  {
-    const auto lock = std::lock_guard<std::mutex>{append_chunk_mutex};
-    for (auto& converter : converters) {
-      segments.push_back(converter->finish());
+  for (auto converted_column_id = ColumnID{0}; converted_column_id < column_count; ++converted_column_id) {
+    auto segment = std::shared_ptr<AbstractSegment>{converters[converted_column_id]->finish()};
+    if (encoding_spec && encoding_spec->encoding_type != EncodingType::Unencoded) {
+      segment = ChunkEncoder::encode_segment(segment, table.column_data_type(converted_column_id), *encoding_spec);
     }
+    segments.push_back(segment);
   }
 
   return row_count;
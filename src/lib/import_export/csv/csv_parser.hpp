@@ -2,11 +2,13 @@
 
 #include <memory>
 #include <optional>
+#include <span>
 #include <string>
 #include <string_view>
 #include <vector>
 
 #include "import_export/csv/csv_meta.hpp"
+#include "storage/encoding_type.hpp"
 
 namespace hyrise {
 
@@ -21,19 +23,33 @@ class Chunk;
  * For non-RFC 4180, all linebreaks within quoted strings are further escaped with an escape character.
  * For the structure of the meta csv file see export_csv.hpp
  *
- * This parser reads the whole csv file and iterates over it to separate the data into chunks that are aligned with the
- * csv rows.
- * Each data chunk is parsed and converted into a Hyrise chunk. In the end all chunks are combined to the final table.
+ * The csv file is streamed in blocks, so that the memory footprint of the parser is independent of the file size. For
+ * each block,
+ *   (i)   the ends of all fields are found in parallel. The block is split into ranges and, in a first pass, the number
+ *         of unescaped quotes is counted per range to determine whether a range starts within a quoted field. In a
+ *         second pass, the unquoted separators and delimiters are collected. Both passes test eight characters at once
+ *         for the special characters (SIMD within a register).
+ *   (ii)  the complete chunks (i.e., rows up to a multiple of the target chunk size) are parsed and, optionally,
+ *         encoded by JobTasks. The remaining rows are carried over to the next block. While these tasks run, the next
+ *         block is read and its fields are found.
+ * At most two blocks are held in memory at a time. A block is only enlarged if it does not contain a single complete
+ * chunk.
  */
 class CsvParser {
  public:
+  static constexpr auto DEFAULT_BLOCK_SIZE = size_t{64} * 1024 * 1024;
+
   /*
    * @param filename      Path to the input file.
    * @param csv_meta      Custom csv meta information which will be used instead of the default "filename" + ".json" meta.
+   * @param encoding_spec If set, the segments of each chunk are encoded with it right after they have been parsed.
+   * @param block_size    Number of bytes that are read from the file at once.
    * @returns             The table that was created from the csv file.
    */
   static std::shared_ptr<Table> parse(const std::string& filename, const ChunkOffset chunk_size = Chunk::DEFAULT_SIZE,
-                                      const std::optional<CsvMeta>& csv_meta = std::nullopt);
+                                      const std::optional<CsvMeta>& csv_meta = std::nullopt,
+                                      const std::optional<SegmentEncodingSpec>& encoding_spec = std::nullopt,
+                                      const size_t block_size = DEFAULT_BLOCK_SIZE);
   static std::shared_ptr<Table> create_table_from_meta_file(const std::string& filename,
                                                             const ChunkOffset chunk_size = Chunk::DEFAULT_SIZE);
 
@@ -44,25 +60,24 @@ class CsvParser {
   static std::shared_ptr<Table> _create_table_from_meta(const ChunkOffset chunk_size, const CsvMeta& meta);
 
   /*
-   * @param      csv_content String_view on the remaining content of the CSV.
-   * @param      table       Empty table created by _process_meta_file.
-   * @param[out] field_ends  Empty vector, to be filled with positions of the field ends for one chunk found in \p
-   * csv_content.
-   * @returns                False if \p csv_content is empty or chunk_size set to 0, True otherwise.
+   * @param      csv_content String_view on a block of the CSV that starts at the beginning of a row.
+   * @returns                Positions of all field ends (i.e., unquoted separators and delimiters) in \p csv_content.
    */
-  static bool _find_fields_in_chunk(std::string_view csv_content, const Table& table, std::vector<size_t>& field_ends,
-                                    const CsvMeta& meta);
+  static std::vector<size_t> _find_field_ends(std::string_view csv_content, const ParseConfig& config);
 
   /*
-   * @param      csv_chunk  String_view on one chunk of the CSV.
-   * @param      field_ends Positions of the field ends of the given \p csv_chunk.
-   * @param      table      Empty table created by _process_meta_file.
-   * @param[out] segments   The segments of the chunk, to be populated with data
-   * @returns               The number of rows in the chunk
+   * @param      csv_content   String_view on the block of the CSV that contains the chunk.
+   * @param      field_ends    Positions of the field ends of the chunk in \p csv_content.
+   * @param      start         Position of the first field of the chunk in \p csv_content.
+   * @param      table         Empty table created by _process_meta_file.
+   * @param[out] segments      The segments of the chunk, to be populated with data
+   * @param      encoding_spec If set, the segments are encoded with it.
+   * @returns                  The number of rows in the chunk
    */
-  static size_t _parse_into_chunk(std::string_view csv_chunk, const std::vector<size_t>& field_ends, const Table& table,
-                                  Segments& segments, const CsvMeta& meta, const std::string& escaped_linebreak,
-                                  std::mutex& append_chunk_mutex);
+  static size_t _parse_into_chunk(std::string_view csv_content, std::span<const size_t> field_ends, size_t start,
+                                  const Table& table, Segments& segments, const CsvMeta& meta,
+                                  const std::string& escaped_linebreak,
+                                  const std::optional<SegmentEncodingSpec>& encoding_spec);
 
   /*
    * @param field The field that needs to be modified to be RFC 4180 compliant.
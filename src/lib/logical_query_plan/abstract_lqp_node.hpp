@@ -15,6 +15,7 @@ enum class LQPNodeType {
   Aggregate,
   Alias,
   ChangeMetaTable,
+  CreateIndex,
   CreateTable,
   CreatePreparedPlan,
   CreateView,
@@ -0,0 +1,41 @@
+#include "create_index_node.hpp"
+
+#include <sstream>
+#include <string>
+
+namespace hyrise {
+
+CreateIndexNode::CreateIndexNode(const std::string& init_index_name, const std::string& init_table_name,
+                                 const ColumnID init_column_id, const bool init_if_not_exists)
+    : AbstractNonQueryNode(LQPNodeType::CreateIndex),
+      index_name(init_index_name),
+      table_name(init_table_name),
+      column_id(init_column_id),
+      if_not_exists(init_if_not_exists) {}
+
+std::string CreateIndexNode::description(const DescriptionMode /*mode*/) const {
+  std::ostringstream stream;
+  stream << "[CreateIndex] " << (if_not_exists ? "IfNotExists " : "");
+  stream << "Name: '" << index_name << "' On: '" << table_name << "' Column: " << column_id;
+  return stream.str();
+}
+
+size_t CreateIndexNode::_on_shallow_hash() const {
+  auto hash = boost::hash_value(index_name);
+  boost::hash_combine(hash, table_name);
+  boost::hash_combine(hash, static_cast<ColumnID::base_type>(column_id));
+  boost::hash_combine(hash, if_not_exists);
+  return hash;
+}
+
+std::shared_ptr<AbstractLQPNode> CreateIndexNode::_on_shallow_copy(LQPNodeMapping& /*node_mapping*/) const {
+  return CreateIndexNode::make(index_name, table_name, column_id, if_not_exists);
+}
+
+bool CreateIndexNode::_on_shallow_equals(const AbstractLQPNode& rhs, const LQPNodeMapping& /*node_mapping*/) const {
+  const auto& create_index_node = static_cast<const CreateIndexNode&>(rhs);
+  return index_name == create_index_node.index_name && table_name == create_index_node.table_name &&
+         column_id == create_index_node.column_id && if_not_exists == create_index_node.if_not_exists;
+}
+
+}  // namespace hyrise
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <string>
+
+#include "abstract_non_query_node.hpp"
+#include "enable_make_for_lqp_node.hpp"
+
+namespace hyrise {
+
+/**
+ * This node type represents the CREATE INDEX management command. Only single-column indexes are supported.
+ */
+class CreateIndexNode : public EnableMakeForLQPNode<CreateIndexNode>, public AbstractNonQueryNode {
+ public:
+  CreateIndexNode(const std::string& init_index_name, const std::string& init_table_name,
+                  const ColumnID init_column_id, const bool init_if_not_exists);
+
+  std::string description(const DescriptionMode mode = DescriptionMode::Short) const override;
+
+  const std::string index_name;
+  const std::string table_name;
+  const ColumnID column_id;
+  const bool if_not_exists;
+
+ protected:
+  size_t _on_shallow_hash() const override;
+  std::shared_ptr<AbstractLQPNode> _on_shallow_copy(LQPNodeMapping& /*node_mapping*/) const override;
+  bool _on_shallow_equals(const AbstractLQPNode& rhs, const LQPNodeMapping& /*node_mapping*/) const override;
+};
+
+}  // namespace hyrise
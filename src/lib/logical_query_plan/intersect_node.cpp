@@ -28,18 +28,14 @@ bool IntersectNode::is_column_nullable(const ColumnID column_id) const {
 }
 
 UniqueColumnCombinations IntersectNode::unique_column_combinations() const {
-  /**
-   * Because INTERSECT acts as a pure filter for both input tables, all unique column combinations remain valid.
-   *
-   * Future Work: Merge unique column combinations from the left and right input node.
-   */
-  DebugAssert(left_input()->unique_column_combinations() == right_input()->unique_column_combinations(),
-              "Merging of unique column combinations should be implemented.");
+  // INTERSECT only emits rows of the left input (see SetOperationHash) and acts as a pure filter for them. Thus, all
+  // unique column combinations from the left input node remain valid.
   return _forward_left_unique_column_combinations();
 }
 
 FunctionalDependencies IntersectNode::non_trivial_functional_dependencies() const {
-  Fail("Merging of FDs is not implemented.");
+  // The right input node is used for filtering only. It does not contribute any FDs.
+  return left_input()->non_trivial_functional_dependencies();
 }
 
 size_t IntersectNode::_on_shallow_hash() const {
@@ -312,12 +312,15 @@ std::shared_ptr<AbstractLQPNode> JoinNode::_on_shallow_copy(LQPNodeMapping& node
   const auto copied_join_node =
       JoinNode::make(join_mode, expressions_copy_and_adapt_to_different_lqp(join_predicates(), node_mapping));
   copied_join_node->_is_semi_reduction = _is_semi_reduction;
+  copied_join_node->index_side = index_side;
+  copied_join_node->runtime_filter_side = runtime_filter_side;
   return copied_join_node;
 }
 
 bool JoinNode::_on_shallow_equals(const AbstractLQPNode& rhs, const LQPNodeMapping& node_mapping) const {
   const auto& join_node = static_cast<const JoinNode&>(rhs);
-  if (join_mode != join_node.join_mode || _is_semi_reduction != join_node._is_semi_reduction) {
+  if (join_mode != join_node.join_mode || _is_semi_reduction != join_node._is_semi_reduction ||
+      index_side != join_node.index_side || runtime_filter_side != join_node.runtime_filter_side) {
     return false;
   }
   return expressions_equal_to_expressions_in_different_lqp(join_predicates(), join_node.join_predicates(),
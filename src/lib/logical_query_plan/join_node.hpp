@@ -89,6 +89,19 @@ class JoinNode : public EnableMakeForLQPNode<JoinNode>, public AbstractLQPNode {
 
   JoinMode join_mode;
 
+  /**
+   * Set by the IndexScanRule if the input on this side is a stored table with a table index on the join column and
+   * the other input is small enough to probe the index for each of its rows. The LQPTranslator then uses a JoinIndex.
+   */
+  std::optional<LQPInputSide> index_side;
+
+  /**
+   * Set by the RuntimeFilterRule if the input on this side is small compared to the other one and only few rows of the
+   * other input are expected to find a join partner. The LQPTranslator then builds a RuntimeFilter from this input and
+   * pushes it into the scans of the other input.
+   */
+  std::optional<LQPInputSide> runtime_filter_side;
+
  protected:
   /**
    * The following data members are only relevant for semi joins added by the SemiJoinReductionRule. For details,
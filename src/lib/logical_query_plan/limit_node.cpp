@@ -3,6 +3,8 @@
 #include <sstream>
 #include <string>
 
+#include <boost/functional/hash.hpp>
+
 #include "expression/abstract_expression.hpp"
 #include "expression/expression_utils.hpp"
 #include "utils/assert.hpp"
@@ -17,6 +19,9 @@ std::string LimitNode::description(const DescriptionMode mode) const {
 
   std::stringstream stream;
   stream << "[Limit] " << num_rows_expression()->description(expression_mode);
+  if (fuse_with_sort) {
+    stream << " (fused with Sort)";
+  }
   return stream.str();
 }
 
@@ -28,13 +33,21 @@ std::shared_ptr<AbstractExpression> LimitNode::num_rows_expression() const {
   return node_expressions[0];
 }
 
+size_t LimitNode::_on_shallow_hash() const {
+  return boost::hash_value(fuse_with_sort);
+}
+
 std::shared_ptr<AbstractLQPNode> LimitNode::_on_shallow_copy(LQPNodeMapping& node_mapping) const {
-  return LimitNode::make(expression_copy_and_adapt_to_different_lqp(*num_rows_expression(), node_mapping));
+  const auto limit_node =
+      LimitNode::make(expression_copy_and_adapt_to_different_lqp(*num_rows_expression(), node_mapping));
+  limit_node->fuse_with_sort = fuse_with_sort;
+  return limit_node;
 }
 
 bool LimitNode::_on_shallow_equals(const AbstractLQPNode& rhs, const LQPNodeMapping& node_mapping) const {
   const auto& limit_node = static_cast<const LimitNode&>(rhs);
-  return expression_equal_to_expression_in_different_lqp(*num_rows_expression(), *limit_node.num_rows_expression(),
+  return fuse_with_sort == limit_node.fuse_with_sort &&
+         expression_equal_to_expression_in_different_lqp(*num_rows_expression(), *limit_node.num_rows_expression(),
                                                          node_mapping);
 }
 
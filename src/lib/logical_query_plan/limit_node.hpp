@@ -20,7 +20,11 @@ class LimitNode : public EnableMakeForLQPNode<LimitNode>, public AbstractLQPNode
 
   std::shared_ptr<AbstractExpression> num_rows_expression() const;
 
+  // Set by the TopKRule if the input SortNode and this node are translated into a single TopK operator.
+  bool fuse_with_sort{false};
+
  protected:
+  size_t _on_shallow_hash() const override;
   std::shared_ptr<AbstractLQPNode> _on_shallow_copy(LQPNodeMapping& node_mapping) const override;
   bool _on_shallow_equals(const AbstractLQPNode& rhs, const LQPNodeMapping& node_mapping) const override;
 };
@@ -7,6 +7,8 @@
 #include "aggregate_node.hpp"
 #include "alias_node.hpp"
 #include "change_meta_table_node.hpp"
+#include "cost_estimation/cost_estimator_calibrated.hpp"
+#include "create_index_node.hpp"
 #include "create_prepared_plan_node.hpp"
 #include "create_table_node.hpp"
 #include "create_view_node.hpp"
@@ -17,21 +19,26 @@
 #include "export_node.hpp"
 #include "expression/abstract_expression.hpp"
 #include "expression/abstract_predicate_expression.hpp"
+#include "expression/binary_predicate_expression.hpp"
 #include "expression/expression_utils.hpp"
 #include "expression/lqp_column_expression.hpp"
 #include "expression/lqp_subquery_expression.hpp"
 #include "expression/pqp_column_expression.hpp"
 #include "expression/pqp_subquery_expression.hpp"
 #include "expression/value_expression.hpp"
+#include "expression/window_expression.hpp"
+#include "expression/window_function_expression.hpp"
 #include "hyrise.hpp"
 #include "import_node.hpp"
 #include "insert_node.hpp"
 #include "intersect_node.hpp"
 #include "join_node.hpp"
 #include "limit_node.hpp"
+#include "lqp_utils.hpp"
 #include "operators/aggregate_hash.hpp"
 #include "operators/alias_operator.hpp"
 #include "operators/change_meta_table.hpp"
+#include "operators/chunk_pipeline.hpp"
 #include "operators/delete.hpp"
 #include "operators/export.hpp"
 #include "operators/get_table.hpp"
@@ -39,9 +46,11 @@
 #include "operators/index_scan.hpp"
 #include "operators/insert.hpp"
 #include "operators/join_hash.hpp"
+#include "operators/join_index.hpp"
 #include "operators/join_nested_loop.hpp"
 #include "operators/join_sort_merge.hpp"
 #include "operators/limit.hpp"
+#include "operators/maintenance/create_index.hpp"
 #include "operators/maintenance/create_prepared_plan.hpp"
 #include "operators/maintenance/create_table.hpp"
 #include "operators/maintenance/create_view.hpp"
@@ -50,28 +59,144 @@
 #include "operators/operator_join_predicate.hpp"
 #include "operators/operator_scan_predicate.hpp"
 #include "operators/pqp_utils.hpp"
+#include "operators/primary_key_lookup.hpp"
 #include "operators/product.hpp"
 #include "operators/projection.hpp"
+#include "operators/runtime_filter.hpp"
+#include "operators/set_operation_hash.hpp"
 #include "operators/sort.hpp"
+#include "operators/table_index_scan.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
+#include "operators/top_k.hpp"
 #include "operators/union_all.hpp"
 #include "operators/union_positions.hpp"
 #include "operators/update.hpp"
 #include "operators/validate.hpp"
+#include "operators/window_function_evaluator.hpp"
 #include "predicate_node.hpp"
 #include "projection_node.hpp"
 #include "sort_node.hpp"
 #include "static_table_node.hpp"
+#include "statistics/cardinality_estimator.hpp"
+#include "storage/index/partial_hash/partial_hash_index.hpp"
 #include "stored_table_node.hpp"
 #include "union_node.hpp"
 #include "update_node.hpp"
 #include "utils/column_pruning_utils.hpp"
 
+namespace {
+
+using namespace hyrise;  // NOLINT
+
+bool contains_subquery(const std::vector<std::shared_ptr<AbstractExpression>>& expressions) {
+  auto subquery_found = false;
+  for (const auto& expression : expressions) {
+    visit_expression(expression, [&](const auto& sub_expression) {
+      if (sub_expression->type == ExpressionType::LQPSubquery) {
+        subquery_found = true;
+      }
+      return subquery_found ? ExpressionVisitation::DoNotVisitArguments : ExpressionVisitation::VisitArguments;
+    });
+  }
+  return subquery_found;
+}
+
+// Validate, TableScan, and Projection operators process each chunk independently and can thus be part of a
+// ChunkPipeline. Operators that use subqueries are excluded, as the subquery results have to be shared between the
+// morsels (for uncorrelated subqueries) and would make the pipeline depend on other operators.
+bool is_chunk_pipeline_stage(const AbstractLQPNode& node) {
+  switch (node.type) {
+    case LQPNodeType::Validate:
+      return true;
+    case LQPNodeType::Predicate: {
+      const auto& predicate_node = static_cast<const PredicateNode&>(node);
+      return predicate_node.scan_type == ScanType::TableScan && !contains_subquery({predicate_node.predicate()});
+    }
+    case LQPNodeType::Projection:
+      return !contains_subquery(node.node_expressions);
+    default:
+      return false;
+  }
+}
+
+// Returns whether the predicate holds for any operator of the PQP. Besides the inputs, the operators of uncorrelated
+// subqueries and the build operators of runtime filters are visited, as they are executed before the operator, too.
+template <typename Predicate>
+bool any_operator_in_pqp(const std::shared_ptr<AbstractOperator>& pqp, const Predicate& predicate) {
+  auto operator_stack = std::vector<std::shared_ptr<AbstractOperator>>{pqp};
+  auto visited_operators = std::unordered_set<std::shared_ptr<AbstractOperator>>{};
+
+  while (!operator_stack.empty()) {
+    const auto op = operator_stack.back();
+    operator_stack.pop_back();
+    if (!visited_operators.emplace(op).second) {
+      continue;
+    }
+
+    if (predicate(op)) {
+      return true;
+    }
+
+    if (op->left_input()) {
+      operator_stack.emplace_back(op->mutable_left_input());
+    }
+    if (op->right_input()) {
+      operator_stack.emplace_back(op->mutable_right_input());
+    }
+    for (const auto& subquery : op->uncorrelated_subqueries()) {
+      operator_stack.emplace_back(subquery);
+    }
+    for (const auto& runtime_filter : op->runtime_filters) {
+      operator_stack.emplace_back(runtime_filter.first->build_operator());
+    }
+  }
+
+  return false;
+}
+
+std::shared_ptr<const CostEstimatorCalibrated> make_cost_estimator() {
+  if (!Hyrise::get().cost_model) {
+    return nullptr;
+  }
+
+  auto cost_estimator =
+      std::make_shared<CostEstimatorCalibrated>(std::make_shared<CardinalityEstimator>(), Hyrise::get().cost_model);
+  // The LQP does not change during its translation. Caching the statistics of each subplan avoids re-estimating the
+  // entire input subplan of every join.
+  cost_estimator->guarantee_bottom_up_construction();
+  return cost_estimator;
+}
+
+template <typename JoinOperator>
+constexpr OperatorType join_operator_type() {
+  if constexpr (std::is_same_v<JoinOperator, JoinHash>) {
+    return OperatorType::JoinHash;
+  } else if constexpr (std::is_same_v<JoinOperator, JoinSortMerge>) {
+    return OperatorType::JoinSortMerge;
+  } else {
+    static_assert(std::is_same_v<JoinOperator, JoinNestedLoop>, "Unexpected join operator.");
+    return OperatorType::JoinNestedLoop;
+  }
+}
+
+}  // namespace
+
 namespace hyrise {
 
+LQPTranslator::LQPTranslator() : LQPTranslator(Hyrise::get().use_chunk_pipelines) {}
+
+LQPTranslator::LQPTranslator(const bool use_chunk_pipelines)
+    : LQPTranslator(use_chunk_pipelines, make_cost_estimator()) {}
+
+LQPTranslator::LQPTranslator(const bool use_chunk_pipelines,
+                             const std::shared_ptr<const CostEstimatorCalibrated>& cost_estimator)
+    : _use_chunk_pipelines(use_chunk_pipelines), _cost_estimator(cost_estimator) {}
+
 std::shared_ptr<AbstractOperator> LQPTranslator::translate_node(const std::shared_ptr<AbstractLQPNode>& node) const {
-  return _translate_node_recursively(node);
+  const auto pqp = _translate_node_recursively(node);
+  _add_runtime_filters(pqp);
+  return pqp;
 }
 
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_node_recursively(
@@ -107,7 +232,10 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_node_recursively(
     return operator_iter->second;
   }
 
-  const auto pqp = _translate_by_node_type(node->type, node);
+  auto pqp = _use_chunk_pipelines ? _translate_chunk_pipeline(node) : nullptr;
+  if (!pqp) {
+    pqp = _translate_by_node_type(node->type, node);
+  }
 
   // Adding the actual LQP node that led to the creation of the PQP node.  Note, the LQP needs to be set in
   // _translate_predicate_node_to_index_scan() as well, because the function creates two scans operators and returns
@@ -147,6 +275,7 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_by_node_type(
     case LQPNodeType::DropView:           return _translate_drop_view_node(node);
     case LQPNodeType::CreateTable:        return _translate_create_table_node(node);
     case LQPNodeType::DropTable:          return _translate_drop_table_node(node);
+    case LQPNodeType::CreateIndex:        return _translate_create_index_node(node);
     case LQPNodeType::Import:             return _translate_import_node(node);
     case LQPNodeType::Export:             return _translate_export_node(node);
     case LQPNodeType::CreatePreparedPlan: return _translate_create_prepared_plan_node(node);
@@ -168,9 +297,22 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_stored_table_node(
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_predicate_node(
     const std::shared_ptr<AbstractLQPNode>& node) const {
   const auto input_node = node->left_input();
-  const auto input_operator = _translate_node_recursively(input_node);
   const auto predicate_node = std::dynamic_pointer_cast<PredicateNode>(node);
 
+  if (predicate_node->scan_type == ScanType::IndexScan) {
+    const auto primary_key_lookup = _translate_predicate_node_to_primary_key_lookup(predicate_node);
+    if (primary_key_lookup) {
+      return primary_key_lookup;
+    }
+
+    const auto table_index_scan = _translate_predicate_node_to_table_index_scan(predicate_node);
+    if (table_index_scan) {
+      return table_index_scan;
+    }
+  }
+
+  const auto input_operator = _translate_node_recursively(input_node);
+
   switch (predicate_node->scan_type) {
     case ScanType::TableScan:
       return _translate_predicate_node_to_table_scan(predicate_node, input_operator);
@@ -266,6 +408,103 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_predicate_node_to_in
   return std::make_shared<UnionAll>(index_scan, table_scan);
 }
 
+std::shared_ptr<AbstractOperator> LQPTranslator::_translate_predicate_node_to_table_index_scan(
+    const std::shared_ptr<PredicateNode>& node) const {
+  // The IndexScanRule only selects table indexes for predicates in the form <column> = <value>.
+  const auto predicate = std::dynamic_pointer_cast<BinaryPredicateExpression>(node->predicate());
+  if (!predicate || predicate->predicate_condition != PredicateCondition::Equals) {
+    return nullptr;
+  }
+
+  const auto column_expression = std::dynamic_pointer_cast<LQPColumnExpression>(predicate->left_operand());
+  const auto value_expression = std::dynamic_pointer_cast<ValueExpression>(predicate->right_operand());
+  if (!column_expression || !value_expression) {
+    return nullptr;
+  }
+
+  // The StoredTableNode might be separated from the PredicateNode by a ValidateNode.
+  const auto& input_node = node->left_input();
+  const auto validate_node = input_node->type == LQPNodeType::Validate ? input_node : nullptr;
+  const auto stored_table_node =
+      std::dynamic_pointer_cast<StoredTableNode>(validate_node ? validate_node->left_input() : input_node);
+  if (!stored_table_node || column_expression->original_node.lock() != stored_table_node) {
+    return nullptr;
+  }
+
+  const auto& table_name = stored_table_node->table_name;
+  const auto column_id = column_expression->original_column_id;
+  const auto table_indexes = Hyrise::get().storage_manager.get_table(table_name)->get_table_indexes(column_id);
+  if (table_indexes.empty()) {
+    return nullptr;
+  }
+
+  // Fix the set of indexed chunks now. Chunks that are added to the index later on are scanned by the TableScan.
+  const auto& pruned_chunk_ids = stored_table_node->pruned_chunk_ids();
+  DebugAssert(std::is_sorted(pruned_chunk_ids.cbegin(), pruned_chunk_ids.cend()), "Expected sorted vector of ChunkIDs");
+  auto indexed_chunk_ids = std::vector<ChunkID>{};
+  for (const auto chunk_id : table_indexes.front()->get_indexed_chunk_ids()) {
+    if (!std::binary_search(pruned_chunk_ids.cbegin(), pruned_chunk_ids.cend(), chunk_id)) {
+      indexed_chunk_ids.emplace_back(chunk_id);
+    }
+  }
+  std::sort(indexed_chunk_ids.begin(), indexed_chunk_ids.end());
+
+  auto excluded_chunk_ids = std::vector<ChunkID>{};
+  std::set_union(pruned_chunk_ids.cbegin(), pruned_chunk_ids.cend(), indexed_chunk_ids.cbegin(),
+                 indexed_chunk_ids.cend(), std::back_inserter(excluded_chunk_ids));
+
+  const auto& pruned_column_ids = stored_table_node->pruned_column_ids();
+  const auto table_index_scan =
+      std::make_shared<TableIndexScan>(table_name, column_id, value_expression->value, pruned_column_ids);
+  table_index_scan->included_chunk_ids = std::move(indexed_chunk_ids);
+  table_index_scan->lqp_node = node;
+
+  const auto get_table = std::make_shared<GetTable>(table_name, excluded_chunk_ids, pruned_column_ids);
+  get_table->lqp_node = stored_table_node;
+
+  auto index_scan_input = std::shared_ptr<AbstractOperator>{table_index_scan};
+  auto table_scan_input = std::shared_ptr<AbstractOperator>{get_table};
+  if (validate_node) {
+    index_scan_input = std::make_shared<Validate>(index_scan_input);
+    index_scan_input->lqp_node = validate_node;
+    table_scan_input = std::make_shared<Validate>(table_scan_input);
+    table_scan_input->lqp_node = validate_node;
+  }
+
+  const auto table_scan = _translate_predicate_node_to_table_scan(node, table_scan_input);
+  table_scan->lqp_node = node;
+
+  return std::make_shared<UnionAll>(index_scan_input, table_scan);
+}
+
+std::shared_ptr<AbstractOperator> LQPTranslator::_translate_predicate_node_to_primary_key_lookup(
+    const std::shared_ptr<PredicateNode>& node) const {
+  // The IndexScanRule marks the topmost PredicateNode of chains that bind all primary key columns. The lookup replaces
+  // the entire chain, only the predicates on other columns remain as TableScans.
+  const auto primary_key_predicates = find_primary_key_predicates(node);
+  if (!primary_key_predicates) {
+    return nullptr;
+  }
+
+  const auto& stored_table_node = primary_key_predicates->stored_table_node;
+  auto output_operator = std::shared_ptr<AbstractOperator>{std::make_shared<PrimaryKeyLookup>(
+      stored_table_node->table_name, primary_key_predicates->key_values, stored_table_node->pruned_column_ids())};
+  output_operator->lqp_node = node;
+
+  // Lookups return all versions of the key.
+  if (const auto& validate_node = primary_key_predicates->validate_node) {
+    output_operator = std::make_shared<Validate>(output_operator);
+    output_operator->lqp_node = validate_node;
+  }
+
+  for (const auto& predicate_node : primary_key_predicates->remaining_predicate_nodes) {
+    output_operator = _translate_predicate_node_to_table_scan(predicate_node, output_operator);
+    output_operator->lqp_node = predicate_node;
+  }
+
+  return output_operator;
+}
+
 std::shared_ptr<TableScan> LQPTranslator::_translate_predicate_node_to_table_scan(
     const std::shared_ptr<PredicateNode>& node, const std::shared_ptr<AbstractOperator>& input_operator) const {
   return std::make_shared<TableScan>(input_operator, _translate_expression(node->predicate(), node->left_input(),
@@ -308,7 +547,14 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_sort_node(
   auto input_operator = _translate_node_recursively(node->left_input());
 
   std::shared_ptr<AbstractOperator> current_pqp = input_operator;
-  const auto& pqp_expressions = _translate_expressions(sort_node->node_expressions, node->left_input());
+  current_pqp = std::make_shared<Sort>(current_pqp, _translate_sort_column_definitions(sort_node));
+
+  return current_pqp;
+}
+
+std::vector<SortColumnDefinition> LQPTranslator::_translate_sort_column_definitions(
+    const std::shared_ptr<SortNode>& sort_node) const {
+  const auto& pqp_expressions = _translate_expressions(sort_node->node_expressions, sort_node->left_input());
 
   auto pqp_expression_iter = pqp_expressions.begin();
   auto sort_mode_iter = sort_node->sort_modes.begin();
@@ -323,9 +569,8 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_sort_node(
 
     column_definitions.emplace_back(pqp_column_expression->column_id, *sort_mode_iter);
   }
-  current_pqp = std::make_shared<Sort>(current_pqp, column_definitions);
 
-  return current_pqp;
+  return column_definitions;
 }
 
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_join_node(
@@ -357,16 +602,29 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_join_node(
   const auto& primary_join_predicate = join_predicates.front();
   std::vector<OperatorJoinPredicate> secondary_join_predicates(join_predicates.cbegin() + 1, join_predicates.cend());
 
+  // The IndexScanRule only sets the index side for single-predicate inner joins.
+  if (join_node->index_side) {
+    const auto index_side = *join_node->index_side == LQPInputSide::Left ? IndexSide::Left : IndexSide::Right;
+    return std::make_shared<JoinIndex>(left_input_operator, right_input_operator, join_node->join_mode,
+                                       primary_join_predicate, std::move(secondary_join_predicates), index_side);
+  }
+
   auto join_operator = std::shared_ptr<AbstractOperator>{};
 
   const auto left_data_type = join_node->join_predicates().front()->arguments[0]->data_type();
   const auto right_data_type = join_node->join_predicates().front()->arguments[1]->data_type();
 
-  // Lacking a proper cost model, we assume JoinHash is always faster than JoinSortMerge, which is faster than
-  // JoinNestedLoop and thus check for an operator compatible with the JoinNode in that order
+  // Without a calibrated cost model, we assume JoinHash is always faster than JoinSortMerge, which is faster than
+  // JoinNestedLoop and thus check for an operator compatible with the JoinNode in that order. With a cost model, the
+  // cheapest compatible operator is used.
   constexpr auto JOIN_OPERATOR_PREFERENCE_ORDER =
       hana::to_tuple(hana::tuple_t<JoinHash, JoinSortMerge, JoinNestedLoop>);
 
+  auto cheapest_join_operator_type = std::optional<OperatorType>{};
+  if (_cost_estimator) {
+    cheapest_join_operator_type = _cost_estimator->cheapest_join_operator(join_node).first;
+  }
+
   boost::hana::for_each(JOIN_OPERATOR_PREFERENCE_ORDER, [&](const auto join_operator_t) {
     using JoinOperator = typename decltype(join_operator_t)::type;
 
@@ -374,6 +632,10 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_join_node(
       return;
     }
 
+    if (cheapest_join_operator_type && *cheapest_join_operator_type != join_operator_type<JoinOperator>()) {
+      return;
+    }
+
     // NOLINTBEGIN(bugprone-use-after-move, hicpp-invalid-access-moved)
     // clang-tidy complains about the move in the loop as it does not recognize the early out above.
     if (JoinOperator::supports({join_node->join_mode, primary_join_predicate.predicate_condition, left_data_type,
@@ -429,10 +691,20 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_aggregate_node(
 
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_limit_node(
     const std::shared_ptr<AbstractLQPNode>& node) const {
-  const auto input_operator = _translate_node_recursively(node->left_input());
   auto limit_node = std::dynamic_pointer_cast<LimitNode>(node);
-  return std::make_shared<Limit>(
-      input_operator, _translate_expressions({limit_node->num_rows_expression()}, node->left_input()).front());
+  const auto num_rows_expression =
+      _translate_expressions({limit_node->num_rows_expression()}, node->left_input()).front();
+
+  // The TopKRule marks LimitNodes whose input SortNode is executed together with the limit.
+  if (limit_node->fuse_with_sort) {
+    const auto sort_node = std::dynamic_pointer_cast<SortNode>(node->left_input());
+    Assert(sort_node, "Expected SortNode as input of LimitNode fused with sort.");
+    const auto input_operator = _translate_node_recursively(sort_node->left_input());
+    return std::make_shared<TopK>(input_operator, _translate_sort_column_definitions(sort_node), num_rows_expression);
+  }
+
+  const auto input_operator = _translate_node_recursively(node->left_input());
+  return std::make_shared<Limit>(input_operator, num_rows_expression);
 }
 
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_insert_node(
@@ -468,7 +740,8 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_union_node(
 
   switch (union_node->set_operation_mode) {
     case SetOperationMode::Unique:
-      Fail("Currently, only the All and Positions modes are implemented for the union operation");
+      return std::make_shared<SetOperationHash>(input_operator_left, input_operator_right, SetOperationType::Union,
+                                                SetOperationMode::Unique);
     case SetOperationMode::All:
       return std::make_shared<UnionAll>(input_operator_left, input_operator_right);
     case SetOperationMode::Positions:
@@ -477,16 +750,28 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_union_node(
   Fail("Invalid enum value.");
 }
 
-// NOLINTNEXTLINE - while this particular method could be made static, others cannot.
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_intersect_node(
-    const std::shared_ptr<AbstractLQPNode>& /*node*/) const {
-  FailInput("Hyrise does not yet support set operations");
+    const std::shared_ptr<AbstractLQPNode>& node) const {
+  const auto intersect_node = std::dynamic_pointer_cast<IntersectNode>(node);
+  Assert(intersect_node->set_operation_mode != SetOperationMode::Positions,
+         "The Positions mode is not supported for the intersect operation");
+
+  const auto input_operator_left = _translate_node_recursively(node->left_input());
+  const auto input_operator_right = _translate_node_recursively(node->right_input());
+  return std::make_shared<SetOperationHash>(input_operator_left, input_operator_right, SetOperationType::Intersect,
+                                            intersect_node->set_operation_mode);
 }
 
-// NOLINTNEXTLINE - while this particular method could be made static, others cannot.
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_except_node(
-    const std::shared_ptr<AbstractLQPNode>& /*node*/) const {
-  FailInput("Hyrise does not yet support set operations");
+    const std::shared_ptr<AbstractLQPNode>& node) const {
+  const auto except_node = std::dynamic_pointer_cast<ExceptNode>(node);
+  Assert(except_node->set_operation_mode != SetOperationMode::Positions,
+         "The Positions mode is not supported for the except operation");
+
+  const auto input_operator_left = _translate_node_recursively(node->left_input());
+  const auto input_operator_right = _translate_node_recursively(node->right_input());
+  return std::make_shared<SetOperationHash>(input_operator_left, input_operator_right, SetOperationType::Except,
+                                            except_node->set_operation_mode);
 }
 
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_validate_node(
@@ -495,10 +780,188 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_validate_node(
   return std::make_shared<Validate>(input_operator);
 }
 
-// NOLINTNEXTLINE - while this particular method could be made static, others cannot.
+std::shared_ptr<AbstractOperator> LQPTranslator::_translate_chunk_pipeline(
+    const std::shared_ptr<AbstractLQPNode>& node) const {
+  // Collect the stages top-down. Nodes below the topmost stage are only fused if they have no other consumers.
+  // Otherwise, their result is needed by another operator and they become the pipeline's input.
+  auto stage_nodes = std::vector<std::shared_ptr<AbstractLQPNode>>{};
+  auto source_node = node;
+  while (is_chunk_pipeline_stage(*source_node) &&
+         (source_node == node ||
+          (source_node->output_count() == 1 && !_operator_by_lqp_node.contains(source_node)))) {
+    stage_nodes.emplace_back(source_node);
+    source_node = source_node->left_input();
+  }
+
+  if (stage_nodes.size() < 2) {
+    return nullptr;
+  }
+
+  const auto input_operator = _translate_node_recursively(source_node);
+
+  // The stages are built on top of a placeholder, which ChunkPipeline replaces with the morsels of its input.
+  const auto pipeline_source = std::make_shared<TableWrapper>(nullptr);
+  auto pipeline_root = std::shared_ptr<AbstractOperator>{pipeline_source};
+
+  for (auto stage_iter = stage_nodes.rbegin(); stage_iter != stage_nodes.rend(); ++stage_iter) {
+    const auto& stage_node = *stage_iter;
+    switch (stage_node->type) {
+      case LQPNodeType::Validate:
+        pipeline_root = std::make_shared<Validate>(pipeline_root);
+        break;
+      case LQPNodeType::Predicate:
+        pipeline_root = _translate_predicate_node_to_table_scan(std::static_pointer_cast<PredicateNode>(stage_node),
+                                                                pipeline_root);
+        break;
+      case LQPNodeType::Projection:
+        pipeline_root = std::make_shared<Projection>(
+            pipeline_root, _translate_expressions(stage_node->node_expressions, stage_node->left_input()));
+        break;
+      default:
+        Fail("Unexpected pipeline stage.");
+    }
+    pipeline_root->lqp_node = stage_node;
+  }
+
+  return std::make_shared<ChunkPipeline>(input_operator, pipeline_source, pipeline_root);
+}
+
+void LQPTranslator::_add_runtime_filters(const std::shared_ptr<AbstractOperator>& pqp) const {
+  auto join_operators = std::vector<std::shared_ptr<AbstractOperator>>{};
+  any_operator_in_pqp(pqp, [&](const auto& op) {
+    const auto join_node = std::dynamic_pointer_cast<const JoinNode>(op->lqp_node);
+    if (op->type() == OperatorType::JoinHash && join_node && join_node->runtime_filter_side) {
+      join_operators.emplace_back(op);
+    }
+    return false;
+  });
+
+  for (const auto& join_operator : join_operators) {
+    const auto& join_node = static_cast<const JoinNode&>(*join_operator->lqp_node);
+    const auto& primary_predicate = static_cast<const JoinHash&>(*join_operator).primary_predicate();
+    const auto build_side_is_right = *join_node.runtime_filter_side == LQPInputSide::Right;
+    const auto build_operator =
+        build_side_is_right ? join_operator->mutable_right_input() : join_operator->mutable_left_input();
+    const auto build_column_id =
+        build_side_is_right ? primary_predicate.column_ids.second : primary_predicate.column_ids.first;
+
+    // Follow the join column of the probe side down to the GetTable it stems from. Rows can only be dropped on the way
+    // if no other operator uses them and if they do not contribute to the result without a join partner.
+    auto probe_operator =
+        build_side_is_right ? join_operator->mutable_left_input() : join_operator->mutable_right_input();
+    auto probe_column_id =
+        build_side_is_right ? primary_predicate.column_ids.first : primary_predicate.column_ids.second;
+    auto path_operators = std::unordered_set<std::shared_ptr<AbstractOperator>>{};
+    auto get_table = std::shared_ptr<GetTable>{};
+    auto row_filter_operator = std::shared_ptr<AbstractOperator>{};
+
+    while (probe_operator->consumer_count() == 1) {
+      path_operators.emplace(probe_operator);
+      const auto operator_type = probe_operator->type();
+
+      if (operator_type == OperatorType::GetTable) {
+        get_table = std::static_pointer_cast<GetTable>(probe_operator);
+        break;
+      }
+
+      if (operator_type == OperatorType::TableScan || operator_type == OperatorType::Validate) {
+        // Both keep the columns of their input. Only the operator right above the GetTable filters rows, as
+        // Validate can only filter data tables.
+        const auto input_operator = probe_operator->mutable_left_input();
+        if (input_operator->type() == OperatorType::GetTable) {
+          row_filter_operator = probe_operator;
+        }
+        probe_operator = input_operator;
+        continue;
+      }
+
+      const auto probe_join_node = std::dynamic_pointer_cast<const JoinNode>(probe_operator->lqp_node);
+      if (operator_type != OperatorType::JoinHash || !probe_join_node ||
+          (probe_join_node->join_mode != JoinMode::Inner && probe_join_node->join_mode != JoinMode::Semi)) {
+        break;
+      }
+
+      // Inner joins output the columns of the left input followed by those of the right input, semi joins only output
+      // the columns of the left input.
+      const auto left_column_count = probe_join_node->left_input()->output_expressions().size();
+      if (probe_column_id < left_column_count) {
+        probe_operator = probe_operator->mutable_left_input();
+      } else {
+        probe_operator = probe_operator->mutable_right_input();
+        probe_column_id = static_cast<ColumnID>(probe_column_id - left_column_count);
+      }
+    }
+
+    if (!get_table) {
+      continue;
+    }
+
+    // The operators that apply the filter are executed after the build operator. Thus, neither they nor the operators
+    // above them may be required for the build operator.
+    if (any_operator_in_pqp(build_operator, [&](const auto& op) {
+          return op == join_operator || path_operators.contains(op);
+        })) {
+      continue;
+    }
+
+    const auto runtime_filter = std::make_shared<RuntimeFilter>(build_operator, build_column_id);
+
+    // GetTable applies the filter to the stored table, whose columns might have been pruned.
+    auto stored_column_id = probe_column_id;
+    for (const auto pruned_column_id : get_table->pruned_column_ids()) {
+      if (pruned_column_id <= stored_column_id) {
+        ++stored_column_id;
+      }
+    }
+    get_table->runtime_filters.emplace_back(runtime_filter, stored_column_id);
+
+    if (row_filter_operator) {
+      row_filter_operator->runtime_filters.emplace_back(runtime_filter, probe_column_id);
+    }
+  }
+}
+
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_window_node(
     const std::shared_ptr<AbstractLQPNode>& node) const {
-  FailInput("Hyrise does not yet support window functions.");
+  const auto input_operator = _translate_node_recursively(node->left_input());
+  const auto& input_expressions = node->left_input()->output_expressions();
+
+  const auto& lqp_expression = node->node_expressions.front();
+  const auto pqp_expression = _translate_expression(lqp_expression, node->left_input(), input_expressions);
+  const auto window_function_expression = std::static_pointer_cast<WindowFunctionExpression>(pqp_expression);
+
+  // As for AggregateNodes, we expect the argument as well as the PARTITION BY and ORDER BY expressions to be already
+  // present, i.e., we do not calculate them on the fly.
+  const auto find_column_id = [&](const auto& expression) {
+    const auto column_id = find_expression_idx(*expression, input_expressions);
+    Assert(column_id, "Window expression '" + expression->as_column_name() + "' not available as column");
+    return *column_id;
+  };
+
+  auto function_argument_column_id = INVALID_COLUMN_ID;
+  const auto& lqp_window_function = static_cast<const WindowFunctionExpression&>(*lqp_expression);
+  const auto& argument = lqp_window_function.argument();
+  if (argument && !WindowFunctionExpression::is_count_star(lqp_window_function)) {
+    function_argument_column_id = find_column_id(argument);
+  }
+
+  const auto& window = static_cast<const WindowExpression&>(*lqp_window_function.window());
+  const auto window_argument_count = window.arguments.size();
+  auto partition_by_column_ids = std::vector<ColumnID>{};
+  partition_by_column_ids.reserve(window.order_by_expressions_begin_idx);
+  auto order_by_column_ids = std::vector<ColumnID>{};
+  order_by_column_ids.reserve(window_argument_count - window.order_by_expressions_begin_idx);
+  for (auto expression_idx = size_t{0}; expression_idx < window_argument_count; ++expression_idx) {
+    const auto column_id = find_column_id(window.arguments[expression_idx]);
+    if (expression_idx < window.order_by_expressions_begin_idx) {
+      partition_by_column_ids.emplace_back(column_id);
+    } else {
+      order_by_column_ids.emplace_back(column_id);
+    }
+  }
+
+  return std::make_shared<WindowFunctionEvaluator>(input_operator, partition_by_column_ids, order_by_column_ids,
+                                                   function_argument_column_id, window_function_expression);
 }
 
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_change_meta_table_node(
@@ -548,6 +1011,14 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_drop_table_node(
   return std::make_shared<DropTable>(drop_table_node->table_name, drop_table_node->if_exists);
 }
 
+// NOLINTNEXTLINE - while this particular method could be made static, others cannot.
+std::shared_ptr<AbstractOperator> LQPTranslator::_translate_create_index_node(
+    const std::shared_ptr<AbstractLQPNode>& node) const {
+  const auto create_index_node = std::dynamic_pointer_cast<CreateIndexNode>(node);
+  return std::make_shared<CreateIndex>(create_index_node->index_name, create_index_node->table_name,
+                                       create_index_node->column_id, create_index_node->if_not_exists);
+}
+
 // NOLINTNEXTLINE - while this particular method could be made static, others cannot.
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_import_node(
     const std::shared_ptr<AbstractLQPNode>& node) const {
@@ -599,10 +1070,12 @@ std::shared_ptr<AbstractExpression> LQPTranslator::_translate_expression(
       return ExpressionVisitation::DoNotVisitArguments;
     }
 
-    // Resolve COUNT(*)
+    // Resolve COUNT(*), keeping its window definition (if any) when used as a window function.
     if (WindowFunctionExpression::is_count_star(*expression)) {
       const auto star = std::make_shared<PQPColumnExpression>(INVALID_COLUMN_ID, DataType::Long, false, "*");
-      expression = std::make_shared<WindowFunctionExpression>(WindowFunction::Count, star);
+      const auto& window = static_cast<const WindowFunctionExpression&>(*expression).window();
+      const auto pqp_window = window ? _translate_expression(window, node, output_expressions) : nullptr;
+      expression = std::make_shared<WindowFunctionExpression>(WindowFunction::Count, star, pqp_window);
       return ExpressionVisitation::DoNotVisitArguments;
     }
 
@@ -625,7 +1098,7 @@ std::shared_ptr<AbstractExpression> LQPTranslator::_translate_expression(
        */
       auto subquery_pqp = std::shared_ptr<AbstractOperator>();
       if (subquery_expression->is_correlated()) {
-        subquery_pqp = LQPTranslator{}.translate_node(subquery_expression->lqp);
+        subquery_pqp = LQPTranslator{_use_chunk_pipelines, _cost_estimator}.translate_node(subquery_expression->lqp);
       } else {
         subquery_pqp = _translate_node_recursively(subquery_expression->lqp);
       }
@@ -10,9 +10,11 @@
 namespace hyrise {
 
 class AbstractOperator;
+class CostEstimatorCalibrated;
 class TransactionContext;
 class AbstractExpression;
 class PredicateNode;
+class SortNode;
 class TableScan;
 struct OperatorScanPredicate;
 struct OperatorJoinPredicate;
@@ -20,14 +22,28 @@ struct OperatorJoinPredicate;
 /**
  * Translates an LQP (Logical Query Plan), represented by its root node, into an Operator tree for the execution
  * engine, which in return is represented by its root Operator.
+ *
+ * If use_chunk_pipelines is set, chains of Validate, TableScan, and Projection operators are fused into ChunkPipeline
+ * operators, which pass each morsel of their input through the entire chain. Each stage still materializes its result
+ * for the morsel, but only for a single morsel at a time instead of for the entire input. Such a chain ends at a
+ * pipeline breaker, i.e., at any other node, at a node with multiple outputs, or at a node that uses subqueries. The
+ * default constructor uses Hyrise::get().use_chunk_pipelines.
+ *
+ * If Hyrise::get().cost_model is set, joins are translated to the join operator with the lowest estimated cost. As
+ * the estimations are cached by LQP node, the LQP must not be modified while it is translated.
+ * Otherwise, JoinHash is preferred over JoinSortMerge, which is preferred over JoinNestedLoop.
  */
 class LQPTranslator {
  public:
+  LQPTranslator();
+  explicit LQPTranslator(const bool use_chunk_pipelines);
   ~LQPTranslator() = default;
 
   std::shared_ptr<AbstractOperator> translate_node(const std::shared_ptr<AbstractLQPNode>& node) const;
 
  private:
+  LQPTranslator(const bool use_chunk_pipelines, const std::shared_ptr<const CostEstimatorCalibrated>& cost_estimator);
+
   std::shared_ptr<AbstractOperator> _translate_node_recursively(const std::shared_ptr<AbstractLQPNode>& node) const;
 
   std::shared_ptr<AbstractOperator> _translate_by_node_type(LQPNodeType type,
@@ -37,11 +53,17 @@ class LQPTranslator {
   std::shared_ptr<AbstractOperator> _translate_predicate_node(const std::shared_ptr<AbstractLQPNode>& node) const;
   std::shared_ptr<AbstractOperator> _translate_predicate_node_to_index_scan(
       const std::shared_ptr<PredicateNode>& node, const std::shared_ptr<AbstractOperator>& input_operator) const;
+  std::shared_ptr<AbstractOperator> _translate_predicate_node_to_table_index_scan(
+      const std::shared_ptr<PredicateNode>& node) const;
+  std::shared_ptr<AbstractOperator> _translate_predicate_node_to_primary_key_lookup(
+      const std::shared_ptr<PredicateNode>& node) const;
   std::shared_ptr<TableScan> _translate_predicate_node_to_table_scan(
       const std::shared_ptr<PredicateNode>& node, const std::shared_ptr<AbstractOperator>& input_operator) const;
   std::shared_ptr<AbstractOperator> _translate_alias_node(const std::shared_ptr<AbstractLQPNode>& node) const;
   std::shared_ptr<AbstractOperator> _translate_projection_node(const std::shared_ptr<AbstractLQPNode>& node) const;
   std::shared_ptr<AbstractOperator> _translate_sort_node(const std::shared_ptr<AbstractLQPNode>& node) const;
+  std::vector<SortColumnDefinition> _translate_sort_column_definitions(
+      const std::shared_ptr<SortNode>& sort_node) const;
   std::shared_ptr<AbstractOperator> _translate_join_node(const std::shared_ptr<AbstractLQPNode>& node) const;
   std::shared_ptr<AbstractOperator> _translate_aggregate_node(const std::shared_ptr<AbstractLQPNode>& node) const;
   std::shared_ptr<AbstractOperator> _translate_limit_node(const std::shared_ptr<AbstractLQPNode>& node) const;
@@ -58,6 +80,17 @@ class LQPTranslator {
   std::shared_ptr<AbstractOperator> _translate_validate_node(const std::shared_ptr<AbstractLQPNode>& node) const;
   std::shared_ptr<AbstractOperator> _translate_window_node(const std::shared_ptr<AbstractLQPNode>& node) const;
 
+  // Returns a ChunkPipeline if `node` is the topmost of at least two fusable nodes, nullptr otherwise.
+  std::shared_ptr<AbstractOperator> _translate_chunk_pipeline(const std::shared_ptr<AbstractLQPNode>& node) const;
+
+  /**
+   * Adds RuntimeFilters to the hash joins of the translated PQP whose JoinNode has a runtime_filter_side. The filter is
+   * applied by the GetTable that the join column of the probe side stems from and by the TableScan or Validate right
+   * above it. This is only possible if the way from the join to the GetTable consists of TableScans, Validates, and
+   * inner or semi hash joins that are not used by other operators. Thus, the PQP has to be translated completely.
+   */
+  void _add_runtime_filters(const std::shared_ptr<AbstractOperator>& pqp) const;
+
   // Maintenance operators
   std::shared_ptr<AbstractOperator> _translate_show_tables_node(const std::shared_ptr<AbstractLQPNode>& node) const;
   std::shared_ptr<AbstractOperator> _translate_show_columns_node(const std::shared_ptr<AbstractLQPNode>& node) const;
@@ -65,6 +98,7 @@ class LQPTranslator {
   std::shared_ptr<AbstractOperator> _translate_drop_view_node(const std::shared_ptr<AbstractLQPNode>& node) const;
   std::shared_ptr<AbstractOperator> _translate_create_table_node(const std::shared_ptr<AbstractLQPNode>& node) const;
   std::shared_ptr<AbstractOperator> _translate_drop_table_node(const std::shared_ptr<AbstractLQPNode>& node) const;
+  std::shared_ptr<AbstractOperator> _translate_create_index_node(const std::shared_ptr<AbstractLQPNode>& node) const;
   std::shared_ptr<AbstractOperator> _translate_import_node(const std::shared_ptr<AbstractLQPNode>& node) const;
   std::shared_ptr<AbstractOperator> _translate_export_node(const std::shared_ptr<AbstractLQPNode>& node) const;
   std::shared_ptr<AbstractOperator> _translate_create_prepared_plan_node(
@@ -83,6 +117,12 @@ class LQPTranslator {
   //   - identical operators (operators below a diamond shape)
   //   - equal but not identical operators
   mutable LQPNodeUnorderedMap<std::shared_ptr<AbstractOperator>> _operator_by_lqp_node;
+
+  const bool _use_chunk_pipelines;
+
+  // Chooses the join operators if a calibrated cost model is available, nullptr otherwise. It caches the statistics of
+  // the translated subplans and is shared with the translators of correlated subqueries.
+  const std::shared_ptr<const CostEstimatorCalibrated> _cost_estimator;
 };
 
 }  // namespace hyrise
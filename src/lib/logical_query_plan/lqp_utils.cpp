@@ -1,9 +1,13 @@
 #include "lqp_utils.hpp"
 
 #include "expression/abstract_expression.hpp"
+#include "expression/binary_predicate_expression.hpp"
 #include "expression/expression_functional.hpp"
 #include "expression/expression_utils.hpp"
+#include "expression/lqp_column_expression.hpp"
 #include "expression/lqp_subquery_expression.hpp"
+#include "expression/value_expression.hpp"
+#include "hyrise.hpp"
 #include "logical_query_plan/change_meta_table_node.hpp"
 #include "logical_query_plan/insert_node.hpp"
 #include "logical_query_plan/mock_node.hpp"
@@ -12,6 +16,8 @@
 #include "logical_query_plan/stored_table_node.hpp"
 #include "logical_query_plan/union_node.hpp"
 #include "logical_query_plan/update_node.hpp"
+#include "storage/index/adaptive_radix_tree/primary_key_index.hpp"
+#include "storage/table.hpp"
 #include "utils/assert.hpp"
 
 namespace {
@@ -303,6 +309,7 @@ std::set<std::string> lqp_find_modified_tables(const std::shared_ptr<AbstractLQP
       case LQPNodeType::ChangeMetaTable:
         modified_tables.insert(static_cast<ChangeMetaTableNode&>(*node).table_name);
         break;
+      case LQPNodeType::CreateIndex:
       case LQPNodeType::CreateTable:
       case LQPNodeType::CreatePreparedPlan:
       case LQPNodeType::DropTable:
@@ -626,4 +633,90 @@ std::shared_ptr<AbstractLQPNode> find_diamond_origin_node(const std::shared_ptr<
   return nullptr;
 }
 
+std::optional<PrimaryKeyPredicates> find_primary_key_predicates(const std::shared_ptr<PredicateNode>& predicate_node) {
+  auto predicate_nodes = std::vector<std::shared_ptr<PredicateNode>>{predicate_node};
+  auto node = predicate_node->left_input();
+  while (node->type == LQPNodeType::Predicate && node->output_count() == 1) {
+    predicate_nodes.emplace_back(std::static_pointer_cast<PredicateNode>(node));
+    node = node->left_input();
+  }
+
+  auto validate_node = std::shared_ptr<AbstractLQPNode>{};
+  if (node->type == LQPNodeType::Validate) {
+    validate_node = node;
+    node = node->left_input();
+  }
+
+  if (node->type != LQPNodeType::StoredTable) {
+    return std::nullopt;
+  }
+
+  const auto stored_table_node = std::static_pointer_cast<StoredTableNode>(node);
+  const auto table = Hyrise::get().storage_manager.get_table(stored_table_node->table_name);
+  const auto primary_key_index = table->primary_key_index();
+  if (!primary_key_index) {
+    return std::nullopt;
+  }
+
+  const auto& key_column_ids = primary_key_index->column_ids();
+  auto key_values = std::vector<std::optional<AllTypeVariant>>(key_column_ids.size());
+  auto remaining_predicate_nodes = std::vector<std::shared_ptr<PredicateNode>>{};
+
+  for (auto node_iter = predicate_nodes.rbegin(); node_iter != predicate_nodes.rend(); ++node_iter) {
+    const auto& current_predicate_node = *node_iter;
+    const auto predicate = std::dynamic_pointer_cast<BinaryPredicateExpression>(current_predicate_node->predicate());
+    if (!predicate || predicate->predicate_condition != PredicateCondition::Equals) {
+      remaining_predicate_nodes.emplace_back(current_predicate_node);
+      continue;
+    }
+
+    auto column_expression = std::dynamic_pointer_cast<LQPColumnExpression>(predicate->left_operand());
+    auto value_expression = std::dynamic_pointer_cast<ValueExpression>(predicate->right_operand());
+    if (!column_expression || !value_expression) {
+      column_expression = std::dynamic_pointer_cast<LQPColumnExpression>(predicate->right_operand());
+      value_expression = std::dynamic_pointer_cast<ValueExpression>(predicate->left_operand());
+    }
+
+    // Strings and numbers are not compared like their casted values, so such predicates are left to the TableScan.
+    const auto binds_key_column = [&]() {
+      if (!column_expression || !value_expression || variant_is_null(value_expression->value) ||
+          column_expression->original_node.lock() != stored_table_node) {
+        return false;
+      }
+
+      const auto column_is_string = table->column_data_type(column_expression->original_column_id) == DataType::String;
+      const auto value_is_string = value_expression->data_type() == DataType::String;
+      return column_is_string == value_is_string;
+    }();
+
+    const auto key_column_iter =
+        binds_key_column
+            ? std::find(key_column_ids.cbegin(), key_column_ids.cend(), column_expression->original_column_id)
+            : key_column_ids.cend();
+    if (key_column_iter == key_column_ids.cend()) {
+      remaining_predicate_nodes.emplace_back(current_predicate_node);
+      continue;
+    }
+
+    auto& key_value = key_values[std::distance(key_column_ids.cbegin(), key_column_iter)];
+    if (key_value) {
+      // The column is bound twice. Only the first predicate is used for the lookup, the second one is still scanned.
+      remaining_predicate_nodes.emplace_back(current_predicate_node);
+      continue;
+    }
+    key_value = value_expression->value;
+  }
+
+  auto result = PrimaryKeyPredicates{stored_table_node, validate_node, {}, std::move(remaining_predicate_nodes)};
+  result.key_values.reserve(key_values.size());
+  for (const auto& key_value : key_values) {
+    if (!key_value) {
+      return std::nullopt;
+    }
+    result.key_values.emplace_back(*key_value);
+  }
+
+  return result;
+}
+
 }  // namespace hyrise
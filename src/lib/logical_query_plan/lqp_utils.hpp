@@ -4,12 +4,15 @@
 #include <set>
 #include <unordered_set>
 
+#include "all_type_variant.hpp"
 #include "logical_query_plan/abstract_lqp_node.hpp"
 
 namespace hyrise {
 
 class AbstractExpression;
 class LQPSubqueryExpression;
+class PredicateNode;
+class StoredTableNode;
 
 enum class LQPInputSide;
 
@@ -262,4 +265,29 @@ void remove_invalid_fds(const std::shared_ptr<const AbstractLQPNode>& lqp, Funct
  */
 std::shared_ptr<AbstractLQPNode> find_diamond_origin_node(const std::shared_ptr<AbstractLQPNode>& union_root_node);
 
+/**
+ * A chain of PredicateNodes on top of a StoredTableNode (possibly separated by a ValidateNode) that binds each column
+ * of the table's PrimaryKeyIndex to a value with an equality predicate. See find_primary_key_predicates().
+ */
+struct PrimaryKeyPredicates {
+  std::shared_ptr<StoredTableNode> stored_table_node;
+
+  // nullptr if the PredicateNodes directly follow the StoredTableNode.
+  std::shared_ptr<AbstractLQPNode> validate_node;
+
+  // The values of the key columns, in the order of PrimaryKeyIndex::column_ids().
+  std::vector<AllTypeVariant> key_values;
+
+  // PredicateNodes of the chain that do not bind a key column, from the bottom to the top.
+  std::vector<std::shared_ptr<PredicateNode>> remaining_predicate_nodes;
+};
+
+/**
+ * Checks whether the rows selected by @param predicate_node and the PredicateNodes below it can be retrieved with a
+ * single lookup in the PrimaryKeyIndex of the underlying table, i.e., whether the chain contains a predicate of the
+ * form <key column> = <value> for each key column. Lower PredicateNodes are only considered if they have no other
+ * outputs. @returns std::nullopt if the table has no PrimaryKeyIndex or not all key columns are bound.
+ */
+std::optional<PrimaryKeyPredicates> find_primary_key_predicates(const std::shared_ptr<PredicateNode>& predicate_node);
+
 }  // namespace hyrise
@@ -23,8 +23,17 @@ std::vector<std::shared_ptr<AbstractExpression>> UnionNode::output_expressions()
    * Asserting matching table schemas leads to multiple fetches of a subplan's output expressions. Though this does not
    * have performance implications now, they may arise in the future. In this case, consider relaxing the check by using
    * `DebugAssert`.
+   *
+   * UnionPositions merges the PosLists of the same table(s), so both inputs have to output the same expressions. The
+   * other modes unite the rows of arbitrary inputs (e.g., SQL's UNION [ALL]) and only require the same number of
+   * columns. Like in SQL, the output columns are named after the left input's columns.
    */
-  Assert(expressions_equal(left_expressions, right_input()->output_expressions()), "Input Expressions must match");
+  const auto& right_expressions = right_input()->output_expressions();
+  if (set_operation_mode == SetOperationMode::Positions) {
+    Assert(expressions_equal(left_expressions, right_expressions), "Input Expressions must match");
+  } else {
+    Assert(left_expressions.size() == right_expressions.size(), "Inputs must have the same number of columns");
+  }
   return left_expressions;
 }
 
@@ -58,8 +67,14 @@ UniqueColumnCombinations UnionNode::unique_column_combinations() const {
        */
       return UniqueColumnCombinations{};
     }
-    case SetOperationMode::Unique:
-      Fail("ToDo, see discussion https://github.com/hyrise/hyrise/pull/2156#discussion_r452803825");
+    case SetOperationMode::Unique: {
+      /**
+       * The output of SetOperationHash does not contain duplicates. However, rows from the left and the right input
+       * might share values for a subset of the columns. Thus, the input UCCs do not remain valid, and we discard them.
+       * See also https://github.com/hyrise/hyrise/pull/2156#discussion_r452803825.
+       */
+      return UniqueColumnCombinations{};
+    }
   }
   Fail("Unhandled UnionMode");
 }
@@ -90,10 +105,15 @@ FunctionalDependencies UnionNode::non_trivial_functional_dependencies() const {
                   "Expected both input nodes to pass the same non-trivial FDs.");
       return non_trivial_fds;
     }
-    default: {
-      Fail("Unhandled UnionMode");
+    case SetOperationMode::Unique: {
+      /**
+       * The rows of both inputs are merged, so an FD that holds for each input does not necessarily hold for the
+       * output. As the inputs of SQL's UNION usually have different expressions anyway, we do not pass any FDs.
+       */
+      return FunctionalDependencies{};
     }
   }
+  Fail("Unhandled UnionMode");
 }
 
 size_t UnionNode::_on_shallow_hash() const {
@@ -28,12 +28,13 @@ class UnionNode : public EnableMakeForLQPNode<UnionNode>, public AbstractLQPNode
   /**
    * (1) Forwards unique column combinations from the left input node in case of SetOperationMode::Positions.
    *     (UCCs of both, left and right input node are identical)
-   * (2) Discards all input unique column combinations for SetOperationMode::All and
-   * (3) Fails for SetOperationMode::Unique, which is not yet implemented.
+   * (2) Discards all input unique column combinations for SetOperationMode::All.
+   * (3) Discards all input unique column combinations for SetOperationMode::Unique.
    */
   UniqueColumnCombinations unique_column_combinations() const override;
 
-  // Implementation is limited to SetOperationMode::Positions only. Passes FDs from the left input node.
+  // Passes FDs from the left input node for SetOperationMode::Positions and FDs valid for both input nodes for
+  // SetOperationMode::All. Does not pass any FDs for SetOperationMode::Unique.
   FunctionalDependencies non_trivial_functional_dependencies() const override;
 
   const SetOperationMode set_operation_mode;
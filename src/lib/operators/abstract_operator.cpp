@@ -6,6 +6,7 @@
 #include "logical_query_plan/abstract_non_query_node.hpp"
 #include "logical_query_plan/dummy_table_node.hpp"
 #include "operators/get_table.hpp"
+#include "operators/runtime_filter.hpp"
 #include "resolve_type.hpp"
 #include "scheduler/operator_task.hpp"
 #include "storage/table.hpp"
@@ -126,6 +127,11 @@ void AbstractOperator::execute() {
     subquery_expression->pqp->deregister_consumer();
   }
 
+  // The cached results of correlated subqueries are not needed anymore.
+  for (const auto& subquery_expression : _correlated_subquery_expressions) {
+    subquery_expression->result_cache->clear();
+  }
+
   if constexpr (HYRISE_DEBUG) {
     // Verify that LQP (if set) and PQP match.
     if (lqp_node) {
@@ -217,6 +223,24 @@ std::shared_ptr<AbstractOperator> AbstractOperator::deep_copy(
   const auto copied_op = _on_deep_copy(copied_left_input, copied_right_input, copied_ops);
   copied_op->lqp_node = lqp_node;
 
+  // Operators that apply the same runtime filter as their input share its copy, so that it is only built once.
+  for (const auto& [runtime_filter, column_id] : runtime_filters) {
+    auto copied_runtime_filter = std::shared_ptr<RuntimeFilter>{};
+    if (left_input()) {
+      const auto& input_runtime_filters = left_input()->runtime_filters;
+      for (auto filter_idx = size_t{0}; filter_idx < input_runtime_filters.size(); ++filter_idx) {
+        if (input_runtime_filters[filter_idx].first == runtime_filter) {
+          copied_runtime_filter = copied_left_input->runtime_filters[filter_idx].first;
+        }
+      }
+    }
+
+    if (!copied_runtime_filter) {
+      copied_runtime_filter = runtime_filter->deep_copy(copied_ops);
+    }
+    copied_op->runtime_filters.emplace_back(copied_runtime_filter, column_id);
+  }
+
   /**
    * Set the transaction context so that we can execute the copied plan in the current transaction
    * (see, e.g., ExpressionEvaluator::_evaluate_subquery_expression_for_row)
@@ -390,6 +414,9 @@ void AbstractOperator::_search_and_register_uncorrelated_subqueries(
 
   for (const auto& subquery_expression : pqp_subquery_expressions) {
     if (subquery_expression->is_correlated()) {
+      // Remember correlated subqueries to clear their cached results after execution (see
+      // CorrelatedSubqueryResultCache).
+      _correlated_subquery_expressions.emplace_back(subquery_expression);
       continue;
     }
     /**
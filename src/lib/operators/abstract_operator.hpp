@@ -4,6 +4,8 @@
 #include <memory>
 #include <mutex>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include "all_parameter_variant.hpp"
 #include "logical_query_plan/abstract_lqp_node.hpp"
@@ -12,6 +14,7 @@
 namespace hyrise {
 
 class OperatorTask;
+class RuntimeFilter;
 class Table;
 class TransactionContext;
 class PQPSubqueryExpression;
@@ -20,6 +23,8 @@ enum class OperatorType {
   Aggregate,
   Alias,
   ChangeMetaTable,
+  ChunkPipeline,
+  CreateIndex,
   CreateTable,
   CreatePreparedPlan,
   CreateView,
@@ -38,16 +43,21 @@ enum class OperatorType {
   JoinSortMerge,
   JoinVerification,
   Limit,
+  PrimaryKeyLookup,
   Print,
   Product,
   Projection,
+  SetOperationHash,
   Sort,
+  TableIndexScan,
   TableScan,
   TableWrapper,
+  TopK,
   UnionAll,
   UnionPositions,
   Update,
   Validate,
+  WindowFunction,
   Mock  // for Tests that need to Mock operators
 };
 
@@ -98,8 +108,10 @@ enum class OperatorState { Created, Running, ExecutedAndAvailable, ExecutedAndCl
  *      starts, to prevent subquery results from being cleared too early. Otherwise, operators may need to re-execute,
  *      which is illegal.
  *
- *      In contrast to uncorrelated subqueries, correlated subqueries are deep-copied for each row that they are
- *      executed on, so the registration happens at execution time in the ExpressionEvaluator.
+ *      In contrast to uncorrelated subqueries, correlated subqueries are deep-copied for each distinct combination of
+ *      parameter values that they are executed on, so the registration happens at execution time in the
+ *      ExpressionEvaluator. Their results are cached by the parameter values until the consuming operator has
+ *      executed (see CorrelatedSubqueryResultCache).
  *
  * AUTOMATIC CLEARING
  *  Operators clear themselves automatically by calling clear_output when the last consumer deregisters. Note that
@@ -213,6 +225,12 @@ class AbstractOperator : public std::enable_shared_from_this<AbstractOperator>,
   // LQP node with which this operator has been created. Might be uninitialized.
   std::shared_ptr<const AbstractLQPNode> lqp_node;
 
+  /**
+   * Runtime filters that the operator applies to the given column of its input (for GetTable, of the stored table).
+   * Only GetTable, TableScan, and Validate use them. Set by the LQPTranslator, see RuntimeFilter for details.
+   */
+  std::vector<std::pair<std::shared_ptr<RuntimeFilter>, ColumnID>> runtime_filters;
+
   std::unique_ptr<AbstractOperatorPerformanceData> performance_data;
 
  protected:
@@ -258,6 +276,9 @@ class AbstractOperator : public std::enable_shared_from_this<AbstractOperator>,
   // subqueries in AbstractOperator to create their tasks.
   std::vector<std::shared_ptr<PQPSubqueryExpression>> _uncorrelated_subquery_expressions;
 
+  // Correlated subqueries of these operators, whose result caches are cleared after execution.
+  std::vector<std::shared_ptr<PQPSubqueryExpression>> _correlated_subquery_expressions;
+
   /**
    * OperatorTasks wrap operators for scheduling. Since operator results are shared between uncorrelated subqueries
    * and their outer queries, OperatorTasks should be shared, too, to reduce scheduling overhead and to prevent
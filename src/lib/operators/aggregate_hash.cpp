@@ -1,6 +1,9 @@
 #include "aggregate_hash.hpp"
 
+#include <algorithm>
+#include <bit>
 #include <cmath>
+#include <iterator>
 #include <memory>
 #include <optional>
 #include <string>
@@ -135,15 +138,99 @@ AggregateKey& get_aggregate_key([[maybe_unused]] KeysPerChunk<AggregateKey>& key
   }
 }
 
+// Calls functor(chunk_offset) for each row of a chunk with `chunk_size` rows or, if given, only for the `positions`.
+template <typename Functor>
+void for_each_chunk_offset(const ChunkOffset chunk_size, const std::shared_ptr<const RowIDPosList>& positions,
+                           const Functor& functor) {
+  if (positions) {
+    for (const auto& row_id : *positions) {
+      functor(row_id.chunk_offset);
+    }
+  } else {
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+      functor(chunk_offset);
+    }
+  }
+}
+
+// Maximum number of partitions of the parallel aggregation (as a power of two). Each partition requires a position
+// list per remaining chunk, so more partitions than workers do not pay off.
+constexpr auto MAX_RADIX_BITS = uint32_t{6};
+
+// Partitions by the most significant bits of the hash. As std::hash is the identity for integers, the hash is
+// multiplied with the golden ratio first (Fibonacci hashing) so that consecutive keys spread across the partitions.
+template <typename AggregateKey>
+size_t radix_partition(const AggregateKey& key, const uint32_t radix_bits) {
+  if (radix_bits == 0) {
+    return 0;
+  }
+  const auto hash = static_cast<uint64_t>(std::hash<AggregateKey>{}(key)) * uint64_t{0x9E3779B97F4A7C15};
+  return static_cast<size_t>(hash >> (64 - radix_bits));
+}
+
+// Merges the result of a group that was aggregated on a disjoint set of rows (`source`) into `target`.
+template <typename ColumnDataType, WindowFunction aggregate_function, typename AggregateResult>
+void merge_aggregate_results(AggregateResult& target, const AggregateResult& source) {
+  if (target.row_id.is_null()) {
+    target.row_id = source.row_id;
+  }
+
+  if (source.aggregate_count == 0) {
+    return;
+  }
+
+  if constexpr (aggregate_function == WindowFunction::Min) {
+    if (target.aggregate_count == 0 || value_smaller(source.accumulator, target.accumulator)) {
+      target.accumulator = source.accumulator;
+    }
+  } else if constexpr (aggregate_function == WindowFunction::Max) {
+    if (target.aggregate_count == 0 || value_greater(source.accumulator, target.accumulator)) {
+      target.accumulator = source.accumulator;
+    }
+  } else if constexpr (aggregate_function == WindowFunction::Sum || aggregate_function == WindowFunction::Avg) {
+    // Avg stores the sum, see WindowFunctionBuilder.
+    if constexpr (std::is_arithmetic_v<ColumnDataType>) {
+      target.accumulator += source.accumulator;
+    } else {
+      Fail("SUM and AVG are not available for non-arithmetic types.");
+    }
+  } else if constexpr (aggregate_function == WindowFunction::CountDistinct) {
+    target.accumulator.insert(source.accumulator.begin(), source.accumulator.end());
+  } else if constexpr (aggregate_function == WindowFunction::StandardDeviationSample) {
+    if constexpr (std::is_arithmetic_v<ColumnDataType>) {
+      // Combine the counts, means, and squared distances from the mean of both sides (Chan et al.)
+      // https://en.wikipedia.org/wiki/Algorithms_for_calculating_variance#Parallel_algorithm
+      auto& [count, mean, squared_distance_from_mean, result] = target.accumulator;
+      const auto& [source_count, source_mean, source_squared_distance_from_mean, source_result] = source.accumulator;
+
+      const auto combined_count = count + source_count;
+      const auto delta = source_mean - mean;
+      squared_distance_from_mean +=
+          source_squared_distance_from_mean + delta * delta * count * source_count / combined_count;
+      mean += delta * source_count / combined_count;
+      count = combined_count;
+
+      if (count > 1) {
+        result = std::sqrt(squared_distance_from_mean / (count - 1));
+      }
+    } else {
+      Fail("StandardDeviationSample not available for non-arithmetic types.");
+    }
+  }
+
+  target.aggregate_count += source.aggregate_count;
+}
+
 }  // namespace
 
 namespace hyrise {
 
 AggregateHash::AggregateHash(const std::shared_ptr<AbstractOperator>& input_operator,
                              const std::vector<std::shared_ptr<WindowFunctionExpression>>& aggregates,
-                             const std::vector<ColumnID>& groupby_column_ids)
+                             const std::vector<ColumnID>& groupby_column_ids, const ExecutionMode execution_mode)
     : AbstractAggregateOperator(input_operator, aggregates, groupby_column_ids,
-                                std::make_unique<OperatorPerformanceData<OperatorSteps>>()) {
+                                std::make_unique<OperatorPerformanceData<OperatorSteps>>()),
+      _execution_mode(execution_mode) {
   // NOLINTNEXTLINE - clang-tidy wants _has_aggregate_functions in the member initializer list
   _has_aggregate_functions =
       !_aggregates.empty() && !std::all_of(_aggregates.begin(), _aggregates.end(), [](const auto aggregate_expression) {
@@ -160,7 +247,7 @@ std::shared_ptr<AbstractOperator> AggregateHash::_on_deep_copy(
     const std::shared_ptr<AbstractOperator>& copied_left_input,
     const std::shared_ptr<AbstractOperator>& /*copied_right_input*/,
     std::unordered_map<const AbstractOperator*, std::shared_ptr<AbstractOperator>>& /*copied_ops*/) const {
-  return std::make_shared<AggregateHash>(copied_left_input, _aggregates, _groupby_column_ids);
+  return std::make_shared<AggregateHash>(copied_left_input, _aggregates, _groupby_column_ids, _execution_mode);
 }
 
 void AggregateHash::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {}
@@ -202,24 +289,27 @@ struct AggregateContext : public AggregateResultContext<ColumnDataType, aggregat
 };
 
 template <typename ColumnDataType, WindowFunction aggregate_function, typename AggregateKey>
-__attribute__((hot)) void AggregateHash::_aggregate_segment(ChunkID chunk_id, ColumnID column_index,
-                                                            const AbstractSegment& abstract_segment,
-                                                            KeysPerChunk<AggregateKey>& keys_per_chunk) {
+__attribute__((hot)) void AggregateHash::_aggregate_segment(
+    ChunkID chunk_id, ColumnID column_index, const AbstractSegment& abstract_segment,
+    KeysPerChunk<AggregateKey>& keys_per_chunk, std::vector<std::shared_ptr<SegmentVisitorContext>>& contexts,
+    const std::shared_ptr<const RowIDPosList>& positions) {
   using AggregateType = typename WindowFunctionTraits<ColumnDataType, aggregate_function>::ReturnType;
 
   auto aggregator = WindowFunctionBuilder<ColumnDataType, AggregateType, aggregate_function>().get_aggregate_function();
 
   auto& context = *std::static_pointer_cast<AggregateContext<ColumnDataType, aggregate_function, AggregateKey>>(
-      _contexts_per_column[column_index]);
+      contexts[column_index]);
 
   auto& result_ids = *context.result_ids;
   auto& results = context.results;
 
-  auto chunk_offset = ChunkOffset{0};
+  // Index into `positions` if the segment is filtered, otherwise equal to the chunk offset.
+  auto position_idx = ChunkOffset{0};
 
   // CacheResultIds is a boolean type parameter that is forwarded to get_or_add_result, see the documentation over there
   // for details.
   const auto process_position = [&](const auto cache_result_ids, const auto& position) {
+    const auto chunk_offset = positions ? (*positions)[position_idx].chunk_offset : position_idx;
     auto& result = get_or_add_result(cache_result_ids, result_ids, results,
                                      get_aggregate_key<AggregateKey>(keys_per_chunk, chunk_id, chunk_offset),
                                      RowID{chunk_id, chunk_offset});
@@ -236,19 +326,25 @@ __attribute__((hot)) void AggregateHash::_aggregate_segment(ChunkID chunk_id, Co
       ++result.aggregate_count;
     }
 
-    ++chunk_offset;
+    ++position_idx;
+  };
+
+  const auto iterate = [&](const auto& functor) {
+    if (positions) {
+      segment_iterate_filtered<ColumnDataType>(abstract_segment, positions, functor);
+    } else {
+      segment_iterate<ColumnDataType>(abstract_segment, functor);
+    }
   };
 
   // Pass true_type into get_or_add_result to enable certain optimizations: If we have more than one aggregate function
   // (and thus more than one context), it makes sense to cache the results indexes, see get_or_add_result for details.
   // Furthermore, if we use the immediate key shortcut (which uses the same code path as caching), we need to pass
   // true_type so that the aggregate keys are checked for immediate access values.
-  if (_contexts_per_column.size() > 1 || _use_immediate_key_shortcut) {
-    segment_iterate<ColumnDataType>(abstract_segment,
-                                    [&](const auto& position) { process_position(std::true_type{}, position); });
+  if (contexts.size() > 1 || _use_immediate_key_shortcut) {
+    iterate([&](const auto& position) { process_position(std::true_type{}, position); });
   } else {
-    segment_iterate<ColumnDataType>(abstract_segment,
-                                    [&](const auto& position) { process_position(std::false_type{}, position); });
+    iterate([&](const auto& position) { process_position(std::false_type{}, position); });
   }
 }
 
@@ -569,213 +665,458 @@ void AggregateHash::_aggregate() {
   /**
    * AGGREGATION STEP
    */
-  _contexts_per_column = std::vector<std::shared_ptr<SegmentVisitorContext>>(_aggregates.size());
+  if (_execution_mode == ExecutionMode::Parallel) {
+    _aggregate_parallel<AggregateKey>(keys_per_chunk);
+  } else {
+    _contexts_per_column = _create_aggregate_contexts<AggregateKey>(_expected_result_size);
 
-  if (!_has_aggregate_functions) {
-    /*
-    Insert a dummy context for the DISTINCT implementation.
-    That way, _contexts_per_column will always have at least one context with results.
-    This is important later on when we write the group keys into the table.
-    The template parameters (int32_t, WindowFunction::Min) do not matter, as we do not calculate an aggregate anyway.
-    */
-    auto context =
-        std::make_shared<AggregateContext<int32_t, WindowFunction::Min, AggregateKey>>(_expected_result_size);
+    // Process Chunks and perform aggregations
+    const auto chunk_count = input_table->chunk_count();
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      _aggregate_chunk<AggregateKey>(chunk_id, keys_per_chunk, _contexts_per_column, nullptr);
+    }
+  }
+  step_performance_data.set_step_runtime(OperatorSteps::Aggregating, timer.lap());
+}
 
-    _contexts_per_column.push_back(context);
+template <typename AggregateKey>
+void AggregateHash::_aggregate_chunk(const ChunkID chunk_id, KeysPerChunk<AggregateKey>& keys_per_chunk,
+                                     std::vector<std::shared_ptr<SegmentVisitorContext>>& contexts,
+                                     const std::shared_ptr<const RowIDPosList>& positions) {
+  const auto& input_table = left_input_table();
+  const auto chunk_in = input_table->get_chunk(chunk_id);
+  if (!chunk_in) {
+    return;
   }
 
-  /**
-   * Create an AggregateContext for each column in the input table that a normal (i.e. non-DISTINCT) aggregate is
-   * created on. We do this here, and not in the per-chunk-loop below, because there might be no Chunks in the input
-   * and _write_aggregate_output() needs these contexts anyway.
-   */
-  const auto aggregate_count = _aggregates.size();
-  for (auto aggregate_idx = ColumnID{0}; aggregate_idx < aggregate_count; ++aggregate_idx) {
-    const auto& aggregate = _aggregates[aggregate_idx];
+  // Sometimes, gcc is really bad at accessing loop conditions only once, so we cache that here.
+  const auto input_chunk_size = chunk_in->size();
+
+  if (!_has_aggregate_functions) {
+    /**
+     * DISTINCT implementation
+     *
+     * In Hyrise we handle the SQL keyword DISTINCT by using an aggregate operator with grouping but without 
+     * aggregate functions. All input columns (either explicitly specified as `SELECT DISTINCT a, b, c` OR implicitly
+     * as `SELECT DISTINCT *` are passed as `groupby_column_ids`).
+     *
+     * As the grouping happens as part of the aggregation but no aggregate function exists, we use
+     * `WindowFunction::Min` as a fake aggregate function whose result will be discarded. From here on, the steps
+     * are the same as they are for a regular grouped aggregate.
+     */
+
+    auto context = std::static_pointer_cast<AggregateContext<DistinctColumnType, WindowFunction::Min, AggregateKey>>(
+        contexts[0]);
+
+    auto& result_ids = *context->result_ids;
+    auto& results = context->results;
+
+    // Add value or combination of values is added to the list of distinct value(s). This is done by calling
+    // get_or_add_result, which adds the corresponding entry in the list of GROUP BY values.
+    if (_use_immediate_key_shortcut) {
+      for_each_chunk_offset(input_chunk_size, positions, [&](const auto chunk_offset) {
+        // We are able to use immediate keys, so pass true_type so that the combined caching/immediate key code path
+        // is enabled in get_or_add_result.
+        get_or_add_result(std::true_type{}, result_ids, results,
+                          get_aggregate_key<AggregateKey>(keys_per_chunk, chunk_id, chunk_offset),
+                          RowID{chunk_id, chunk_offset});
+      });
+    } else {
+      // Same as above, but we do not have immediate keys, so we disable that code path to reduce the complexity of
+      // get_aggregate_key.
+      for_each_chunk_offset(input_chunk_size, positions, [&](const auto chunk_offset) {
+        get_or_add_result(std::false_type{}, result_ids, results,
+                          get_aggregate_key<AggregateKey>(keys_per_chunk, chunk_id, chunk_offset),
+                          RowID{chunk_id, chunk_offset});
+      });
+    }
+    return;
+  }
+
+  auto aggregate_idx = ColumnID{0};
+  for (const auto& aggregate : _aggregates) {
+    /**
+     * Special COUNT(*) implementation.
+     * Because COUNT(*) does not have a specific target column, we use the maximum ColumnID.
+     * We then go through the keys_per_chunk map and count the occurrences of each group key.
+     * The results are saved in the regular aggregate_count variable so that we don't need a
+     * specific output logic for COUNT(*).
+     */
 
     const auto& pqp_column = static_cast<const PQPColumnExpression&>(*aggregate->argument());
     const auto input_column_id = pqp_column.column_id;
 
     if (input_column_id == INVALID_COLUMN_ID) {
       Assert(aggregate->window_function == WindowFunction::Count, "Only COUNT may have an invalid ColumnID");
-      // SELECT COUNT(*) - we know the template arguments, so we don't need a visitor
-      auto context = std::make_shared<AggregateContext<CountColumnType, WindowFunction::Count, AggregateKey>>(
-          _expected_result_size);
+      auto context = std::static_pointer_cast<AggregateContext<CountColumnType, WindowFunction::Count, AggregateKey>>(
+          contexts[aggregate_idx]);
+
+      auto& result_ids = *context->result_ids;
+      auto& results = context->results;
 
-      _contexts_per_column[aggregate_idx] = context;
+      if constexpr (std::is_same_v<AggregateKey, EmptyAggregateKey>) {
+        // Not grouped by anything, simply count the number of rows
+        results.resize(1);
+        results[0].aggregate_count += positions ? positions->size() : size_t{input_chunk_size};
+
+        // We need to set any RowID because the default value (NULL_ROW_ID) would later be skipped. As we are not
+        // reconstructing the GROUP BY values later, the exact value of this row_id does not matter, as long as it
+        // not NULL_ROW_ID.
+        results[0].row_id = RowID{ChunkID{0}, ChunkOffset{0}};
+      } else {
+        // Count occurrences for each group key -  If we have more than one aggregate function (and thus more than
+        // one context), it makes sense to cache the results indexes, see get_or_add_result for details.
+        if (contexts.size() > 1 || _use_immediate_key_shortcut) {
+          for_each_chunk_offset(input_chunk_size, positions, [&](const auto chunk_offset) {
+            // Use CacheResultIds==true_type if we have more than one group by column or if the cached result ids
+            // have been written by the immediate key shortcut
+            auto& result = get_or_add_result(std::true_type{}, result_ids, results,
+                                             get_aggregate_key<AggregateKey>(keys_per_chunk, chunk_id, chunk_offset),
+                                             RowID{chunk_id, chunk_offset});
+            ++result.aggregate_count;
+          });
+        } else {
+          for_each_chunk_offset(input_chunk_size, positions, [&](const auto chunk_offset) {
+            auto& result = get_or_add_result(std::false_type{}, result_ids, results,
+                                             get_aggregate_key<AggregateKey>(keys_per_chunk, chunk_id, chunk_offset),
+                                             RowID{chunk_id, chunk_offset});
+            ++result.aggregate_count;
+          });
+        }
+      }
+
+      ++aggregate_idx;
       continue;
     }
+
+    const auto abstract_segment = chunk_in->get_segment(input_column_id);
     const auto data_type = input_table->column_data_type(input_column_id);
-    _contexts_per_column[aggregate_idx] =
-        _create_aggregate_context<AggregateKey>(data_type, aggregate->window_function);
+
+    /*
+    Invoke correct aggregator for each segment
+    */
+
+    resolve_data_type(data_type, [&, aggregate](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+
+      switch (aggregate->window_function) {
+        case WindowFunction::Min:
+          _aggregate_segment<ColumnDataType, WindowFunction::Min, AggregateKey>(
+              chunk_id, aggregate_idx, *abstract_segment, keys_per_chunk, contexts, positions);
+          break;
+        case WindowFunction::Max:
+          _aggregate_segment<ColumnDataType, WindowFunction::Max, AggregateKey>(
+              chunk_id, aggregate_idx, *abstract_segment, keys_per_chunk, contexts, positions);
+          break;
+        case WindowFunction::Sum:
+          _aggregate_segment<ColumnDataType, WindowFunction::Sum, AggregateKey>(
+              chunk_id, aggregate_idx, *abstract_segment, keys_per_chunk, contexts, positions);
+          break;
+        case WindowFunction::Avg:
+          _aggregate_segment<ColumnDataType, WindowFunction::Avg, AggregateKey>(
+              chunk_id, aggregate_idx, *abstract_segment, keys_per_chunk, contexts, positions);
+          break;
+        case WindowFunction::Count:
+          _aggregate_segment<ColumnDataType, WindowFunction::Count, AggregateKey>(
+              chunk_id, aggregate_idx, *abstract_segment, keys_per_chunk, contexts, positions);
+          break;
+        case WindowFunction::CountDistinct:
+          _aggregate_segment<ColumnDataType, WindowFunction::CountDistinct, AggregateKey>(
+              chunk_id, aggregate_idx, *abstract_segment, keys_per_chunk, contexts, positions);
+          break;
+        case WindowFunction::StandardDeviationSample:
+          _aggregate_segment<ColumnDataType, WindowFunction::StandardDeviationSample, AggregateKey>(
+              chunk_id, aggregate_idx, *abstract_segment, keys_per_chunk, contexts, positions);
+          break;
+        case WindowFunction::Any:
+          // ANY is a pseudo-function and is handled by _write_groupby_output
+          break;
+        case WindowFunction::CumeDist:
+        case WindowFunction::DenseRank:
+        case WindowFunction::PercentRank:
+        case WindowFunction::Rank:
+        case WindowFunction::RowNumber:
+          Fail("Unsupported aggregate function " + window_function_to_string.left.at(aggregate->window_function));
+      }
+    });
+
+    ++aggregate_idx;
   }
+}  // NOLINT(readability/fn_size)
 
-  // Process Chunks and perform aggregations
+template <typename AggregateKey>
+void AggregateHash::_aggregate_parallel(KeysPerChunk<AggregateKey>& keys_per_chunk) {
+  const auto& input_table = left_input_table();
   const auto chunk_count = input_table->chunk_count();
-  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
-    const auto chunk_in = input_table->get_chunk(chunk_id);
-    if (!chunk_in) {
-      continue;
-    }
 
-    // Sometimes, gcc is really bad at accessing loop conditions only once, so we cache that here.
-    const auto input_chunk_size = chunk_in->size();
-
-    if (!_has_aggregate_functions) {
-      /**
-       * DISTINCT implementation
-       *
-       * In Hyrise we handle the SQL keyword DISTINCT by using an aggregate operator with grouping but without 
-       * aggregate functions. All input columns (either explicitly specified as `SELECT DISTINCT a, b, c` OR implicitly
-       * as `SELECT DISTINCT *` are passed as `groupby_column_ids`).
-       *
-       * As the grouping happens as part of the aggregation but no aggregate function exists, we use
-       * `WindowFunction::Min` as a fake aggregate function whose result will be discarded. From here on, the steps
-       * are the same as they are for a regular grouped aggregate.
-       */
-
-      auto context = std::static_pointer_cast<AggregateContext<DistinctColumnType, WindowFunction::Min, AggregateKey>>(
-          _contexts_per_column[0]);
+  // Calls functor(context) for the first context that holds results. If there are multiple contexts, only this one
+  // fills its AggregateResultIdMap. The others find their results via the ids cached in the keys (see
+  // get_or_add_result). As all contexts see all rows, they have the same result ids.
+  const auto visit_first_context = [&](auto& contexts, const auto& functor) {
+    auto visited = false;
+    _resolve_context_types([&](const auto context_idx, const auto type, const auto aggregate_function_t) {
+      if (visited) {
+        return;
+      }
+      visited = true;
+      using ColumnDataType = typename decltype(type)::type;
+      constexpr auto aggregate_function = decltype(aggregate_function_t)::value;
+      functor(static_cast<AggregateContext<ColumnDataType, aggregate_function, AggregateKey>&>(*contexts[context_idx]));
+    });
+  };
 
-      auto& result_ids = *context->result_ids;
-      auto& results = context->results;
+  /**
+   * LOCAL PRE-AGGREGATION
+   *
+   * The chunks are split into ranges of at least _min_rows_per_task rows. Each range is aggregated into contexts of
+   * its own. Once these hold more than _max_local_group_count groups, the task stops and leaves the remaining chunks
+   * of its range to the partitioned aggregation below. If the GROUP BY columns are already known to have more distinct
+   * values, pre-aggregation cannot reduce the data and is skipped altogether.
+   */
+  auto range_begins = std::vector<ChunkID>{};
+  if (_expected_result_size <= _max_local_group_count) {
+    auto range_row_count = size_t{0};
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      if (range_row_count == 0) {
+        range_begins.emplace_back(chunk_id);
+      }
+      const auto chunk = input_table->get_chunk(chunk_id);
+      range_row_count += chunk ? chunk->size() : 0;
+      if (range_row_count >= _min_rows_per_task) {
+        range_row_count = 0;
+      }
+    }
+  }
 
-      // Add value or combination of values is added to the list of distinct value(s). This is done by calling
-      // get_or_add_result, which adds the corresponding entry in the list of GROUP BY values.
-      if (_use_immediate_key_shortcut) {
-        for (auto chunk_offset = ChunkOffset{0}; chunk_offset < input_chunk_size; ++chunk_offset) {
-          // We are able to use immediate keys, so pass true_type so that the combined caching/immediate key code path
-          // is enabled in get_or_add_result.
-          get_or_add_result(std::true_type{}, result_ids, results,
-                            get_aggregate_key<AggregateKey>(keys_per_chunk, chunk_id, chunk_offset),
-                            RowID{chunk_id, chunk_offset});
-        }
-      } else {
-        // Same as above, but we do not have immediate keys, so we disable that code path to reduce the complexity of
-        // get_aggregate_key.
-        for (auto chunk_offset = ChunkOffset{0}; chunk_offset < input_chunk_size; ++chunk_offset) {
-          get_or_add_result(std::false_type{}, result_ids, results,
-                            get_aggregate_key<AggregateKey>(keys_per_chunk, chunk_id, chunk_offset),
-                            RowID{chunk_id, chunk_offset});
+  const auto range_count = range_begins.size();
+  auto local_contexts = std::vector<std::vector<std::shared_ptr<SegmentVisitorContext>>>(range_count);
+  // First chunk of each range that has not been pre-aggregated.
+  auto range_remainder_begins = std::vector<ChunkID>(range_count);
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(range_count);
+  for (auto range_idx = size_t{0}; range_idx < range_count; ++range_idx) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, range_idx]() {
+      auto& contexts = local_contexts[range_idx];
+      contexts = _create_aggregate_contexts<AggregateKey>(0);
+
+      const auto range_end = range_idx + 1 < range_count ? range_begins[range_idx + 1] : chunk_count;
+      auto chunk_id = range_begins[range_idx];
+      while (chunk_id < range_end) {
+        _aggregate_chunk<AggregateKey>(chunk_id, keys_per_chunk, contexts, nullptr);
+        ++chunk_id;
+
+        auto result_count = size_t{0};
+        visit_first_context(contexts, [&](const auto& context) { result_count = context.results.size(); });
+        if (result_count > _max_local_group_count) {
+          break;
         }
       }
-    } else {
-      auto aggregate_idx = ColumnID{0};
-      for (const auto& aggregate : _aggregates) {
-        /**
-         * Special COUNT(*) implementation.
-         * Because COUNT(*) does not have a specific target column, we use the maximum ColumnID.
-         * We then go through the keys_per_chunk map and count the occurrences of each group key.
-         * The results are saved in the regular aggregate_count variable so that we don't need a
-         * specific output logic for COUNT(*).
-         */
-
-        const auto& pqp_column = static_cast<const PQPColumnExpression&>(*aggregate->argument());
-        const auto input_column_id = pqp_column.column_id;
+      range_remainder_begins[range_idx] = chunk_id;
+    }));
+  }
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+
+  auto remaining_chunk_ids = std::vector<ChunkID>{};
+  auto local_result_count = size_t{0};
+  for (auto range_idx = size_t{0}; range_idx < range_count; ++range_idx) {
+    const auto range_end = range_idx + 1 < range_count ? range_begins[range_idx + 1] : chunk_count;
+    for (auto chunk_id = range_remainder_begins[range_idx]; chunk_id < range_end; ++chunk_id) {
+      remaining_chunk_ids.emplace_back(chunk_id);
+    }
+    visit_first_context(local_contexts[range_idx],
+                        [&](const auto& context) { local_result_count += context.results.size(); });
+  }
+  if (range_count == 0) {
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      remaining_chunk_ids.emplace_back(chunk_id);
+    }
+  }
 
-        if (input_column_id == INVALID_COLUMN_ID) {
-          Assert(aggregate->window_function == WindowFunction::Count, "Only COUNT may have an invalid ColumnID");
-          auto context =
-              std::static_pointer_cast<AggregateContext<CountColumnType, WindowFunction::Count, AggregateKey>>(
-                  _contexts_per_column[aggregate_idx]);
+  /**
+   * RADIX PARTITIONING
+   *
+   * The local results and the remaining rows are partitioned by their AggregateKey. If the local results are small
+   * and no rows remain, they are merged by a single task.
+   */
+  auto radix_bits = uint32_t{0};
+  if constexpr (!std::is_same_v<AggregateKey, EmptyAggregateKey>) {
+    if (!remaining_chunk_ids.empty() || local_result_count > _max_local_group_count) {
+      const auto cpu_count = std::clamp(Hyrise::get().topology.num_cpus(), size_t{1}, size_t{1} << MAX_RADIX_BITS);
+      radix_bits = static_cast<uint32_t>(std::bit_width(std::bit_ceil(cpu_count)) - 1);
+    }
+  }
+  const auto partition_count = size_t{1} << radix_bits;
+
+  // AggregateKeys of the local results, indexed by their result id. The keys in keys_per_chunk cannot be used, as
+  // they are overwritten with the result ids when these are cached.
+  auto local_keys = std::vector<std::vector<AggregateKey>>(range_count);
+  // Ids of the valid local results per range and partition.
+  auto local_ids = std::vector<std::vector<std::vector<AggregateResultId>>>(
+      range_count, std::vector<std::vector<AggregateResultId>>(partition_count));
+  // Positions of the remaining rows per chunk and partition. If there is only a single partition, the chunks are
+  // aggregated as a whole.
+  auto remaining_positions = std::vector<std::vector<std::shared_ptr<RowIDPosList>>>(
+      remaining_chunk_ids.size(), std::vector<std::shared_ptr<RowIDPosList>>(partition_count));
+
+  jobs.clear();
+  jobs.reserve(range_count + remaining_chunk_ids.size());
+  for (auto range_idx = size_t{0}; range_idx < range_count; ++range_idx) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, range_idx]() {
+      visit_first_context(local_contexts[range_idx], [&](const auto& context) {
+        const auto& results = context.results;
+        auto& keys = local_keys[range_idx];
+        keys.resize(results.size());
+
+        if constexpr (std::is_same_v<AggregateKey, AggregateKeyEntry>) {
+          if (_use_immediate_key_shortcut) {
+            // Immediate keys are the result ids (without the CACHE_MASK).
+            for (auto result_id = AggregateResultId{0}; result_id < results.size(); ++result_id) {
+              if (!results[result_id].row_id.is_null()) {
+                keys[result_id] = result_id;
+                local_ids[range_idx][radix_partition(keys[result_id], radix_bits)].emplace_back(result_id);
+              }
+            }
+            return;
+          }
+        }
 
-          auto& result_ids = *context->result_ids;
-          auto& results = context->results;
+        if constexpr (std::is_same_v<AggregateKey, EmptyAggregateKey>) {
+          if (!results.empty()) {
+            local_ids[range_idx][0].emplace_back(0);
+          }
+        } else {
+          for (const auto& [key, result_id] : *context.result_ids) {
+            keys[result_id] = key;
+            local_ids[range_idx][radix_partition(key, radix_bits)].emplace_back(result_id);
+          }
+        }
+      });
+    }));
+  }
 
-          if constexpr (std::is_same_v<AggregateKey, EmptyAggregateKey>) {
-            // Not grouped by anything, simply count the number of rows
-            results.resize(1);
-            results[0].aggregate_count += input_chunk_size;
+  for (auto remaining_chunk_idx = size_t{0}; remaining_chunk_idx < remaining_chunk_ids.size(); ++remaining_chunk_idx) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, remaining_chunk_idx]() {
+      const auto chunk_id = remaining_chunk_ids[remaining_chunk_idx];
+      const auto chunk = input_table->get_chunk(chunk_id);
+      if (!chunk || (partition_count == 1 && !_use_immediate_key_shortcut)) {
+        return;
+      }
 
-            // We need to set any RowID because the default value (NULL_ROW_ID) would later be skipped. As we are not
-            // reconstructing the GROUP BY values later, the exact value of this row_id does not matter, as long as it
-            // not NULL_ROW_ID.
-            results[0].row_id = RowID{ChunkID{0}, ChunkOffset{0}};
-          } else {
-            // Count occurrences for each group key -  If we have more than one aggregate function (and thus more than
-            // one context), it makes sense to cache the results indexes, see get_or_add_result for details.
-            if (_contexts_per_column.size() > 1 || _use_immediate_key_shortcut) {
-              for (auto chunk_offset = ChunkOffset{0}; chunk_offset < input_chunk_size; ++chunk_offset) {
-                // Use CacheResultIds==true_type if we have more than one group by column or if the cached result ids
-                // have been written by the immediate key shortcut
-                auto& result =
-                    get_or_add_result(std::true_type{}, result_ids, results,
-                                      get_aggregate_key<AggregateKey>(keys_per_chunk, chunk_id, chunk_offset),
-                                      RowID{chunk_id, chunk_offset});
-                ++result.aggregate_count;
-              }
-            } else {
-              for (auto chunk_offset = ChunkOffset{0}; chunk_offset < input_chunk_size; ++chunk_offset) {
-                auto& result =
-                    get_or_add_result(std::false_type{}, result_ids, results,
-                                      get_aggregate_key<AggregateKey>(keys_per_chunk, chunk_id, chunk_offset),
-                                      RowID{chunk_id, chunk_offset});
-                ++result.aggregate_count;
-              }
-            }
+      const auto chunk_size = chunk->size();
+      auto& positions = remaining_positions[remaining_chunk_idx];
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+        auto& key = get_aggregate_key<AggregateKey>(keys_per_chunk, chunk_id, chunk_offset);
+        if constexpr (std::is_same_v<AggregateKey, AggregateKeyEntry>) {
+          // Immediate keys are looked up in the AggregateResultIdMap of the partition like all others.
+          if (_use_immediate_key_shortcut) {
+            key &= ~CACHE_MASK;
           }
+        }
 
-          ++aggregate_idx;
+        if (partition_count == 1) {
           continue;
         }
 
-        const auto abstract_segment = chunk_in->get_segment(input_column_id);
-        const auto data_type = input_table->column_data_type(input_column_id);
+        auto& partition_positions = positions[radix_partition(key, radix_bits)];
+        if (!partition_positions) {
+          partition_positions = std::make_shared<RowIDPosList>();
+          partition_positions->guarantee_single_chunk();
+        }
+        partition_positions->emplace_back(RowID{chunk_id, chunk_offset});
+      }
+    }));
+  }
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
 
-        /*
-        Invoke correct aggregator for each segment
-        */
+  /**
+   * PARTITIONED AGGREGATION
+   *
+   * For each partition, the local results of its groups are merged first. Afterwards, its remaining rows are
+   * aggregated into the same contexts.
+   */
+  auto partition_contexts = std::vector<std::vector<std::shared_ptr<SegmentVisitorContext>>>(partition_count);
+
+  jobs.clear();
+  jobs.reserve(partition_count);
+  for (auto partition_idx = size_t{0}; partition_idx < partition_count; ++partition_idx) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, partition_idx]() {
+      auto& contexts = partition_contexts[partition_idx];
+      contexts = _create_aggregate_contexts<AggregateKey>(0);
+
+      auto target_ids = std::vector<AggregateResultId>{};
+      for (auto range_idx = size_t{0}; range_idx < range_count; ++range_idx) {
+        const auto& source_ids = local_ids[range_idx][partition_idx];
+
+        // Look up (or assign) the result id of each group in the partition's contexts.
+        target_ids.clear();
+        visit_first_context(contexts, [&](auto& context) {
+          for (const auto source_id : source_ids) {
+            if constexpr (std::is_same_v<AggregateKey, EmptyAggregateKey>) {
+              target_ids.emplace_back(0);
+            } else {
+              auto& result_ids = *context.result_ids;
+              const auto& key = local_keys[range_idx][source_id];
+              target_ids.emplace_back(result_ids.emplace(key, result_ids.size()).first->second);
+            }
+          }
+        });
 
-        resolve_data_type(data_type, [&, aggregate](auto type) {
+        _resolve_context_types([&](const auto context_idx, const auto type, const auto aggregate_function_t) {
           using ColumnDataType = typename decltype(type)::type;
-
-          switch (aggregate->window_function) {
-            case WindowFunction::Min:
-              _aggregate_segment<ColumnDataType, WindowFunction::Min, AggregateKey>(chunk_id, aggregate_idx,
-                                                                                    *abstract_segment, keys_per_chunk);
-              break;
-            case WindowFunction::Max:
-              _aggregate_segment<ColumnDataType, WindowFunction::Max, AggregateKey>(chunk_id, aggregate_idx,
-                                                                                    *abstract_segment, keys_per_chunk);
-              break;
-            case WindowFunction::Sum:
-              _aggregate_segment<ColumnDataType, WindowFunction::Sum, AggregateKey>(chunk_id, aggregate_idx,
-                                                                                    *abstract_segment, keys_per_chunk);
-              break;
-            case WindowFunction::Avg:
-              _aggregate_segment<ColumnDataType, WindowFunction::Avg, AggregateKey>(chunk_id, aggregate_idx,
-                                                                                    *abstract_segment, keys_per_chunk);
-              break;
-            case WindowFunction::Count:
-              _aggregate_segment<ColumnDataType, WindowFunction::Count, AggregateKey>(
-                  chunk_id, aggregate_idx, *abstract_segment, keys_per_chunk);
-              break;
-            case WindowFunction::CountDistinct:
-              _aggregate_segment<ColumnDataType, WindowFunction::CountDistinct, AggregateKey>(
-                  chunk_id, aggregate_idx, *abstract_segment, keys_per_chunk);
-              break;
-            case WindowFunction::StandardDeviationSample:
-              _aggregate_segment<ColumnDataType, WindowFunction::StandardDeviationSample, AggregateKey>(
-                  chunk_id, aggregate_idx, *abstract_segment, keys_per_chunk);
-              break;
-            case WindowFunction::Any:
-              // ANY is a pseudo-function and is handled by _write_groupby_output
-              break;
-            case WindowFunction::CumeDist:
-            case WindowFunction::DenseRank:
-            case WindowFunction::PercentRank:
-            case WindowFunction::Rank:
-            case WindowFunction::RowNumber:
-              Fail("Unsupported aggregate function " + window_function_to_string.left.at(aggregate->window_function));
+          constexpr auto aggregate_function = decltype(aggregate_function_t)::value;
+          using Context = AggregateResultContext<ColumnDataType, aggregate_function>;
+
+          auto& target_results = static_cast<Context&>(*contexts[context_idx]).results;
+          const auto& source_results = static_cast<const Context&>(*local_contexts[range_idx][context_idx]).results;
+          for (auto id_idx = size_t{0}; id_idx < source_ids.size(); ++id_idx) {
+            const auto target_id = target_ids[id_idx];
+            if (target_id >= target_results.size()) {
+              target_results.resize(target_id + 1);
+            }
+            merge_aggregate_results<ColumnDataType, aggregate_function>(target_results[target_id],
+                                                                         source_results[source_ids[id_idx]]);
           }
         });
+      }
 
-        ++aggregate_idx;
+      for (auto remaining_chunk_idx = size_t{0}; remaining_chunk_idx < remaining_chunk_ids.size();
+           ++remaining_chunk_idx) {
+        const auto& positions = remaining_positions[remaining_chunk_idx][partition_idx];
+        if (partition_count > 1 && !positions) {
+          continue;
+        }
+        _aggregate_chunk<AggregateKey>(remaining_chunk_ids[remaining_chunk_idx], keys_per_chunk, contexts, positions);
       }
-    }
+    }));
   }
-  step_performance_data.set_step_runtime(OperatorSteps::Aggregating, timer.lap());
-}  // NOLINT(readability/fn_size)
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+
+  // As the partitions do not share any groups, their results are simply concatenated.
+  if (partition_count == 1) {
+    _contexts_per_column = std::move(partition_contexts[0]);
+    return;
+  }
+
+  _contexts_per_column = _create_aggregate_contexts<AggregateKey>(0);
+  _resolve_context_types([&](const auto context_idx, const auto type, const auto aggregate_function_t) {
+    using ColumnDataType = typename decltype(type)::type;
+    constexpr auto aggregate_function = decltype(aggregate_function_t)::value;
+    using Context = AggregateResultContext<ColumnDataType, aggregate_function>;
+
+    auto result_count = size_t{0};
+    for (const auto& contexts : partition_contexts) {
+      result_count += static_cast<const Context&>(*contexts[context_idx]).results.size();
+    }
+
+    auto& results = static_cast<Context&>(*_contexts_per_column[context_idx]).results;
+    results.reserve(result_count);
+    for (auto& contexts : partition_contexts) {
+      auto& partition_results = static_cast<Context&>(*contexts[context_idx]).results;
+      std::move(partition_results.begin(), partition_results.end(), std::back_inserter(results));
+    }
+  });
+}
 
 std::shared_ptr<const Table> AggregateHash::_on_execute() {
   // We do not want the overhead of a vector with heap storage when we have a limited number of aggregate columns.
@@ -1189,12 +1530,61 @@ void AggregateHash::_write_aggregate_output(ColumnID aggregate_index) {
   aggregate_columns_writing_duration += timer.lap() - excluded_time;
 }
 
+template <typename AggregateKey>
+std::vector<std::shared_ptr<SegmentVisitorContext>> AggregateHash::_create_aggregate_contexts(
+    const size_t preallocated_size) const {
+  const auto& input_table = left_input_table();
+  auto contexts = std::vector<std::shared_ptr<SegmentVisitorContext>>(_aggregates.size());
+
+  if (!_has_aggregate_functions) {
+    /*
+    Insert a dummy context for the DISTINCT implementation.
+    That way, the contexts will always have at least one context with results.
+    This is important later on when we write the group keys into the table.
+    The template parameters (DistinctColumnType, WindowFunction::Min) do not matter, as we do not calculate an
+    aggregate anyway.
+    */
+    auto context =
+        std::make_shared<AggregateContext<DistinctColumnType, WindowFunction::Min, AggregateKey>>(preallocated_size);
+
+    contexts.push_back(context);
+  }
+
+  /**
+   * Create an AggregateContext for each column in the input table that a normal (i.e. non-DISTINCT) aggregate is
+   * created on. We do this before processing the chunks because there might be no Chunks in the input and
+   * _write_aggregate_output() needs these contexts anyway.
+   */
+  const auto aggregate_count = _aggregates.size();
+  for (auto aggregate_idx = ColumnID{0}; aggregate_idx < aggregate_count; ++aggregate_idx) {
+    const auto& aggregate = _aggregates[aggregate_idx];
+
+    const auto& pqp_column = static_cast<const PQPColumnExpression&>(*aggregate->argument());
+    const auto input_column_id = pqp_column.column_id;
+
+    if (input_column_id == INVALID_COLUMN_ID) {
+      Assert(aggregate->window_function == WindowFunction::Count, "Only COUNT may have an invalid ColumnID");
+      // SELECT COUNT(*) - we know the template arguments, so we don't need a visitor
+      auto context = std::make_shared<AggregateContext<CountColumnType, WindowFunction::Count, AggregateKey>>(
+          preallocated_size);
+
+      contexts[aggregate_idx] = context;
+      continue;
+    }
+    const auto data_type = input_table->column_data_type(input_column_id);
+    contexts[aggregate_idx] =
+        _create_aggregate_context<AggregateKey>(data_type, aggregate->window_function, preallocated_size);
+  }
+
+  return contexts;
+}
+
 template <typename AggregateKey>
 std::shared_ptr<SegmentVisitorContext> AggregateHash::_create_aggregate_context(
-    const DataType data_type, const WindowFunction aggregate_function) const {
+    const DataType data_type, const WindowFunction aggregate_function, const size_t preallocated_size) const {
   std::shared_ptr<SegmentVisitorContext> context;
   resolve_data_type(data_type, [&](auto type) {
-    const auto size = _expected_result_size.load();
+    const auto size = preallocated_size;
     using ColumnDataType = typename decltype(type)::type;
     switch (aggregate_function) {
       case WindowFunction::Min:
@@ -1235,4 +1625,62 @@ std::shared_ptr<SegmentVisitorContext> AggregateHash::_create_aggregate_context(
   return context;
 }
 
+template <typename Functor>
+void AggregateHash::_resolve_context_types(const Functor& functor) const {
+  if (!_has_aggregate_functions) {
+    functor(ColumnID{0}, hana::type_c<DistinctColumnType>,
+            std::integral_constant<WindowFunction, WindowFunction::Min>{});
+    return;
+  }
+
+  const auto& input_table = left_input_table();
+  const auto aggregate_count = _aggregates.size();
+  for (auto aggregate_idx = ColumnID{0}; aggregate_idx < aggregate_count; ++aggregate_idx) {
+    const auto& aggregate = _aggregates[aggregate_idx];
+    const auto input_column_id = static_cast<const PQPColumnExpression&>(*aggregate->argument()).column_id;
+
+    if (input_column_id == INVALID_COLUMN_ID) {
+      functor(aggregate_idx, hana::type_c<CountColumnType>,
+              std::integral_constant<WindowFunction, WindowFunction::Count>{});
+      continue;
+    }
+
+    resolve_data_type(input_table->column_data_type(input_column_id), [&](auto type) {
+      switch (aggregate->window_function) {
+        case WindowFunction::Min:
+          functor(aggregate_idx, type, std::integral_constant<WindowFunction, WindowFunction::Min>{});
+          break;
+        case WindowFunction::Max:
+          functor(aggregate_idx, type, std::integral_constant<WindowFunction, WindowFunction::Max>{});
+          break;
+        case WindowFunction::Sum:
+          functor(aggregate_idx, type, std::integral_constant<WindowFunction, WindowFunction::Sum>{});
+          break;
+        case WindowFunction::Avg:
+          functor(aggregate_idx, type, std::integral_constant<WindowFunction, WindowFunction::Avg>{});
+          break;
+        case WindowFunction::Count:
+          functor(aggregate_idx, type, std::integral_constant<WindowFunction, WindowFunction::Count>{});
+          break;
+        case WindowFunction::CountDistinct:
+          functor(aggregate_idx, type, std::integral_constant<WindowFunction, WindowFunction::CountDistinct>{});
+          break;
+        case WindowFunction::StandardDeviationSample:
+          functor(aggregate_idx, type,
+                  std::integral_constant<WindowFunction, WindowFunction::StandardDeviationSample>{});
+          break;
+        case WindowFunction::Any:
+          // ANY is a pseudo-function without results of its own.
+          break;
+        case WindowFunction::CumeDist:
+        case WindowFunction::DenseRank:
+        case WindowFunction::PercentRank:
+        case WindowFunction::Rank:
+        case WindowFunction::RowNumber:
+          Fail("Unsupported aggregate function " + window_function_to_string.left.at(aggregate->window_function));
+      }
+    });
+  }
+}
+
 }  // namespace hyrise
@@ -138,9 +138,21 @@ using DistinctAggregateType = int8_t;
 
 class AggregateHash : public AbstractAggregateOperator {
  public:
+  /**
+   * Sequential: All chunks are aggregated into a single set of results by the calling thread.
+   * Parallel:   Ranges of chunks are pre-aggregated into task-local results by JobTasks. As long as the local results
+   *             are small enough to stay in the CPU cache, this avoids any synchronization. If a task sees more than
+   *             _max_local_group_count groups (or the GROUP BY columns are known to have more distinct values), it
+   *             stops, and the remaining rows are radix-partitioned by their AggregateKey instead. Each partition is
+   *             then processed by a JobTask, which merges the local results of its groups and aggregates its rows.
+   *             As partitions do not share groups, their results are simply concatenated.
+   */
+  enum class ExecutionMode : uint8_t { Sequential, Parallel };
+
   AggregateHash(const std::shared_ptr<AbstractOperator>& input_operator,
                 const std::vector<std::shared_ptr<WindowFunctionExpression>>& aggregates,
-                const std::vector<ColumnID>& groupby_column_ids);
+                const std::vector<ColumnID>& groupby_column_ids,
+                const ExecutionMode execution_mode = ExecutionMode::Sequential);
 
   const std::string& name() const override;
 
@@ -161,6 +173,16 @@ class AggregateHash : public AbstractAggregateOperator {
   template <typename AggregateKey>
   void _aggregate();
 
+  // Aggregates all rows of the chunk (or, if given, the rows in `positions`) into the given contexts.
+  template <typename AggregateKey>
+  void _aggregate_chunk(const ChunkID chunk_id, KeysPerChunk<AggregateKey>& keys_per_chunk,
+                        std::vector<std::shared_ptr<SegmentVisitorContext>>& contexts,
+                        const std::shared_ptr<const RowIDPosList>& positions);
+
+  // Implementation of ExecutionMode::Parallel, writes the results to _contexts_per_column.
+  template <typename AggregateKey>
+  void _aggregate_parallel(KeysPerChunk<AggregateKey>& keys_per_chunk);
+
   std::shared_ptr<AbstractOperator> _on_deep_copy(
       const std::shared_ptr<AbstractOperator>& copied_left_input,
       const std::shared_ptr<AbstractOperator>& copied_right_input,
@@ -177,11 +199,23 @@ class AggregateHash : public AbstractAggregateOperator {
 
   template <typename ColumnDataType, WindowFunction aggregate_function, typename AggregateKey>
   void _aggregate_segment(ChunkID chunk_id, ColumnID column_index, const AbstractSegment& abstract_segment,
-                          KeysPerChunk<AggregateKey>& keys_per_chunk);
+                          KeysPerChunk<AggregateKey>& keys_per_chunk,
+                          std::vector<std::shared_ptr<SegmentVisitorContext>>& contexts,
+                          const std::shared_ptr<const RowIDPosList>& positions);
+
+  // Creates one context per aggregate (plus the dummy context used for DISTINCT).
+  template <typename AggregateKey>
+  std::vector<std::shared_ptr<SegmentVisitorContext>> _create_aggregate_contexts(const size_t preallocated_size) const;
 
   template <typename AggregateKey>
   std::shared_ptr<SegmentVisitorContext> _create_aggregate_context(const DataType data_type,
-                                                                   const WindowFunction aggregate_function) const;
+                                                                   const WindowFunction aggregate_function,
+                                                                   const size_t preallocated_size) const;
+
+  // Calls functor(context_index, data_type_t, aggregate_function_t) for each context that holds results, i.e., for all
+  // but those of ANY pseudo-aggregates. aggregate_function_t is an std::integral_constant<WindowFunction, ...>.
+  template <typename Functor>
+  void _resolve_context_types(const Functor& functor) const;
 
   std::vector<std::shared_ptr<BaseValueSegment>> _groupby_segments;
   std::vector<std::shared_ptr<SegmentVisitorContext>> _contexts_per_column;
@@ -190,6 +224,13 @@ class AggregateHash : public AbstractAggregateOperator {
   std::atomic_size_t _expected_result_size{};
   bool _use_immediate_key_shortcut{};
 
+  const ExecutionMode _execution_mode;
+
+  // Parameters of ExecutionMode::Parallel. The local results of a task are considered to exceed the cache if they hold
+  // more than _max_local_group_count groups. Each task pre-aggregates ranges of at least _min_rows_per_task rows.
+  size_t _max_local_group_count{16'384};
+  size_t _min_rows_per_task{65'535};
+
   std::chrono::nanoseconds groupby_columns_writing_duration{};
   std::chrono::nanoseconds aggregate_columns_writing_duration{};
 };
@@ -0,0 +1,224 @@
+#include "chunk_pipeline.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "concurrency/transaction_context.hpp"
+#include "hyrise.hpp"
+#include "operators/table_wrapper.hpp"
+#include "scheduler/job_task.hpp"
+#include "storage/pos_lists/entire_chunk_pos_list.hpp"
+#include "storage/reference_segment.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace hyrise;  // NOLINT
+
+// Creates a finalized chunk from the given segments that keeps the sort order of the chunk it was derived from.
+std::shared_ptr<Chunk> create_chunk(Segments&& segments, const Chunk& source_chunk) {
+  const auto chunk = std::make_shared<Chunk>(std::move(segments));
+  chunk->finalize();
+
+  const auto& sorted_by = source_chunk.individually_sorted_by();
+  if (!sorted_by.empty()) {
+    chunk->set_individually_sorted_by(sorted_by);
+  }
+  return chunk;
+}
+
+}  // namespace
+
+namespace hyrise {
+
+ChunkPipeline::ChunkPipeline(const std::shared_ptr<const AbstractOperator>& input_operator,
+                             const std::shared_ptr<AbstractOperator>& pipeline_source,
+                             const std::shared_ptr<AbstractOperator>& pipeline_root)
+    : AbstractReadOnlyOperator(OperatorType::ChunkPipeline, input_operator),
+      _pipeline_source(pipeline_source),
+      _pipeline_root(pipeline_root) {
+  Assert(_pipeline_source && _pipeline_root && _pipeline_source != _pipeline_root, "Expected at least one stage.");
+  Assert(!_pipeline_source->left_input() && !_pipeline_source->right_input(), "Pipeline source must be a leaf.");
+
+  for (auto stage = std::shared_ptr<const AbstractOperator>{_pipeline_root}; stage != _pipeline_source;
+       stage = stage->left_input()) {
+    Assert(stage, "Pipeline root does not consume the pipeline source.");
+    Assert(!stage->right_input(), "Pipeline stages must have a single input.");
+    Assert(stage->type() == OperatorType::Validate || stage->type() == OperatorType::TableScan ||
+               stage->type() == OperatorType::Projection,
+           "Unsupported pipeline stage: " + stage->name());
+    Assert(stage->uncorrelated_subqueries().empty(), "Pipeline stages must not consume uncorrelated subqueries.");
+  }
+}
+
+const std::string& ChunkPipeline::name() const {
+  static const auto name = std::string{"ChunkPipeline"};
+  return name;
+}
+
+std::string ChunkPipeline::description(DescriptionMode description_mode) const {
+  const auto separator = (description_mode == DescriptionMode::SingleLine ? ' ' : '\n');
+
+  auto stream = std::stringstream{};
+  stream << AbstractOperator::description(description_mode);
+  for (const auto& stage : stages()) {
+    stream << separator << "-> " << stage->description(DescriptionMode::SingleLine);
+  }
+
+  return stream.str();
+}
+
+std::vector<std::shared_ptr<const AbstractOperator>> ChunkPipeline::stages() const {
+  auto stages = std::vector<std::shared_ptr<const AbstractOperator>>{};
+  for (auto stage = std::shared_ptr<const AbstractOperator>{_pipeline_root}; stage != _pipeline_source;
+       stage = stage->left_input()) {
+    stages.emplace_back(stage);
+  }
+  std::reverse(stages.begin(), stages.end());
+  return stages;
+}
+
+std::shared_ptr<AbstractOperator> ChunkPipeline::_on_deep_copy(
+    const std::shared_ptr<AbstractOperator>& copied_left_input,
+    const std::shared_ptr<AbstractOperator>& /*copied_right_input*/,
+    std::unordered_map<const AbstractOperator*, std::shared_ptr<AbstractOperator>>& copied_ops) const {
+  const auto copied_pipeline_source = _pipeline_source->deep_copy(copied_ops);
+  return std::make_shared<ChunkPipeline>(copied_left_input, copied_pipeline_source,
+                                         _pipeline_root->deep_copy(copied_ops));
+}
+
+void ChunkPipeline::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {
+  _pipeline_root->set_parameters(parameters);
+}
+
+std::shared_ptr<const Table> ChunkPipeline::_on_execute() {
+  return _on_execute(nullptr);
+}
+
+std::shared_ptr<const Table> ChunkPipeline::_on_execute(std::shared_ptr<TransactionContext> transaction_context) {
+  const auto input_table = left_input_table();
+  const auto chunk_count = input_table->chunk_count();
+  const auto& column_definitions = input_table->column_definitions();
+  const auto column_count = input_table->column_count();
+
+  // Build the morsels. Each morsel is a reference table that covers consecutive chunks of the input table with at
+  // least Chunk::DEFAULT_SIZE rows in total (or the remaining chunks). If the input table is a data table, its chunks
+  // are referenced through EntireChunkPosLists, which the stages resolve without any additional indirection.
+  auto morsels = std::vector<std::shared_ptr<const Table>>{};
+  auto morsel_chunks = std::vector<std::shared_ptr<Chunk>>{};
+  auto morsel_row_count = size_t{0};
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = input_table->get_chunk(chunk_id);
+    Assert(chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
+
+    if (chunk->size() == 0) {
+      continue;
+    }
+
+    auto segments = Segments{};
+    segments.reserve(column_count);
+    if (input_table->type() == TableType::References) {
+      for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+        segments.emplace_back(chunk->get_segment(column_id));
+      }
+    } else {
+      const auto pos_list = std::make_shared<EntireChunkPosList>(chunk_id, chunk->size());
+      for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+        segments.emplace_back(std::make_shared<ReferenceSegment>(input_table, column_id, pos_list));
+      }
+    }
+
+    morsel_chunks.emplace_back(create_chunk(std::move(segments), *chunk));
+
+    morsel_row_count += chunk->size();
+    if (morsel_row_count >= Chunk::DEFAULT_SIZE) {
+      morsels.emplace_back(
+          std::make_shared<Table>(column_definitions, TableType::References, std::move(morsel_chunks)));
+      morsel_chunks = {};
+      morsel_row_count = 0;
+    }
+  }
+
+  // The remaining chunks form the last morsel. We also execute the stages on an empty morsel if the input is empty so
+  // that the output columns are defined by the stages.
+  if (!morsel_chunks.empty() || morsels.empty()) {
+    morsels.emplace_back(std::make_shared<Table>(column_definitions, TableType::References, std::move(morsel_chunks)));
+  }
+
+  const auto morsel_count = morsels.size();
+  auto morsel_outputs = std::vector<std::shared_ptr<const Table>>(morsel_count);
+
+  if (morsel_count == 1) {
+    // Single morsels are executed directly instead of scheduling a single job.
+    morsel_outputs[0] = _execute_morsel(morsels[0], transaction_context);
+  } else {
+    auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+    jobs.reserve(morsel_count);
+    for (auto morsel_id = size_t{0}; morsel_id < morsel_count; ++morsel_id) {
+      jobs.emplace_back(std::make_shared<JobTask>([&, morsel_id]() {
+        morsel_outputs[morsel_id] = _execute_morsel(morsels[morsel_id], transaction_context);
+      }));
+    }
+    Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+  }
+
+  // The stages determine the nullability of computed columns based on the data that they see (see Projection). Thus,
+  // the morsels' outputs might differ in their nullability, which we merge here.
+  auto output_column_definitions = morsel_outputs[0]->column_definitions();
+  const auto output_table_type = morsel_outputs[0]->type();
+  auto output_chunks = std::vector<std::shared_ptr<Chunk>>{};
+
+  for (const auto& morsel_output : morsel_outputs) {
+    Assert(morsel_output->type() == output_table_type, "Pipeline stages produced different table types.");
+    const auto output_column_count = morsel_output->column_count();
+    DebugAssert(output_column_count == output_column_definitions.size(), "Pipeline stages produced different columns.");
+    for (auto column_id = ColumnID{0}; column_id < output_column_count; ++column_id) {
+      output_column_definitions[column_id].nullable |= morsel_output->column_is_nullable(column_id);
+    }
+
+    const auto output_chunk_count = morsel_output->chunk_count();
+    for (auto chunk_id = ChunkID{0}; chunk_id < output_chunk_count; ++chunk_id) {
+      const auto chunk = morsel_output->get_chunk(chunk_id);
+      auto segments = Segments{};
+      segments.reserve(output_column_count);
+      for (auto column_id = ColumnID{0}; column_id < output_column_count; ++column_id) {
+        segments.emplace_back(chunk->get_segment(column_id));
+      }
+      output_chunks.emplace_back(create_chunk(std::move(segments), *chunk));
+    }
+  }
+
+  return std::make_shared<Table>(output_column_definitions, output_table_type, std::move(output_chunks));
+}
+
+std::shared_ptr<const Table> ChunkPipeline::_execute_morsel(
+    const std::shared_ptr<const Table>& morsel, const std::shared_ptr<TransactionContext>& transaction_context) const {
+  auto copied_ops = std::unordered_map<const AbstractOperator*, std::shared_ptr<AbstractOperator>>{};
+  const auto morsel_wrapper = std::make_shared<TableWrapper>(morsel);
+  copied_ops.emplace(_pipeline_source.get(), morsel_wrapper);
+
+  const auto root = _pipeline_root->deep_copy(copied_ops);
+  if (transaction_context) {
+    root->set_transaction_context_recursively(transaction_context);
+  }
+
+  // Execute the copied stages bottom-up. Each stage deregisters from its input once it has executed, so that the
+  // intermediate result of a morsel is released as soon as the next stage has consumed it.
+  auto operators = std::vector<std::shared_ptr<AbstractOperator>>{};
+  for (auto op = root; op; op = op->mutable_left_input()) {
+    operators.emplace_back(op);
+  }
+
+  for (auto op_iter = operators.rbegin(); op_iter != operators.rend(); ++op_iter) {
+    (*op_iter)->execute();
+  }
+
+  return root->get_output();
+}
+
+}  // namespace hyrise
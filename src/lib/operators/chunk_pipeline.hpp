@@ -0,0 +1,59 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "abstract_read_only_operator.hpp"
+#include "types.hpp"
+
+namespace hyrise {
+
+/**
+ * Operator that executes a chain of chunk-local operators (Validate, TableScan, Projection) morsel by morsel instead
+ * of operator by operator. Without pipelining, each operator of a chain such as GetTable -> Validate -> TableScan ->
+ * Projection materializes its entire output table (and thus a position list for each chunk) before the next operator
+ * starts. ChunkPipeline instead splits its input into morsels of at least Chunk::DEFAULT_SIZE rows and passes each
+ * morsel through the entire chain within a single JobTask, i.e., while its data is still in the worker's cache.
+ * Intermediate results are released as soon as the next stage has consumed them.
+ *
+ * The stages are given as the root of an operator chain whose leaf is `pipeline_source`, a placeholder that is never
+ * executed. For each morsel, the chain is deep-copied with the placeholder being replaced by a TableWrapper around the
+ * morsel. Each morsel is a reference table whose segments point to the input table, so that the RowIDs in the output
+ * are the same as those produced by the unfused chain. The output chunks are emitted in the order of the input chunks.
+ *
+ * Stages must only use chunk-local information: Operators that consume uncorrelated subqueries, index scans, or
+ * operators that exclude chunks by their ChunkID are not supported. The LQPTranslator decides which chains are fused
+ * (see LQPTranslator::_translate_chunk_pipeline).
+ */
+class ChunkPipeline : public AbstractReadOnlyOperator {
+ public:
+  ChunkPipeline(const std::shared_ptr<const AbstractOperator>& input_operator,
+                const std::shared_ptr<AbstractOperator>& pipeline_source,
+                const std::shared_ptr<AbstractOperator>& pipeline_root);
+
+  const std::string& name() const override;
+  std::string description(DescriptionMode description_mode = DescriptionMode::SingleLine) const override;
+
+  // Returns the stages of the pipeline, beginning with the one that consumes the pipeline source.
+  std::vector<std::shared_ptr<const AbstractOperator>> stages() const;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute(std::shared_ptr<TransactionContext> transaction_context) override;
+  std::shared_ptr<const Table> _on_execute() override;
+  std::shared_ptr<AbstractOperator> _on_deep_copy(
+      const std::shared_ptr<AbstractOperator>& copied_left_input,
+      const std::shared_ptr<AbstractOperator>& /*copied_right_input*/,
+      std::unordered_map<const AbstractOperator*, std::shared_ptr<AbstractOperator>>& copied_ops) const override;
+  void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override;
+
+  // Executes a copy of the stages on the given morsel and returns the result of the last stage.
+  std::shared_ptr<const Table> _execute_morsel(const std::shared_ptr<const Table>& morsel,
+                                               const std::shared_ptr<TransactionContext>& transaction_context) const;
+
+  const std::shared_ptr<AbstractOperator> _pipeline_source;
+  const std::shared_ptr<AbstractOperator> _pipeline_root;
+};
+
+}  // namespace hyrise
@@ -5,8 +5,10 @@
 #include <utility>
 
 #include "concurrency/transaction_context.hpp"
+#include "hyrise.hpp"
 #include "operators/validate.hpp"
 #include "statistics/table_statistics.hpp"
+#include "storage/index/adaptive_radix_tree/primary_key_index.hpp"
 #include "storage/reference_segment.hpp"
 #include "utils/assert.hpp"
 
@@ -90,6 +92,7 @@ std::shared_ptr<const Table> Delete::_on_execute(std::shared_ptr<TransactionCont
 }
 
 void Delete::_on_commit_records(const CommitID commit_id) {
+  auto& write_ahead_log = Hyrise::get().write_ahead_log;
   const auto chunk_count = _referencing_table->chunk_count();
   for (auto referencing_chunk_id = ChunkID{0}; referencing_chunk_id < chunk_count; ++referencing_chunk_id) {
     const auto referencing_chunk = _referencing_table->get_chunk(referencing_chunk_id);
@@ -97,12 +100,32 @@ void Delete::_on_commit_records(const CommitID commit_id) {
         std::static_pointer_cast<const ReferenceSegment>(referencing_chunk->get_segment(ColumnID{0}));
     const auto referenced_table = referencing_segment->referenced_table();
 
+    if (write_ahead_log.is_enabled()) {
+      write_ahead_log.log_delete(commit_id, referenced_table, *referencing_segment->pos_list());
+    }
+
+    const auto primary_key_index = referenced_table->primary_key_index();
     for (const auto row_id : *referencing_segment->pos_list()) {
       const auto referenced_chunk = referenced_table->get_chunk(row_id.chunk_id);
 
       referenced_chunk->mvcc_data()->set_end_cid(row_id.chunk_offset, commit_id);
       referenced_chunk->increase_invalid_row_count(ChunkOffset{1});
       // We do not unlock the rows so subsequent transactions properly fail when attempting to update these rows.
+
+      if (primary_key_index) {
+        primary_key_index->register_deleted_row(*referenced_table, row_id, commit_id);
+      }
+    }
+
+    referenced_table->increase_modified_row_count(referencing_segment->pos_list()->size());
+
+    // Remove the rows of earlier Deletes that no active transaction can see anymore. As this transaction is still
+    // active, its own rows are kept until a later Delete commits.
+    if (primary_key_index) {
+      const auto lowest_snapshot_commit_id = Hyrise::get().transaction_manager.get_lowest_active_snapshot_commit_id();
+      if (lowest_snapshot_commit_id) {
+        primary_key_index->remove_deleted_rows(*lowest_snapshot_commit_id);
+      }
     }
   }
 }
@@ -8,6 +8,7 @@
 #include "logical_query_plan/predicate_node.hpp"
 #include "logical_query_plan/stored_table_node.hpp"
 #include "operators/pqp_utils.hpp"
+#include "operators/runtime_filter.hpp"
 #include "operators/table_scan.hpp"
 #include "storage/index/partial_hash/partial_hash_index.hpp"
 #include "utils/chunk_pruning_utils.hpp"
@@ -103,6 +104,15 @@ std::shared_ptr<const Table> GetTable::_on_execute() {
   // Currently, value_clustered_by is only used for temporary tables. If tables in the StorageManager start using that
   // flag, too, it needs to be forwarded here; otherwise it would be completely invisible in the PQP.
   DebugAssert(stored_table->value_clustered_by().empty(), "GetTable does not forward value_clustered_by");
+
+  // Runtime filters can only be used if the output of their build operator is available, see RuntimeFilter.
+  auto built_runtime_filters = std::vector<std::pair<std::shared_ptr<RuntimeFilter>, ColumnID>>{};
+  for (const auto& runtime_filter : runtime_filters) {
+    if (runtime_filter.first->try_build()) {
+      built_runtime_filters.emplace_back(runtime_filter);
+    }
+  }
+
   auto excluded_chunk_ids = std::vector<ChunkID>{};
   auto pruned_chunk_ids_iter = _pruned_chunk_ids.begin();
   for (ChunkID stored_chunk_id{0}; stored_chunk_id < chunk_count; ++stored_chunk_id) {
@@ -133,6 +143,16 @@ std::shared_ptr<const Table> GetTable::_on_execute() {
       excluded_chunk_ids.emplace_back(stored_chunk_id);
       continue;
     }
+
+    // Check whether the Chunk holds no join partners for the build side of a runtime filter
+    const auto& pruning_statistics = chunk->pruning_statistics();
+    if (pruning_statistics &&
+        std::any_of(built_runtime_filters.begin(), built_runtime_filters.end(), [&](const auto& runtime_filter) {
+          return runtime_filter.first->can_prune(*(*pruning_statistics)[runtime_filter.second]);
+        })) {
+      excluded_chunk_ids.emplace_back(stored_chunk_id);
+      continue;
+    }
   }
 
   // We cannot create a Table without columns - since Chunks rely on their first column to determine their row count
@@ -241,33 +261,26 @@ std::shared_ptr<const Table> GetTable::_on_execute() {
     ++output_chunks_iter;
   }
 
-  // Lambda to check if all chunks indexed by a table index have been pruned by the ChunkPruningRule or
-  // ColumnPruningRule of the optimizer.
-  const auto all_indexed_segments_pruned = [&](const auto& table_index) {
-    // Check if indexed ColumnID has been pruned.
-    const auto indexed_column_id = table_index->get_indexed_column_id();
-    if (std::find(_pruned_column_ids.cbegin(), _pruned_column_ids.cend(), indexed_column_id) !=
-        _pruned_column_ids.cend()) {
+  // Table indexes store the RowIDs of the stored table. They can only be forwarded if these RowIDs are valid for the
+  // output table as well, i.e., if the ColumnIDs and ChunkIDs do not change. For the ChunkIDs, this is the case if
+  // only chunks at the end of the stored table were excluded. Consumers of the output table must ignore the index
+  // entries of chunks beyond its chunk count, which might also have been indexed while the output table is used.
+  const auto output_chunk_ids_are_stable =
+      excluded_chunk_ids.empty() || excluded_chunk_ids.front() == static_cast<ChunkID::base_type>(output_chunks.size());
+
+  // Lambda to check if the table index cannot be forwarded, e.g., because chunks or columns have been pruned by the
+  // ChunkPruningRule or ColumnPruningRule of the optimizer.
+  const auto index_cannot_be_forwarded = [&](const auto& table_index) {
+    if (!output_chunk_ids_are_stable) {
       return true;
     }
 
-    const auto indexed_chunk_ids = table_index->get_indexed_chunk_ids();
-
-    // Early out if index is empty.
-    if (indexed_chunk_ids.empty()) {
-      return false;
-    }
-
-    // Check if the indexed chunks have been pruned.
-    DebugAssert(std::is_sorted(_pruned_chunk_ids.begin(), _pruned_chunk_ids.end()),
-                "Expected _pruned_chunk_ids vector to be sorted.");
-    return std::all_of(indexed_chunk_ids.cbegin(), indexed_chunk_ids.cend(), [&](const auto chunk_id) {
-      return std::binary_search(_pruned_chunk_ids.cbegin(), _pruned_chunk_ids.cend(), chunk_id);
-    });
+    // Check if the indexed column or a column before it has been pruned.
+    return !_pruned_column_ids.empty() && _pruned_column_ids.front() <= table_index->get_indexed_column_id();
   };
 
   auto table_indexes = stored_table->get_table_indexes();
-  table_indexes.erase(std::remove_if(table_indexes.begin(), table_indexes.end(), all_indexed_segments_pruned),
+  table_indexes.erase(std::remove_if(table_indexes.begin(), table_indexes.end(), index_cannot_be_forwarded),
                       table_indexes.cend());
 
   return std::make_shared<Table>(pruned_column_definitions, TableType::Data, std::move(output_chunks),
@@ -11,7 +11,8 @@ namespace hyrise {
 // added), this is not reflected in GetTable's result. This is by design to make sure that following operators do not
 // have to deal with tables that change their chunk count while they are being looked at. However, rows added to a chunk
 // within that stored table that was already present when GetTable was executed will be visible when calling
-// get_output().
+// get_output(). In addition, chunks are pruned during the execution if their pruning statistics show that they hold no
+// join partners for one of the operator's runtime filters (see RuntimeFilter).
 class GetTable : public AbstractReadOnlyOperator {
  public:
   // Convenience constructor without pruning info
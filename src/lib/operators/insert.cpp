@@ -9,6 +9,7 @@
 #include "hyrise.hpp"
 #include "resolve_type.hpp"
 #include "storage/abstract_encoded_segment.hpp"
+#include "storage/index/adaptive_radix_tree/primary_key_index.hpp"
 #include "storage/segment_iterate.hpp"
 #include "storage/value_segment.hpp"
 #include "utils/assert.hpp"
@@ -125,6 +126,9 @@ std::shared_ptr<const Table> Insert::_on_execute(std::shared_ptr<TransactionCont
           ChunkRange{target_chunk_id, target_chunk->size(),
                      static_cast<ChunkOffset>(target_chunk->size() + num_rows_for_target_chunk)});
 
+      // The chunk must not be finalized before this Insert committed or rolled back.
+      target_chunk->increase_pending_inserts();
+
       // Mark new (but still empty) rows as being under modification by current transaction.
       // Do so before resizing the Segments, because the resize of `Chunk::_segments.front()` is what releases the
       // new row count.
@@ -218,10 +222,38 @@ std::shared_ptr<const Table> Insert::_on_execute(std::shared_ptr<TransactionCont
     }
   }
 
+  /**
+   * 3. Add the new rows to the primary key index, which fails if their keys are already held by other rows.
+   */
+  _primary_key_index = _target_table->primary_key_index();
+  if (_primary_key_index) {
+    const auto transaction_id = context->transaction_id();
+    for (const auto& target_chunk_range : _target_chunk_ranges) {
+      for (auto chunk_offset = target_chunk_range.begin_chunk_offset;
+           chunk_offset < target_chunk_range.end_chunk_offset; ++chunk_offset) {
+        const auto row_id = RowID{target_chunk_range.chunk_id, chunk_offset};
+        if (!_primary_key_index->insert(*_target_table, row_id, transaction_id)) {
+          _mark_as_failed();
+          return nullptr;
+        }
+        _primary_key_index_row_ids.emplace_back(row_id);
+      }
+    }
+  }
+
   return nullptr;
 }
 
 void Insert::_on_commit_records(const CommitID cid) {
+  // Log the new rows before they are marked as committed. Until then, the chunk cannot be encoded in the background.
+  auto& write_ahead_log = Hyrise::get().write_ahead_log;
+  if (write_ahead_log.is_enabled()) {
+    for (const auto& target_chunk_range : _target_chunk_ranges) {
+      write_ahead_log.log_insert(cid, _target_table_name, _target_table, target_chunk_range.chunk_id,
+                                 target_chunk_range.begin_chunk_offset, target_chunk_range.end_chunk_offset);
+    }
+  }
+
   for (const auto& target_chunk_range : _target_chunk_ranges) {
     const auto target_chunk = _target_table->get_chunk(target_chunk_range.chunk_id);
     auto mvcc_data = target_chunk->mvcc_data();
@@ -234,10 +266,18 @@ void Insert::_on_commit_records(const CommitID cid) {
 
     // This fence ensures that the changes to TID (which are not sequentially consistent) are visible to other threads.
     std::atomic_thread_fence(std::memory_order_release);
+
+    _finish_chunk_insert(target_chunk_range.chunk_id, target_chunk);
   }
+
+  _target_table->increase_modified_row_count(_inserted_row_count());
 }
 
 void Insert::_on_rollback_records() {
+  for (const auto& row_id : _primary_key_index_row_ids) {
+    _primary_key_index->erase(*_target_table, row_id);
+  }
+
   for (const auto& target_chunk_range : _target_chunk_ranges) {
     const auto target_chunk = _target_table->get_chunk(target_chunk_range.chunk_id);
     auto mvcc_data = target_chunk->mvcc_data();
@@ -252,7 +292,7 @@ void Insert::_on_rollback_records() {
      * the other transaction would consider the row (that is in the process of being rolled back and should have never
      * been visible) as visible.
      *
-     * We need to set `begin_cid = 0` so that the ChunkCompressionTask can identify "completed" Chunks.
+     * We need to set `begin_cid = 0` so that the chunk can be finalized once it is full (see Chunk::finalize()).
      */
 
     for (auto chunk_offset = target_chunk_range.begin_chunk_offset; chunk_offset < target_chunk_range.end_chunk_offset;
@@ -275,6 +315,28 @@ void Insert::_on_rollback_records() {
 
     // This fence ensures that the changes to TID (which are not sequentially consistent) are visible to other threads.
     std::atomic_thread_fence(std::memory_order_release);
+
+    _finish_chunk_insert(target_chunk_range.chunk_id, target_chunk);
+  }
+}
+
+uint64_t Insert::_inserted_row_count() const {
+  auto row_count = uint64_t{0};
+  for (const auto& target_chunk_range : _target_chunk_ranges) {
+    row_count += target_chunk_range.end_chunk_offset - target_chunk_range.begin_chunk_offset;
+  }
+  return row_count;
+}
+
+void Insert::_finish_chunk_insert(const ChunkID target_chunk_id, const std::shared_ptr<Chunk>& target_chunk) const {
+  // Once the last pending Insert into a full chunk is committed or rolled back, the chunk's content does not change
+  // anymore (apart from invalidations). Thus, the chunk can be added to the table indexes right away. As full chunks do
+  // not receive new Inserts, only one Insert ends up here per chunk. Pruning statistics require the chunk to be
+  // finalized. They are generated in the background (see StatisticsMaintenancePlugin and ChunkCompressionPlugin) to
+  // keep this work off the commit path.
+  const auto was_last_pending_insert = target_chunk->decrease_pending_inserts();
+  if (was_last_pending_insert && target_chunk->size() == _target_table->target_chunk_size()) {
+    _target_table->add_chunk_to_table_indexes(target_chunk_id);
   }
 }
 
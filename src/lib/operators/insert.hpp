@@ -10,6 +10,7 @@
 
 namespace hyrise {
 
+class PrimaryKeyIndex;
 class TransactionContext;
 
 /**
@@ -18,6 +19,9 @@ class TransactionContext;
  * the values to insert in a separate table using the same column layout.
  *
  * Assumption: The input has been validated before.
+ *
+ * If the target table has a PrimaryKeyIndex, the new rows are added to it. If the key of a new row is already held by
+ * another row, the Insert fails and the transaction has to be rolled back.
  */
 class Insert : public AbstractReadWriteOperator {
  public:
@@ -37,6 +41,12 @@ class Insert : public AbstractReadWriteOperator {
   void _on_rollback_records() override;
 
  private:
+  uint64_t _inserted_row_count() const;
+
+  // Decreases the pending inserts of the chunk. If the chunk is completed, generates its pruning statistics and adds
+  // it to the table indexes.
+  void _finish_chunk_insert(const ChunkID target_chunk_id, const std::shared_ptr<Chunk>& target_chunk) const;
+
   const std::string _target_table_name;
 
   // Ranges of rows to which the inserted values are written
@@ -49,6 +59,10 @@ class Insert : public AbstractReadWriteOperator {
   std::vector<ChunkRange> _target_chunk_ranges;
 
   std::shared_ptr<Table> _target_table;
+
+  // Rows that were added to the primary key index and have to be removed from it on rollback
+  std::shared_ptr<PrimaryKeyIndex> _primary_key_index;
+  std::vector<RowID> _primary_key_index_row_ids;
 };
 
 }  // namespace hyrise
@@ -1,5 +1,6 @@
 #include "join_index.hpp"
 
+#include <algorithm>
 #include <map>
 #include <memory>
 #include <numeric>
@@ -13,6 +14,8 @@
 #include "multi_predicate_join/multi_predicate_join_evaluator.hpp"
 #include "resolve_type.hpp"
 #include "storage/index/abstract_chunk_index.hpp"
+#include "storage/index/partial_hash/partial_hash_index.hpp"
+#include "storage/reference_segment.hpp"
 #include "storage/segment_iterate.hpp"
 #include "type_comparison.hpp"
 #include "utils/assert.hpp"
@@ -151,9 +154,16 @@ std::shared_ptr<const Table> JoinIndex::_on_execute() {
   Timer timer;
   if (_mode == JoinMode::Inner && _index_input_table->type() == TableType::References &&
       _secondary_predicates.empty()) {  // INNER REFERENCE JOIN
+    const auto chunks_joined_using_table_index = _reference_join_using_table_index();
+    index_joining_duration += timer.lap();
+
     // Scan all chunks for index input
     const auto chunk_count_index_input_table = _index_input_table->chunk_count();
     for (ChunkID index_chunk_id{0}; index_chunk_id < chunk_count_index_input_table; ++index_chunk_id) {
+      if (chunks_joined_using_table_index[index_chunk_id]) {
+        continue;
+      }
+
       const auto index_chunk = _index_input_table->get_chunk(index_chunk_id);
       Assert(index_chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
 
@@ -201,9 +211,16 @@ std::shared_ptr<const Table> JoinIndex::_on_execute() {
       }
     }
   } else {  // DATA JOIN since only inner joins are supported for a reference table on the index side
+    const auto chunks_joined_using_table_index = _data_join_using_table_index();
+    index_joining_duration += timer.lap();
+
     // Scan all chunks for index input
     const auto chunk_count_index_input_table = _index_input_table->chunk_count();
     for (ChunkID index_chunk_id{0}; index_chunk_id < chunk_count_index_input_table; ++index_chunk_id) {
+      if (chunks_joined_using_table_index[index_chunk_id]) {
+        continue;
+      }
+
       const auto index_chunk = _index_input_table->get_chunk(index_chunk_id);
       Assert(index_chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
 
@@ -310,6 +327,177 @@ void JoinIndex::_fallback_nested_loop(const ChunkID index_chunk_id, const bool t
   join_index_performance_data.chunks_scanned_without_index++;
 }
 
+std::shared_ptr<PartialHashIndex> JoinIndex::_usable_table_index(const Table& table, const ColumnID column_id) const {
+  // Table indexes only support lookups of single values. The index is typed by the indexed column's data type, so the
+  // probe values need to have the same type.
+  if (_adjusted_primary_predicate.predicate_condition != PredicateCondition::Equals ||
+      _mode == JoinMode::AntiNullAsTrue || !_secondary_predicates.empty() ||
+      table.column_data_type(column_id) !=
+          _probe_input_table->column_data_type(_adjusted_primary_predicate.column_ids.first)) {
+    return nullptr;
+  }
+
+  const auto table_indexes = table.get_table_indexes(column_id);
+  return table_indexes.empty() ? nullptr : table_indexes.front();
+}
+
+template <typename IsRelevant, typename Functor>
+void JoinIndex::_probe_table_index(const PartialHashIndex& table_index, const IsRelevant& is_relevant,
+                                   const Functor& functor) {
+  auto index_matches = RowIDPosList{};
+  const auto chunk_count = _probe_input_table->chunk_count();
+  for (auto probe_chunk_id = ChunkID{0}; probe_chunk_id < chunk_count; ++probe_chunk_id) {
+    const auto chunk = _probe_input_table->get_chunk(probe_chunk_id);
+    Assert(chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
+
+    const auto& probe_segment = chunk->get_segment(_adjusted_primary_predicate.column_ids.first);
+    segment_iterate(*probe_segment, [&](const auto& probe_side_position) {
+      if (probe_side_position.is_null()) {
+        return;
+      }
+
+      index_matches.clear();
+      table_index.range_equals_with_iterators(
+          [&](auto begin, const auto end) {
+            std::copy_if(begin, end, std::back_inserter(index_matches), is_relevant);
+          },
+          AllTypeVariant{probe_side_position.value()});
+      functor(probe_chunk_id, probe_side_position.chunk_offset(), index_matches);
+    });
+  }
+}
+
+std::vector<bool> JoinIndex::_data_join_using_table_index() {
+  const auto chunk_count = _index_input_table->chunk_count();
+  auto chunks_joined = std::vector<bool>(chunk_count, false);
+
+  const auto table_index = _usable_table_index(*_index_input_table, _adjusted_primary_predicate.column_ids.second);
+  if (!table_index) {
+    return chunks_joined;
+  }
+
+  // Fix the indexed chunks before probing, as chunks might be added to the index concurrently. If GetTable excluded
+  // chunks at the end of the stored table, the index also contains chunk ids beyond our chunk count.
+  auto joined_chunk_count = size_t{0};
+  for (const auto chunk_id : table_index->get_indexed_chunk_ids()) {
+    if (chunk_id < chunk_count) {
+      chunks_joined[chunk_id] = true;
+      ++joined_chunk_count;
+    }
+  }
+  if (joined_chunk_count == 0) {
+    return chunks_joined;
+  }
+
+  const auto is_joined_chunk = [&](const RowID& row_id) {
+    return row_id.chunk_id < chunk_count && chunks_joined[row_id.chunk_id];
+  };
+  _probe_table_index(
+      *table_index, is_joined_chunk,
+      [&](const ChunkID probe_chunk_id, const ChunkOffset probe_chunk_offset, const RowIDPosList& index_matches) {
+        _append_matches(index_matches, probe_chunk_offset, probe_chunk_id);
+      });
+
+  static_cast<PerformanceData&>(*performance_data).chunks_scanned_with_index += joined_chunk_count;
+  return chunks_joined;
+}
+
+std::vector<bool> JoinIndex::_reference_join_using_table_index() {
+  const auto chunk_count = _index_input_table->chunk_count();
+  auto chunks_joined = std::vector<bool>(chunk_count, false);
+  if (chunk_count == 0) {
+    return chunks_joined;
+  }
+
+  const auto index_column_id = _adjusted_primary_predicate.column_ids.second;
+  const auto first_chunk = _index_input_table->get_chunk(ChunkID{0});
+  Assert(first_chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
+  const auto first_reference_segment =
+      std::dynamic_pointer_cast<const ReferenceSegment>(first_chunk->get_segment(index_column_id));
+  if (!first_reference_segment) {
+    return chunks_joined;
+  }
+
+  const auto referenced_table = first_reference_segment->referenced_table();
+  const auto table_index = _usable_table_index(*referenced_table, first_reference_segment->referenced_column_id());
+  if (!table_index) {
+    return chunks_joined;
+  }
+
+  const auto referenced_chunk_count = referenced_table->chunk_count();
+  auto referenced_chunk_is_indexed = std::vector<bool>(referenced_chunk_count, false);
+  for (const auto chunk_id : table_index->get_indexed_chunk_ids()) {
+    if (chunk_id < referenced_chunk_count) {
+      referenced_chunk_is_indexed[chunk_id] = true;
+    }
+  }
+
+  // For each indexed chunk of the referenced table, collect the (sorted) positions that the index input references.
+  // Only these positions may be emitted.
+  auto referenced_positions = std::vector<RowIDPosList>(referenced_chunk_count);
+  auto joined_chunk_count = size_t{0};
+  for (auto index_chunk_id = ChunkID{0}; index_chunk_id < chunk_count; ++index_chunk_id) {
+    const auto index_chunk = _index_input_table->get_chunk(index_chunk_id);
+    Assert(index_chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
+
+    const auto reference_segment =
+        std::dynamic_pointer_cast<const ReferenceSegment>(index_chunk->get_segment(index_column_id));
+    if (!reference_segment || reference_segment->referenced_table() != referenced_table ||
+        reference_segment->referenced_column_id() != first_reference_segment->referenced_column_id()) {
+      continue;
+    }
+
+    const auto& pos_list = reference_segment->pos_list();
+    if (pos_list->empty()) {
+      chunks_joined[index_chunk_id] = true;
+      ++joined_chunk_count;
+      continue;
+    }
+
+    if (!pos_list->references_single_chunk()) {
+      continue;
+    }
+
+    const auto referenced_chunk_id = (*pos_list)[ChunkOffset{0}].chunk_id;
+    if (!referenced_chunk_is_indexed[referenced_chunk_id]) {
+      continue;
+    }
+
+    auto& positions = referenced_positions[referenced_chunk_id];
+    positions.insert(positions.end(), pos_list->begin(), pos_list->end());
+    chunks_joined[index_chunk_id] = true;
+    ++joined_chunk_count;
+  }
+
+  if (joined_chunk_count == 0) {
+    return chunks_joined;
+  }
+
+  for (auto& positions : referenced_positions) {
+    std::sort(positions.begin(), positions.end());
+  }
+
+  auto index_table_matches = RowIDPosList{};
+  _probe_table_index(
+      *table_index,
+      [&](const RowID& row_id) {
+        return row_id.chunk_id < referenced_chunk_count && !referenced_positions[row_id.chunk_id].empty();
+      },
+      [&](const ChunkID probe_chunk_id, const ChunkOffset probe_chunk_offset, const RowIDPosList& index_matches) {
+        // Emit each match as often as the index input references it.
+        index_table_matches.clear();
+        for (const auto& row_id : index_matches) {
+          const auto& positions = referenced_positions[row_id.chunk_id];
+          const auto [range_begin, range_end] = std::equal_range(positions.cbegin(), positions.cend(), row_id);
+          index_table_matches.insert(index_table_matches.end(), range_begin, range_end);
+        }
+        _append_matches_dereferenced(probe_chunk_id, probe_chunk_offset, index_table_matches);
+      });
+
+  static_cast<PerformanceData&>(*performance_data).chunks_scanned_with_index += joined_chunk_count;
+  return chunks_joined;
+}
+
 // join loop that joins two segments of two columns using an iterator for the probe side,
 // and an index for the index side
 template <typename ProbeIterator>
@@ -457,6 +645,35 @@ void JoinIndex::_append_matches(const AbstractChunkIndex::Iterator& range_begin,
   }
 }
 
+void JoinIndex::_append_matches(const RowIDPosList& index_matches, const ChunkOffset probe_chunk_offset,
+                                const ChunkID probe_chunk_id) {
+  if (index_matches.empty()) {
+    return;
+  }
+
+  const auto semi_or_anti_join = is_semi_or_anti_join(_mode);
+
+  // Remember the matches for non-inner joins
+  if (((semi_or_anti_join || _mode == JoinMode::Left) && _index_side == IndexSide::Right) ||
+      (_mode == JoinMode::Right && _index_side == IndexSide::Left) || _mode == JoinMode::FullOuter) {
+    _probe_matches[probe_chunk_id][probe_chunk_offset] = true;
+  }
+
+  if (!semi_or_anti_join) {
+    // we replicate the probe side value for each index side value
+    std::fill_n(std::back_inserter(*_probe_pos_list), index_matches.size(), RowID{probe_chunk_id, probe_chunk_offset});
+    _index_pos_list->insert(_index_pos_list->end(), index_matches.begin(), index_matches.end());
+  }
+
+  if ((_mode == JoinMode::Left && _index_side == IndexSide::Left) ||
+      (_mode == JoinMode::Right && _index_side == IndexSide::Right) || _mode == JoinMode::FullOuter ||
+      (semi_or_anti_join && _index_side == IndexSide::Left)) {
+    for (const auto& row_id : index_matches) {
+      _index_matches[row_id.chunk_id][row_id.chunk_offset] = true;
+    }
+  }
+}
+
 void JoinIndex::_append_matches_dereferenced(const ChunkID& probe_chunk_id, const ChunkOffset& probe_chunk_offset,
                                              const RowIDPosList& index_table_matches) {
   for (const auto& index_side_row_id : index_table_matches) {
@@ -8,6 +8,7 @@
 
 #include "abstract_join_operator.hpp"
 #include "storage/index/abstract_chunk_index.hpp"
+#include "storage/index/partial_hash/partial_hash_index.hpp"
 #include "storage/pos_lists/row_id_pos_list.hpp"
 #include "types.hpp"
 
@@ -27,6 +28,12 @@ using IndexRange = std::pair<AbstractChunkIndex::Iterator, AbstractChunkIndex::I
    * scanned with index in the performance data.
    *
    * Note: An index needs to be present on the index side table in order to execute an index join.
+   *
+   * Besides chunk indexes, equi-joins can use a table index (see Table::create_table_index) on the index side column.
+   * For a data table on the index side, the table index must have been created on that table (GetTable forwards the
+   * indexes of the stored table, see GetTable::_on_execute). For a reference table, the table index of the referenced
+   * table is used for all chunks whose position lists reference a single indexed chunk. Instead of one lookup per
+   * probe row and index chunk, a single lookup per probe row is required for all chunks covered by the table index.
    */
 class JoinIndex : public AbstractJoinOperator {
  public:
@@ -84,6 +91,22 @@ class JoinIndex : public AbstractJoinOperator {
                        const ChunkOffset probe_chunk_offset, const ChunkID probe_chunk_id,
                        const ChunkID index_chunk_id);
 
+  void _append_matches(const RowIDPosList& index_matches, const ChunkOffset probe_chunk_offset,
+                       const ChunkID probe_chunk_id);
+
+  // Returns the table index on the given column if it can be used to evaluate the primary predicate.
+  std::shared_ptr<PartialHashIndex> _usable_table_index(const Table& table, const ColumnID column_id) const;
+
+  // Join all chunks of the index input that are covered by a table index. For each chunk of the index input, the
+  // returned vector states whether the chunk was joined.
+  std::vector<bool> _data_join_using_table_index();
+  std::vector<bool> _reference_join_using_table_index();
+
+  // Calls functor(probe_chunk_id, probe_chunk_offset, index_matches) for each non-NULL probe value with the RowIDs
+  // returned by the table index that satisfy is_relevant.
+  template <typename IsRelevant, typename Functor>
+  void _probe_table_index(const PartialHashIndex& table_index, const IsRelevant& is_relevant, const Functor& functor);
+
   void _append_matches_dereferenced(const ChunkID& probe_chunk_id, const ChunkOffset& probe_chunk_offset,
                                     const RowIDPosList& index_table_matches);
 
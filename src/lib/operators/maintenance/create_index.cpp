@@ -0,0 +1,75 @@
+#include "create_index.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+
+#include "hyrise.hpp"
+#include "sql/sql_plan_cache.hpp"
+#include "storage/table.hpp"
+
+namespace hyrise {
+
+CreateIndex::CreateIndex(const std::string& init_index_name, const std::string& init_table_name,
+                         const ColumnID init_column_id, const bool init_if_not_exists)
+    : AbstractReadOnlyOperator(OperatorType::CreateIndex),
+      index_name(init_index_name),
+      table_name(init_table_name),
+      column_id(init_column_id),
+      if_not_exists(init_if_not_exists) {}
+
+const std::string& CreateIndex::name() const {
+  static const auto name = std::string{"CreateIndex"};
+  return name;
+}
+
+std::string CreateIndex::description(DescriptionMode description_mode) const {
+  return AbstractOperator::description(description_mode) + " '" + index_name + "' on '" + table_name + "'";
+}
+
+bool CreateIndex::index_exists() const {
+  const auto table = Hyrise::get().storage_manager.get_table(table_name);
+  const auto table_indexes_statistics = table->table_indexes_statistics();
+  return std::any_of(table_indexes_statistics.cbegin(), table_indexes_statistics.cend(), [&](const auto& statistics) {
+    if (!index_name.empty()) {
+      return statistics.name == index_name;
+    }
+    return statistics.column_ids == std::vector<ColumnID>{column_id};
+  });
+}
+
+std::shared_ptr<const Table> CreateIndex::_on_execute() {
+  // If IF NOT EXISTS is not set and the index already exists, Table::create_table_index fails for named indexes.
+  if (if_not_exists && index_exists()) {
+    return nullptr;
+  }
+
+  Hyrise::get().storage_manager.get_table(table_name)->create_table_index(column_id, index_name);
+
+  // Plans that were cached before the index was created do not use it.
+  auto& hyrise = Hyrise::get();
+  if (hyrise.default_lqp_cache) {
+    hyrise.default_lqp_cache->clear();
+  }
+  if (hyrise.default_pqp_cache) {
+    hyrise.default_pqp_cache->clear();
+  }
+  if (hyrise.default_parameterized_lqp_cache) {
+    hyrise.default_parameterized_lqp_cache->clear();
+  }
+
+  return nullptr;
+}
+
+std::shared_ptr<AbstractOperator> CreateIndex::_on_deep_copy(
+    const std::shared_ptr<AbstractOperator>& /*copied_left_input*/,
+    const std::shared_ptr<AbstractOperator>& /*copied_right_input*/,
+    std::unordered_map<const AbstractOperator*, std::shared_ptr<AbstractOperator>>& /*copied_ops*/) const {
+  return std::make_shared<CreateIndex>(index_name, table_name, column_id, if_not_exists);
+}
+
+void CreateIndex::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {
+  // No parameters possible for CREATE INDEX
+}
+
+}  // namespace hyrise
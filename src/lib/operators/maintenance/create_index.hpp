@@ -0,0 +1,38 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "operators/abstract_read_only_operator.hpp"
+
+namespace hyrise {
+
+// maintenance operator for the "CREATE INDEX" sql statement, creates a table index (see Table::create_table_index)
+class CreateIndex : public AbstractReadOnlyOperator {
+ public:
+  CreateIndex(const std::string& init_index_name, const std::string& init_table_name, const ColumnID init_column_id,
+              const bool init_if_not_exists);
+
+  const std::string& name() const override;
+  std::string description(DescriptionMode description_mode) const override;
+
+  // Returns whether the table already has an index with the same name or, for unnamed indexes, on the same column.
+  bool index_exists() const;
+
+  const std::string index_name;
+  const std::string table_name;
+  const ColumnID column_id;
+  const bool if_not_exists;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  std::shared_ptr<AbstractOperator> _on_deep_copy(
+      const std::shared_ptr<AbstractOperator>& /*copied_left_input*/,
+      const std::shared_ptr<AbstractOperator>& /*copied_right_input*/,
+      std::unordered_map<const AbstractOperator*, std::shared_ptr<AbstractOperator>>& /*copied_ops*/) const override;
+
+  void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override;
+};
+
+}  // namespace hyrise
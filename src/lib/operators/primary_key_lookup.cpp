@@ -0,0 +1,122 @@
+#include "primary_key_lookup.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "hyrise.hpp"
+#include "storage/index/adaptive_radix_tree/primary_key_index.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace hyrise {
+
+PrimaryKeyLookup::PrimaryKeyLookup(const std::string& table_name, const std::vector<AllTypeVariant>& values,
+                                   const std::vector<ColumnID>& pruned_column_ids)
+    : AbstractReadOnlyOperator(OperatorType::PrimaryKeyLookup),
+      _table_name(table_name),
+      _values(values),
+      _pruned_column_ids(pruned_column_ids) {
+  DebugAssert(std::is_sorted(_pruned_column_ids.cbegin(), _pruned_column_ids.cend()),
+              "Expected sorted vector of ColumnIDs.");
+  Assert(!_values.empty(), "PrimaryKeyLookup requires a value for each primary key column.");
+}
+
+const std::string& PrimaryKeyLookup::name() const {
+  static const auto name = std::string{"PrimaryKeyLookup"};
+  return name;
+}
+
+std::string PrimaryKeyLookup::description(DescriptionMode description_mode) const {
+  const auto separator = (description_mode == DescriptionMode::SingleLine ? ' ' : '\n');
+
+  auto stream = std::stringstream{};
+  stream << AbstractOperator::description(description_mode) << separator << "(" << _table_name << ")";
+  stream << separator << "Key: (";
+  for (auto index = size_t{0}; index < _values.size(); ++index) {
+    stream << (index > 0 ? ", " : "") << _values[index];
+  }
+  stream << ")";
+  return stream.str();
+}
+
+const std::string& PrimaryKeyLookup::table_name() const {
+  return _table_name;
+}
+
+const std::vector<AllTypeVariant>& PrimaryKeyLookup::values() const {
+  return _values;
+}
+
+const std::vector<ColumnID>& PrimaryKeyLookup::pruned_column_ids() const {
+  return _pruned_column_ids;
+}
+
+std::shared_ptr<const Table> PrimaryKeyLookup::_on_execute() {
+  const auto stored_table = Hyrise::get().storage_manager.get_table(_table_name);
+  const auto primary_key_index = stored_table->primary_key_index();
+  Assert(primary_key_index, "Table '" + _table_name + "' has no primary key index.");
+
+  // Old versions of the row might be located in chunks that were physically deleted.
+  auto matches = primary_key_index->lookup(_values);
+  matches.erase(std::remove_if(matches.begin(), matches.end(),
+                               [&](const auto& row_id) { return !stored_table->get_chunk(row_id.chunk_id); }),
+                matches.end());
+  std::sort(matches.begin(), matches.end());
+
+  // Determine the non-pruned columns and their definitions.
+  auto output_column_ids = std::vector<ColumnID>{};
+  auto output_column_definitions = TableColumnDefinitions{};
+  auto pruned_column_ids_iter = _pruned_column_ids.cbegin();
+  const auto column_count = stored_table->column_count();
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    if (pruned_column_ids_iter != _pruned_column_ids.cend() && column_id == *pruned_column_ids_iter) {
+      ++pruned_column_ids_iter;
+      continue;
+    }
+    output_column_ids.emplace_back(column_id);
+    output_column_definitions.emplace_back(stored_table->column_definitions()[column_id]);
+  }
+
+  const auto output_table = std::make_shared<Table>(output_column_definitions, TableType::References);
+
+  // Emit one output chunk per referenced chunk so that the position lists reference a single chunk each. Usually,
+  // there is only a single match.
+  const auto match_count = matches.size();
+  auto range_begin = size_t{0};
+  while (range_begin < match_count) {
+    const auto chunk_id = matches[range_begin].chunk_id;
+    auto range_end = range_begin + 1;
+    while (range_end < match_count && matches[range_end].chunk_id == chunk_id) {
+      ++range_end;
+    }
+
+    const auto pos_list = std::make_shared<RowIDPosList>(matches.cbegin() + range_begin, matches.cbegin() + range_end);
+    pos_list->guarantee_single_chunk();
+
+    auto segments = Segments{};
+    segments.reserve(output_column_ids.size());
+    for (const auto column_id : output_column_ids) {
+      segments.emplace_back(std::make_shared<ReferenceSegment>(stored_table, column_id, pos_list));
+    }
+    output_table->append_chunk(segments);
+
+    range_begin = range_end;
+  }
+
+  return output_table;
+}
+
+std::shared_ptr<AbstractOperator> PrimaryKeyLookup::_on_deep_copy(
+    const std::shared_ptr<AbstractOperator>& /*copied_left_input*/,
+    const std::shared_ptr<AbstractOperator>& /*copied_right_input*/,
+    std::unordered_map<const AbstractOperator*, std::shared_ptr<AbstractOperator>>& /*copied_ops*/) const {
+  return std::make_shared<PrimaryKeyLookup>(_table_name, _values, _pruned_column_ids);
+}
+
+void PrimaryKeyLookup::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {}
+
+}  // namespace hyrise
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "abstract_read_only_operator.hpp"
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace hyrise {
+
+/**
+ * Operator that looks up the rows of a stored table with a given primary key using the table's PrimaryKeyIndex (see
+ * Table::create_primary_key_index). The values are given in the order of the index' columns. Like the
+ * TableIndexScan, the operator has no input but directly accesses the table. The output references the stored table
+ * and contains all of its columns except for the pruned ones.
+ *
+ * As the index covers all chunks, no additional scan is needed. However, the index also returns old versions of rows
+ * that were updated or deleted, so the output has to be validated.
+ */
+class PrimaryKeyLookup : public AbstractReadOnlyOperator {
+ public:
+  PrimaryKeyLookup(const std::string& table_name, const std::vector<AllTypeVariant>& values,
+                   const std::vector<ColumnID>& pruned_column_ids = {});
+
+  const std::string& name() const override;
+  std::string description(DescriptionMode description_mode) const override;
+
+  const std::string& table_name() const;
+  const std::vector<AllTypeVariant>& values() const;
+  const std::vector<ColumnID>& pruned_column_ids() const;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  std::shared_ptr<AbstractOperator> _on_deep_copy(
+      const std::shared_ptr<AbstractOperator>& /*copied_left_input*/,
+      const std::shared_ptr<AbstractOperator>& /*copied_right_input*/,
+      std::unordered_map<const AbstractOperator*, std::shared_ptr<AbstractOperator>>& /*copied_ops*/) const override;
+  void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override;
+
+  const std::string _table_name;
+  const std::vector<AllTypeVariant> _values;
+  const std::vector<ColumnID> _pruned_column_ids;
+};
+
+}  // namespace hyrise
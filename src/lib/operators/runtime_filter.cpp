@@ -0,0 +1,244 @@
+#include "runtime_filter.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "operators/abstract_operator.hpp"
+#include "resolve_type.hpp"
+#include "statistics/base_attribute_statistics.hpp"
+#include "storage/abstract_segment.hpp"
+#include "storage/chunk.hpp"
+#include "storage/pos_lists/entire_chunk_pos_list.hpp"
+#include "storage/pos_lists/row_id_pos_list.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+#include "utils/chunk_pruning_utils.hpp"
+
+namespace {
+
+// Odd constants used to derive the bit positions within the words of a block from the hash, taken from the Parquet
+// specification of split block Bloom filters.
+constexpr auto SALTS = std::array<uint32_t, 8>{0x47b6137bU, 0x44974d91U, 0x8824ad5bU, 0xa2b7289dU,
+                                               0x705495c7U, 0x2df1424bU, 0x9efc4947U, 0x5c6bfb31U};
+
+}  // namespace
+
+namespace hyrise {
+
+BlockedBloomFilter::BlockedBloomFilter(const size_t expected_element_count) {
+  constexpr auto BITS_PER_BLOCK = WORDS_PER_BLOCK * 64;
+  const auto required_block_count = (expected_element_count * BITS_PER_ELEMENT + BITS_PER_BLOCK - 1) / BITS_PER_BLOCK;
+  const auto block_count = std::min(std::bit_ceil(std::max(required_block_count, size_t{1})), MAX_BLOCK_COUNT);
+  _blocks.resize(block_count);
+  _block_mask = block_count - 1;
+}
+
+void BlockedBloomFilter::insert(const uint64_t hash) {
+  auto& block = _blocks[(hash >> 32) & _block_mask];
+  const auto masks = _masks(hash);
+  for (auto word_id = size_t{0}; word_id < WORDS_PER_BLOCK; ++word_id) {
+    block.words[word_id] |= masks[word_id];
+  }
+}
+
+bool BlockedBloomFilter::might_contain(const uint64_t hash) const {
+  const auto& block = _blocks[(hash >> 32) & _block_mask];
+  const auto masks = _masks(hash);
+
+  // Combine the checks of all words instead of returning early, so that the compiler can vectorize the loop.
+  auto missing_bits = uint64_t{0};
+  for (auto word_id = size_t{0}; word_id < WORDS_PER_BLOCK; ++word_id) {
+    missing_bits |= masks[word_id] & ~block.words[word_id];
+  }
+  return missing_bits == 0;
+}
+
+size_t BlockedBloomFilter::block_count() const {
+  return _blocks.size();
+}
+
+std::array<uint64_t, BlockedBloomFilter::WORDS_PER_BLOCK> BlockedBloomFilter::_masks(const uint64_t hash) {
+  const auto lower_hash = static_cast<uint32_t>(hash);
+  auto masks = std::array<uint64_t, WORDS_PER_BLOCK>{};
+  for (auto word_id = size_t{0}; word_id < WORDS_PER_BLOCK; ++word_id) {
+    // The upper six bits of the 32-bit product select one of the 64 bits of the word.
+    masks[word_id] = uint64_t{1} << ((lower_hash * SALTS[word_id]) >> 26);
+  }
+  return masks;
+}
+
+RuntimeFilter::RuntimeFilter(const std::shared_ptr<AbstractOperator>& build_operator, const ColumnID build_column_id)
+    : _build_operator{build_operator}, _build_column_id{build_column_id} {
+  Assert(_build_operator, "RuntimeFilter requires a build operator.");
+}
+
+const std::shared_ptr<AbstractOperator>& RuntimeFilter::build_operator() const {
+  return _build_operator;
+}
+
+ColumnID RuntimeFilter::build_column_id() const {
+  return _build_column_id;
+}
+
+bool RuntimeFilter::try_build() {
+  if (_built.load()) {
+    return true;
+  }
+
+  const auto lock = std::lock_guard<std::mutex>{_build_mutex};
+  if (_built.load()) {
+    return true;
+  }
+
+  // Operators that hold the filter are scheduled after the build operator, and its output is consumed by the join,
+  // which is executed after them. Thus, the output is only unavailable if the operators are executed manually.
+  if (_build_operator->state() != OperatorState::ExecutedAndAvailable) {
+    return false;
+  }
+
+  _build();
+  _built.store(true);
+  return true;
+}
+
+bool RuntimeFilter::can_prune(const BaseAttributeStatistics& segment_statistics) const {
+  DebugAssert(_built.load(), "RuntimeFilter has not been built.");
+  if (!_min) {
+    // The build side holds no join partners.
+    return true;
+  }
+
+  if (segment_statistics.data_type != _data_type) {
+    return false;
+  }
+
+  return hyrise::can_prune(segment_statistics, PredicateCondition::BetweenInclusive, *_min, *_max);
+}
+
+std::shared_ptr<RowIDPosList> RuntimeFilter::filter(
+    const AbstractSegment& segment, const std::shared_ptr<const AbstractPosList>& position_filter) const {
+  DebugAssert(_built.load(), "RuntimeFilter has not been built.");
+  if (segment.data_type() != _data_type) {
+    return nullptr;
+  }
+
+  auto matches = std::make_shared<RowIDPosList>();
+  if (position_filter->references_single_chunk()) {
+    matches->guarantee_single_chunk();
+  }
+
+  if (!_min) {
+    return matches;
+  }
+
+  matches->reserve(position_filter->size());
+
+  resolve_data_type(_data_type, [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+
+    const auto& min = boost::get<ColumnDataType>(*_min);
+    const auto& max = boost::get<ColumnDataType>(*_max);
+    const auto might_contain = [&](const auto& position) {
+      if (position.is_null()) {
+        return false;
+      }
+
+      const auto& value = position.value();
+      return value >= min && value <= max && _bloom_filter->might_contain(BlockedBloomFilter::hash(value));
+    };
+
+    // ReferenceSegments cannot be accessed by position, and other segments only by positions that are guaranteed to
+    // reference a single chunk. For all positions of a chunk, iterating the segment sequentially is faster, too. In
+    // these cases, we check all values of the segment first.
+    if (dynamic_cast<const ReferenceSegment*>(&segment) || !position_filter->references_single_chunk() ||
+        dynamic_cast<const EntireChunkPosList*>(position_filter.get())) {
+      auto value_might_be_contained = std::vector<bool>(segment.size());
+      segment_iterate<ColumnDataType>(segment, [&](const auto& position) {
+        value_might_be_contained[position.chunk_offset()] = might_contain(position);
+      });
+
+      for (const auto& row_id : *position_filter) {
+        if (value_might_be_contained[row_id.chunk_offset]) {
+          matches->emplace_back(row_id);
+        }
+      }
+      return;
+    }
+
+    segment_iterate_filtered<ColumnDataType>(segment, position_filter, [&](const auto& position) {
+      if (might_contain(position)) {
+        // For filtered iterations, the chunk offset of a position is its index in the position filter.
+        matches->emplace_back((*position_filter)[position.chunk_offset()]);
+      }
+    });
+  });
+
+  if (matches->size() == position_filter->size()) {
+    return nullptr;
+  }
+  return matches;
+}
+
+size_t RuntimeFilter::build_row_count() const {
+  DebugAssert(_built.load(), "RuntimeFilter has not been built.");
+  return _build_row_count;
+}
+
+std::shared_ptr<RuntimeFilter> RuntimeFilter::deep_copy(
+    std::unordered_map<const AbstractOperator*, std::shared_ptr<AbstractOperator>>& copied_ops) const {
+  return std::make_shared<RuntimeFilter>(_build_operator->deep_copy(copied_ops), _build_column_id);
+}
+
+void RuntimeFilter::_build() {
+  const auto table = _build_operator->get_output();
+  _data_type = table->column_data_type(_build_column_id);
+  _bloom_filter.emplace(table->row_count());
+
+  resolve_data_type(_data_type, [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+
+    auto min = std::optional<ColumnDataType>{};
+    auto max = std::optional<ColumnDataType>{};
+
+    const auto chunk_count = table->chunk_count();
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      const auto chunk = table->get_chunk(chunk_id);
+      if (!chunk) {
+        continue;
+      }
+
+      segment_iterate<ColumnDataType>(*chunk->get_segment(_build_column_id), [&](const auto& position) {
+        if (position.is_null()) {
+          return;
+        }
+
+        const auto& value = position.value();
+        _bloom_filter->insert(BlockedBloomFilter::hash(value));
+        if (!min || value < *min) {
+          min = value;
+        }
+        if (!max || value > *max) {
+          max = value;
+        }
+        ++_build_row_count;
+      });
+    }
+
+    if (min) {
+      _min = AllTypeVariant{*min};
+      _max = AllTypeVariant{*max};
+    }
+  });
+}
+
+}  // namespace hyrise
@@ -0,0 +1,150 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace hyrise {
+
+class AbstractOperator;
+class AbstractPosList;
+class AbstractSegment;
+class BaseAttributeStatistics;
+class RowIDPosList;
+
+/**
+ * A register-blocked Bloom filter (also known as split block Bloom filter). Each element sets one bit in each of the
+ * eight 64-bit words of a single cache-line-sized block, so that inserting and probing an element touches a single
+ * cache line and can be done without branches. The upper 32 bits of the element's hash select the block, the lower
+ * 32 bits are multiplied with a different odd constant per word to select the bit within that word (see "Cache-,
+ * Hash- and Space-Efficient Bloom Filters", Putze et al., 2007, and the Parquet specification of Bloom filters).
+ *
+ * With the default of 16 bits per element, the false positive rate is below 0.5%.
+ */
+class BlockedBloomFilter {
+ public:
+  static constexpr auto WORDS_PER_BLOCK = size_t{8};
+  static constexpr auto BITS_PER_ELEMENT = size_t{16};
+  static constexpr auto MAX_BLOCK_COUNT = size_t{1} << 20;
+
+  // Sizes the filter for the expected number of elements. The block count is a power of two.
+  explicit BlockedBloomFilter(const size_t expected_element_count);
+
+  void insert(const uint64_t hash);
+
+  bool might_contain(const uint64_t hash) const;
+
+  size_t block_count() const;
+
+  // Hashes values such that all values that compare equal have the same hash.
+  template <typename T>
+  static uint64_t hash(const T& value) {
+    auto hash = uint64_t{};
+    if constexpr (std::is_same_v<T, pmr_string>) {
+      hash = std::hash<std::string_view>{}(std::string_view{value.data(), value.size()});
+    } else if constexpr (std::is_floating_point_v<T>) {
+      using UnsignedType = std::conditional_t<sizeof(T) == 4, uint32_t, uint64_t>;
+      // -0.0 and 0.0 are equal but differ in their bits.
+      hash = std::bit_cast<UnsignedType>(value == T{0} ? T{0} : value);
+    } else {
+      hash = static_cast<uint64_t>(value);
+    }
+
+    // std::hash is the identity function for integers in common implementations. Hence, the bits are mixed with the
+    // finalizer of MurmurHash3 so that all bits of the hash depend on all bits of the value.
+    hash ^= hash >> 33;
+    hash *= uint64_t{0xff51afd7ed558ccd};
+    hash ^= hash >> 33;
+    hash *= uint64_t{0xc4ceb9fe1a85ec53};
+    hash ^= hash >> 33;
+    return hash;
+  }
+
+ private:
+  struct alignas(64) Block {
+    std::array<uint64_t, WORDS_PER_BLOCK> words{};
+  };
+
+  // Returns the mask of the bits that the element sets in each word of its block.
+  static std::array<uint64_t, WORDS_PER_BLOCK> _masks(const uint64_t hash);
+
+  std::vector<Block> _blocks;
+  uint64_t _block_mask;
+};
+
+/**
+ * A RuntimeFilter passes information from the build side of an equi-join to operators on its probe side
+ * (sideways information passing). It consists of a BlockedBloomFilter and the minimum and maximum of the join column
+ * on the build side. Operators that hold a runtime filter (see AbstractOperator::runtime_filters) use it to drop
+ * chunks (GetTable) and rows (TableScan, Validate) that cannot find a join partner before they are materialized by
+ * later operators. Thus, they must only be applied on paths where such rows do not contribute to the query result,
+ * i.e., below the probe side of inner and semi joins. The LQPTranslator adds runtime filters to joins marked by the
+ * RuntimeFilterRule.
+ *
+ * The filter is built from the output of the build operator when it is first used. For this, the operators holding
+ * it are scheduled after the build operator (see OperatorTask::make_tasks_from_operator). If the build operator has
+ * not been executed yet (e.g., because the operators are executed manually), nothing is filtered.
+ */
+class RuntimeFilter : private Noncopyable {
+ public:
+  RuntimeFilter(const std::shared_ptr<AbstractOperator>& build_operator, const ColumnID build_column_id);
+
+  const std::shared_ptr<AbstractOperator>& build_operator() const;
+  ColumnID build_column_id() const;
+
+  /**
+   * Builds the filter if this has not happened yet. Returns false if it cannot be built because the output of the
+   * build operator is not available. Thread-safe.
+   */
+  bool try_build();
+
+  /**
+   * Returns whether the statistics of a segment show that none of its values is contained in the build side. Like
+   * filter(), this must only be called after try_build() returned true.
+   */
+  bool can_prune(const BaseAttributeStatistics& segment_statistics) const;
+
+  /**
+   * Returns the positions of `position_filter` (offsets into the segment) whose values might be contained in the
+   * build side, or nullptr if this is the case for all of them. NULL values are never contained.
+   */
+  std::shared_ptr<RowIDPosList> filter(const AbstractSegment& segment,
+                                       const std::shared_ptr<const AbstractPosList>& position_filter) const;
+
+  // Returns the number of rows the filter was built from.
+  size_t build_row_count() const;
+
+  std::shared_ptr<RuntimeFilter> deep_copy(
+      std::unordered_map<const AbstractOperator*, std::shared_ptr<AbstractOperator>>& copied_ops) const;
+
+ private:
+  void _build();
+
+  const std::shared_ptr<AbstractOperator> _build_operator;
+  const ColumnID _build_column_id;
+
+  std::mutex _build_mutex;
+  std::atomic<bool> _built{false};
+
+  std::optional<BlockedBloomFilter> _bloom_filter;
+  DataType _data_type{DataType::Null};
+  size_t _build_row_count{0};
+
+  // Not set if all values on the build side are NULL.
+  std::optional<AllTypeVariant> _min;
+  std::optional<AllTypeVariant> _max;
+};
+
+}  // namespace hyrise
@@ -0,0 +1,438 @@
+#include "set_operation_hash.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <boost/container_hash/hash.hpp>
+
+#include "tsl/robin_map.h"
+
+#include "hyrise.hpp"
+#include "magic_enum.hpp"
+#include "resolve_type.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/job_task.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/segment_iterate.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace hyrise;  // NOLINT
+
+// Maximum number of partitions (as a power of two). Each partition is processed by one task, so more partitions than
+// workers do not pay off.
+constexpr auto MAX_RADIX_BITS = uint32_t{6};
+
+// Inputs with fewer rows are processed as a single partition, as the partitioning does not pay off.
+constexpr auto MIN_ROW_COUNT_FOR_PARTITIONING = uint64_t{10'000};
+
+// Arbitrary value that NULLs contribute to the row hash.
+constexpr auto NULL_VALUE_HASH = size_t{0x5BD1E995};
+
+// Partitions by the most significant bits of the row hash, see radix_partition() in aggregate_hash.cpp.
+size_t radix_partition(const size_t row_hash, const uint32_t radix_bits) {
+  if (radix_bits == 0) {
+    return 0;
+  }
+  const auto hash = static_cast<uint64_t>(row_hash) * uint64_t{0x9E3779B97F4A7C15};
+  return static_cast<size_t>(hash >> (64 - radix_bits));
+}
+
+// The values of one column of an input table, materialized per chunk, so that rows can be hashed and compared without
+// accessing the segments again.
+class BaseMaterializedColumn {
+ public:
+  virtual ~BaseMaterializedColumn() = default;
+
+  virtual void materialize_chunk(const ChunkID chunk_id, const AbstractSegment& segment) = 0;
+
+  // Combines the hashes of the chunk's values into the given row hashes.
+  virtual void hash_chunk(const ChunkID chunk_id, std::vector<size_t>& row_hashes) const = 0;
+
+  // Compares a value of this column to a value of `other_column`, which must have the same data type.
+  virtual bool equals(const RowID& row_id, const BaseMaterializedColumn& other_column,
+                      const RowID& other_row_id) const = 0;
+};
+
+template <typename ColumnDataType>
+class MaterializedColumn : public BaseMaterializedColumn {
+ public:
+  explicit MaterializedColumn(const ChunkID chunk_count) : _values(chunk_count), _null_values(chunk_count) {}
+
+  void materialize_chunk(const ChunkID chunk_id, const AbstractSegment& segment) final {
+    auto& values = _values[chunk_id];
+    auto& null_values = _null_values[chunk_id];
+    values.resize(segment.size());
+    null_values.resize(segment.size());
+
+    segment_iterate<ColumnDataType>(segment, [&](const auto& position) {
+      if (position.is_null()) {
+        null_values[position.chunk_offset()] = true;
+      } else {
+        values[position.chunk_offset()] = position.value();
+      }
+    });
+  }
+
+  void hash_chunk(const ChunkID chunk_id, std::vector<size_t>& row_hashes) const final {
+    const auto& values = _values[chunk_id];
+    const auto& null_values = _null_values[chunk_id];
+    const auto row_count = values.size();
+    for (auto chunk_offset = size_t{0}; chunk_offset < row_count; ++chunk_offset) {
+      const auto value_hash =
+          null_values[chunk_offset] ? NULL_VALUE_HASH : std::hash<ColumnDataType>{}(values[chunk_offset]);
+      boost::hash_combine(row_hashes[chunk_offset], value_hash);
+    }
+  }
+
+  bool equals(const RowID& row_id, const BaseMaterializedColumn& other_column,
+              const RowID& other_row_id) const final {
+    const auto& other = static_cast<const MaterializedColumn<ColumnDataType>&>(other_column);
+    const auto is_null = _null_values[row_id.chunk_id][row_id.chunk_offset];
+    const auto other_is_null = other._null_values[other_row_id.chunk_id][other_row_id.chunk_offset];
+    if (is_null || other_is_null) {
+      return is_null && other_is_null;
+    }
+    return _values[row_id.chunk_id][row_id.chunk_offset] ==
+           other._values[other_row_id.chunk_id][other_row_id.chunk_offset];
+  }
+
+ private:
+  std::vector<std::vector<ColumnDataType>> _values;
+  std::vector<std::vector<bool>> _null_values;
+};
+
+using MaterializedColumns = std::vector<std::unique_ptr<BaseMaterializedColumn>>;
+
+// The materialized rows of one input table.
+struct MaterializedInput {
+  std::shared_ptr<const Table> table;
+  MaterializedColumns columns;
+  std::vector<std::vector<size_t>> row_hashes_per_chunk;
+
+  // Offsets of the rows of each chunk, partitioned by their row hashes.
+  std::vector<std::vector<std::vector<ChunkOffset>>> offsets_per_chunk_and_partition;
+
+  // Whether a row is part of the output. We use uint8_t instead of bool, as the partitions are processed concurrently
+  // and write to the same chunks.
+  std::vector<std::vector<uint8_t>> emitted_rows_per_chunk;
+};
+
+// Identifies a row of one of the two inputs (0 for left, 1 for right) within the hash table of a partition.
+struct RowReference {
+  size_t hash;
+  size_t input_idx;
+  RowID row_id;
+};
+
+struct RowReferenceHash {
+  size_t operator()(const RowReference& row) const {
+    return row.hash;
+  }
+};
+
+struct RowReferenceEqual {
+  const std::array<MaterializedInput, 2>* inputs;
+
+  bool operator()(const RowReference& lhs, const RowReference& rhs) const {
+    if (lhs.hash != rhs.hash) {
+      return false;
+    }
+
+    const auto& lhs_columns = (*inputs)[lhs.input_idx].columns;
+    const auto& rhs_columns = (*inputs)[rhs.input_idx].columns;
+    const auto column_count = lhs_columns.size();
+    for (auto column_id = size_t{0}; column_id < column_count; ++column_id) {
+      if (!lhs_columns[column_id]->equals(lhs.row_id, *rhs_columns[column_id], rhs.row_id)) {
+        return false;
+      }
+    }
+    return true;
+  }
+};
+
+// Maps the distinct rows of a partition to a counter, whose meaning depends on the set operation.
+using RowCounts = tsl::robin_map<RowReference, size_t, RowReferenceHash, RowReferenceEqual>;
+
+// Calls `functor` with a RowReference for each row of the input that belongs to the partition, in the order of the
+// input's chunks and offsets.
+template <typename Functor>
+void for_each_row_in_partition(const MaterializedInput& input, const size_t input_idx, const size_t partition_idx,
+                               const Functor& functor) {
+  const auto chunk_count = static_cast<ChunkID::base_type>(input.offsets_per_chunk_and_partition.size());
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto& offsets_per_partition = input.offsets_per_chunk_and_partition[chunk_id];
+    if (offsets_per_partition.empty()) {
+      continue;
+    }
+
+    const auto& row_hashes = input.row_hashes_per_chunk[chunk_id];
+    for (const auto chunk_offset : offsets_per_partition[partition_idx]) {
+      functor(RowReference{row_hashes[chunk_offset], input_idx, RowID{chunk_id, chunk_offset}});
+    }
+  }
+}
+
+// Creates a chunk that references the emitted rows of an input chunk.
+std::shared_ptr<Chunk> create_output_chunk(const std::shared_ptr<const Table>& input_table, const ChunkID chunk_id,
+                                           const std::vector<uint8_t>& emitted_rows) {
+  const auto input_chunk = input_table->get_chunk(chunk_id);
+  const auto column_count = input_table->column_count();
+
+  // Segments that share a position list in the input share it in the output, too.
+  auto output_pos_lists = std::unordered_map<std::shared_ptr<const AbstractPosList>, std::shared_ptr<RowIDPosList>>{};
+  auto output_segments = Segments{};
+  output_segments.reserve(column_count);
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    const auto segment = input_chunk->get_segment(column_id);
+    const auto reference_segment = std::dynamic_pointer_cast<const ReferenceSegment>(segment);
+
+    // For data tables, the nullptr entry holds the positions in the input table itself.
+    const auto input_pos_list = reference_segment ? reference_segment->pos_list() : nullptr;
+    auto& output_pos_list = output_pos_lists[input_pos_list];
+    if (!output_pos_list) {
+      output_pos_list = std::make_shared<RowIDPosList>();
+      const auto input_size = emitted_rows.size();
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < input_size; ++chunk_offset) {
+        if (!emitted_rows[chunk_offset]) {
+          continue;
+        }
+        output_pos_list->emplace_back(input_pos_list ? (*input_pos_list)[chunk_offset]
+                                                     : RowID{chunk_id, chunk_offset});
+      }
+
+      if (!input_pos_list || input_pos_list->references_single_chunk()) {
+        output_pos_list->guarantee_single_chunk();
+      }
+    }
+
+    if (reference_segment) {
+      output_segments.emplace_back(std::make_shared<ReferenceSegment>(
+          reference_segment->referenced_table(), reference_segment->referenced_column_id(), output_pos_list));
+    } else {
+      output_segments.emplace_back(std::make_shared<ReferenceSegment>(input_table, column_id, output_pos_list));
+    }
+  }
+
+  // The rows keep their order, so the chunk is still sorted.
+  const auto output_chunk = std::make_shared<Chunk>(output_segments);
+  output_chunk->finalize();
+  const auto& sorted_by = input_chunk->individually_sorted_by();
+  if (!sorted_by.empty()) {
+    output_chunk->set_individually_sorted_by(sorted_by);
+  }
+  return output_chunk;
+}
+
+}  // namespace
+
+namespace hyrise {
+
+SetOperationHash::SetOperationHash(const std::shared_ptr<const AbstractOperator>& left_input,
+                                   const std::shared_ptr<const AbstractOperator>& right_input,
+                                   const SetOperationType set_operation_type,
+                                   const SetOperationMode set_operation_mode)
+    : AbstractReadOnlyOperator(OperatorType::SetOperationHash, left_input, right_input),
+      _set_operation_type(set_operation_type),
+      _set_operation_mode(set_operation_mode) {
+  Assert(set_operation_mode != SetOperationMode::Positions, "SetOperationHash does not support the Positions mode.");
+  Assert(set_operation_type != SetOperationType::Union || set_operation_mode != SetOperationMode::All,
+         "UNION ALL is handled by UnionAll.");
+}
+
+const std::string& SetOperationHash::name() const {
+  static const auto name = std::string{"SetOperationHash"};
+  return name;
+}
+
+std::string SetOperationHash::description(DescriptionMode description_mode) const {
+  return AbstractOperator::description(description_mode) + " (" +
+         std::string{magic_enum::enum_name(_set_operation_type)} + " " +
+         std::string{magic_enum::enum_name(_set_operation_mode)} + ")";
+}
+
+SetOperationType SetOperationHash::set_operation_type() const {
+  return _set_operation_type;
+}
+
+SetOperationMode SetOperationHash::set_operation_mode() const {
+  return _set_operation_mode;
+}
+
+std::shared_ptr<AbstractOperator> SetOperationHash::_on_deep_copy(
+    const std::shared_ptr<AbstractOperator>& copied_left_input,
+    const std::shared_ptr<AbstractOperator>& copied_right_input,
+    std::unordered_map<const AbstractOperator*, std::shared_ptr<AbstractOperator>>& /*copied_ops*/) const {
+  return std::make_shared<SetOperationHash>(copied_left_input, copied_right_input, _set_operation_type,
+                                            _set_operation_mode);
+}
+
+void SetOperationHash::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {}
+
+std::shared_ptr<const Table> SetOperationHash::_on_execute() {
+  const auto& left_table = left_input_table();
+  const auto& right_table = right_input_table();
+  const auto column_count = left_table->column_count();
+  Assert(right_table->column_count() == column_count, "Input tables must have the same number of columns.");
+
+  auto output_column_definitions = left_table->column_definitions();
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    Assert(left_table->column_data_type(column_id) == right_table->column_data_type(column_id),
+           "Input tables must have the same column data types.");
+    output_column_definitions[column_id].nullable |= right_table->column_is_nullable(column_id);
+  }
+
+  const auto row_count = left_table->row_count() + right_table->row_count();
+  auto radix_bits = uint32_t{0};
+  if (row_count >= MIN_ROW_COUNT_FOR_PARTITIONING) {
+    const auto cpu_count = std::clamp(Hyrise::get().topology.num_cpus(), size_t{1}, size_t{1} << MAX_RADIX_BITS);
+    radix_bits = static_cast<uint32_t>(std::bit_width(std::bit_ceil(cpu_count)) - 1);
+  }
+  const auto partition_count = size_t{1} << radix_bits;
+
+  /**
+   * MATERIALIZATION
+   *
+   * Each chunk of both inputs is materialized, hashed, and partitioned by a separate task.
+   */
+  auto inputs = std::array<MaterializedInput, 2>{};
+  inputs[0].table = left_table;
+  inputs[1].table = right_table;
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  for (auto& input : inputs) {
+    const auto chunk_count = input.table->chunk_count();
+    for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+      resolve_data_type(left_table->column_data_type(column_id), [&](const auto data_type_t) {
+        using ColumnDataType = typename decltype(data_type_t)::type;
+        input.columns.emplace_back(std::make_unique<MaterializedColumn<ColumnDataType>>(chunk_count));
+      });
+    }
+    input.row_hashes_per_chunk.resize(chunk_count);
+    input.offsets_per_chunk_and_partition.resize(chunk_count);
+    input.emitted_rows_per_chunk.resize(chunk_count);
+
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      const auto chunk = input.table->get_chunk(chunk_id);
+      if (!chunk || chunk->size() == 0) {
+        continue;
+      }
+
+      jobs.emplace_back(std::make_shared<JobTask>([&, chunk, chunk_id]() {
+        auto& row_hashes = input.row_hashes_per_chunk[chunk_id];
+        row_hashes.resize(chunk->size());
+        for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+          input.columns[column_id]->materialize_chunk(chunk_id, *chunk->get_segment(column_id));
+          input.columns[column_id]->hash_chunk(chunk_id, row_hashes);
+        }
+
+        auto& offsets_per_partition = input.offsets_per_chunk_and_partition[chunk_id];
+        offsets_per_partition.resize(partition_count);
+        const auto chunk_size = chunk->size();
+        for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+          offsets_per_partition[radix_partition(row_hashes[chunk_offset], radix_bits)].emplace_back(chunk_offset);
+        }
+
+        input.emitted_rows_per_chunk[chunk_id].resize(chunk_size);
+      }));
+    }
+  }
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+
+  /**
+   * PARTITIONED SET OPERATION
+   *
+   * Equal rows end up in the same partition. Each partition is processed by a task with its own hash table.
+   */
+  const auto emit = [&](const RowReference& row) {
+    inputs[row.input_idx].emitted_rows_per_chunk[row.row_id.chunk_id][row.row_id.chunk_offset] = 1;
+  };
+
+  jobs.clear();
+  jobs.reserve(partition_count);
+  for (auto partition_idx = size_t{0}; partition_idx < partition_count; ++partition_idx) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, partition_idx]() {
+      auto row_counts = RowCounts{0, RowReferenceHash{}, RowReferenceEqual{&inputs}};
+
+      if (_set_operation_type == SetOperationType::Union) {
+        // Emit the first occurrence of each row of both inputs.
+        for (auto input_idx = size_t{0}; input_idx < inputs.size(); ++input_idx) {
+          for_each_row_in_partition(inputs[input_idx], input_idx, partition_idx, [&](const RowReference& row) {
+            if (row_counts.emplace(row, 0).second) {
+              emit(row);
+            }
+          });
+        }
+        return;
+      }
+
+      // For INTERSECT and EXCEPT, count the occurrences of each row in the right input first.
+      for_each_row_in_partition(inputs[1], 1, partition_idx, [&](const RowReference& row) {
+        ++row_counts[row];
+      });
+
+      // Then, decide for each row of the left input whether it is emitted.
+      for_each_row_in_partition(inputs[0], 0, partition_idx, [&](const RowReference& row) {
+        auto iter = row_counts.find(row);
+        const auto right_count = iter == row_counts.end() ? size_t{0} : iter->second;
+
+        if (_set_operation_type == SetOperationType::Intersect) {
+          if (right_count == 0) {
+            return;
+          }
+          emit(row);
+          // Each emitted row consumes one occurrence in the right input (ALL) or all of them (set semantics).
+          iter.value() = _set_operation_mode == SetOperationMode::All ? right_count - 1 : 0;
+          return;
+        }
+
+        // EXCEPT
+        if (_set_operation_mode == SetOperationMode::All) {
+          if (right_count > 0) {
+            // The occurrence in the left input is cancelled out by one in the right input.
+            iter.value() = right_count - 1;
+          } else {
+            emit(row);
+          }
+          return;
+        }
+
+        // With set semantics, rows occurring in the right input are never emitted. Other rows are emitted once and
+        // then added with a count of zero to skip their duplicates.
+        if (iter == row_counts.end()) {
+          emit(row);
+          row_counts.emplace(row, 0);
+        }
+      });
+    }));
+  }
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+
+  /**
+   * OUTPUT
+   */
+  auto output_chunks = std::vector<std::shared_ptr<Chunk>>{};
+  const auto emitting_input_count = _set_operation_type == SetOperationType::Union ? size_t{2} : size_t{1};
+  for (auto input_idx = size_t{0}; input_idx < emitting_input_count; ++input_idx) {
+    const auto& input = inputs[input_idx];
+    const auto chunk_count = static_cast<ChunkID::base_type>(input.emitted_rows_per_chunk.size());
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      const auto& emitted_rows = input.emitted_rows_per_chunk[chunk_id];
+      if (std::find(emitted_rows.cbegin(), emitted_rows.cend(), uint8_t{1}) == emitted_rows.cend()) {
+        continue;
+      }
+      output_chunks.emplace_back(create_output_chunk(input.table, chunk_id, emitted_rows));
+    }
+  }
+
+  return std::make_shared<Table>(output_column_definitions, TableType::References, std::move(output_chunks));
+}
+
+}  // namespace hyrise
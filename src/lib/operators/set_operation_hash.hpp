@@ -0,0 +1,54 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "abstract_read_only_operator.hpp"
+#include "types.hpp"
+
+namespace hyrise {
+
+/**
+ * Computes UNION, INTERSECT, or EXCEPT of two tables by comparing their rows value by value. Both inputs need to have
+ * the same number of columns with the same data types. As in SQL, NULLs are considered equal to each other.
+ *
+ * For a row that occurs m times in the left and n times in the right input, the output contains it
+ *     UNION:          once if m + n > 0
+ *     INTERSECT:      once if m > 0 and n > 0          INTERSECT ALL:  min(m, n) times
+ *     EXCEPT:         once if m > 0 and n = 0          EXCEPT ALL:     max(m - n, 0) times
+ * UNION ALL does not need to compare rows and is handled by UnionAll.
+ *
+ * The rows of both inputs are materialized and hashed chunk by chunk. The row hashes are then used to radix-partition
+ * the rows, so that each partition can be processed by a separate task using its own hash table. Rows are hashed and
+ * compared with their typed values, i.e., without serializing them.
+ *
+ * The output references the input rows. INTERSECT and EXCEPT emit rows of the left input, UNION emits rows of both
+ * inputs. Each output chunk holds the emitted rows of one input chunk in their original order. With set semantics, the
+ * first occurrence of a row (left before right) is emitted.
+ */
+class SetOperationHash : public AbstractReadOnlyOperator {
+ public:
+  SetOperationHash(const std::shared_ptr<const AbstractOperator>& left_input,
+                   const std::shared_ptr<const AbstractOperator>& right_input,
+                   const SetOperationType set_operation_type, const SetOperationMode set_operation_mode);
+
+  const std::string& name() const override;
+
+  std::string description(DescriptionMode description_mode) const override;
+
+  SetOperationType set_operation_type() const;
+  SetOperationMode set_operation_mode() const;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+  std::shared_ptr<AbstractOperator> _on_deep_copy(
+      const std::shared_ptr<AbstractOperator>& copied_left_input,
+      const std::shared_ptr<AbstractOperator>& copied_right_input,
+      std::unordered_map<const AbstractOperator*, std::shared_ptr<AbstractOperator>>& /*copied_ops*/) const override;
+  void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override;
+
+  const SetOperationType _set_operation_type;
+  const SetOperationMode _set_operation_mode;
+};
+
+}  // namespace hyrise
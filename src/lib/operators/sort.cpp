@@ -1,5 +1,10 @@
 #include "sort.hpp"
 
+#include <bit>
+#include <cstring>
+
+#include "hyrise.hpp"
+#include "scheduler/job_task.hpp"
 #include "storage/segment_iterate.hpp"
 #include "utils/timer.hpp"
 
@@ -225,6 +230,212 @@ std::shared_ptr<Table> write_reference_output_table(const std::shared_ptr<const
   return output_table;
 }
 
+// Runs are sorted independently of each other before they are merged. A run consists of consecutive input chunks.
+struct SortRun {
+  ChunkID begin_chunk_id;
+  ChunkID end_chunk_id;
+  size_t begin_row;
+  size_t end_row;
+};
+
+// A single row during sorting. The first bytes of the row's normalized key are stored inline as an integer, so that
+// most comparisons do not need to access the key buffer.
+struct SortEntry {
+  uint64_t key_prefix;
+  size_t row_index;
+};
+
+constexpr auto KEY_PREFIX_LENGTH = sizeof(SortEntry::key_prefix);
+
+// Number of samples per merge job that are drawn from the runs to determine the splitters of the merge jobs.
+constexpr auto MERGE_SPLITTER_OVERSAMPLING = size_t{8};
+
+// Describes how a sort column is encoded into the normalized key. Each column starts with a NULL marker (only for
+// nullable columns), followed by value_width bytes of the encoded value. Strings are zero-padded and followed by their
+// length, unless they are truncated. A truncated string column is the last column of the normalized key.
+struct NormalizedKeyColumn {
+  ColumnID column_id;
+  DataType data_type;
+  SortMode sort_mode;
+  bool is_nullable;
+  bool is_truncated;
+  size_t offset;
+  size_t value_width;
+};
+
+// The normalized keys of all input rows plus the values needed to order rows whose (truncated) keys are equal.
+struct NormalizedKeys {
+  size_t key_width{0};
+  std::vector<uint8_t> buffer;
+
+  // Full values of the first truncated sort column and all less significant sort columns, indexed by row.
+  std::vector<SortMode> fallback_sort_modes;
+  std::vector<std::vector<AllTypeVariant>> fallback_values;
+};
+
+// Orders SortEntries by their normalized keys. As ties are broken by the row index, i.e., the position of the row in
+// the input table, this is a strict total order and the sort is stable.
+class SortEntryComparator {
+ public:
+  explicit SortEntryComparator(const NormalizedKeys& normalized_keys) : _keys(normalized_keys) {}
+
+  bool operator()(const SortEntry& lhs, const SortEntry& rhs) const {
+    if (lhs.key_prefix != rhs.key_prefix) {
+      return lhs.key_prefix < rhs.key_prefix;
+    }
+
+    if (_keys.key_width > KEY_PREFIX_LENGTH) {
+      const auto* const buffer = _keys.buffer.data();
+      const auto result = std::memcmp(buffer + lhs.row_index * _keys.key_width + KEY_PREFIX_LENGTH,
+                                      buffer + rhs.row_index * _keys.key_width + KEY_PREFIX_LENGTH,
+                                      _keys.key_width - KEY_PREFIX_LENGTH);
+      if (result != 0) {
+        return result < 0;
+      }
+    }
+
+    const auto fallback_column_count = _keys.fallback_values.size();
+    for (auto fallback_column_idx = size_t{0}; fallback_column_idx < fallback_column_count; ++fallback_column_idx) {
+      const auto& values = _keys.fallback_values[fallback_column_idx];
+      const auto& lhs_value = values[lhs.row_index];
+      const auto& rhs_value = values[rhs.row_index];
+
+      // NULLs come first, independent of the sort mode.
+      const auto lhs_is_null = variant_is_null(lhs_value);
+      const auto rhs_is_null = variant_is_null(rhs_value);
+      if (lhs_is_null || rhs_is_null) {
+        if (lhs_is_null && rhs_is_null) {
+          continue;
+        }
+        return lhs_is_null;
+      }
+
+      if (lhs_value == rhs_value) {
+        continue;
+      }
+      const auto is_less = lhs_value < rhs_value;
+      return _keys.fallback_sort_modes[fallback_column_idx] == SortMode::Ascending ? is_less : !is_less;
+    }
+
+    return lhs.row_index < rhs.row_index;
+  }
+
+ private:
+  const NormalizedKeys& _keys;
+};
+
+// Executes function(task_idx) for all tasks. Multiple tasks are executed in parallel as JobTasks, a single task is
+// executed directly.
+template <typename Function>
+void execute_tasks(const size_t task_count, const Function& function) {
+  if (task_count == 1) {
+    function(size_t{0});
+    return;
+  }
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(task_count);
+  for (auto task_idx = size_t{0}; task_idx < task_count; ++task_idx) {
+    jobs.emplace_back(std::make_shared<JobTask>([&function, task_idx] {
+      function(task_idx);
+    }));
+  }
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+}
+
+// Returns an unsigned integer whose order matches the order of the given numeric value.
+template <typename T>
+auto order_preserving_bits(const T value) {
+  if constexpr (std::is_integral_v<T>) {
+    using Unsigned = std::make_unsigned_t<T>;
+    constexpr auto SIGN_BIT = static_cast<Unsigned>(Unsigned{1} << (sizeof(T) * 8 - 1));
+    return static_cast<Unsigned>(static_cast<Unsigned>(value) ^ SIGN_BIT);
+  } else {
+    using Unsigned = std::conditional_t<sizeof(T) == sizeof(uint32_t), uint32_t, uint64_t>;
+    constexpr auto SIGN_BIT = static_cast<Unsigned>(Unsigned{1} << (sizeof(T) * 8 - 1));
+    // -0.0 and 0.0 are equal and have to be encoded identically.
+    const auto bits = std::bit_cast<Unsigned>(value == T{0} ? T{0} : value);
+    return static_cast<Unsigned>((bits & SIGN_BIT) ? ~bits : bits | SIGN_BIT);
+  }
+}
+
+// Writes the normalized key bytes of the given column for all rows of a segment. first_key points to the normalized
+// key of the segment's first row. The key buffer is zero-initialized, so NULLs do not need to be written.
+template <typename ColumnDataType>
+void encode_segment(const AbstractSegment& segment, const NormalizedKeyColumn& key_column, uint8_t* const first_key,
+                    const size_t key_width) {
+  segment_iterate<ColumnDataType>(segment, [&](const auto& position) {
+    auto* key = first_key + static_cast<size_t>(position.chunk_offset()) * key_width + key_column.offset;
+    if (key_column.is_nullable) {
+      if (position.is_null()) {
+        return;
+      }
+      *key = 1;
+      ++key;
+    }
+    DebugAssert(!position.is_null(), "Unexpected NULL value in non-nullable column.");
+
+    auto encoded_width = key_column.value_width;
+    if constexpr (std::is_same_v<ColumnDataType, pmr_string>) {
+      const auto& value = position.value();
+      std::memcpy(key, value.data(), std::min(value.size(), key_column.value_width));
+      if (!key_column.is_truncated) {
+        // Zero padding cannot distinguish "a" from "a\0". If the padded bytes are equal, the shorter string is a prefix
+        // of the longer one and thus smaller.
+        key[key_column.value_width] = static_cast<uint8_t>(value.size());
+        ++encoded_width;
+      }
+    } else {
+      const auto bits = order_preserving_bits(position.value());
+      for (auto byte_idx = size_t{0}; byte_idx < sizeof(bits); ++byte_idx) {
+        key[byte_idx] = static_cast<uint8_t>(bits >> ((sizeof(bits) - 1 - byte_idx) * 8));
+      }
+    }
+
+    if (key_column.sort_mode == SortMode::Descending) {
+      for (auto byte_idx = size_t{0}; byte_idx < encoded_width; ++byte_idx) {
+        key[byte_idx] = static_cast<uint8_t>(~key[byte_idx]);
+      }
+    }
+  });
+}
+
+// Merges the sorted ranges [begin, end) of entries and writes the RowIDs of the merged rows to output_begin.
+void multiway_merge(const std::vector<SortEntry>& entries, std::vector<std::pair<size_t, size_t>>&& ranges,
+                    const SortEntryComparator& less, const std::vector<RowID>& row_ids,
+                    RowIDPosList::iterator output_begin) {
+  std::erase_if(ranges, [](const auto& range) {
+    return range.first == range.second;
+  });
+
+  // Min-heap of the ranges, ordered by their current first entry.
+  const auto heap_comparator = [&](const auto& lhs, const auto& rhs) {
+    return less(entries[rhs.first], entries[lhs.first]);
+  };
+  std::make_heap(ranges.begin(), ranges.end(), heap_comparator);
+
+  auto output_it = output_begin;
+  while (ranges.size() > 1) {
+    std::pop_heap(ranges.begin(), ranges.end(), heap_comparator);
+    auto& range = ranges.back();
+    *output_it = row_ids[entries[range.first].row_index];
+    ++output_it;
+    ++range.first;
+    if (range.first == range.second) {
+      ranges.pop_back();
+    } else {
+      std::push_heap(ranges.begin(), ranges.end(), heap_comparator);
+    }
+  }
+
+  if (!ranges.empty()) {
+    for (auto entry_idx = ranges.front().first; entry_idx < ranges.front().second; ++entry_idx) {
+      *output_it = row_ids[entries[entry_idx].row_index];
+      ++output_it;
+    }
+  }
+}
+
 }  // namespace
 
 namespace hyrise {
@@ -275,46 +486,219 @@ std::shared_ptr<const Table> Sort::_on_execute() {
     return input_table;
   }
 
-  std::shared_ptr<Table> sorted_table;
+  auto& step_performance_data = dynamic_cast<OperatorPerformanceData<OperatorSteps>&>(*performance_data);
+  Timer timer;
 
-  // After the first (least significant) sort operation has been completed, this holds the order of the table as it has
-  // been determined so far. This is not a completely proper PosList on the input table as it might point to
-  // ReferenceSegments.
-  auto previously_sorted_pos_list = std::optional<RowIDPosList>{};
+  // 1. Bundle the input chunks into runs. Small chunks are bundled together to avoid unnecessary scheduling overhead
+  //    (similar to the Validate operator). The rows of all runs are numbered consecutively in the order of the input.
+  const auto input_chunk_count = input_table->chunk_count();
+  auto runs = std::vector<SortRun>{};
+  auto row_count = size_t{0};
+  for (auto chunk_id = ChunkID{0}; chunk_id < input_chunk_count; ++chunk_id) {
+    const auto chunk = input_table->get_chunk(chunk_id);
+    Assert(chunk, "Did not expect deleted chunk here.");  // see https://github.com/hyrise/hyrise/issues/1686
+
+    if (runs.empty() || runs.back().end_row - runs.back().begin_row >= Chunk::DEFAULT_SIZE) {
+      runs.push_back(SortRun{chunk_id, chunk_id, row_count, row_count});
+    }
+    row_count += chunk->size();
+    runs.back().end_chunk_id = ChunkID{chunk_id + 1};
+    runs.back().end_row = row_count;
+  }
+  const auto run_count = runs.size();
+
+  // 2. Determine the layout of the normalized keys. Strings are encoded with the length of the longest string in the
+  //    column, but with at most MAX_STRING_KEY_LENGTH bytes.
+  const auto sort_definition_count = _sort_definitions.size();
+  auto max_string_lengths_by_run = std::vector<std::vector<size_t>>(run_count);
+  const auto has_string_column = std::any_of(_sort_definitions.cbegin(), _sort_definitions.cend(),
+                                             [&](const auto& sort_definition) {
+                                               return input_table->column_data_type(sort_definition.column) ==
+                                                      DataType::String;
+                                             });
+  if (has_string_column) {
+    execute_tasks(run_count, [&](const size_t run_idx) {
+      const auto& run = runs[run_idx];
+      auto& max_string_lengths = max_string_lengths_by_run[run_idx];
+      max_string_lengths.resize(sort_definition_count);
+      for (auto definition_idx = size_t{0}; definition_idx < sort_definition_count; ++definition_idx) {
+        const auto column_id = _sort_definitions[definition_idx].column;
+        if (input_table->column_data_type(column_id) != DataType::String) {
+          continue;
+        }
 
-  auto total_materialization_time = std::chrono::nanoseconds{};
-  auto total_temporary_result_writing_time = std::chrono::nanoseconds{};
-  auto total_sort_time = std::chrono::nanoseconds{};
+        for (auto chunk_id = run.begin_chunk_id; chunk_id < run.end_chunk_id; ++chunk_id) {
+          const auto& segment = *input_table->get_chunk(chunk_id)->get_segment(column_id);
+          segment_iterate<pmr_string>(segment, [&](const auto& position) {
+            if (!position.is_null()) {
+              max_string_lengths[definition_idx] =
+                  std::max(max_string_lengths[definition_idx], position.value().size());
+            }
+          });
+        }
+      }
+    });
+  }
 
-  for (auto sort_step = static_cast<int64_t>(_sort_definitions.size() - 1); sort_step >= 0; --sort_step) {
-    const auto& sort_definition = _sort_definitions[sort_step];
+  auto normalized_keys = NormalizedKeys{};
+  auto key_columns = std::vector<NormalizedKeyColumn>{};
+  auto fallback_begin = sort_definition_count;
+  for (auto definition_idx = size_t{0}; definition_idx < sort_definition_count; ++definition_idx) {
+    const auto& sort_definition = _sort_definitions[definition_idx];
     const auto data_type = input_table->column_data_type(sort_definition.column);
+    auto key_column = NormalizedKeyColumn{sort_definition.column,
+                                          data_type,
+                                          sort_definition.sort_mode,
+                                          input_table->column_is_nullable(sort_definition.column),
+                                          false,
+                                          normalized_keys.key_width,
+                                          size_t{0}};
+
+    if (data_type == DataType::String) {
+      auto max_string_length = size_t{0};
+      for (const auto& max_string_lengths : max_string_lengths_by_run) {
+        max_string_length = std::max(max_string_length, max_string_lengths[definition_idx]);
+      }
+      key_column.is_truncated = max_string_length > MAX_STRING_KEY_LENGTH;
+      key_column.value_width = std::min(max_string_length, MAX_STRING_KEY_LENGTH);
+    } else {
+      resolve_data_type(data_type, [&](auto type) {
+        key_column.value_width = sizeof(typename decltype(type)::type);
+      });
+    }
 
-    resolve_data_type(data_type, [&](auto type) {
-      using ColumnDataType = typename decltype(type)::type;
+    normalized_keys.key_width += (key_column.is_nullable ? 1 : 0) + key_column.value_width +
+                                 (data_type == DataType::String && !key_column.is_truncated ? 1 : 0);
+    key_columns.push_back(key_column);
 
-      auto sort_impl = SortImpl<ColumnDataType>(input_table, sort_definition.column, sort_definition.sort_mode);
-      previously_sorted_pos_list = sort_impl.sort(previously_sorted_pos_list);
+    // Less significant columns cannot be part of the key, as they must only be compared if the full values of the
+    // truncated column are equal.
+    if (key_column.is_truncated) {
+      fallback_begin = definition_idx;
+      break;
+    }
+  }
 
-      total_materialization_time += sort_impl.materialization_time;
-      total_temporary_result_writing_time += sort_impl.temporary_result_writing_time;
-      total_sort_time += sort_impl.sort_time;
-    });
+  for (auto definition_idx = fallback_begin; definition_idx < sort_definition_count; ++definition_idx) {
+    normalized_keys.fallback_sort_modes.push_back(_sort_definitions[definition_idx].sort_mode);
+    normalized_keys.fallback_values.emplace_back(row_count);
   }
 
-  auto& step_performance_data = dynamic_cast<OperatorPerformanceData<OperatorSteps>&>(*performance_data);
-  step_performance_data.set_step_runtime(OperatorSteps::MaterializeSortColumns, total_materialization_time);
-  step_performance_data.set_step_runtime(OperatorSteps::TemporaryResultWriting, total_temporary_result_writing_time);
-  step_performance_data.set_step_runtime(OperatorSteps::Sort, total_sort_time);
+  // 3. Materialize the normalized keys, the RowIDs, and the fallback values.
+  normalized_keys.buffer.resize(row_count * normalized_keys.key_width);
+  auto entries = std::vector<SortEntry>(row_count);
+  auto row_ids = std::vector<RowID>(row_count);
+  execute_tasks(run_count, [&](const size_t run_idx) {
+    const auto& run = runs[run_idx];
+    const auto key_width = normalized_keys.key_width;
+    auto row_index = run.begin_row;
+    for (auto chunk_id = run.begin_chunk_id; chunk_id < run.end_chunk_id; ++chunk_id) {
+      const auto chunk = input_table->get_chunk(chunk_id);
+      const auto chunk_row_index = row_index;
+      auto* const first_key = normalized_keys.buffer.data() + chunk_row_index * key_width;
+
+      for (const auto& key_column : key_columns) {
+        resolve_data_type(key_column.data_type, [&](auto type) {
+          using ColumnDataType = typename decltype(type)::type;
+          encode_segment<ColumnDataType>(*chunk->get_segment(key_column.column_id), key_column, first_key, key_width);
+        });
+      }
+
+      const auto chunk_size = chunk->size();
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+        const auto* const key = first_key + static_cast<size_t>(chunk_offset) * key_width;
+        auto key_prefix = uint64_t{0};
+        for (auto byte_idx = size_t{0}; byte_idx < KEY_PREFIX_LENGTH; ++byte_idx) {
+          key_prefix <<= 8u;
+          if (byte_idx < key_width) {
+            key_prefix |= key[byte_idx];
+          }
+        }
+        entries[row_index] = SortEntry{key_prefix, row_index};
+        row_ids[row_index] = RowID{chunk_id, chunk_offset};
+        ++row_index;
+      }
+
+      for (auto definition_idx = fallback_begin; definition_idx < sort_definition_count; ++definition_idx) {
+        const auto column_id = _sort_definitions[definition_idx].column;
+        auto& values = normalized_keys.fallback_values[definition_idx - fallback_begin];
+        resolve_data_type(input_table->column_data_type(column_id), [&](auto type) {
+          using ColumnDataType = typename decltype(type)::type;
+          segment_iterate<ColumnDataType>(*chunk->get_segment(column_id), [&](const auto& position) {
+            values[chunk_row_index + position.chunk_offset()] =
+                position.is_null() ? NULL_VALUE : AllTypeVariant{position.value()};
+          });
+        });
+      }
+    }
+  });
+  step_performance_data.set_step_runtime(OperatorSteps::MaterializeSortColumns, timer.lap());
+
+  // 4. Sort the runs.
+  const auto less = SortEntryComparator{normalized_keys};
+  execute_tasks(run_count, [&](const size_t run_idx) {
+    const auto& run = runs[run_idx];
+    std::sort(entries.begin() + static_cast<std::ptrdiff_t>(run.begin_row),
+              entries.begin() + static_cast<std::ptrdiff_t>(run.end_row), less);
+  });
+  step_performance_data.set_step_runtime(OperatorSteps::Sort, timer.lap());
+
+  // 5. Merge the sorted runs. To parallelize the merge, we sample splitters from the runs. Merge job i writes all rows
+  //    between splitter i - 1 (inclusive) and splitter i (exclusive). Its output position is the number of smaller
+  //    rows, i.e., the sum of the splitter's positions within all runs.
+  auto pos_list = RowIDPosList(row_count);
+  const auto merge_job_count =
+      run_count == 1 ? size_t{1} : (row_count + MIN_ROWS_PER_MERGE_JOB - 1) / MIN_ROWS_PER_MERGE_JOB;
+  auto splitters = std::vector<SortEntry>{};
+  if (merge_job_count > 1) {
+    for (const auto& run : runs) {
+      const auto run_size = run.end_row - run.begin_row;
+      if (run_size == 0) {
+        continue;
+      }
+      const auto sample_count =
+          std::max(size_t{1}, MERGE_SPLITTER_OVERSAMPLING * merge_job_count * run_size / row_count);
+      for (auto sample_idx = size_t{1}; sample_idx <= sample_count; ++sample_idx) {
+        splitters.push_back(entries[run.begin_row + sample_idx * run_size / (sample_count + 1)]);
+      }
+    }
+    std::sort(splitters.begin(), splitters.end(), less);
+
+    auto samples = std::move(splitters);
+    splitters = std::vector<SortEntry>(merge_job_count - 1);
+    for (auto splitter_idx = size_t{0}; splitter_idx < merge_job_count - 1; ++splitter_idx) {
+      splitters[splitter_idx] = samples[(splitter_idx + 1) * samples.size() / merge_job_count];
+    }
+  }
+
+  execute_tasks(merge_job_count, [&](const size_t merge_job_idx) {
+    const auto run_position = [&](const SortRun& run, const size_t splitter_idx) {
+      return static_cast<size_t>(std::lower_bound(entries.begin() + static_cast<std::ptrdiff_t>(run.begin_row),
+                                                  entries.begin() + static_cast<std::ptrdiff_t>(run.end_row),
+                                                  splitters[splitter_idx], less) -
+                                 entries.begin());
+    };
+
+    auto ranges = std::vector<std::pair<size_t, size_t>>{};
+    ranges.reserve(run_count);
+    auto output_offset = size_t{0};
+    for (const auto& run : runs) {
+      const auto begin = merge_job_idx == 0 ? run.begin_row : run_position(run, merge_job_idx - 1);
+      const auto end = merge_job_idx == merge_job_count - 1 ? run.end_row : run_position(run, merge_job_idx);
+      ranges.emplace_back(begin, end);
+      output_offset += begin - run.begin_row;
+    }
+    multiway_merge(entries, std::move(ranges), less, row_ids,
+                   pos_list.begin() + static_cast<std::ptrdiff_t>(output_offset));
+  });
+  step_performance_data.set_step_runtime(OperatorSteps::Merge, timer.lap());
 
   // We have to materialize the output (i.e., write ValueSegments) if
   //  (a) it is requested by the user,
   //  (b) a column in the table references multiple tables (see write_reference_output_table for details), or
   //  (c) a column in the table references multiple columns in the same table (which is an unlikely edge case).
   // Cases (b) and (c) can only occur if there is more than one ReferenceSegment in an input chunk.
-  Timer timer;
   auto must_materialize = _force_materialization == ForceMaterialization::Yes;
-  const auto input_chunk_count = input_table->chunk_count();
   if (!must_materialize && input_table->type() == TableType::References && input_chunk_count > 1) {
     const auto input_column_count = input_table->column_count();
 
@@ -341,17 +725,15 @@ std::shared_ptr<const Table> Sort::_on_execute() {
     }
   }
 
+  auto sorted_table = std::shared_ptr<Table>{};
   if (must_materialize) {
-    sorted_table =
-        write_materialized_output_table(input_table, std::move(*previously_sorted_pos_list), _output_chunk_size);
+    sorted_table = write_materialized_output_table(input_table, std::move(pos_list), _output_chunk_size);
   } else {
-    sorted_table =
-        write_reference_output_table(input_table, std::move(*previously_sorted_pos_list), _output_chunk_size);
+    sorted_table = write_reference_output_table(input_table, std::move(pos_list), _output_chunk_size);
   }
 
   const auto& final_sort_definition = _sort_definitions[0];
-  // Set the sorted_by attribute of the output's chunks according to the most significant sort operation, which is the
-  // column the table was sorted by last.
+  // Set the sorted_by attribute of the output's chunks according to the most significant sort column.
   const auto output_chunk_count = sorted_table->chunk_count();
   for (auto output_chunk_id = ChunkID{0}; output_chunk_id < output_chunk_count; ++output_chunk_id) {
     const auto& output_chunk = sorted_table->get_chunk(output_chunk_id);
@@ -363,126 +745,4 @@ std::shared_ptr<const Table> Sort::_on_execute() {
   return sorted_table;
 }
 
-template <typename SortColumnType>
-class Sort::SortImpl {
- public:
-  using RowIDValuePair = std::pair<RowID, SortColumnType>;
-
-  std::chrono::nanoseconds materialization_time{};
-  std::chrono::nanoseconds temporary_result_writing_time{};
-  std::chrono::nanoseconds sort_time{};
-
-  SortImpl(const std::shared_ptr<const Table>& table_in, const ColumnID column_id,
-           const SortMode sort_mode = SortMode::Ascending)
-      : _table_in(table_in), _column_id(column_id), _sort_mode(sort_mode) {
-    const auto row_count = _table_in->row_count();
-    _row_id_value_vector.reserve(row_count);
-    _null_value_rows.reserve(row_count);
-  }
-
-  // Sorts table_in, potentially taking the pre-existing order of previously_sorted_pos_list into account.
-  // Returns a PosList, which can either be used as an input to the next call of sort or for materializing the
-  // output table.
-  RowIDPosList sort(const std::optional<RowIDPosList>& previously_sorted_pos_list) {
-    Timer timer;
-    // 1. Prepare Sort: Creating RowID-value-Structure
-    _materialize_sort_column(previously_sorted_pos_list);
-    materialization_time = timer.lap();
-
-    // 2. After we got our ValueRowID Map we sort the map by the value of the pair
-    const auto sort_with_comparator = [&](auto comparator) {
-      std::stable_sort(
-          _row_id_value_vector.begin(), _row_id_value_vector.end(),
-          [comparator](RowIDValuePair lhs, RowIDValuePair rhs) { return comparator(lhs.second, rhs.second); });
-    };
-    if (_sort_mode == SortMode::Ascending) {
-      sort_with_comparator(std::less<>{});
-    } else {
-      sort_with_comparator(std::greater<>{});
-    }
-    sort_time = timer.lap();
-
-    // 2b. Insert null rows in front of all non-NULL rows
-    if (!_null_value_rows.empty()) {
-      // NULLs come before all values. The SQL standard allows for this to be implementation-defined. We used to have
-      // a NULLS LAST mode, but never used it over multiple years. Different databases have different behaviors, and
-      // storing NULLs first even for descending orders is somewhat uncommon:
-      //   https://docs.mendix.com/refguide/ordering-behavior#null-ordering-behavior
-      // For Hyrise, we found that storing NULLs first is the method that requires the least amount of code.
-      _row_id_value_vector.insert(_row_id_value_vector.begin(), _null_value_rows.begin(), _null_value_rows.end());
-    }
-
-    RowIDPosList pos_list{};
-    pos_list.reserve(_row_id_value_vector.size());
-    for (const auto& [row_id, _] : _row_id_value_vector) {
-      pos_list.emplace_back(row_id);
-    }
-    temporary_result_writing_time = timer.lap();
-    return pos_list;
-  }
-
- protected:
-  // completely materializes the sort column to create a vector of RowID-Value pairs
-  void _materialize_sort_column(const std::optional<RowIDPosList>& previously_sorted_pos_list) {
-    // If there was no PosList passed, this is the first sorting run and we simply fill our values and nulls data
-    // structures from our input table. Otherwise we will materialize according to the PosList which is the result of
-    // the last run.
-    if (previously_sorted_pos_list) {
-      _materialize_column_from_pos_list(*previously_sorted_pos_list);
-    } else {
-      const auto chunk_count = _table_in->chunk_count();
-      for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
-        const auto chunk = _table_in->get_chunk(chunk_id);
-        Assert(chunk, "Did not expect deleted chunk here.");  // see https://github.com/hyrise/hyrise/issues/1686
-
-        auto abstract_segment = chunk->get_segment(_column_id);
-
-        segment_iterate<SortColumnType>(*abstract_segment, [&](const auto& position) {
-          if (position.is_null()) {
-            _null_value_rows.emplace_back(RowID{chunk_id, position.chunk_offset()}, SortColumnType{});
-          } else {
-            _row_id_value_vector.emplace_back(RowID{chunk_id, position.chunk_offset()}, position.value());
-          }
-        });
-      }
-    }
-  }
-
-  // When there was a preceding sorting run, we materialize by retaining the order of the values in the passed PosList.
-  void _materialize_column_from_pos_list(const RowIDPosList& pos_list) {
-    const auto input_chunk_count = _table_in->chunk_count();
-    auto accessor_by_chunk_id =
-        std::vector<std::unique_ptr<AbstractSegmentAccessor<SortColumnType>>>(input_chunk_count);
-    for (auto input_chunk_id = ChunkID{0}; input_chunk_id < input_chunk_count; ++input_chunk_id) {
-      const auto& abstract_segment = _table_in->get_chunk(input_chunk_id)->get_segment(_column_id);
-      accessor_by_chunk_id[input_chunk_id] = create_segment_accessor<SortColumnType>(abstract_segment);
-    }
-
-    for (auto row_id : pos_list) {
-      const auto [chunk_id, chunk_offset] = row_id;
-
-      auto& accessor = accessor_by_chunk_id[chunk_id];
-      const auto typed_value = accessor->access(chunk_offset);
-      if (!typed_value) {
-        _null_value_rows.emplace_back(row_id, SortColumnType{});
-      } else {
-        _row_id_value_vector.emplace_back(row_id, typed_value.value());
-      }
-    }
-  }
-
-  // NOLINTBEGIN(cppcoreguidelines-avoid-const-or-ref-data-members)
-  const std::shared_ptr<const Table> _table_in;
-
-  // Column to sort by.
-  const ColumnID _column_id;
-  const SortMode _sort_mode;
-  // NOLINTEND(cppcoreguidelines-avoid-const-or-ref-data-members)
-
-  std::vector<RowIDValuePair> _row_id_value_vector;
-
-  // Stored as RowIDValuePair for better type compatibility even if value is unused.
-  std::vector<RowIDValuePair> _null_value_rows;
-};
-
 }  // namespace hyrise
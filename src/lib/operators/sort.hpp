@@ -18,12 +18,29 @@ namespace hyrise {
  * Operator to sort a table by one or multiple columns. This implements a stable sort, i.e., rows that share the same
  * value will maintain their relative order.
  * By passing multiple sort column definitions it is possible to sort multiple columns with one operator run.
+ *
+ * All sort columns are sorted in a single pass using normalized keys: the values of a row are encoded into a byte
+ * string whose byte-wise order equals the requested order (including NULLs first and descending columns). Sorting
+ * happens in three steps, each of which is parallelized using JobTasks:
+ *   (i)   The input chunks are bundled into runs of at least Chunk::DEFAULT_SIZE rows and the normalized keys of each
+ *         run are materialized.
+ *   (ii)  Each run is sorted independently.
+ *   (iii) The sorted runs are combined with a multiway merge. The output is split into ranges using splitters sampled
+ *         from the runs, so that each range can be merged by a separate JobTask.
+ * Strings longer than MAX_STRING_KEY_LENGTH are truncated in the normalized key. Rows with equal truncated keys are
+ * ordered by comparing the full values of this column and of all less significant sort columns.
  */
 class Sort : public AbstractReadOnlyOperator {
  public:
   enum class ForceMaterialization : bool { Yes = true, No = false };
 
-  enum class OperatorSteps : uint8_t { MaterializeSortColumns, Sort, TemporaryResultWriting, WriteOutput };
+  enum class OperatorSteps : uint8_t { MaterializeSortColumns, Sort, Merge, WriteOutput };
+
+  // Maximum number of bytes of a string value that are encoded into the normalized key.
+  static constexpr auto MAX_STRING_KEY_LENGTH = size_t{32};
+
+  // Minimum number of output rows per merge job.
+  static constexpr auto MIN_ROWS_PER_MERGE_JOB = size_t{65'535};
 
   Sort(const std::shared_ptr<const AbstractOperator>& input_operator,
        const std::vector<SortColumnDefinition>& sort_definitions,
@@ -42,12 +59,6 @@ class Sort : public AbstractReadOnlyOperator {
       std::unordered_map<const AbstractOperator*, std::shared_ptr<AbstractOperator>>& /*copied_ops*/) const override;
   void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override;
 
-  template <typename SortColumnType>
-  class SortImpl;
-
-  template <typename SortColumnType>
-  class SortImplMaterializeOutput;
-
   const std::vector<SortColumnDefinition> _sort_definitions;
   const ChunkOffset _output_chunk_size;
   const ForceMaterialization _force_materialization;
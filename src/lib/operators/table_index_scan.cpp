@@ -0,0 +1,142 @@
+#include "table_index_scan.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "hyrise.hpp"
+#include "lossless_cast.hpp"
+#include "storage/index/partial_hash/partial_hash_index.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace hyrise {
+
+TableIndexScan::TableIndexScan(const std::string& table_name, const ColumnID column_id, const AllTypeVariant& value,
+                               const std::vector<ColumnID>& pruned_column_ids)
+    : AbstractReadOnlyOperator(OperatorType::TableIndexScan),
+      _table_name(table_name),
+      _column_id(column_id),
+      _value(value),
+      _pruned_column_ids(pruned_column_ids) {
+  DebugAssert(std::is_sorted(_pruned_column_ids.cbegin(), _pruned_column_ids.cend()),
+              "Expected sorted vector of ColumnIDs.");
+  Assert(!variant_is_null(_value), "TableIndexScan cannot look up NULL values.");
+}
+
+const std::string& TableIndexScan::name() const {
+  static const auto name = std::string{"TableIndexScan"};
+  return name;
+}
+
+std::string TableIndexScan::description(DescriptionMode description_mode) const {
+  const auto separator = (description_mode == DescriptionMode::SingleLine ? ' ' : '\n');
+
+  auto stream = std::stringstream{};
+  stream << AbstractOperator::description(description_mode) << separator << "(" << _table_name << ")";
+  stream << separator << "Column #" << _column_id << " = " << _value;
+  stream << separator << "included chunks: " << included_chunk_ids.size();
+  return stream.str();
+}
+
+const std::string& TableIndexScan::table_name() const {
+  return _table_name;
+}
+
+ColumnID TableIndexScan::column_id() const {
+  return _column_id;
+}
+
+const AllTypeVariant& TableIndexScan::value() const {
+  return _value;
+}
+
+const std::vector<ColumnID>& TableIndexScan::pruned_column_ids() const {
+  return _pruned_column_ids;
+}
+
+std::shared_ptr<const Table> TableIndexScan::_on_execute() {
+  DebugAssert(std::is_sorted(included_chunk_ids.cbegin(), included_chunk_ids.cend()),
+              "Expected sorted vector of ChunkIDs.");
+
+  const auto stored_table = Hyrise::get().storage_manager.get_table(_table_name);
+  const auto table_indexes = stored_table->get_table_indexes(_column_id);
+  Assert(!table_indexes.empty(), "Did not find a table index on column #" + std::to_string(_column_id) + " of table '" +
+                                     _table_name + "'.");
+
+  // The index is typed by the column's data type, which might differ from the value's (e.g., an int literal for a long
+  // column). If the value cannot be represented in the column's data type, no row can match.
+  auto matches = RowIDPosList{};
+  const auto column_value = lossless_variant_cast(_value, stored_table->column_data_type(_column_id));
+  if (column_value) {
+    table_indexes.front()->range_equals_with_iterators(
+        [&](auto begin, const auto end) {
+          std::copy_if(begin, end, std::back_inserter(matches), [&](const RowID& row_id) {
+            return std::binary_search(included_chunk_ids.cbegin(), included_chunk_ids.cend(), row_id.chunk_id);
+          });
+        },
+        *column_value);
+    std::sort(matches.begin(), matches.end());
+  }
+
+  // Determine the non-pruned columns and their definitions.
+  auto output_column_ids = std::vector<ColumnID>{};
+  auto output_column_definitions = TableColumnDefinitions{};
+  auto pruned_column_ids_iter = _pruned_column_ids.cbegin();
+  const auto column_count = stored_table->column_count();
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    if (pruned_column_ids_iter != _pruned_column_ids.cend() && column_id == *pruned_column_ids_iter) {
+      ++pruned_column_ids_iter;
+      continue;
+    }
+    output_column_ids.emplace_back(column_id);
+    output_column_definitions.emplace_back(stored_table->column_definitions()[column_id]);
+  }
+
+  const auto output_table = std::make_shared<Table>(output_column_definitions, TableType::References);
+
+  // Emit one output chunk per referenced chunk so that the position lists reference a single chunk each.
+  const auto match_count = matches.size();
+  auto range_begin = size_t{0};
+  while (range_begin < match_count) {
+    const auto chunk_id = matches[range_begin].chunk_id;
+    auto range_end = range_begin + 1;
+    while (range_end < match_count && matches[range_end].chunk_id == chunk_id) {
+      ++range_end;
+    }
+
+    // The chunk might have been physically deleted after it was indexed.
+    if (stored_table->get_chunk(chunk_id)) {
+      const auto pos_list =
+          std::make_shared<RowIDPosList>(matches.cbegin() + range_begin, matches.cbegin() + range_end);
+      pos_list->guarantee_single_chunk();
+
+      auto segments = Segments{};
+      segments.reserve(output_column_ids.size());
+      for (const auto column_id : output_column_ids) {
+        segments.emplace_back(std::make_shared<ReferenceSegment>(stored_table, column_id, pos_list));
+      }
+      output_table->append_chunk(segments);
+    }
+
+    range_begin = range_end;
+  }
+
+  return output_table;
+}
+
+std::shared_ptr<AbstractOperator> TableIndexScan::_on_deep_copy(
+    const std::shared_ptr<AbstractOperator>& /*copied_left_input*/,
+    const std::shared_ptr<AbstractOperator>& /*copied_right_input*/,
+    std::unordered_map<const AbstractOperator*, std::shared_ptr<AbstractOperator>>& /*copied_ops*/) const {
+  const auto copy = std::make_shared<TableIndexScan>(_table_name, _column_id, _value, _pruned_column_ids);
+  copy->included_chunk_ids = included_chunk_ids;
+  return copy;
+}
+
+void TableIndexScan::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {}
+
+}  // namespace hyrise
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "abstract_read_only_operator.hpp"
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace hyrise {
+
+/**
+ * Operator that looks up all rows of a stored table whose value in a column equals a given value using the table
+ * index (see Table::create_table_index) on that column. As the RowIDs of a table index refer to the stored table, the
+ * operator has no input but directly accesses the table, similar to GetTable. The output references the stored table
+ * and contains all of its columns except for the pruned ones.
+ *
+ * Only matches in included_chunk_ids are emitted. The chunks that a table index covers grow while the table is
+ * modified. To avoid emitting rows twice, the LQPTranslator fixes the indexed chunks when it translates the plan and
+ * scans the remaining chunks with a TableScan.
+ */
+class TableIndexScan : public AbstractReadOnlyOperator {
+ public:
+  TableIndexScan(const std::string& table_name, const ColumnID column_id, const AllTypeVariant& value,
+                 const std::vector<ColumnID>& pruned_column_ids = {});
+
+  const std::string& name() const override;
+  std::string description(DescriptionMode description_mode) const override;
+
+  const std::string& table_name() const;
+  ColumnID column_id() const;
+  const AllTypeVariant& value() const;
+  const std::vector<ColumnID>& pruned_column_ids() const;
+
+  // Sorted IDs of the chunks (of the stored table) whose matches are emitted.
+  std::vector<ChunkID> included_chunk_ids;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  std::shared_ptr<AbstractOperator> _on_deep_copy(
+      const std::shared_ptr<AbstractOperator>& /*copied_left_input*/,
+      const std::shared_ptr<AbstractOperator>& /*copied_right_input*/,
+      std::unordered_map<const AbstractOperator*, std::shared_ptr<AbstractOperator>>& /*copied_ops*/) const override;
+  void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override;
+
+  const std::string _table_name;
+  const ColumnID _column_id;
+  const AllTypeVariant _value;
+  const std::vector<ColumnID> _pruned_column_ids;
+};
+
+}  // namespace hyrise
@@ -23,6 +23,7 @@
 #include "lossless_cast.hpp"
 #include "operators/operator_scan_predicate.hpp"
 #include "operators/pqp_utils.hpp"
+#include "operators/runtime_filter.hpp"
 #include "scheduler/abstract_task.hpp"
 #include "scheduler/job_task.hpp"
 #include "storage/abstract_segment.hpp"
@@ -97,6 +98,14 @@ std::shared_ptr<const Table> TableScan::_on_execute() {
 
   const auto excluded_chunk_set = std::unordered_set<ChunkID>{excluded_chunk_ids.cbegin(), excluded_chunk_ids.cend()};
 
+  // Runtime filters can only be used if the output of their build operator is available, see RuntimeFilter.
+  auto built_runtime_filters = std::vector<std::pair<std::shared_ptr<RuntimeFilter>, ColumnID>>{};
+  for (const auto& runtime_filter : runtime_filters) {
+    if (runtime_filter.first->try_build()) {
+      built_runtime_filters.emplace_back(runtime_filter);
+    }
+  }
+
   auto output_chunks = std::vector<std::shared_ptr<Chunk>>{};
   output_chunks.reserve(in_table->chunk_count() - excluded_chunk_set.size());
 
@@ -112,9 +121,26 @@ std::shared_ptr<const Table> TableScan::_on_execute() {
     Assert(chunk_in, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
 
     // chunk_in – Copy by value since copy by reference is not possible due to the limited scope of the for-iteration.
-    auto perform_table_scan = [this, chunk_id, chunk_in, &in_table, &output_mutex, &output_chunks]() {
+    auto perform_table_scan = [this, chunk_id, chunk_in, &in_table, &built_runtime_filters, &output_mutex,
+                               &output_chunks]() {
       // The actual scan happens in the sub classes of BaseTableScanImpl
-      const auto matches_out = _impl->scan_chunk(chunk_id);
+      auto matches_out = _impl->scan_chunk(chunk_id);
+
+      // Drop the matches that cannot find a join partner on the build side of a runtime filter.
+      if (in_table->type() == TableType::Data) {
+        matches_out->guarantee_single_chunk();
+      }
+      for (const auto& runtime_filter : built_runtime_filters) {
+        if (matches_out->empty()) {
+          break;
+        }
+
+        const auto& segment = *chunk_in->get_segment(runtime_filter.second);
+        if (auto filtered_matches = runtime_filter.first->filter(segment, matches_out)) {
+          matches_out = std::move(filtered_matches);
+        }
+      }
+
       if (matches_out->empty()) {
         return;
       }
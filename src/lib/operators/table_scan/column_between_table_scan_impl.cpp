@@ -8,9 +8,11 @@
 #include "sorted_segment_search.hpp"
 #include "storage/chunk.hpp"
 #include "storage/create_iterable_from_segment.hpp"
+#include "storage/pos_lists/entire_chunk_pos_list.hpp"
 #include "storage/segment_iterables/create_iterable_from_attribute_vector.hpp"
 #include "storage/segment_iterate.hpp"
 #include "storage/table.hpp"
+#include "value_id_scan_kernels.hpp"
 
 #include "utils/assert.hpp"
 
@@ -107,6 +109,12 @@ void ColumnBetweenTableScanImpl::_scan_dictionary_segment(
     upper_bound_value_id = segment.lower_bound(right_value);
   }
 
+  // If the entire attribute vector is scanned, the value IDs are compared by the SIMD kernels (see
+  // value_id_scan_kernels.hpp) instead of through the iterators.
+  const auto scans_entire_segment =
+      !position_filter || (dynamic_cast<const EntireChunkPosList*>(position_filter.get()) &&
+                           position_filter->size() == segment.size());
+
   auto attribute_vector_iterable = create_iterable_from_attribute_vector(segment);
 
   /**
@@ -114,7 +122,11 @@ void ColumnBetweenTableScanImpl::_scan_dictionary_segment(
    */
   // NOLINTNEXTLINE - cpplint is drunk
   if (lower_bound_value_id == ValueID{0} && upper_bound_value_id == INVALID_VALUE_ID) {
-    if (_column_is_nullable) {
+    if (_column_is_nullable && scans_entire_segment) {
+      // We still have to check for NULLs, i.e., value IDs in [0, null_value_id) match.
+      scan_value_id_range(*segment.attribute_vector(), ValueID{0}, segment.null_value_id(), false,
+                          segment.null_value_id(), chunk_id, matches);
+    } else if (_column_is_nullable) {
       // We still have to check for NULLs
       attribute_vector_iterable.with_iterators(position_filter, [&](auto left_it, auto left_end) {
         static const auto always_true = [](const auto&) { return true; };
@@ -163,6 +175,12 @@ void ColumnBetweenTableScanImpl::_scan_dictionary_segment(
     upper_bound_value_id = segment.unique_values_count();
   }
 
+  if (scans_entire_segment) {
+    scan_value_id_range(*segment.attribute_vector(), lower_bound_value_id, upper_bound_value_id, false,
+                        segment.null_value_id(), chunk_id, matches);
+    return;
+  }
+
   const auto value_id_diff = upper_bound_value_id - lower_bound_value_id;
   const auto comparator = [lower_bound_value_id, value_id_diff](const auto& position) {
     // Using < here because the right value id is the upper_bound. Also, because the value ids are integers, we can do
@@ -7,9 +7,11 @@
 #include "sorted_segment_search.hpp"
 #include "storage/base_dictionary_segment.hpp"
 #include "storage/create_iterable_from_segment.hpp"
+#include "storage/pos_lists/entire_chunk_pos_list.hpp"
 #include "storage/resolve_encoded_segment_type.hpp"
 #include "storage/segment_iterables/create_iterable_from_attribute_vector.hpp"
 #include "storage/segment_iterate.hpp"
+#include "value_id_scan_kernels.hpp"
 
 #include "resolve_type.hpp"
 #include "type_comparison.hpp"
@@ -111,10 +113,20 @@ void ColumnVsValueTableScanImpl::_scan_dictionary_segment(
    * column >= value | search_vid == 0                                        | search_vid == INVALID_VALUE_ID
    */
 
+  // If the entire attribute vector is scanned, the value IDs are compared by the SIMD kernels (see
+  // value_id_scan_kernels.hpp) instead of through the iterators.
+  const auto scans_entire_segment =
+      !position_filter || (dynamic_cast<const EntireChunkPosList*>(position_filter.get()) &&
+                           position_filter->size() == segment.size());
+
   auto iterable = create_iterable_from_attribute_vector(segment);
 
   if (_value_matches_all(segment, search_value_id)) {
-    if (_column_is_nullable) {
+    if (_column_is_nullable && scans_entire_segment) {
+      // We still have to check for NULLs, i.e., value IDs in [0, null_value_id) match.
+      scan_value_id_range(*segment.attribute_vector(), ValueID{0}, segment.null_value_id(), false,
+                          segment.null_value_id(), chunk_id, matches);
+    } else if (_column_is_nullable) {
       // We still have to check for NULLs
       iterable.with_iterators(position_filter, [&](auto it, auto end) {
         static const auto always_true = [](const auto&) { return true; };
@@ -150,6 +162,39 @@ void ColumnVsValueTableScanImpl::_scan_dictionary_segment(
     return;
   }
 
+  if (scans_entire_segment) {
+    // Express the predicate as a (possibly negated) range of value IDs, see the table above.
+    auto lower_value_id = ValueID{0};
+    auto upper_value_id = segment.null_value_id();
+    auto negate = false;
+    switch (predicate_condition) {
+      case PredicateCondition::NotEquals:
+        negate = true;
+        [[fallthrough]];
+      case PredicateCondition::Equals:
+        lower_value_id = search_value_id;
+        upper_value_id = ValueID{static_cast<ValueID::base_type>(search_value_id + 1)};
+        break;
+
+      case PredicateCondition::LessThan:
+      case PredicateCondition::LessThanEquals:
+        upper_value_id = search_value_id;
+        break;
+
+      case PredicateCondition::GreaterThan:
+      case PredicateCondition::GreaterThanEquals:
+        lower_value_id = search_value_id;
+        break;
+
+      default:
+        Fail("Unsupported comparison type encountered");
+    }
+
+    scan_value_id_range(*segment.attribute_vector(), lower_value_id, upper_value_id, negate, segment.null_value_id(),
+                        chunk_id, matches);
+    return;
+  }
+
   _with_operator_for_dict_segment_scan([&](auto predicate_comparator) {
     auto comparator = [predicate_comparator, search_value_id](const auto& position) {
       return predicate_comparator(position.value(), search_value_id);
@@ -0,0 +1,275 @@
+#include "value_id_scan_kernels.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstring>
+#include <type_traits>
+
+#if defined(__x86_64__)
+#include <immintrin.h>
+#endif
+
+#include "storage/vector_compression/resolve_compressed_vector_type.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace hyrise;  // NOLINT
+
+// Number of value IDs that are scanned before the matches are appended to the output. The buffers of a block fit into
+// the L1 cache.
+constexpr auto BLOCK_SIZE = size_t{1024};
+
+// The AVX2 kernel always stores a full register of offsets, even if only some of them are matches.
+constexpr auto OFFSET_BUFFER_SLACK = size_t{8};
+
+struct ValueIDRange {
+  uint32_t lower;
+  // Number of value IDs in the range. By subtracting `lower` first, the range check becomes a single unsigned
+  // comparison, as value IDs below `lower` wrap around to large values.
+  uint32_t width;
+  uint32_t null_value_id;
+  bool negate;
+
+  bool matches(const uint32_t value_id) const {
+    return ((value_id - lower < width) != negate) && value_id < null_value_id;
+  }
+};
+
+template <typename ValueIDType>
+size_t scan_block_scalar(const ValueIDType* value_ids, const size_t count, const uint32_t first_offset,
+                         const ValueIDRange& range, uint32_t* offsets) {
+  auto match_count = size_t{0};
+  for (auto index = size_t{0}; index < count; ++index) {
+    // Branch-free: always write the offset, but only advance the output position for matches.
+    offsets[match_count] = first_offset + static_cast<uint32_t>(index);
+    match_count += static_cast<size_t>(range.matches(value_ids[index]));
+  }
+  return match_count;
+}
+
+#if defined(__x86_64__)
+
+// For each 8-bit mask, the lanes of the set bits in ascending order. Used to move the matching offsets of an AVX2
+// register to its front, as AVX2 has no compress instruction.
+constexpr auto AVX2_COMPRESS_PERMUTATIONS = [] {
+  auto permutations = std::array<std::array<uint32_t, 8>, 256>{};
+  for (auto mask = uint32_t{0}; mask < 256; ++mask) {
+    auto lane_count = size_t{0};
+    for (auto lane = uint32_t{0}; lane < 8; ++lane) {
+      if ((mask >> lane) & 1u) {
+        permutations[mask][lane_count] = lane;
+        ++lane_count;
+      }
+    }
+  }
+  return permutations;
+}();
+
+template <typename ValueIDType>
+__attribute__((target("avx2"))) __m256i load_value_ids_avx2(const ValueIDType* value_ids) {
+  if constexpr (std::is_same_v<ValueIDType, uint8_t>) {
+    return _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(value_ids)));
+  } else if constexpr (std::is_same_v<ValueIDType, uint16_t>) {
+    return _mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(value_ids)));
+  } else {
+    return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(value_ids));
+  }
+}
+
+template <typename ValueIDType>
+__attribute__((target("avx2"))) size_t scan_block_avx2(const ValueIDType* value_ids, const size_t count,
+                                                        const uint32_t first_offset, const ValueIDRange& range,
+                                                        uint32_t* offsets) {
+  // AVX2 only offers signed comparisons. Flipping the sign bit of both operands turns them into unsigned ones.
+  constexpr auto SIGN_BIT = uint32_t{0x80000000};
+  const auto sign_bit = _mm256_set1_epi32(static_cast<int32_t>(SIGN_BIT));
+  const auto lower = _mm256_set1_epi32(static_cast<int32_t>(range.lower));
+  const auto width = _mm256_set1_epi32(static_cast<int32_t>(range.width ^ SIGN_BIT));
+  const auto null_value_id = _mm256_set1_epi32(static_cast<int32_t>(range.null_value_id ^ SIGN_BIT));
+  const auto negate = _mm256_set1_epi32(range.negate ? -1 : 0);
+  const auto lanes = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+
+  auto match_count = size_t{0};
+  auto index = size_t{0};
+  for (; index + 8 <= count; index += 8) {
+    const auto value_id_register = load_value_ids_avx2(value_ids + index);
+    const auto shifted_value_ids = _mm256_xor_si256(_mm256_sub_epi32(value_id_register, lower), sign_bit);
+    const auto in_range = _mm256_cmpgt_epi32(width, shifted_value_ids);
+    const auto not_null = _mm256_cmpgt_epi32(null_value_id, _mm256_xor_si256(value_id_register, sign_bit));
+    const auto matches = _mm256_and_si256(_mm256_xor_si256(in_range, negate), not_null);
+
+    const auto mask = static_cast<uint32_t>(_mm256_movemask_ps(_mm256_castsi256_ps(matches)));
+    if (mask == 0) {
+      continue;
+    }
+
+    const auto offset_register =
+        _mm256_add_epi32(_mm256_set1_epi32(static_cast<int32_t>(first_offset + index)), lanes);
+    const auto permutation =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(AVX2_COMPRESS_PERMUTATIONS[mask].data()));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(offsets + match_count),
+                        _mm256_permutevar8x32_epi32(offset_register, permutation));
+    match_count += std::popcount(mask);
+  }
+
+  return match_count + scan_block_scalar(value_ids + index, count - index,
+                                         first_offset + static_cast<uint32_t>(index), range, offsets + match_count);
+}
+
+template <typename ValueIDType>
+__attribute__((target("avx512f"))) __m512i load_value_ids_avx512(const ValueIDType* value_ids) {
+  if constexpr (std::is_same_v<ValueIDType, uint8_t>) {
+    return _mm512_cvtepu8_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(value_ids)));
+  } else if constexpr (std::is_same_v<ValueIDType, uint16_t>) {
+    return _mm512_cvtepu16_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(value_ids)));
+  } else {
+    return _mm512_loadu_si512(value_ids);
+  }
+}
+
+template <typename ValueIDType>
+__attribute__((target("avx512f"))) size_t scan_block_avx512(const ValueIDType* value_ids, const size_t count,
+                                                            const uint32_t first_offset, const ValueIDRange& range,
+                                                            uint32_t* offsets) {
+  const auto lower = _mm512_set1_epi32(static_cast<int32_t>(range.lower));
+  const auto width = _mm512_set1_epi32(static_cast<int32_t>(range.width));
+  const auto null_value_id = _mm512_set1_epi32(static_cast<int32_t>(range.null_value_id));
+  const auto negate = static_cast<uint32_t>(range.negate ? 0xFFFF : 0);
+  const auto lanes = _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+
+  auto match_count = size_t{0};
+  auto index = size_t{0};
+  for (; index + 16 <= count; index += 16) {
+    const auto value_id_register = load_value_ids_avx512(value_ids + index);
+    const auto in_range = _mm512_cmplt_epu32_mask(_mm512_sub_epi32(value_id_register, lower), width);
+    const auto not_null = _mm512_cmplt_epu32_mask(value_id_register, null_value_id);
+    const auto mask = static_cast<__mmask16>((in_range ^ negate) & not_null);
+
+    // Writes only the matching offsets, so no slack is needed in the offset buffer.
+    const auto offset_register =
+        _mm512_add_epi32(_mm512_set1_epi32(static_cast<int32_t>(first_offset + index)), lanes);
+    _mm512_mask_compressstoreu_epi32(offsets + match_count, mask, offset_register);
+    match_count += std::popcount(static_cast<uint32_t>(mask));
+  }
+
+  return match_count + scan_block_scalar(value_ids + index, count - index,
+                                         first_offset + static_cast<uint32_t>(index), range, offsets + match_count);
+}
+
+#endif
+
+template <typename ValueIDType>
+size_t scan_block(const ScanKernelInstructionSet instruction_set, const ValueIDType* value_ids, const size_t count,
+                  const uint32_t first_offset, const ValueIDRange& range, uint32_t* offsets) {
+  switch (instruction_set) {
+#if defined(__x86_64__)
+    case ScanKernelInstructionSet::AVX512:
+      return scan_block_avx512(value_ids, count, first_offset, range, offsets);
+    case ScanKernelInstructionSet::AVX2:
+      return scan_block_avx2(value_ids, count, first_offset, range, offsets);
+#endif
+    default:
+      return scan_block_scalar(value_ids, count, first_offset, range, offsets);
+  }
+}
+
+// Unpacks `count` value IDs starting at `begin` from a BitPackingVector. Each value ID is extracted with a single
+// unaligned 64-bit load: As value IDs have at most 32 bits and the load starts at most seven bits before the value ID,
+// the loaded word always contains all of its bits.
+void unpack_value_ids(const pmr_compact_vector& data, const size_t begin, const size_t count, uint32_t* value_ids) {
+  static_assert(std::endian::native == std::endian::little, "Unpacking assumes little-endian words.");
+
+  const auto bits = static_cast<size_t>(data.bits());
+  const auto mask = (uint64_t{1} << bits) - 1;
+  const auto* const bytes = reinterpret_cast<const char*>(data.get());
+
+  // Loads must not read past the last word of the vector. Value IDs whose load would do so are read through the
+  // compact_vector's accessor.
+  const auto byte_count = (data.size() * bits + 63) / 64 * sizeof(uint64_t);
+  const auto loadable_end = byte_count >= sizeof(uint64_t) ? (byte_count * 8 - 64) / bits + 1 : size_t{0};
+  const auto end = begin + count;
+  const auto unpack_end = std::clamp(loadable_end, begin, end);
+
+  for (auto index = begin; index < unpack_end; ++index) {
+    const auto bit_position = index * bits;
+    auto word = uint64_t{};
+    std::memcpy(&word, bytes + (bit_position >> 3), sizeof(word));
+    value_ids[index - begin] = static_cast<uint32_t>((word >> (bit_position & 7)) & mask);
+  }
+
+  for (auto index = unpack_end; index < end; ++index) {
+    value_ids[index - begin] = data[index];
+  }
+}
+
+void append_matches(const uint32_t* offsets, const size_t match_count, const ChunkID chunk_id,
+                    RowIDPosList& matches) {
+  const auto output_begin = matches.size();
+  matches.resize(output_begin + match_count);
+  for (auto index = size_t{0}; index < match_count; ++index) {
+    matches[output_begin + index] = RowID{chunk_id, ChunkOffset{offsets[index]}};
+  }
+}
+
+}  // namespace
+
+namespace hyrise {
+
+ScanKernelInstructionSet supported_scan_kernel_instruction_set() {
+  static const auto instruction_set = [] {
+#if defined(__x86_64__)
+    if (__builtin_cpu_supports("avx512f")) {
+      return ScanKernelInstructionSet::AVX512;
+    }
+
+    if (__builtin_cpu_supports("avx2")) {
+      return ScanKernelInstructionSet::AVX2;
+    }
+#endif
+    return ScanKernelInstructionSet::Scalar;
+  }();
+
+  return instruction_set;
+}
+
+void scan_value_id_range(const BaseCompressedVector& attribute_vector, const ValueID lower_value_id,
+                         const ValueID upper_value_id, const bool negate, const ValueID null_value_id,
+                         const ChunkID chunk_id, RowIDPosList& matches,
+                         const ScanKernelInstructionSet instruction_set) {
+  Assert(lower_value_id <= upper_value_id, "Invalid value ID range.");
+  Assert(instruction_set <= supported_scan_kernel_instruction_set(), "Instruction set is not supported by the CPU.");
+
+  const auto range = ValueIDRange{static_cast<uint32_t>(lower_value_id),
+                                  static_cast<uint32_t>(upper_value_id - lower_value_id),
+                                  static_cast<uint32_t>(null_value_id), negate};
+
+  auto offsets = std::array<uint32_t, BLOCK_SIZE + OFFSET_BUFFER_SLACK>{};
+
+  resolve_compressed_vector_type(attribute_vector, [&](const auto& vector) {
+    using VectorType = std::decay_t<decltype(vector)>;
+    const auto size = vector.size();
+
+    if constexpr (std::is_same_v<VectorType, BitPackingVector>) {
+      auto value_ids = std::array<uint32_t, BLOCK_SIZE>{};
+      for (auto block_begin = size_t{0}; block_begin < size; block_begin += BLOCK_SIZE) {
+        const auto block_size = std::min(BLOCK_SIZE, size - block_begin);
+        unpack_value_ids(vector.data(), block_begin, block_size, value_ids.data());
+        const auto match_count = scan_block(instruction_set, value_ids.data(), block_size,
+                                            static_cast<uint32_t>(block_begin), range, offsets.data());
+        append_matches(offsets.data(), match_count, chunk_id, matches);
+      }
+    } else {
+      const auto* const value_ids = vector.data().data();
+      for (auto block_begin = size_t{0}; block_begin < size; block_begin += BLOCK_SIZE) {
+        const auto block_size = std::min(BLOCK_SIZE, size - block_begin);
+        const auto match_count = scan_block(instruction_set, value_ids + block_begin, block_size,
+                                            static_cast<uint32_t>(block_begin), range, offsets.data());
+        append_matches(offsets.data(), match_count, chunk_id, matches);
+      }
+    }
+  });
+}
+
+}  // namespace hyrise
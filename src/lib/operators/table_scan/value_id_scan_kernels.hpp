@@ -0,0 +1,44 @@
+#pragma once
+
+#include <cstdint>
+
+#include "storage/pos_lists/row_id_pos_list.hpp"
+#include "types.hpp"
+
+namespace hyrise {
+
+class BaseCompressedVector;
+
+/**
+ * Kernels that scan the attribute vector of a dictionary-encoded segment for a range of value IDs. Instead of
+ * decompressing the value IDs one by one through the iterators of the compressed vector, they compare whole blocks of
+ * value IDs using SIMD instructions and write the matching chunk offsets to the output in bulk.
+ *
+ * - FixedWidthIntegerVectors are compared in place: 1- and 2-byte value IDs are widened to 32 bit in the registers.
+ * - BitPackingVectors are unpacked block-wise into a small, cache-resident buffer using unaligned 64-bit loads (i.e.,
+ *   without the per-element branches of the BitPackingIterator). The buffer is then compared like a 4-byte vector.
+ *
+ * The kernels are compiled for AVX2 and AVX-512 independently of the compiler flags used for the rest of Hyrise. The
+ * instruction set is chosen at runtime based on the capabilities of the CPU. On other CPUs (or other architectures),
+ * a branch-free scalar kernel is used.
+ */
+enum class ScanKernelInstructionSet : uint8_t { Scalar, AVX2, AVX512 };
+
+// Returns the most capable instruction set supported by the executing CPU. The result is determined once.
+ScanKernelInstructionSet supported_scan_kernel_instruction_set();
+
+/**
+ * Appends RowID{chunk_id, offset} to `matches` for each offset in the attribute vector whose value ID fulfills
+ *
+ *    (lower_value_id <= value_id < upper_value_id) != negate    and    value_id < null_value_id
+ *
+ * i.e., value IDs that are greater than or equal to `null_value_id` (the ValueID used for NULLs) never match. All
+ * comparisons of a column with a value (e.g., `column != value` as the negated range [value_id, value_id + 1)) and
+ * all BETWEEN predicates can be expressed this way.
+ */
+void scan_value_id_range(const BaseCompressedVector& attribute_vector, const ValueID lower_value_id,
+                         const ValueID upper_value_id, const bool negate, const ValueID null_value_id,
+                         const ChunkID chunk_id, RowIDPosList& matches,
+                         const ScanKernelInstructionSet instruction_set = supported_scan_kernel_instruction_set());
+
+}  // namespace hyrise
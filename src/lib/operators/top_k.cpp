@@ -0,0 +1,460 @@
+#include "top_k.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <queue>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "expression/evaluation/expression_evaluator.hpp"
+#include "expression/expression_utils.hpp"
+#include "hyrise.hpp"
+#include "resolve_type.hpp"
+#include "scheduler/job_task.hpp"
+#include "statistics/attribute_statistics.hpp"
+#include "statistics/statistics_objects/min_max_filter.hpp"
+#include "statistics/statistics_objects/range_filter.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+#include "utils/timer.hpp"
+
+namespace {
+
+using namespace hyrise;  // NOLINT
+
+// A candidate row. It holds the values of all sort columns and the position of the row in the input table.
+struct TopKRow {
+  std::vector<AllTypeVariant> values;
+  RowID row_id;
+};
+
+// Returns true if lhs comes before rhs in the output. Ties are broken by the position in the input, which keeps the
+// order stable.
+class TopKRowComparator {
+ public:
+  explicit TopKRowComparator(const std::vector<SortColumnDefinition>& sort_definitions)
+      : _sort_definitions(sort_definitions) {}
+
+  bool operator()(const TopKRow& lhs, const TopKRow& rhs) const {
+    const auto sort_definition_count = _sort_definitions.size();
+    for (auto definition_idx = size_t{0}; definition_idx < sort_definition_count; ++definition_idx) {
+      const auto& lhs_value = lhs.values[definition_idx];
+      const auto& rhs_value = rhs.values[definition_idx];
+
+      // NULLs come first, independent of the sort mode (see Sort).
+      const auto lhs_is_null = variant_is_null(lhs_value);
+      const auto rhs_is_null = variant_is_null(rhs_value);
+      if (lhs_is_null || rhs_is_null) {
+        if (lhs_is_null && rhs_is_null) {
+          continue;
+        }
+        return lhs_is_null;
+      }
+
+      if (lhs_value == rhs_value) {
+        continue;
+      }
+      const auto is_less = lhs_value < rhs_value;
+      return _sort_definitions[definition_idx].sort_mode == SortMode::Ascending ? is_less : !is_less;
+    }
+
+    return lhs.row_id < rhs.row_id;
+  }
+
+ private:
+  const std::vector<SortColumnDefinition>& _sort_definitions;
+};
+
+// The value of the first sort column of the worst row in a full heap. Rows whose first value is worse cannot be part
+// of the result.
+template <typename T>
+struct Threshold {
+  bool is_null;
+  T value;
+};
+
+// Returns whether a row whose first sort value is (is_null, value) can still be among the k best rows. Rows that tie
+// with the threshold have to be compared using the remaining sort columns.
+template <typename T>
+bool may_qualify(const bool is_null, const T& value, const std::optional<Threshold<T>>& threshold,
+                 const SortMode sort_mode) {
+  if (!threshold || is_null) {
+    return true;
+  }
+
+  if (threshold->is_null) {
+    return false;
+  }
+
+  return sort_mode == SortMode::Ascending ? value <= threshold->value : value >= threshold->value;
+}
+
+// Returns the tighter of both thresholds.
+template <typename T>
+std::optional<Threshold<T>> tighter_threshold(const std::optional<Threshold<T>>& lhs,
+                                              const std::optional<Threshold<T>>& rhs, const SortMode sort_mode) {
+  if (!lhs || !rhs) {
+    return lhs ? lhs : rhs;
+  }
+
+  return may_qualify(lhs->is_null, lhs->value, rhs, sort_mode) ? lhs : rhs;
+}
+
+// Returns the pruning statistics of the given segment. For ReferenceSegments that reference a single chunk, the
+// statistics of the referenced chunk are returned, as they cover a superset of the segment's values.
+template <typename T>
+std::shared_ptr<const AttributeStatistics<T>> segment_pruning_statistics(const Table& table, const ChunkID chunk_id,
+                                                                          const ColumnID column_id) {
+  auto statistics_chunk = table.get_chunk(chunk_id);
+  auto statistics_column_id = column_id;
+
+  const auto reference_segment = std::dynamic_pointer_cast<ReferenceSegment>(statistics_chunk->get_segment(column_id));
+  if (reference_segment) {
+    const auto& pos_list = reference_segment->pos_list();
+    if (pos_list->empty() || !pos_list->references_single_chunk()) {
+      return nullptr;
+    }
+
+    statistics_chunk = reference_segment->referenced_table()->get_chunk(pos_list->common_chunk_id());
+    statistics_column_id = reference_segment->referenced_column_id();
+    if (!statistics_chunk) {
+      return nullptr;
+    }
+  }
+
+  const auto& pruning_statistics = statistics_chunk->pruning_statistics();
+  if (!pruning_statistics) {
+    return nullptr;
+  }
+
+  return std::static_pointer_cast<const AttributeStatistics<T>>((*pruning_statistics)[statistics_column_id]);
+}
+
+// Returns the best value of a segment according to its pruning statistics, i.e., the minimum for ascending and the
+// maximum for descending sort modes.
+template <typename T>
+std::optional<T> best_value(const AttributeStatistics<T>& statistics, const SortMode sort_mode) {
+  if constexpr (std::is_arithmetic_v<T>) {
+    if (statistics.range_filter && !statistics.range_filter->ranges.empty()) {
+      const auto& ranges = statistics.range_filter->ranges;
+      return sort_mode == SortMode::Ascending ? ranges.front().first : ranges.back().second;
+    }
+  }
+
+  if (statistics.min_max_filter) {
+    return sort_mode == SortMode::Ascending ? statistics.min_max_filter->min : statistics.min_max_filter->max;
+  }
+
+  return std::nullopt;
+}
+
+// Returns whether the pruning statistics guarantee that the segment only contains values worse than the threshold.
+template <typename T>
+bool can_prune(const AttributeStatistics<T>& statistics, const Threshold<T>& threshold, const SortMode sort_mode) {
+  const auto predicate_condition =
+      sort_mode == SortMode::Ascending ? PredicateCondition::LessThanEquals : PredicateCondition::GreaterThanEquals;
+  const auto threshold_value = AllTypeVariant{threshold.value};
+
+  if constexpr (std::is_arithmetic_v<T>) {
+    if (statistics.range_filter && statistics.range_filter->does_not_contain(predicate_condition, threshold_value)) {
+      return true;
+    }
+  }
+
+  return statistics.min_max_filter && statistics.min_max_filter->does_not_contain(predicate_condition, threshold_value);
+}
+
+// Writes the given rows of the input table to a new data table.
+std::shared_ptr<Table> materialize_rows(const std::shared_ptr<const Table>& input_table, const RowIDPosList& pos_list,
+                                        const SortColumnDefinition& sorted_by) {
+  const auto row_count = pos_list.size();
+  const auto column_count = input_table->column_count();
+  const auto output_chunk_size = static_cast<size_t>(Chunk::DEFAULT_SIZE);
+  const auto output_chunk_count = (row_count + output_chunk_size - 1) / output_chunk_size;
+  auto output_segments_by_chunk = std::vector<Segments>(output_chunk_count, Segments(column_count));
+
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    const auto column_is_nullable = input_table->column_is_nullable(column_id);
+    resolve_data_type(input_table->column_data_type(column_id), [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+
+      const auto input_chunk_count = input_table->chunk_count();
+      auto accessor_by_chunk_id =
+          std::vector<std::unique_ptr<AbstractSegmentAccessor<ColumnDataType>>>(input_chunk_count);
+
+      for (auto output_chunk_idx = size_t{0}; output_chunk_idx < output_chunk_count; ++output_chunk_idx) {
+        const auto begin = output_chunk_idx * output_chunk_size;
+        const auto end = std::min(begin + output_chunk_size, row_count);
+
+        auto values = pmr_vector<ColumnDataType>{};
+        auto null_values = pmr_vector<bool>{};
+        values.reserve(end - begin);
+        null_values.reserve(end - begin);
+        for (auto row_idx = begin; row_idx < end; ++row_idx) {
+          const auto [chunk_id, chunk_offset] = pos_list[row_idx];
+          auto& accessor = accessor_by_chunk_id[chunk_id];
+          if (!accessor) {
+            const auto& segment = input_table->get_chunk(chunk_id)->get_segment(column_id);
+            accessor = create_segment_accessor<ColumnDataType>(segment);
+          }
+
+          const auto value = accessor->access(chunk_offset);
+          values.emplace_back(value ? *value : ColumnDataType{});
+          null_values.emplace_back(!value);
+        }
+
+        if (column_is_nullable) {
+          output_segments_by_chunk[output_chunk_idx][column_id] =
+              std::make_shared<ValueSegment<ColumnDataType>>(std::move(values), std::move(null_values));
+        } else {
+          output_segments_by_chunk[output_chunk_idx][column_id] =
+              std::make_shared<ValueSegment<ColumnDataType>>(std::move(values));
+        }
+      }
+    });
+  }
+
+  auto output_table = std::make_shared<Table>(input_table->column_definitions(), TableType::Data);
+  for (auto& segments : output_segments_by_chunk) {
+    output_table->append_chunk(segments);
+    const auto& output_chunk = output_table->get_chunk(static_cast<ChunkID>(output_table->chunk_count() - 1));
+    output_chunk->finalize();
+    output_chunk->set_individually_sorted_by(sorted_by);
+  }
+
+  return output_table;
+}
+
+}  // namespace
+
+namespace hyrise {
+
+TopK::TopK(const std::shared_ptr<const AbstractOperator>& input_operator,
+           const std::vector<SortColumnDefinition>& sort_definitions,
+           const std::shared_ptr<AbstractExpression>& row_count_expression)
+    : AbstractReadOnlyOperator(OperatorType::TopK, input_operator, nullptr, std::make_unique<PerformanceData>()),
+      _sort_definitions(sort_definitions),
+      _row_count_expression(row_count_expression) {
+  Assert(!_sort_definitions.empty(), "Expected at least one sort criterion.");
+}
+
+const std::string& TopK::name() const {
+  static const auto name = std::string{"TopK"};
+  return name;
+}
+
+const std::vector<SortColumnDefinition>& TopK::sort_definitions() const {
+  return _sort_definitions;
+}
+
+std::shared_ptr<AbstractExpression> TopK::row_count_expression() const {
+  return _row_count_expression;
+}
+
+std::shared_ptr<AbstractOperator> TopK::_on_deep_copy(
+    const std::shared_ptr<AbstractOperator>& copied_left_input,
+    const std::shared_ptr<AbstractOperator>& /*copied_right_input*/,
+    std::unordered_map<const AbstractOperator*, std::shared_ptr<AbstractOperator>>& copied_ops) const {
+  return std::make_shared<TopK>(copied_left_input, _sort_definitions, _row_count_expression->deep_copy(copied_ops));
+}
+
+void TopK::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {
+  expression_set_parameters(_row_count_expression, parameters);
+}
+
+void TopK::_on_set_transaction_context(const std::weak_ptr<TransactionContext>& transaction_context) {
+  expression_set_transaction_context(_row_count_expression, transaction_context);
+}
+
+std::shared_ptr<const Table> TopK::_on_execute() {
+  const auto& input_table = left_input_table();
+
+  for (const auto& sort_definition : _sort_definitions) {
+    Assert(sort_definition.column < input_table->column_count(), "TopK: Invalid column in sort definition.");
+  }
+
+  // Evaluate the row count expression in the same way as the Limit operator does.
+  auto k = size_t{0};
+  resolve_data_type(_row_count_expression->data_type(), [&](const auto data_type_t) {
+    using LimitDataType = typename decltype(data_type_t)::type;
+
+    if constexpr (std::is_integral_v<LimitDataType>) {
+      const auto row_count_expression_result =
+          ExpressionEvaluator{}.evaluate_expression_to_result<LimitDataType>(*_row_count_expression);
+      Assert(row_count_expression_result->size() == 1, "Expected exactly one row for TopK.");
+      Assert(!row_count_expression_result->is_null(0), "Expected non-null for TopK.");
+
+      const auto signed_k = row_count_expression_result->value(0);
+      Assert(signed_k >= 0, "Can't limit to a negative number of rows.");
+      k = static_cast<size_t>(signed_k);
+    } else {
+      Fail("Non-integral types not allowed in TopK.");
+    }
+  });
+
+  if (k == 0 || input_table->row_count() == 0) {
+    return std::make_shared<Table>(input_table->column_definitions(), TableType::Data);
+  }
+
+  auto pos_list = RowIDPosList{};
+  resolve_data_type(input_table->column_data_type(_sort_definitions.front().column), [&](auto type) {
+    using FirstColumnDataType = typename decltype(type)::type;
+    pos_list = _compute_top_k<FirstColumnDataType>(input_table, k);
+  });
+
+  auto timer = Timer{};
+  const auto output_table = materialize_rows(input_table, pos_list, _sort_definitions.front());
+  auto& step_performance_data = static_cast<PerformanceData&>(*performance_data);
+  step_performance_data.set_step_runtime(OperatorSteps::WriteOutput, timer.lap());
+
+  return output_table;
+}
+
+template <typename FirstColumnDataType>
+RowIDPosList TopK::_compute_top_k(const std::shared_ptr<const Table>& input_table, const size_t k) {
+  auto& step_performance_data = static_cast<PerformanceData&>(*performance_data);
+  auto timer = Timer{};
+
+  const auto comparator = TopKRowComparator{_sort_definitions};
+  const auto first_column_id = _sort_definitions.front().column;
+  const auto first_sort_mode = _sort_definitions.front().sort_mode;
+  const auto sort_definition_count = _sort_definitions.size();
+  const auto chunk_count = input_table->chunk_count();
+
+  // Chunks can only be pruned if the first sort column contains no NULLs, as these are not covered by the statistics.
+  const auto pruning_enabled = !input_table->column_is_nullable(first_column_id);
+
+  // Order the chunks by the best value that their pruning statistics promise. Chunks without statistics come last.
+  auto chunk_statistics = std::vector<std::shared_ptr<const AttributeStatistics<FirstColumnDataType>>>(chunk_count);
+  auto chunk_order = std::vector<std::pair<std::optional<FirstColumnDataType>, ChunkID>>{};
+  chunk_order.reserve(chunk_count);
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = input_table->get_chunk(chunk_id);
+    Assert(chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
+
+    auto chunk_best_value = std::optional<FirstColumnDataType>{};
+    if (pruning_enabled && chunk->size() > 0) {
+      chunk_statistics[chunk_id] =
+          segment_pruning_statistics<FirstColumnDataType>(*input_table, chunk_id, first_column_id);
+      if (chunk_statistics[chunk_id]) {
+        chunk_best_value = best_value(*chunk_statistics[chunk_id], first_sort_mode);
+      }
+    }
+    chunk_order.emplace_back(chunk_best_value, chunk_id);
+  }
+
+  if (pruning_enabled) {
+    std::stable_sort(chunk_order.begin(), chunk_order.end(), [&](const auto& lhs, const auto& rhs) {
+      if (!lhs.first || !rhs.first) {
+        return lhs.first && !rhs.first;
+      }
+      return first_sort_mode == SortMode::Ascending ? *lhs.first < *rhs.first : *lhs.first > *rhs.first;
+    });
+  }
+
+  // The threshold is shared between the chunk jobs. Each job reads it once before it starts and publishes the
+  // threshold of its own heap once it is done.
+  auto shared_threshold = std::optional<Threshold<FirstColumnDataType>>{};
+  auto threshold_mutex = std::mutex{};
+
+  auto rows_by_chunk = std::vector<std::vector<TopKRow>>(chunk_count);
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(chunk_count);
+  for (const auto& [_, chunk_id] : chunk_order) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id = chunk_id] {
+      auto threshold = std::optional<Threshold<FirstColumnDataType>>{};
+      {
+        const auto lock = std::lock_guard<std::mutex>{threshold_mutex};
+        threshold = shared_threshold;
+      }
+
+      const auto& statistics = chunk_statistics[chunk_id];
+      if (statistics && threshold && can_prune(*statistics, *threshold, first_sort_mode)) {
+        ++step_performance_data.num_chunks_pruned;
+        return;
+      }
+
+      const auto chunk = input_table->get_chunk(chunk_id);
+      auto segments = std::vector<std::shared_ptr<AbstractSegment>>(sort_definition_count);
+      for (auto definition_idx = size_t{1}; definition_idx < sort_definition_count; ++definition_idx) {
+        segments[definition_idx] = chunk->get_segment(_sort_definitions[definition_idx].column);
+      }
+
+      // Max-heap according to the output order, i.e., the worst row is on top.
+      auto heap = std::priority_queue<TopKRow, std::vector<TopKRow>, TopKRowComparator>{comparator};
+
+      segment_iterate<FirstColumnDataType>(*chunk->get_segment(first_column_id), [&](const auto& position) {
+        const auto is_null = position.is_null();
+        const auto value = is_null ? FirstColumnDataType{} : position.value();
+        if (!may_qualify(is_null, value, threshold, first_sort_mode)) {
+          return;
+        }
+
+        auto row = TopKRow{std::vector<AllTypeVariant>(sort_definition_count),
+                           RowID{chunk_id, position.chunk_offset()}};
+        row.values[0] = is_null ? NULL_VALUE : AllTypeVariant{value};
+        for (auto definition_idx = size_t{1}; definition_idx < sort_definition_count; ++definition_idx) {
+          row.values[definition_idx] = (*segments[definition_idx])[position.chunk_offset()];
+        }
+
+        if (heap.size() == k) {
+          if (!comparator(row, heap.top())) {
+            return;
+          }
+          heap.pop();
+        }
+        heap.push(std::move(row));
+
+        if (heap.size() == k) {
+          const auto& worst_value = heap.top().values[0];
+          const auto heap_threshold =
+              variant_is_null(worst_value)
+                  ? Threshold<FirstColumnDataType>{true, FirstColumnDataType{}}
+                  : Threshold<FirstColumnDataType>{false, boost::get<FirstColumnDataType>(worst_value)};
+          threshold = tighter_threshold(threshold, std::optional{heap_threshold}, first_sort_mode);
+        }
+      });
+
+      if (heap.size() == k) {
+        const auto lock = std::lock_guard<std::mutex>{threshold_mutex};
+        shared_threshold = tighter_threshold(shared_threshold, threshold, first_sort_mode);
+      }
+
+      auto& rows = rows_by_chunk[chunk_id];
+      rows.reserve(heap.size());
+      while (!heap.empty()) {
+        rows.emplace_back(heap.top());
+        heap.pop();
+      }
+    }));
+  }
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+  step_performance_data.set_step_runtime(OperatorSteps::ComputeChunkHeaps, timer.lap());
+
+  // Merge the heaps of all chunks.
+  auto rows = std::vector<TopKRow>{};
+  for (auto& chunk_rows : rows_by_chunk) {
+    std::move(chunk_rows.begin(), chunk_rows.end(), std::back_inserter(rows));
+  }
+
+  const auto output_row_count = std::min(k, rows.size());
+  std::partial_sort(rows.begin(), rows.begin() + static_cast<std::ptrdiff_t>(output_row_count), rows.end(),
+                    comparator);
+
+  auto pos_list = RowIDPosList{};
+  pos_list.reserve(output_row_count);
+  for (auto row_idx = size_t{0}; row_idx < output_row_count; ++row_idx) {
+    pos_list.emplace_back(rows[row_idx].row_id);
+  }
+  step_performance_data.set_step_runtime(OperatorSteps::MergeHeaps, timer.lap());
+
+  return pos_list;
+}
+
+}  // namespace hyrise
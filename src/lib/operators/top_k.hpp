@@ -0,0 +1,70 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "abstract_read_only_operator.hpp"
+#include "expression/abstract_expression.hpp"
+#include "types.hpp"
+
+namespace hyrise {
+
+/**
+ * Operator that returns the first k rows of its input according to the given sort definitions. It computes the same
+ * result as a Sort followed by a Limit (i.e., the order is stable and NULLs come first), but it does not sort the
+ * entire input. Instead, each chunk is processed in a separate JobTask that keeps a bounded heap of its k best rows.
+ * The heaps are merged at the end.
+ *
+ * Once a heap holds k rows, the value of the first sort column in its worst row is a threshold: rows with worse values
+ * cannot be part of the result. The threshold is shared between the chunks and used to skip rows early. If the first
+ * sort column is not nullable, whole chunks are pruned when their MinMaxFilter or RangeFilter shows that they only
+ * contain worse values. To find a tight threshold early, chunks are processed in the order of the best value that
+ * their pruning statistics promise. Nullable columns cannot be pruned, as the statistics do not cover NULLs.
+ *
+ * As the result is expected to be small, it is materialized.
+ */
+class TopK : public AbstractReadOnlyOperator {
+ public:
+  enum class OperatorSteps : uint8_t { ComputeChunkHeaps, MergeHeaps, WriteOutput };
+
+  struct PerformanceData : public OperatorPerformanceData<OperatorSteps> {
+    std::atomic_size_t num_chunks_pruned{0};
+
+    void output_to_stream(std::ostream& stream, DescriptionMode description_mode) const override {
+      OperatorPerformanceData<OperatorSteps>::output_to_stream(stream, description_mode);
+
+      const auto separator = (description_mode == DescriptionMode::SingleLine ? ' ' : '\n');
+      stream << separator << "Chunks: " << num_chunks_pruned.load() << " pruned.";
+    }
+  };
+
+  TopK(const std::shared_ptr<const AbstractOperator>& input_operator,
+       const std::vector<SortColumnDefinition>& sort_definitions,
+       const std::shared_ptr<AbstractExpression>& row_count_expression);
+
+  const std::string& name() const override;
+
+  const std::vector<SortColumnDefinition>& sort_definitions() const;
+  std::shared_ptr<AbstractExpression> row_count_expression() const;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+  std::shared_ptr<AbstractOperator> _on_deep_copy(
+      const std::shared_ptr<AbstractOperator>& copied_left_input,
+      const std::shared_ptr<AbstractOperator>& /*copied_right_input*/,
+      std::unordered_map<const AbstractOperator*, std::shared_ptr<AbstractOperator>>& copied_ops) const override;
+  void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override;
+  void _on_set_transaction_context(const std::weak_ptr<TransactionContext>& transaction_context) override;
+
+  // Returns the RowIDs of the k best rows of the input table in output order.
+  template <typename FirstColumnDataType>
+  RowIDPosList _compute_top_k(const std::shared_ptr<const Table>& input_table, const size_t k);
+
+  const std::vector<SortColumnDefinition> _sort_definitions;
+  const std::shared_ptr<AbstractExpression> _row_count_expression;
+};
+
+}  // namespace hyrise
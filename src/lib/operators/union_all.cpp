@@ -5,6 +5,8 @@
 #include <utility>
 #include <vector>
 
+#include "storage/pos_lists/entire_chunk_pos_list.hpp"
+#include "storage/reference_segment.hpp"
 #include "utils/assert.hpp"
 
 namespace hyrise {
@@ -20,16 +22,31 @@ const std::string& UnionAll::name() const {
 }
 
 std::shared_ptr<const Table> UnionAll::_on_execute() {
-  Assert(left_input_table()->column_definitions() == right_input_table()->column_definitions(),
-         "Input tables must have same number of columns");
-  DebugAssert(left_input_table()->type() == right_input_table()->type(), "Input tables must have the same type");
+  const auto& left_table = left_input_table();
+  const auto& right_table = right_input_table();
+  const auto column_count = left_table->column_count();
+  Assert(right_table->column_count() == column_count, "Input tables must have same number of columns");
 
-  auto output_chunks =
-      std::vector<std::shared_ptr<Chunk>>{left_input_table()->chunk_count() + right_input_table()->chunk_count()};
+  // As in SQL, the columns of both inputs are matched by their position and named after the left input's columns.
+  auto output_column_definitions = left_table->column_definitions();
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    Assert(left_table->column_data_type(column_id) == right_table->column_data_type(column_id),
+           "Input tables must have the same column data types");
+    output_column_definitions[column_id].nullable |= right_table->column_is_nullable(column_id);
+  }
+
+  // If only one of the inputs is a reference table (e.g., the union of a filtered and an unfiltered table), the chunks
+  // of the data table are turned into reference chunks so that the output table is a valid reference table.
+  const auto output_table_type =
+      left_table->type() == right_table->type() ? left_table->type() : TableType::References;
+
+  auto output_chunks = std::vector<std::shared_ptr<Chunk>>{left_table->chunk_count() + right_table->chunk_count()};
   auto output_chunk_idx = size_t{0};
 
   // add positions to output by iterating over both input tables
-  for (const auto& input : {left_input_table(), right_input_table()}) {
+  for (const auto& input : {left_table, right_table}) {
+    const auto reference_data_chunks = input->type() != output_table_type;
+
     // iterating over all chunks of table input
     const auto chunk_count = input->chunk_count();
     for (ChunkID in_chunk_id{0}; in_chunk_id < chunk_count; in_chunk_id++) {
@@ -38,10 +55,16 @@ std::shared_ptr<const Table> UnionAll::_on_execute() {
 
       // creating empty chunk to add segments with positions
       Segments output_segments;
+      const auto pos_list =
+          reference_data_chunks ? std::make_shared<EntireChunkPosList>(in_chunk_id, chunk->size()) : nullptr;
 
       // iterating over all segments of the current chunk
-      for (auto column_id = ColumnID{0}; column_id < input->column_count(); ++column_id) {
-        output_segments.push_back(chunk->get_segment(column_id));
+      for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+        if (reference_data_chunks) {
+          output_segments.push_back(std::make_shared<ReferenceSegment>(input, column_id, pos_list));
+        } else {
+          output_segments.push_back(chunk->get_segment(column_id));
+        }
       }
 
       // adding newly filled chunk to the output table
@@ -50,8 +73,7 @@ std::shared_ptr<const Table> UnionAll::_on_execute() {
     }
   }
 
-  return std::make_shared<Table>(left_input_table()->column_definitions(), left_input_table()->type(),
-                                 std::move(output_chunks));
+  return std::make_shared<Table>(output_column_definitions, output_table_type, std::move(output_chunks));
 }
 
 std::shared_ptr<AbstractOperator> UnionAll::_on_deep_copy(
@@ -8,6 +8,7 @@
 #include "concurrency/transaction_context.hpp"
 #include "hyrise.hpp"
 #include "operators/delete.hpp"
+#include "operators/runtime_filter.hpp"
 #include "scheduler/job_task.hpp"
 #include "storage/pos_lists/entire_chunk_pos_list.hpp"
 #include "storage/reference_segment.hpp"
@@ -276,6 +277,23 @@ void Validate::_validate_chunks(const std::shared_ptr<const Table>& input_table,
         pos_list_out = std::make_shared<const RowIDPosList>(std::move(temp_pos_list));
       }
 
+      // Drop the rows that cannot find a join partner on the build side of a runtime filter. Runtime filters are only
+      // added to Validate operators that receive data tables, i.e., whose input is a GetTable (see LQPTranslator).
+      for (const auto& runtime_filter : runtime_filters) {
+        if (pos_list_out->empty()) {
+          break;
+        }
+
+        if (!runtime_filter.first->try_build()) {
+          continue;
+        }
+
+        const auto& segment = *chunk_in->get_segment(runtime_filter.second);
+        if (auto filtered_pos_list = runtime_filter.first->filter(segment, pos_list_out)) {
+          pos_list_out = std::move(filtered_pos_list);
+        }
+      }
+
       // Create actual ReferenceSegment objects.
       for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
         auto ref_segment_out = std::make_shared<ReferenceSegment>(referenced_table, column_id, pos_list_out);
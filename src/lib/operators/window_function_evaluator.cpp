@@ -0,0 +1,773 @@
+#include "window_function_evaluator.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <boost/container_hash/hash.hpp>
+
+#include "aggregate/window_function_traits.hpp"
+#include "hyrise.hpp"
+#include "resolve_type.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/job_task.hpp"
+#include "storage/pos_lists/entire_chunk_pos_list.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/value_segment.hpp"
+#include "utils/assert.hpp"
+#include "utils/timer.hpp"
+
+namespace {
+
+using namespace hyrise;  // NOLINT
+
+using RelevantRowInformation = WindowFunctionEvaluator::RelevantRowInformation;
+
+// In contrast to the SQL semantics of NullValue comparisons, PARTITION BY and ORDER BY treat NULLs as equal to each
+// other. As in the Sort operator, NULLs come before all other values for both sort modes.
+bool values_equal(const AllTypeVariant& lhs, const AllTypeVariant& rhs) {
+  const auto lhs_is_null = variant_is_null(lhs);
+  const auto rhs_is_null = variant_is_null(rhs);
+  if (lhs_is_null || rhs_is_null) {
+    return lhs_is_null && rhs_is_null;
+  }
+  return lhs == rhs;
+}
+
+bool value_less(const AllTypeVariant& lhs, const AllTypeVariant& rhs, const SortMode sort_mode) {
+  if (variant_is_null(lhs)) {
+    return !variant_is_null(rhs);
+  }
+  if (variant_is_null(rhs)) {
+    return false;
+  }
+  return sort_mode == SortMode::Ascending ? lhs < rhs : rhs < lhs;
+}
+
+bool values_equal(const std::vector<AllTypeVariant>& lhs, const std::vector<AllTypeVariant>& rhs) {
+  const auto value_count = lhs.size();
+  for (auto value_idx = size_t{0}; value_idx < value_count; ++value_idx) {
+    if (!values_equal(lhs[value_idx], rhs[value_idx])) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Iterative, bottom-up segment tree. Leaves are stored at [leaf_count, 2 * leaf_count). The combine function does not
+// need to be commutative, but it must be associative and `neutral_element` must be its identity.
+template <typename State, typename Combine>
+class SegmentTree {
+ public:
+  SegmentTree(std::vector<State>&& leaves, const State& neutral_element, const Combine& combine)
+      : _leaf_count{leaves.size()}, _neutral_element{neutral_element}, _combine{combine} {
+    _nodes.resize(2 * _leaf_count, _neutral_element);
+    std::move(leaves.begin(), leaves.end(), _nodes.begin() + static_cast<std::ptrdiff_t>(_leaf_count));
+    for (auto node_idx = _leaf_count - 1; node_idx > 0; --node_idx) {
+      _nodes[node_idx] = _combine(_nodes[2 * node_idx], _nodes[2 * node_idx + 1]);
+    }
+  }
+
+  // Combines the leaves in [begin, end).
+  State query(size_t begin, size_t end) const {
+    auto left_state = _neutral_element;
+    auto right_state = _neutral_element;
+    begin += _leaf_count;
+    end += _leaf_count;
+    while (begin < end) {
+      if (begin & 1u) {
+        left_state = _combine(left_state, _nodes[begin++]);
+      }
+      if (end & 1u) {
+        right_state = _combine(_nodes[--end], right_state);
+      }
+      begin >>= 1u;
+      end >>= 1u;
+    }
+    return _combine(left_state, right_state);
+  }
+
+ private:
+  const size_t _leaf_count;
+  const State _neutral_element;
+  const Combine _combine;
+  std::vector<State> _nodes;
+};
+
+/**
+ * An aggregate usable with frames is described by a state that can be created from a single (potentially NULL) input
+ * value, a neutral state, an associative combine function, and a function that turns the state into the result. This
+ * allows the same definition to be used for running aggregates and for segment trees.
+ */
+template <typename ColumnType, WindowFunction window_function, typename Enable = void>
+struct FrameAggregate {};
+
+template <typename ColumnType, WindowFunction window_function>
+struct FrameAggregate<
+    ColumnType, window_function,
+    std::enable_if_t<window_function == WindowFunction::Min || window_function == WindowFunction::Max>> {
+  using State = std::optional<ColumnType>;
+  using ReturnType = typename WindowFunctionTraits<ColumnType, window_function>::ReturnType;
+
+  static State neutral() {
+    return std::nullopt;
+  }
+
+  static State lift(const std::optional<ColumnType>& value) {
+    return value;
+  }
+
+  static State combine(const State& lhs, const State& rhs) {
+    if (!lhs) {
+      return rhs;
+    }
+    if (!rhs) {
+      return lhs;
+    }
+    if constexpr (window_function == WindowFunction::Min) {
+      return *rhs < *lhs ? rhs : lhs;
+    } else {
+      return *lhs < *rhs ? rhs : lhs;
+    }
+  }
+
+  static std::optional<ReturnType> finalize(const State& state) {
+    return state;
+  }
+};
+
+template <typename ColumnType>
+struct FrameAggregate<ColumnType, WindowFunction::Sum, std::enable_if_t<std::is_arithmetic_v<ColumnType>>> {
+  using ReturnType = typename WindowFunctionTraits<ColumnType, WindowFunction::Sum>::ReturnType;
+  using State = std::optional<ReturnType>;
+
+  static State neutral() {
+    return std::nullopt;
+  }
+
+  static State lift(const std::optional<ColumnType>& value) {
+    if (!value) {
+      return std::nullopt;
+    }
+    return static_cast<ReturnType>(*value);
+  }
+
+  static State combine(const State& lhs, const State& rhs) {
+    if (!lhs) {
+      return rhs;
+    }
+    if (!rhs) {
+      return lhs;
+    }
+    return *lhs + *rhs;
+  }
+
+  static std::optional<ReturnType> finalize(const State& state) {
+    return state;
+  }
+};
+
+template <typename ColumnType>
+struct FrameAggregate<ColumnType, WindowFunction::Avg, std::enable_if_t<std::is_arithmetic_v<ColumnType>>> {
+  using ReturnType = typename WindowFunctionTraits<ColumnType, WindowFunction::Avg>::ReturnType;
+  // Sum and count of non-NULL values.
+  using State = std::pair<double, int64_t>;
+
+  static State neutral() {
+    return {0.0, 0};
+  }
+
+  static State lift(const std::optional<ColumnType>& value) {
+    if (!value) {
+      return neutral();
+    }
+    return {static_cast<double>(*value), 1};
+  }
+
+  static State combine(const State& lhs, const State& rhs) {
+    return {lhs.first + rhs.first, lhs.second + rhs.second};
+  }
+
+  static std::optional<ReturnType> finalize(const State& state) {
+    if (state.second == 0) {
+      return std::nullopt;
+    }
+    return state.first / static_cast<double>(state.second);
+  }
+};
+
+template <typename ColumnType>
+struct FrameAggregate<ColumnType, WindowFunction::Count> {
+  using ReturnType = typename WindowFunctionTraits<ColumnType, WindowFunction::Count>::ReturnType;
+  using State = int64_t;
+
+  static State neutral() {
+    return 0;
+  }
+
+  static State lift(const std::optional<ColumnType>& value) {
+    return value ? 1 : 0;
+  }
+
+  static State combine(const State& lhs, const State& rhs) {
+    return lhs + rhs;
+  }
+
+  static std::optional<ReturnType> finalize(const State& state) {
+    return state;
+  }
+};
+
+// Computes the first and last row (inclusive) of the peer group of each row in [partition_begin, partition_end).
+// Peers are rows with equal ORDER BY values. Without ORDER BY, all rows of a partition are peers.
+void determine_peer_groups(const std::vector<RelevantRowInformation>& rows, const size_t partition_begin,
+                           const size_t partition_end, std::vector<size_t>& peer_group_begins,
+                           std::vector<size_t>& peer_group_ends) {
+  const auto partition_size = partition_end - partition_begin;
+  peer_group_begins.resize(partition_size);
+  peer_group_ends.resize(partition_size);
+
+  auto group_begin = size_t{0};
+  for (auto row_idx = size_t{1}; row_idx <= partition_size; ++row_idx) {
+    if (row_idx < partition_size && values_equal(rows[partition_begin + row_idx].order_values,
+                                                 rows[partition_begin + row_idx - 1].order_values)) {
+      continue;
+    }
+
+    for (auto peer_idx = group_begin; peer_idx < row_idx; ++peer_idx) {
+      peer_group_begins[peer_idx] = group_begin;
+      peer_group_ends[peer_idx] = row_idx - 1;
+    }
+    group_begin = row_idx;
+  }
+}
+
+}  // namespace
+
+namespace hyrise {
+
+WindowFunctionEvaluator::WindowFunctionEvaluator(
+    const std::shared_ptr<const AbstractOperator>& input_operator, const std::vector<ColumnID>& partition_by_column_ids,
+    const std::vector<ColumnID>& order_by_column_ids, const ColumnID function_argument_column_id,
+    const std::shared_ptr<WindowFunctionExpression>& window_function_expression)
+    : AbstractReadOnlyOperator(OperatorType::WindowFunction, input_operator, nullptr,
+                               std::make_unique<OperatorPerformanceData<OperatorSteps>>()),
+      _partition_by_column_ids{partition_by_column_ids},
+      _order_by_column_ids{order_by_column_ids},
+      _function_argument_column_id{function_argument_column_id},
+      _window_function_expression{window_function_expression} {
+  Assert(_window_function_expression && _window_function_expression->window(),
+         "WindowFunctionEvaluator requires a window function with a window definition.");
+  Assert(_order_by_column_ids.size() == _sort_modes().size(), "Expected one sort mode per ORDER BY column.");
+
+  const auto window_function = _window_function_expression->window_function;
+  AssertInput(window_function != WindowFunction::CountDistinct &&
+                  window_function != WindowFunction::StandardDeviationSample && window_function != WindowFunction::Any,
+              "Window function " + window_function_to_string.left.at(window_function) + " is not supported.");
+
+  const auto& frame = _frame_description();
+  AssertInput(frame.type != FrameType::Groups, "GROUPS frames are not supported.");
+  if (frame.type == FrameType::Range) {
+    const auto bound_has_offset = [](const auto& bound) {
+      return bound.type != FrameBoundType::CurrentRow && !bound.unbounded;
+    };
+    AssertInput(!bound_has_offset(frame.start) && !bound_has_offset(frame.end),
+                "RANGE frames with offsets are not supported.");
+  }
+}
+
+const std::string& WindowFunctionEvaluator::name() const {
+  static const auto name = std::string{"WindowFunctionEvaluator"};
+  return name;
+}
+
+std::string WindowFunctionEvaluator::description(DescriptionMode description_mode) const {
+  const auto separator = (description_mode == DescriptionMode::SingleLine ? ' ' : '\n');
+  auto stream = std::stringstream{};
+  stream << AbstractOperator::description(description_mode) << separator;
+  stream << _window_function_expression->as_column_name();
+  return stream.str();
+}
+
+const std::vector<ColumnID>& WindowFunctionEvaluator::partition_by_column_ids() const {
+  return _partition_by_column_ids;
+}
+
+const std::vector<ColumnID>& WindowFunctionEvaluator::order_by_column_ids() const {
+  return _order_by_column_ids;
+}
+
+ColumnID WindowFunctionEvaluator::function_argument_column_id() const {
+  return _function_argument_column_id;
+}
+
+std::shared_ptr<WindowFunctionExpression> WindowFunctionEvaluator::window_function_expression() const {
+  return _window_function_expression;
+}
+
+std::shared_ptr<AbstractOperator> WindowFunctionEvaluator::_on_deep_copy(
+    const std::shared_ptr<AbstractOperator>& copied_left_input,
+    const std::shared_ptr<AbstractOperator>& /*copied_right_input*/,
+    std::unordered_map<const AbstractOperator*, std::shared_ptr<AbstractOperator>>& /*copied_ops*/) const {
+  return std::make_shared<WindowFunctionEvaluator>(copied_left_input, _partition_by_column_ids, _order_by_column_ids,
+                                                   _function_argument_column_id, _window_function_expression);
+}
+
+void WindowFunctionEvaluator::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {}
+
+const FrameDescription& WindowFunctionEvaluator::_frame_description() const {
+  return static_cast<const WindowExpression&>(*_window_function_expression->window()).frame_description;
+}
+
+const std::vector<SortMode>& WindowFunctionEvaluator::_sort_modes() const {
+  return static_cast<const WindowExpression&>(*_window_function_expression->window()).sort_modes;
+}
+
+std::vector<std::vector<RelevantRowInformation>> WindowFunctionEvaluator::_partition_and_sort() const {
+  const auto& input_table = *left_input_table();
+  const auto chunk_count = input_table.chunk_count();
+  const auto bucket_count = _partition_by_column_ids.empty() ? size_t{1} : PARTITION_BUCKET_COUNT;
+  const auto partition_column_count = _partition_by_column_ids.size();
+  const auto order_column_count = _order_by_column_ids.size();
+
+  // Materialize the relevant values chunk by chunk and distribute the rows into buckets.
+  auto buckets_by_chunk = std::vector<std::vector<std::vector<RelevantRowInformation>>>(chunk_count);
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(chunk_count);
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = input_table.get_chunk(chunk_id);
+    Assert(chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
+
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk, chunk_id]() {
+      const auto chunk_size = chunk->size();
+      auto rows = std::vector<RelevantRowInformation>(chunk_size);
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+        auto& row = rows[chunk_offset];
+        row.partition_values.resize(partition_column_count);
+        row.order_values.resize(order_column_count);
+        row.row_id = RowID{chunk_id, chunk_offset};
+      }
+
+      const auto materialize_column = [&](const ColumnID column_id, auto&& get_target) {
+        const auto& segment = *chunk->get_segment(column_id);
+        resolve_data_type(input_table.column_data_type(column_id), [&](const auto data_type_t) {
+          using ColumnDataType = typename decltype(data_type_t)::type;
+          segment_iterate<ColumnDataType>(segment, [&](const auto& position) {
+            get_target(rows[position.chunk_offset()]) =
+                position.is_null() ? NULL_VALUE : AllTypeVariant{position.value()};
+          });
+        });
+      };
+
+      for (auto column_idx = size_t{0}; column_idx < partition_column_count; ++column_idx) {
+        materialize_column(_partition_by_column_ids[column_idx],
+                           [column_idx](auto& row) -> auto& { return row.partition_values[column_idx]; });
+      }
+      for (auto column_idx = size_t{0}; column_idx < order_column_count; ++column_idx) {
+        materialize_column(_order_by_column_ids[column_idx],
+                           [column_idx](auto& row) -> auto& { return row.order_values[column_idx]; });
+      }
+      if (_function_argument_column_id != INVALID_COLUMN_ID) {
+        materialize_column(_function_argument_column_id, [](auto& row) -> auto& { return row.function_argument; });
+      }
+
+      auto& buckets = buckets_by_chunk[chunk_id];
+      buckets.resize(bucket_count);
+      if (bucket_count == 1) {
+        buckets.front() = std::move(rows);
+        return;
+      }
+
+      for (auto& row : rows) {
+        auto hash = size_t{0};
+        for (const auto& partition_value : row.partition_values) {
+          boost::hash_combine(hash, std::hash<AllTypeVariant>{}(partition_value));
+        }
+        buckets[hash % bucket_count].emplace_back(std::move(row));
+      }
+    }));
+  }
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+
+  // Gather the rows of each bucket and sort each bucket by (PARTITION BY, ORDER BY). The RowID is used as a tie
+  // breaker to guarantee deterministic results for rows that are peers.
+  const auto& sort_modes = _sort_modes();
+  const auto row_less = [&](const RelevantRowInformation& lhs, const RelevantRowInformation& rhs) {
+    for (auto column_idx = size_t{0}; column_idx < partition_column_count; ++column_idx) {
+      if (value_less(lhs.partition_values[column_idx], rhs.partition_values[column_idx], SortMode::Ascending)) {
+        return true;
+      }
+      if (value_less(rhs.partition_values[column_idx], lhs.partition_values[column_idx], SortMode::Ascending)) {
+        return false;
+      }
+    }
+    for (auto column_idx = size_t{0}; column_idx < order_column_count; ++column_idx) {
+      if (value_less(lhs.order_values[column_idx], rhs.order_values[column_idx], sort_modes[column_idx])) {
+        return true;
+      }
+      if (value_less(rhs.order_values[column_idx], lhs.order_values[column_idx], sort_modes[column_idx])) {
+        return false;
+      }
+    }
+    return lhs.row_id < rhs.row_id;
+  };
+
+  auto buckets = std::vector<std::vector<RelevantRowInformation>>(bucket_count);
+  jobs.clear();
+  jobs.reserve(bucket_count);
+  for (auto bucket_idx = size_t{0}; bucket_idx < bucket_count; ++bucket_idx) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, bucket_idx]() {
+      auto& bucket = buckets[bucket_idx];
+      auto row_count = size_t{0};
+      for (const auto& chunk_buckets : buckets_by_chunk) {
+        row_count += chunk_buckets[bucket_idx].size();
+      }
+      bucket.reserve(row_count);
+      for (auto& chunk_buckets : buckets_by_chunk) {
+        auto& rows = chunk_buckets[bucket_idx];
+        std::move(rows.begin(), rows.end(), std::back_inserter(bucket));
+        rows = {};
+      }
+      std::sort(bucket.begin(), bucket.end(), row_less);
+    }));
+  }
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+
+  return buckets;
+}
+
+std::shared_ptr<const Table> WindowFunctionEvaluator::_on_execute() {
+  auto timer = Timer{};
+  auto& step_performance_data = dynamic_cast<OperatorPerformanceData<OperatorSteps>&>(*performance_data);
+
+  const auto& input_table = *left_input_table();
+  const auto buckets = _partition_and_sort();
+  step_performance_data.set_step_runtime(OperatorSteps::PartitionAndSort, timer.lap());
+
+  const auto window_function = _window_function_expression->window_function;
+  const auto& frame = _frame_description();
+
+  const auto argument_data_type = _function_argument_column_id == INVALID_COLUMN_ID
+                                      ? DataType::Int
+                                      : input_table.column_data_type(_function_argument_column_id);
+
+  auto output_table = std::shared_ptr<const Table>{};
+
+  resolve_data_type(argument_data_type, [&](const auto argument_data_type_t) {
+    using ArgumentType = typename decltype(argument_data_type_t)::type;
+
+    // Prepare one result vector per input chunk. Each row's result is written exactly once, so the bucket jobs can
+    // write concurrently without synchronization.
+    const auto with_output_type = [&](const auto output_type_t) {
+      using OutputColumnType = typename decltype(output_type_t)::type;
+
+      const auto chunk_count = input_table.chunk_count();
+      auto results_by_chunk = std::vector<std::vector<std::optional<OutputColumnType>>>(chunk_count);
+      for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+        results_by_chunk[chunk_id].resize(input_table.get_chunk(chunk_id)->size());
+      }
+
+      const auto write_result = [&](const RowID row_id, std::optional<OutputColumnType> value) {
+        results_by_chunk[row_id.chunk_id][row_id.chunk_offset] = std::move(value);
+      };
+
+      const auto argument_value = [&](const RelevantRowInformation& row) -> std::optional<ArgumentType> {
+        // COUNT(*) counts all rows, so each row is treated as a non-NULL value.
+        if (_function_argument_column_id == INVALID_COLUMN_ID) {
+          return ArgumentType{};
+        }
+        if (variant_is_null(row.function_argument)) {
+          return std::nullopt;
+        }
+        return boost::get<ArgumentType>(row.function_argument);
+      };
+
+      // Processes a single window partition, i.e., rows [partition_begin, partition_end) of a sorted bucket.
+      const auto compute_partition = [&](const std::vector<RelevantRowInformation>& rows, const size_t partition_begin,
+                                         const size_t partition_end, std::vector<size_t>& peer_group_begins,
+                                         std::vector<size_t>& peer_group_ends) {
+        const auto partition_size = partition_end - partition_begin;
+        determine_peer_groups(rows, partition_begin, partition_end, peer_group_begins, peer_group_ends);
+
+        const auto compute_ranking = [&](auto&& rank_for_row) {
+          for (auto row_idx = size_t{0}; row_idx < partition_size; ++row_idx) {
+            write_result(rows[partition_begin + row_idx].row_id,
+                         static_cast<OutputColumnType>(rank_for_row(row_idx)));
+          }
+        };
+
+        switch (window_function) {
+          case WindowFunction::RowNumber:
+            if constexpr (std::is_same_v<OutputColumnType, int64_t>) {
+              compute_ranking([](const size_t row_idx) { return static_cast<int64_t>(row_idx + 1); });
+            }
+            return;
+
+          case WindowFunction::Rank:
+            if constexpr (std::is_same_v<OutputColumnType, int64_t>) {
+              compute_ranking([&](const size_t row_idx) {
+                return static_cast<int64_t>(peer_group_begins[row_idx] + 1);
+              });
+            }
+            return;
+
+          case WindowFunction::DenseRank:
+            if constexpr (std::is_same_v<OutputColumnType, int64_t>) {
+              auto dense_rank = int64_t{0};
+              for (auto row_idx = size_t{0}; row_idx < partition_size; ++row_idx) {
+                if (peer_group_begins[row_idx] == row_idx) {
+                  ++dense_rank;
+                }
+                write_result(rows[partition_begin + row_idx].row_id, dense_rank);
+              }
+            }
+            return;
+
+          case WindowFunction::PercentRank:
+            if constexpr (std::is_same_v<OutputColumnType, double>) {
+              compute_ranking([&](const size_t row_idx) {
+                return partition_size == 1 ? 0.0
+                                           : static_cast<double>(peer_group_begins[row_idx]) /
+                                                 static_cast<double>(partition_size - 1);
+              });
+            }
+            return;
+
+          case WindowFunction::CumeDist:
+            if constexpr (std::is_same_v<OutputColumnType, double>) {
+              compute_ranking([&](const size_t row_idx) {
+                return static_cast<double>(peer_group_ends[row_idx] + 1) / static_cast<double>(partition_size);
+              });
+            }
+            return;
+
+          default:
+            break;
+        }
+
+        // Aggregate functions with frames. Frame bounds are computed relative to the partition as [begin, end).
+        const auto frame_begin = [&](const size_t row_idx) -> size_t {
+          const auto& bound = frame.start;
+          if (bound.unbounded) {
+            return 0;
+          }
+          if (frame.type == FrameType::Range) {
+            return peer_group_begins[row_idx];
+          }
+          switch (bound.type) {
+            case FrameBoundType::Preceding:
+              return row_idx >= bound.offset ? row_idx - bound.offset : 0;
+            case FrameBoundType::CurrentRow:
+              return row_idx;
+            case FrameBoundType::Following:
+              return std::min(row_idx + bound.offset, partition_size);
+          }
+          Fail("Invalid enum value.");
+        };
+
+        const auto frame_end = [&](const size_t row_idx) -> size_t {
+          const auto& bound = frame.end;
+          if (bound.unbounded) {
+            return partition_size;
+          }
+          if (frame.type == FrameType::Range) {
+            return peer_group_ends[row_idx] + 1;
+          }
+          switch (bound.type) {
+            case FrameBoundType::Preceding:
+              return row_idx >= bound.offset ? row_idx - bound.offset + 1 : 0;
+            case FrameBoundType::CurrentRow:
+              return row_idx + 1;
+            case FrameBoundType::Following:
+              return std::min(row_idx + bound.offset + 1, partition_size);
+          }
+          Fail("Invalid enum value.");
+        };
+
+        const auto compute_aggregate = [&](const auto window_function_t) {
+          constexpr auto WINDOW_FUNCTION = decltype(window_function_t)::value;
+          using Aggregate = FrameAggregate<ArgumentType, WINDOW_FUNCTION>;
+
+          if constexpr (WindowFunctionTraits<ArgumentType, WINDOW_FUNCTION>::RESULT_TYPE == DataType::Null) {
+            FailInput("Invalid window function " + window_function_to_string.left.at(WINDOW_FUNCTION) +
+                      " on column type " + data_type_to_string.left.at(data_type_from_type<ArgumentType>()) + ".");
+          } else if constexpr (std::is_same_v<typename Aggregate::ReturnType, OutputColumnType>) {
+            if (frame.start.unbounded) {
+              // Running aggregate: the frame end never moves backwards, so we only add the rows that entered the
+              // frame since the previous row.
+              auto state = Aggregate::neutral();
+              auto aggregated_until = size_t{0};
+              for (auto row_idx = size_t{0}; row_idx < partition_size; ++row_idx) {
+                const auto end = frame_end(row_idx);
+                for (; aggregated_until < end; ++aggregated_until) {
+                  const auto& row = rows[partition_begin + aggregated_until];
+                  state = Aggregate::combine(state, Aggregate::lift(argument_value(row)));
+                }
+                write_result(rows[partition_begin + row_idx].row_id, Aggregate::finalize(state));
+              }
+              return;
+            }
+
+            auto leaves = std::vector<typename Aggregate::State>(partition_size);
+            for (auto row_idx = size_t{0}; row_idx < partition_size; ++row_idx) {
+              leaves[row_idx] = Aggregate::lift(argument_value(rows[partition_begin + row_idx]));
+            }
+            const auto segment_tree = SegmentTree(std::move(leaves), Aggregate::neutral(), &Aggregate::combine);
+
+            for (auto row_idx = size_t{0}; row_idx < partition_size; ++row_idx) {
+              const auto begin = frame_begin(row_idx);
+              const auto end = frame_end(row_idx);
+              const auto state = begin < end ? segment_tree.query(begin, end) : Aggregate::neutral();
+              write_result(rows[partition_begin + row_idx].row_id, Aggregate::finalize(state));
+            }
+          }
+        };
+
+        switch (window_function) {
+          case WindowFunction::Min:
+            compute_aggregate(std::integral_constant<WindowFunction, WindowFunction::Min>{});
+            return;
+          case WindowFunction::Max:
+            compute_aggregate(std::integral_constant<WindowFunction, WindowFunction::Max>{});
+            return;
+          case WindowFunction::Sum:
+            compute_aggregate(std::integral_constant<WindowFunction, WindowFunction::Sum>{});
+            return;
+          case WindowFunction::Avg:
+            compute_aggregate(std::integral_constant<WindowFunction, WindowFunction::Avg>{});
+            return;
+          case WindowFunction::Count:
+            compute_aggregate(std::integral_constant<WindowFunction, WindowFunction::Count>{});
+            return;
+          default:
+            Fail("Unsupported window function.");
+        }
+      };
+
+      // Each bucket contains complete window partitions and is processed by its own job.
+      auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+      jobs.reserve(buckets.size());
+      for (const auto& bucket : buckets) {
+        if (bucket.empty()) {
+          continue;
+        }
+
+        jobs.emplace_back(std::make_shared<JobTask>([&]() {
+          auto peer_group_begins = std::vector<size_t>{};
+          auto peer_group_ends = std::vector<size_t>{};
+          const auto row_count = bucket.size();
+          auto partition_begin = size_t{0};
+          for (auto row_idx = size_t{1}; row_idx <= row_count; ++row_idx) {
+            if (row_idx == row_count ||
+                !values_equal(bucket[row_idx].partition_values, bucket[partition_begin].partition_values)) {
+              compute_partition(bucket, partition_begin, row_idx, peer_group_begins, peer_group_ends);
+              partition_begin = row_idx;
+            }
+          }
+        }));
+      }
+      Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+      step_performance_data.set_step_runtime(OperatorSteps::Compute, timer.lap());
+
+      output_table = _annotate_input_table<OutputColumnType>(std::move(results_by_chunk));
+      step_performance_data.set_step_runtime(OperatorSteps::AnnotateInputTable, timer.lap());
+    };
+
+    resolve_data_type(_window_function_expression->data_type(), with_output_type);
+  });
+
+  return output_table;
+}
+
+template <typename OutputColumnType>
+std::shared_ptr<const Table> WindowFunctionEvaluator::_annotate_input_table(
+    std::vector<std::vector<std::optional<OutputColumnType>>>&& results_by_chunk) const {
+  const auto& input_table = left_input_table();
+  const auto chunk_count = input_table->chunk_count();
+  const auto input_column_count = input_table->column_count();
+
+  // Aggregates over empty frames or frames without non-NULL values yield NULL. Only then, the result column is
+  // nullable.
+  const auto column_is_nullable =
+      std::any_of(results_by_chunk.cbegin(), results_by_chunk.cend(), [](const auto& results) {
+        return std::any_of(results.cbegin(), results.cend(), [](const auto& result) { return !result; });
+      });
+
+  auto result_segments = std::vector<std::shared_ptr<ValueSegment<OutputColumnType>>>(chunk_count);
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    auto& results = results_by_chunk[chunk_id];
+    const auto result_count = results.size();
+    auto values = pmr_vector<OutputColumnType>(result_count);
+    auto nulls = pmr_vector<bool>(column_is_nullable ? result_count : 0);
+    for (auto chunk_offset = size_t{0}; chunk_offset < result_count; ++chunk_offset) {
+      if (results[chunk_offset]) {
+        values[chunk_offset] = std::move(*results[chunk_offset]);
+      } else {
+        nulls[chunk_offset] = true;
+      }
+    }
+    results = {};
+
+    if (column_is_nullable) {
+      result_segments[chunk_id] =
+          std::make_shared<ValueSegment<OutputColumnType>>(std::move(values), std::move(nulls));
+    } else {
+      result_segments[chunk_id] = std::make_shared<ValueSegment<OutputColumnType>>(std::move(values));
+    }
+  }
+
+  auto output_column_definitions = input_table->column_definitions();
+  const auto result_column_definition = TableColumnDefinition{_window_function_expression->as_column_name(),
+                                                              data_type_from_type<OutputColumnType>(),
+                                                              column_is_nullable};
+  output_column_definitions.emplace_back(result_column_definition);
+
+  // As in the Projection operator, the newly generated column cannot be part of a reference table. Instead, the results
+  // are stored in a separate data table that the output's ReferenceSegments point to.
+  const auto output_table_type = input_table->type();
+  auto result_table = std::shared_ptr<Table>{};
+  if (output_table_type == TableType::References) {
+    result_table = std::make_shared<Table>(TableColumnDefinitions{result_column_definition}, TableType::Data,
+                                           std::nullopt, UseMvcc::No);
+  }
+
+  auto output_chunks = std::vector<std::shared_ptr<Chunk>>(chunk_count);
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto input_chunk = input_table->get_chunk(chunk_id);
+    auto segments = Segments{};
+    segments.reserve(input_column_count + 1);
+    for (auto column_id = ColumnID{0}; column_id < input_column_count; ++column_id) {
+      segments.emplace_back(input_chunk->get_segment(column_id));
+    }
+
+    auto chunk = std::shared_ptr<Chunk>{};
+    if (output_table_type == TableType::Data) {
+      segments.emplace_back(result_segments[chunk_id]);
+      chunk = std::make_shared<Chunk>(std::move(segments), input_chunk->mvcc_data());
+      chunk->increase_invalid_row_count(input_chunk->invalid_row_count());
+    } else {
+      result_table->append_chunk(Segments{result_segments[chunk_id]});
+      const auto pos_list = std::make_shared<EntireChunkPosList>(chunk_id, input_chunk->size());
+      segments.emplace_back(std::make_shared<ReferenceSegment>(result_table, ColumnID{0}, pos_list));
+      chunk = std::make_shared<Chunk>(std::move(segments));
+    }
+
+    chunk->finalize();
+    const auto& sorted_by = input_chunk->individually_sorted_by();
+    if (!sorted_by.empty()) {
+      chunk->set_individually_sorted_by(sorted_by);
+    }
+    output_chunks[chunk_id] = chunk;
+  }
+
+  return std::make_shared<Table>(output_column_definitions, output_table_type, std::move(output_chunks),
+                                 input_table->uses_mvcc());
+}
+
+}  // namespace hyrise
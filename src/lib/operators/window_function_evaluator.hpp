@@ -0,0 +1,87 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "abstract_read_only_operator.hpp"
+#include "all_type_variant.hpp"
+#include "expression/window_expression.hpp"
+#include "expression/window_function_expression.hpp"
+#include "types.hpp"
+
+namespace hyrise {
+
+/**
+ * Operator to evaluate SQL:2003 window functions, e.g., ROW_NUMBER() OVER (PARTITION BY a ORDER BY b) or
+ * SUM(c) OVER (ORDER BY b ROWS BETWEEN 2 PRECEDING AND CURRENT ROW). The operator forwards all input columns and
+ * appends a single column holding the result of the window function. The order of the input rows is preserved.
+ *
+ * Execution happens in three steps:
+ *   (i)   The relevant columns (PARTITION BY, ORDER BY, and the function's argument) are materialized per chunk and the
+ *         rows are hash-partitioned by their PARTITION BY values into buckets. Rows of the same window partition always
+ *         end up in the same bucket. Each bucket is then sorted by (PARTITION BY, ORDER BY) in its own JobTask.
+ *   (ii)  Each bucket is processed in a separate JobTask. Ranking functions are computed in a single pass. Aggregates
+ *         whose frame starts at UNBOUNDED PRECEDING are computed incrementally by keeping a running state while the
+ *         frame end advances. All other frames are answered by a segment tree over the partition, so each frame costs
+ *         O(log n) instead of O(frame size).
+ *   (iii) The results are written to ValueSegments that are appended to the input chunks (see Projection for how this
+ *         works for reference tables).
+ *
+ * Unsupported: GROUPS frames, RANGE frames with offsets, and COUNT(DISTINCT)/STDDEV_SAMP/ANY as window functions.
+ */
+class WindowFunctionEvaluator : public AbstractReadOnlyOperator {
+ public:
+  enum class OperatorSteps : uint8_t { PartitionAndSort, Compute, AnnotateInputTable };
+
+  WindowFunctionEvaluator(const std::shared_ptr<const AbstractOperator>& input_operator,
+                          const std::vector<ColumnID>& partition_by_column_ids,
+                          const std::vector<ColumnID>& order_by_column_ids, const ColumnID function_argument_column_id,
+                          const std::shared_ptr<WindowFunctionExpression>& window_function_expression);
+
+  const std::string& name() const override;
+  std::string description(DescriptionMode description_mode) const override;
+
+  const std::vector<ColumnID>& partition_by_column_ids() const;
+  const std::vector<ColumnID>& order_by_column_ids() const;
+  ColumnID function_argument_column_id() const;
+  std::shared_ptr<WindowFunctionExpression> window_function_expression() const;
+
+  // Number of buckets used to hash-partition the input when PARTITION BY is given. Window partitions never span
+  // multiple buckets, so the buckets can be processed independently of each other.
+  static constexpr auto PARTITION_BUCKET_COUNT = size_t{256};
+
+  // All values of a single input row that are relevant for evaluating the window function.
+  struct RelevantRowInformation {
+    std::vector<AllTypeVariant> partition_values;
+    std::vector<AllTypeVariant> order_values;
+    AllTypeVariant function_argument;
+    RowID row_id;
+  };
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+  std::shared_ptr<AbstractOperator> _on_deep_copy(
+      const std::shared_ptr<AbstractOperator>& copied_left_input,
+      const std::shared_ptr<AbstractOperator>& /*copied_right_input*/,
+      std::unordered_map<const AbstractOperator*, std::shared_ptr<AbstractOperator>>& /*copied_ops*/) const override;
+  void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override;
+
+  const FrameDescription& _frame_description() const;
+  const std::vector<SortMode>& _sort_modes() const;
+
+  std::vector<std::vector<RelevantRowInformation>> _partition_and_sort() const;
+
+  template <typename OutputColumnType>
+  std::shared_ptr<const Table> _annotate_input_table(
+      std::vector<std::vector<std::optional<OutputColumnType>>>&& results_by_chunk) const;
+
+  const std::vector<ColumnID> _partition_by_column_ids;
+  const std::vector<ColumnID> _order_by_column_ids;
+  const ColumnID _function_argument_column_id;
+  const std::shared_ptr<WindowFunctionExpression> _window_function_expression;
+};
+
+}  // namespace hyrise
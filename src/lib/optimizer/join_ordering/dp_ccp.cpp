@@ -1,5 +1,6 @@
 #include "dp_ccp.hpp"
 
+#include <algorithm>
 #include <unordered_map>
 
 #include "cost_estimation/abstract_cost_estimator.hpp"
@@ -15,6 +16,9 @@ namespace hyrise {
 std::shared_ptr<AbstractLQPNode> DpCcp::operator()(const JoinGraph& join_graph,
                                                    const std::shared_ptr<AbstractCostEstimator>& cost_estimator) {
   Assert(!join_graph.vertices.empty(), "Code below relies on the JoinGraph having vertices");
+  Assert(std::none_of(join_graph.edges.begin(), join_graph.edges.end(),
+                      [](const auto& edge) { return edge.join_mode != JoinMode::Inner; }),
+         "DpCcp does not reorder semi and anti joins, use DpHyp.");
 
   // No std::unordered_map, since hashing of JoinGraphVertexSet is not (efficiently) possible because
   // boost::dynamic_bitset hides the data necessary for doing so efficiently.
@@ -0,0 +1,393 @@
+#include "dp_hyp.hpp"
+
+#include <functional>
+#include <limits>
+#include <numeric>
+#include <optional>
+#include <set>
+#include <vector>
+
+#include "cost_estimation/abstract_cost_estimator.hpp"
+#include "join_graph.hpp"
+#include "logical_query_plan/join_node.hpp"
+#include "utils/assert.hpp"
+
+/**
+ * --- Glossary ---
+ *
+ * See enumerate_ccp.cpp. In addition:
+ *
+ * Hyperedge            An edge that references more than two vertices. Here, all edges are treated as undirected
+ *                      hyperedges: An edge leads from a vertex set S to the vertices of the edge outside of S if it
+ *                      references S. The lowest of these vertices represents them in the neighborhood of S.
+ */
+
+namespace {
+
+using namespace hyrise;  // NOLINT
+
+/**
+ * CsgCmpPair enumeration on hypergraphs as described in the paper (Solve, EnumerateCsgRec, EmitCsg, EnumerateCmpRec).
+ * In contrast to EnumerateCcp, the pairs are not returned, but passed to a callback. This is necessary, as whether a
+ * vertex set is connected is only known once a pair forming it has been emitted.
+ */
+class EnumerateCcpHyp final {
+ public:
+  // Called for each CsgCmpPair with the indices of the edges that connect the two vertex sets.
+  using Callback =
+      std::function<void(const JoinGraphVertexSet&, const JoinGraphVertexSet&, const std::vector<size_t>&)>;
+
+  EnumerateCcpHyp(const JoinGraph& join_graph, const size_t max_vertex_set_size, const size_t limit,
+                  const Callback& callback)
+      : _join_graph(join_graph),
+        _vertex_count(join_graph.vertices.size()),
+        _max_vertex_set_size(max_vertex_set_size),
+        _limit(limit),
+        _callback(callback) {
+    const auto edge_count = _join_graph.edges.size();
+    for (auto edge_idx = size_t{0}; edge_idx < edge_count; ++edge_idx) {
+      // Local and uncorrelated predicates do not connect vertices.
+      if (_join_graph.edges[edge_idx].vertex_set.count() > 1) {
+        _edge_indices.emplace_back(edge_idx);
+      }
+    }
+  }
+
+  // Returns the number of emitted CsgCmpPairs. Stops once `limit` is exceeded.
+  size_t operator()() {
+    for (auto vertex_idx = size_t{0}; vertex_idx < _vertex_count; ++vertex_idx) {
+      _connected_vertex_sets.emplace(_single_vertex_set(vertex_idx));
+    }
+
+    for (auto reverse_vertex_idx = size_t{0}; reverse_vertex_idx < _vertex_count && !_aborted(); ++reverse_vertex_idx) {
+      const auto vertex_idx = _vertex_count - reverse_vertex_idx - 1;
+      const auto vertex_set = _single_vertex_set(vertex_idx);
+      _emit_csg(vertex_set);
+      _enumerate_csg_recursive(vertex_set, _vertices_up_to(vertex_idx));
+    }
+
+    return _pair_count;
+  }
+
+ private:
+  // Corresponds to EnumerateCsgRec in the paper. Grows the connected subgraph `vertex_set` by subsets of its
+  // neighborhood.
+  void _enumerate_csg_recursive(const JoinGraphVertexSet& vertex_set, const JoinGraphVertexSet& exclusion_set) {
+    // A connected subgraph needs a complement of at least one vertex.
+    const auto vertex_set_size = vertex_set.count();
+    if (vertex_set_size + 1 >= _max_vertex_set_size) {
+      return;
+    }
+
+    const auto neighborhood = _neighborhood(vertex_set, exclusion_set);
+    const auto max_subset_size = _max_vertex_set_size - vertex_set_size - 1;
+
+    _for_each_subset(neighborhood, max_subset_size, [&](const auto& subset) {
+      const auto csg = vertex_set | subset;
+      if (_connected_vertex_sets.contains(csg)) {
+        _emit_csg(csg);
+      }
+    });
+
+    const auto extended_exclusion_set = exclusion_set | neighborhood;
+    _for_each_subset(neighborhood, max_subset_size, [&](const auto& subset) {
+      _enumerate_csg_recursive(vertex_set | subset, extended_exclusion_set);
+    });
+  }
+
+  // Corresponds to EmitCsg in the paper. Finds the complements of the connected subgraph `csg`.
+  void _emit_csg(const JoinGraphVertexSet& csg) {
+    if (csg.count() >= _max_vertex_set_size) {
+      return;
+    }
+
+    const auto exclusion_set = csg | _vertices_up_to(csg.find_first());
+    const auto neighborhood = _neighborhood(csg, exclusion_set);
+
+    auto neighbor_indices = std::vector<size_t>{};
+    for (auto vertex_idx = neighborhood.find_first(); vertex_idx != JoinGraphVertexSet::npos;
+         vertex_idx = neighborhood.find_next(vertex_idx)) {
+      neighbor_indices.emplace_back(vertex_idx);
+    }
+
+    // NOLINTNEXTLINE(modernize-loop-convert)
+    for (auto iter = neighbor_indices.rbegin(); iter != neighbor_indices.rend() && !_aborted(); ++iter) {
+      const auto cmp = _single_vertex_set(*iter);
+      _emit_csg_cmp(csg, cmp);
+      _enumerate_cmp_recursive(csg, cmp, exclusion_set | (_vertices_up_to(*iter) & neighborhood));
+    }
+  }
+
+  // Corresponds to EnumerateCmpRec in the paper. Grows the complement `cmp` of the connected subgraph `csg`.
+  void _enumerate_cmp_recursive(const JoinGraphVertexSet& csg, const JoinGraphVertexSet& cmp,
+                                const JoinGraphVertexSet& exclusion_set) {
+    const auto vertex_set_size = csg.count() + cmp.count();
+    if (vertex_set_size >= _max_vertex_set_size) {
+      return;
+    }
+
+    const auto neighborhood = _neighborhood(cmp, exclusion_set);
+    const auto max_subset_size = _max_vertex_set_size - vertex_set_size;
+
+    _for_each_subset(neighborhood, max_subset_size, [&](const auto& subset) {
+      const auto extended_cmp = cmp | subset;
+      if (_connected_vertex_sets.contains(extended_cmp)) {
+        _emit_csg_cmp(csg, extended_cmp);
+      }
+    });
+
+    const auto extended_exclusion_set = exclusion_set | neighborhood;
+    _for_each_subset(neighborhood, max_subset_size, [&](const auto& subset) {
+      _enumerate_cmp_recursive(csg, cmp | subset, extended_exclusion_set);
+    });
+  }
+
+  // Corresponds to EmitCsgCmp in the paper.
+  void _emit_csg_cmp(const JoinGraphVertexSet& csg, const JoinGraphVertexSet& cmp) {
+    const auto edge_indices = _connecting_edges(csg, cmp);
+    if (!edge_indices) {
+      return;
+    }
+
+    ++_pair_count;
+    if (_aborted()) {
+      return;
+    }
+
+    _callback(csg, cmp, *edge_indices);
+    _connected_vertex_sets.emplace(csg | cmp);
+  }
+
+  // Returns the edges that connect the two vertex sets, or std::nullopt if they cannot be joined.
+  std::optional<std::vector<size_t>> _connecting_edges(const JoinGraphVertexSet& vertex_set_a,
+                                                       const JoinGraphVertexSet& vertex_set_b) const {
+    const auto joined_vertex_set = vertex_set_a | vertex_set_b;
+    auto edge_indices = std::vector<size_t>{};
+
+    for (const auto edge_idx : _edge_indices) {
+      const auto& edge = _join_graph.edges[edge_idx];
+
+      if (edge.right_vertex_idx) {
+        const auto right_vertex_idx = *edge.right_vertex_idx;
+        if (!joined_vertex_set.test(right_vertex_idx)) {
+          continue;
+        }
+
+        const auto& right_vertex_set = vertex_set_a.test(right_vertex_idx) ? vertex_set_a : vertex_set_b;
+        const auto& left_vertex_set = vertex_set_a.test(right_vertex_idx) ? vertex_set_b : vertex_set_a;
+        if (right_vertex_set.count() > 1) {
+          // The semi or anti join is part of the subplan of `right_vertex_set`.
+          continue;
+        }
+
+        // No other edge references the right vertex. Thus, it can only be joined using this edge, which requires all
+        // other vertices of the edge in the left input.
+        if (!(edge.vertex_set - right_vertex_set).is_subset_of(left_vertex_set)) {
+          return std::nullopt;
+        }
+        return std::vector<size_t>{edge_idx};
+      }
+
+      if (!edge.vertex_set.intersects(vertex_set_a) || !edge.vertex_set.intersects(vertex_set_b) ||
+          !edge.vertex_set.is_subset_of(joined_vertex_set)) {
+        continue;
+      }
+
+      edge_indices.emplace_back(edge_idx);
+    }
+
+    if (edge_indices.empty()) {
+      return std::nullopt;
+    }
+    return edge_indices;
+  }
+
+  // Corresponds to N(S, X) in the paper.
+  JoinGraphVertexSet _neighborhood(const JoinGraphVertexSet& vertex_set,
+                                   const JoinGraphVertexSet& exclusion_set) const {
+    auto neighborhood = JoinGraphVertexSet{_vertex_count};
+    for (const auto edge_idx : _edge_indices) {
+      const auto& edge_vertex_set = _join_graph.edges[edge_idx].vertex_set;
+      if (!edge_vertex_set.intersects(vertex_set)) {
+        continue;
+      }
+
+      const auto outside_vertex_set = edge_vertex_set - vertex_set;
+      if (outside_vertex_set.none() || outside_vertex_set.intersects(exclusion_set)) {
+        continue;
+      }
+
+      neighborhood.set(outside_vertex_set.find_first());
+    }
+
+    return neighborhood;
+  }
+
+  // Calls `functor` for all non-empty subsets of `vertex_set` with at most `max_subset_size` vertices. Smaller subsets
+  // come first, so that all subsets of a set are enumerated before the set itself.
+  template <typename Functor>
+  void _for_each_subset(const JoinGraphVertexSet& vertex_set, const size_t max_subset_size, const Functor& functor) {
+    auto vertex_indices = std::vector<size_t>{};
+    for (auto vertex_idx = vertex_set.find_first(); vertex_idx != JoinGraphVertexSet::npos;
+         vertex_idx = vertex_set.find_next(vertex_idx)) {
+      vertex_indices.emplace_back(vertex_idx);
+    }
+
+    const auto vertex_index_count = vertex_indices.size();
+    const auto subset_size_limit = std::min(max_subset_size, vertex_index_count);
+    for (auto subset_size = size_t{1}; subset_size <= subset_size_limit; ++subset_size) {
+      // Positions in `vertex_indices` of the vertices of the current subset, advanced like an odometer.
+      auto positions = std::vector<size_t>(subset_size);
+      std::iota(positions.begin(), positions.end(), size_t{0});
+
+      while (!_aborted()) {
+        auto subset = JoinGraphVertexSet{_vertex_count};
+        for (const auto position : positions) {
+          subset.set(vertex_indices[position]);
+        }
+        functor(subset);
+
+        auto position_idx = subset_size;
+        while (position_idx > 0 &&
+               positions[position_idx - 1] == vertex_index_count - subset_size + position_idx - 1) {
+          --position_idx;
+        }
+
+        if (position_idx == 0) {
+          break;
+        }
+
+        ++positions[position_idx - 1];
+        for (auto following_position_idx = position_idx; following_position_idx < subset_size;
+             ++following_position_idx) {
+          positions[following_position_idx] = positions[following_position_idx - 1] + 1;
+        }
+      }
+    }
+  }
+
+  // Corresponds to B_v in the paper: All vertices with an index lower than or equal to `vertex_idx`.
+  JoinGraphVertexSet _vertices_up_to(const size_t vertex_idx) const {
+    auto vertex_set = JoinGraphVertexSet{_vertex_count};
+    vertex_set.set(0, vertex_idx + 1, true);
+    return vertex_set;
+  }
+
+  JoinGraphVertexSet _single_vertex_set(const size_t vertex_idx) const {
+    auto vertex_set = JoinGraphVertexSet{_vertex_count};
+    vertex_set.set(vertex_idx);
+    return vertex_set;
+  }
+
+  bool _aborted() const {
+    return _pair_count > _limit;
+  }
+
+  const JoinGraph& _join_graph;
+  const size_t _vertex_count;
+  const size_t _max_vertex_set_size;
+  const size_t _limit;
+  const Callback _callback;
+
+  // Edges that reference at least two vertices.
+  std::vector<size_t> _edge_indices;
+
+  // Corresponds to the check for a dpTable entry in the paper. No std::unordered_set, see dp_ccp.cpp.
+  std::set<JoinGraphVertexSet> _connected_vertex_sets;
+
+  size_t _pair_count{0};
+};
+
+}  // namespace
+
+namespace hyrise {
+
+std::shared_ptr<AbstractLQPNode> DpHyp::operator()(const JoinGraph& join_graph,
+                                                   const std::shared_ptr<AbstractCostEstimator>& cost_estimator) {
+  Assert(!join_graph.vertices.empty(), "Code below relies on the JoinGraph having vertices");
+
+  const auto vertex_count = join_graph.vertices.size();
+  const auto plan_table = build_plan_table(join_graph, cost_estimator, vertex_count);
+
+  auto all_vertices_set = JoinGraphVertexSet{vertex_count};
+  all_vertices_set.flip();  // Turns all bits to '1'
+
+  const auto best_plan_iter = plan_table.find(all_vertices_set);
+  Assert(best_plan_iter != plan_table.end(), "No plan for all vertices generated. Maybe JoinGraph isn't connected?");
+
+  // Place uncorrelated predicates (think "6 > 4": not referencing any vertex) on top of the plan.
+  auto uncorrelated_predicates = std::vector<std::shared_ptr<AbstractExpression>>{};
+  for (const auto& edge : join_graph.edges) {
+    if (edge.vertex_set.none()) {
+      uncorrelated_predicates.insert(uncorrelated_predicates.end(), edge.predicates.begin(), edge.predicates.end());
+    }
+  }
+
+  return _add_predicates_to_plan(best_plan_iter->second.first, uncorrelated_predicates, cost_estimator);
+}
+
+DpHyp::PlanTable DpHyp::build_plan_table(const JoinGraph& join_graph,
+                                         const std::shared_ptr<AbstractCostEstimator>& cost_estimator,
+                                         const size_t max_vertex_set_size) {
+  auto plan_table = PlanTable{};
+
+  /**
+   * 1. Initialize the plan table with the vertices and their local predicates.
+   */
+  const auto vertex_count = join_graph.vertices.size();
+  for (auto vertex_idx = size_t{0}; vertex_idx < vertex_count; ++vertex_idx) {
+    auto single_vertex_set = JoinGraphVertexSet{vertex_count};
+    single_vertex_set.set(vertex_idx);
+
+    const auto plan = _add_predicates_to_plan(join_graph.vertices[vertex_idx],
+                                              join_graph.find_local_predicates(vertex_idx), cost_estimator);
+    plan_table.emplace(single_vertex_set, std::make_pair(plan, cost_estimator->estimate_plan_cost(plan)));
+  }
+
+  /**
+   * 2. Enumerate the CsgCmpPairs; build candidate plans; update the plan table if the candidate plan is cheaper than
+   *    the cheapest currently known plan for the same set of vertices.
+   */
+  const auto build_candidate_plan = [&](const JoinGraphVertexSet& csg, const JoinGraphVertexSet& cmp,
+                                        const std::vector<size_t>& edge_indices) -> std::shared_ptr<AbstractLQPNode> {
+    const auto& csg_plan = plan_table.at(csg).first;
+    const auto& cmp_plan = plan_table.at(cmp).first;
+
+    const auto& first_edge = join_graph.edges[edge_indices.front()];
+    if (first_edge.right_vertex_idx) {
+      // Semi and anti joins are connected by a single edge. Their right input is the single right vertex.
+      const auto csg_is_right = csg.test(*first_edge.right_vertex_idx);
+      return JoinNode::make(first_edge.join_mode, first_edge.predicates, csg_is_right ? cmp_plan : csg_plan,
+                            csg_is_right ? csg_plan : cmp_plan);
+    }
+
+    auto join_predicates = std::vector<std::shared_ptr<AbstractExpression>>{};
+    for (const auto edge_idx : edge_indices) {
+      const auto& predicates = join_graph.edges[edge_idx].predicates;
+      join_predicates.insert(join_predicates.end(), predicates.begin(), predicates.end());
+    }
+
+    return _add_join_to_plan(csg_plan, cmp_plan, join_predicates, cost_estimator);
+  };
+
+  EnumerateCcpHyp{join_graph, max_vertex_set_size, std::numeric_limits<size_t>::max(),
+                  [&](const auto& csg, const auto& cmp, const auto& edge_indices) {
+                    const auto candidate_plan = build_candidate_plan(csg, cmp, edge_indices);
+                    const auto candidate_cost = cost_estimator->estimate_plan_cost(candidate_plan);
+
+                    const auto joined_vertex_set = csg | cmp;
+                    const auto plan_iter = plan_table.find(joined_vertex_set);
+                    if (plan_iter == plan_table.end() || candidate_cost < plan_iter->second.second) {
+                      plan_table.insert_or_assign(joined_vertex_set, std::make_pair(candidate_plan, candidate_cost));
+                    }
+                  }}();
+
+  return plan_table;
+}
+
+size_t DpHyp::count_candidate_joins(const JoinGraph& join_graph, const size_t max_vertex_set_size,
+                                    const size_t limit) {
+  return EnumerateCcpHyp{join_graph, max_vertex_set_size, limit, [](const auto&, const auto&, const auto&) {}}();
+}
+
+}  // namespace hyrise
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <map>
+#include <memory>
+#include <utility>
+
+#include "abstract_join_ordering_algorithm.hpp"
+#include "join_graph_edge.hpp"
+#include "types.hpp"
+
+namespace hyrise {
+
+class AbstractCostEstimator;
+class JoinGraph;
+
+/**
+ * Optimal join ordering algorithm described in "Dynamic Programming Strikes Back"
+ * https://dl.acm.org/doi/10.1145/1376616.1376672
+ *
+ * Like DpCcp, DpHyp finds the cheapest bushy join tree without cross products by enumerating all pairs of connected
+ * subgraphs that are connected by an edge (CsgCmpPairs) in an order suitable for dynamic programming. Unlike DpCcp,
+ * it works on the hypergraph: Edges that reference more than two vertices connect subgraphs on their own and do not
+ * rely on the cross join edges added by the JoinGraphBuilder. Semi and anti joins are reordered with the inner joins:
+ * A candidate join that involves the right vertex of a semi or anti join edge is only built if the edge connects this
+ * single vertex to a subgraph containing all other vertices of the edge.
+ *
+ * Local predicates are pushed down and sorted by increasing cost. Uncorrelated predicates are placed on top of the
+ * resulting plan.
+ *
+ * The number of CsgCmpPairs grows exponentially with the number of vertices for dense graphs. It can be restricted by
+ * limiting the number of vertices of the subplans, which is used by IterativeDpHyp to order large join graphs.
+ */
+class DpHyp final : public AbstractJoinOrderingAlgorithm {
+ public:
+  // The cheapest plan known for a set of vertices and its cost.
+  using PlanTable = std::map<JoinGraphVertexSet, std::pair<std::shared_ptr<AbstractLQPNode>, Cost>>;
+
+  std::shared_ptr<AbstractLQPNode> operator()(const JoinGraph& join_graph,
+                                              const std::shared_ptr<AbstractCostEstimator>& cost_estimator) override;
+
+  /**
+   * Returns the cheapest plans for all vertex sets of up to @param max_vertex_set_size vertices that can be joined
+   * without cross products. The plans of single vertices contain their local predicates. Uncorrelated predicates are
+   * not placed.
+   */
+  static PlanTable build_plan_table(const JoinGraph& join_graph,
+                                    const std::shared_ptr<AbstractCostEstimator>& cost_estimator,
+                                    const size_t max_vertex_set_size);
+
+  /**
+   * Returns the number of candidate joins that build_plan_table() creates and costs for @param max_vertex_set_size.
+   * Counting is much cheaper than building the plans, as no cost is estimated. It stops once @param limit is
+   * exceeded.
+   */
+  static size_t count_candidate_joins(const JoinGraph& join_graph, const size_t max_vertex_set_size,
+                                      const size_t limit);
+};
+
+}  // namespace hyrise
@@ -1,5 +1,6 @@
 #include "greedy_operator_ordering.hpp"
 
+#include <algorithm>
 #include <numeric>
 #include <unordered_map>
 #include <unordered_set>
@@ -14,6 +15,9 @@ namespace hyrise {
 std::shared_ptr<AbstractLQPNode> GreedyOperatorOrdering::operator()(
     const JoinGraph& join_graph, const std::shared_ptr<AbstractCostEstimator>& cost_estimator) {
   DebugAssert(!join_graph.vertices.empty(), "Code below relies on there being at least one vertex");
+  Assert(std::none_of(join_graph.edges.begin(), join_graph.edges.end(),
+                      [](const auto& edge) { return edge.join_mode != JoinMode::Inner; }),
+         "GreedyOperatorOrdering does not reorder semi and anti joins, use DpHyp.");
 
   /**
    * 1. Initialize
@@ -0,0 +1,147 @@
+#include "iterative_dp_hyp.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "cost_estimation/abstract_cost_estimator.hpp"
+#include "join_graph.hpp"
+#include "utils/assert.hpp"
+
+namespace hyrise {
+
+IterativeDpHyp::IterativeDpHyp(const size_t init_max_candidate_join_count)
+    : _max_candidate_join_count(init_max_candidate_join_count) {
+  Assert(_max_candidate_join_count > 0, "IterativeDpHyp needs to be able to build at least one candidate join.");
+}
+
+std::shared_ptr<AbstractLQPNode> IterativeDpHyp::operator()(
+    const JoinGraph& join_graph, const std::shared_ptr<AbstractCostEstimator>& cost_estimator) {
+  Assert(!join_graph.vertices.empty(), "Code below relies on the JoinGraph having vertices");
+
+  // Uncorrelated predicates (think "6 > 4": not referencing any vertex) do not survive the contraction of vertices.
+  // They are placed on top of the final plan.
+  auto uncorrelated_predicates = std::vector<std::shared_ptr<AbstractExpression>>{};
+  auto edges = std::vector<JoinGraphEdge>{};
+  for (const auto& edge : join_graph.edges) {
+    if (edge.vertex_set.none()) {
+      uncorrelated_predicates.insert(uncorrelated_predicates.end(), edge.predicates.begin(), edge.predicates.end());
+    } else {
+      edges.emplace_back(edge);
+    }
+  }
+
+  // JoinGraphs are not assignable, std::optional allows us to replace the current one.
+  auto current_join_graph = std::optional<JoinGraph>{};
+  current_join_graph.emplace(join_graph.vertices, edges);
+
+  while (true) {
+    const auto vertex_count = current_join_graph->vertices.size();
+    const auto max_vertex_set_size = _max_vertex_set_size(*current_join_graph);
+    const auto plan_table = DpHyp::build_plan_table(*current_join_graph, cost_estimator, max_vertex_set_size);
+
+    if (max_vertex_set_size == vertex_count) {
+      auto all_vertices_set = JoinGraphVertexSet{vertex_count};
+      all_vertices_set.flip();  // Turns all bits to '1'
+
+      const auto best_plan_iter = plan_table.find(all_vertices_set);
+      Assert(best_plan_iter != plan_table.end(),
+             "No plan for all vertices generated. Maybe JoinGraph isn't connected?");
+
+      return _add_predicates_to_plan(best_plan_iter->second.first, uncorrelated_predicates, cost_estimator);
+    }
+
+    // Fix the cheapest of the largest subplans.
+    auto fixed_plan_iter = plan_table.begin();
+    for (auto plan_iter = plan_table.begin(); plan_iter != plan_table.end(); ++plan_iter) {
+      const auto vertex_set_size = plan_iter->first.count();
+      const auto fixed_vertex_set_size = fixed_plan_iter->first.count();
+      if (vertex_set_size > fixed_vertex_set_size ||
+          (vertex_set_size == fixed_vertex_set_size && plan_iter->second.second < fixed_plan_iter->second.second)) {
+        fixed_plan_iter = plan_iter;
+      }
+    }
+    Assert(fixed_plan_iter->first.count() > 1, "Could not join any vertices. Maybe JoinGraph isn't connected?");
+
+    auto contracted_join_graph = _contract(*current_join_graph, plan_table, fixed_plan_iter->first);
+    current_join_graph.emplace(std::move(contracted_join_graph));
+  }
+}
+
+size_t IterativeDpHyp::_max_vertex_set_size(const JoinGraph& join_graph) const {
+  const auto vertex_count = join_graph.vertices.size();
+  if (vertex_count <= 2 ||
+      DpHyp::count_candidate_joins(join_graph, vertex_count, _max_candidate_join_count) <= _max_candidate_join_count) {
+    return vertex_count;
+  }
+
+  // Each iteration with subplans of k vertices removes k - 1 vertices from the JoinGraph. We split the budget among the
+  // expected number of iterations and look for the largest k for which the current iteration stays within its share.
+  // The number of candidate joins grows monotonically with k, so we can use a binary search.
+  const auto fits_budget = [&](const size_t max_vertex_set_size) {
+    const auto iteration_count = (vertex_count - 1 + max_vertex_set_size - 2) / (max_vertex_set_size - 1);
+    const auto budget = std::max(_max_candidate_join_count / iteration_count, size_t{1});
+    return DpHyp::count_candidate_joins(join_graph, max_vertex_set_size, budget) <= budget;
+  };
+
+  // Subplans of two vertices are always built, even if that exceeds the budget. Otherwise, we would not progress.
+  auto lower_bound = size_t{2};
+  auto upper_bound = vertex_count - 1;
+  while (lower_bound < upper_bound) {
+    const auto max_vertex_set_size = lower_bound + (upper_bound - lower_bound + 1) / 2;
+    if (fits_budget(max_vertex_set_size)) {
+      lower_bound = max_vertex_set_size;
+    } else {
+      upper_bound = max_vertex_set_size - 1;
+    }
+  }
+
+  return lower_bound;
+}
+
+JoinGraph IterativeDpHyp::_contract(const JoinGraph& join_graph, const DpHyp::PlanTable& plan_table,
+                                    const JoinGraphVertexSet& fixed_vertex_set) {
+  const auto vertex_count = join_graph.vertices.size();
+
+  // The fixed subplan becomes the first vertex, the other vertices keep their order. Their plans from the plan table
+  // already contain their local predicates.
+  auto vertices = std::vector<std::shared_ptr<AbstractLQPNode>>{plan_table.at(fixed_vertex_set).first};
+  auto new_vertex_indices = std::vector<size_t>(vertex_count, 0);
+  for (auto vertex_idx = size_t{0}; vertex_idx < vertex_count; ++vertex_idx) {
+    if (fixed_vertex_set.test(vertex_idx)) {
+      continue;
+    }
+
+    auto single_vertex_set = JoinGraphVertexSet{vertex_count};
+    single_vertex_set.set(vertex_idx);
+    new_vertex_indices[vertex_idx] = vertices.size();
+    vertices.emplace_back(plan_table.at(single_vertex_set).first);
+  }
+
+  // Local predicates are part of the vertices' plans, the predicates of edges within the fixed vertex set are part of
+  // its plan.
+  auto edges = std::vector<JoinGraphEdge>{};
+  for (const auto& edge : join_graph.edges) {
+    if (edge.vertex_set.count() < 2 || edge.vertex_set.is_subset_of(fixed_vertex_set)) {
+      continue;
+    }
+
+    auto vertex_set = JoinGraphVertexSet{vertices.size()};
+    for (auto vertex_idx = edge.vertex_set.find_first(); vertex_idx != JoinGraphVertexSet::npos;
+         vertex_idx = edge.vertex_set.find_next(vertex_idx)) {
+      vertex_set.set(new_vertex_indices[vertex_idx]);
+    }
+
+    auto right_vertex_idx = std::optional<size_t>{};
+    if (edge.right_vertex_idx) {
+      right_vertex_idx = new_vertex_indices[*edge.right_vertex_idx];
+    }
+
+    edges.emplace_back(vertex_set, edge.predicates, edge.join_mode, right_vertex_idx);
+  }
+
+  return JoinGraph{vertices, edges};
+}
+
+}  // namespace hyrise
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <memory>
+
+#include "abstract_join_ordering_algorithm.hpp"
+#include "dp_hyp.hpp"
+
+namespace hyrise {
+
+class AbstractCostEstimator;
+class JoinGraph;
+
+/**
+ * Join ordering algorithm for join graphs of any size, based on iterative dynamic programming (IDP1 as described in
+ * "Iterative Dynamic Programming: A New Class of Query Optimization Algorithms",
+ * https://dl.acm.org/doi/10.1145/352958.352982).
+ *
+ * If DpHyp builds at most `max_candidate_join_count` candidate joins for the entire JoinGraph, its optimal plan is
+ * returned. Otherwise, DpHyp is restricted to subplans of k vertices, with k being chosen as large as possible while
+ * staying within the budget. The cheapest subplan of k vertices is then fixed, its vertices are replaced by a single
+ * vertex, and the process is repeated for the smaller JoinGraph. Thus, the planning time is bounded for JoinGraphs of
+ * any size and shape, while the plans are optimal for small graphs and close to optimal for large ones.
+ *
+ * The budget counts candidate joins instead of measuring the time so that the resulting plans are deterministic.
+ */
+class IterativeDpHyp final : public AbstractJoinOrderingAlgorithm {
+ public:
+  // Enough to plan cliques of nine vertices, stars of eleven vertices, or chains of 39 vertices optimally.
+  static constexpr auto DEFAULT_MAX_CANDIDATE_JOIN_COUNT = size_t{10'000};
+
+  explicit IterativeDpHyp(const size_t init_max_candidate_join_count = DEFAULT_MAX_CANDIDATE_JOIN_COUNT);
+
+  std::shared_ptr<AbstractLQPNode> operator()(const JoinGraph& join_graph,
+                                              const std::shared_ptr<AbstractCostEstimator>& cost_estimator) override;
+
+ private:
+  // Returns the largest number of vertices per subplan for which all iterations are expected to stay within budget.
+  size_t _max_vertex_set_size(const JoinGraph& join_graph) const;
+
+  // Replaces the vertices of `fixed_vertex_set` by a single vertex holding their plan.
+  static JoinGraph _contract(const JoinGraph& join_graph, const DpHyp::PlanTable& plan_table,
+                             const JoinGraphVertexSet& fixed_vertex_set);
+
+  const size_t _max_candidate_join_count;
+};
+
+}  // namespace hyrise
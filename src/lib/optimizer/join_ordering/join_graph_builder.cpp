@@ -7,6 +7,7 @@
 #include "logical_query_plan/join_node.hpp"
 #include "logical_query_plan/predicate_node.hpp"
 #include "logical_query_plan/union_node.hpp"
+#include "operators/operator_join_predicate.hpp"
 #include "utils/assert.hpp"
 
 #include "join_graph_edge.hpp"
@@ -27,6 +28,15 @@ std::optional<JoinGraph> JoinGraphBuilder::operator()(const std::shared_ptr<Abst
    * Turn the predicates into JoinEdges and build the JoinGraph
    */
   auto edges = _join_edges_from_predicates(_vertices, _predicates);
+  for (const auto& [join_node, right_vertex_idx] : _semi_and_anti_joins) {
+    const auto& join_predicates = join_node->join_predicates();
+    auto vertex_set = JoinGraphVertexSet{_vertices.size()};
+    for (const auto& join_predicate : join_predicates) {
+      vertex_set |= _get_vertex_set_accessed_by_expression(*join_predicate, _vertices);
+    }
+    edges.emplace_back(vertex_set, join_predicates, join_node->join_mode, right_vertex_idx);
+  }
+
   auto cross_edges = _cross_edges_between_components(_vertices, edges);
 
   edges.insert(edges.end(), cross_edges.begin(), cross_edges.end());
@@ -55,6 +65,10 @@ void JoinGraphBuilder::_traverse(const std::shared_ptr<AbstractLQPNode>& node) {
       /**
        * Cross joins are simply being traversed past. Outer joins are hard to address during join ordering and until we
        * do outer joins are opaque: The outer join node is added as a vertex and traversal stops at this point.
+       *
+       * Semi and anti joins filter their left input. Thus, they can be reordered with the inner joins in their left
+       * input as long as their right input is not joined with anything else. We traverse their left input and add
+       * their right input as a vertex. Their predicates form an edge of their own (see JoinGraphEdge).
        */
 
       const auto join_node = std::static_pointer_cast<JoinNode>(node);
@@ -67,6 +81,14 @@ void JoinGraphBuilder::_traverse(const std::shared_ptr<AbstractLQPNode>& node) {
       if (join_node->join_mode == JoinMode::Inner || join_node->join_mode == JoinMode::Cross) {
         _traverse(node->left_input());
         _traverse(node->right_input());
+      } else if (is_semi_or_anti_join(join_node->join_mode) &&
+                 OperatorJoinPredicate::from_expression(*join_node->join_predicates().front(), *node->left_input(),
+                                                        *node->right_input())) {
+        // The primary predicate references both inputs. Thus, the edge of the join references the right vertex and
+        // at least one vertex of the left input.
+        _traverse(node->left_input());
+        _semi_and_anti_joins.emplace_back(join_node, _vertices.size());
+        _vertices.emplace_back(node->right_input());
       } else {
         _vertices.emplace_back(node);
       }
@@ -157,6 +179,9 @@ std::vector<JoinGraphEdge> JoinGraphBuilder::_cross_edges_between_components(
    *
    * where the edges AD and DF are being created and have no predicates. There is of course the theoretical chance that
    * different edges, say CD and EF would result in a better plan. We ignore this possibility for now.
+   *
+   * The right vertices of semi and anti joins must only be joined via the edge of their join. They are connected by
+   * this edge and are not part of any component.
    */
 
   std::unordered_set<size_t> remaining_vertex_indices;
@@ -164,6 +189,12 @@ std::vector<JoinGraphEdge> JoinGraphBuilder::_cross_edges_between_components(
     remaining_vertex_indices.insert(vertex_idx);
   }
 
+  for (const auto& edge : edges) {
+    if (edge.right_vertex_idx) {
+      remaining_vertex_indices.erase(*edge.right_vertex_idx);
+    }
+  }
+
   std::vector<size_t> one_vertex_per_component;
 
   while (!remaining_vertex_indices.empty()) {
@@ -186,7 +217,8 @@ std::vector<JoinGraphEdge> JoinGraphBuilder::_cross_edges_between_components(
         // Also skip hyperedges, as hyperedges do not connect components; components connected only by a hyperedge
         //    need a cross join edge between them anyway. DPccp needs the JoinGraphs to be connected without relying on
         //    the hyperedges
-        if (!edge.vertex_set.test(vertex_idx2) || edge.vertex_set.count() != 2) {
+        // Edges of semi and anti joins are skipped, too (see above).
+        if (!edge.vertex_set.test(vertex_idx2) || edge.vertex_set.count() != 2 || edge.right_vertex_idx) {
           ++iter;
           continue;
         }
@@ -4,6 +4,7 @@
 #include <memory>
 #include <optional>
 #include <set>
+#include <utility>
 #include <vector>
 
 #include "join_graph.hpp"
@@ -88,5 +89,8 @@ class JoinGraphBuilder final {
 
   std::vector<std::shared_ptr<AbstractLQPNode>> _vertices;
   std::vector<std::shared_ptr<AbstractExpression>> _predicates;
+
+  // Semi and anti joins that are reordered and the index of the vertex of their right input.
+  std::vector<std::pair<std::shared_ptr<JoinNode>, size_t>> _semi_and_anti_joins;
 };
 }  // namespace hyrise
@@ -5,12 +5,24 @@
 namespace hyrise {
 
 JoinGraphEdge::JoinGraphEdge(const JoinGraphVertexSet& init_vertex_set,
-                             const std::vector<std::shared_ptr<AbstractExpression>>& init_predicates)
-    : vertex_set(init_vertex_set), predicates(init_predicates) {}
+                             const std::vector<std::shared_ptr<AbstractExpression>>& init_predicates,
+                             const JoinMode init_join_mode, const std::optional<size_t>& init_right_vertex_idx)
+    : vertex_set(init_vertex_set),
+      predicates(init_predicates),
+      join_mode(init_join_mode),
+      right_vertex_idx(init_right_vertex_idx) {
+  Assert(join_mode == JoinMode::Inner || is_semi_or_anti_join(join_mode), "Unexpected JoinMode for JoinGraphEdge.");
+  Assert((join_mode == JoinMode::Inner) == !right_vertex_idx, "Only semi and anti join edges have a right vertex.");
+  Assert(!right_vertex_idx || (vertex_set.test(*right_vertex_idx) && vertex_set.count() > 1),
+         "Semi and anti join edges must reference their right vertex and at least one other vertex.");
+}
 
 std::ostream& operator<<(std::ostream& stream, const JoinGraphEdge& join_graph_edge) {
-  stream << "Vertices: " << join_graph_edge.vertex_set << "; " << join_graph_edge.predicates.size() << " predicates"
-         << std::endl;
+  stream << "Vertices: " << join_graph_edge.vertex_set << "; " << join_graph_edge.predicates.size() << " predicates";
+  if (join_graph_edge.right_vertex_idx) {
+    stream << "; " << join_graph_edge.join_mode << " join with right vertex " << *join_graph_edge.right_vertex_idx;
+  }
+  stream << std::endl;
   for (const auto& predicate : join_graph_edge.predicates) {
     stream << predicate->as_column_name() << std::endl;
   }
@@ -2,10 +2,13 @@
 
 #include <iostream>
 #include <memory>
+#include <optional>
+#include <vector>
 
 #include <boost/container_hash/hash.hpp>
 #include <boost/dynamic_bitset.hpp>
 
+#include "types.hpp"
 #include "utils/assert.hpp"
 
 namespace hyrise {
@@ -26,16 +29,28 @@ using JoinGraphVertexSet = boost::dynamic_bitset<>;
  * Each predicate must operate exactly on the vertices in vertex_set. That is, each predicate must reference columns
  * from all vertices in vertex_set and no columns from vertices not in vertex_set. If the predicate wouldn't, then it
  * would belong to another edge.
+ *
+ * Edges of semi and anti joins hold all predicates of the join. These have to be evaluated by a single JoinNode with
+ * the vertex at right_vertex_idx as its right input and all other vertices of vertex_set in its left input. As the
+ * columns of the right vertex are not visible above the join, no other edge references it.
  */
 struct JoinGraphEdge final {
  public:
   // Doesn't check that the predicates actually only reference the vertex_set, since it has no knowledge of
   // LQPNode -> vertex index mapping. Thus, the caller has to ensure validity.
   explicit JoinGraphEdge(const JoinGraphVertexSet& init_vertex_set,
-                         const std::vector<std::shared_ptr<AbstractExpression>>& init_predicates = {});
+                         const std::vector<std::shared_ptr<AbstractExpression>>& init_predicates = {},
+                         const JoinMode init_join_mode = JoinMode::Inner,
+                         const std::optional<size_t>& init_right_vertex_idx = std::nullopt);
 
   JoinGraphVertexSet vertex_set;
   std::vector<std::shared_ptr<AbstractExpression>> predicates;
+
+  // Inner for edges of inner joins, cross joins, and predicates. Otherwise, a semi or anti join mode.
+  JoinMode join_mode;
+
+  // Only set for semi and anti joins.
+  std::optional<size_t> right_vertex_idx;
 };
 
 std::ostream& operator<<(std::ostream& stream, const JoinGraphEdge& join_graph_edge);
@@ -1,8 +1,10 @@
 #include "optimizer.hpp"
 
+#include "cost_estimation/cost_estimator_calibrated.hpp"
 #include "cost_estimation/cost_estimator_logical.hpp"
 #include "expression/expression_utils.hpp"
 #include "expression/lqp_subquery_expression.hpp"
+#include "hyrise.hpp"
 #include "logical_query_plan/aggregate_node.hpp"
 #include "logical_query_plan/logical_plan_root_node.hpp"
 #include "logical_query_plan/lqp_utils.hpp"
@@ -22,9 +24,11 @@
 #include "strategy/predicate_placement_rule.hpp"
 #include "strategy/predicate_reordering_rule.hpp"
 #include "strategy/predicate_split_up_rule.hpp"
+#include "strategy/runtime_filter_rule.hpp"
 #include "strategy/semi_join_reduction_rule.hpp"
 #include "strategy/stored_table_column_alignment_rule.hpp"
 #include "strategy/subquery_to_join_rule.hpp"
+#include "strategy/top_k_rule.hpp"
 #include "utils/timer.hpp"
 
 namespace {
@@ -112,6 +116,7 @@ void validate_lqp_with_uncorrelated_subqueries(const std::shared_ptr<const Abstr
     // Check that the node has the expected number of inputs.
     auto num_expected_inputs = size_t{0};
     switch (node->type) {
+      case LQPNodeType::CreateIndex:
       case LQPNodeType::CreatePreparedPlan:
       case LQPNodeType::CreateView:
       case LQPNodeType::DummyTable:
@@ -176,6 +181,11 @@ OptimizerRuleMetrics::OptimizerRuleMetrics(const std::string& init_rule_name,
  */
 std::shared_ptr<Optimizer> Optimizer::create_default_optimizer() {
   auto optimizer = std::make_shared<Optimizer>();
+  if (const auto& cost_model = Hyrise::get().cost_model) {
+    // Order joins based on the runtimes of the physical operators that the LQPTranslator chooses.
+    optimizer = std::make_shared<Optimizer>(
+        std::make_shared<CostEstimatorCalibrated>(std::make_shared<CardinalityEstimator>(), cost_model));
+  }
 
   optimizer->add_rule(std::make_unique<ExpressionReductionRule>());
 
@@ -183,9 +193,8 @@ std::shared_ptr<Optimizer> Optimizer::create_default_optimizer() {
   // JoinOrderingRule cannot handle UnionNodes (#1829), do not split disjunctions just yet.
   optimizer->add_rule(std::make_unique<PredicateSplitUpRule>(false));
 
-  // The JoinOrderingRule cannot proceed past Semi/Anti Joins. These may be part of the initial query plan (in which
-  // case we are out of luck and the join ordering will be sub-optimal) but many of them are also introduced by the
-  // SubqueryToJoinRule. As such, we run the JoinOrderingRule before the SubqueryToJoinRule.
+  // Order the joins of the initial query plan. Semi and anti joins introduced by the SubqueryToJoinRule and the
+  // JoinToSemiJoinRule are ordered by a second run of the JoinOrderingRule below.
   optimizer->add_rule(std::make_unique<JoinOrderingRule>());
 
   // Run Group-By Reduction after the JoinOrderingRule ran. The actual join order is not important, but the matching
@@ -206,13 +215,19 @@ std::shared_ptr<Optimizer> Optimizer::create_default_optimizer() {
   optimizer->add_rule(std::make_unique<ColumnPruningRule>());
 
   // Run the JoinToSemiJoinRule and the JoinToPredicateRewriteRule before the PredicatePlacementRule, as they might turn
-  // joins into semi joins (which are treated as predicates) or predicates that can be pushed further down. For the same
-  // reason, run them after the JoinOrderingRule, which does not like semi joins (see above). Furthermore, these two
-  // rules depend on the ColumnPruningRule that flags joins where one input is not used later in the query plan.
+  // joins into semi joins (which are treated as predicates) or predicates that can be pushed further down.
+  // Furthermore, these two rules depend on the ColumnPruningRule that flags joins where one input is not used later in
+  // the query plan.
   optimizer->add_rule(std::make_unique<JoinToSemiJoinRule>());
 
   optimizer->add_rule(std::make_unique<JoinToPredicateRewriteRule>());
 
+  // Order the JoinGraphs that contain the semi and anti joins created by the SubqueryToJoinRule and the
+  // JoinToSemiJoinRule, together with the inner joins around them. Graphs without such joins keep the order of the
+  // first run. Run it before the SemiJoinReductionRule, whose semi joins are only reductions and not meant to be
+  // reordered, and before the PredicatePlacementRule, which places the predicates below the reordered joins.
+  optimizer->add_rule(std::make_unique<JoinOrderingRule>(true));
+
   // The SemiJoinReductionRule is very sensitive to the predicate placement and order present when it is applied. In
   // general, running the PredicatePlacementRule and the PredicateReorderingRule before the SemiJoinReductionRule is
   // beneficial. However, TPC-H Q 21 (that is already long-running) degrades drastically. See:
@@ -248,8 +263,14 @@ std::shared_ptr<Optimizer> Optimizer::create_default_optimizer() {
 
   optimizer->add_rule(std::make_unique<IndexScanRule>());
 
+  // Runtime filters are not used for joins that are executed by a JoinIndex, so the IndexScanRule has to run first.
+  optimizer->add_rule(std::make_unique<RuntimeFilterRule>());
+
   optimizer->add_rule(std::make_unique<PredicateMergeRule>());
 
+  // Run the TopKRule last, as it relies on SortNodes and LimitNodes being adjacent in the final plan.
+  optimizer->add_rule(std::make_unique<TopKRule>());
+
   return optimizer;
 }
 
@@ -321,4 +342,8 @@ void Optimizer::validate_lqp(const std::shared_ptr<AbstractLQPNode>& root_node)
   }
 }
 
+const std::shared_ptr<AbstractCostEstimator>& Optimizer::cost_estimator() const {
+  return _cost_estimator;
+}
+
 }  // namespace hyrise
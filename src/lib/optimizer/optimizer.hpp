@@ -44,6 +44,8 @@ class Optimizer final {
 
   static void validate_lqp(const std::shared_ptr<AbstractLQPNode>& root_node);
 
+  const std::shared_ptr<AbstractCostEstimator>& cost_estimator() const;
+
  private:
   std::vector<std::unique_ptr<AbstractRule>> _rules;
   std::shared_ptr<AbstractCostEstimator> _cost_estimator;
@@ -65,6 +65,7 @@ ExpressionUnorderedSet gather_locally_required_expressions(
     // For the vast majority of node types, AbstractLQPNode::node_expression holds all expressions required by this
     // node.
     case LQPNodeType::Alias:
+    case LQPNodeType::CreateIndex:
     case LQPNodeType::CreatePreparedPlan:
     case LQPNodeType::CreateView:
     case LQPNodeType::DropView:
@@ -161,17 +162,25 @@ ExpressionUnorderedSet gather_locally_required_expressions(
 
         case SetOperationMode::All: {
           // Similarly, if the two input tables are only glued together, the UnionNode itself does not require any
-          // expressions. Currently, this mode is used to merge the result of two mutually exclusive or conditions (see
-          // PredicateSplitUpRule). Once we have a union operator that merges data from different tables, we have to
-          // look into this more deeply.
-          Assert(union_node.left_input()->output_expressions() == union_node.right_input()->output_expressions(),
-                 "Can only handle SetOperationMode::All if both inputs have the same expressions");
+          // expressions. This holds if the union merges the result of two mutually exclusive or conditions (see
+          // PredicateSplitUpRule), where both inputs have the same expressions. For SQL's UNION ALL, the columns of
+          // both inputs are matched by their position. Pruning a column on one side only would shift the columns of
+          // that side, so we require all expressions from both inputs.
+          const auto& left_input_expressions = union_node.left_input()->output_expressions();
+          const auto& right_input_expressions = union_node.right_input()->output_expressions();
+          if (!expressions_equal(left_input_expressions, right_input_expressions)) {
+            locally_required_expressions.insert(left_input_expressions.begin(), left_input_expressions.end());
+            locally_required_expressions.insert(right_input_expressions.begin(), right_input_expressions.end());
+          }
         } break;
 
         case SetOperationMode::Unique: {
-          // This probably needs all expressions, as all of them are used to establish uniqueness
-          Fail("SetOperationMode::Unique is not supported yet");
-        }
+          // All expressions are used to establish uniqueness.
+          const auto& left_input_expressions = union_node.left_input()->output_expressions();
+          const auto& right_input_expressions = union_node.right_input()->output_expressions();
+          locally_required_expressions.insert(left_input_expressions.begin(), left_input_expressions.end());
+          locally_required_expressions.insert(right_input_expressions.begin(), right_input_expressions.end());
+        } break;
       }
     } break;
 
@@ -190,13 +199,10 @@ ExpressionUnorderedSet gather_locally_required_expressions(
       locally_required_expressions.insert(window.arguments.begin(), window.arguments.end());
     } break;
 
+    // No pruning of the input columns for these nodes as they need them all. Intersect and Except compare the rows of
+    // both inputs by all of their columns.
     case LQPNodeType::Intersect:
-    case LQPNodeType::Except: {
-      Fail("Intersect and Except are not supported yet");
-      // Not sure what needs to happen here. That partially depends on how intersect and except are finally implemented.
-    } break;
-
-    // No pruning of the input columns for these nodes as they need them all.
+    case LQPNodeType::Except:
     case LQPNodeType::CreateTable:
     case LQPNodeType::Delete:
     case LQPNodeType::Insert:
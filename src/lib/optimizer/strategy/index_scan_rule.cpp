@@ -3,12 +3,19 @@
 #include <algorithm>
 #include <iostream>
 #include <memory>
+#include <optional>
 #include <string>
 #include <vector>
 
 #include "all_parameter_variant.hpp"
 #include "cost_estimation/abstract_cost_estimator.hpp"
+#include "expression/binary_predicate_expression.hpp"
+#include "expression/expression_utils.hpp"
+#include "expression/lqp_column_expression.hpp"
+#include "expression/value_expression.hpp"
+#include "hyrise.hpp"
 #include "logical_query_plan/abstract_lqp_node.hpp"
+#include "logical_query_plan/join_node.hpp"
 #include "logical_query_plan/lqp_utils.hpp"
 #include "logical_query_plan/predicate_node.hpp"
 #include "logical_query_plan/stored_table_node.hpp"
@@ -25,6 +32,34 @@ constexpr float INDEX_SCAN_SELECTIVITY_THRESHOLD = 0.01f;
 // Only if the number of input rows exceeds num_input_rows, the ScanType can be set to IndexScan.
 // The number is taken from: Fast Lookups for In-Memory Column Stores: Group-Key Indices, Lookup and Maintenance.
 constexpr float INDEX_SCAN_ROW_COUNT_THRESHOLD = 1000.0f;
+
+using namespace hyrise;  // NOLINT
+
+// Returns the StoredTableNode below a PredicateNode or JoinNode if it is the node's direct input or only separated by a
+// ValidateNode. In both cases, the translated operators can access the stored table's RowIDs.
+std::shared_ptr<StoredTableNode> stored_table_node_below(const std::shared_ptr<AbstractLQPNode>& node) {
+  auto input_node = node;
+  if (input_node->type == LQPNodeType::Validate) {
+    input_node = input_node->left_input();
+  }
+  return std::dynamic_pointer_cast<StoredTableNode>(input_node);
+}
+
+// Returns the column of the stored table that `expression` refers to if the table has a table index on it.
+std::optional<ColumnID> table_indexed_column_id(const std::shared_ptr<AbstractExpression>& expression,
+                                                const std::shared_ptr<StoredTableNode>& stored_table_node) {
+  const auto column_expression = std::dynamic_pointer_cast<LQPColumnExpression>(expression);
+  if (!column_expression || column_expression->original_node.lock() != stored_table_node) {
+    return std::nullopt;
+  }
+
+  const auto table = Hyrise::get().storage_manager.get_table(stored_table_node->table_name);
+  if (table->get_table_indexes(column_expression->original_column_id).empty()) {
+    return std::nullopt;
+  }
+  return column_expression->original_column_id;
+}
+
 }  // namespace
 
 namespace hyrise {
@@ -41,9 +76,16 @@ void IndexScanRule::_apply_to_plan_without_subqueries(const std::shared_ptr<Abst
   visit_lqp(lqp_root, [&](const auto& node) {
     if (node->type == LQPNodeType::Predicate) {
       const auto& child = node->left_input();
+      const auto predicate_node = std::dynamic_pointer_cast<PredicateNode>(node);
+
+      // A lookup in the primary key index is cheaper than any scan, independent of the selectivity. It replaces the
+      // PredicateNodes below, so they do not need to be visited.
+      if (find_primary_key_predicates(predicate_node)) {
+        predicate_node->scan_type = ScanType::IndexScan;
+        return LQPVisitation::DoNotVisitInputs;
+      }
 
       if (child->type == LQPNodeType::StoredTable) {
-        const auto predicate_node = std::dynamic_pointer_cast<PredicateNode>(node);
         const auto stored_table_node = std::dynamic_pointer_cast<StoredTableNode>(child);
 
         const auto indexes_statistics = stored_table_node->chunk_indexes_statistics();
@@ -53,6 +95,12 @@ void IndexScanRule::_apply_to_plan_without_subqueries(const std::shared_ptr<Abst
           }
         }
       }
+
+      if (predicate_node->scan_type == ScanType::TableScan && _is_table_index_scan_applicable(predicate_node)) {
+        predicate_node->scan_type = ScanType::IndexScan;
+      }
+    } else if (node->type == LQPNodeType::Join) {
+      _set_join_index_side(std::static_pointer_cast<JoinNode>(node));
     }
 
     return LQPVisitation::VisitInputs;
@@ -86,6 +134,41 @@ bool IndexScanRule::_is_index_scan_applicable(const ChunkIndexStatistics& index_
     return false;
   }
 
+  return _is_selective(predicate_node);
+}
+
+bool IndexScanRule::_is_table_index_scan_applicable(const std::shared_ptr<PredicateNode>& predicate_node) const {
+  const auto stored_table_node = stored_table_node_below(predicate_node->left_input());
+  if (!stored_table_node) {
+    return false;
+  }
+
+  // The LQPTranslator expects the predicate in the form <column> = <value>.
+  const auto predicate = std::dynamic_pointer_cast<BinaryPredicateExpression>(predicate_node->predicate());
+  if (!predicate || predicate->predicate_condition != PredicateCondition::Equals) {
+    return false;
+  }
+
+  const auto value_expression = std::dynamic_pointer_cast<ValueExpression>(predicate->right_operand());
+  if (!value_expression || variant_is_null(value_expression->value)) {
+    return false;
+  }
+
+  // Values of a different data type are converted to the column's data type when the index is probed. We do not
+  // convert between strings and numbers.
+  const auto column_is_string = predicate->left_operand()->data_type() == DataType::String;
+  if (column_is_string != (value_expression->data_type() == DataType::String)) {
+    return false;
+  }
+
+  if (!table_indexed_column_id(predicate->left_operand(), stored_table_node)) {
+    return false;
+  }
+
+  return _is_selective(predicate_node);
+}
+
+bool IndexScanRule::_is_selective(const std::shared_ptr<PredicateNode>& predicate_node) const {
   const auto row_count_table =
       cost_estimator->cardinality_estimator->estimate_cardinality(predicate_node->left_input());
   if (row_count_table < INDEX_SCAN_ROW_COUNT_THRESHOLD) {
@@ -98,6 +181,60 @@ bool IndexScanRule::_is_index_scan_applicable(const ChunkIndexStatistics& index_
   return selectivity <= INDEX_SCAN_SELECTIVITY_THRESHOLD;
 }
 
+void IndexScanRule::_set_join_index_side(const std::shared_ptr<JoinNode>& join_node) const {
+  join_node->index_side.reset();
+
+  // JoinIndex only supports single-predicate inner joins if the index side is a reference table (i.e., if there is a
+  // ValidateNode). Table indexes can only be probed for equality.
+  if (join_node->join_mode != JoinMode::Inner || join_node->join_predicates().size() != 1) {
+    return;
+  }
+
+  const auto predicate = std::dynamic_pointer_cast<BinaryPredicateExpression>(join_node->join_predicates().front());
+  if (!predicate || predicate->predicate_condition != PredicateCondition::Equals ||
+      predicate->left_operand()->data_type() != predicate->right_operand()->data_type()) {
+    return;
+  }
+
+  const auto& estimator = *cost_estimator->cardinality_estimator;
+  for (const auto index_side : {LQPInputSide::Right, LQPInputSide::Left}) {
+    const auto index_input = join_node->input(index_side);
+    const auto probe_input = join_node->input(index_side == LQPInputSide::Left ? LQPInputSide::Right
+                                                                               : LQPInputSide::Left);
+
+    const auto stored_table_node = stored_table_node_below(index_input);
+    if (!stored_table_node || !stored_table_node->pruned_chunk_ids().empty()) {
+      continue;
+    }
+
+    // Find the join column of the index side.
+    auto index_column_id = std::optional<ColumnID>{};
+    for (const auto& operand : {predicate->left_operand(), predicate->right_operand()}) {
+      if (expression_evaluable_on_lqp(operand, *index_input)) {
+        index_column_id = table_indexed_column_id(operand, stored_table_node);
+      }
+    }
+    if (!index_column_id) {
+      continue;
+    }
+
+    // GetTable only forwards the table indexes if the indexed column keeps its ColumnID, see GetTable::_on_execute.
+    const auto& pruned_column_ids = stored_table_node->pruned_column_ids();
+    if (!pruned_column_ids.empty() && pruned_column_ids.front() <= *index_column_id) {
+      continue;
+    }
+
+    const auto index_row_count = estimator.estimate_cardinality(index_input);
+    if (index_row_count < INDEX_SCAN_ROW_COUNT_THRESHOLD ||
+        estimator.estimate_cardinality(probe_input) > index_row_count * INDEX_SCAN_SELECTIVITY_THRESHOLD) {
+      continue;
+    }
+
+    join_node->index_side = index_side;
+    return;
+  }
+}
+
 bool IndexScanRule::_is_single_segment_index(const ChunkIndexStatistics& index_statistics) {
   return index_statistics.column_ids.size() == 1;
 }
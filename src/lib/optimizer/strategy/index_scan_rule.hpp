@@ -11,6 +11,7 @@
 namespace hyrise {
 
 class AbstractLQPNode;
+class JoinNode;
 class PredicateNode;
 
 /**
@@ -23,6 +24,15 @@ class PredicateNode;
  * not supported. We also assume that if chunks have an index, all of them are of the same type, we do not mix GroupKey
  * and ART indexes. In addition, chains of IndexScans are not possible since an IndexScan's input must be a GetTable.
  * Currently, only GroupKeyIndexes are supported.
+ *
+ * Table indexes (see Table::create_table_index) are used for equality predicates on a StoredTableNode, optionally with
+ * a ValidateNode in between. In addition, the rule marks the index side of inner equi-joins if one input is a stored
+ * table with a table index on the join column and the other input is small compared to it. These joins are executed
+ * by the JoinIndex, which probes the index for each row of the smaller input.
+ *
+ * If a chain of PredicateNodes binds all columns of a table's PrimaryKeyIndex to values (see
+ * find_primary_key_predicates), the topmost node of the chain is marked as an IndexScan regardless of its
+ * selectivity. The LQPTranslator then replaces the chain by a PrimaryKeyLookup.
  */
 
 class IndexScanRule : public AbstractRule {
@@ -33,6 +43,9 @@ class IndexScanRule : public AbstractRule {
   void _apply_to_plan_without_subqueries(const std::shared_ptr<AbstractLQPNode>& lqp_root) const override;
   bool _is_index_scan_applicable(const ChunkIndexStatistics& index_statistics,
                                  const std::shared_ptr<PredicateNode>& predicate_node) const;
+  bool _is_table_index_scan_applicable(const std::shared_ptr<PredicateNode>& predicate_node) const;
+  bool _is_selective(const std::shared_ptr<PredicateNode>& predicate_node) const;
+  void _set_join_index_side(const std::shared_ptr<JoinNode>& join_node) const;
   static bool _is_single_segment_index(const ChunkIndexStatistics& index_statistics);
 };
 
@@ -1,10 +1,12 @@
 #include "join_ordering_rule.hpp"
 
+#include <algorithm>
+
 #include "cost_estimation/abstract_cost_estimator.hpp"
 #include "expression/expression_utils.hpp"
 #include "logical_query_plan/projection_node.hpp"
 #include "optimizer/join_ordering/dp_ccp.hpp"
-#include "optimizer/join_ordering/greedy_operator_ordering.hpp"
+#include "optimizer/join_ordering/iterative_dp_hyp.hpp"
 #include "optimizer/join_ordering/join_graph.hpp"
 #include "statistics/abstract_cardinality_estimator.hpp"
 #include "statistics/cardinality_estimation_cache.hpp"
@@ -13,6 +15,9 @@
 
 namespace hyrise {
 
+JoinOrderingRule::JoinOrderingRule(const bool only_semi_and_anti_join_graphs)
+    : _only_semi_and_anti_join_graphs(only_semi_and_anti_join_graphs) {}
+
 std::string JoinOrderingRule::name() const {
   static const auto name = std::string{"JoinOrderingRule"};
   return name;
@@ -50,12 +55,40 @@ std::shared_ptr<AbstractLQPNode> JoinOrderingRule::_perform_join_ordering_recurs
    *        -> look for more JoinGraphs below the JoinGraph's vertices
    */
 
-  const auto join_graph = JoinGraph::build_from_lqp(lqp);
+  auto join_graph = JoinGraph::build_from_lqp(lqp);
   if (!join_graph) {
     _recurse_to_inputs(lqp);
     return lqp;
   }
 
+  if (_only_semi_and_anti_join_graphs) {
+    const auto has_semi_or_anti_join =
+        std::any_of(join_graph->edges.begin(), join_graph->edges.end(), [](const auto& edge) {
+          return edge.join_mode == JoinMode::Semi || edge.join_mode == JoinMode::AntiNullAsTrue ||
+                 edge.join_mode == JoinMode::AntiNullAsFalse;
+        });
+    if (!has_semi_or_anti_join) {
+      // Keep the order of the graph's joins, but look for semi and anti joins below them.
+      _recurse_to_inputs(lqp);
+      return lqp;
+    }
+  }
+
+  /**
+   * Order the joins within the vertices first. Most vertices are opaque nodes (e.g., outer joins), whose inputs are
+   * ordered. The right inputs of semi and anti joins, however, are arbitrary subplans and might be JoinGraphs of their
+   * own. In this case, the vertex is replaced by its ordered plan.
+   */
+  auto ordered_vertices = join_graph->vertices;
+  for (auto& vertex : ordered_vertices) {
+    vertex = _perform_join_ordering_recursively(vertex);
+  }
+
+  if (ordered_vertices != join_graph->vertices) {
+    const auto edges = join_graph->edges;
+    join_graph.emplace(ordered_vertices, edges);
+  }
+
   /**
    * Setup Cardinality and Cost Estimation caches
    *
@@ -70,22 +103,21 @@ std::shared_ptr<AbstractLQPNode> JoinOrderingRule::_perform_join_ordering_recurs
 
   /**
    * Select and call the actual Join Ordering Algorithm
-   * Simple heuristic: Use DpCcp for any query with less than X tables and GOO for everything more complex
+   * Simple heuristic: Use DpCcp for graphs with less than nine vertices and only inner joins. Use IterativeDpHyp for
+   * everything more complex, which is optimal as long as the JoinGraph is small enough for the planning to stay within
+   * its budget and bounds the planning time otherwise.
    */
-  // TODO(anybody) Increase X once our costing/cardinality estimation is faster/uses internal caching
+  const auto only_inner_joins = std::all_of(join_graph->edges.begin(), join_graph->edges.end(),
+                                           [](const auto& edge) { return edge.join_mode == JoinMode::Inner; });
   auto result_lqp = std::shared_ptr<AbstractLQPNode>{};
   DebugAssert(!join_graph->vertices.empty(), "There should be nodes in the join graph.");
   if (join_graph->vertices.size() == 1) {
     // a join graph with only one vertex is no actual join and needs no ordering
     result_lqp = lqp;
-  } else if (join_graph->vertices.size() < 9) {
+  } else if (join_graph->vertices.size() < 9 && only_inner_joins) {
     result_lqp = DpCcp{}(*join_graph, caching_cost_estimator);  // NOLINT - doesn't like `{}()`
   } else {
-    result_lqp = GreedyOperatorOrdering{}(*join_graph, caching_cost_estimator);  // NOLINT - doesn't like `{}()`
-  }
-
-  for (const auto& vertex : join_graph->vertices) {
-    _recurse_to_inputs(vertex);
+    result_lqp = IterativeDpHyp{}(*join_graph, caching_cost_estimator);  // NOLINT - doesn't like `{}()`
   }
 
   return result_lqp;
@@ -10,10 +10,20 @@ class AbstractCostEstimator;
 
 /**
  * A rule that brings join operations into a (supposedly) efficient order.
- * Currently only the order of inner joins is modified using a single underlying algorithm, DpCcp.
+ * The JoinGraph of a subplan consists of its inner joins and its semi and anti joins. For the latter, the left input
+ * is part of the graph and the right input becomes a vertex that can only be joined via the semi/anti join's own edge.
+ * Outer joins and all other nodes that are not part of the graph are opaque vertices, whose inputs are ordered
+ * separately. Small graphs of only inner joins are ordered with DpCcp, all others with IterativeDpHyp, which bounds the
+ * planning effort for large graphs.
+ *
+ * If @param only_semi_and_anti_join_graphs is set, only JoinGraphs that contain semi or anti joins are ordered. This
+ * allows a second run after the rules that create semi and anti joins (e.g., the SubqueryToJoinRule) without
+ * reordering the plans that the first run already ordered.
  */
 class JoinOrderingRule : public AbstractRule {
  public:
+  explicit JoinOrderingRule(const bool only_semi_and_anti_join_graphs = false);
+
   std::string name() const override;
 
  protected:
@@ -23,6 +33,8 @@ class JoinOrderingRule : public AbstractRule {
   std::shared_ptr<AbstractLQPNode> _perform_join_ordering_recursively(
       const std::shared_ptr<AbstractLQPNode>& lqp) const;
   void _recurse_to_inputs(const std::shared_ptr<AbstractLQPNode>& lqp) const;
+
+  bool _only_semi_and_anti_join_graphs;
 };
 
 }  // namespace hyrise
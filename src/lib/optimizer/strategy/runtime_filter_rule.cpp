@@ -0,0 +1,90 @@
+#include "runtime_filter_rule.hpp"
+
+#include <memory>
+#include <string>
+
+#include "cost_estimation/abstract_cost_estimator.hpp"
+#include "expression/binary_predicate_expression.hpp"
+#include "logical_query_plan/abstract_lqp_node.hpp"
+#include "logical_query_plan/join_node.hpp"
+#include "logical_query_plan/lqp_utils.hpp"
+#include "statistics/cardinality_estimator.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+// Only if we expect that num_probe_rows_with_join_partner <= num_probe_rows * selectivity_threshold, a runtime filter
+// is built. Otherwise, filtering the probe side does not pay off the costs of building the filter and probing it.
+constexpr auto RUNTIME_FILTER_SELECTIVITY_THRESHOLD = 0.5f;
+
+// Runtime filters are only built for probe inputs with at least this many rows.
+constexpr auto RUNTIME_FILTER_MIN_PROBE_ROW_COUNT = 1000.0f;
+
+// Building the filter requires a pass over the build input, which is not parallelized. Hence, large build inputs are
+// not considered.
+constexpr auto RUNTIME_FILTER_MAX_BUILD_ROW_COUNT = 5'000'000.0f;
+
+}  // namespace
+
+namespace hyrise {
+
+std::string RuntimeFilterRule::name() const {
+  static const auto name = std::string{"RuntimeFilterRule"};
+  return name;
+}
+
+void RuntimeFilterRule::_apply_to_plan_without_subqueries(const std::shared_ptr<AbstractLQPNode>& lqp_root) const {
+  DebugAssert(cost_estimator, "RuntimeFilterRule requires cost estimator to be set");
+
+  visit_lqp(lqp_root, [&](const auto& node) {
+    if (node->type == LQPNodeType::Join) {
+      _set_runtime_filter_side(std::static_pointer_cast<JoinNode>(node));
+    }
+
+    return LQPVisitation::VisitInputs;
+  });
+}
+
+void RuntimeFilterRule::_set_runtime_filter_side(const std::shared_ptr<JoinNode>& join_node) const {
+  join_node->runtime_filter_side.reset();
+
+  if ((join_node->join_mode != JoinMode::Inner && join_node->join_mode != JoinMode::Semi) || join_node->index_side) {
+    return;
+  }
+
+  // The filter is built on the primary join predicate, which has to be an equality predicate.
+  const auto predicate = std::dynamic_pointer_cast<BinaryPredicateExpression>(join_node->join_predicates().front());
+  if (!predicate || predicate->predicate_condition != PredicateCondition::Equals ||
+      predicate->left_operand()->data_type() != predicate->right_operand()->data_type()) {
+    return;
+  }
+
+  const auto& left_input = join_node->left_input();
+  const auto& right_input = join_node->right_input();
+  const auto caching_cardinality_estimator = cost_estimator->cardinality_estimator->new_instance();
+  const auto left_row_count = caching_cardinality_estimator->estimate_cardinality(left_input);
+  const auto right_row_count = caching_cardinality_estimator->estimate_cardinality(right_input);
+
+  // Semi joins only emit rows of their left input. Thus, only these rows can be dropped early.
+  const auto build_side = join_node->join_mode == JoinMode::Semi || right_row_count <= left_row_count
+                              ? LQPInputSide::Right
+                              : LQPInputSide::Left;
+  const auto build_row_count = build_side == LQPInputSide::Right ? right_row_count : left_row_count;
+  const auto probe_row_count = build_side == LQPInputSide::Right ? left_row_count : right_row_count;
+  if (build_row_count > RUNTIME_FILTER_MAX_BUILD_ROW_COUNT || probe_row_count < RUNTIME_FILTER_MIN_PROBE_ROW_COUNT) {
+    return;
+  }
+
+  // A semi join of the probe input with the build input yields the rows of the probe input that pass the filter.
+  const auto& probe_input = build_side == LQPInputSide::Right ? left_input : right_input;
+  const auto& build_input = build_side == LQPInputSide::Right ? right_input : left_input;
+  const auto semi_join_node = JoinNode::make(JoinMode::Semi, predicate, probe_input, build_input);
+  const auto passing_row_count = caching_cardinality_estimator->estimate_cardinality(semi_join_node);
+  if (passing_row_count > probe_row_count * RUNTIME_FILTER_SELECTIVITY_THRESHOLD) {
+    return;
+  }
+
+  join_node->runtime_filter_side = build_side;
+}
+
+}  // namespace hyrise
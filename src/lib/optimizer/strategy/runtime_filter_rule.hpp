@@ -0,0 +1,33 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "abstract_rule.hpp"
+
+namespace hyrise {
+
+class AbstractLQPNode;
+class JoinNode;
+
+/**
+ * This rule marks the input of equi-joins from which a RuntimeFilter should be built (see JoinNode::
+ * runtime_filter_side). The LQPTranslator pushes such filters into the GetTable, TableScan, and Validate operators on
+ * the other (probe) side, which then drop chunks and rows that cannot find a join partner. This pays off if the
+ * filtered input is large and only few of its rows find a join partner, e.g., for the fact table of a star schema that
+ * is joined with filtered dimension tables.
+ *
+ * Runtime filters are only used for inner and semi joins, where rows without a join partner do not contribute to the
+ * result. For semi joins, they are built from the right input. For inner joins, they are built from the smaller input.
+ * Joins that are executed by a JoinIndex (see IndexScanRule) do not scan their probe side and are not considered.
+ */
+class RuntimeFilterRule : public AbstractRule {
+ public:
+  std::string name() const override;
+
+ protected:
+  void _apply_to_plan_without_subqueries(const std::shared_ptr<AbstractLQPNode>& lqp_root) const override;
+  void _set_runtime_filter_side(const std::shared_ptr<JoinNode>& join_node) const;
+};
+
+}  // namespace hyrise
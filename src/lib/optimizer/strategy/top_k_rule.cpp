@@ -0,0 +1,54 @@
+#include "top_k_rule.hpp"
+
+#include <memory>
+#include <optional>
+#include <string>
+
+#include "expression/value_expression.hpp"
+#include "logical_query_plan/abstract_lqp_node.hpp"
+#include "logical_query_plan/limit_node.hpp"
+#include "logical_query_plan/lqp_utils.hpp"
+#include "resolve_type.hpp"
+#include "utils/assert.hpp"
+
+namespace hyrise {
+
+std::string TopKRule::name() const {
+  static const auto name = std::string{"TopKRule"};
+  return name;
+}
+
+void TopKRule::_apply_to_plan_without_subqueries(const std::shared_ptr<AbstractLQPNode>& lqp_root) const {
+  visit_lqp(lqp_root, [&](const auto& node) {
+    if (node->type != LQPNodeType::Limit) {
+      return LQPVisitation::VisitInputs;
+    }
+
+    const auto& input_node = node->left_input();
+    if (input_node->type != LQPNodeType::Sort || input_node->output_count() > 1) {
+      return LQPVisitation::VisitInputs;
+    }
+
+    const auto limit_node = std::static_pointer_cast<LimitNode>(node);
+    const auto value_expression = std::dynamic_pointer_cast<ValueExpression>(limit_node->num_rows_expression());
+    if (!value_expression || variant_is_null(value_expression->value)) {
+      return LQPVisitation::VisitInputs;
+    }
+
+    auto row_count = std::optional<int64_t>{};
+    resolve_data_type(value_expression->data_type(), [&](const auto data_type_t) {
+      using LimitDataType = typename decltype(data_type_t)::type;
+      if constexpr (std::is_integral_v<LimitDataType>) {
+        row_count = boost::get<LimitDataType>(value_expression->value);
+      }
+    });
+
+    if (row_count && *row_count <= MAX_ROW_COUNT) {
+      limit_node->fuse_with_sort = true;
+    }
+
+    return LQPVisitation::VisitInputs;
+  });
+}
+
+}  // namespace hyrise
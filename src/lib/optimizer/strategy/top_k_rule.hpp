@@ -0,0 +1,30 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "abstract_rule.hpp"
+
+namespace hyrise {
+
+class AbstractLQPNode;
+
+/**
+ * This rule finds LimitNodes whose input is a SortNode (e.g., ORDER BY x LIMIT 10) and marks them to be fused with the
+ * SortNode. The LQPTranslator translates fused nodes into a single TopK operator, which does not sort the entire input
+ * but keeps only the k best rows per chunk.
+ *
+ * The rule only applies if the SortNode has no other outputs and the limit is a literal of at most MAX_ROW_COUNT rows.
+ * For larger limits, the bounded heaps of the TopK operator hold a large share of the input and a full sort is faster.
+ */
+class TopKRule : public AbstractRule {
+ public:
+  std::string name() const override;
+
+  static constexpr auto MAX_ROW_COUNT = int64_t{10'000};
+
+ protected:
+  void _apply_to_plan_without_subqueries(const std::shared_ptr<AbstractLQPNode>& lqp_root) const override;
+};
+
+}  // namespace hyrise
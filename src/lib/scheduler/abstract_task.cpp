@@ -7,11 +7,34 @@
 
 #include "abstract_scheduler.hpp"
 #include "hyrise.hpp"
+#include "query_task_group.hpp"
 #include "task_queue.hpp"
 #include "worker.hpp"
 
 #include "utils/assert.hpp"
 
+namespace {
+
+// The query task group of the task that is currently executed by this thread, if any.
+thread_local std::shared_ptr<hyrise::QueryTaskGroup> executing_query_task_group;  // NOLINT (clang-tidy wants const)
+
+// Sets the executing query task group of this thread and restores the previous one when leaving the scope, even if the
+// task throws. Tasks can be executed in a nested fashion (e.g., when a worker waits for tasks).
+class ExecutingQueryTaskGroupScope : public hyrise::Noncopyable {
+ public:
+  explicit ExecutingQueryTaskGroupScope(const std::shared_ptr<hyrise::QueryTaskGroup>& query_task_group)
+      : _previous_query_task_group(std::exchange(executing_query_task_group, query_task_group)) {}
+
+  ~ExecutingQueryTaskGroupScope() {
+    executing_query_task_group = std::move(_previous_query_task_group);
+  }
+
+ private:
+  std::shared_ptr<hyrise::QueryTaskGroup> _previous_query_task_group;
+};
+
+}  // namespace
+
 namespace hyrise {
 
 AbstractTask::AbstractTask(SchedulePriority priority, bool stealable) : _priority(priority), _stealable(stealable) {}
@@ -82,6 +105,16 @@ void AbstractTask::set_node_id(NodeID node_id) {
   _node_id = node_id;
 }
 
+void AbstractTask::set_query_task_group(const std::shared_ptr<QueryTaskGroup>& query_task_group) {
+  DebugAssert(!is_scheduled(), "Possible race: Don't set the query task group after the Task was scheduled");
+
+  _query_task_group = query_task_group;
+}
+
+const std::shared_ptr<QueryTaskGroup>& AbstractTask::query_task_group() const {
+  return _query_task_group;
+}
+
 bool AbstractTask::try_mark_as_enqueued() {
   return _try_transition_to(TaskState::Enqueued);
 }
@@ -110,6 +143,14 @@ void AbstractTask::schedule(NodeID preferred_node_id) {
     return;
   }
 
+  if (!_query_task_group) {
+    _query_task_group = executing_query_task_group;
+  }
+
+  if (_query_task_group) {
+    _query_task_group->increment_scheduled_task_count();
+  }
+
   Hyrise::get().scheduler()->schedule(shared_from_this(), preferred_node_id, _priority);
 }
 
@@ -137,7 +178,15 @@ void AbstractTask::execute() {
   // _is_scheduled and this assert (potentially in "thread" B) reads it, it is guaranteed that no writes of whoever
   // spawned the task are pushed down to a point where this thread is already running.
 
-  _on_execute();
+  {
+    // Tasks scheduled by this task belong to the same query.
+    const auto query_task_group_scope = ExecutingQueryTaskGroupScope{_query_task_group};
+    _on_execute();
+  }
+
+  if (_query_task_group) {
+    _query_task_group->increment_finished_task_count();
+  }
 
   {
     auto success_done = _try_transition_to(TaskState::Done);
@@ -11,6 +11,7 @@
 
 namespace hyrise {
 
+class QueryTaskGroup;
 class Worker;
 
 /**
@@ -143,6 +144,13 @@ class AbstractTask : public std::enable_shared_from_this<AbstractTask> {
    */
   void set_node_id(NodeID node_id);
 
+  /**
+   * The query this task is executed for, if any. Tasks without a group inherit the group of the task that is executing
+   * on the scheduling thread when they are scheduled.
+   */
+  void set_query_task_group(const std::shared_ptr<QueryTaskGroup>& query_task_group);
+  const std::shared_ptr<QueryTaskGroup>& query_task_group() const;
+
   /**
    * Callback to be executed right after the task finished. Notice the execution of the callback might happen on ANY
    * thread.
@@ -203,6 +211,7 @@ class AbstractTask : public std::enable_shared_from_this<AbstractTask> {
   SchedulePriority _priority;
   std::atomic_bool _stealable;
   std::function<void()> _done_callback;
+  std::shared_ptr<QueryTaskGroup> _query_task_group;
 
   // For dependencies.
   std::atomic_uint32_t _pending_predecessors{0};
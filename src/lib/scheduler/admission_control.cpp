@@ -0,0 +1,150 @@
+#include "admission_control.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "hyrise.hpp"
+#include "query_task_group.hpp"
+#include "utils/assert.hpp"
+#include "utils/settings/abstract_setting.hpp"
+#include "worker.hpp"
+
+namespace {
+
+using namespace hyrise;  // NOLINT
+
+// Number of admitted queries that are currently executed by this thread.
+thread_local size_t admitted_query_count_of_this_thread = 0;  // NOLINT (clang-tidy wants this const)
+
+class MaxConcurrentQueriesSetting : public AbstractSetting {
+ public:
+  MaxConcurrentQueriesSetting() : AbstractSetting("AdmissionControl.max_concurrent_queries") {}
+
+  const std::string& description() const final {
+    static const auto description =
+        std::string{"Maximum number of concurrently executed queries, further queries wait (0: unlimited)"};
+    return description;
+  }
+
+  const std::string& get() final {
+    _value = std::to_string(Hyrise::get().admission_control.max_concurrent_queries());
+    return _value;
+  }
+
+  void set(const std::string& value) final {
+    AssertInput(!value.empty() && std::all_of(value.cbegin(), value.cend(), [](const unsigned char character) {
+                  return std::isdigit(character);
+                }),
+                "Expected a non-negative integer for " + name + ", got '" + value + "'.");
+    const auto max_concurrent_queries = std::stoull(value);
+    AssertInput(max_concurrent_queries <= std::numeric_limits<uint32_t>::max(), "Value for " + name + " is too large.");
+    Hyrise::get().admission_control.set_max_concurrent_queries(static_cast<uint32_t>(max_concurrent_queries));
+  }
+
+ private:
+  std::string _value;
+};
+
+}  // namespace
+
+namespace hyrise {
+
+AdmissionControl::ScopedAdmission::ScopedAdmission(AdmissionControl& admission_control, const std::string& description,
+                                                   const uint32_t weight)
+    : _admission_control(admission_control), _query_task_group(admission_control.admit(description, weight)) {}
+
+AdmissionControl::ScopedAdmission::~ScopedAdmission() {
+  _admission_control.release(_query_task_group);
+}
+
+const std::shared_ptr<QueryTaskGroup>& AdmissionControl::ScopedAdmission::query_task_group() const {
+  return _query_task_group;
+}
+
+AdmissionControl& AdmissionControl::operator=(AdmissionControl&& admission_control) noexcept {
+  // Only used by Hyrise::reset(), where no queries should be running anymore.
+  const auto lock = std::scoped_lock{_mutex, admission_control._mutex};
+  _max_concurrent_queries = admission_control._max_concurrent_queries;
+  _next_query_id = admission_control._next_query_id;
+  _running_query_count = admission_control._running_query_count;
+  _query_task_groups = std::move(admission_control._query_task_groups);
+  _query_released.notify_all();
+  return *this;
+}
+
+uint32_t AdmissionControl::max_concurrent_queries() const {
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  return _max_concurrent_queries;
+}
+
+void AdmissionControl::set_max_concurrent_queries(const uint32_t max_concurrent_queries) {
+  {
+    const auto lock = std::lock_guard<std::mutex>{_mutex};
+    _max_concurrent_queries = max_concurrent_queries;
+  }
+
+  // Waiting queries might be admitted now.
+  _query_released.notify_all();
+}
+
+std::shared_ptr<QueryTaskGroup> AdmissionControl::admit(const std::string& description, const uint32_t weight) {
+  auto lock = std::unique_lock<std::mutex>{_mutex};
+  auto query_task_group = std::make_shared<QueryTaskGroup>(_next_query_id++, description, weight);
+  _query_task_groups.emplace_back(query_task_group);
+
+  if (!Worker::get_this_thread_worker() && admitted_query_count_of_this_thread == 0) {
+    _query_released.wait(lock, [&]() { return _can_run(query_task_group); });
+  }
+
+  query_task_group->set_state(QueryTaskGroupState::Running);
+  ++_running_query_count;
+  ++admitted_query_count_of_this_thread;
+
+  // The next waiting query might be allowed to run as well, e.g., if the limit was raised in the meantime.
+  _query_released.notify_all();
+
+  return query_task_group;
+}
+
+void AdmissionControl::release(const std::shared_ptr<QueryTaskGroup>& query_task_group) {
+  {
+    const auto lock = std::lock_guard<std::mutex>{_mutex};
+    const auto iter = std::find(_query_task_groups.begin(), _query_task_groups.end(), query_task_group);
+    Assert(iter != _query_task_groups.end() && query_task_group->state() == QueryTaskGroupState::Running,
+           "Query was not admitted.");
+    _query_task_groups.erase(iter);
+    --_running_query_count;
+    --admitted_query_count_of_this_thread;
+  }
+
+  _query_released.notify_all();
+}
+
+std::vector<std::shared_ptr<QueryTaskGroup>> AdmissionControl::query_task_groups() const {
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  return _query_task_groups;
+}
+
+std::shared_ptr<AbstractSetting> AdmissionControl::create_max_concurrent_queries_setting() {
+  return std::make_shared<MaxConcurrentQueriesSetting>();
+}
+
+bool AdmissionControl::_can_run(const std::shared_ptr<QueryTaskGroup>& query_task_group) const {
+  if (_max_concurrent_queries > 0 && _running_query_count >= _max_concurrent_queries) {
+    return false;
+  }
+
+  // Queries are admitted in the order of their arrival.
+  const auto first_waiting_query_task_group =
+      std::find_if(_query_task_groups.cbegin(), _query_task_groups.cend(), [](const auto& group) {
+        return group->state() == QueryTaskGroupState::Waiting;
+      });
+  return *first_waiting_query_task_group == query_task_group;
+}
+
+}  // namespace hyrise
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "types.hpp"
+
+namespace hyrise {
+
+class AbstractSetting;
+class QueryTaskGroup;
+
+/**
+ * Limits the number of queries that are executed concurrently. Queries that exceed the limit wait in FIFO order until
+ * a running query finishes. Limiting the number of concurrent queries bounds the memory consumed by intermediate
+ * results and avoids that many queries make slow progress at the same time. Among the admitted queries, the workers
+ * are shared according to the queries' weights (see FAIR SCHEDULING in task_queue.hpp).
+ *
+ * The limit can be changed using the setting "AdmissionControl.max_concurrent_queries", where 0 (the default) means
+ * that the number of queries is not limited. Admitted and waiting queries are listed in the meta table "queries".
+ *
+ * Queries issued from a worker thread (e.g., by a plugin) or from a thread that is already executing an admitted query
+ * are admitted immediately, as they could otherwise wait for themselves.
+ */
+class AdmissionControl : public Noncopyable {
+ public:
+  /**
+   * Admits a query on construction (see admit()) and releases it on destruction, even if the query's execution throws.
+   */
+  class ScopedAdmission : public Noncopyable {
+   public:
+    ScopedAdmission(AdmissionControl& admission_control, const std::string& description, const uint32_t weight);
+    ~ScopedAdmission();
+
+    const std::shared_ptr<QueryTaskGroup>& query_task_group() const;
+
+   private:
+    AdmissionControl& _admission_control;
+    const std::shared_ptr<QueryTaskGroup> _query_task_group;
+  };
+
+  uint32_t max_concurrent_queries() const;
+  void set_max_concurrent_queries(const uint32_t max_concurrent_queries);
+
+  /**
+   * Blocks until the query may be executed and returns its group. Every admitted query must be released.
+   */
+  std::shared_ptr<QueryTaskGroup> admit(const std::string& description, const uint32_t weight);
+  void release(const std::shared_ptr<QueryTaskGroup>& query_task_group);
+
+  /**
+   * Returns the waiting and running queries, ordered by their arrival.
+   */
+  std::vector<std::shared_ptr<QueryTaskGroup>> query_task_groups() const;
+
+  /**
+   * Returns the setting that controls the limit. It accesses the AdmissionControl of the Hyrise singleton.
+   */
+  static std::shared_ptr<AbstractSetting> create_max_concurrent_queries_setting();
+
+ protected:
+  friend class Hyrise;
+  friend class AdmissionControlTest;
+
+  AdmissionControl() = default;
+  AdmissionControl& operator=(AdmissionControl&& admission_control) noexcept;
+
+ private:
+  // Returns true if the query is next in line and the limit allows for one more running query.
+  bool _can_run(const std::shared_ptr<QueryTaskGroup>& query_task_group) const;
+
+  mutable std::mutex _mutex;
+  std::condition_variable _query_released;
+
+  uint32_t _max_concurrent_queries{0};
+  uint64_t _next_query_id{0};
+  size_t _running_query_count{0};
+  std::vector<std::shared_ptr<QueryTaskGroup>> _query_task_groups;
+};
+
+}  // namespace hyrise
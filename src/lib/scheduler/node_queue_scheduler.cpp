@@ -15,7 +15,7 @@
 
 namespace hyrise {
 
-NodeQueueScheduler::NodeQueueScheduler() {
+NodeQueueScheduler::NodeQueueScheduler(const NodeQueueSchedulerMode mode) : _mode(mode) {
   _worker_id_allocator = std::make_shared<UidAllocator>();
 }
 
@@ -42,12 +42,33 @@ void NodeQueueScheduler::begin() {
     const auto& topology_node = Hyrise::get().topology.nodes()[node_id];
 
     for (const auto& topology_cpu : topology_node.cpus) {
-      _workers.emplace_back(
-          std::make_shared<Worker>(queue, WorkerID{_worker_id_allocator->allocate()}, topology_cpu.cpu_id));
+      _workers.emplace_back(std::make_shared<Worker>(queue, WorkerID{_worker_id_allocator->allocate()},
+                                                     topology_cpu.cpu_id,
+                                                     _mode == NodeQueueSchedulerMode::WorkStealingDeques));
     }
   }
 
   _workers_per_node = _workers.size() / _queue_count;
+
+  if (_mode == NodeQueueSchedulerMode::WorkStealingDeques) {
+    // Each worker steals from the workers of its own node first. Then, it visits the other nodes in ascending order,
+    // starting with the next node, so that the steal attempts of different nodes are spread over the remote nodes.
+    for (const auto& worker : _workers) {
+      const auto node_id = worker->queue()->node_id();
+      for (auto node_offset = size_t{0}; node_offset < _queue_count; ++node_offset) {
+        const auto victim_node_id = (node_id + node_offset) % _queue_count;
+        for (const auto& victim : _workers) {
+          if (victim != worker && victim->queue()->node_id() == victim_node_id) {
+            worker->_steal_victims.emplace_back(victim.get());
+          }
+        }
+
+        if (node_offset == 0) {
+          worker->_same_node_victim_count = worker->_steal_victims.size();
+        }
+      }
+    }
+  }
   _active = true;
 
   for (auto& worker : _workers) {
@@ -115,6 +136,10 @@ const std::vector<std::shared_ptr<Worker>>& NodeQueueScheduler::workers() const
   return _workers;
 }
 
+NodeQueueSchedulerMode NodeQueueScheduler::mode() const {
+  return _mode;
+}
+
 void NodeQueueScheduler::schedule(std::shared_ptr<AbstractTask> task, NodeID preferred_node_id,
                                   SchedulePriority priority) {
   /**
@@ -130,6 +155,16 @@ void NodeQueueScheduler::schedule(std::shared_ptr<AbstractTask> task, NodeID pre
     return;
   }
 
+  if (_mode == NodeQueueSchedulerMode::WorkStealingDeques && preferred_node_id == CURRENT_NODE_ID &&
+      priority == SchedulePriority::Default && task->is_stealable()) {
+    // Tasks spawned by a worker stay local to that worker, see WORK-STEALING DEQUES above.
+    const auto& worker = Worker::get_this_thread_worker();
+    if (worker && worker->uses_local_deque()) {
+      worker->push_local_task(task);
+      return;
+    }
+  }
+
   const auto node_id_for_queue = determine_queue_id(preferred_node_id);
   DebugAssert((static_cast<size_t>(node_id_for_queue) < _queues.size()),
               "Node ID is not within range of available nodes.");
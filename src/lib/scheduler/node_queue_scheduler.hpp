@@ -70,8 +70,23 @@ namespace hyrise {
  * Afterwards, the current worker is checking its local queue gain.
  *
  * [1] http://frankdenneman.nl/2016/07/13/numa-deep-dive-4-local-memory-optimization/
+ *
+ *
+ * WORK-STEALING DEQUES
+ *
+ * With many cores and many small JobTasks (e.g., one per chunk), the shared queue of a node becomes a point of
+ * contention. In the NodeQueueSchedulerMode::WorkStealingDeques mode, each worker additionally owns a Chase-Lev deque
+ * (see WorkStealingDeque). Tasks that are scheduled by a worker (i.e., spawned by the task it executes) are pushed to
+ * its own deque instead of the node's queue, if they have the default priority, are stealable, and are not meant for
+ * a specific node. The worker pops tasks from its deque in LIFO order, so that it works on recently spawned tasks while
+ * their data is still cached. Workers that run out of tasks check their node's queue and then steal the oldest tasks
+ * from the deques of other workers (in FIFO order), trying the workers of their own node before those of remote nodes.
+ * Tasks scheduled from outside of workers as well as high-priority tasks still go through the node queues. Idle
+ * workers spin for a short while before they sleep on their node queue's condition variable.
  */
 
+enum class NodeQueueSchedulerMode : uint8_t { SharedNodeQueues, WorkStealingDeques };
+
 class Worker;
 class TaskQueue;
 class UidAllocator;
@@ -81,7 +96,7 @@ class UidAllocator;
  */
 class NodeQueueScheduler : public AbstractScheduler {
  public:
-  NodeQueueScheduler();
+  explicit NodeQueueScheduler(const NodeQueueSchedulerMode mode = NodeQueueSchedulerMode::SharedNodeQueues);
   ~NodeQueueScheduler() override;
 
   /**
@@ -98,6 +113,8 @@ class NodeQueueScheduler : public AbstractScheduler {
 
   const std::vector<std::shared_ptr<Worker>>& workers() const;
 
+  NodeQueueSchedulerMode mode() const;
+
   /**
    * @param task
    * @param preferred_node_id determines to which queue tasks are added. Note, the task might still be stolen by other nodes due
@@ -129,6 +146,7 @@ class NodeQueueScheduler : public AbstractScheduler {
   std::vector<std::shared_ptr<TaskQueue>> _queues;
   std::vector<std::shared_ptr<Worker>> _workers;
   std::atomic_bool _active{false};
+  const NodeQueueSchedulerMode _mode;
 
   size_t _queue_count{1};
   size_t _workers_per_node{2};
@@ -3,6 +3,7 @@
 #include "operators/abstract_operator.hpp"
 #include "operators/abstract_read_write_operator.hpp"
 #include "operators/get_table.hpp"
+#include "operators/runtime_filter.hpp"
 #include "scheduler/task_utils.hpp"
 
 namespace {
@@ -42,6 +43,12 @@ std::shared_ptr<OperatorTask> add_operator_tasks_recursively(const std::shared_p
     subquery_root->set_as_predecessor_of(task);
   }
 
+  // Runtime filters are built from the output of the build operator when the operator is executed.
+  for (const auto& runtime_filter : op->runtime_filters) {
+    const auto& build_root = add_operator_tasks_recursively(runtime_filter.first->build_operator(), tasks);
+    build_root->set_as_predecessor_of(task);
+  }
+
   return task;
 }
 
@@ -0,0 +1,54 @@
+#include "query_task_group.hpp"
+
+#include <string>
+
+#include "utils/assert.hpp"
+
+namespace hyrise {
+
+QueryTaskGroup::QueryTaskGroup(const uint64_t init_id, const std::string& init_description, const uint32_t init_weight)
+    : _id(init_id), _description(init_description), _weight(init_weight) {
+  Assert(_weight > 0 && _weight <= MAX_WEIGHT, "Weight of a QueryTaskGroup must be in [1, MAX_WEIGHT].");
+}
+
+uint64_t QueryTaskGroup::id() const {
+  return _id;
+}
+
+const std::string& QueryTaskGroup::description() const {
+  return _description;
+}
+
+uint32_t QueryTaskGroup::weight() const {
+  return _weight;
+}
+
+uint64_t QueryTaskGroup::stride() const {
+  return STRIDE_BASE / _weight;
+}
+
+QueryTaskGroupState QueryTaskGroup::state() const {
+  return _state;
+}
+
+void QueryTaskGroup::set_state(const QueryTaskGroupState state) {
+  _state = state;
+}
+
+void QueryTaskGroup::increment_scheduled_task_count() {
+  ++_scheduled_task_count;
+}
+
+void QueryTaskGroup::increment_finished_task_count() {
+  ++_finished_task_count;
+}
+
+uint64_t QueryTaskGroup::scheduled_task_count() const {
+  return _scheduled_task_count;
+}
+
+uint64_t QueryTaskGroup::finished_task_count() const {
+  return _finished_task_count;
+}
+
+}  // namespace hyrise
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <string>
+
+#include "types.hpp"
+
+namespace hyrise {
+
+enum class QueryTaskGroupState { Waiting, Running };
+
+/**
+ * Groups all tasks that are executed on behalf of a single query. The TaskQueue uses the groups to share the workers
+ * between concurrently running queries (see FAIR SCHEDULING in task_queue.hpp), the AdmissionControl uses them to
+ * limit the number of concurrently running queries.
+ *
+ * Tasks that are scheduled while a task of a group is being executed (e.g., the JobTasks spawned by an operator)
+ * inherit the group of the executing task.
+ */
+class QueryTaskGroup : private Noncopyable {
+ public:
+  // Weights are relative to each other. A query with twice the weight of another query gets twice as many tasks
+  // dispatched while both queries have pending tasks.
+  static constexpr auto DEFAULT_WEIGHT = uint32_t{100};
+  static constexpr auto MAX_WEIGHT = uint32_t{10'000};
+
+  // Large enough so that the integer division in stride() does not lose much precision for sensible weights.
+  static constexpr auto STRIDE_BASE = uint64_t{1} << 20;
+
+  QueryTaskGroup(const uint64_t init_id, const std::string& init_description, const uint32_t init_weight);
+
+  uint64_t id() const;
+  const std::string& description() const;
+  uint32_t weight() const;
+
+  // The pass value a query advances by for each dispatched task. Inversely proportional to the weight.
+  uint64_t stride() const;
+
+  QueryTaskGroupState state() const;
+  void set_state(const QueryTaskGroupState state);
+
+  void increment_scheduled_task_count();
+  void increment_finished_task_count();
+  uint64_t scheduled_task_count() const;
+  uint64_t finished_task_count() const;
+
+ private:
+  const uint64_t _id;
+  const std::string _description;
+  const uint32_t _weight;
+
+  std::atomic<QueryTaskGroupState> _state{QueryTaskGroupState::Waiting};
+  std::atomic_uint64_t _scheduled_task_count{0};
+  std::atomic_uint64_t _finished_task_count{0};
+};
+
+}  // namespace hyrise
@@ -1,11 +1,25 @@
 #include "task_queue.hpp"
 
+#include <algorithm>
 #include <memory>
 #include <utility>
 
 #include "abstract_task.hpp"
+#include "query_task_group.hpp"
 #include "utils/assert.hpp"
 
+namespace {
+
+using namespace hyrise;  // NOLINT
+
+constexpr auto HIGH_PRIORITY_QUEUE_ID = static_cast<uint32_t>(SchedulePriority::High);
+constexpr auto DEFAULT_PRIORITY_QUEUE_ID = static_cast<uint32_t>(SchedulePriority::Default);
+
+// Ungrouped tasks are served as if they belonged to a single group with the default weight.
+constexpr auto UNGROUPED_STRIDE = QueryTaskGroup::STRIDE_BASE / QueryTaskGroup::DEFAULT_WEIGHT;
+
+}  // namespace
+
 namespace hyrise {
 
 TaskQueue::TaskQueue(NodeID node_id) : _node_id(node_id) {}
@@ -16,7 +30,7 @@ bool TaskQueue::empty() const {
       return false;
     }
   }
-  return true;
+  return _grouped_task_count == 0;
 }
 
 NodeID TaskQueue::node_id() const {
@@ -33,24 +47,49 @@ void TaskQueue::push(const std::shared_ptr<AbstractTask>& task, const SchedulePr
   }
 
   task->set_node_id(_node_id);
-  _queues[priority_uint].push(task);
+
+  const auto& query_task_group = task->query_task_group();
+  if (query_task_group && priority == SchedulePriority::Default) {
+    const auto lock = std::lock_guard<std::mutex>{_group_mutex};
+    auto [group_queue, is_new_group] = _group_queues.try_emplace(query_task_group.get());
+    if (is_new_group) {
+      // The group becomes active on this queue. See FAIR SCHEDULING for its initial pass.
+      group_queue->second = QueryTaskGroupQueue{query_task_group, _virtual_time, _next_group_arrival++, {}};
+      _groups_by_pass.emplace(_virtual_time, group_queue->second.arrival, query_task_group.get());
+    }
+    group_queue->second.tasks.emplace_back(task);
+    ++_grouped_task_count;
+  } else {
+    _queues[priority_uint].push(task);
+  }
 
   new_task.notify_one();
 }
 
 std::shared_ptr<AbstractTask> TaskQueue::pull() {
   std::shared_ptr<AbstractTask> task;
-  for (auto& queue : _queues) {
-    if (queue.try_pop(task)) {
-      return task;
-    }
+  if (_queues[HIGH_PRIORITY_QUEUE_ID].try_pop(task)) {
+    return task;
+  }
+
+  if (_grouped_task_count > 0) {
+    return _pull_default_priority_task(false);
+  }
+
+  if (_queues[DEFAULT_PRIORITY_QUEUE_ID].try_pop(task)) {
+    return task;
   }
   return nullptr;
 }
 
 std::shared_ptr<AbstractTask> TaskQueue::steal() {
   std::shared_ptr<AbstractTask> task;
-  for (auto& queue : _queues) {
+  for (auto queue_id = uint32_t{0}; queue_id < NUM_PRIORITY_LEVELS; ++queue_id) {
+    if (queue_id == DEFAULT_PRIORITY_QUEUE_ID && _grouped_task_count > 0) {
+      return _pull_default_priority_task(true);
+    }
+
+    auto& queue = _queues[queue_id];
     if (queue.try_pop(task)) {
       if (task->is_stealable()) {
         return task;
@@ -72,7 +111,78 @@ size_t TaskQueue::estimate_load() {
     estimated_load += _queues[queue_id].unsafe_size() * (size_t{1} << (NUM_PRIORITY_LEVELS - 1 - queue_id));
   }
 
+  // Grouped tasks always have the default priority.
+  estimated_load += _grouped_task_count;
+
   return estimated_load;
 }
 
+std::shared_ptr<AbstractTask> TaskQueue::_pull_default_priority_task(const bool stealable_only) {
+  const auto lock = std::lock_guard<std::mutex>{_group_mutex};
+
+  // Find the group with the smallest pass that has a matching task. Without `stealable_only`, this is the first group.
+  auto* next_group_queue = static_cast<QueryTaskGroupQueue*>(nullptr);
+  auto next_task = std::deque<std::shared_ptr<AbstractTask>>::iterator{};
+  for (const auto& [pass, arrival, query_task_group] : _groups_by_pass) {
+    auto& group_queue = _group_queues.at(query_task_group);
+    auto task = group_queue.tasks.begin();
+    if (stealable_only) {
+      task = std::find_if(task, group_queue.tasks.end(), [](const auto& candidate) {
+        return candidate->is_stealable();
+      });
+    }
+
+    if (task != group_queue.tasks.end()) {
+      next_group_queue = &group_queue;
+      next_task = task;
+      break;
+    }
+  }
+
+  // Serve the ungrouped tasks if it is their turn. Like groups, they cannot save up credit while being idle.
+  const auto ungrouped_pass = std::max(_ungrouped_pass, _virtual_time);
+  if (!next_group_queue || ungrouped_pass < next_group_queue->pass) {
+    auto& queue = _queues[DEFAULT_PRIORITY_QUEUE_ID];
+    std::shared_ptr<AbstractTask> task;
+    if (queue.try_pop(task)) {
+      if (!stealable_only || task->is_stealable()) {
+        _virtual_time = ungrouped_pass;
+        _ungrouped_pass = ungrouped_pass + UNGROUPED_STRIDE;
+        return task;
+      }
+
+      queue.push(task);
+    }
+  }
+
+  if (!next_group_queue) {
+    return nullptr;
+  }
+
+  auto task = std::move(*next_task);
+  if (next_task == next_group_queue->tasks.begin()) {
+    next_group_queue->tasks.pop_front();
+  } else {
+    next_group_queue->tasks.erase(next_task);
+  }
+  --_grouped_task_count;
+
+  _advance_group(*next_group_queue);
+  return task;
+}
+
+void TaskQueue::_advance_group(QueryTaskGroupQueue& group_queue) {
+  const auto* const query_task_group = group_queue.query_task_group.get();
+  _groups_by_pass.erase({group_queue.pass, group_queue.arrival, query_task_group});
+
+  _virtual_time = group_queue.pass;
+  if (group_queue.tasks.empty()) {
+    _group_queues.erase(query_task_group);
+    return;
+  }
+
+  group_queue.pass += query_task_group->stride();
+  _groups_by_pass.emplace(group_queue.pass, group_queue.arrival, query_task_group);
+}
+
 }  // namespace hyrise
@@ -5,16 +5,37 @@
 #include <array>
 #include <atomic>
 #include <condition_variable>
+#include <deque>
 #include <memory>
+#include <mutex>
+#include <set>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include "types.hpp"
 
 namespace hyrise {
 
 class AbstractTask;
+class QueryTaskGroup;
 
 /**
  * Holds a queue of AbstractTasks, usually one of these exists per node
+ *
+ * FAIR SCHEDULING
+ * Without further measures, a query that spawns many tasks (e.g., a large analytical query) fills the queue and
+ * delays the tasks of all queries that are scheduled afterwards (e.g., short point lookups). Therefore, tasks of the
+ * default priority that belong to a QueryTaskGroup are kept in one FIFO queue per group, and the groups share the
+ * workers using stride scheduling [1]: each group has a pass value that advances by the group's stride whenever one
+ * of its tasks is pulled, and the group with the smallest pass is served next. Groups that become active (again) start
+ * at the pass of the most recently served group, so that they neither get penalized nor can save up credit while being
+ * idle. Groups with the same pass are served in the order in which they became active. Tasks without a group are
+ * treated as one additional group with the default weight. High-priority tasks are always pulled first, regardless of
+ * their group.
+ *
+ * [1] Waldspurger and Weihl. Stride Scheduling: Deterministic Proportional-Share Resource Management. MIT 1995.
  */
 class TaskQueue {
  public:
@@ -57,8 +78,37 @@ class TaskQueue {
   std::mutex lock;
 
  private:
+  struct QueryTaskGroupQueue {
+    std::shared_ptr<QueryTaskGroup> query_task_group;
+    uint64_t pass;
+    // Breaks ties between groups with the same pass, see _groups_by_pass.
+    uint64_t arrival;
+    std::deque<std::shared_ptr<AbstractTask>> tasks;
+  };
+
+  // Removes `group_queue` from _groups_by_pass, advances its pass, and re-inserts it or removes the group if it has no
+  // more tasks.
+  void _advance_group(QueryTaskGroupQueue& group_queue);
+
+  // Removes the next default-priority task, which is either a task of the group with the smallest pass or an
+  // ungrouped task (see FAIR SCHEDULING above). If `stealable_only` is set, non-stealable tasks are skipped. Returns
+  // nullptr if no matching task was found.
+  std::shared_ptr<AbstractTask> _pull_default_priority_task(const bool stealable_only);
+
   NodeID _node_id;
   std::array<tbb::concurrent_queue<std::shared_ptr<AbstractTask>>, NUM_PRIORITY_LEVELS> _queues;
+
+  // Default-priority tasks of query task groups. Guarded by _group_mutex, except for the task count, which allows
+  // pull() and steal() to use the lock-free queue without taking the mutex when no grouped tasks are pending. The
+  // active groups are ordered by their pass and their arrival, so that the next group is found without scanning all of
+  // them and groups with the same pass are served in the order in which they became active.
+  std::mutex _group_mutex;
+  std::unordered_map<const QueryTaskGroup*, QueryTaskGroupQueue> _group_queues;
+  std::set<std::tuple<uint64_t, uint64_t, const QueryTaskGroup*>> _groups_by_pass;
+  uint64_t _next_group_arrival{0};
+  std::atomic_size_t _grouped_task_count{0};
+  uint64_t _virtual_time{0};
+  uint64_t _ungrouped_pass{0};
 };
 
 }  // namespace hyrise
@@ -0,0 +1,131 @@
+#include "work_stealing_deque.hpp"
+
+#include <memory>
+#include <utility>
+
+#include "abstract_task.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace hyrise;  // NOLINT
+
+// Takes ownership of a task that was claimed from a slot.
+std::shared_ptr<AbstractTask> unbox(std::shared_ptr<AbstractTask>* boxed_task) {
+  if (!boxed_task) {
+    return nullptr;
+  }
+
+  auto task = std::move(*boxed_task);
+  delete boxed_task;  // NOLINT(cppcoreguidelines-owning-memory)
+  return task;
+}
+
+}  // namespace
+
+namespace hyrise {
+
+WorkStealingDeque::Buffer::Buffer(const size_t init_capacity)
+    : capacity(init_capacity), slots(init_capacity) {
+  DebugAssert(capacity > 0 && (capacity & (capacity - 1)) == 0, "Capacity must be a power of two.");
+}
+
+WorkStealingDeque::Slot& WorkStealingDeque::Buffer::slot(const int64_t index) const {
+  return slots[static_cast<size_t>(index) & (capacity - 1)];
+}
+
+WorkStealingDeque::WorkStealingDeque(const size_t initial_capacity) {
+  Assert(initial_capacity > 0 && (initial_capacity & (initial_capacity - 1)) == 0,
+         "Initial capacity must be a power of two.");
+  _buffers.emplace_back(std::make_unique<Buffer>(initial_capacity));
+  _buffer.store(_buffers.back().get(), std::memory_order_relaxed);
+}
+
+WorkStealingDeque::~WorkStealingDeque() {
+  // Release the tasks that have not been claimed.
+  const auto* const buffer = _buffer.load(std::memory_order_relaxed);
+  const auto bottom = _bottom.load(std::memory_order_relaxed);
+  for (auto index = _top.load(std::memory_order_relaxed); index < bottom; ++index) {
+    unbox(buffer->slot(index).load(std::memory_order_relaxed));
+  }
+}
+
+void WorkStealingDeque::push(const std::shared_ptr<AbstractTask>& task) {
+  const auto bottom = _bottom.load(std::memory_order_relaxed);
+  const auto top = _top.load(std::memory_order_acquire);
+  auto* buffer = _buffer.load(std::memory_order_relaxed);
+
+  if (bottom - top > static_cast<int64_t>(buffer->capacity) - 1) {
+    buffer = _grow(*buffer, top, bottom);
+  }
+
+  // NOLINTNEXTLINE(cppcoreguidelines-owning-memory)
+  buffer->slot(bottom).store(new std::shared_ptr<AbstractTask>(task), std::memory_order_relaxed);
+  // [2] uses a release fence followed by a relaxed store. A release store is equivalent here and, in contrast to
+  // standalone fences, understood by tsan.
+  _bottom.store(bottom + 1, std::memory_order_release);
+}
+
+std::shared_ptr<AbstractTask> WorkStealingDeque::pop() {
+  const auto bottom = _bottom.load(std::memory_order_relaxed) - 1;
+  const auto* const buffer = _buffer.load(std::memory_order_relaxed);
+  _bottom.store(bottom, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  auto top = _top.load(std::memory_order_relaxed);
+
+  if (top > bottom) {
+    // The deque is empty.
+    _bottom.store(bottom + 1, std::memory_order_relaxed);
+    return nullptr;
+  }
+
+  auto* boxed_task = buffer->slot(bottom).load(std::memory_order_relaxed);
+  if (top == bottom) {
+    // This is the last task, which thieves might try to claim concurrently.
+    if (!_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+      boxed_task = nullptr;
+    }
+    _bottom.store(bottom + 1, std::memory_order_relaxed);
+  }
+
+  return unbox(boxed_task);
+}
+
+std::shared_ptr<AbstractTask> WorkStealingDeque::steal() {
+  auto top = _top.load(std::memory_order_acquire);
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  const auto bottom = _bottom.load(std::memory_order_acquire);
+
+  if (top >= bottom) {
+    return nullptr;
+  }
+
+  const auto* const buffer = _buffer.load(std::memory_order_acquire);
+  auto* boxed_task = buffer->slot(top).load(std::memory_order_relaxed);
+  if (!_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+    // The owner or another thief claimed the task.
+    return nullptr;
+  }
+
+  return unbox(boxed_task);
+}
+
+size_t WorkStealingDeque::estimate_size() const {
+  const auto bottom = _bottom.load(std::memory_order_relaxed);
+  const auto top = _top.load(std::memory_order_relaxed);
+  return bottom > top ? static_cast<size_t>(bottom - top) : size_t{0};
+}
+
+WorkStealingDeque::Buffer* WorkStealingDeque::_grow(const Buffer& buffer, const int64_t top, const int64_t bottom) {
+  auto new_buffer = std::make_unique<Buffer>(buffer.capacity * 2);
+  for (auto index = top; index < bottom; ++index) {
+    new_buffer->slot(index).store(buffer.slot(index).load(std::memory_order_relaxed), std::memory_order_relaxed);
+  }
+
+  auto* const new_buffer_ptr = new_buffer.get();
+  _buffers.emplace_back(std::move(new_buffer));
+  _buffer.store(new_buffer_ptr, std::memory_order_release);
+  return new_buffer_ptr;
+}
+
+}  // namespace hyrise
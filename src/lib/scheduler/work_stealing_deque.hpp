@@ -0,0 +1,84 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "types.hpp"
+
+namespace hyrise {
+
+class AbstractTask;
+
+/**
+ * Chase-Lev work-stealing deque [1] using the memory orderings of [2]. Only the owning worker may push() and pop()
+ * tasks, which it does in LIFO order at the bottom of the deque. Any other thread may steal() tasks from the top, i.e.,
+ * in FIFO order. The owner only synchronizes with thieves when the deque is about to run empty, so that a worker that
+ * processes its own tasks does not contend with other workers.
+ *
+ * Thieves might read a slot while the owner overwrites it. Thus, slots store pointers to heap-allocated shared_ptrs,
+ * which are only dereferenced by the thread that successfully claimed the slot. When the circular buffer is full, it
+ * is replaced by one of twice the capacity. Replaced buffers are kept until the deque is destroyed, as thieves might
+ * still read from them.
+ *
+ * [1] Chase and Lev. Dynamic Circular Work-Stealing Deque. SPAA 2005.
+ * [2] Lê et al. Correct and Efficient Work-Stealing for Weak Memory Models. PPoPP 2013.
+ */
+class WorkStealingDeque : private Noncopyable {
+ public:
+  explicit WorkStealingDeque(const size_t initial_capacity = 256);
+  ~WorkStealingDeque();
+
+  WorkStealingDeque(WorkStealingDeque&&) = delete;
+  WorkStealingDeque& operator=(WorkStealingDeque&&) = delete;
+
+  /**
+   * Adds a task to the bottom of the deque. Must only be called by the owner.
+   */
+  void push(const std::shared_ptr<AbstractTask>& task);
+
+  /**
+   * Removes and returns the most recently pushed task or nullptr if the deque is empty. Must only be called by the
+   * owner.
+   */
+  std::shared_ptr<AbstractTask> pop();
+
+  /**
+   * Removes and returns the least recently pushed task. Returns nullptr if the deque is empty or if another thread
+   * claimed the task concurrently. Can be called by any thread.
+   */
+  std::shared_ptr<AbstractTask> steal();
+
+  /**
+   * Returns the number of tasks in the deque. The result might be outdated when other threads access the deque.
+   */
+  size_t estimate_size() const;
+
+ private:
+  using Slot = std::atomic<std::shared_ptr<AbstractTask>*>;
+
+  struct Buffer {
+    explicit Buffer(const size_t init_capacity);
+
+    Slot& slot(const int64_t index) const;
+
+    const size_t capacity;
+    // Slots are never resized, as atomics cannot be moved. They are mutable as storing to a slot does not modify the
+    // buffer itself.
+    mutable std::vector<Slot> slots;
+  };
+
+  // Replaces the current buffer with one of twice the capacity that holds the tasks in [top, bottom).
+  Buffer* _grow(const Buffer& buffer, const int64_t top, const int64_t bottom);
+
+  // Place top and bottom on different cache lines, as top is modified by thieves and bottom by the owner.
+  alignas(64) std::atomic<int64_t> _top{0};
+  alignas(64) std::atomic<int64_t> _bottom{0};
+  std::atomic<Buffer*> _buffer;
+
+  // All buffers ever used by this deque, including the current one. Only modified by the owner.
+  std::vector<std::unique_ptr<Buffer>> _buffers;
+};
+
+}  // namespace hyrise
@@ -16,6 +16,7 @@
 #include "abstract_task.hpp"
 #include "hyrise.hpp"
 #include "task_queue.hpp"
+#include "work_stealing_deque.hpp"
 
 namespace {
 
@@ -29,20 +30,30 @@ thread_local std::weak_ptr<hyrise::Worker> this_thread_worker;  // NOLINT (clang
 // The sleep time was determined experimentally
 static constexpr auto WORKER_SLEEP_TIME = std::chrono::microseconds(300);
 
+// Number of unsuccessful attempts to find a task after which idle workers with a local deque go to sleep. In between,
+// they yield the CPU.
+static constexpr auto WORKER_IDLE_SPIN_ROUNDS = uint32_t{64};
+
 namespace hyrise {
 
 std::shared_ptr<Worker> Worker::get_this_thread_worker() {
   return ::this_thread_worker.lock();
 }
 
-Worker::Worker(const std::shared_ptr<TaskQueue>& queue, WorkerID worker_id, CpuID cpu_id)
+Worker::Worker(const std::shared_ptr<TaskQueue>& queue, WorkerID worker_id, CpuID cpu_id, const bool use_local_deque)
     : _queue(queue), _id(worker_id), _cpu_id(cpu_id) {
   // Generate a random distribution from 0-99 for later use, see below
   _random.resize(100);
   std::iota(_random.begin(), _random.end(), 0);
   std::shuffle(_random.begin(), _random.end(), std::default_random_engine{std::random_device{}()});
+
+  if (use_local_deque) {
+    _local_deque = std::make_unique<WorkStealingDeque>();
+  }
 }
 
+Worker::~Worker() = default;
+
 WorkerID Worker::id() const {
   return _id;
 }
@@ -69,14 +80,24 @@ void Worker::operator()() {
 
 void Worker::_work() {
   // If execute_next has been called, run that task first, otherwise try to retrieve a task from the queue.
+  // With a local deque, the most recently spawned own task is preferred over the tasks of the node queue, as its data
+  // is most likely still in the cache.
   auto task = std::shared_ptr<AbstractTask>{};
   if (_next_task) {
     task = std::move(_next_task);
     _next_task = nullptr;
-  } else {
+  } else if (_local_deque) {
+    task = _local_deque->pop();
+  }
+
+  if (!task) {
     task = _queue->pull();
   }
 
+  if (!task && _local_deque) {
+    task = _steal_from_workers();
+  }
+
   if (!task) {
     // Simple work stealing without explicitly transferring data between nodes.
     auto work_stealing_successful = false;
@@ -93,9 +114,17 @@ void Worker::_work() {
       }
     }
 
-    // If there is no ready task neither in our queue nor in any other, worker waits for a new task to be pushed to the
-    // own queue or returns after timer exceeded (whatever occurs first).
     if (!work_stealing_successful) {
+      // Workers with a local deque spin for some rounds before they sleep, as tasks pushed to other workers' deques
+      // might not wake them up.
+      if (_local_deque && _idle_rounds < WORKER_IDLE_SPIN_ROUNDS) {
+        ++_idle_rounds;
+        std::this_thread::yield();
+        return;
+      }
+
+      // If there is no ready task neither in our queue nor in any other, worker waits for a new task to be pushed to
+      // the own queue or returns after timer exceeded (whatever occurs first).
       {
         std::unique_lock<std::mutex> unique_lock(_queue->lock);
         _queue->new_task.wait_for(unique_lock, WORKER_SLEEP_TIME);
@@ -104,6 +133,8 @@ void Worker::_work() {
     }
   }
 
+  _idle_rounds = 0;
+
   const auto successfully_assigned = task->try_mark_as_assigned_to_worker();
   if (!successfully_assigned) {
     // Some other worker has already started to work on this task - pick a different one.
@@ -133,11 +164,61 @@ void Worker::execute_next(const std::shared_ptr<AbstractTask>& task) {
     }
     Assert(successfully_enqueued, "Task was already enqueued, expected to be solely responsible for execution");
     _next_task = task;
+  } else if (_local_deque && task->is_stealable()) {
+    push_local_task(task);
   } else {
     _queue->push(task, SchedulePriority::Default);
   }
 }
 
+void Worker::push_local_task(const std::shared_ptr<AbstractTask>& task) {
+  DebugAssert(&*get_this_thread_worker() == this, "Only the worker itself may push to its local deque");
+  DebugAssert(_local_deque, "Worker does not use a local deque");
+
+  // Someone else was first to enqueue this task? No problem!
+  if (!task->try_mark_as_enqueued()) {
+    return;
+  }
+
+  task->set_node_id(_queue->node_id());
+  _local_deque->push(task);
+
+  // Wake up a sleeping worker of the same node, which will steal the task if this worker does not get to it first.
+  _queue->new_task.notify_one();
+}
+
+bool Worker::uses_local_deque() const {
+  return static_cast<bool>(_local_deque);
+}
+
+std::shared_ptr<AbstractTask> Worker::_steal_from_workers() {
+  // Start at a random victim of the same node so that idle workers do not all try to steal from the same victim.
+  // Tasks are stolen from the top of the deques, i.e., the oldest ones. For divide-and-conquer tasks, these tend to
+  // be the largest ones, so that stealing amortizes well.
+  if (_same_node_victim_count > 0) {
+    _next_random = (_next_random + 1) % _random.size();
+    const auto first_victim = static_cast<size_t>(_random[_next_random]) % _same_node_victim_count;
+    for (auto victim_offset = size_t{0}; victim_offset < _same_node_victim_count; ++victim_offset) {
+      auto task = _steal_victims[(first_victim + victim_offset) % _same_node_victim_count]->_local_deque->steal();
+      if (task) {
+        return task;
+      }
+    }
+  }
+
+  // Only steal from other nodes if no worker of this node has pending tasks.
+  const auto victim_count = _steal_victims.size();
+  for (auto victim_id = _same_node_victim_count; victim_id < victim_count; ++victim_id) {
+    auto task = _steal_victims[victim_id]->_local_deque->steal();
+    if (task) {
+      task->set_node_id(_queue->node_id());
+      return task;
+    }
+  }
+
+  return nullptr;
+}
+
 void Worker::start() {
   _thread = std::thread(&Worker::operator(), this);
 }
@@ -12,6 +12,7 @@
 namespace hyrise {
 
 class TaskQueue;
+class WorkStealingDeque;
 
 /**
  * To be executed on a separate Thread, fetches and executes tasks until the queue is empty AND the shutdown flag is set
@@ -19,11 +20,15 @@ class TaskQueue;
  */
 class Worker : public std::enable_shared_from_this<Worker>, private Noncopyable {
   friend class AbstractScheduler;
+  friend class NodeQueueScheduler;
 
  public:
   static std::shared_ptr<Worker> get_this_thread_worker();
 
-  Worker(const std::shared_ptr<TaskQueue>& queue, WorkerID worker_id, CpuID cpu_id);
+  // If `use_local_deque` is set, the worker keeps the tasks it spawns in a WorkStealingDeque, from which idle workers
+  // can steal (see NodeQueueSchedulerMode::WorkStealingDeques).
+  Worker(const std::shared_ptr<TaskQueue>& queue, WorkerID worker_id, CpuID cpu_id, const bool use_local_deque = false);
+  ~Worker();
 
   /**
    * Unique ID of a worker. Currently not in use, but really helpful for debugging.
@@ -42,6 +47,12 @@ class Worker : public std::enable_shared_from_this<Worker>, private Noncopyable
   // so that they are worked on as soon as possible by either this or another worker.
   void execute_next(const std::shared_ptr<AbstractTask>& task);
 
+  // Adds a ready task to the worker's local deque, from which it is executed in LIFO order by this worker or stolen by
+  // others. Must be called from the worker's thread and only if the worker uses a local deque.
+  void push_local_task(const std::shared_ptr<AbstractTask>& task);
+
+  bool uses_local_deque() const;
+
   // Returns the number of tasks the worker has processed. This method is used as part of the scheduler shutdown. Be
   // cautious when using this method in any other context (see comments in #2526).
   uint64_t num_finished_tasks() const;
@@ -55,6 +66,9 @@ class Worker : public std::enable_shared_from_this<Worker>, private Noncopyable
 
   void _wait_for_tasks(const std::vector<std::shared_ptr<AbstractTask>>& tasks);
 
+  // Tries to steal a task from the local deques of other workers. Workers of the same node are tried first.
+  std::shared_ptr<AbstractTask> _steal_from_workers();
+
  private:
   /**
    * Pin a worker to a particular core.
@@ -71,6 +85,18 @@ class Worker : public std::enable_shared_from_this<Worker>, private Noncopyable
 
   std::vector<int> _random{};
   size_t _next_random{};
+
+  std::unique_ptr<WorkStealingDeque> _local_deque;
+
+  // Workers whose local deques are candidates for stealing, set by the NodeQueueScheduler. The first
+  // `_same_node_victim_count` workers run on the same node as this worker, the remaining ones on the other nodes. The
+  // workers are owned by the scheduler and outlive this worker's thread.
+  std::vector<Worker*> _steal_victims{};
+  size_t _same_node_victim_count{0};
+
+  // Number of consecutive calls to _work() in which no task was found. Idle workers of the work-stealing mode spin
+  // for a while before they sleep so that they quickly pick up tasks spawned by other workers.
+  uint32_t _idle_rounds{0};
 };
 
 }  // namespace hyrise
@@ -12,8 +12,10 @@ namespace hyrise {
 
 // Specified port (default: 5432) will be opened after initializing the _acceptor
 Server::Server(const boost::asio::ip::address& address, const uint16_t port,
-               const SendExecutionInfo send_execution_info)
-    : _acceptor(_io_service, boost::asio::ip::tcp::endpoint(address, port)), _send_execution_info(send_execution_info) {
+               const SendExecutionInfo send_execution_info, const NodeQueueSchedulerMode scheduler_mode)
+    : _acceptor(_io_service, boost::asio::ip::tcp::endpoint(address, port)),
+      _send_execution_info(send_execution_info),
+      _scheduler_mode(scheduler_mode) {
   std::cout << "Server started at " << server_address() << " and port " << server_port() << std::endl
             << "Run 'psql -h localhost " << server_address() << "' to connect to the server" << std::endl;
 }
@@ -22,7 +24,7 @@ void Server::run() {
   _is_initialized = false;
 
   // Set scheduler so that the server can execute the tasks on separate threads.
-  Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+  Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>(_scheduler_mode));
 
   // Set caches
   Hyrise::get().default_pqp_cache = std::make_shared<SQLPhysicalPlanCache>();
@@ -3,6 +3,7 @@
 #include <boost/asio/io_service.hpp>
 #include <boost/asio/ip/tcp.hpp>
 
+#include "scheduler/node_queue_scheduler.hpp"
 #include "server_types.hpp"
 #include "session.hpp"
 
@@ -29,7 +30,8 @@ namespace hyrise {
 
 class Server {
  public:
-  Server(const boost::asio::ip::address& address, const uint16_t port, const SendExecutionInfo send_execution_info);
+  Server(const boost::asio::ip::address& address, const uint16_t port, const SendExecutionInfo send_execution_info,
+         const NodeQueueSchedulerMode scheduler_mode = NodeQueueSchedulerMode::SharedNodeQueues);
 
   // Start server to accept new sessions.
   void run();
@@ -55,6 +57,7 @@ class Server {
   boost::asio::io_service _io_service;
   boost::asio::ip::tcp::acceptor _acceptor;
   const SendExecutionInfo _send_execution_info;
+  const NodeQueueSchedulerMode _scheduler_mode;
   std::atomic_bool _is_initialized{false};
 };
 }  // namespace hyrise
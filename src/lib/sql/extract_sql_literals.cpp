@@ -0,0 +1,203 @@
+#include "extract_sql_literals.hpp"
+
+#include <cctype>
+#include <charconv>
+#include <cstdlib>
+#include <limits>
+#include <string>
+
+#include <boost/algorithm/string.hpp>
+
+namespace {
+
+bool is_identifier_start(const char character) {
+  return std::isalpha(static_cast<unsigned char>(character)) || character == '_';
+}
+
+bool is_identifier_character(const char character) {
+  return std::isalnum(static_cast<unsigned char>(character)) || character == '_' || character == '$';
+}
+
+bool is_digit(const char character) {
+  return std::isdigit(static_cast<unsigned char>(character));
+}
+
+// Literals following these keywords are part of a typed literal (e.g., DATE '2000-01-01') or an interval
+// (e.g., INTERVAL '3' DAY). The parser does not accept placeholders at these positions.
+bool is_typed_literal_keyword(const std::string& word) {
+  return word == "DATE" || word == "TIMESTAMP" || word == "INTERVAL";
+}
+
+}  // namespace
+
+namespace hyrise {
+
+std::optional<ParameterizedSQL> extract_sql_literals(const std::string& sql) {
+  auto parameterized_sql = ParameterizedSQL{};
+  parameterized_sql.sql.reserve(sql.size());
+
+  const auto sql_length = sql.size();
+  // The last keyword or identifier, if it directly precedes the current token (whitespace aside).
+  auto previous_word = std::string{};
+
+  auto position = size_t{0};
+  while (position < sql_length) {
+    const auto character = sql[position];
+    const auto next_character = position + 1 < sql_length ? sql[position + 1] : '\0';
+
+    // Comments.
+    if (character == '-' && next_character == '-') {
+      auto end = sql.find('\n', position);
+      end = end == std::string::npos ? sql_length : end;
+      parameterized_sql.sql.append(sql, position, end - position);
+      position = end;
+      continue;
+    }
+
+    if (character == '/' && next_character == '*') {
+      const auto end = sql.find("*/", position + 2);
+      if (end == std::string::npos) {
+        return std::nullopt;
+      }
+      parameterized_sql.sql.append(sql, position, end + 2 - position);
+      position = end + 2;
+      continue;
+    }
+
+    // Quoted identifiers.
+    if (character == '"') {
+      const auto end = sql.find('"', position + 1);
+      if (end == std::string::npos) {
+        return std::nullopt;
+      }
+      parameterized_sql.sql.append(sql, position, end + 1 - position);
+      position = end + 1;
+      previous_word.clear();
+      continue;
+    }
+
+    // We cannot tell the placeholders of the statement apart from the ones we add.
+    if (character == '?') {
+      return std::nullopt;
+    }
+
+    // String literals. Quotes are escaped by doubling them.
+    if (character == '\'') {
+      auto value = std::string{};
+      auto end = position + 1;
+      while (true) {
+        if (end >= sql_length || sql[end] == '\\') {
+          return std::nullopt;
+        }
+
+        if (sql[end] == '\'') {
+          if (end + 1 < sql_length && sql[end + 1] == '\'') {
+            value += '\'';
+            end += 2;
+            continue;
+          }
+          break;
+        }
+
+        value += sql[end];
+        ++end;
+      }
+
+      if (is_typed_literal_keyword(previous_word)) {
+        parameterized_sql.sql.append(sql, position, end + 1 - position);
+      } else {
+        parameterized_sql.sql += '?';
+        parameterized_sql.literals.emplace_back(pmr_string{value});
+      }
+      position = end + 1;
+      previous_word.clear();
+      continue;
+    }
+
+    // Keywords and identifiers.
+    if (is_identifier_start(character)) {
+      auto end = position + 1;
+      while (end < sql_length && is_identifier_character(sql[end])) {
+        ++end;
+      }
+
+      previous_word = boost::to_upper_copy(sql.substr(position, end - position));
+      parameterized_sql.sql.append(sql, position, end - position);
+      position = end;
+      continue;
+    }
+
+    // Numeric literals, e.g., 42, 4.2, .42, or 4.2e1. Signs are unary operators and not part of the literal.
+    if (is_digit(character) || (character == '.' && is_digit(next_character))) {
+      auto end = position;
+      auto is_floating_point = false;
+      while (end < sql_length && is_digit(sql[end])) {
+        ++end;
+      }
+      if (end < sql_length && sql[end] == '.') {
+        is_floating_point = true;
+        ++end;
+        while (end < sql_length && is_digit(sql[end])) {
+          ++end;
+        }
+      }
+      if (end < sql_length && (sql[end] == 'e' || sql[end] == 'E')) {
+        auto exponent_end = end + 1;
+        if (exponent_end < sql_length && (sql[exponent_end] == '+' || sql[exponent_end] == '-')) {
+          ++exponent_end;
+        }
+        if (exponent_end < sql_length && is_digit(sql[exponent_end])) {
+          is_floating_point = true;
+          end = exponent_end;
+          while (end < sql_length && is_digit(sql[end])) {
+            ++end;
+          }
+        }
+      }
+
+      // Something like `1abc` is not a number we can handle.
+      if (end < sql_length && is_identifier_character(sql[end])) {
+        return std::nullopt;
+      }
+
+      const auto token = sql.substr(position, end - position);
+      auto literal = std::optional<AllTypeVariant>{};
+      if (!is_typed_literal_keyword(previous_word)) {
+        if (is_floating_point) {
+          literal = std::strtod(token.c_str(), nullptr);
+        } else {
+          auto value = int64_t{0};
+          const auto [parse_end, error] = std::from_chars(token.data(), token.data() + token.size(), value);
+          // Integers that exceed the range of long are left to the parser, which rejects them.
+          if (error == std::errc{} && parse_end == token.data() + token.size()) {
+            if (value >= std::numeric_limits<int32_t>::min() && value <= std::numeric_limits<int32_t>::max()) {
+              literal = static_cast<int32_t>(value);
+            } else {
+              literal = value;
+            }
+          }
+        }
+      }
+
+      if (literal) {
+        parameterized_sql.sql += '?';
+        parameterized_sql.literals.emplace_back(*literal);
+      } else {
+        parameterized_sql.sql += token;
+      }
+      position = end;
+      previous_word.clear();
+      continue;
+    }
+
+    if (!std::isspace(static_cast<unsigned char>(character))) {
+      previous_word.clear();
+    }
+    parameterized_sql.sql += character;
+    ++position;
+  }
+
+  return parameterized_sql;
+}
+
+}  // namespace hyrise
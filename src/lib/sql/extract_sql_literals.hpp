@@ -0,0 +1,32 @@
+#pragma once
+
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "all_type_variant.hpp"
+
+namespace hyrise {
+
+struct ParameterizedSQL {
+  // The SQL string with each extracted literal replaced by a `?`.
+  std::string sql;
+
+  // The values of the extracted literals, in the order of their placeholders (i.e., by ValuePlaceholderID). Integers
+  // are typed as the SQLTranslator types them (int if they fit, otherwise long), floating-point numbers as double.
+  std::vector<AllTypeVariant> literals;
+};
+
+/**
+ * Replaces the numeric and string literals of a single SQL statement with placeholders. Statements that only differ in
+ * their literals thus share the same normalized SQL string, which can be used as a key for caching their plans.
+ *
+ * Literals that are part of the statement's structure rather than values (i.e., the strings and numbers following the
+ * DATE, TIMESTAMP, and INTERVAL keywords) are kept. Identifiers, keywords, and comments are copied verbatim.
+ *
+ * Returns std::nullopt if the statement already contains placeholders or if its literals cannot be extracted safely
+ * (e.g., unterminated strings or escape sequences).
+ */
+std::optional<ParameterizedSQL> extract_sql_literals(const std::string& sql);
+
+}  // namespace hyrise
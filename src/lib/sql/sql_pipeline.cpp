@@ -17,9 +17,12 @@ namespace hyrise {
 SQLPipeline::SQLPipeline(const std::string& sql, const std::shared_ptr<TransactionContext>& transaction_context,
                          const UseMvcc use_mvcc, const std::shared_ptr<Optimizer>& optimizer,
                          const std::shared_ptr<SQLPhysicalPlanCache>& init_pqp_cache,
-                         const std::shared_ptr<SQLLogicalPlanCache>& init_lqp_cache)
+                         const std::shared_ptr<SQLLogicalPlanCache>& init_lqp_cache,
+                         const std::shared_ptr<SQLParameterizedPlanCache>& init_parameterized_lqp_cache,
+                         const uint32_t scheduling_weight)
     : pqp_cache(init_pqp_cache),
       lqp_cache(init_lqp_cache),
+      parameterized_lqp_cache(init_parameterized_lqp_cache),
       _sql(sql),
       _transaction_context(transaction_context),
       _optimizer(optimizer) {
@@ -80,8 +83,9 @@ SQLPipeline::SQLPipeline(const std::string& sql, const std::shared_ptr<Transacti
     const auto statement_string = boost::trim_copy(sql.substr(sql_string_offset, statement_string_length));
     sql_string_offset += statement_string_length;
 
-    auto pipeline_statement = std::make_shared<SQLPipelineStatement>(statement_string, std::move(parsed_statement),
-                                                                     use_mvcc, optimizer, pqp_cache, lqp_cache);
+    auto pipeline_statement = std::make_shared<SQLPipelineStatement>(
+        statement_string, std::move(parsed_statement), use_mvcc, optimizer, pqp_cache, lqp_cache,
+        parameterized_lqp_cache, scheduling_weight);
     _sql_pipeline_statements.emplace_back(std::move(pipeline_statement));
   }
 
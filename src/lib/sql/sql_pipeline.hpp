@@ -35,7 +35,9 @@ class SQLPipeline : public Noncopyable {
   SQLPipeline(const std::string& sql, const std::shared_ptr<TransactionContext>& transaction_context,
               const UseMvcc use_mvcc, const std::shared_ptr<Optimizer>& optimizer,
               const std::shared_ptr<SQLPhysicalPlanCache>& init_pqp_cache,
-              const std::shared_ptr<SQLLogicalPlanCache>& init_lqp_cache);
+              const std::shared_ptr<SQLLogicalPlanCache>& init_lqp_cache,
+              const std::shared_ptr<SQLParameterizedPlanCache>& init_parameterized_lqp_cache,
+              const uint32_t scheduling_weight);
 
   // Returns the original SQL string
   const std::string& get_sql() const;
@@ -95,6 +97,7 @@ class SQLPipeline : public Noncopyable {
 
   const std::shared_ptr<SQLPhysicalPlanCache> pqp_cache;
   const std::shared_ptr<SQLLogicalPlanCache> lqp_cache;
+  const std::shared_ptr<SQLParameterizedPlanCache> parameterized_lqp_cache;
 
  private:
   friend class SQLPipelineStatementTest;
@@ -1,10 +1,14 @@
 #include "sql_pipeline_builder.hpp"
 #include "hyrise.hpp"
+#include "utils/assert.hpp"
 
 namespace hyrise {
 
 SQLPipelineBuilder::SQLPipelineBuilder(const std::string& sql)
-    : _sql(sql), _pqp_cache(Hyrise::get().default_pqp_cache), _lqp_cache(Hyrise::get().default_lqp_cache) {}
+    : _sql(sql),
+      _pqp_cache(Hyrise::get().default_pqp_cache),
+      _lqp_cache(Hyrise::get().default_lqp_cache),
+      _parameterized_lqp_cache(Hyrise::get().default_parameterized_lqp_cache) {}
 
 SQLPipelineBuilder& SQLPipelineBuilder::with_mvcc(const UseMvcc use_mvcc) {
   _use_mvcc = use_mvcc;
@@ -34,13 +38,27 @@ SQLPipelineBuilder& SQLPipelineBuilder::with_lqp_cache(const std::shared_ptr<SQL
   return *this;
 }
 
+SQLPipelineBuilder& SQLPipelineBuilder::with_parameterized_lqp_cache(
+    const std::shared_ptr<SQLParameterizedPlanCache>& parameterized_lqp_cache) {
+  _parameterized_lqp_cache = parameterized_lqp_cache;
+  return *this;
+}
+
+SQLPipelineBuilder& SQLPipelineBuilder::with_scheduling_weight(const uint32_t scheduling_weight) {
+  AssertInput(scheduling_weight > 0 && scheduling_weight <= QueryTaskGroup::MAX_WEIGHT,
+              "Scheduling weight must be in [1, " + std::to_string(QueryTaskGroup::MAX_WEIGHT) + "].");
+  _scheduling_weight = scheduling_weight;
+  return *this;
+}
+
 SQLPipelineBuilder& SQLPipelineBuilder::disable_mvcc() {
   return with_mvcc(UseMvcc::No);
 }
 
 SQLPipeline SQLPipelineBuilder::create_pipeline() const {
   auto optimizer = _optimizer ? _optimizer : Optimizer::create_default_optimizer();
-  auto pipeline = SQLPipeline(_sql, _transaction_context, _use_mvcc, optimizer, _pqp_cache, _lqp_cache);
+  auto pipeline = SQLPipeline(_sql, _transaction_context, _use_mvcc, optimizer, _pqp_cache, _lqp_cache,
+                              _parameterized_lqp_cache, _scheduling_weight);
   return pipeline;
 }
 
@@ -5,6 +5,7 @@
 
 #include "types.hpp"
 
+#include "scheduler/query_task_group.hpp"
 #include "sql/sql_plan_cache.hpp"
 #include "sql_pipeline.hpp"
 #include "sql_pipeline_statement.hpp"
@@ -28,6 +29,7 @@ class Optimizer;
  * Defaults:
  *  - MVCC is enabled
  *  - The default Optimizer (Optimizer::create_default_optimizer()) is used.
+ *  - The statements are scheduled with QueryTaskGroup::DEFAULT_WEIGHT.
  *
  * Favour this interface over calling the SQLPipeline[Statement] constructors with their long parameter list.
  * See SQLPipeline[Statement] doc for these classes, in short SQLPipeline ist for queries with multiple statement,
@@ -43,6 +45,18 @@ class SQLPipelineBuilder final {
   SQLPipelineBuilder& with_pqp_cache(const std::shared_ptr<SQLPhysicalPlanCache>& pqp_cache);
   SQLPipelineBuilder& with_lqp_cache(const std::shared_ptr<SQLLogicalPlanCache>& lqp_cache);
 
+  /**
+   * Enables the parameterized caching of LQPs, see SQLPipelineStatement::get_optimized_logical_plan(). If set, it is
+   * used instead of the LQP cache.
+   */
+  SQLPipelineBuilder& with_parameterized_lqp_cache(
+      const std::shared_ptr<SQLParameterizedPlanCache>& parameterized_lqp_cache);
+
+  /**
+   * Relative share of the workers that the statements get while other queries are running, see QueryTaskGroup.
+   */
+  SQLPipelineBuilder& with_scheduling_weight(const uint32_t scheduling_weight);
+
   /**
    * Short for with_mvcc(UseMvcc::No)
    */
@@ -58,6 +72,8 @@ class SQLPipelineBuilder final {
   std::shared_ptr<Optimizer> _optimizer;
   std::shared_ptr<SQLPhysicalPlanCache> _pqp_cache;
   std::shared_ptr<SQLLogicalPlanCache> _lqp_cache;
+  std::shared_ptr<SQLParameterizedPlanCache> _parameterized_lqp_cache;
+  uint32_t _scheduling_weight{QueryTaskGroup::DEFAULT_WEIGHT};
 };
 
 }  // namespace hyrise
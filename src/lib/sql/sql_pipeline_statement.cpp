@@ -1,41 +1,223 @@
 #include "sql_pipeline_statement.hpp"
 
+#include <algorithm>
 #include <fstream>
 #include <iomanip>
+#include <limits>
 #include <memory>
+#include <optional>
+#include <unordered_set>
 #include <utility>
 
 #include <boost/algorithm/string.hpp>
 
 #include "SQLParser.h"
 #include "create_sql_parser_error_message.hpp"
+#include "expression/expression_utils.hpp"
+#include "expression/lqp_subquery_expression.hpp"
+#include "expression/placeholder_expression.hpp"
 #include "expression/value_expression.hpp"
+#include "extract_sql_literals.hpp"
 #include "hyrise.hpp"
+#include "logical_query_plan/join_node.hpp"
+#include "logical_query_plan/limit_node.hpp"
+#include "logical_query_plan/logical_plan_root_node.hpp"
 #include "logical_query_plan/lqp_utils.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
 #include "operators/export.hpp"
 #include "operators/import.hpp"
+#include "operators/maintenance/create_index.hpp"
 #include "operators/maintenance/create_prepared_plan.hpp"
 #include "operators/maintenance/create_table.hpp"
 #include "operators/maintenance/create_view.hpp"
 #include "operators/maintenance/drop_table.hpp"
 #include "operators/maintenance/drop_view.hpp"
 #include "optimizer/optimizer.hpp"
+#include "optimizer/strategy/chunk_pruning_rule.hpp"
+#include "optimizer/strategy/index_scan_rule.hpp"
+#include "optimizer/strategy/top_k_rule.hpp"
 #include "scheduler/job_task.hpp"
 #include "sql/sql_pipeline_builder.hpp"
 #include "sql/sql_plan_cache.hpp"
 #include "sql/sql_translator.hpp"
+#include "storage/prepared_plan.hpp"
 #include "utils/assert.hpp"
 
+namespace {
+
+using namespace hyrise;  // NOLINT
+
+void lqp_replace_literals_with_placeholders_impl(const std::shared_ptr<AbstractLQPNode>& lqp,
+                                                 const std::vector<ParameterID>& parameter_ids,
+                                                 std::vector<bool>& replaced_literals,
+                                                 std::unordered_set<std::shared_ptr<AbstractLQPNode>>& visited_nodes);
+
+void expression_replace_literals_with_placeholders_impl(
+    std::shared_ptr<AbstractExpression>& expression, const std::vector<ParameterID>& parameter_ids,
+    std::vector<bool>& replaced_literals, std::unordered_set<std::shared_ptr<AbstractLQPNode>>& visited_nodes) {
+  visit_expression(expression, [&](auto& sub_expression) {
+    if (sub_expression->type == ExpressionType::Value) {
+      const auto& value_expression = static_cast<const ValueExpression&>(*sub_expression);
+      if (value_expression.value_placeholder_id) {
+        const auto literal_id = static_cast<size_t>(*value_expression.value_placeholder_id);
+        replaced_literals[literal_id] = true;
+        sub_expression = std::make_shared<PlaceholderExpression>(parameter_ids[literal_id]);
+      }
+
+      return ExpressionVisitation::DoNotVisitArguments;
+    }
+
+    if (const auto subquery_expression = std::dynamic_pointer_cast<LQPSubqueryExpression>(sub_expression)) {
+      lqp_replace_literals_with_placeholders_impl(subquery_expression->lqp, parameter_ids, replaced_literals,
+                                                  visited_nodes);
+    }
+
+    return ExpressionVisitation::VisitArguments;
+  });
+}
+
+void lqp_replace_literals_with_placeholders_impl(const std::shared_ptr<AbstractLQPNode>& lqp,
+                                                 const std::vector<ParameterID>& parameter_ids,
+                                                 std::vector<bool>& replaced_literals,
+                                                 std::unordered_set<std::shared_ptr<AbstractLQPNode>>& visited_nodes) {
+  visit_lqp(lqp, [&](const auto& node) {
+    if (!visited_nodes.emplace(node).second) {
+      return LQPVisitation::DoNotVisitInputs;
+    }
+
+    for (auto& expression : node->node_expressions) {
+      expression_replace_literals_with_placeholders_impl(expression, parameter_ids, replaced_literals, visited_nodes);
+    }
+
+    return LQPVisitation::VisitInputs;
+  });
+}
+
+/**
+ * Turns the optimized LQP of a parameterized statement back into an LQP with placeholders by replacing the values that
+ * were extracted from literals (i.e., that have a value_placeholder_id) with the placeholders of the literals. Returns
+ * false if the optimizer removed any of these values (e.g., when it simplified `a > 5 AND a > 7` to `a > 7`). In this
+ * case, the LQP is only valid for the given literals.
+ */
+bool lqp_replace_literals_with_placeholders(const std::shared_ptr<AbstractLQPNode>& lqp,
+                                            const std::vector<ParameterID>& parameter_ids) {
+  auto replaced_literals = std::vector<bool>(parameter_ids.size(), false);
+  auto visited_nodes = std::unordered_set<std::shared_ptr<AbstractLQPNode>>{};
+  lqp_replace_literals_with_placeholders_impl(lqp, parameter_ids, replaced_literals, visited_nodes);
+
+  return std::all_of(replaced_literals.cbegin(), replaced_literals.cend(), [](const auto replaced) {
+    return replaced;
+  });
+}
+
+/**
+ * Re-evaluates the decisions of the optimizer rules that depend on the literals of a parameterized statement: the
+ * chunks pruned by the ChunkPruningRule, the scan types and join index sides chosen by the IndexScanRule, and the
+ * Sort/Limit pairs that the TopKRule fuses depending on the row count of the LIMIT clause. The LQP is updated with the
+ * new decisions. Returns whether any decision changed.
+ */
+bool reevaluate_literal_dependent_decisions(const std::shared_ptr<AbstractLQPNode>& lqp,
+                                            const std::shared_ptr<AbstractCostEstimator>& cost_estimator) {
+  const auto root_node = LogicalPlanRootNode::make(lqp);
+
+  auto lqps = std::vector<std::shared_ptr<AbstractLQPNode>>{root_node};
+  for (const auto& [subquery_lqp, _] : collect_lqp_subquery_expressions_by_lqp(root_node)) {
+    lqps.emplace_back(subquery_lqp);
+  }
+
+  // Store the previous decisions and reset them, as the rules expect unoptimized nodes.
+  auto stored_table_nodes = std::vector<std::shared_ptr<StoredTableNode>>{};
+  auto pruned_chunk_ids = std::vector<std::vector<ChunkID>>{};
+  auto predicate_nodes = std::vector<std::shared_ptr<PredicateNode>>{};
+  auto scan_types = std::vector<ScanType>{};
+  auto join_nodes = std::vector<std::shared_ptr<JoinNode>>{};
+  auto index_sides = std::vector<std::optional<LQPInputSide>>{};
+  auto limit_nodes = std::vector<std::shared_ptr<LimitNode>>{};
+  auto fuse_with_sorts = std::vector<bool>{};
+  auto visited_nodes = std::unordered_set<std::shared_ptr<AbstractLQPNode>>{};
+  for (const auto& plan : lqps) {
+    visit_lqp(plan, [&](const auto& node) {
+      if (!visited_nodes.emplace(node).second) {
+        return LQPVisitation::DoNotVisitInputs;
+      }
+
+      if (node->type == LQPNodeType::StoredTable) {
+        const auto stored_table_node = std::static_pointer_cast<StoredTableNode>(node);
+        pruned_chunk_ids.emplace_back(stored_table_node->pruned_chunk_ids());
+        stored_table_node->set_pruned_chunk_ids({});
+        stored_table_nodes.emplace_back(stored_table_node);
+      } else if (node->type == LQPNodeType::Predicate) {
+        const auto predicate_node = std::static_pointer_cast<PredicateNode>(node);
+        scan_types.emplace_back(predicate_node->scan_type);
+        predicate_node->scan_type = ScanType::TableScan;
+        predicate_nodes.emplace_back(predicate_node);
+      } else if (node->type == LQPNodeType::Join) {
+        const auto join_node = std::static_pointer_cast<JoinNode>(node);
+        index_sides.emplace_back(join_node->index_side);
+        join_node->index_side.reset();
+        join_nodes.emplace_back(join_node);
+      } else if (node->type == LQPNodeType::Limit) {
+        const auto limit_node = std::static_pointer_cast<LimitNode>(node);
+        fuse_with_sorts.emplace_back(limit_node->fuse_with_sort);
+        limit_node->fuse_with_sort = false;
+        limit_nodes.emplace_back(limit_node);
+      }
+
+      return LQPVisitation::VisitInputs;
+    });
+  }
+
+  ChunkPruningRule{}.apply_to_plan(root_node);
+  auto index_scan_rule = IndexScanRule{};
+  index_scan_rule.cost_estimator = cost_estimator;
+  index_scan_rule.apply_to_plan(root_node);
+  TopKRule{}.apply_to_plan(root_node);
+
+  root_node->set_left_input(nullptr);
+
+  for (auto node_idx = size_t{0}; node_idx < stored_table_nodes.size(); ++node_idx) {
+    if (stored_table_nodes[node_idx]->pruned_chunk_ids() != pruned_chunk_ids[node_idx]) {
+      return true;
+    }
+  }
+
+  for (auto node_idx = size_t{0}; node_idx < predicate_nodes.size(); ++node_idx) {
+    if (predicate_nodes[node_idx]->scan_type != scan_types[node_idx]) {
+      return true;
+    }
+  }
+
+  for (auto node_idx = size_t{0}; node_idx < join_nodes.size(); ++node_idx) {
+    if (join_nodes[node_idx]->index_side != index_sides[node_idx]) {
+      return true;
+    }
+  }
+
+  for (auto node_idx = size_t{0}; node_idx < limit_nodes.size(); ++node_idx) {
+    if (limit_nodes[node_idx]->fuse_with_sort != fuse_with_sorts[node_idx]) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+}  // namespace
+
 namespace hyrise {
 
-SQLPipelineStatement::SQLPipelineStatement(const std::string& sql, std::shared_ptr<hsql::SQLParserResult> parsed_sql,
-                                           const UseMvcc use_mvcc, const std::shared_ptr<Optimizer>& optimizer,
-                                           const std::shared_ptr<SQLPhysicalPlanCache>& init_pqp_cache,
-                                           const std::shared_ptr<SQLLogicalPlanCache>& init_lqp_cache)
+SQLPipelineStatement::SQLPipelineStatement(
+    const std::string& sql, std::shared_ptr<hsql::SQLParserResult> parsed_sql, const UseMvcc use_mvcc,
+    const std::shared_ptr<Optimizer>& optimizer, const std::shared_ptr<SQLPhysicalPlanCache>& init_pqp_cache,
+    const std::shared_ptr<SQLLogicalPlanCache>& init_lqp_cache,
+    const std::shared_ptr<SQLParameterizedPlanCache>& init_parameterized_lqp_cache, const uint32_t scheduling_weight)
     : pqp_cache(init_pqp_cache),
       lqp_cache(init_lqp_cache),
+      parameterized_lqp_cache(init_parameterized_lqp_cache),
       _sql_string(sql),
       _use_mvcc(use_mvcc),
+      _scheduling_weight(scheduling_weight),
       _optimizer(optimizer),
       _parsed_sql_statement(std::move(parsed_sql)),
       _metrics(std::make_shared<SQLPipelineStatementMetrics>()) {
@@ -114,6 +296,13 @@ const std::shared_ptr<AbstractLQPNode>& SQLPipelineStatement::get_optimized_logi
     return _optimized_logical_plan;
   }
 
+  if (parameterized_lqp_cache) {
+    _optimized_logical_plan = _get_parameterized_optimized_logical_plan();
+    if (_optimized_logical_plan) {
+      return _optimized_logical_plan;
+    }
+  }
+
   // Handle logical query plan if statement has been cached
   if (lqp_cache) {
     if (const auto cached_plan = lqp_cache->try_get(_sql_string)) {
@@ -131,20 +320,12 @@ const std::shared_ptr<AbstractLQPNode>& SQLPipelineStatement::get_optimized_logi
 
   auto unoptimized_lqp = get_unoptimized_logical_plan();
 
-  const auto started = std::chrono::steady_clock::now();
-
   // The optimizer works on the original unoptimized LQP nodes. After optimizing, the unoptimized version is also
   // optimized, which could lead to subtle bugs. optimized_logical_plan holds the original values now.
   // As the unoptimized LQP is only used for visualization, we can afford to recreate it if necessary.
   _unoptimized_logical_plan = nullptr;
 
-  auto optimizer_rule_durations = std::make_shared<std::vector<OptimizerRuleMetrics>>();
-
-  _optimized_logical_plan = _optimizer->optimize(std::move(unoptimized_lqp), optimizer_rule_durations);
-
-  const auto done = std::chrono::steady_clock::now();
-  _metrics->optimization_duration = done - started;
-  _metrics->optimizer_rule_durations = *optimizer_rule_durations;
+  _optimized_logical_plan = _optimize_logical_plan(std::move(unoptimized_lqp));
 
   // Cache newly created plan for the according sql statement
   if (lqp_cache && _translation_info.cacheable) {
@@ -270,6 +451,14 @@ std::pair<SQLPipelineStatus, const std::shared_ptr<const Table>&> SQLPipelineSta
 
   const auto& tasks = get_tasks();
 
+  // Wait until the AdmissionControl lets the query run. The query's tasks, including the tasks spawned by its
+  // operators, form a group that shares the workers with the other running queries.
+  const auto admission = AdmissionControl::ScopedAdmission{Hyrise::get().admission_control, _sql_string,
+                                                           _scheduling_weight};
+  for (const auto& task : tasks) {
+    task->set_query_task_group(admission.query_task_group());
+  }
+
   const auto started = std::chrono::steady_clock::now();
 
   Hyrise::get().scheduler()->schedule_and_wait_for_tasks(tasks);
@@ -341,6 +530,14 @@ void SQLPipelineStatement::_precheck_ddl_operators(const std::shared_ptr<Abstrac
                   "Prepared Plan '" + create_prepared_plan->prepared_plan_name() + "' already exists.");
       break;
     }
+    case OperatorType::CreateIndex: {
+      const auto create_index = std::dynamic_pointer_cast<CreateIndex>(pqp);
+      AssertInput(storage_manager.has_table(create_index->table_name),
+                  "Table '" + create_index->table_name + "' does not exist.");
+      AssertInput(create_index->if_not_exists || !create_index->index_exists(),
+                  "Index '" + create_index->index_name + "' already exists.");
+      break;
+    }
     case OperatorType::CreateTable: {
       const auto create_table = std::dynamic_pointer_cast<CreateTable>(pqp);
       AssertInput(create_table->if_not_exists || !storage_manager.has_table(create_table->table_name),
@@ -376,6 +573,108 @@ void SQLPipelineStatement::_precheck_ddl_operators(const std::shared_ptr<Abstrac
   }
 }
 
+std::shared_ptr<AbstractLQPNode> SQLPipelineStatement::_optimize_logical_plan(std::shared_ptr<AbstractLQPNode> lqp) {
+  const auto started = std::chrono::steady_clock::now();
+
+  auto optimizer_rule_durations = std::make_shared<std::vector<OptimizerRuleMetrics>>();
+
+  auto optimized_lqp = _optimizer->optimize(std::move(lqp), optimizer_rule_durations);
+
+  const auto done = std::chrono::steady_clock::now();
+  _metrics->optimization_duration = done - started;
+  _metrics->optimizer_rule_durations = *optimizer_rule_durations;
+
+  return optimized_lqp;
+}
+
+std::shared_ptr<AbstractLQPNode> SQLPipelineStatement::_get_parameterized_optimized_logical_plan() {
+  const auto parameterized_sql = extract_sql_literals(_sql_string);
+  if (!parameterized_sql ||
+      parameterized_sql->literals.size() > std::numeric_limits<ValuePlaceholderID::base_type>::max()) {
+    return nullptr;
+  }
+
+  const auto& [sql, literals] = *parameterized_sql;
+
+  // The values remember the literal they were extracted from so that they can be replaced with placeholders again
+  // after the optimization.
+  auto values = std::vector<std::shared_ptr<AbstractExpression>>{};
+  values.reserve(literals.size());
+  for (auto literal_id = size_t{0}; literal_id < literals.size(); ++literal_id) {
+    const auto value = std::make_shared<ValueExpression>(literals[literal_id]);
+    value->value_placeholder_id = ValuePlaceholderID{static_cast<ValuePlaceholderID::base_type>(literal_id)};
+    values.emplace_back(value);
+  }
+
+  if (const auto cached_plan = parameterized_lqp_cache->try_get(sql)) {
+    const auto& prepared_plan = *cached_plan;
+    if (!prepared_plan) {
+      return nullptr;
+    }
+
+    const auto started = std::chrono::steady_clock::now();
+    auto lqp = prepared_plan->instantiate(values);
+
+    // MVCC-enabled and MVCC-disabled LQPs will evict each other. If the literals lead to different decisions of the
+    // ChunkPruningRule, the IndexScanRule, or the TopKRule, we optimize the statement again and replace the cache
+    // entry.
+    if (lqp_is_validated(lqp) == (_use_mvcc == UseMvcc::Yes) &&
+        !reevaluate_literal_dependent_decisions(lqp, _optimizer->cost_estimator())) {
+      _metrics->optimization_duration = std::chrono::steady_clock::now() - started;
+      _metrics->parameterized_lqp_cache_hit = true;
+      return lqp;
+    }
+  }
+
+  auto parsed_sql = hsql::SQLParserResult{};
+  hsql::SQLParser::parse(sql, &parsed_sql);
+  if (!parsed_sql.isValid() || parsed_sql.size() != 1 || parsed_sql.parameters().size() != literals.size()) {
+    parameterized_lqp_cache->set(sql, nullptr);
+    return nullptr;
+  }
+
+  const auto started = std::chrono::steady_clock::now();
+
+  auto translation_result = SQLTranslationResult{};
+  try {
+    translation_result = SQLTranslator{_use_mvcc}.translate_parser_result(parsed_sql);
+  } catch (const std::exception& /*exception*/) {
+    // Not all SQL constructs accept placeholders (e.g., those that the SQLTranslator evaluates itself). Such
+    // statements are translated without parameterization, which also reports the errors of the original statement.
+    parameterized_lqp_cache->set(sql, nullptr);
+    return nullptr;
+  }
+
+  const auto done = std::chrono::steady_clock::now();
+  _metrics->sql_translation_duration = done - started;
+
+  const auto& parameter_ids = translation_result.translation_info.parameter_ids_of_value_placeholders;
+  if (!translation_result.translation_info.cacheable || parameter_ids.size() != literals.size()) {
+    parameterized_lqp_cache->set(sql, nullptr);
+    return nullptr;
+  }
+
+  DebugAssert(translation_result.lqp_nodes.size() == 1,
+              "LQP translation returned no or more than one LQP root for a single statement.");
+  auto lqp = PreparedPlan{translation_result.lqp_nodes.front(), parameter_ids}.instantiate(values);
+
+  auto optimized_lqp = _optimize_logical_plan(std::move(lqp));
+
+  // The rules might decide differently when they are applied to the optimized LQP instead of the unoptimized one (e.g.,
+  // after the PredicateMergeRule merged predicates). As cache hits compare the decisions for the optimized LQP, the
+  // cached decisions have to be made the same way.
+  reevaluate_literal_dependent_decisions(optimized_lqp, _optimizer->cost_estimator());
+
+  const auto parameterized_lqp = optimized_lqp->deep_copy();
+  if (lqp_replace_literals_with_placeholders(parameterized_lqp, parameter_ids)) {
+    parameterized_lqp_cache->set(sql, std::make_shared<PreparedPlan>(parameterized_lqp, parameter_ids));
+  } else {
+    parameterized_lqp_cache->set(sql, nullptr);
+  }
+
+  return optimized_lqp;
+}
+
 bool SQLPipelineStatement::_is_transaction_statement() {
   return get_parsed_sql_statement()->getStatements().front()->isType(hsql::kStmtTransaction);
 }
@@ -26,6 +26,7 @@ struct SQLPipelineStatementMetrics {
   std::chrono::nanoseconds plan_execution_duration{};
 
   bool query_plan_cache_hit = false;
+  bool parameterized_lqp_cache_hit = false;
 };
 
 enum class SQLPipelineStatus {
@@ -50,6 +51,14 @@ enum class SQLPipelineStatus {
  *  If a physical plan for an SQL statement is in the SQLPhysicalPlanCache, it will be used instead of translating the
  *  optimized LQP (get_optimized_logical_plans()) into a PQP. Thus, in this case, the optimized LQP and PQP could be
  *  different.
+ *
+ * NOTE:
+ *  If an SQLParameterizedPlanCache is set, the literals of the statement are replaced with placeholders and the
+ *  normalized statement is used as cache key (see extract_sql_literals()). On a cache hit, the cached LQP is
+ *  instantiated with the statement's literals. As the ChunkPruningRule and the IndexScanRule depend on the literals,
+ *  their decisions are re-evaluated for the instantiated LQP. If any decision differs, the statement is optimized
+ *  anew and replaces the cache entry. Other decisions of the optimizer (e.g., the join order) are reused even though
+ *  they might not be optimal for the new literals.
  */
 class SQLPipelineStatement : public Noncopyable {
  public:
@@ -57,7 +66,9 @@ class SQLPipelineStatement : public Noncopyable {
   SQLPipelineStatement(const std::string& sql, std::shared_ptr<hsql::SQLParserResult> parsed_sql,
                        const UseMvcc use_mvcc, const std::shared_ptr<Optimizer>& optimizer,
                        const std::shared_ptr<SQLPhysicalPlanCache>& init_pqp_cache,
-                       const std::shared_ptr<SQLLogicalPlanCache>& init_lqp_cache);
+                       const std::shared_ptr<SQLLogicalPlanCache>& init_lqp_cache,
+                       const std::shared_ptr<SQLParameterizedPlanCache>& init_parameterized_lqp_cache,
+                       const uint32_t scheduling_weight);
 
   // Set the transaction context if this SQLPipelineStatement should not auto-commit.
   void set_transaction_context(const std::shared_ptr<TransactionContext>& transaction_context);
@@ -102,10 +113,17 @@ class SQLPipelineStatement : public Noncopyable {
 
   const std::shared_ptr<SQLPhysicalPlanCache> pqp_cache;
   const std::shared_ptr<SQLLogicalPlanCache> lqp_cache;
+  const std::shared_ptr<SQLParameterizedPlanCache> parameterized_lqp_cache;
 
  private:
   bool _is_transaction_statement();
 
+  // Optimizes the LQP and records the optimization duration in the metrics.
+  std::shared_ptr<AbstractLQPNode> _optimize_logical_plan(std::shared_ptr<AbstractLQPNode> lqp);
+
+  // Returns the optimized LQP using the parameterized LQP cache or nullptr if the statement cannot be parameterized.
+  std::shared_ptr<AbstractLQPNode> _get_parameterized_optimized_logical_plan();
+
   // Returns the tasks that execute transaction statements
   std::vector<std::shared_ptr<AbstractTask>> _get_transaction_tasks();
 
@@ -116,6 +134,7 @@ class SQLPipelineStatement : public Noncopyable {
 
   const std::string _sql_string;
   const UseMvcc _use_mvcc;
+  const uint32_t _scheduling_weight;
 
   const std::shared_ptr<Optimizer> _optimizer;
 
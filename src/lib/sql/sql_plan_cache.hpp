@@ -9,8 +9,14 @@ namespace hyrise {
 
 class AbstractOperator;
 class AbstractLQPNode;
+class PreparedPlan;
 
 using SQLPhysicalPlanCache = GDFSCache<std::string, std::shared_ptr<AbstractOperator>>;
 using SQLLogicalPlanCache = GDFSCache<std::string, std::shared_ptr<AbstractLQPNode>>;
 
+// Caches optimized LQPs of statements whose literals were replaced with placeholders, keyed by the normalized statement
+// (see extract_sql_literals()). Statements with the same structure but different literals share one entry. nullptr
+// marks statements that cannot be parameterized, so that we do not retry for each execution.
+using SQLParameterizedPlanCache = GDFSCache<std::string, std::shared_ptr<PreparedPlan>>;
+
 }  // namespace hyrise
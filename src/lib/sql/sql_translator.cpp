@@ -27,6 +27,7 @@
 #include "logical_query_plan/aggregate_node.hpp"
 #include "logical_query_plan/alias_node.hpp"
 #include "logical_query_plan/change_meta_table_node.hpp"
+#include "logical_query_plan/create_index_node.hpp"
 #include "logical_query_plan/create_prepared_plan_node.hpp"
 #include "logical_query_plan/create_table_node.hpp"
 #include "logical_query_plan/create_view_node.hpp"
@@ -445,8 +446,6 @@ std::shared_ptr<AbstractLQPNode> SQLTranslator::_translate_select_statement(cons
 
   if (select.setOperations) {
     for (const auto* const set_operator : *select.setOperations) {
-      // Currently, only the SQL translation of intersect and except is implemented.
-      AssertInput(set_operator->setType != hsql::kSetUnion, "Union Operations are currently not supported");
       _translate_set_operation(*set_operator);
 
       // In addition to local ORDER BY and LIMIT clauses, the result of the set operation(s) may have final clauses,
@@ -1502,7 +1501,7 @@ std::shared_ptr<AbstractLQPNode> SQLTranslator::_translate_create(const hsql::Cr
     case hsql::CreateType::kCreateTableFromTbl:
       FailInput("CREATE TABLE FROM is not yet supported");
     case hsql::CreateType::kCreateIndex:
-      FailInput("CREATE INDEX is not yet supported");
+      return _translate_create_index(create_statement);
   }
   Fail("Invalid enum value");
 }
@@ -1677,6 +1676,24 @@ std::shared_ptr<AbstractLQPNode> SQLTranslator::_translate_create_table(const hs
   return CreateTableNode::make(create_statement.tableName, create_statement.ifNotExists, input_node);
 }
 
+std::shared_ptr<AbstractLQPNode> SQLTranslator::_translate_create_index(const hsql::CreateStatement& create_statement) {
+  const auto table_name = std::string{create_statement.tableName};
+  const auto& storage_manager = Hyrise::get().storage_manager;
+  AssertInput(storage_manager.has_table(table_name), "Did not find a table with name " + table_name);
+  Assert(create_statement.indexColumns, "CREATE INDEX: No columns specified. Parser bug?");
+  AssertInput(create_statement.indexColumns->size() == 1, "Multi-column indexes are not supported");
+
+  const auto column_name = std::string{create_statement.indexColumns->front()};
+  const auto table = storage_manager.get_table(table_name);
+  const auto column_names = table->column_names();
+  AssertInput(std::find(column_names.begin(), column_names.end(), column_name) != column_names.end(),
+              "Did not find a column with name " + column_name + " in table " + table_name);
+  const auto column_id = table->column_id_by_name(column_name);
+
+  const auto index_name = create_statement.indexName ? std::string{create_statement.indexName} : std::string{};
+  return CreateIndexNode::make(index_name, table_name, column_id, create_statement.ifNotExists);
+}
+
 // NOLINTNEXTLINE - while this particular method could be made static, others cannot.
 std::shared_ptr<AbstractLQPNode> SQLTranslator::_translate_drop(const hsql::DropStatement& drop_statement) {
   switch (drop_statement.type) {
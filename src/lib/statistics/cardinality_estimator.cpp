@@ -5,6 +5,7 @@
 #include "expression/expression_functional.hpp"
 #include "expression/expression_utils.hpp"
 #include "expression/logical_expression.hpp"
+#include "expression/lqp_column_expression.hpp"
 #include "expression/lqp_subquery_expression.hpp"
 #include "expression/value_expression.hpp"
 #include "hyrise.hpp"
@@ -28,6 +29,7 @@
 #include "resolve_type.hpp"
 #include "statistics/attribute_statistics.hpp"
 #include "statistics/cardinality_estimation_cache.hpp"
+#include "statistics/column_group_statistics.hpp"
 #include "statistics/statistics_objects/equal_distinct_count_histogram.hpp"
 #include "statistics/statistics_objects/generic_histogram.hpp"
 #include "statistics/statistics_objects/generic_histogram_builder.hpp"
@@ -63,6 +65,63 @@ std::optional<float> estimate_null_value_ratio_of_column(const TableStatistics&
   return std::nullopt;
 }
 
+std::shared_ptr<TableStatistics> scaled_table_statistics(const TableStatistics& table_statistics,
+                                                         const Selectivity selectivity) {
+  auto column_statistics =
+      std::vector<std::shared_ptr<BaseAttributeStatistics>>{table_statistics.column_statistics.size()};
+  for (auto column_id = ColumnID{0}; column_id < column_statistics.size(); ++column_id) {
+    column_statistics[column_id] = table_statistics.column_statistics[column_id]->scaled(selectivity);
+  }
+
+  return std::make_shared<TableStatistics>(std::move(column_statistics), table_statistics.row_count * selectivity);
+}
+
+// Column group statistics and the distinct counts of the unfiltered columns are only available in the statistics of
+// the node that the columns originate from, not in the statistics estimated for intermediate results.
+std::shared_ptr<TableStatistics> original_table_statistics(
+    const std::shared_ptr<const AbstractLQPNode>& original_node) {
+  if (!original_node) {
+    return nullptr;
+  }
+
+  if (original_node->type == LQPNodeType::StoredTable) {
+    const auto& table_name = static_cast<const StoredTableNode&>(*original_node).table_name;
+    if (!Hyrise::get().storage_manager.has_table(table_name)) {
+      return nullptr;
+    }
+    return Hyrise::get().storage_manager.get_table(table_name)->table_statistics();
+  }
+
+  if (original_node->type == LQPNodeType::Mock) {
+    return static_cast<const MockNode&>(*original_node).table_statistics();
+  }
+
+  return nullptr;
+}
+
+// Returns the distinct count of the combined @param columns in their original table, if all of them stem from the
+// same table and the distinct count is known.
+std::optional<Cardinality> original_distinct_count(const std::vector<std::shared_ptr<LQPColumnExpression>>& columns) {
+  DebugAssert(!columns.empty(), "Expected at least one column.");
+  const auto original_node = columns.front()->original_node.lock();
+
+  auto column_ids = std::vector<ColumnID>{};
+  column_ids.reserve(columns.size());
+  for (const auto& column : columns) {
+    if (column->original_node.lock() != original_node || column->original_column_id == INVALID_COLUMN_ID) {
+      return std::nullopt;
+    }
+    column_ids.emplace_back(column->original_column_id);
+  }
+
+  const auto table_statistics = original_table_statistics(original_node);
+  if (!table_statistics) {
+    return std::nullopt;
+  }
+
+  return table_statistics->distinct_count(column_ids);
+}
+
 }  // namespace
 
 namespace hyrise {
@@ -210,6 +269,7 @@ std::shared_ptr<TableStatistics> CardinalityEstimator::estimate_statistics(
 
     // These Node types should not be relevant during query optimization. Return an empty TableStatistics object for
     // them
+    case LQPNodeType::CreateIndex:
     case LQPNodeType::CreateTable:
     case LQPNodeType::CreatePreparedPlan:
     case LQPNodeType::CreateView:
@@ -619,6 +679,16 @@ std::shared_ptr<TableStatistics> CardinalityEstimator::estimate_predicate_node(
     output_table_statistics = estimate_operator_scan_predicate(output_table_statistics, operator_scan_predicate);
   }
 
+  // If the predicate is correlated with the predicates below, it filters fewer rows than estimated independently.
+  if (input_table_statistics->row_count > 0 && output_table_statistics->row_count > 0) {
+    const auto correlated_selectivity = estimate_correlated_equals_selectivity(predicate_node);
+    const auto independent_selectivity = output_table_statistics->row_count / input_table_statistics->row_count;
+    if (correlated_selectivity && *correlated_selectivity > independent_selectivity) {
+      output_table_statistics =
+          scaled_table_statistics(*output_table_statistics, *correlated_selectivity / independent_selectivity);
+    }
+  }
+
   return output_table_statistics;
 }
 
@@ -646,10 +716,13 @@ std::shared_ptr<TableStatistics> CardinalityEstimator::estimate_join_node(
       case JoinMode::FullOuter:
       case JoinMode::Inner:
         switch (primary_operator_join_predicate->predicate_condition) {
-          case PredicateCondition::Equals:
-            return estimate_inner_equi_join(primary_operator_join_predicate->column_ids.first,
-                                            primary_operator_join_predicate->column_ids.second,
-                                            *left_input_table_statistics, *right_input_table_statistics);
+          case PredicateCondition::Equals: {
+            const auto primary_predicate_statistics = estimate_inner_equi_join(
+                primary_operator_join_predicate->column_ids.first, primary_operator_join_predicate->column_ids.second,
+                *left_input_table_statistics, *right_input_table_statistics);
+            return estimate_multi_predicate_equi_join(join_node, *left_input_table_statistics,
+                                                      *right_input_table_statistics, primary_predicate_statistics);
+          }
 
           // TODO(anybody) Implement estimation for non-equi joins. #1830
           case PredicateCondition::NotEquals:
@@ -1205,6 +1278,121 @@ std::pair<HistogramCountType, HistogramCountType> CardinalityEstimator::estimate
   return {match_count, HistogramCountType{right_distinct_count}};
 }
 
+std::optional<Selectivity> CardinalityEstimator::estimate_correlated_equals_selectivity(
+    const PredicateNode& predicate_node) {
+  const auto column = equals_value_predicate_column(predicate_node);
+  if (!column) {
+    return std::nullopt;
+  }
+
+  const auto& input_node = predicate_node.left_input();
+  auto filtered_columns = equals_value_predicate_columns(input_node);
+  std::erase_if(filtered_columns, [&](const auto& filtered_column) { return *filtered_column == *column; });
+  if (filtered_columns.empty()) {
+    return std::nullopt;
+  }
+
+  const auto filtered_column_set = ExpressionUnorderedSet{filtered_columns.cbegin(), filtered_columns.cend()};
+  for (const auto& fd : input_node->functional_dependencies()) {
+    if (fd.dependents.contains(column) &&
+        std::all_of(fd.determinants.cbegin(), fd.determinants.cend(),
+                    [&](const auto& determinant) { return filtered_column_set.contains(determinant); })) {
+      return Selectivity{1};
+    }
+  }
+
+  // Column group statistics only cover columns of the same table.
+  const auto original_node = column->original_node.lock();
+  std::erase_if(filtered_columns, [&](const auto& filtered_column) {
+    return filtered_column->original_node.lock() != original_node;
+  });
+  if (filtered_columns.empty()) {
+    return std::nullopt;
+  }
+
+  // Statistics might exist for the group of all filtered columns or for groups with single filtered columns. The
+  // strongest correlation determines the selectivity, as the independent estimation tends to underestimate.
+  auto condition_column_groups = std::vector<std::vector<std::shared_ptr<LQPColumnExpression>>>{filtered_columns};
+  if (filtered_columns.size() > 1) {
+    for (const auto& filtered_column : filtered_columns) {
+      condition_column_groups.push_back({filtered_column});
+    }
+  }
+
+  auto selectivity = std::optional<Selectivity>{};
+  for (auto& condition_columns : condition_column_groups) {
+    const auto condition_distinct_count = original_distinct_count(condition_columns);
+    condition_columns.emplace_back(column);
+    const auto group_distinct_count = original_distinct_count(condition_columns);
+    if (!condition_distinct_count || !group_distinct_count || *group_distinct_count <= 0.0f) {
+      continue;
+    }
+
+    const auto conditional_selectivity = std::min(*condition_distinct_count / *group_distinct_count, Selectivity{1});
+    selectivity = std::max(selectivity.value_or(Selectivity{0}), conditional_selectivity);
+  }
+
+  return selectivity;
+}
+
+std::shared_ptr<TableStatistics> CardinalityEstimator::estimate_multi_predicate_equi_join(
+    const JoinNode& join_node, const TableStatistics& left_input_table_statistics,
+    const TableStatistics& right_input_table_statistics,
+    const std::shared_ptr<TableStatistics>& primary_predicate_statistics) {
+  // Outer joins keep the unmatched rows of their preserved inputs. Lowering the estimation of the matches might thus
+  // estimate fewer rows than these inputs have.
+  const auto& join_predicates = join_node.join_predicates();
+  if (join_node.join_mode != JoinMode::Inner || join_predicates.size() < 2 ||
+      primary_predicate_statistics->row_count <= 0) {
+    return primary_predicate_statistics;
+  }
+
+  auto left_columns = std::vector<std::shared_ptr<LQPColumnExpression>>{};
+  auto right_columns = std::vector<std::shared_ptr<LQPColumnExpression>>{};
+  const auto& left_output_expressions = join_node.left_input()->output_expressions();
+  const auto& right_output_expressions = join_node.right_input()->output_expressions();
+  for (const auto& join_predicate : join_predicates) {
+    const auto operator_join_predicate =
+        OperatorJoinPredicate::from_expression(*join_predicate, *join_node.left_input(), *join_node.right_input());
+    if (!operator_join_predicate || operator_join_predicate->predicate_condition != PredicateCondition::Equals) {
+      return primary_predicate_statistics;
+    }
+
+    const auto left_column = std::dynamic_pointer_cast<LQPColumnExpression>(
+        left_output_expressions[operator_join_predicate->column_ids.first]);
+    const auto right_column = std::dynamic_pointer_cast<LQPColumnExpression>(
+        right_output_expressions[operator_join_predicate->column_ids.second]);
+    if (!left_column || !right_column) {
+      return primary_predicate_statistics;
+    }
+
+    left_columns.emplace_back(left_column);
+    right_columns.emplace_back(right_column);
+  }
+
+  const auto left_distinct_count = original_distinct_count(left_columns);
+  const auto right_distinct_count = original_distinct_count(right_columns);
+  if (!left_distinct_count || !right_distinct_count) {
+    return primary_predicate_statistics;
+  }
+
+  // The inputs might be filtered, so that they contain fewer distinct value combinations than the stored tables.
+  const auto distinct_count =
+      std::max(std::min(*left_distinct_count, left_input_table_statistics.row_count),
+               std::min(*right_distinct_count, right_input_table_statistics.row_count));
+  if (distinct_count <= 0.0f) {
+    return primary_predicate_statistics;
+  }
+
+  const auto cardinality =
+      Cardinality{left_input_table_statistics.row_count * right_input_table_statistics.row_count / distinct_count};
+  if (cardinality >= primary_predicate_statistics->row_count) {
+    return primary_predicate_statistics;
+  }
+
+  return scaled_table_statistics(*primary_predicate_statistics, cardinality / primary_predicate_statistics->row_count);
+}
+
 std::shared_ptr<TableStatistics> CardinalityEstimator::prune_column_statistics(
     const std::shared_ptr<TableStatistics>& table_statistics, const std::vector<ColumnID>& pruned_column_ids) {
   if (pruned_column_ids.empty()) {
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 
 #include <boost/dynamic_bitset.hpp>
 
@@ -226,6 +227,34 @@ class CardinalityEstimator : public AbstractCardinalityEstimator {
 
   /** @} */
 
+  /**
+   * Estimations of correlated predicates
+   * @{
+   */
+
+  /**
+   * Estimates the selectivity of the `column = value` predicate of @param predicate_node if `column = value`
+   * predicates directly below it already filtered correlated columns. If these columns functionally determine the
+   * column, the predicate does not filter any further rows (assuming that the compared values are consistent).
+   * Otherwise, the conditional selectivity is derived from ColumnGroupStatistics of the underlying table, e.g.,
+   * distinct(zip) / distinct(zip, city) for `city = 'Potsdam'` after `zip = '14482'`.
+   * @return std::nullopt if neither is known, i.e., if the predicates have to be assumed to be independent.
+   */
+  static std::optional<Selectivity> estimate_correlated_equals_selectivity(const PredicateNode& predicate_node);
+
+  /**
+   * Joins with several equality predicates are estimated based on their primary predicate only (see #1560). If
+   * ColumnGroupStatistics exist for the join columns of both inputs, the estimation of the primary predicate
+   * (@param primary_predicate_statistics) is refined to |left| * |right| / max(distinct(left columns),
+   * distinct(right columns)). Outer joins are estimated based on their primary predicate only.
+   */
+  static std::shared_ptr<TableStatistics> estimate_multi_predicate_equi_join(
+      const JoinNode& join_node, const TableStatistics& left_input_table_statistics,
+      const TableStatistics& right_input_table_statistics,
+      const std::shared_ptr<TableStatistics>& primary_predicate_statistics);
+
+  /** @} */
+
   /**
    * Helper
    * @{
@@ -0,0 +1,217 @@
+#include "column_group_statistics.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <boost/container_hash/hash.hpp>
+
+#include "expression/binary_predicate_expression.hpp"
+#include "expression/lqp_column_expression.hpp"
+#include "logical_query_plan/abstract_lqp_node.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "operators/abstract_operator.hpp"
+#include "operators/pqp_utils.hpp"
+#include "resolve_type.hpp"
+#include "statistics/cardinality_estimator.hpp"
+#include "statistics/sketches/hyper_log_log.hpp"
+#include "statistics/table_statistics.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace hyrise;  // NOLINT
+
+// The relative standard error of the distinct count estimation is about 0.8%.
+constexpr auto DISTINCT_COUNT_PRECISION = uint8_t{14};
+
+// Hash that NULL values contribute to a row's hash.
+constexpr auto NULL_VALUE_HASH = size_t{0x9E3779B97F4A7C15};
+
+bool is_value_operand(const AbstractExpression& expression) {
+  return expression.type == ExpressionType::Value || expression.type == ExpressionType::Placeholder;
+}
+
+}  // namespace
+
+namespace hyrise {
+
+std::shared_ptr<ColumnGroupStatistics> ColumnGroupStatistics::from_table(const Table& table,
+                                                                         std::vector<ColumnID> column_ids) {
+  std::sort(column_ids.begin(), column_ids.end());
+  column_ids.erase(std::unique(column_ids.begin(), column_ids.end()), column_ids.end());
+  Assert(column_ids.size() > 1, "Column group statistics require at least two columns.");
+  Assert(column_ids.back() < table.column_count(), "ColumnID out of bounds.");
+
+  // Combine the hashes of each row's values and add them to a HyperLogLog sketch. Chunks are processed one at a time,
+  // so that only the hashes of a single chunk are kept in memory.
+  auto hyper_log_log = HyperLogLog{DISTINCT_COUNT_PRECISION};
+  auto row_hashes = std::vector<size_t>{};
+  const auto chunk_count = table.chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = table.get_chunk(chunk_id);
+    if (!chunk) {
+      continue;
+    }
+
+    // Concurrent Inserts grow the segments of mutable chunks one after another, and Chunk::size() returns the size of
+    // the first segment. Thus, rows beyond the size read here might not be present in all segments yet and are skipped.
+    const auto chunk_size = chunk->size();
+    row_hashes.assign(chunk_size, size_t{0});
+    for (const auto column_id : column_ids) {
+      resolve_data_type(table.column_data_type(column_id), [&](const auto data_type_t) {
+        using ColumnDataType = typename decltype(data_type_t)::type;
+
+        segment_iterate<ColumnDataType>(*chunk->get_segment(column_id), [&](const auto& position) {
+          if (position.chunk_offset() >= chunk_size) {
+            return;
+          }
+          const auto value_hash = position.is_null() ? NULL_VALUE_HASH : std::hash<ColumnDataType>{}(position.value());
+          boost::hash_combine(row_hashes[position.chunk_offset()], value_hash);
+        });
+      });
+    }
+
+    for (const auto row_hash : row_hashes) {
+      hyper_log_log.add_hash(row_hash);
+    }
+  }
+
+  // The estimation cannot exceed the row count.
+  const auto distinct_count = std::min(static_cast<Cardinality>(hyper_log_log.estimate()),
+                                       static_cast<Cardinality>(table.row_count()));
+  return std::make_shared<ColumnGroupStatistics>(std::move(column_ids), distinct_count);
+}
+
+ColumnGroupStatistics::ColumnGroupStatistics(std::vector<ColumnID>&& init_column_ids,
+                                             const Cardinality init_distinct_count)
+    : column_ids(std::move(init_column_ids)), distinct_count(init_distinct_count) {
+  Assert(std::adjacent_find(column_ids.cbegin(), column_ids.cend(), std::greater_equal<>{}) == column_ids.cend(),
+         "Expected sorted and unique ColumnIDs.");
+}
+
+void add_column_group_statistics(Table& table, const std::vector<ColumnID>& column_ids) {
+  const auto table_statistics = table.table_statistics();
+  Assert(table_statistics, "Column group statistics can only be added to tables with statistics.");
+
+  const auto column_group_statistics = ColumnGroupStatistics::from_table(table, column_ids);
+
+  auto extended_table_statistics = std::make_shared<TableStatistics>(*table_statistics);
+  std::erase_if(extended_table_statistics->column_group_statistics, [&](const auto& existing_statistics) {
+    return existing_statistics->column_ids == column_group_statistics->column_ids;
+  });
+  extended_table_statistics->column_group_statistics.emplace_back(column_group_statistics);
+  table.set_table_statistics(extended_table_statistics);
+}
+
+std::vector<ColumnGroupStatisticsSuggestion> suggest_column_group_statistics(
+    const std::shared_ptr<const AbstractOperator>& pqp, const float misestimation_factor) {
+  auto suggestions = std::vector<ColumnGroupStatisticsSuggestion>{};
+  const auto cardinality_estimator = CardinalityEstimator{};
+
+  visit_pqp(pqp, [&](const auto& op) {
+    if (op->type() != OperatorType::TableScan || !op->lqp_node || op->lqp_node->type != LQPNodeType::Predicate ||
+        !op->left_input()) {
+      return PQPVisitation::VisitInputs;
+    }
+
+    const auto& predicate_node = static_cast<const PredicateNode&>(*op->lqp_node);
+    const auto column = equals_value_predicate_column(predicate_node);
+    if (!column) {
+      return PQPVisitation::VisitInputs;
+    }
+
+    const auto original_node = column->original_node.lock();
+    if (!original_node || original_node->type != LQPNodeType::StoredTable) {
+      return PQPVisitation::VisitInputs;
+    }
+
+    auto column_ids = std::vector<ColumnID>{column->original_column_id};
+    for (const auto& filtered_column : equals_value_predicate_columns(predicate_node.left_input())) {
+      if (filtered_column->original_node.lock() == original_node) {
+        column_ids.emplace_back(filtered_column->original_column_id);
+      }
+    }
+    std::sort(column_ids.begin(), column_ids.end());
+    column_ids.erase(std::unique(column_ids.begin(), column_ids.end()), column_ids.end());
+    if (column_ids.size() < 2 || column_ids.back() == INVALID_COLUMN_ID) {
+      return PQPVisitation::VisitInputs;
+    }
+
+    const auto& performance_data = *op->performance_data;
+    const auto& input_performance_data = *op->left_input()->performance_data;
+    if (!performance_data.has_output || !input_performance_data.has_output ||
+        input_performance_data.output_row_count == 0) {
+      return PQPVisitation::VisitInputs;
+    }
+
+    const auto estimated_input_row_count = cardinality_estimator.estimate_cardinality(predicate_node.left_input());
+    if (estimated_input_row_count <= 0.0f) {
+      return PQPVisitation::VisitInputs;
+    }
+
+    const auto estimated_selectivity =
+        Selectivity{cardinality_estimator.estimate_cardinality(op->lqp_node) / estimated_input_row_count};
+    const auto actual_selectivity = Selectivity{static_cast<float>(performance_data.output_row_count) /
+                                                static_cast<float>(input_performance_data.output_row_count)};
+    if (actual_selectivity <= estimated_selectivity * misestimation_factor) {
+      return PQPVisitation::VisitInputs;
+    }
+
+    const auto& table_name = static_cast<const StoredTableNode&>(*original_node).table_name;
+    const auto is_suggested = std::any_of(suggestions.cbegin(), suggestions.cend(), [&](const auto& suggestion) {
+      return suggestion.table_name == table_name && suggestion.column_ids == column_ids;
+    });
+    if (!is_suggested) {
+      suggestions.emplace_back(ColumnGroupStatisticsSuggestion{table_name, std::move(column_ids),
+                                                               estimated_selectivity, actual_selectivity});
+    }
+
+    return PQPVisitation::VisitInputs;
+  });
+
+  return suggestions;
+}
+
+std::shared_ptr<LQPColumnExpression> equals_value_predicate_column(const PredicateNode& predicate_node) {
+  const auto binary_predicate = std::dynamic_pointer_cast<BinaryPredicateExpression>(predicate_node.predicate());
+  if (!binary_predicate || binary_predicate->predicate_condition != PredicateCondition::Equals) {
+    return nullptr;
+  }
+
+  const auto& left_operand = binary_predicate->left_operand();
+  const auto& right_operand = binary_predicate->right_operand();
+  if (left_operand->type == ExpressionType::LQPColumn && is_value_operand(*right_operand)) {
+    return std::static_pointer_cast<LQPColumnExpression>(left_operand);
+  }
+
+  if (right_operand->type == ExpressionType::LQPColumn && is_value_operand(*left_operand)) {
+    return std::static_pointer_cast<LQPColumnExpression>(right_operand);
+  }
+
+  return nullptr;
+}
+
+std::vector<std::shared_ptr<LQPColumnExpression>> equals_value_predicate_columns(
+    const std::shared_ptr<AbstractLQPNode>& node) {
+  auto columns = std::vector<std::shared_ptr<LQPColumnExpression>>{};
+  auto current_node = node;
+  while (current_node &&
+         (current_node->type == LQPNodeType::Predicate || current_node->type == LQPNodeType::Validate)) {
+    if (current_node->type == LQPNodeType::Predicate) {
+      if (auto column = equals_value_predicate_column(static_cast<const PredicateNode&>(*current_node))) {
+        columns.emplace_back(std::move(column));
+      }
+    }
+    current_node = current_node->left_input();
+  }
+
+  return columns;
+}
+
+}  // namespace hyrise
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "types.hpp"
+
+namespace hyrise {
+
+class AbstractLQPNode;
+class AbstractOperator;
+class LQPColumnExpression;
+class PredicateNode;
+class Table;
+
+/**
+ * Number of distinct value combinations of a group of columns, e.g., (zip, city). Without it, the CardinalityEstimator
+ * assumes that predicates on different columns are independent and multiplies their selectivities. For correlated
+ * columns, this underestimates the result: `zip = '14482' AND city = 'Potsdam'` is estimated to select
+ * rows / (distinct(zip) * distinct(city)) instead of rows / distinct(zip, city) rows.
+ *
+ * The distinct count is estimated with a HyperLogLog sketch of the rows' hashes, so that creating the statistics takes
+ * a single pass over the columns with a fixed amount of memory. Column group statistics are not created by default.
+ * They are added on demand with add_column_group_statistics(), e.g., for the column groups returned by
+ * suggest_column_group_statistics().
+ */
+class ColumnGroupStatistics {
+ public:
+  static std::shared_ptr<ColumnGroupStatistics> from_table(const Table& table, std::vector<ColumnID> column_ids);
+
+  ColumnGroupStatistics(std::vector<ColumnID>&& init_column_ids, const Cardinality init_distinct_count);
+
+  // Sorted and free of duplicates.
+  const std::vector<ColumnID> column_ids;
+  const Cardinality distinct_count;
+};
+
+/**
+ * Creates ColumnGroupStatistics for the columns @param column_ids of @param table and adds them to the table's
+ * statistics, replacing existing statistics of the same column group. As the statistics are read by concurrent
+ * optimizations, they are not modified but replaced by an extended copy.
+ */
+void add_column_group_statistics(Table& table, const std::vector<ColumnID>& column_ids);
+
+struct ColumnGroupStatisticsSuggestion {
+  std::string table_name;
+  std::vector<ColumnID> column_ids;
+  Selectivity estimated_selectivity;
+  Selectivity actual_selectivity;
+};
+
+/**
+ * Returns the column groups whose statistics are likely to improve the estimations for the executed @param pqp. A
+ * column group is suggested for a TableScan of a `column = value` predicate if other columns of the same stored table
+ * were filtered with `column = value` predicates directly before (i.e., the predicates might be correlated) and the
+ * actual selectivity of the scan exceeds the estimated one by more than @param misestimation_factor.
+ */
+std::vector<ColumnGroupStatisticsSuggestion> suggest_column_group_statistics(
+    const std::shared_ptr<const AbstractOperator>& pqp, const float misestimation_factor = 10.0f);
+
+/**
+ * @return the column of a `column = value` predicate (or `column = ?` for prepared statements), nullptr for all other
+ *         predicates.
+ */
+std::shared_ptr<LQPColumnExpression> equals_value_predicate_column(const PredicateNode& predicate_node);
+
+/**
+ * @return the columns of all `column = value` predicates in the chain of PredicateNodes starting with @param node.
+ *         ValidateNodes in the chain are skipped.
+ */
+std::vector<std::shared_ptr<LQPColumnExpression>> equals_value_predicate_columns(
+    const std::shared_ptr<AbstractLQPNode>& node);
+
+}  // namespace hyrise
@@ -45,7 +45,9 @@ std::optional<JoinGraphStatisticsCache::Bitmask> JoinGraphStatisticsCache::bitma
     }
 
     if (const auto join_node = std::dynamic_pointer_cast<const JoinNode>(node)) {
-      if (join_node->join_mode == JoinMode::Inner) {
+      // The right vertex of a semi or anti join is joined using the predicates of its JoinGraphEdge only (see
+      // JoinGraphBuilder). Thus, these predicates identify the join just like the predicates of an inner join.
+      if (join_node->join_mode == JoinMode::Inner || is_semi_or_anti_join(join_node->join_mode)) {
         for (const auto& join_predicate : join_node->join_predicates()) {
           const auto predicate_index_iter = _predicate_indices.find(join_predicate);
           if (predicate_index_iter == _predicate_indices.end()) {
@@ -60,7 +62,7 @@ std::optional<JoinGraphStatisticsCache::Bitmask> JoinGraphStatisticsCache::bitma
       } else if (join_node->join_mode == JoinMode::Cross) {
         return LQPVisitation::VisitInputs;
       } else {
-        // Non-Inner/Cross join detected, cannot construct a bitmask from those
+        // Outer join detected, cannot construct a bitmask from those
         bitmask.reset();
         return LQPVisitation::DoNotVisitInputs;
       }
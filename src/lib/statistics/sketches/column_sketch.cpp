@@ -0,0 +1,147 @@
+#include "column_sketch.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "statistics/attribute_statistics.hpp"
+#include "statistics/statistics_objects/generic_histogram.hpp"
+#include "statistics/statistics_objects/histogram_domain.hpp"
+#include "statistics/statistics_objects/null_value_ratio_statistics.hpp"
+#include "storage/segment_iterate.hpp"
+#include "utils/assert.hpp"
+
+namespace hyrise {
+
+template <typename T>
+ColumnSketch<T>::ColumnSketch(const uint32_t quantile_sketch_size, const uint8_t distinct_count_precision,
+                              const uint32_t init_sampling_interval)
+    : sampling_interval(init_sampling_interval),
+      distinct_values(distinct_count_precision),
+      quantiles(quantile_sketch_size) {
+  Assert(sampling_interval > 0, "Sampling interval must be greater than zero.");
+}
+
+template <typename T>
+void ColumnSketch<T>::add_segment(const AbstractSegment& segment) {
+  // As for the EqualDistinctCountHistogram, strings are mapped to the histogram's domain.
+  const auto domain = HistogramDomain<T>{};
+
+  segment_iterate<T>(segment, [&](const auto& position) {
+    if (position.is_null()) {
+      ++null_count;
+      return;
+    }
+
+    ++non_null_count;
+    distinct_values.add(position.value());
+
+    if (_values_until_next_sample > 0) {
+      --_values_until_next_sample;
+      return;
+    }
+    _values_until_next_sample = sampling_interval - 1;
+
+    if constexpr (std::is_same_v<T, pmr_string>) {
+      if (!domain.contains(position.value())) {
+        quantiles.update(domain.string_to_domain(position.value()));
+        return;
+      }
+    }
+    quantiles.update(position.value());
+  });
+}
+
+template <typename T>
+void ColumnSketch<T>::merge(const BaseColumnSketch& other) {
+  const auto& other_sketch = static_cast<const ColumnSketch<T>&>(other);
+  Assert(sampling_interval == other_sketch.sampling_interval,
+         "Cannot merge column sketches with different sampling intervals.");
+
+  distinct_values.merge(other_sketch.distinct_values);
+  quantiles.merge(other_sketch.quantiles);
+  non_null_count += other_sketch.non_null_count;
+  null_count += other_sketch.null_count;
+}
+
+template <typename T>
+std::shared_ptr<BaseColumnSketch> ColumnSketch<T>::clone() const {
+  return std::make_shared<ColumnSketch<T>>(*this);
+}
+
+template <typename T>
+std::shared_ptr<BaseAttributeStatistics> ColumnSketch<T>::attribute_statistics(const BinID max_bin_count) const {
+  Assert(max_bin_count > 0, "max_bin_count must be greater than zero.");
+
+  const auto attribute_statistics = std::make_shared<AttributeStatistics<T>>();
+  const auto row_count = non_null_count + null_count;
+  const auto null_value_ratio =
+      row_count == 0 ? 0.0f : static_cast<float>(null_count) / static_cast<float>(row_count);
+  attribute_statistics->set_statistics_object(std::make_shared<NullValueRatioStatistics>(null_value_ratio));
+
+  const auto weighted_values = quantiles.weighted_values();
+  if (weighted_values.empty()) {
+    return attribute_statistics;
+  }
+
+  // The KLL sketch covers only the sampled values. The heights and distinct counts of the bins are scaled to the
+  // non-NULL values and the distinct count estimated by the HyperLogLog sketch, respectively. A column has at least as
+  // many distinct values as the sample.
+  const auto sampled_count = static_cast<double>(quantiles.count());
+  const auto height_scale = static_cast<double>(non_null_count) / sampled_count;
+  const auto sampled_distinct_count = static_cast<double>(weighted_values.size());
+  const auto distinct_count = std::clamp(distinct_values.estimate(), sampled_distinct_count,
+                                         std::max(sampled_distinct_count, static_cast<double>(non_null_count)));
+  const auto distinct_scale = distinct_count / sampled_distinct_count;
+
+  // Bins have about the same height. They end at distinct values, as the bins of a histogram must not overlap.
+  const auto bin_count = std::min(max_bin_count, weighted_values.size());
+  const auto target_bin_weight = sampled_count / static_cast<double>(bin_count);
+
+  auto bin_minima = std::vector<T>{};
+  auto bin_maxima = std::vector<T>{};
+  auto bin_heights = std::vector<HistogramCountType>{};
+  auto bin_distinct_counts = std::vector<HistogramCountType>{};
+  bin_minima.reserve(bin_count);
+  bin_maxima.reserve(bin_count);
+  bin_heights.reserve(bin_count);
+  bin_distinct_counts.reserve(bin_count);
+
+  auto cumulative_weight = 0.0;
+  auto bin_begin_idx = size_t{0};
+  auto bin_weight = uint64_t{0};
+  for (auto value_idx = size_t{0}; value_idx < weighted_values.size(); ++value_idx) {
+    bin_weight += weighted_values[value_idx].second;
+    cumulative_weight += static_cast<double>(weighted_values[value_idx].second);
+
+    const auto remaining_value_count = weighted_values.size() - value_idx - 1;
+    const auto remaining_bin_count = bin_count - bin_minima.size() - 1;
+    const auto is_last_value = value_idx + 1 == weighted_values.size();
+    const auto bin_is_full =
+        cumulative_weight >= target_bin_weight * static_cast<double>(bin_minima.size() + 1) && remaining_bin_count > 0;
+    if (!is_last_value && !bin_is_full && remaining_value_count > remaining_bin_count) {
+      continue;
+    }
+
+    const auto height = static_cast<double>(bin_weight) * height_scale;
+    const auto bin_sampled_distinct_count = static_cast<double>(value_idx - bin_begin_idx + 1);
+    bin_minima.emplace_back(weighted_values[bin_begin_idx].first);
+    bin_maxima.emplace_back(weighted_values[value_idx].first);
+    bin_heights.emplace_back(static_cast<HistogramCountType>(height));
+    bin_distinct_counts.emplace_back(
+        static_cast<HistogramCountType>(std::clamp(bin_sampled_distinct_count * distinct_scale, 1.0, height)));
+
+    bin_begin_idx = value_idx + 1;
+    bin_weight = 0;
+  }
+
+  attribute_statistics->set_statistics_object(std::make_shared<GenericHistogram<T>>(
+      std::move(bin_minima), std::move(bin_maxima), std::move(bin_heights), std::move(bin_distinct_counts)));
+
+  return attribute_statistics;
+}
+
+EXPLICITLY_INSTANTIATE_DATA_TYPES(ColumnSketch);
+
+}  // namespace hyrise
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+
+#include "all_type_variant.hpp"
+#include "hyper_log_log.hpp"
+#include "kll_sketch.hpp"
+#include "statistics/statistics_objects/abstract_histogram.hpp"
+
+namespace hyrise {
+
+class AbstractSegment;
+class BaseAttributeStatistics;
+
+/**
+ * Summary of the values of a column (or of some of its chunks) from which AttributeStatistics can be derived without
+ * another pass over the data. Sketches of different chunks can be built in parallel and merged afterwards. Compared to
+ * the exact EqualDistinctCountHistograms, the histograms derived from a sketch have approximate bin boundaries and
+ * distinct counts.
+ */
+class BaseColumnSketch {
+ public:
+  virtual ~BaseColumnSketch() = default;
+
+  virtual void add_segment(const AbstractSegment& segment) = 0;
+
+  virtual void merge(const BaseColumnSketch& other) = 0;
+
+  virtual std::shared_ptr<BaseColumnSketch> clone() const = 0;
+
+  /**
+   * Creates a GenericHistogram with up to @param max_bin_count bins of about equal height and the NullValueRatio.
+   */
+  virtual std::shared_ptr<BaseAttributeStatistics> attribute_statistics(const BinID max_bin_count) const = 0;
+};
+
+/**
+ * The distinct count is estimated with a HyperLogLog sketch that sees all non-NULL values, while the value distribution
+ * is estimated with a KLL sketch. To reduce the creation time further, only every @param sampling_interval-th value is
+ * added to the KLL sketch.
+ */
+template <typename T>
+class ColumnSketch : public BaseColumnSketch {
+ public:
+  ColumnSketch(const uint32_t quantile_sketch_size, const uint8_t distinct_count_precision,
+               const uint32_t init_sampling_interval);
+
+  void add_segment(const AbstractSegment& segment) override;
+
+  void merge(const BaseColumnSketch& other) override;
+
+  std::shared_ptr<BaseColumnSketch> clone() const override;
+
+  std::shared_ptr<BaseAttributeStatistics> attribute_statistics(const BinID max_bin_count) const override;
+
+  const uint32_t sampling_interval;
+
+  HyperLogLog distinct_values;
+  KllSketch<T> quantiles;
+  uint64_t non_null_count{0};
+  uint64_t null_count{0};
+
+ private:
+  // Number of non-NULL values to skip before the next value is added to the KLL sketch.
+  uint32_t _values_until_next_sample{0};
+};
+
+EXPLICITLY_DECLARE_DATA_TYPES(ColumnSketch);
+
+}  // namespace hyrise
@@ -0,0 +1,67 @@
+#include "hyper_log_log.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+
+#include "utils/assert.hpp"
+
+namespace {
+
+// Finalizer of SplitMix64, which spreads the bits of the input hash over the entire 64 bits.
+uint64_t mix_hash(uint64_t hash) {
+  hash = (hash ^ (hash >> 30u)) * uint64_t{0xbf58476d1ce4e5b9};
+  hash = (hash ^ (hash >> 27u)) * uint64_t{0x94d049bb133111eb};
+  return hash ^ (hash >> 31u);
+}
+
+}  // namespace
+
+namespace hyrise {
+
+HyperLogLog::HyperLogLog(const uint8_t init_precision)
+    : precision(init_precision), _registers(size_t{1} << init_precision, uint8_t{0}) {
+  Assert(precision >= MIN_PRECISION && precision <= MAX_PRECISION, "Unsupported HyperLogLog precision.");
+}
+
+void HyperLogLog::add_hash(const uint64_t hash) {
+  const auto mixed_hash = mix_hash(hash);
+
+  // The first `precision` bits select the register, the position of the first one bit of the remaining bits is the
+  // observed rank. If all remaining bits are zero, the rank is 64 - precision + 1.
+  const auto register_idx = mixed_hash >> (64u - precision);
+  const auto remaining_bits = (mixed_hash << precision) | (uint64_t{1} << (precision - 1u));
+  const auto rank = static_cast<uint8_t>(std::countl_zero(remaining_bits) + 1);
+
+  _registers[register_idx] = std::max(_registers[register_idx], rank);
+}
+
+void HyperLogLog::merge(const HyperLogLog& other) {
+  Assert(precision == other.precision, "Cannot merge HyperLogLog sketches with different precisions.");
+  std::transform(_registers.cbegin(), _registers.cend(), other._registers.cbegin(), _registers.begin(),
+                 [](const auto lhs, const auto rhs) { return std::max(lhs, rhs); });
+}
+
+double HyperLogLog::estimate() const {
+  const auto register_count = static_cast<double>(_registers.size());
+
+  auto inverse_sum = 0.0;
+  auto zero_register_count = size_t{0};
+  for (const auto rank : _registers) {
+    inverse_sum += std::ldexp(1.0, -static_cast<int>(rank));
+    zero_register_count += rank == 0 ? 1 : 0;
+  }
+
+  const auto alpha = 0.7213 / (1.0 + 1.079 / register_count);
+  const auto raw_estimate = alpha * register_count * register_count / inverse_sum;
+
+  // For small cardinalities, many registers are still empty and linear counting is more accurate.
+  if (raw_estimate <= 2.5 * register_count && zero_register_count > 0) {
+    return register_count * std::log(register_count / static_cast<double>(zero_register_count));
+  }
+
+  return raw_estimate;
+}
+
+}  // namespace hyrise
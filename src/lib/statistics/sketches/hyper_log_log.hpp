@@ -0,0 +1,42 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace hyrise {
+
+/**
+ * HyperLogLog sketch that estimates the number of distinct values with a fixed amount of memory (2^precision bytes).
+ * The relative standard error of the estimation is about 1.04 / sqrt(2^precision), i.e., 1.6% for the default
+ * precision of 12. Sketches with the same precision can be merged, e.g., to combine the sketches of different chunks.
+ *
+ * See Flajolet et al., "HyperLogLog: the analysis of a near-optimal cardinality estimation algorithm" (2007), and
+ * Heule et al., "HyperLogLog in Practice" (2013) for the small range correction.
+ */
+class HyperLogLog {
+ public:
+  static constexpr auto MIN_PRECISION = uint8_t{4};
+  static constexpr auto MAX_PRECISION = uint8_t{18};
+
+  explicit HyperLogLog(const uint8_t init_precision = 12);
+
+  template <typename T>
+  void add(const T& value) {
+    add_hash(std::hash<T>{}(value));
+  }
+
+  // The hash is mixed again, as std::hash is the identity function for integers in some standard libraries.
+  void add_hash(const uint64_t hash);
+
+  void merge(const HyperLogLog& other);
+
+  double estimate() const;
+
+  const uint8_t precision;
+
+ private:
+  std::vector<uint8_t> _registers;
+};
+
+}  // namespace hyrise
@@ -0,0 +1,140 @@
+#include "kll_sketch.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <iterator>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "utils/assert.hpp"
+
+namespace hyrise {
+
+template <typename T>
+KllSketch<T>::KllSketch(const uint32_t init_k) : k(init_k), _levels(1) {
+  Assert(k >= MIN_K, "KLL sketches require k >= " + std::to_string(MIN_K) + ".");
+  _update_total_capacity();
+}
+
+template <typename T>
+void KllSketch<T>::update(const T& value) {
+  _levels.front().emplace_back(value);
+  ++_retained_count;
+  ++_count;
+  if (_retained_count > _total_capacity) {
+    _compress();
+  }
+}
+
+template <typename T>
+void KllSketch<T>::merge(const KllSketch<T>& other) {
+  Assert(k == other.k, "Cannot merge KLL sketches with different k.");
+
+  if (_levels.size() < other._levels.size()) {
+    _levels.resize(other._levels.size());
+    _update_total_capacity();
+  }
+
+  for (auto level = size_t{0}; level < other._levels.size(); ++level) {
+    _levels[level].insert(_levels[level].end(), other._levels[level].cbegin(), other._levels[level].cend());
+  }
+
+  _retained_count += other._retained_count;
+  _count += other._count;
+  _compress();
+}
+
+template <typename T>
+uint64_t KllSketch<T>::count() const {
+  return _count;
+}
+
+template <typename T>
+std::vector<std::pair<T, uint64_t>> KllSketch<T>::weighted_values() const {
+  auto weighted_values = std::vector<std::pair<T, uint64_t>>{};
+  weighted_values.reserve(_retained_count);
+  for (auto level = size_t{0}; level < _levels.size(); ++level) {
+    const auto weight = uint64_t{1} << level;
+    for (const auto& value : _levels[level]) {
+      weighted_values.emplace_back(value, weight);
+    }
+  }
+
+  std::sort(weighted_values.begin(), weighted_values.end(),
+            [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+
+  // Combine the weights of equal values.
+  auto output_iter = weighted_values.begin();
+  for (auto input_iter = weighted_values.begin(); input_iter != weighted_values.end(); ++input_iter) {
+    if (output_iter != weighted_values.begin() && std::prev(output_iter)->first == input_iter->first) {
+      std::prev(output_iter)->second += input_iter->second;
+      continue;
+    }
+    *output_iter = std::move(*input_iter);
+    ++output_iter;
+  }
+  weighted_values.erase(output_iter, weighted_values.end());
+
+  return weighted_values;
+}
+
+template <typename T>
+size_t KllSketch<T>::_level_capacity(const size_t level) const {
+  // The top level has a capacity of k, each level below it has 2/3 of the capacity of the level above.
+  const auto depth = static_cast<double>(_levels.size() - level - 1);
+  return std::max(size_t{MIN_K}, static_cast<size_t>(std::ceil(static_cast<double>(k) * std::pow(2.0 / 3.0, depth))));
+}
+
+template <typename T>
+void KllSketch<T>::_update_total_capacity() {
+  // Adding a level increases the capacity of all levels below it.
+  _total_capacity = 0;
+  for (auto level = size_t{0}; level < _levels.size(); ++level) {
+    _total_capacity += _level_capacity(level);
+  }
+}
+
+template <typename T>
+void KllSketch<T>::_compress() {
+  while (_retained_count > _total_capacity) {
+    // Compact the lowest level that exceeds its capacity. As the total capacity is exceeded, such a level exists.
+    auto level = size_t{0};
+    while (_levels[level].size() < _level_capacity(level)) {
+      ++level;
+    }
+
+    if (level + 1 == _levels.size()) {
+      _levels.emplace_back();
+      _update_total_capacity();
+    }
+
+    auto& values = _levels[level];
+    std::sort(values.begin(), values.end());
+
+    // With an odd number of values, one value (the largest) remains on this level.
+    auto remaining_value = std::optional<T>{};
+    if (values.size() % 2 == 1) {
+      remaining_value = std::move(values.back());
+      values.pop_back();
+    }
+
+    auto& next_level_values = _levels[level + 1];
+    const auto offset = static_cast<size_t>(_random_engine() % 2);
+    for (auto value_idx = offset; value_idx < values.size(); value_idx += 2) {
+      next_level_values.emplace_back(std::move(values[value_idx]));
+    }
+
+    _retained_count -= values.size() / 2;
+    values.clear();
+    if (remaining_value) {
+      values.emplace_back(std::move(*remaining_value));
+    }
+  }
+}
+
+EXPLICITLY_INSTANTIATE_DATA_TYPES(KllSketch);
+
+}  // namespace hyrise
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <cstdint>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "all_type_variant.hpp"
+
+namespace hyrise {
+
+/**
+ * KLL quantile sketch (Karnin, Lang, and Liberty, "Optimal Quantile Approximation in Streams", 2016). It retains a
+ * small, weighted sample of the added values: values are added to the lowest of a hierarchy of compactors. When a
+ * compactor is full, it is sorted and every other value (starting at a random offset) is promoted to the next
+ * compactor with twice the weight, while the others are discarded. The capacity of the compactors decreases
+ * geometrically from the top level downwards, so that the sketch retains O(k) values.
+ *
+ * The rank error is about 1.7 / k with high probability, i.e., about 1% for the default k of 200. Sketches with the
+ * same k can be merged, e.g., to combine the sketches of different chunks.
+ */
+template <typename T>
+class KllSketch {
+ public:
+  static constexpr auto MIN_K = uint32_t{8};
+
+  explicit KllSketch(const uint32_t init_k = 200);
+
+  void update(const T& value);
+
+  void merge(const KllSketch<T>& other);
+
+  // Number of values added to this sketch and all merged sketches.
+  uint64_t count() const;
+
+  // Retained values in ascending order with their weights. The weights add up to count(). Equal values are combined.
+  std::vector<std::pair<T, uint64_t>> weighted_values() const;
+
+  const uint32_t k;
+
+ private:
+  size_t _level_capacity(const size_t level) const;
+  void _update_total_capacity();
+  void _compress();
+
+  // Values in _levels[level] have a weight of 2^level.
+  std::vector<std::vector<T>> _levels;
+  size_t _retained_count{0};
+  size_t _total_capacity{0};
+  uint64_t _count{0};
+
+  // Sketches are deterministic for the same sequence of updates and merges.
+  std::minstd_rand _random_engine{};
+};
+
+EXPLICITLY_DECLARE_DATA_TYPES(KllSketch);
+
+}  // namespace hyrise
@@ -8,21 +8,143 @@
 #include "hyrise.hpp"
 #include "resolve_type.hpp"
 #include "scheduler/job_task.hpp"
+#include "statistics/column_group_statistics.hpp"
+#include "statistics/sketches/column_sketch.hpp"
 #include "statistics/statistics_objects/abstract_histogram.hpp"
 #include "storage/table.hpp"
 #include "utils/assert.hpp"
 
+namespace {
+
+using namespace hyrise;  // NOLINT
+
+// Each job sketches up to this many chunks of a column. The sketches of the jobs are merged afterwards.
+constexpr auto CHUNKS_PER_SKETCH_JOB = ChunkID::base_type{8};
+
+constexpr auto DISTINCT_COUNT_PRECISION = uint8_t{12};
+
+/**
+ * Determine bin count, within mostly arbitrarily chosen bounds: 5 (for tables with <=2k rows) up to 100 bins
+ * (for tables with >= 200m rows) are created.
+ */
+size_t max_histogram_bin_count(const Table& table) {
+  return std::min<size_t>(100, std::max<size_t>(5, table.row_count() / 2'000));
+}
+
+std::shared_ptr<BaseColumnSketch> make_column_sketch(const DataType data_type,
+                                                     const StatisticsGenerationConfig& config) {
+  auto column_sketch = std::shared_ptr<BaseColumnSketch>{};
+  resolve_data_type(data_type, [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+    column_sketch = std::make_shared<ColumnSketch<ColumnDataType>>(config.sketch_size, DISTINCT_COUNT_PRECISION,
+                                                                   config.sampling_interval);
+  });
+  return column_sketch;
+}
+
+// Returns a sketch per column that covers the chunks in [begin_chunk_id, end_chunk_id). Batches of chunks of all
+// columns are sketched in parallel.
+std::vector<std::shared_ptr<BaseColumnSketch>> sketch_chunks(const Table& table, const ChunkID begin_chunk_id,
+                                                             const ChunkID end_chunk_id,
+                                                             const StatisticsGenerationConfig& config) {
+  const auto column_count = table.column_count();
+  const auto batch_count = (end_chunk_id - begin_chunk_id + CHUNKS_PER_SKETCH_JOB - 1) / CHUNKS_PER_SKETCH_JOB;
+  auto batch_sketches = std::vector<std::vector<std::shared_ptr<BaseColumnSketch>>>(
+      column_count, std::vector<std::shared_ptr<BaseColumnSketch>>(batch_count));
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(column_count * batch_count);
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    for (auto batch_idx = ChunkID::base_type{0}; batch_idx < batch_count; ++batch_idx) {
+      jobs.emplace_back(std::make_shared<JobTask>([&, column_id, batch_idx]() {
+        const auto column_sketch = make_column_sketch(table.column_data_type(column_id), config);
+        const auto batch_begin_chunk_id = begin_chunk_id + batch_idx * CHUNKS_PER_SKETCH_JOB;
+        const auto batch_end_chunk_id = std::min(ChunkID{batch_begin_chunk_id + CHUNKS_PER_SKETCH_JOB}, end_chunk_id);
+        for (auto chunk_id = ChunkID{batch_begin_chunk_id}; chunk_id < batch_end_chunk_id; ++chunk_id) {
+          const auto chunk = table.get_chunk(chunk_id);
+          if (chunk) {
+            column_sketch->add_segment(*chunk->get_segment(column_id));
+          }
+        }
+        batch_sketches[column_id][batch_idx] = column_sketch;
+      }));
+    }
+  }
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+
+  auto column_sketches = std::vector<std::shared_ptr<BaseColumnSketch>>(column_count);
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    column_sketches[column_id] = make_column_sketch(table.column_data_type(column_id), config);
+    for (const auto& batch_sketch : batch_sketches[column_id]) {
+      column_sketches[column_id]->merge(*batch_sketch);
+    }
+  }
+
+  return column_sketches;
+}
+
+/**
+ * Creates statistics from the @param previous_column_sketches of the first @param previous_sketched_chunk_count chunks
+ * (if any) and sketches of the remaining chunks. The sketches of the chunks that are immutable are kept in the
+ * statistics so that they do not have to be sketched again when the statistics are updated.
+ */
+std::shared_ptr<TableStatistics> from_sketches(
+    const Table& table, const StatisticsGenerationConfig& config,
+    const std::vector<std::shared_ptr<const BaseColumnSketch>>& previous_column_sketches,
+    const ChunkID previous_sketched_chunk_count) {
+  const auto column_count = table.column_count();
+  const auto chunk_count = table.chunk_count();
+
+  auto immutable_chunk_count = previous_sketched_chunk_count;
+  while (immutable_chunk_count < chunk_count) {
+    const auto chunk = table.get_chunk(immutable_chunk_count);
+    if (chunk && chunk->is_mutable()) {
+      break;
+    }
+    ++immutable_chunk_count;
+  }
+
+  auto immutable_column_sketches = sketch_chunks(table, previous_sketched_chunk_count, immutable_chunk_count, config);
+  if (!previous_column_sketches.empty()) {
+    Assert(previous_column_sketches.size() == column_count, "Column count of the table changed.");
+    for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+      auto merged_column_sketch = previous_column_sketches[column_id]->clone();
+      merged_column_sketch->merge(*immutable_column_sketches[column_id]);
+      immutable_column_sketches[column_id] = merged_column_sketch;
+    }
+  }
+
+  const auto mutable_column_sketches = sketch_chunks(table, immutable_chunk_count, chunk_count, config);
+
+  const auto bin_count = max_histogram_bin_count(table);
+  auto column_statistics = std::vector<std::shared_ptr<BaseAttributeStatistics>>(column_count);
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    const auto column_sketch = immutable_column_sketches[column_id]->clone();
+    column_sketch->merge(*mutable_column_sketches[column_id]);
+    column_statistics[column_id] = column_sketch->attribute_statistics(bin_count);
+  }
+
+  const auto table_statistics = std::make_shared<TableStatistics>(std::move(column_statistics), table.row_count());
+  table_statistics->column_sketches.assign(immutable_column_sketches.begin(), immutable_column_sketches.end());
+  table_statistics->sketched_chunk_count = immutable_chunk_count;
+  table_statistics->generation_config = config;
+  return table_statistics;
+}
+
+}  // namespace
+
 namespace hyrise {
 
-std::shared_ptr<TableStatistics> TableStatistics::from_table(const Table& table) {
+std::shared_ptr<TableStatistics> TableStatistics::from_table(const Table& table,
+                                                             const StatisticsGenerationConfig& config) {
+  if (config.mode == StatisticsGenerationMode::Sketch) {
+    return from_sketches(table, config, {}, ChunkID{0});
+  }
+
   const auto column_count = table.column_count();
   auto column_statistics = std::vector<std::shared_ptr<BaseAttributeStatistics>>{column_count};
 
-  /**
-   * Determine bin count, within mostly arbitrarily chosen bounds: 5 (for tables with <=2k rows) up to 100 bins
-   * (for tables with >= 200m rows) are created.
-   */
-  const auto histogram_bin_count = std::min<size_t>(100, std::max<size_t>(5, table.row_count() / 2'000));
+  const auto histogram_bin_count = max_histogram_bin_count(table);
 
   /**
    * We highly recommend setting up a multithreaded scheduler before the following procedure is executed to parallelly
@@ -69,6 +191,17 @@ std::shared_ptr<TableStatistics> TableStatistics::from_table(const Table& table)
   return std::make_shared<TableStatistics>(std::move(column_statistics), table.row_count());
 }
 
+std::shared_ptr<TableStatistics> TableStatistics::update_from_table(const Table& table,
+                                                                    const TableStatistics& previous_statistics) {
+  const auto table_statistics =
+      previous_statistics.column_sketches.empty()
+          ? from_table(table, previous_statistics.generation_config)
+          : from_sketches(table, previous_statistics.generation_config, previous_statistics.column_sketches,
+                          previous_statistics.sketched_chunk_count);
+  table_statistics->column_group_statistics = previous_statistics.column_group_statistics;
+  return table_statistics;
+}
+
 TableStatistics::TableStatistics(std::vector<std::shared_ptr<BaseAttributeStatistics>>&& init_column_statistics,
                                  const Cardinality init_row_count)
     : column_statistics(std::move(init_column_statistics)), row_count(init_row_count) {}
@@ -78,6 +211,41 @@ DataType TableStatistics::column_data_type(const ColumnID column_id) const {
   return column_statistics[column_id]->data_type;
 }
 
+std::optional<Cardinality> TableStatistics::distinct_count(std::vector<ColumnID> column_ids) const {
+  std::sort(column_ids.begin(), column_ids.end());
+  column_ids.erase(std::unique(column_ids.begin(), column_ids.end()), column_ids.end());
+  if (column_ids.empty() || column_ids.back() >= column_statistics.size()) {
+    return std::nullopt;
+  }
+
+  if (column_ids.size() > 1) {
+    for (const auto& statistics : column_group_statistics) {
+      if (statistics->column_ids == column_ids) {
+        return statistics->distinct_count;
+      }
+    }
+    return std::nullopt;
+  }
+
+  auto distinct_count = std::optional<Cardinality>{};
+  resolve_data_type(column_data_type(column_ids.front()), [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+
+    const auto attribute_statistics =
+        std::dynamic_pointer_cast<const AttributeStatistics<ColumnDataType>>(column_statistics[column_ids.front()]);
+    if (!attribute_statistics) {
+      return;
+    }
+
+    if (attribute_statistics->histogram) {
+      distinct_count = attribute_statistics->histogram->total_distinct_count();
+    } else if (attribute_statistics->distinct_value_count) {
+      distinct_count = static_cast<Cardinality>(attribute_statistics->distinct_value_count->count);
+    }
+  });
+  return distinct_count;
+}
+
 std::ostream& operator<<(std::ostream& stream, const TableStatistics& table_statistics) {
   stream << "TableStatistics {" << std::endl;
   stream << "  RowCount: " << table_statistics.row_count << "; " << std::endl;
@@ -12,8 +12,28 @@
 namespace hyrise {
 
 class BaseAttributeStatistics;
+class BaseColumnSketch;
+class ColumnGroupStatistics;
 class Table;
 
+/**
+ * Exact statistics require a pass over all values that determines the distinct values and their frequencies, which
+ * takes minutes for tables with billions of rows. Statistics derived from sketches (see ColumnSketch) are approximate,
+ * but they are created in a single, parallel pass over the chunks with a bounded amount of memory.
+ */
+enum class StatisticsGenerationMode { Exact, Sketch };
+
+struct StatisticsGenerationConfig {
+  StatisticsGenerationMode mode{StatisticsGenerationMode::Exact};
+
+  // Parameter k of the KLL sketches that approximate the value distributions. Larger values increase the accuracy of
+  // the histograms (rank error of about 1.7 / k) and the creation time.
+  uint32_t sketch_size{200};
+
+  // Only every n-th value is added to the KLL sketches. Distinct counts are still estimated from all values.
+  uint32_t sampling_interval{1};
+};
+
 /**
  * Container for all cardinality estimation statistics gathered about a Table. Also used to represent the estimation of
  * a temporary Table during Optimization.
@@ -24,7 +44,17 @@ class TableStatistics {
    * Creates statistics objects for cardinality estimation for all Columns in @param table. See implementation for
    * which statistics objects are created.
    */
-  static std::shared_ptr<TableStatistics> from_table(const Table& table);
+  static std::shared_ptr<TableStatistics> from_table(const Table& table,
+                                                     const StatisticsGenerationConfig& config = {});
+
+  /**
+   * Creates statistics for @param table, which has grown since @param previous_statistics were created for it. If the
+   * previous statistics were created from sketches, only the chunks that were mutable back then and the new chunks
+   * are sketched. Otherwise, exact statistics are created from scratch. Column group statistics are kept from the
+   * previous statistics without being refreshed.
+   */
+  static std::shared_ptr<TableStatistics> update_from_table(const Table& table,
+                                                            const TableStatistics& previous_statistics);
 
   TableStatistics(std::vector<std::shared_ptr<BaseAttributeStatistics>>&& init_column_statistics,
                   const Cardinality init_row_count);
@@ -34,8 +64,23 @@ class TableStatistics {
    */
   DataType column_data_type(const ColumnID column_id) const;
 
+  /**
+   * @return the distinct count of a single column (taken from its histogram) or of a group of columns (taken from the
+   *         ColumnGroupStatistics), std::nullopt if it is unknown.
+   */
+  std::optional<Cardinality> distinct_count(std::vector<ColumnID> column_ids) const;
+
   const std::vector<std::shared_ptr<BaseAttributeStatistics>> column_statistics;
   Cardinality row_count;
+
+  // For statistics created from sketches, the merged sketches of the first `sketched_chunk_count` chunks, which were
+  // immutable during the creation. They are extended by update_from_table().
+  std::vector<std::shared_ptr<const BaseColumnSketch>> column_sketches;
+  ChunkID sketched_chunk_count{0};
+  StatisticsGenerationConfig generation_config;
+
+  // Optional statistics of correlated columns, see ColumnGroupStatistics.
+  std::vector<std::shared_ptr<const ColumnGroupStatistics>> column_group_statistics;
 };
 
 std::ostream& operator<<(std::ostream& stream, const TableStatistics& table_statistics);
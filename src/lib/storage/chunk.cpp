@@ -248,6 +248,19 @@ void Chunk::increase_invalid_row_count(const ChunkOffset count) const {
   _invalid_row_count += count;
 }
 
+void Chunk::increase_pending_inserts() const {
+  ++_pending_inserts;
+}
+
+bool Chunk::decrease_pending_inserts() const {
+  DebugAssert(_pending_inserts > 0, "Cannot decrease the number of pending inserts below zero.");
+  return --_pending_inserts == 0;
+}
+
+bool Chunk::has_pending_inserts() const {
+  return _pending_inserts > 0;
+}
+
 const std::vector<SortColumnDefinition>& Chunk::individually_sorted_by() const {
   return _sorted_by;
 }
@@ -180,6 +180,16 @@ class Chunk : private Noncopyable {
 
   void set_cleanup_commit_id(CommitID cleanup_commit_id);
 
+  /**
+   * Insert operators register at the chunks they allocated rows in and deregister once they committed or rolled back.
+   * A full chunk without pending inserts does not change anymore and can be finalized and encoded, e.g., by the
+   * ChunkCompressionTask. (The functions are marked as const for the same reason as increase_invalid_row_count.)
+   * decrease_pending_inserts() returns whether the calling Insert was the last pending one.
+   */
+  void increase_pending_inserts() const;
+  bool decrease_pending_inserts() const;
+  bool has_pending_inserts() const;
+
   /**
    * Executes tasks that are connected with finalizing a chunk. Currently, chunks are made immutable, and
    * depending on skip_mvcc_check, the MVCC max_begin_cid is set. Finalizing a chunk is the inserter's responsibility.
@@ -196,9 +206,10 @@ class Chunk : private Noncopyable {
   std::shared_ptr<MvccData> _mvcc_data;
   Indexes _indexes;
   std::optional<ChunkPruningStatistics> _pruning_statistics;
-  bool _is_mutable = true;
+  std::atomic_bool _is_mutable{true};
   std::vector<SortColumnDefinition> _sorted_by;
   mutable std::atomic<ChunkOffset::base_type> _invalid_row_count{ChunkOffset::base_type{0}};
+  mutable std::atomic_uint32_t _pending_inserts{0};
 
   // Default value of zero means "not set"
   std::atomic<CommitID> _cleanup_commit_id{CommitID{0}};
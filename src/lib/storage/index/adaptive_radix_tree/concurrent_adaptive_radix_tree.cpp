@@ -0,0 +1,499 @@
+#include "concurrent_adaptive_radix_tree.hpp"
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "types.hpp"
+#include "utils/assert.hpp"
+
+namespace hyrise {
+
+struct ConcurrentAdaptiveRadixTree::Node {
+  enum class Type : uint8_t { Leaf, Inner };
+
+  explicit Node(const Type init_type) : type(init_type) {}
+
+  const Type type;
+};
+
+struct ConcurrentAdaptiveRadixTree::Leaf final : public Node {
+  Leaf(Key init_key, std::vector<RowID> init_row_ids)
+      : Node{Type::Leaf}, key(std::move(init_key)), row_ids(std::move(init_row_ids)) {}
+
+  const Key key;
+  const std::vector<RowID> row_ids;
+};
+
+/**
+ * Inner nodes map partial keys (i.e., single bytes of the keys) to children. The children and partial keys are stored
+ * in atomics because readers access them while they are modified. Readers validate the version afterwards and discard
+ * what they have read if the node was modified in the meantime.
+ */
+struct ConcurrentAdaptiveRadixTree::InnerNode : public Node {
+  InnerNode() : Node{Type::Inner} {}
+
+  virtual ~InnerNode() = default;
+
+  // Returns nullptr if there is no child for the partial key.
+  virtual Node* find_child(const uint8_t partial_key) const = 0;
+
+  virtual bool is_full() const = 0;
+
+  // The following methods expect the node to be locked. insert_child() expects that the node is not full and that
+  // there is no child for the partial key, change_child() and remove_child() expect that there is one.
+  virtual void insert_child(const uint8_t partial_key, Node* child) = 0;
+  virtual void change_child(const uint8_t partial_key, Node* child) = 0;
+  virtual void remove_child(const uint8_t partial_key) = 0;
+
+  // Returns a copy of the node with the next larger capacity.
+  virtual InnerNode* grow() const = 0;
+
+  virtual void for_each_child(const std::function<void(uint8_t, Node*)>& functor) const = 0;
+
+  /**
+   * Optimistic lock coupling: the version is incremented by each write. The lock bit is set while a writer modifies
+   * the node, the obsolete bit is set once the node was replaced by a larger one.
+   */
+  static constexpr auto OBSOLETE_BIT = uint64_t{0b01};
+  static constexpr auto LOCK_BIT = uint64_t{0b10};
+
+  // Returns false if the node is locked or obsolete.
+  bool read_lock(uint64_t& version) const {
+    version = _version.load();
+    return (version & (LOCK_BIT | OBSOLETE_BIT)) == 0;
+  }
+
+  // Returns false if the node was modified since its version was read.
+  bool validate(const uint64_t version) const {
+    std::atomic_thread_fence(std::memory_order_acquire);
+    return _version.load(std::memory_order_relaxed) == version;
+  }
+
+  // Returns false if the node was modified since its version was read.
+  bool upgrade_to_write_lock(uint64_t version) {
+    return _version.compare_exchange_strong(version, version + LOCK_BIT);
+  }
+
+  void write_unlock() {
+    _version.fetch_add(LOCK_BIT);
+  }
+
+  void write_unlock_obsolete() {
+    _version.fetch_add(LOCK_BIT | OBSOLETE_BIT);
+  }
+
+ private:
+  std::atomic<uint64_t> _version{0b100};
+};
+
+}  // namespace hyrise
+
+namespace {
+
+using namespace hyrise;  // NOLINT
+
+using Node = ConcurrentAdaptiveRadixTree::Node;
+using Leaf = ConcurrentAdaptiveRadixTree::Leaf;
+using InnerNode = ConcurrentAdaptiveRadixTree::InnerNode;
+
+// Directly addressed by the partial keys.
+class Node256 final : public InnerNode {
+ public:
+  Node* find_child(const uint8_t partial_key) const final {
+    return _children[partial_key].load(std::memory_order_acquire);
+  }
+
+  bool is_full() const final {
+    return false;
+  }
+
+  void insert_child(const uint8_t partial_key, Node* child) final {
+    _children[partial_key].store(child, std::memory_order_release);
+  }
+
+  void change_child(const uint8_t partial_key, Node* child) final {
+    _children[partial_key].store(child, std::memory_order_release);
+  }
+
+  void remove_child(const uint8_t partial_key) final {
+    _children[partial_key].store(nullptr, std::memory_order_release);
+  }
+
+  InnerNode* grow() const final {
+    Fail("Nodes with 256 children cannot grow.");
+  }
+
+  void for_each_child(const std::function<void(uint8_t, Node*)>& functor) const final {
+    for (auto partial_key = uint16_t{0}; partial_key < _children.size(); ++partial_key) {
+      if (auto* child = _children[partial_key].load(std::memory_order_relaxed)) {
+        functor(static_cast<uint8_t>(partial_key), child);
+      }
+    }
+  }
+
+ private:
+  std::array<std::atomic<Node*>, 256> _children{};
+};
+
+// _child_index[partial_key] is the position of the partial key's child in _children.
+class Node48 final : public InnerNode {
+ public:
+  Node48() {
+    for (auto& child_index : _child_index) {
+      child_index.store(NO_CHILD, std::memory_order_relaxed);
+    }
+  }
+
+  Node* find_child(const uint8_t partial_key) const final {
+    const auto child_index = _child_index[partial_key].load(std::memory_order_relaxed);
+    if (child_index == NO_CHILD) {
+      return nullptr;
+    }
+    return _children[child_index].load(std::memory_order_acquire);
+  }
+
+  bool is_full() const final {
+    return _child_count.load(std::memory_order_relaxed) == CAPACITY;
+  }
+
+  void insert_child(const uint8_t partial_key, Node* child) final {
+    // Removed children leave gaps in _children, so we search for a free position.
+    auto child_index = uint8_t{0};
+    while (_children[child_index].load(std::memory_order_relaxed)) {
+      ++child_index;
+    }
+    DebugAssert(child_index < CAPACITY, "Node is full.");
+
+    _children[child_index].store(child, std::memory_order_release);
+    _child_index[partial_key].store(child_index, std::memory_order_release);
+    ++_child_count;
+  }
+
+  void change_child(const uint8_t partial_key, Node* child) final {
+    _children[_child_index[partial_key].load(std::memory_order_relaxed)].store(child, std::memory_order_release);
+  }
+
+  void remove_child(const uint8_t partial_key) final {
+    const auto child_index = _child_index[partial_key].load(std::memory_order_relaxed);
+    _child_index[partial_key].store(NO_CHILD, std::memory_order_release);
+    _children[child_index].store(nullptr, std::memory_order_release);
+    --_child_count;
+  }
+
+  InnerNode* grow() const final {
+    auto* grown_node = new Node256{};  // NOLINT(cppcoreguidelines-owning-memory)
+    for_each_child([&](const uint8_t partial_key, Node* child) { grown_node->insert_child(partial_key, child); });
+    return grown_node;
+  }
+
+  void for_each_child(const std::function<void(uint8_t, Node*)>& functor) const final {
+    for (auto partial_key = uint16_t{0}; partial_key < _child_index.size(); ++partial_key) {
+      const auto child_index = _child_index[partial_key].load(std::memory_order_relaxed);
+      if (child_index != NO_CHILD) {
+        functor(static_cast<uint8_t>(partial_key), _children[child_index].load(std::memory_order_relaxed));
+      }
+    }
+  }
+
+  static constexpr auto CAPACITY = uint8_t{48};
+  static constexpr auto NO_CHILD = uint8_t{255};
+
+ private:
+  std::atomic<uint8_t> _child_count{0};
+  std::array<std::atomic<uint8_t>, 256> _child_index{};
+  std::array<std::atomic<Node*>, CAPACITY> _children{};
+};
+
+// Used for nodes with up to 4 and up to 16 children. _partial_keys[i] is the partial key of child _children[i].
+template <uint8_t capacity>
+class SmallNode final : public InnerNode {
+ public:
+  Node* find_child(const uint8_t partial_key) const final {
+    const auto child_count = _child_count.load(std::memory_order_acquire);
+    for (auto index = uint8_t{0}; index < child_count; ++index) {
+      if (_partial_keys[index].load(std::memory_order_relaxed) == partial_key) {
+        return _children[index].load(std::memory_order_acquire);
+      }
+    }
+    return nullptr;
+  }
+
+  bool is_full() const final {
+    return _child_count.load(std::memory_order_relaxed) == capacity;
+  }
+
+  void insert_child(const uint8_t partial_key, Node* child) final {
+    const auto index = _child_count.load(std::memory_order_relaxed);
+    DebugAssert(index < capacity, "Node is full.");
+    _partial_keys[index].store(partial_key, std::memory_order_relaxed);
+    _children[index].store(child, std::memory_order_release);
+    _child_count.store(index + 1, std::memory_order_release);
+  }
+
+  void change_child(const uint8_t partial_key, Node* child) final {
+    _children[_position(partial_key)].store(child, std::memory_order_release);
+  }
+
+  void remove_child(const uint8_t partial_key) final {
+    // Move the last child to the position of the removed one.
+    const auto index = _position(partial_key);
+    const auto last_index = static_cast<uint8_t>(_child_count.load(std::memory_order_relaxed) - 1);
+    _partial_keys[index].store(_partial_keys[last_index].load(std::memory_order_relaxed), std::memory_order_relaxed);
+    _children[index].store(_children[last_index].load(std::memory_order_relaxed), std::memory_order_release);
+    _child_count.store(last_index, std::memory_order_release);
+  }
+
+  InnerNode* grow() const final {
+    auto* grown_node = static_cast<InnerNode*>(nullptr);
+    if constexpr (capacity == 4) {
+      grown_node = new SmallNode<16>{};  // NOLINT(cppcoreguidelines-owning-memory)
+    } else {
+      grown_node = new Node48{};  // NOLINT(cppcoreguidelines-owning-memory)
+    }
+    for_each_child([&](const uint8_t partial_key, Node* child) { grown_node->insert_child(partial_key, child); });
+    return grown_node;
+  }
+
+  void for_each_child(const std::function<void(uint8_t, Node*)>& functor) const final {
+    const auto child_count = _child_count.load(std::memory_order_relaxed);
+    for (auto index = uint8_t{0}; index < child_count; ++index) {
+      functor(_partial_keys[index].load(std::memory_order_relaxed), _children[index].load(std::memory_order_relaxed));
+    }
+  }
+
+ private:
+  uint8_t _position(const uint8_t partial_key) const {
+    const auto child_count = _child_count.load(std::memory_order_relaxed);
+    for (auto index = uint8_t{0}; index < child_count; ++index) {
+      if (_partial_keys[index].load(std::memory_order_relaxed) == partial_key) {
+        return index;
+      }
+    }
+    Fail("Node has no child for the partial key.");
+  }
+
+  std::atomic<uint8_t> _child_count{0};
+  std::array<std::atomic<uint8_t>, capacity> _partial_keys{};
+  std::array<std::atomic<Node*>, capacity> _children{};
+};
+
+// Creates the nodes that are needed to distinguish the keys of two leaves that are equal up to (excluding) depth.
+Node* expand(Leaf* first_leaf, Leaf* second_leaf, size_t depth) {
+  auto* top_node = new SmallNode<4>{};  // NOLINT(cppcoreguidelines-owning-memory)
+  auto* node = top_node;
+  while (true) {
+    Assert(depth < first_leaf->key.size() && depth < second_leaf->key.size(), "Keys must be prefix-free.");
+    const auto first_partial_key = first_leaf->key[depth];
+    const auto second_partial_key = second_leaf->key[depth];
+    if (first_partial_key != second_partial_key) {
+      node->insert_child(first_partial_key, first_leaf);
+      node->insert_child(second_partial_key, second_leaf);
+      return top_node;
+    }
+
+    auto* child = new SmallNode<4>{};  // NOLINT(cppcoreguidelines-owning-memory)
+    node->insert_child(first_partial_key, child);
+    node = child;
+    ++depth;
+  }
+}
+
+void delete_subtree(Node* node) {
+  if (node->type == Node::Type::Leaf) {
+    delete static_cast<Leaf*>(node);  // NOLINT(cppcoreguidelines-owning-memory)
+    return;
+  }
+
+  auto* inner_node = static_cast<InnerNode*>(node);
+  inner_node->for_each_child([](const uint8_t /*partial_key*/, Node* child) { delete_subtree(child); });
+  delete inner_node;  // NOLINT(cppcoreguidelines-owning-memory)
+}
+
+}  // namespace
+
+namespace hyrise {
+
+ConcurrentAdaptiveRadixTree::ConcurrentAdaptiveRadixTree() : _root(new Node256{}) {}
+
+ConcurrentAdaptiveRadixTree::~ConcurrentAdaptiveRadixTree() {
+  delete_subtree(_root);
+}
+
+std::vector<RowID> ConcurrentAdaptiveRadixTree::lookup(const Key& key) const {
+  const auto epoch_guard = _epoch_manager.pin();
+  while (true) {
+    auto row_ids = _try_lookup(key);
+    if (row_ids) {
+      return std::move(*row_ids);
+    }
+  }
+}
+
+bool ConcurrentAdaptiveRadixTree::update(const Key& key, const UpdateFunctor& update_functor) {
+  DebugAssert(!key.empty(), "Keys must not be empty.");
+  const auto epoch_guard = _epoch_manager.pin();
+  while (true) {
+    const auto updated = _try_update(key, update_functor);
+    if (updated) {
+      return *updated;
+    }
+  }
+}
+
+size_t ConcurrentAdaptiveRadixTree::key_count() const {
+  return _key_count.load();
+}
+
+std::optional<std::vector<RowID>> ConcurrentAdaptiveRadixTree::_try_lookup(const Key& key) const {
+  const auto* node = static_cast<const InnerNode*>(_root);
+  auto version = uint64_t{0};
+  if (!node->read_lock(version)) {
+    return std::nullopt;
+  }
+
+  for (const auto partial_key : key) {
+    const auto* child = node->find_child(partial_key);
+    if (!node->validate(version)) {
+      return std::nullopt;
+    }
+
+    if (!child) {
+      return std::vector<RowID>{};
+    }
+
+    // Leaves are immutable and cannot be deleted while we are pinned, so we do not need to validate again.
+    if (child->type == Node::Type::Leaf) {
+      const auto& leaf = static_cast<const Leaf&>(*child);
+      return leaf.key == key ? leaf.row_ids : std::vector<RowID>{};
+    }
+
+    node = static_cast<const InnerNode*>(child);
+    if (!node->read_lock(version)) {
+      return std::nullopt;
+    }
+  }
+
+  Fail("Keys must be prefix-free.");
+}
+
+std::optional<bool> ConcurrentAdaptiveRadixTree::_try_update(const Key& key, const UpdateFunctor& update_functor) {
+  auto* parent = static_cast<InnerNode*>(nullptr);
+  auto parent_version = uint64_t{0};
+  auto parent_partial_key = uint8_t{0};
+
+  auto* node = _root;
+  auto version = uint64_t{0};
+  if (!node->read_lock(version)) {
+    return std::nullopt;
+  }
+
+  for (auto depth = size_t{0}; depth < key.size(); ++depth) {
+    const auto partial_key = key[depth];
+    auto* child = node->find_child(partial_key);
+    if (!node->validate(version)) {
+      return std::nullopt;
+    }
+
+    // The key is not contained: add a leaf to the node.
+    if (!child) {
+      if (!node->is_full()) {
+        if (!node->upgrade_to_write_lock(version)) {
+          return std::nullopt;
+        }
+
+        auto row_ids = update_functor({});
+        if (row_ids && !row_ids->empty()) {
+          auto* const new_leaf = new Leaf{key, std::move(*row_ids)};  // NOLINT(cppcoreguidelines-owning-memory)
+          node->insert_child(partial_key, new_leaf);
+          ++_key_count;
+        }
+        node->write_unlock();
+        return row_ids && !row_ids->empty();
+      }
+
+      // The node is full and has to be replaced by a larger one, which requires locking its parent. As the root never
+      // is full, there always is a parent.
+      if (!parent->upgrade_to_write_lock(parent_version)) {
+        return std::nullopt;
+      }
+      if (!node->upgrade_to_write_lock(version)) {
+        parent->write_unlock();
+        return std::nullopt;
+      }
+
+      auto row_ids = update_functor({});
+      if (!row_ids || row_ids->empty()) {
+        node->write_unlock();
+        parent->write_unlock();
+        return false;
+      }
+
+      auto* grown_node = node->grow();
+      auto* const new_leaf = new Leaf{key, std::move(*row_ids)};  // NOLINT(cppcoreguidelines-owning-memory)
+      grown_node->insert_child(partial_key, new_leaf);
+      parent->change_child(parent_partial_key, grown_node);
+      ++_key_count;
+      node->write_unlock_obsolete();
+      parent->write_unlock();
+      _epoch_manager.retire(node);
+      return true;
+    }
+
+    if (child->type == Node::Type::Leaf) {
+      // Locking the node with the validated version guarantees that the leaf is still its child.
+      if (!node->upgrade_to_write_lock(version)) {
+        return std::nullopt;
+      }
+
+      auto* leaf = static_cast<Leaf*>(child);
+      if (leaf->key == key) {
+        auto row_ids = update_functor(leaf->row_ids);
+        if (!row_ids) {
+          node->write_unlock();
+          return false;
+        }
+
+        if (row_ids->empty()) {
+          node->remove_child(partial_key);
+          --_key_count;
+        } else {
+          auto* const new_leaf = new Leaf{key, std::move(*row_ids)};  // NOLINT(cppcoreguidelines-owning-memory)
+          node->change_child(partial_key, new_leaf);
+        }
+        node->write_unlock();
+        _epoch_manager.retire(leaf);
+        return true;
+      }
+
+      // The leaf holds a different key with the same prefix. Replace it by inner nodes that distinguish both keys.
+      auto row_ids = update_functor({});
+      if (!row_ids || row_ids->empty()) {
+        node->write_unlock();
+        return false;
+      }
+
+      auto* new_leaf = new Leaf{key, std::move(*row_ids)};  // NOLINT(cppcoreguidelines-owning-memory)
+      node->change_child(partial_key, expand(leaf, new_leaf, depth + 1));
+      ++_key_count;
+      node->write_unlock();
+      return true;
+    }
+
+    parent = node;
+    parent_version = version;
+    parent_partial_key = partial_key;
+    node = static_cast<InnerNode*>(child);
+    if (!node->read_lock(version)) {
+      return std::nullopt;
+    }
+  }
+
+  Fail("Keys must be prefix-free.");
+}
+
+}  // namespace hyrise
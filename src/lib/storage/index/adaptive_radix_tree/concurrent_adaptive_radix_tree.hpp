@@ -0,0 +1,75 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <vector>
+
+#include "epoch_manager.hpp"
+#include "types.hpp"
+
+namespace hyrise {
+
+/**
+ * An Adaptive Radix Tree (ART) that can be read and modified concurrently. Unlike the AdaptiveRadixTreeIndex, which
+ * is bulk-loaded from a single immutable DictionarySegment, it stores arbitrary byte keys and maps each of them to a
+ * list of RowIDs. The keys have to be prefix-free, i.e., no key may be a prefix of another one. PrimaryKeyIndex
+ * describes how table values are encoded to such keys.
+ *
+ * As in the AdaptiveRadixTreeIndex, inner nodes hold up to 4, 16, 48, or 256 children, and on level n, the n-th byte of
+ * the key is used to find the child. Nodes grow when they are full, but do not shrink when keys are removed. Leaves
+ * store the full key and are placed right below the first node whose byte distinguishes their key from all others
+ * (lazy expansion). Thus, operations take O(key length). Inner nodes do not store compressed prefixes.
+ *
+ * Concurrency is handled with optimistic lock coupling, as described in "The ART of Practical Synchronization" (Leis
+ * et al., DaMoN 2016): each inner node has a version counter containing a lock bit and an obsolete bit. Readers do not
+ * acquire locks but validate the versions of the nodes they read and restart if a node was modified in the meantime.
+ * Writers only lock the node they modify, plus its parent if the node has to be replaced by a larger one. Leaves are
+ * immutable, so modifying the RowIDs of a key replaces its leaf. Replaced nodes and leaves might still be read by
+ * concurrent operations and are deleted by the EpochManager once this is no longer possible.
+ */
+class ConcurrentAdaptiveRadixTree : private Noncopyable {
+ public:
+  using Key = std::vector<uint8_t>;
+
+  /**
+   * Receives the current RowIDs of a key (empty if the key is not contained) and returns the RowIDs that should be
+   * stored instead. Returning an empty vector removes the key, returning std::nullopt leaves the tree unchanged.
+   */
+  using UpdateFunctor = std::function<std::optional<std::vector<RowID>>(const std::vector<RowID>&)>;
+
+  ConcurrentAdaptiveRadixTree();
+  ~ConcurrentAdaptiveRadixTree();
+
+  // Returns the RowIDs of the key or an empty vector if the key is not contained.
+  std::vector<RowID> lookup(const Key& key) const;
+
+  /**
+   * Atomically replaces the RowIDs of the key by the result of update_functor. It is called exactly once, while the
+   * node that holds (or would hold) the key's leaf is locked. Thus, it should be cheap and must not access the tree.
+   * Returns whether the tree was modified.
+   */
+  bool update(const Key& key, const UpdateFunctor& update_functor);
+
+  size_t key_count() const;
+
+  // Node types, defined in the source file.
+  struct Node;
+  struct Leaf;
+  struct InnerNode;
+
+ private:
+  // Both return std::nullopt if the operation has to be restarted because of a concurrent modification.
+  std::optional<std::vector<RowID>> _try_lookup(const Key& key) const;
+  std::optional<bool> _try_update(const Key& key, const UpdateFunctor& update_functor);
+
+  // The root is a node with 256 children that is never replaced.
+  InnerNode* _root;
+
+  std::atomic<size_t> _key_count{0};
+
+  mutable EpochManager _epoch_manager;
+};
+
+}  // namespace hyrise
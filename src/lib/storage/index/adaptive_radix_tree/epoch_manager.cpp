@@ -0,0 +1,93 @@
+#include "epoch_manager.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "utils/assert.hpp"
+
+namespace hyrise {
+
+EpochManager::EpochGuard::EpochGuard(std::atomic<uint64_t>& slot) : _slot(slot) {}
+
+EpochManager::EpochGuard::~EpochGuard() {
+  _slot.store(UNPINNED);
+}
+
+EpochManager::~EpochManager() {
+  for (const auto& retired_object : _retired_objects) {
+    retired_object.deleter(retired_object.object);
+  }
+}
+
+EpochManager::EpochGuard EpochManager::pin() {
+  // Start searching for a free slot at a thread-specific position, so that threads usually do not compete for slots.
+  // As pins are short, a free slot is found quickly even if there are more threads than slots.
+  thread_local const auto first_slot_id = std::hash<std::thread::id>{}(std::this_thread::get_id());
+
+  for (auto slot_id = first_slot_id;; ++slot_id) {
+    auto& slot = _pinned_epochs[slot_id % SLOT_COUNT];
+    if (slot.load(std::memory_order_relaxed) != UNPINNED) {
+      continue;
+    }
+
+    // The epoch might advance before the slot is claimed. Pinning an older epoch only delays the reclamation.
+    auto expected = UNPINNED;
+    if (slot.compare_exchange_strong(expected, _global_epoch.load())) {
+      return EpochGuard{slot};
+    }
+  }
+}
+
+void EpochManager::_retire(void* object, void (*deleter)(void*)) {
+  DebugAssert(object, "Cannot retire a nullptr.");
+  auto lock = std::unique_lock<std::mutex>{_retired_objects_mutex};
+  _retired_objects.emplace_back(RetiredObject{_global_epoch.load(), object, deleter});
+  const auto reclamation_due = _retired_objects.size() % RECLAMATION_INTERVAL == 0;
+  lock.unlock();
+
+  if (reclamation_due) {
+    reclaim();
+  }
+}
+
+void EpochManager::reclaim() {
+  _global_epoch.fetch_add(1);
+
+  // Threads that are not visible in the slots yet pin an epoch that is at least as recent as the current one. Hence,
+  // they cannot reach any of the objects retired so far.
+  auto oldest_pinned_epoch = std::numeric_limits<uint64_t>::max();
+  for (const auto& slot : _pinned_epochs) {
+    const auto epoch = slot.load();
+    if (epoch != UNPINNED) {
+      oldest_pinned_epoch = std::min(oldest_pinned_epoch, epoch);
+    }
+  }
+
+  auto reclaimable_objects = std::vector<RetiredObject>{};
+  {
+    const auto lock = std::lock_guard<std::mutex>{_retired_objects_mutex};
+    const auto reclaimable_begin =
+        std::partition(_retired_objects.begin(), _retired_objects.end(), [&](const auto& retired_object) {
+          return retired_object.epoch >= oldest_pinned_epoch;
+        });
+    reclaimable_objects.assign(reclaimable_begin, _retired_objects.end());
+    _retired_objects.erase(reclaimable_begin, _retired_objects.end());
+  }
+
+  for (const auto& retired_object : reclaimable_objects) {
+    retired_object.deleter(retired_object.object);
+  }
+}
+
+size_t EpochManager::retired_object_count() const {
+  const auto lock = std::lock_guard<std::mutex>{_retired_objects_mutex};
+  return _retired_objects.size();
+}
+
+}  // namespace hyrise
@@ -0,0 +1,86 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+#include "types.hpp"
+
+namespace hyrise {
+
+/**
+ * Epoch-based memory reclamation for data structures that are read without locks, such as the
+ * ConcurrentAdaptiveRadixTree. Threads pin the current epoch (see pin()) while they access the data structure.
+ * Objects that were unlinked from the data structure might still be read by threads that reached them before, so
+ * they are retired instead of being deleted right away. A retired object is deleted once every thread is pinned to a
+ * later epoch than the one the object was retired in: such threads started their access after the object was
+ * unlinked and cannot reach it.
+ *
+ * The pinned epochs are stored in a fixed number of slots that are claimed for the duration of a pin. Thus, threads do
+ * not need to register with the EpochManager, which suits the short-lived tasks of the scheduler.
+ */
+class EpochManager : private Noncopyable {
+ public:
+  // Unpins the epoch when it goes out of scope. Can neither be copied nor moved.
+  class EpochGuard : private Noncopyable {
+   public:
+    ~EpochGuard();
+
+    EpochGuard(EpochGuard&&) = delete;
+    EpochGuard& operator=(EpochGuard&&) = delete;
+
+   private:
+    friend class EpochManager;
+
+    explicit EpochGuard(std::atomic<uint64_t>& slot);
+
+    std::atomic<uint64_t>& _slot;
+  };
+
+  EpochManager() = default;
+
+  // Deletes all retired objects. The data structure must not be accessed anymore.
+  ~EpochManager();
+
+  // Pins the current epoch until the returned guard is destroyed.
+  EpochGuard pin();
+
+  // Deletes the object as soon as no pinned thread can read it anymore.
+  template <typename T>
+  void retire(T* object) {
+    _retire(object, [](void* retired_object) {
+      delete static_cast<T*>(retired_object);  // NOLINT(cppcoreguidelines-owning-memory)
+    });
+  }
+
+  // Advances the epoch and deletes the retired objects that cannot be read anymore. Called by retire() for every
+  // RECLAMATION_INTERVAL retired objects.
+  void reclaim();
+
+  size_t retired_object_count() const;
+
+  static constexpr auto SLOT_COUNT = size_t{256};
+  static constexpr auto RECLAMATION_INTERVAL = size_t{64};
+
+ private:
+  struct RetiredObject {
+    uint64_t epoch;
+    void* object;
+    void (*deleter)(void*);
+  };
+
+  void _retire(void* object, void (*deleter)(void*));
+
+  // Epochs start at one, zero marks unused slots.
+  static constexpr auto UNPINNED = uint64_t{0};
+
+  std::atomic<uint64_t> _global_epoch{1};
+  std::array<std::atomic<uint64_t>, SLOT_COUNT> _pinned_epochs{};
+
+  mutable std::mutex _retired_objects_mutex;
+  std::vector<RetiredObject> _retired_objects;
+};
+
+}  // namespace hyrise
@@ -0,0 +1,252 @@
+#include "primary_key_index.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "lossless_cast.hpp"
+#include "resolve_type.hpp"
+#include "storage/chunk.hpp"
+#include "storage/mvcc_data.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace hyrise;  // NOLINT
+
+using Key = ConcurrentAdaptiveRadixTree::Key;
+
+/**
+ * Appends the bytes of a value so that the resulting byte strings compare like the values:
+ *  - Integers are stored in big-endian byte order with an inverted sign bit, so that negative values come first.
+ *  - Floating-point numbers are stored like integers. As their other bits are not in two's complement, all bits of
+ *    negative numbers are inverted. -0.0 is stored as 0.0 because both are equal.
+ *  - Strings are terminated by two zero bytes. Zero bytes within the string are followed by 0xFF. Hence, no encoded
+ *    string is a prefix of another one, which is required by the ConcurrentAdaptiveRadixTree.
+ */
+template <typename T>
+void append_encoded_value(Key& key, const T& value) {
+  if constexpr (std::is_same_v<T, pmr_string>) {
+    for (const auto character : value) {
+      key.push_back(static_cast<uint8_t>(character));
+      if (character == '\0') {
+        key.push_back(uint8_t{0xFF});
+      }
+    }
+    key.push_back(uint8_t{0});
+    key.push_back(uint8_t{0});
+  } else {
+    using UnsignedType = std::conditional_t<sizeof(T) == 4, uint32_t, uint64_t>;
+    constexpr auto SIGN_BIT = UnsignedType{1} << (sizeof(T) * 8 - 1);
+
+    auto bits = UnsignedType{};
+    if constexpr (std::is_floating_point_v<T>) {
+      bits = std::bit_cast<UnsignedType>(value == T{0} ? T{0} : value);
+      bits = (bits & SIGN_BIT) ? ~bits : bits | SIGN_BIT;
+    } else {
+      bits = static_cast<UnsignedType>(value) ^ SIGN_BIT;
+    }
+
+    for (auto byte_id = sizeof(T); byte_id > 0; --byte_id) {
+      key.push_back(static_cast<uint8_t>(bits >> ((byte_id - 1) * 8)));
+    }
+  }
+}
+
+}  // namespace
+
+namespace hyrise {
+
+PrimaryKeyIndex::PrimaryKeyIndex(const Table& table, const std::vector<ColumnID>& column_ids)
+    : _column_ids(column_ids) {
+  Assert(!_column_ids.empty(), "Primary key index requires at least one column.");
+  _data_types.reserve(_column_ids.size());
+  for (const auto column_id : _column_ids) {
+    Assert(!table.column_is_nullable(column_id), "Primary key columns must not be NULLable.");
+    _data_types.emplace_back(table.column_data_type(column_id));
+  }
+
+  const auto chunk_count = table.chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = table.get_chunk(chunk_id);
+    if (!chunk) {
+      continue;
+    }
+
+    // Encode the keys column by column, which is faster than accessing the rows' values one by one.
+    const auto chunk_size = chunk->size();
+    auto keys = std::vector<Key>(chunk_size);
+    for (auto index = size_t{0}; index < _column_ids.size(); ++index) {
+      resolve_data_type(_data_types[index], [&](const auto data_type_t) {
+        using ColumnDataType = typename decltype(data_type_t)::type;
+        segment_iterate<ColumnDataType>(*chunk->get_segment(_column_ids[index]), [&](const auto& position) {
+          append_encoded_value(keys[position.chunk_offset()], position.value());
+        });
+      });
+    }
+
+    const auto& mvcc_data = chunk->mvcc_data();
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+      if (mvcc_data && mvcc_data->get_end_cid(chunk_offset) != MvccData::MAX_COMMIT_ID) {
+        continue;
+      }
+
+      const auto row_id = RowID{chunk_id, chunk_offset};
+      const auto inserted =
+          _tree.update(keys[chunk_offset], [&](const auto& row_ids) -> std::optional<std::vector<RowID>> {
+            if (!row_ids.empty()) {
+              return std::nullopt;
+            }
+            return std::vector<RowID>{row_id};
+          });
+      AssertInput(inserted, "Cannot create primary key index: duplicate key in row " +
+                                std::to_string(chunk_offset) + " of chunk " + std::to_string(chunk_id) + ".");
+    }
+  }
+}
+
+const std::vector<ColumnID>& PrimaryKeyIndex::column_ids() const {
+  return _column_ids;
+}
+
+std::vector<RowID> PrimaryKeyIndex::lookup(const std::vector<AllTypeVariant>& values) const {
+  Assert(values.size() == _column_ids.size(), "Expected one value per primary key column.");
+
+  auto casted_values = std::vector<AllTypeVariant>{};
+  casted_values.reserve(values.size());
+  for (auto index = size_t{0}; index < values.size(); ++index) {
+    // A key column cannot be NULL or equal to a value that has no lossless representation in the column's data type.
+    const auto casted_value = lossless_variant_cast(values[index], _data_types[index]);
+    if (!casted_value || variant_is_null(*casted_value)) {
+      return {};
+    }
+    casted_values.emplace_back(*casted_value);
+  }
+
+  return _tree.lookup(encode_key(casted_values));
+}
+
+bool PrimaryKeyIndex::insert(const Table& table, const RowID row_id, const TransactionID transaction_id) {
+  const auto key = _encode_row(*table.get_chunk(row_id.chunk_id), row_id.chunk_offset);
+
+  return _tree.update(key, [&](const auto& current_row_ids) -> std::optional<std::vector<RowID>> {
+    auto row_ids = std::vector<RowID>{};
+    row_ids.reserve(current_row_ids.size() + 1);
+
+    for (const auto& current_row_id : current_row_ids) {
+      const auto chunk = table.get_chunk(current_row_id.chunk_id);
+      if (!chunk) {
+        // The chunk was physically deleted. Its rows were invalidated before.
+        continue;
+      }
+
+      const auto& mvcc_data = chunk->mvcc_data();
+      if (!mvcc_data) {
+        return std::nullopt;
+      }
+
+      const auto chunk_offset = current_row_id.chunk_offset;
+      if (mvcc_data->get_end_cid(chunk_offset) != MvccData::MAX_COMMIT_ID) {
+        // The row was deleted by a committed transaction. Active transactions might still see it, so it is kept until
+        // remove_deleted_rows() drops it.
+        row_ids.emplace_back(current_row_id);
+        continue;
+      }
+
+      // Rows that are deleted by the inserting transaction do not conflict. If a transaction deletes a row it
+      // inserted itself, the row's TID is reset (see Delete::_on_execute()) and the row never becomes visible.
+      const auto row_tid = mvcc_data->get_tid(chunk_offset);
+      const auto begin_cid = mvcc_data->get_begin_cid(chunk_offset);
+      if (row_tid == transaction_id && begin_cid != MvccData::MAX_COMMIT_ID) {
+        row_ids.emplace_back(current_row_id);
+        continue;
+      }
+      if (row_tid == INVALID_TRANSACTION_ID && begin_cid == MvccData::MAX_COMMIT_ID) {
+        continue;
+      }
+
+      // The row is visible, is being inserted by another transaction, or is being deleted by another transaction,
+      // which might still roll back.
+      return std::nullopt;
+    }
+
+    row_ids.emplace_back(row_id);
+    return row_ids;
+  });
+}
+
+void PrimaryKeyIndex::erase(const Table& table, const RowID row_id) {
+  _erase(_encode_row(*table.get_chunk(row_id.chunk_id), row_id.chunk_offset), row_id);
+}
+
+void PrimaryKeyIndex::register_deleted_row(const Table& table, const RowID row_id, const CommitID commit_id) {
+  auto key = _encode_row(*table.get_chunk(row_id.chunk_id), row_id.chunk_offset);
+  const auto lock = std::lock_guard<std::mutex>{_deleted_rows_mutex};
+  _deleted_rows.emplace_back(DeletedRow{commit_id, std::move(key), row_id});
+}
+
+size_t PrimaryKeyIndex::remove_deleted_rows(const CommitID snapshot_commit_id) {
+  // Take the rows out of the list first, so that the tree is not modified while holding the mutex. Rows registered
+  // after a row that is still visible are kept as well and removed by a later call.
+  auto removed_rows = std::vector<DeletedRow>{};
+  {
+    const auto lock = std::lock_guard<std::mutex>{_deleted_rows_mutex};
+    while (!_deleted_rows.empty() && _deleted_rows.front().commit_id <= snapshot_commit_id) {
+      removed_rows.emplace_back(std::move(_deleted_rows.front()));
+      _deleted_rows.pop_front();
+    }
+  }
+
+  for (const auto& removed_row : removed_rows) {
+    _erase(removed_row.key, removed_row.row_id);
+  }
+  return removed_rows.size();
+}
+
+size_t PrimaryKeyIndex::key_count() const {
+  return _tree.key_count();
+}
+
+ConcurrentAdaptiveRadixTree::Key PrimaryKeyIndex::encode_key(const std::vector<AllTypeVariant>& values) {
+  auto key = Key{};
+  for (const auto& value : values) {
+    Assert(!variant_is_null(value), "Primary keys cannot contain NULL values.");
+    resolve_data_type(data_type_from_all_type_variant(value), [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+      append_encoded_value(key, boost::get<ColumnDataType>(value));
+    });
+  }
+  return key;
+}
+
+ConcurrentAdaptiveRadixTree::Key PrimaryKeyIndex::_encode_row(const Chunk& chunk,
+                                                               const ChunkOffset chunk_offset) const {
+  auto values = std::vector<AllTypeVariant>{};
+  values.reserve(_column_ids.size());
+  for (const auto column_id : _column_ids) {
+    values.emplace_back((*chunk.get_segment(column_id))[chunk_offset]);
+  }
+  return encode_key(values);
+}
+
+void PrimaryKeyIndex::_erase(const ConcurrentAdaptiveRadixTree::Key& key, const RowID row_id) {
+  _tree.update(key, [&](const auto& current_row_ids) -> std::optional<std::vector<RowID>> {
+    auto row_ids = current_row_ids;
+    const auto removed_row_id = std::remove(row_ids.begin(), row_ids.end(), row_id);
+    if (removed_row_id == row_ids.end()) {
+      return std::nullopt;
+    }
+    row_ids.erase(removed_row_id, row_ids.end());
+    return row_ids;
+  });
+}
+
+}  // namespace hyrise
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <deque>
+#include <mutex>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "concurrent_adaptive_radix_tree.hpp"
+#include "types.hpp"
+
+namespace hyrise {
+
+class Chunk;
+class Table;
+
+/**
+ * A table-wide index on the primary key columns of a table that maps each key to the RowIDs of the rows holding it.
+ * Unlike chunk indexes and the PartialHashIndex, it also covers mutable chunks: the Insert operator adds new rows
+ * right away and rejects rows whose key is already held by another row (see insert()). As Delete and Update only
+ * invalidate rows, a key can map to multiple RowIDs: the current row and old versions that running transactions might
+ * still see. Lookups return all of them, so their results have to be validated. Delete registers the rows it removes
+ * when it commits (see register_deleted_row()), and they are dropped from the index once no transaction can see them
+ * anymore (see remove_deleted_rows()).
+ *
+ * The values of the key columns are encoded into a binary-comparable, prefix-free byte string (see
+ * PrimaryKeyIndex::encode_key()), which is stored in a ConcurrentAdaptiveRadixTree. Thus, lookups and uniqueness
+ * checks take O(key length) and neither block each other nor concurrent Inserts.
+ */
+class PrimaryKeyIndex : private Noncopyable {
+ public:
+  /**
+   * Creates the index on the given columns and adds all rows of the table that have not been deleted. Fails if the
+   * columns are NULLable or hold duplicate keys. The table must not be modified while the index is created.
+   */
+  PrimaryKeyIndex(const Table& table, const std::vector<ColumnID>& column_ids);
+
+  const std::vector<ColumnID>& column_ids() const;
+
+  /**
+   * Returns the RowIDs of all rows that hold the key, including old versions. The values are given in the order of
+   * column_ids() and are converted to the columns' data types. If a value cannot be converted losslessly, no row can
+   * hold the key.
+   */
+  std::vector<RowID> lookup(const std::vector<AllTypeVariant>& values) const;
+
+  /**
+   * Adds a row that is being inserted by the given transaction. Returns false (and leaves the index unchanged) if
+   * another row holds the same key, unless that row was deleted (by a committed transaction or by the inserting
+   * transaction itself). Thus, the key of a row can be updated by deleting and re-inserting it in one transaction.
+   * Deleted rows remain in the index until they are removed by remove_deleted_rows().
+   */
+  bool insert(const Table& table, const RowID row_id, const TransactionID transaction_id);
+
+  // Removes a row that was added using insert() when its Insert is rolled back.
+  void erase(const Table& table, const RowID row_id);
+
+  // Registers a row that was deleted by the transaction with the given commit ID, see Delete::_on_commit_records().
+  void register_deleted_row(const Table& table, const RowID row_id, const CommitID commit_id);
+
+  /**
+   * Removes the registered rows that are invisible to all transactions whose snapshot commit ID is at least the given
+   * one, i.e., that were deleted by a transaction with a commit ID up to the snapshot commit ID. Callers pass the
+   * lowest snapshot commit ID of the active transactions. Returns the number of removed rows.
+   */
+  size_t remove_deleted_rows(const CommitID snapshot_commit_id);
+
+  size_t key_count() const;
+
+  // Encodes the values of the key columns so that the byte strings of two keys compare like the keys themselves.
+  static ConcurrentAdaptiveRadixTree::Key encode_key(const std::vector<AllTypeVariant>& values);
+
+ private:
+  ConcurrentAdaptiveRadixTree::Key _encode_row(const Chunk& chunk, const ChunkOffset chunk_offset) const;
+
+  void _erase(const ConcurrentAdaptiveRadixTree::Key& key, const RowID row_id);
+
+  struct DeletedRow {
+    CommitID commit_id;
+    ConcurrentAdaptiveRadixTree::Key key;
+    RowID row_id;
+  };
+
+  const std::vector<ColumnID> _column_ids;
+  std::vector<DataType> _data_types;
+
+  ConcurrentAdaptiveRadixTree _tree;
+
+  // Deleted rows in the order of their registration, which roughly follows their commit IDs. The keys are stored
+  // because the rows' chunks might be physically deleted before the rows are removed from the index.
+  std::mutex _deleted_rows_mutex;
+  std::deque<DeletedRow> _deleted_rows;
+};
+
+}  // namespace hyrise
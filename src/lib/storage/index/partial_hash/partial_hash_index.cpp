@@ -15,6 +15,14 @@ PartialHashIndex::PartialHashIndex(const std::vector<std::pair<ChunkID, std::sha
                     });
 }
 
+PartialHashIndex::PartialHashIndex(const DataType data_type, const ColumnID column_id) : _column_id{column_id} {
+  resolve_data_type(data_type, [&](const auto column_data_type) {
+    using ColumnDataType = typename decltype(column_data_type)::type;
+    _impl = std::make_unique<PartialHashIndexImpl<ColumnDataType>>(
+        std::vector<std::pair<ChunkID, std::shared_ptr<Chunk>>>{}, _column_id);
+  });
+}
+
 size_t PartialHashIndex::insert(const std::vector<std::pair<ChunkID, std::shared_ptr<Chunk>>>& chunks_to_index) {
   // Prevents multiple threads from indexing the same chunk concurrently.
   const auto lock = std::lock_guard<std::shared_mutex>{_data_access_mutex};
@@ -21,6 +21,9 @@ class PartialHashIndex {
   PartialHashIndex() = delete;
   PartialHashIndex(const std::vector<std::pair<ChunkID, std::shared_ptr<Chunk>>>& chunks_to_index, const ColumnID);
 
+  // Creates an empty index for a column of the given data type. Chunks can be added later using insert().
+  PartialHashIndex(const DataType data_type, const ColumnID);
+
   /**
    * The following four methods are used to access any table index. Each of them accepts a generic function object that
    * expects a begin and end iterator to the underlying data structure as parameter. When accessing the index with one
@@ -3,7 +3,8 @@
 namespace hyrise {
 
 bool operator==(const TableIndexStatistics& left, const TableIndexStatistics& right) {
-  return std::tie(left.column_ids, left.chunk_ids) == std::tie(right.column_ids, right.chunk_ids);
+  return std::tie(left.column_ids, left.chunk_ids, left.name) ==
+         std::tie(right.column_ids, right.chunk_ids, right.name);
 }
 
 }  // namespace hyrise
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <string>
+
 #include "storage/chunk.hpp"
 #include "types.hpp"
 
@@ -8,6 +10,7 @@ namespace hyrise {
 struct TableIndexStatistics {
   std::vector<ColumnID> column_ids;
   std::vector<std::pair<ChunkID, std::shared_ptr<Chunk>>> chunk_ids;
+  std::string name;
 };
 
 // For googletest
@@ -1,10 +1,15 @@
 #include "storage_manager.hpp"
 
+#include <algorithm>
+#include <cctype>
+#include <limits>
 #include <memory>
 #include <string>
 #include <utility>
 #include <vector>
 
+#include "magic_enum.hpp"
+
 #include "hyrise.hpp"
 #include "import_export/file_type.hpp"
 #include "logical_query_plan/abstract_lqp_node.hpp"
@@ -12,9 +17,102 @@
 #include "operators/table_wrapper.hpp"
 #include "scheduler/job_task.hpp"
 #include "statistics/generate_pruning_statistics.hpp"
+#include "statistics/sketches/kll_sketch.hpp"
 #include "statistics/table_statistics.hpp"
 #include "utils/assert.hpp"
 #include "utils/meta_table_manager.hpp"
+#include "utils/settings/abstract_setting.hpp"
+
+namespace {
+
+using namespace hyrise;  // NOLINT
+
+uint32_t parse_setting_value(const std::string& name, const std::string& value, const uint32_t min_value) {
+  const auto is_digit = [](const unsigned char character) {
+    return std::isdigit(character);
+  };
+  AssertInput(!value.empty() && value.size() <= 10 && std::all_of(value.cbegin(), value.cend(), is_digit),
+              "Expected a non-negative integer for " + name + ", got '" + value + "'.");
+  const auto parsed_value = std::stoull(value);
+  AssertInput(parsed_value >= min_value && parsed_value <= std::numeric_limits<uint32_t>::max(),
+              "Value for " + name + " must be at least " + std::to_string(min_value) + ".");
+  return static_cast<uint32_t>(parsed_value);
+}
+
+class StatisticsGenerationModeSetting : public AbstractSetting {
+ public:
+  StatisticsGenerationModeSetting() : AbstractSetting("TableStatistics.generation_mode") {}
+
+  const std::string& description() const final {
+    static const auto description =
+        std::string{"Statistics of added tables are Exact or approximated from Sketches, which is faster"};
+    return description;
+  }
+
+  const std::string& get() final {
+    _value = magic_enum::enum_name(Hyrise::get().storage_manager.statistics_generation_config.mode);
+    return _value;
+  }
+
+  void set(const std::string& value) final {
+    const auto mode = magic_enum::enum_cast<StatisticsGenerationMode>(value);
+    AssertInput(mode, "Expected Exact or Sketch for " + name + ", got '" + value + "'.");
+    Hyrise::get().storage_manager.statistics_generation_config.mode = *mode;
+  }
+
+ private:
+  std::string _value;
+};
+
+class StatisticsSketchSizeSetting : public AbstractSetting {
+ public:
+  StatisticsSketchSizeSetting() : AbstractSetting("TableStatistics.sketch_size") {}
+
+  const std::string& description() const final {
+    static const auto description =
+        std::string{"Size of the quantile sketches if statistics are approximated, larger sizes are more accurate"};
+    return description;
+  }
+
+  const std::string& get() final {
+    _value = std::to_string(Hyrise::get().storage_manager.statistics_generation_config.sketch_size);
+    return _value;
+  }
+
+  void set(const std::string& value) final {
+    Hyrise::get().storage_manager.statistics_generation_config.sketch_size =
+        parse_setting_value(name, value, KllSketch<int32_t>::MIN_K);
+  }
+
+ private:
+  std::string _value;
+};
+
+class StatisticsSamplingIntervalSetting : public AbstractSetting {
+ public:
+  StatisticsSamplingIntervalSetting() : AbstractSetting("TableStatistics.sampling_interval") {}
+
+  const std::string& description() const final {
+    static const auto description =
+        std::string{"Only every n-th value is added to the quantile sketches if statistics are approximated"};
+    return description;
+  }
+
+  const std::string& get() final {
+    _value = std::to_string(Hyrise::get().storage_manager.statistics_generation_config.sampling_interval);
+    return _value;
+  }
+
+  void set(const std::string& value) final {
+    Hyrise::get().storage_manager.statistics_generation_config.sampling_interval =
+        parse_setting_value(name, value, 1);
+  }
+
+ private:
+  std::string _value;
+};
+
+}  // namespace
 
 namespace hyrise {
 
@@ -36,7 +134,7 @@ void StorageManager::add_table(const std::string& name, std::shared_ptr<Table> t
 
   // Create table statistics and chunk pruning statistics for added table.
 
-  table->set_table_statistics(TableStatistics::from_table(*table));
+  table->set_table_statistics(TableStatistics::from_table(*table, statistics_generation_config));
   generate_chunk_pruning_statistics(table);
 
   _tables[name] = std::move(table);
@@ -233,6 +331,11 @@ void StorageManager::export_all_tables_as_csv(const std::string& path) {
   Hyrise::get().scheduler()->wait_for_tasks(tasks);
 }
 
+std::vector<std::shared_ptr<AbstractSetting>> StorageManager::create_statistics_generation_settings() {
+  return {std::make_shared<StatisticsGenerationModeSetting>(), std::make_shared<StatisticsSketchSizeSetting>(),
+          std::make_shared<StatisticsSamplingIntervalSetting>()};
+}
+
 std::ostream& operator<<(std::ostream& stream, const StorageManager& storage_manager) {
   stream << "==================" << std::endl;
   stream << "===== Tables =====" << std::endl << std::endl;
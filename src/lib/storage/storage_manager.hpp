@@ -11,12 +11,14 @@
 
 #include "lqp_view.hpp"
 #include "prepared_plan.hpp"
+#include "statistics/table_statistics.hpp"
 #include "types.hpp"
 
 namespace hyrise {
 
 class Table;
 class AbstractLQPNode;
+class AbstractSetting;
 
 // The StorageManager is a class that maintains all tables
 // by mapping table names to table instances.
@@ -60,6 +62,20 @@ class StorageManager : public Noncopyable {
   // For debugging purposes mostly, dump all tables as csv
   void export_all_tables_as_csv(const std::string& path);
 
+  /**
+   * Determines how the statistics of added tables are created. It can be changed using the settings
+   * "TableStatistics.generation_mode", "TableStatistics.sketch_size", and "TableStatistics.sampling_interval" (see
+   * create_statistics_generation_settings()). The config is not synchronized, it should not be changed while tables
+   * are added.
+   */
+  StatisticsGenerationConfig statistics_generation_config;
+
+  /**
+   * Returns the settings that control the statistics_generation_config. They access the StorageManager of the Hyrise
+   * singleton.
+   */
+  static std::vector<std::shared_ptr<AbstractSetting>> create_statistics_generation_settings();
+
  protected:
   StorageManager() = default;
   friend class Hyrise;
@@ -14,6 +14,7 @@
 #include "statistics/attribute_statistics.hpp"
 #include "statistics/table_statistics.hpp"
 #include "storage/index/adaptive_radix_tree/adaptive_radix_tree_index.hpp"
+#include "storage/index/adaptive_radix_tree/primary_key_index.hpp"
 #include "storage/index/group_key/composite_group_key_index.hpp"
 #include "storage/index/group_key/group_key_index.hpp"
 #include "storage/index/partial_hash/partial_hash_index.hpp"
@@ -271,6 +272,18 @@ void Table::remove_chunk(ChunkID chunk_id) {
               }()),
               "Physical delete of chunk prevented: Chunk needs to be fully invalidated before.");
   Assert(_type == TableType::Data, "Removing chunks from other tables than data tables is not intended yet.");
+
+  {
+    const auto lock = std::unique_lock<std::shared_mutex>{_table_indexes_mutex};
+    for (const auto& table_index : _table_indexes) {
+      table_index->remove({chunk_id});
+    }
+    for (auto& table_index_statistics : _table_indexes_statistics) {
+      std::erase_if(table_index_statistics.chunk_ids,
+                    [&](const auto& indexed_chunk) { return indexed_chunk.first == chunk_id; });
+    }
+  }
+
   std::atomic_store(&_chunks[chunk_id], std::shared_ptr<Chunk>(nullptr));
 }
 
@@ -373,11 +386,19 @@ std::unique_lock<std::mutex> Table::acquire_append_mutex() {
 }
 
 std::shared_ptr<TableStatistics> Table::table_statistics() const {
-  return _table_statistics;
+  return std::atomic_load(&_table_statistics);
 }
 
 void Table::set_table_statistics(const std::shared_ptr<TableStatistics>& table_statistics) {
-  _table_statistics = table_statistics;
+  std::atomic_store(&_table_statistics, table_statistics);
+}
+
+uint64_t Table::modified_row_count() const {
+  return _modified_row_count.load();
+}
+
+void Table::increase_modified_row_count(const uint64_t count) const {
+  _modified_row_count += count;
 }
 
 std::vector<ChunkIndexStatistics> Table::chunk_indexes_statistics() const {
@@ -556,11 +577,36 @@ void Table::set_value_clustered_by(const std::vector<ColumnID>& value_clustered_
   _value_clustered_by = value_clustered_by;
 }
 
+void Table::create_primary_key_index() {
+  Assert(_type == TableType::Data, "Primary key indexes can only be created on data tables.");
+
+  const auto primary_key_constraint =
+      std::find_if(_table_key_constraints.cbegin(), _table_key_constraints.cend(), [](const auto& key_constraint) {
+        return key_constraint.key_type() == KeyConstraintType::PRIMARY_KEY;
+      });
+  Assert(primary_key_constraint != _table_key_constraints.cend(), "Table has no primary key constraint.");
+
+  const auto& columns = primary_key_constraint->columns();
+  const auto primary_key_index =
+      std::make_shared<PrimaryKeyIndex>(*this, std::vector<ColumnID>{columns.cbegin(), columns.cend()});
+
+  const auto lock = std::lock_guard<std::shared_mutex>{_table_indexes_mutex};
+  Assert(!_primary_key_index, "Table already has a primary key index.");
+  _primary_key_index = primary_key_index;
+}
+
+std::shared_ptr<PrimaryKeyIndex> Table::primary_key_index() const {
+  const auto lock = std::shared_lock<std::shared_mutex>{_table_indexes_mutex};
+  return _primary_key_index;
+}
+
 pmr_vector<std::shared_ptr<PartialHashIndex>> Table::get_table_indexes() const {
+  const auto lock = std::shared_lock<std::shared_mutex>{_table_indexes_mutex};
   return _table_indexes;
 }
 
 std::vector<std::shared_ptr<PartialHashIndex>> Table::get_table_indexes(const ColumnID column_id) const {
+  const auto lock = std::shared_lock<std::shared_mutex>{_table_indexes_mutex};
   auto result = std::vector<std::shared_ptr<PartialHashIndex>>();
   std::copy_if(_table_indexes.cbegin(), _table_indexes.cend(), std::back_inserter(result),
                [&](const auto& index) { return index->is_index_for(column_id); });
@@ -608,11 +654,73 @@ void Table::create_partial_hash_index(const ColumnID column_id, const std::vecto
 
   table_index = std::make_shared<PartialHashIndex>(chunks_to_index, column_id);
 
+  const auto lock = std::unique_lock<std::shared_mutex>{_table_indexes_mutex};
   _table_indexes.emplace_back(table_index);
 
   _table_indexes_statistics.emplace_back(TableIndexStatistics{{column_id}, chunks_to_index});
 }
 
+void Table::create_table_index(const ColumnID column_id, const std::string& name) {
+  Assert(_type == TableType::Data, "Table indexes can only be created on data tables.");
+  Assert(column_id < column_count(), "ColumnID out of range.");
+
+  // Hold the lock while collecting the chunks so that chunks completed concurrently are either collected here or added
+  // by add_chunk_to_table_indexes afterwards.
+  const auto lock = std::unique_lock<std::shared_mutex>{_table_indexes_mutex};
+  Assert(name.empty() || std::none_of(_table_indexes_statistics.cbegin(), _table_indexes_statistics.cend(),
+                                      [&](const auto& statistics) { return statistics.name == name; }),
+         "Table index '" + name + "' already exists.");
+
+  auto chunks_to_index = std::vector<std::pair<ChunkID, std::shared_ptr<Chunk>>>{};
+  const auto chunk_count = _chunks.size();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = get_chunk(chunk_id);
+    if (!chunk) {
+      continue;
+    }
+
+    const auto is_complete =
+        !chunk->is_mutable() || (chunk->size() == _target_chunk_size && !chunk->has_pending_inserts());
+    if (is_complete) {
+      chunks_to_index.emplace_back(chunk_id, chunk);
+    }
+  }
+
+  // Unlike the other constructor, this one also works if no chunk is complete yet.
+  const auto table_index = std::make_shared<PartialHashIndex>(column_data_type(column_id), column_id);
+  table_index->insert(chunks_to_index);
+
+  _table_indexes.emplace_back(table_index);
+  _table_indexes_statistics.emplace_back(TableIndexStatistics{{column_id}, chunks_to_index, name});
+}
+
+void Table::add_chunk_to_table_indexes(const ChunkID chunk_id) {
+  const auto lock = std::unique_lock<std::shared_mutex>{_table_indexes_mutex};
+  if (_table_indexes.empty()) {
+    return;
+  }
+
+  // Only stored tables are maintained. Their indexes were created with create_partial_hash_index or
+  // create_table_index, which both add the index statistics as well.
+  DebugAssert(_table_indexes.size() == _table_indexes_statistics.size(), "Expected statistics for each table index.");
+
+  const auto chunk = get_chunk(chunk_id);
+  Assert(chunk, "Cannot index physically deleted chunk.");
+  const auto chunks_to_index = std::vector<std::pair<ChunkID, std::shared_ptr<Chunk>>>{{chunk_id, chunk}};
+
+  const auto table_index_count = _table_indexes.size();
+  for (auto index_id = size_t{0}; index_id < table_index_count; ++index_id) {
+    if (_table_indexes[index_id]->insert(chunks_to_index) > 0) {
+      _table_indexes_statistics[index_id].chunk_ids.emplace_back(chunk_id, chunk);
+    }
+  }
+}
+
+std::vector<TableIndexStatistics> Table::table_indexes_statistics() const {
+  const auto lock = std::shared_lock<std::shared_mutex>{_table_indexes_mutex};
+  return _table_indexes_statistics;
+}
+
 template void Table::create_chunk_index<GroupKeyIndex>(const std::vector<ColumnID>& column_ids,
                                                        const std::string& name);
 template void Table::create_chunk_index<CompositeGroupKeyIndex>(const std::vector<ColumnID>& column_ids,
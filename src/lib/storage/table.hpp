@@ -1,7 +1,9 @@
 #pragma once
 
+#include <atomic>
 #include <memory>
 #include <mutex>
+#include <shared_mutex>
 #include <string>
 #include <utility>
 #include <vector>
@@ -23,6 +25,7 @@
 
 namespace hyrise {
 
+class PrimaryKeyIndex;
 class TableStatistics;
 
 /**
@@ -180,7 +183,8 @@ class Table : private Noncopyable {
 
   /**
    * Tables, typically those stored in the StorageManager, can be associated with statistics to perform Cardinality
-   * estimation during optimization.
+   * estimation during optimization. The statistics can be replaced while queries are optimized concurrently (e.g., by
+   * the StatisticsMaintenancePlugin), so they are accessed atomically.
    * @{
    */
   std::shared_ptr<TableStatistics> table_statistics() const;
@@ -188,6 +192,18 @@ class Table : private Noncopyable {
   void set_table_statistics(const std::shared_ptr<TableStatistics>& table_statistics);
   /** @} */
 
+  /**
+   * The number of rows inserted or deleted by committed transactions since the table was created. The counter never
+   * decreases; consumers (e.g., the StatisticsMaintenancePlugin) track the value at which they last looked at the table
+   * to decide whether its statistics are outdated. (increase_modified_row_count() is marked as const for the same
+   * reason as Chunk::increase_invalid_row_count.)
+   * @{
+   */
+  uint64_t modified_row_count() const;
+
+  void increase_modified_row_count(const uint64_t count) const;
+  /** @} */
+
   std::vector<ChunkIndexStatistics> chunk_indexes_statistics() const;
 
   /**
@@ -196,12 +212,42 @@ class Table : private Noncopyable {
    */
   void create_partial_hash_index(const ColumnID column_id, const std::vector<ChunkID>& chunk_ids);
 
+  /**
+   * Creates a PartialHashIndex named `name` (used by CREATE INDEX) on all chunks of a column whose content does not
+   * change anymore, i.e., chunks that are immutable or full without pending Inserts. As all table indexes, it is
+   * maintained when the table changes: chunks that are completed later are added by the Insert operator (see
+   * add_chunk_to_table_indexes) and physically removed chunks are removed from the index. Rows that are deleted or
+   * updated stay in the index, as they are only invalidated and filtered by the Validate operator. Thus, all rows of
+   * the table are indexed except for those in chunks that still receive Inserts.
+   */
+  void create_table_index(const ColumnID column_id, const std::string& name);
+
+  /**
+   * Adds a chunk whose content does not change anymore (apart from invalidations) to all table indexes. Chunks that
+   * are already indexed are skipped.
+   */
+  void add_chunk_to_table_indexes(const ChunkID chunk_id);
+
+  std::vector<TableIndexStatistics> table_indexes_statistics() const;
+
   template <typename Index>
   void create_chunk_index(const std::vector<ColumnID>& column_ids, const std::string& name = "");
 
   /**
-   * NOTE: constraints are currently NOT ENFORCED and are only used to develop optimization rules.
-   * We call them "soft" constraints to draw attention to that.
+   * Creates a PrimaryKeyIndex on the columns of the table's PRIMARY_KEY constraint. Unlike other indexes, it covers
+   * all chunks, including mutable ones, and the Insert operator adds new rows right away. Inserts of rows whose key is
+   * already held by another row fail, which enforces the constraint. The table must not be modified while the index
+   * is created.
+   */
+  void create_primary_key_index();
+
+  // Returns nullptr if no primary key index was created.
+  std::shared_ptr<PrimaryKeyIndex> primary_key_index() const;
+
+  /**
+   * NOTE: constraints are currently NOT ENFORCED (except for primary keys with a PrimaryKeyIndex, see
+   * create_primary_key_index()) and are only used to develop optimization rules. We call them "soft" constraints to
+   * draw attention to that.
    */
   void add_soft_key_constraint(const TableKeyConstraint& table_key_constraint);
   const TableKeyConstraints& soft_key_constraints() const;
@@ -277,9 +323,16 @@ class Table : private Noncopyable {
   std::vector<ChunkIndexStatistics> _chunk_indexes_statistics;
   std::vector<TableIndexStatistics> _table_indexes_statistics;
   pmr_vector<std::shared_ptr<PartialHashIndex>> _table_indexes;
+  std::shared_ptr<PrimaryKeyIndex> _primary_key_index;
+
+  // Protects _table_indexes, _table_indexes_statistics, and _primary_key_index, which are modified while queries are
+  // executed.
+  mutable std::shared_mutex _table_indexes_mutex;
 
   // For tables with _type==Reference, the row count will not vary. As such, there is no need to iterate over all
   // chunks more than once.
   mutable std::optional<uint64_t> _cached_row_count;
+
+  mutable std::atomic<uint64_t> _modified_row_count{0};
 };
 }  // namespace hyrise
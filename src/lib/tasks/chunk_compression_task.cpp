@@ -16,46 +16,42 @@ namespace hyrise {
 ChunkCompressionTask::ChunkCompressionTask(const std::string& table_name, const ChunkID chunk_id)
     : ChunkCompressionTask{table_name, std::vector<ChunkID>{chunk_id}} {}
 
-ChunkCompressionTask::ChunkCompressionTask(const std::string& table_name, const std::vector<ChunkID>& chunk_ids)
-    : _table_name{table_name}, _chunk_ids{chunk_ids} {}
+ChunkCompressionTask::ChunkCompressionTask(const std::string& table_name, const std::vector<ChunkID>& chunk_ids,
+                                           const std::optional<ChunkEncodingSpec>& chunk_encoding_spec)
+    : _table_name{table_name}, _chunk_ids{chunk_ids}, _chunk_encoding_spec{chunk_encoding_spec} {}
 
 void ChunkCompressionTask::_on_execute() {
   auto table = Hyrise::get().storage_manager.get_table(_table_name);
 
   Assert(table, "Table does not exist.");
 
+  const auto chunk_encoding_spec =
+      _chunk_encoding_spec ? *_chunk_encoding_spec : ChunkEncodingSpec{table->column_count(), SegmentEncodingSpec{}};
+  Assert(chunk_encoding_spec.size() == table->column_count(), "Encoding spec does not match the table's columns.");
+
   for (auto chunk_id : _chunk_ids) {
     Assert(chunk_id < table->chunk_count(), "Chunk with given ID does not exist.");
     const auto chunk = table->get_chunk(chunk_id);
     Assert(chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
 
-    // TODO(anyone): It is unclear if this restriction is really necessary. If it becomes a problem and we decide to
-    // get rid of it, we should make sure that a new mutable chunk is created first so that inserts do not end up in
-    // the chunk being compressed.
-    DebugAssert(_chunk_is_completed(chunk, table->target_chunk_size()),
-                "Chunk is not completed and thus can’t be compressed.");
+    if (chunk->is_mutable()) {
+      // Hold the append mutex so that no Insert allocates rows in the chunk while we finalize it.
+      const auto append_lock = table->acquire_append_mutex();
+      Assert(chunk_is_completed(chunk, table->target_chunk_size()),
+             "Chunk is not completed and thus can’t be compressed.");
+      chunk->finalize();
+    }
 
-    ChunkEncoder::encode_chunk(chunk, table->column_data_types());
+    ChunkEncoder::encode_chunk(chunk, table->column_data_types(), chunk_encoding_spec);
   }
 }
 
-bool ChunkCompressionTask::_chunk_is_completed(const std::shared_ptr<Chunk>& chunk, const uint32_t target_chunk_size) {
-  if (chunk->size() != target_chunk_size) {
-    return false;
-  }
-
-  const auto& mvcc_data = chunk->mvcc_data();
-
-  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < target_chunk_size; ++chunk_offset) {
-    // TODO(anybody) Reading the non-atomic begin_cid (which is written to in Insert without a write lock) is likely UB
-    //               When activating the ChunkCompressionTask, please look for a different means of determining whether
-    //               all Inserts to a Chunk finished.
-    if (mvcc_data->get_begin_cid(chunk_offset) == MvccData::MAX_COMMIT_ID) {
-      return false;
-    }
-  }
-
-  return true;
+bool ChunkCompressionTask::chunk_is_completed(const std::shared_ptr<Chunk>& chunk,
+                                              const ChunkOffset target_chunk_size) {
+  // Inserts allocate the rows of a full chunk before they write them. Thus, a full chunk does not get new rows, and
+  // once the Inserts that allocated its rows committed or rolled back, the chunk does not change anymore (except for
+  // the MVCC data of deletes).
+  return chunk->size() == target_chunk_size && !chunk->has_pending_inserts();
 }
 
 }  // namespace hyrise
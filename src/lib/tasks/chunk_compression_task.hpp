@@ -1,31 +1,31 @@
 #pragma once
 
+#include <optional>
 #include <string>
 #include <vector>
 
 #include "scheduler/abstract_task.hpp"
+#include "storage/encoding_type.hpp"
 
 namespace hyrise {
 
 class Chunk;
 
 /**
- * @brief Compresses a chunk of a table using the default encoding
+ * @brief Compresses chunks of a table
  *
- * The task compresses a chunk by sequentially compressing segments.
- * From each value segment, a dictionary segment is created that replaces the
- * uncompressed segment. The exchange is done atomically. Since this can
- * happen during simultaneous access by transactions, operators need to be
- * designed such that they are aware that segment types might change from
- * ValueSegment<T> to DictionarySegment<T> during execution. Shared pointers
- * ensure that existing value segments remain valid.
+ * The task compresses a chunk by sequentially compressing segments. Each segment is encoded according to the passed
+ * ChunkEncodingSpec (dictionary encoding by default) and atomically replaces the current segment. Since this can
+ * happen during simultaneous access by transactions, operators need to be designed such that they are aware that
+ * segment types might change from ValueSegment<T> to DictionarySegment<T> during execution. Shared pointers ensure
+ * that existing value segments remain valid for the readers that hold them.
  *
- * Exchanging segments does not interfere with the Delete operator because
- * it does not touch the segments. However, inserting records while simultaneously
- * compressing the chunk leads to inconsistent state. Therefore only chunks where
- * all insertion has been completed may be compressed. In other words, they need to be
- * full and all of their end-cids must be smaller than infinity. This task calls
- * those chunks “completed”.
+ * Exchanging segments does not interfere with the Delete operator because it does not touch the segments. However,
+ * inserting records while simultaneously compressing the chunk leads to inconsistent state. Therefore, only immutable
+ * chunks and chunks that are “completed” may be compressed. A chunk is completed if it is full and no Insert operator
+ * that allocated rows in it is still pending (see Chunk::has_pending_inserts()). The task finalizes completed chunks
+ * before it compresses them. The ChunkCompressionPlugin uses this task to encode chunks filled by inserts in the
+ * background.
  *
  * Note: Reference segments are not invalidated by this task because the order in which
  *       records are stored does not change.
@@ -33,21 +33,23 @@ class Chunk;
 class ChunkCompressionTask : public AbstractTask {
  public:
   explicit ChunkCompressionTask(const std::string& table_name, const ChunkID chunk_id);
-  explicit ChunkCompressionTask(const std::string& table_name, const std::vector<ChunkID>& chunk_ids);
+  explicit ChunkCompressionTask(const std::string& table_name, const std::vector<ChunkID>& chunk_ids,
+                                const std::optional<ChunkEncodingSpec>& chunk_encoding_spec = std::nullopt);
 
- protected:
-  void _on_execute() override;
-
- private:
   /**
-   * @brief Checks if a chunks is completed
+   * @brief Checks if a chunk is completed
    *
-   * See class comment for further explanation
+   * See class comment for further explanation. Must be called while holding the table's append mutex, as Insert
+   * operators allocate rows under that mutex.
    */
-  static bool _chunk_is_completed(const std::shared_ptr<Chunk>& chunk, const uint32_t target_chunk_size);
+  static bool chunk_is_completed(const std::shared_ptr<Chunk>& chunk, const ChunkOffset target_chunk_size);
+
+ protected:
+  void _on_execute() override;
 
  private:
   const std::string _table_name;
   const std::vector<ChunkID> _chunk_ids;
+  const std::optional<ChunkEncodingSpec> _chunk_encoding_spec;
 };
 }  // namespace hyrise
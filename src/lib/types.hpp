@@ -222,6 +222,9 @@ bool is_semi_or_anti_join(const JoinMode join_mode);
 // see union_positions.hpp for details.
 enum class SetOperationMode { Unique, All, Positions };
 
+// The set operations that compare rows by their values (see SetOperationHash).
+enum class SetOperationType { Union, Intersect, Except };
+
 // According to the SQL standard, the position of NULLs is implementation-defined. In Hyrise, NULLs come before all
 // values, both for ascending and descending sorts. See sort.cpp for details.
 enum class SortMode { Ascending, Descending };
@@ -1,18 +1,26 @@
 #pragma once
 
+#include <optional>
 #include <set>
 
 #include <boost/functional/hash.hpp>
 
+#include "all_type_variant.hpp"
 #include "types.hpp"
 
 namespace hyrise {
 
+class BaseAttributeStatistics;
 class StoredTableNode;
 class TableStatistics;
 struct OperatorScanPredicate;
 class PredicateNode;
 
+// Checks whether any of the statistics objects available for a segment identify the predicate as prunable, i.e., show
+// that no value of the segment satisfies it.
+bool can_prune(const BaseAttributeStatistics& base_segment_statistics, const PredicateCondition predicate_condition,
+               const AllTypeVariant& variant_value, const std::optional<AllTypeVariant>& variant_value2);
+
 using PredicatePruningChain = std::vector<std::shared_ptr<PredicateNode>>;
 
 using StoredTableNodePredicateNodePair = std::pair<std::shared_ptr<StoredTableNode>, std::shared_ptr<PredicateNode>>;
@@ -6,6 +6,7 @@
 #include "utils/meta_tables/meta_exec_table.hpp"
 #include "utils/meta_tables/meta_log_table.hpp"
 #include "utils/meta_tables/meta_plugins_table.hpp"
+#include "utils/meta_tables/meta_queries_table.hpp"
 #include "utils/meta_tables/meta_segments_accurate_table.hpp"
 #include "utils/meta_tables/meta_segments_table.hpp"
 #include "utils/meta_tables/meta_settings_table.hpp"
@@ -41,6 +42,7 @@ MetaTableManager::MetaTableManager() {
                                                                        std::make_shared<MetaSegmentsTable>(),
                                                                        std::make_shared<MetaSegmentsAccurateTable>(),
                                                                        std::make_shared<MetaPluginsTable>(),
+                                                                       std::make_shared<MetaQueriesTable>(),
                                                                        std::make_shared<MetaSettingsTable>(),
                                                                        std::make_shared<MetaSystemInformationTable>(),
                                                                        std::make_shared<MetaSystemUtilizationTable>()};
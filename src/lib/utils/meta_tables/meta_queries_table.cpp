@@ -0,0 +1,38 @@
+#include "meta_queries_table.hpp"
+
+#include "magic_enum.hpp"
+
+#include "hyrise.hpp"
+#include "scheduler/query_task_group.hpp"
+
+namespace hyrise {
+
+MetaQueriesTable::MetaQueriesTable()
+    : AbstractMetaTable(TableColumnDefinitions{{"query_id", DataType::Long, false},
+                                               {"state", DataType::String, false},
+                                               {"weight", DataType::Int, false},
+                                               {"scheduled_tasks", DataType::Long, false},
+                                               {"finished_tasks", DataType::Long, false},
+                                               {"sql", DataType::String, false}}) {}
+
+const std::string& MetaQueriesTable::name() const {
+  static const auto name = std::string{"queries"};
+  return name;
+}
+
+std::shared_ptr<Table> MetaQueriesTable::_on_generate() const {
+  auto output_table = std::make_shared<Table>(_column_definitions, TableType::Data, std::nullopt, UseMvcc::Yes);
+
+  for (const auto& query_task_group : Hyrise::get().admission_control.query_task_groups()) {
+    output_table->append({static_cast<int64_t>(query_task_group->id()),
+                          pmr_string{magic_enum::enum_name(query_task_group->state())},
+                          static_cast<int32_t>(query_task_group->weight()),
+                          static_cast<int64_t>(query_task_group->scheduled_task_count()),
+                          static_cast<int64_t>(query_task_group->finished_task_count()),
+                          pmr_string{query_task_group->description()}});
+  }
+
+  return output_table;
+}
+
+}  // namespace hyrise
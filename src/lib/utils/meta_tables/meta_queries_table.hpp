@@ -0,0 +1,22 @@
+#pragma once
+
+#include "utils/meta_tables/abstract_meta_table.hpp"
+
+namespace hyrise {
+
+/**
+ * This is a class for showing the queries that are running or waiting to be admitted by the AdmissionControl,
+ * including their scheduling weight and the number of scheduled and finished tasks.
+ */
+class MetaQueriesTable : public AbstractMetaTable {
+ public:
+  MetaQueriesTable();
+
+  const std::string& name() const final;
+
+ protected:
+  friend class MetaQueriesTest;
+  std::shared_ptr<Table> _on_generate() const final;
+};
+
+}  // namespace hyrise
@@ -0,0 +1,123 @@
+#include "chunk_compression_plugin.hpp"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "benchmark_table_encoder.hpp"
+#include "hyrise.hpp"
+#include "magic_enum.hpp"
+#include "statistics/generate_pruning_statistics.hpp"
+#include "storage/chunk.hpp"
+#include "storage/table.hpp"
+#include "tasks/chunk_compression_task.hpp"
+#include "utils/assert.hpp"
+
+namespace hyrise {
+
+std::string ChunkCompressionPlugin::description() const {
+  return "Background chunk compression plugin";
+}
+
+void ChunkCompressionPlugin::start() {
+  _encoding_setting = std::make_shared<EncodingSetting>(*this);
+  _encoding_setting->register_at_settings_manager();
+
+  _compressed_chunk_count = 0;
+  _loop_thread_compression = std::make_unique<PausableLoopThread>(IDLE_DELAY_COMPRESSION,
+                                                                  [&](size_t /*unused*/) { _compress_loop(); });
+}
+
+void ChunkCompressionPlugin::stop() {
+  // Call destructor of PausableLoopThread to terminate its thread
+  _loop_thread_compression.reset();
+
+  _encoding_setting->unregister_at_settings_manager();
+  _encoding_setting.reset();
+}
+
+void ChunkCompressionPlugin::set_encoding_config(const EncodingConfig& encoding_config) {
+  const auto lock = std::lock_guard<std::mutex>{_encoding_config_mutex};
+  _encoding_config = encoding_config;
+}
+
+EncodingConfig ChunkCompressionPlugin::encoding_config() const {
+  const auto lock = std::lock_guard<std::mutex>{_encoding_config_mutex};
+  return _encoding_config;
+}
+
+size_t ChunkCompressionPlugin::compressed_chunk_count() const {
+  return _compressed_chunk_count;
+}
+
+/**
+ * This function collects the completed mutable chunks of every table and compresses them using a ChunkCompressionTask.
+ */
+void ChunkCompressionPlugin::_compress_loop() {
+  const auto current_encoding_config = encoding_config();
+  const auto tables = Hyrise::get().storage_manager.tables();
+
+  for (const auto& [table_name, table] : tables) {
+    if (table->type() != TableType::Data || table->uses_mvcc() != UseMvcc::Yes) {
+      continue;
+    }
+
+    auto chunk_ids = std::vector<ChunkID>{};
+    {
+      // Inserts allocate rows while holding the append mutex. Once a chunk is completed, it stays completed.
+      const auto append_lock = table->acquire_append_mutex();
+      const auto chunk_count = table->chunk_count();
+      for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+        const auto chunk = table->get_chunk(chunk_id);
+        if (chunk && chunk->is_mutable() && !chunk->get_cleanup_commit_id() &&
+            ChunkCompressionTask::chunk_is_completed(chunk, table->target_chunk_size())) {
+          chunk_ids.emplace_back(chunk_id);
+        }
+      }
+    }
+
+    if (chunk_ids.empty()) {
+      continue;
+    }
+
+    const auto chunk_encoding_spec =
+        BenchmarkTableEncoder::chunk_encoding_spec(table_name, table, current_encoding_config);
+    const auto compression_task = std::make_shared<ChunkCompressionTask>(table_name, chunk_ids, chunk_encoding_spec);
+    Hyrise::get().scheduler()->schedule_and_wait_for_tasks({compression_task});
+
+    for (const auto chunk_id : chunk_ids) {
+      const auto chunk = table->get_chunk(chunk_id);
+      if (chunk) {
+        generate_chunk_pruning_statistics(chunk);
+      }
+    }
+
+    _compressed_chunk_count += chunk_ids.size();
+  }
+}
+
+ChunkCompressionPlugin::EncodingSetting::EncodingSetting(ChunkCompressionPlugin& plugin)
+    : AbstractSetting("ChunkCompressionPlugin.encoding"), _plugin(plugin) {}
+
+const std::string& ChunkCompressionPlugin::EncodingSetting::description() const {
+  static const auto description =
+      std::string{"Default encoding of chunks compressed in the background (e.g., Dictionary, LZ4, Unencoded)"};
+  return description;
+}
+
+const std::string& ChunkCompressionPlugin::EncodingSetting::get() {
+  _value = std::string{magic_enum::enum_name(_plugin.encoding_config().default_encoding_spec.encoding_type)};
+  return _value;
+}
+
+void ChunkCompressionPlugin::EncodingSetting::set(const std::string& value) {
+  const auto encoding_type = magic_enum::enum_cast<EncodingType>(value);
+  AssertInput(encoding_type, "Invalid encoding type for " + name + ": '" + value + "'.");
+  auto encoding_config = _plugin.encoding_config();
+  encoding_config.default_encoding_spec = SegmentEncodingSpec{*encoding_type};
+  _plugin.set_encoding_config(encoding_config);
+}
+
+EXPORT_PLUGIN(ChunkCompressionPlugin);
+
+}  // namespace hyrise
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include "encoding_config.hpp"
+#include "utils/abstract_plugin.hpp"
+#include "utils/pausable_loop_thread.hpp"
+#include "utils/settings/abstract_setting.hpp"
+
+namespace hyrise {
+
+/*
+ * Tables that grow through Insert operators consist of mutable chunks with unencoded ValueSegments. Only the last
+ * chunk of a table receives new rows, but all previous chunks stay mutable and unencoded, which wastes memory and
+ * slows down scans. This plugin periodically looks for chunks that are full and have no pending Insert operators
+ * anymore (see ChunkCompressionTask::chunk_is_completed). It finalizes them and encodes their segments in the
+ * background using a ChunkCompressionTask. The encoding is derived from an EncodingConfig in the same way as in the
+ * benchmarks (see BenchmarkTableEncoder). By default, all columns are dictionary-encoded. The default encoding can be
+ * changed via the "ChunkCompressionPlugin.encoding" setting.
+ *
+ * Encoded segments replace the ValueSegments atomically. Operators that still hold the old segments keep them alive
+ * until they are done.
+ */
+class ChunkCompressionPlugin : public AbstractPlugin {
+  friend class ChunkCompressionPluginTest;
+
+ public:
+  std::string description() const final;
+
+  void start() final;
+
+  void stop() final;
+
+  void set_encoding_config(const EncodingConfig& encoding_config);
+  EncodingConfig encoding_config() const;
+
+  // Number of chunks encoded since the plugin was started.
+  size_t compressed_chunk_count() const;
+
+  constexpr static std::chrono::milliseconds IDLE_DELAY_COMPRESSION = std::chrono::milliseconds(1000);
+
+ private:
+  class EncodingSetting : public AbstractSetting {
+   public:
+    explicit EncodingSetting(ChunkCompressionPlugin& plugin);
+
+    const std::string& description() const final;
+
+    const std::string& get() final;
+
+    void set(const std::string& value) final;
+
+   private:
+    ChunkCompressionPlugin& _plugin;
+    std::string _value;
+  };
+
+  void _compress_loop();
+
+  std::unique_ptr<PausableLoopThread> _loop_thread_compression;
+  std::shared_ptr<EncodingSetting> _encoding_setting;
+
+  mutable std::mutex _encoding_config_mutex;
+  EncodingConfig _encoding_config;
+
+  std::atomic<size_t> _compressed_chunk_count{0};
+};
+
+}  // namespace hyrise
@@ -0,0 +1,536 @@
+#include "encoding_advisor_plugin.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <queue>
+#include <sstream>
+#include <tuple>
+#include <unordered_map>
+
+#include "hyrise.hpp"
+#include "resolve_type.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/frame_of_reference_segment.hpp"
+#include "storage/pos_lists/row_id_pos_list.hpp"
+#include "storage/segment_encoding_utils.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace hyrise;  // NOLINT
+
+using AccessType = SegmentAccessCounter::AccessType;
+
+/**
+ * Estimated cost of accessing a single value, relative to sequentially reading a value from an unencoded segment.
+ * The factors are rough estimates that only need to rank the encodings correctly: Sequential accesses to compressed
+ * vectors and dictionaries are slightly more expensive than reading plain values, run-length encoding only touches
+ * each run once, and LZ4 has to decompress whole blocks, which makes random accesses particularly expensive.
+ */
+double access_cost(const SegmentEncodingSpec& encoding_spec, const AccessType access_type,
+                   const SegmentCharacteristics& characteristics) {
+  const auto random_access = access_type == AccessType::Point || access_type == AccessType::Random;
+
+  auto cost = 1.0;
+  switch (encoding_spec.encoding_type) {
+    case EncodingType::Unencoded:
+      cost = random_access ? 2.0 : 1.0;
+      break;
+    case EncodingType::Dictionary:
+      cost = random_access ? 2.5 : 1.1;
+      break;
+    case EncodingType::FixedStringDictionary:
+      cost = random_access ? 3.0 : 1.4;
+      break;
+    case EncodingType::FrameOfReference:
+      cost = random_access ? 2.5 : 1.3;
+      break;
+    case EncodingType::RunLength: {
+      const auto run_count = static_cast<double>(std::max(characteristics.run_count, size_t{1}));
+      // Random accesses search the run, sequential accesses process each run once.
+      cost = random_access ? 2.0 + 0.25 * std::log2(run_count)
+                           : 0.2 + run_count / std::max(static_cast<double>(characteristics.row_count), 1.0);
+      break;
+    }
+    case EncodingType::LZ4:
+      cost = random_access ? 40.0 : 3.0;
+      break;
+  }
+
+  if (encoding_spec.vector_compression_type == VectorCompressionType::BitPacking) {
+    cost *= 1.3;
+  }
+
+  return cost;
+}
+
+// Size of a single value in a compressed vector whose largest value is max_value (see compress_vector()).
+double compressed_value_size(const uint64_t max_value, const VectorCompressionType vector_compression_type) {
+  if (vector_compression_type == VectorCompressionType::BitPacking) {
+    return static_cast<double>(std::max(static_cast<uint64_t>(std::bit_width(max_value)), uint64_t{1})) / 8.0;
+  }
+
+  if (max_value <= std::numeric_limits<uint8_t>::max()) {
+    return 1.0;
+  }
+
+  if (max_value <= std::numeric_limits<uint16_t>::max()) {
+    return 2.0;
+  }
+
+  return 4.0;
+}
+
+size_t estimate_memory_usage(const SegmentEncodingSpec& encoding_spec, const SegmentCharacteristics& characteristics) {
+  const auto row_count = static_cast<double>(characteristics.row_count);
+  const auto distinct_value_count = static_cast<double>(characteristics.distinct_value_count);
+  const auto run_count = static_cast<double>(characteristics.run_count);
+  const auto null_value_bytes = characteristics.null_value_count > 0 ? row_count / 8.0 : 0.0;
+
+  auto value_size = 0.0;
+  resolve_data_type(characteristics.data_type, [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+    value_size = static_cast<double>(sizeof(ColumnDataType));
+    if constexpr (std::is_same_v<ColumnDataType, pmr_string>) {
+      value_size += characteristics.average_string_length;
+    }
+  });
+
+  auto memory_usage = 0.0;
+  switch (encoding_spec.encoding_type) {
+    case EncodingType::Unencoded:
+      memory_usage = row_count * value_size + null_value_bytes;
+      break;
+    case EncodingType::Dictionary:
+      // The largest value ID (i.e., the number of distinct values) represents NULL.
+      memory_usage = distinct_value_count * value_size +
+                     row_count * compressed_value_size(characteristics.distinct_value_count,
+                                                       *encoding_spec.vector_compression_type);
+      break;
+    case EncodingType::FixedStringDictionary:
+      memory_usage = distinct_value_count * static_cast<double>(characteristics.max_string_length) +
+                     row_count * compressed_value_size(characteristics.distinct_value_count,
+                                                       *encoding_spec.vector_compression_type);
+      break;
+    case EncodingType::FrameOfReference: {
+      // We only know the value range of the whole segment, which is an upper bound for the range of each block.
+      const auto block_count = std::ceil(row_count / FrameOfReferenceSegment<int32_t>::block_size);
+      memory_usage = row_count * compressed_value_size(characteristics.value_range.value_or(0),
+                                                       *encoding_spec.vector_compression_type) +
+                     block_count * sizeof(int32_t) + null_value_bytes;
+      break;
+    }
+    case EncodingType::RunLength:
+      // Each run stores its value, its end position, and whether it is NULL.
+      memory_usage = run_count * (value_size + sizeof(ChunkOffset) + 1.0 / 8.0);
+      break;
+    case EncodingType::LZ4:
+      memory_usage = static_cast<double>(characteristics.lz4_memory_usage);
+      break;
+  }
+
+  return static_cast<size_t>(std::ceil(memory_usage));
+}
+
+template <typename ColumnDataType>
+SegmentCharacteristics sample_segment(const AbstractSegment& segment) {
+  auto characteristics = SegmentCharacteristics{};
+  characteristics.data_type = segment.data_type();
+  characteristics.row_count = segment.size();
+
+  const auto row_count = static_cast<size_t>(segment.size());
+  if (row_count == 0) {
+    return characteristics;
+  }
+
+  // Sample contiguous blocks that are evenly spread over the segment. Small segments are read completely.
+  constexpr auto SAMPLE_BLOCK_COUNT = EncodingAdvisorPlugin::SAMPLE_BLOCK_COUNT;
+  constexpr auto SAMPLE_BLOCK_SIZE = EncodingAdvisorPlugin::SAMPLE_BLOCK_SIZE;
+  auto block_count = size_t{1};
+  auto block_size = row_count;
+  if (row_count > SAMPLE_BLOCK_COUNT * SAMPLE_BLOCK_SIZE) {
+    block_count = SAMPLE_BLOCK_COUNT;
+    block_size = SAMPLE_BLOCK_SIZE;
+  }
+
+  const auto positions = std::make_shared<RowIDPosList>();
+  positions->reserve(block_count * block_size);
+  for (auto block_id = size_t{0}; block_id < block_count; ++block_id) {
+    const auto block_begin = block_count == 1 ? 0 : block_id * (row_count - block_size) / (block_count - 1);
+    for (auto chunk_offset = block_begin; chunk_offset < block_begin + block_size; ++chunk_offset) {
+      positions->emplace_back(ChunkID{0}, ChunkOffset{static_cast<ChunkOffset::base_type>(chunk_offset)});
+    }
+  }
+  positions->guarantee_single_chunk();
+
+  auto values = pmr_vector<ColumnDataType>{};
+  auto null_values = pmr_vector<bool>{};
+  values.reserve(positions->size());
+  null_values.reserve(positions->size());
+  segment_iterate_filtered<ColumnDataType>(segment, positions, [&](const auto& position) {
+    values.emplace_back(position.is_null() ? ColumnDataType{} : position.value());
+    null_values.emplace_back(position.is_null());
+  });
+
+  const auto sample_size = values.size();
+  auto value_frequencies = std::unordered_map<ColumnDataType, size_t>{};
+  auto value_changes = size_t{0};
+  auto string_length_sum = size_t{0};
+  auto min_value = std::optional<ColumnDataType>{};
+  auto max_value = std::optional<ColumnDataType>{};
+
+  for (auto index = size_t{0}; index < sample_size; ++index) {
+    // Runs are only counted within a block, as the blocks are not adjacent.
+    if (index % block_size != 0 &&
+        (null_values[index] != null_values[index - 1] || (!null_values[index] && values[index] != values[index - 1]))) {
+      ++value_changes;
+    }
+
+    if (null_values[index]) {
+      ++characteristics.null_value_count;
+      continue;
+    }
+
+    const auto& value = values[index];
+    ++value_frequencies[value];
+    if (!min_value || value < *min_value) {
+      min_value = value;
+    }
+    if (!max_value || value > *max_value) {
+      max_value = value;
+    }
+
+    if constexpr (std::is_same_v<ColumnDataType, pmr_string>) {
+      string_length_sum += value.size();
+      characteristics.max_string_length = std::max(characteristics.max_string_length, value.size());
+    }
+  }
+
+  const auto non_null_sample_size = sample_size - characteristics.null_value_count;
+  const auto scale = static_cast<double>(row_count) / static_cast<double>(sample_size);
+  characteristics.null_value_count = static_cast<size_t>(std::round(characteristics.null_value_count * scale));
+
+  // The GEE estimator [1] scales the number of values that occur once in the sample, as these represent the values
+  // that were not sampled. It is exact if the whole segment was sampled.
+  // [1] Charikar et al. Towards Estimation Error Guarantees for Distinct Values. PODS 2000.
+  auto singleton_count = size_t{0};
+  for (const auto& [_, frequency] : value_frequencies) {
+    singleton_count += frequency == 1 ? 1 : 0;
+  }
+  const auto distinct_value_count = std::sqrt(scale) * static_cast<double>(singleton_count) +
+                                    static_cast<double>(value_frequencies.size() - singleton_count);
+  characteristics.distinct_value_count = std::min(static_cast<size_t>(std::round(distinct_value_count)), row_count);
+
+  // Extrapolate the share of positions at which the value changes.
+  const auto comparison_count = sample_size - block_count;
+  const auto change_ratio =
+      comparison_count == 0 ? 0.0 : static_cast<double>(value_changes) / static_cast<double>(comparison_count);
+  characteristics.run_count = 1 + static_cast<size_t>(std::round(change_ratio * static_cast<double>(row_count - 1)));
+
+  if constexpr (std::is_integral_v<ColumnDataType>) {
+    if (min_value) {
+      characteristics.value_range = static_cast<uint64_t>(static_cast<int64_t>(*max_value)) -
+                                    static_cast<uint64_t>(static_cast<int64_t>(*min_value));
+    }
+  }
+
+  if constexpr (std::is_same_v<ColumnDataType, pmr_string>) {
+    if (non_null_sample_size > 0) {
+      characteristics.average_string_length =
+          static_cast<double>(string_length_sum) / static_cast<double>(non_null_sample_size);
+    }
+  }
+
+  const auto sample_segment = characteristics.null_value_count > 0
+                                  ? std::make_shared<ValueSegment<ColumnDataType>>(std::move(values),
+                                                                                   std::move(null_values))
+                                  : std::make_shared<ValueSegment<ColumnDataType>>(std::move(values));
+  const auto lz4_segment =
+      ChunkEncoder::encode_segment(sample_segment, characteristics.data_type, SegmentEncodingSpec{EncodingType::LZ4});
+  characteristics.lz4_memory_usage =
+      static_cast<size_t>(std::ceil(static_cast<double>(lz4_segment->memory_usage(MemoryUsageCalculationMode::Full)) *
+                                    scale));
+
+  return characteristics;
+}
+
+// In contrast to the ChunkEncoder, the vector compression type is ignored if the spec does not define it.
+bool encoding_spec_satisfied(const SegmentEncodingSpec& expected_spec, const SegmentEncodingSpec& actual_spec) {
+  return expected_spec.encoding_type == actual_spec.encoding_type &&
+         (!expected_spec.vector_compression_type ||
+          expected_spec.vector_compression_type == actual_spec.vector_compression_type);
+}
+
+struct SegmentLocation {
+  std::shared_ptr<Chunk> chunk;
+  ColumnID column_id;
+  std::shared_ptr<AbstractSegment> segment;
+};
+
+}  // namespace
+
+namespace hyrise {
+
+std::string EncodingAdvisorPlugin::description() const {
+  return "Workload-driven encoding advisor plugin";
+}
+
+void EncodingAdvisorPlugin::start() {
+  _memory_budget_setting = std::make_shared<MemoryBudgetSetting>(*this);
+  _memory_budget_setting->register_at_settings_manager();
+
+  _loop_thread_encoding_advisor = std::make_unique<PausableLoopThread>(
+      IDLE_DELAY_ENCODING_ADVISOR, [&](size_t /*unused*/) { _advise_and_encode(); });
+}
+
+void EncodingAdvisorPlugin::stop() {
+  // Call destructor of PausableLoopThread to terminate its thread
+  _loop_thread_encoding_advisor.reset();
+
+  _memory_budget_setting->unregister_at_settings_manager();
+  _memory_budget_setting.reset();
+}
+
+std::vector<std::pair<PluginFunctionName, PluginFunctionPointer>>
+EncodingAdvisorPlugin::provided_user_executable_functions() {
+  return {{"AdviseEncodings", [&]() { _advise_and_encode(); }}};
+}
+
+void EncodingAdvisorPlugin::set_memory_budget(const size_t memory_budget) {
+  _memory_budget = memory_budget;
+}
+
+size_t EncodingAdvisorPlugin::memory_budget() const {
+  return _memory_budget;
+}
+
+SegmentCharacteristics EncodingAdvisorPlugin::_sample_segment(const std::shared_ptr<const AbstractSegment>& segment) {
+  // Only the sampled positions are read from the segment. As the sampling is not part of the workload, the accesses it
+  // adds to the access counters are removed afterwards. Accesses of concurrent queries during the sampling are removed
+  // as well, which is negligible.
+  const auto access_counter_before_sampling = SegmentAccessCounter{segment->access_counter};
+
+  auto characteristics = SegmentCharacteristics{};
+  resolve_data_type(segment->data_type(), [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+    characteristics = sample_segment<ColumnDataType>(*segment);
+  });
+
+  for (const auto& [access_type, _] : SegmentAccessCounter::access_type_string_mapping) {
+    segment->access_counter[access_type] -=
+        segment->access_counter[access_type] - access_counter_before_sampling[access_type];
+  }
+  return characteristics;
+}
+
+std::vector<EncodingCandidate> EncodingAdvisorPlugin::_encoding_candidates(
+    const SegmentCharacteristics& characteristics, const SegmentAccessCounter& access_counter) {
+  auto encoding_specs = std::vector<SegmentEncodingSpec>{};
+  for (const auto encoding_type : encoding_types) {
+    if (!encoding_supports_data_type(encoding_type, characteristics.data_type)) {
+      continue;
+    }
+
+    if (encoding_type == EncodingType::Dictionary || encoding_type == EncodingType::FixedStringDictionary ||
+        encoding_type == EncodingType::FrameOfReference) {
+      for (const auto vector_compression_type : magic_enum::enum_values<VectorCompressionType>()) {
+        encoding_specs.emplace_back(encoding_type, vector_compression_type);
+      }
+    } else {
+      encoding_specs.emplace_back(encoding_type);
+    }
+  }
+
+  auto candidates = std::vector<EncodingCandidate>{};
+  candidates.reserve(encoding_specs.size());
+  for (const auto& encoding_spec : encoding_specs) {
+    auto scan_cost = 0.0;
+    for (const auto access_type :
+         {AccessType::Point, AccessType::Sequential, AccessType::Monotonic, AccessType::Random}) {
+      scan_cost += static_cast<double>(access_counter[access_type]) *
+                   access_cost(encoding_spec, access_type, characteristics);
+    }
+    candidates.emplace_back(
+        EncodingCandidate{encoding_spec, estimate_memory_usage(encoding_spec, characteristics), scan_cost});
+  }
+  return candidates;
+}
+
+std::vector<size_t> EncodingAdvisorPlugin::_select_encodings(
+    const std::vector<std::vector<EncodingCandidate>>& segment_candidates, const size_t memory_budget) {
+  const auto segment_count = segment_candidates.size();
+  auto selection = std::vector<size_t>(segment_count);
+  auto memory_usage = size_t{0};
+
+  // Start with the cheapest candidate of each segment. Among equally expensive ones (e.g., for segments that have not
+  // been accessed yet), prefer the smallest one.
+  for (auto segment_id = size_t{0}; segment_id < segment_count; ++segment_id) {
+    const auto& candidates = segment_candidates[segment_id];
+    Assert(!candidates.empty(), "Expected at least one encoding candidate per segment.");
+    const auto cheapest_candidate = std::min_element(candidates.cbegin(), candidates.cend(), [](const auto& lhs,
+                                                                                               const auto& rhs) {
+      return std::tie(lhs.estimated_scan_cost, lhs.estimated_memory_usage) <
+             std::tie(rhs.estimated_scan_cost, rhs.estimated_memory_usage);
+    });
+    selection[segment_id] = std::distance(candidates.cbegin(), cheapest_candidate);
+    memory_usage += cheapest_candidate->estimated_memory_usage;
+  }
+
+  // A downgrade switches a segment from its selected candidate to a smaller one. We always apply the downgrade with
+  // the lowest additional scan cost per saved byte.
+  struct Downgrade {
+    double cost_per_saved_byte;
+    size_t segment_id;
+    size_t from_candidate_id;
+    size_t to_candidate_id;
+
+    bool operator>(const Downgrade& other) const {
+      return cost_per_saved_byte > other.cost_per_saved_byte;
+    }
+  };
+
+  const auto best_downgrade = [&](const size_t segment_id) -> std::optional<Downgrade> {
+    const auto& candidates = segment_candidates[segment_id];
+    const auto& selected_candidate = candidates[selection[segment_id]];
+    auto downgrade = std::optional<Downgrade>{};
+    for (auto candidate_id = size_t{0}; candidate_id < candidates.size(); ++candidate_id) {
+      const auto& candidate = candidates[candidate_id];
+      if (candidate.estimated_memory_usage >= selected_candidate.estimated_memory_usage) {
+        continue;
+      }
+
+      const auto cost_per_saved_byte =
+          (candidate.estimated_scan_cost - selected_candidate.estimated_scan_cost) /
+          static_cast<double>(selected_candidate.estimated_memory_usage - candidate.estimated_memory_usage);
+      if (!downgrade || cost_per_saved_byte < downgrade->cost_per_saved_byte) {
+        downgrade = Downgrade{cost_per_saved_byte, segment_id, selection[segment_id], candidate_id};
+      }
+    }
+    return downgrade;
+  };
+
+  auto downgrades = std::priority_queue<Downgrade, std::vector<Downgrade>, std::greater<>>{};
+  for (auto segment_id = size_t{0}; segment_id < segment_count; ++segment_id) {
+    if (const auto downgrade = best_downgrade(segment_id)) {
+      downgrades.push(*downgrade);
+    }
+  }
+
+  while (memory_usage > memory_budget && !downgrades.empty()) {
+    const auto downgrade = downgrades.top();
+    downgrades.pop();
+
+    // Skip downgrades that were computed for a previous selection of the segment.
+    if (selection[downgrade.segment_id] != downgrade.from_candidate_id) {
+      continue;
+    }
+
+    const auto& candidates = segment_candidates[downgrade.segment_id];
+    memory_usage -= candidates[downgrade.from_candidate_id].estimated_memory_usage -
+                    candidates[downgrade.to_candidate_id].estimated_memory_usage;
+    selection[downgrade.segment_id] = downgrade.to_candidate_id;
+
+    if (const auto next_downgrade = best_downgrade(downgrade.segment_id)) {
+      downgrades.push(*next_downgrade);
+    }
+  }
+
+  return selection;
+}
+
+size_t EncodingAdvisorPlugin::_advise_and_encode() {
+  const auto lock = std::lock_guard<std::mutex>{_advisor_mutex};
+
+  auto segment_locations = std::vector<SegmentLocation>{};
+  auto segment_candidates = std::vector<std::vector<EncodingCandidate>>{};
+  auto current_memory_usage = size_t{0};
+
+  for (const auto& [table_name, table] : Hyrise::get().storage_manager.tables()) {
+    if (table->type() != TableType::Data) {
+      continue;
+    }
+
+    const auto chunk_count = table->chunk_count();
+    const auto column_count = table->column_count();
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      const auto chunk = table->get_chunk(chunk_id);
+      // Mutable chunks still receive inserts. See the ChunkCompressionPlugin for encoding them once they are full.
+      if (!chunk || chunk->is_mutable()) {
+        continue;
+      }
+
+      for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+        // Chunk indexes reference the segments they were built on.
+        if (!chunk->get_indexes(std::vector<ColumnID>{column_id}).empty()) {
+          continue;
+        }
+
+        const auto segment = chunk->get_segment(column_id);
+        // Read the access counters before sampling the segment.
+        const auto access_counter = SegmentAccessCounter{segment->access_counter};
+        segment_candidates.emplace_back(_encoding_candidates(_sample_segment(segment), access_counter));
+        segment_locations.emplace_back(SegmentLocation{chunk, column_id, segment});
+        current_memory_usage += segment->memory_usage(MemoryUsageCalculationMode::Sampled);
+      }
+    }
+  }
+
+  const auto memory_budget = _memory_budget > 0 ? _memory_budget.load() : current_memory_usage;
+  const auto selection = _select_encodings(segment_candidates, memory_budget);
+
+  auto encoded_segment_count = size_t{0};
+  const auto segment_count = segment_locations.size();
+  for (auto segment_id = size_t{0}; segment_id < segment_count; ++segment_id) {
+    const auto& [chunk, column_id, segment] = segment_locations[segment_id];
+    const auto& encoding_spec = segment_candidates[segment_id][selection[segment_id]].encoding_spec;
+    // Skip segments that have been replaced in the meantime.
+    if (chunk->get_segment(column_id) != segment ||
+        encoding_spec_satisfied(encoding_spec, get_segment_encoding_spec(segment))) {
+      continue;
+    }
+
+    const auto encoded_segment = ChunkEncoder::encode_segment(segment, segment->data_type(), encoding_spec);
+    // Keep the workload information for the next run of the advisor.
+    encoded_segment->access_counter = segment->access_counter;
+    chunk->replace_segment(column_id, encoded_segment);
+    ++encoded_segment_count;
+  }
+
+  auto message = std::stringstream{};
+  message << "Re-encoded " << encoded_segment_count << " of " << segment_count << " segments.";
+  Hyrise::get().log_manager.add_message("EncodingAdvisorPlugin", message.str(), LogLevel::Info);
+
+  return encoded_segment_count;
+}
+
+EncodingAdvisorPlugin::MemoryBudgetSetting::MemoryBudgetSetting(EncodingAdvisorPlugin& plugin)
+    : AbstractSetting("EncodingAdvisorPlugin.memory_budget"), _plugin(plugin) {}
+
+const std::string& EncodingAdvisorPlugin::MemoryBudgetSetting::description() const {
+  static const auto description =
+      std::string{"Memory budget in bytes for the segments encoded by the advisor (0: current memory usage)"};
+  return description;
+}
+
+const std::string& EncodingAdvisorPlugin::MemoryBudgetSetting::get() {
+  _value = std::to_string(_plugin.memory_budget());
+  return _value;
+}
+
+void EncodingAdvisorPlugin::MemoryBudgetSetting::set(const std::string& value) {
+  AssertInput(!value.empty() && std::all_of(value.cbegin(), value.cend(), [](const unsigned char character) {
+                return std::isdigit(character);
+              }),
+              "Expected a non-negative integer for " + name + ", got '" + value + "'.");
+  _plugin.set_memory_budget(std::stoull(value));
+}
+
+EXPORT_PLUGIN(EncodingAdvisorPlugin);
+
+}  // namespace hyrise
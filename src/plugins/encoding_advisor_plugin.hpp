@@ -0,0 +1,140 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "storage/encoding_type.hpp"
+#include "storage/segment_access_counter.hpp"
+#include "types.hpp"
+#include "utils/abstract_plugin.hpp"
+#include "utils/pausable_loop_thread.hpp"
+#include "utils/settings/abstract_setting.hpp"
+
+namespace hyrise {
+
+class AbstractSegment;
+
+/**
+ * Data characteristics of a segment that determine how well it can be encoded. Except for the row count, all values
+ * are estimated from a sample of the segment.
+ */
+struct SegmentCharacteristics {
+  DataType data_type{DataType::Int};
+  ChunkOffset row_count{0};
+  size_t null_value_count{0};
+  size_t distinct_value_count{0};
+  size_t run_count{0};
+
+  // Difference between the largest and the smallest value. Only set for integral data types.
+  std::optional<uint64_t> value_range;
+
+  // Only set for string columns.
+  double average_string_length{0.0};
+  size_t max_string_length{0};
+
+  // The compression ratio of LZ4 cannot be derived from the characteristics above. Thus, we encode the sample and
+  // extrapolate its memory usage.
+  size_t lz4_memory_usage{0};
+};
+
+struct EncodingCandidate {
+  SegmentEncodingSpec encoding_spec;
+  size_t estimated_memory_usage{0};
+  double estimated_scan_cost{0.0};
+};
+
+/**
+ * This plugin chooses the encoding of each segment of immutable chunks based on the segment's data characteristics
+ * and on how the workload accesses it (as recorded by the SegmentAccessCounter). For each segment, it estimates the
+ * memory usage and the scan cost of all applicable encodings and vector compression types. It then selects the
+ * encodings with the lowest total scan cost whose memory usage fits into the memory budget. Segments whose selected
+ * encoding differs from their current one are re-encoded in the background.
+ *
+ * The memory budget (in bytes) can be configured via the "EncodingAdvisorPlugin.memory_budget" setting. A budget of
+ * zero (the default) limits the memory usage to that of the segments before the advisor ran, i.e., the advisor never
+ * increases the memory consumption.
+ */
+class EncodingAdvisorPlugin : public AbstractPlugin {
+ public:
+  std::string description() const final;
+
+  void start() final;
+
+  void stop() final;
+
+  std::vector<std::pair<PluginFunctionName, PluginFunctionPointer>> provided_user_executable_functions() final;
+
+  void set_memory_budget(const size_t memory_budget);
+  size_t memory_budget() const;
+
+  /**
+   * IDLE_DELAY_ENCODING_ADVISOR: sleep between two runs of the advisor
+   * SAMPLE_BLOCK_COUNT, SAMPLE_BLOCK_SIZE: number and size of the contiguous blocks that are sampled per segment.
+   * Sampling contiguous rows allows us to estimate run lengths.
+   */
+  constexpr static std::chrono::milliseconds IDLE_DELAY_ENCODING_ADVISOR = std::chrono::milliseconds(60'000);
+  constexpr static size_t SAMPLE_BLOCK_COUNT = 8;
+  constexpr static size_t SAMPLE_BLOCK_SIZE = 512;
+
+ protected:
+  friend class EncodingAdvisorPluginTest;
+
+  /**
+   * Samples the segment and estimates its data characteristics. Only the sampled positions are read, and the
+   * accesses of the sampling are removed from the segment's access counters again.
+   */
+  static SegmentCharacteristics _sample_segment(const std::shared_ptr<const AbstractSegment>& segment);
+
+  /**
+   * Returns all encodings applicable to a segment with the given characteristics, together with their estimated memory
+   * usage and the estimated cost of the accesses recorded in the access counter.
+   */
+  static std::vector<EncodingCandidate> _encoding_candidates(const SegmentCharacteristics& characteristics,
+                                                             const SegmentAccessCounter& access_counter);
+
+  /**
+   * Selects one candidate per segment (returned as index into the segment's candidates). First, the candidate with
+   * the lowest scan cost is chosen for each segment. As long as the selected candidates exceed the memory budget, the
+   * selection is changed greedily to the candidate that saves memory at the lowest additional cost per byte.
+   */
+  static std::vector<size_t> _select_encodings(const std::vector<std::vector<EncodingCandidate>>& segment_candidates,
+                                               const size_t memory_budget);
+
+  /**
+   * Runs the advisor for all immutable chunks of all data tables and re-encodes the segments whose selected encoding
+   * differs from their current one. Returns the number of re-encoded segments.
+   */
+  size_t _advise_and_encode();
+
+ private:
+  class MemoryBudgetSetting : public AbstractSetting {
+   public:
+    explicit MemoryBudgetSetting(EncodingAdvisorPlugin& plugin);
+
+    const std::string& description() const final;
+
+    const std::string& get() final;
+
+    void set(const std::string& value) final;
+
+   private:
+    EncodingAdvisorPlugin& _plugin;
+    std::string _value;
+  };
+
+  std::unique_ptr<PausableLoopThread> _loop_thread_encoding_advisor;
+  std::shared_ptr<MemoryBudgetSetting> _memory_budget_setting;
+
+  std::atomic<size_t> _memory_budget{0};
+
+  // Serializes runs of the advisor triggered by the loop thread and by the user-executable function.
+  std::mutex _advisor_mutex;
+};
+
+}  // namespace hyrise
@@ -0,0 +1,283 @@
+#include "statistics_maintenance_plugin.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "hyrise.hpp"
+#include "logical_query_plan/lqp_utils.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "operators/get_table.hpp"
+#include "operators/pqp_utils.hpp"
+#include "statistics/column_group_statistics.hpp"
+#include "statistics/generate_pruning_statistics.hpp"
+#include "statistics/table_statistics.hpp"
+#include "storage/prepared_plan.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace hyrise;  // NOLINT
+
+bool lqp_references_table(const std::shared_ptr<AbstractLQPNode>& lqp, const std::string& table_name) {
+  for (const auto& subplan_root : lqp_find_subplan_roots(lqp)) {
+    for (const auto& node : lqp_find_nodes_by_type(subplan_root, LQPNodeType::StoredTable)) {
+      if (static_cast<const StoredTableNode&>(*node).table_name == table_name) {
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
+bool pqp_references_table(const std::shared_ptr<AbstractOperator>& pqp, const std::string& table_name) {
+  // PQPs translated from an LQP know their LQP, which (unlike the PQP) lets us find the tables of correlated
+  // subqueries as well.
+  if (pqp->lqp_node) {
+    return lqp_references_table(std::const_pointer_cast<AbstractLQPNode>(pqp->lqp_node), table_name);
+  }
+
+  auto references_table = false;
+  visit_pqp(pqp, [&](const auto& op) {
+    const auto get_table = std::dynamic_pointer_cast<const GetTable>(op);
+    if (get_table && get_table->table_name() == table_name) {
+      references_table = true;
+    }
+    return PQPVisitation::VisitInputs;
+  });
+  return references_table;
+}
+
+// Parses the value of a setting that expects a non-negative number.
+double parse_non_negative_number(const std::string& setting_name, const std::string& value) {
+  auto number = 0.0;
+  auto parsed_length = size_t{0};
+  try {
+    number = std::stod(value, &parsed_length);
+  } catch (const std::exception& /*exception*/) {
+    parsed_length = 0;
+  }
+  AssertInput(parsed_length > 0 && parsed_length == value.size() && number >= 0.0,
+              "Expected a non-negative number for " + setting_name + ", got '" + value + "'.");
+  return number;
+}
+
+template <typename Cache, typename ReferencesTable>
+void evict_from_cache(const std::shared_ptr<Cache>& cache, ReferencesTable references_table) {
+  if (!cache) {
+    return;
+  }
+
+  for (const auto& [key, entry] : cache->snapshot()) {
+    if (references_table(entry.value)) {
+      cache->erase(key);
+    }
+  }
+}
+
+}  // namespace
+
+namespace hyrise {
+
+std::string StatisticsMaintenancePlugin::description() const {
+  return "Background table statistics maintenance plugin";
+}
+
+void StatisticsMaintenancePlugin::start() {
+  _refresh_threshold_setting = std::make_shared<RefreshThresholdSetting>(*this);
+  _refresh_threshold_setting->register_at_settings_manager();
+  _column_group_misestimation_factor_setting = std::make_shared<ColumnGroupMisestimationFactorSetting>(*this);
+  _column_group_misestimation_factor_setting->register_at_settings_manager();
+
+  _loop_thread_statistics_maintenance =
+      std::make_unique<PausableLoopThread>(IDLE_DELAY_STATISTICS_MAINTENANCE, [&](size_t /*unused*/) {
+        _maintain_statistics();
+        _add_column_group_statistics();
+      });
+}
+
+void StatisticsMaintenancePlugin::stop() {
+  // Call destructor of PausableLoopThread to terminate its thread
+  _loop_thread_statistics_maintenance.reset();
+
+  _refresh_threshold_setting->unregister_at_settings_manager();
+  _refresh_threshold_setting.reset();
+  _column_group_misestimation_factor_setting->unregister_at_settings_manager();
+  _column_group_misestimation_factor_setting.reset();
+}
+
+void StatisticsMaintenancePlugin::set_refresh_threshold(const double refresh_threshold) {
+  Assert(refresh_threshold >= 0.0, "Refresh threshold must not be negative.");
+  _refresh_threshold = refresh_threshold;
+}
+
+double StatisticsMaintenancePlugin::refresh_threshold() const {
+  return _refresh_threshold;
+}
+
+void StatisticsMaintenancePlugin::set_column_group_misestimation_factor(const double misestimation_factor) {
+  Assert(misestimation_factor >= 0.0, "Misestimation factor must not be negative.");
+  _column_group_misestimation_factor = misestimation_factor;
+}
+
+double StatisticsMaintenancePlugin::column_group_misestimation_factor() const {
+  return _column_group_misestimation_factor;
+}
+
+size_t StatisticsMaintenancePlugin::_maintain_statistics() {
+  const auto lock = std::lock_guard<std::mutex>{_maintenance_mutex};
+  const auto current_refresh_threshold = refresh_threshold();
+
+  auto refreshed_table_count = size_t{0};
+  for (const auto& [table_name, table] : Hyrise::get().storage_manager.tables()) {
+    if (table->type() != TableType::Data) {
+      continue;
+    }
+
+    // Only finalized chunks without pruning statistics get new ones.
+    generate_chunk_pruning_statistics(table);
+
+    // Read the counter before building the statistics. Rows modified while the statistics are built might or might
+    // not be included in them and are counted towards the next refresh.
+    const auto modified_row_count = table->modified_row_count();
+
+    // If a table was dropped and a new one was added under the same name, the new table's counter starts from zero.
+    const auto last_modified_row_count = std::min(_modified_row_counts[table_name], modified_row_count);
+
+    const auto table_statistics = table->table_statistics();
+    const auto statistics_row_count =
+        table_statistics ? table_statistics->row_count : static_cast<Cardinality>(table->row_count());
+    const auto changed_row_count = modified_row_count - last_modified_row_count;
+    if (changed_row_count == 0 ||
+        static_cast<double>(changed_row_count) < current_refresh_threshold * std::max(statistics_row_count, 1.0f)) {
+      _modified_row_counts[table_name] = last_modified_row_count;
+      continue;
+    }
+
+    // Merging the changes into the existing histograms would require the values of the modified rows, which are not
+    // tracked. Instead, the statistics are rebuilt from the table's current content using the configuration they were
+    // created with. Statistics created from sketches keep the sketches of the chunks that were immutable back then
+    // (see TableStatistics::update_from_table()). Column group statistics were requested explicitly and are rebuilt.
+    auto rebuilt_table_statistics = std::shared_ptr<TableStatistics>{};
+    if (table_statistics) {
+      rebuilt_table_statistics = TableStatistics::update_from_table(*table, *table_statistics);
+      for (auto& column_group_statistics : rebuilt_table_statistics->column_group_statistics) {
+        column_group_statistics = ColumnGroupStatistics::from_table(*table, column_group_statistics->column_ids);
+      }
+    } else {
+      rebuilt_table_statistics =
+          TableStatistics::from_table(*table, Hyrise::get().storage_manager.statistics_generation_config);
+    }
+    table->set_table_statistics(rebuilt_table_statistics);
+    _modified_row_counts[table_name] = modified_row_count;
+    _evict_cached_plans(table_name);
+    ++refreshed_table_count;
+
+    auto message = std::stringstream{};
+    message << "Rebuilt statistics of table '" << table_name << "' after " << changed_row_count << " modified rows.";
+    Hyrise::get().log_manager.add_message("StatisticsMaintenancePlugin", message.str(), LogLevel::Info);
+  }
+
+  return refreshed_table_count;
+}
+
+size_t StatisticsMaintenancePlugin::_add_column_group_statistics() {
+  const auto misestimation_factor = column_group_misestimation_factor();
+  const auto& pqp_cache = Hyrise::get().default_pqp_cache;
+  if (misestimation_factor == 0.0 || !pqp_cache) {
+    return 0;
+  }
+
+  const auto lock = std::lock_guard<std::mutex>{_maintenance_mutex};
+  auto& storage_manager = Hyrise::get().storage_manager;
+
+  auto added_statistics_count = size_t{0};
+  for (const auto& [query, entry] : pqp_cache->snapshot()) {
+    // Plans that were not executed yet have no performance data and do not lead to suggestions.
+    const auto suggestions = suggest_column_group_statistics(entry.value, static_cast<float>(misestimation_factor));
+    for (const auto& suggestion : suggestions) {
+      if (!storage_manager.has_table(suggestion.table_name)) {
+        continue;
+      }
+
+      // Skip column groups that already have statistics. The remaining misestimation has other causes.
+      const auto table = storage_manager.get_table(suggestion.table_name);
+      const auto table_statistics = table->table_statistics();
+      if (!table_statistics || table_statistics->distinct_count(suggestion.column_ids)) {
+        continue;
+      }
+
+      add_column_group_statistics(*table, suggestion.column_ids);
+      _evict_cached_plans(suggestion.table_name);
+      ++added_statistics_count;
+
+      auto message = std::stringstream{};
+      message << "Added column group statistics to table '" << suggestion.table_name << "' (estimated selectivity "
+              << suggestion.estimated_selectivity << ", actual selectivity " << suggestion.actual_selectivity << ").";
+      Hyrise::get().log_manager.add_message("StatisticsMaintenancePlugin", message.str(), LogLevel::Info);
+    }
+  }
+
+  return added_statistics_count;
+}
+
+void StatisticsMaintenancePlugin::_evict_cached_plans(const std::string& table_name) {
+  evict_from_cache(Hyrise::get().default_lqp_cache, [&](const std::shared_ptr<AbstractLQPNode>& lqp) {
+    return lqp_references_table(lqp, table_name);
+  });
+
+  evict_from_cache(Hyrise::get().default_pqp_cache, [&](const std::shared_ptr<AbstractOperator>& pqp) {
+    return pqp_references_table(pqp, table_name);
+  });
+
+  // nullptr entries mark statements that cannot be parameterized. They do not depend on statistics.
+  evict_from_cache(Hyrise::get().default_parameterized_lqp_cache,
+                   [&](const std::shared_ptr<PreparedPlan>& prepared_plan) {
+                     return prepared_plan && lqp_references_table(prepared_plan->lqp, table_name);
+                   });
+}
+
+StatisticsMaintenancePlugin::RefreshThresholdSetting::RefreshThresholdSetting(StatisticsMaintenancePlugin& plugin)
+    : AbstractSetting("StatisticsMaintenancePlugin.refresh_threshold"), _plugin(plugin) {}
+
+const std::string& StatisticsMaintenancePlugin::RefreshThresholdSetting::description() const {
+  static const auto description =
+      std::string{"Fraction of a table's rows that must be inserted or deleted before its statistics are rebuilt"};
+  return description;
+}
+
+const std::string& StatisticsMaintenancePlugin::RefreshThresholdSetting::get() {
+  _value = std::to_string(_plugin.refresh_threshold());
+  return _value;
+}
+
+void StatisticsMaintenancePlugin::RefreshThresholdSetting::set(const std::string& value) {
+  _plugin.set_refresh_threshold(parse_non_negative_number(name, value));
+}
+
+StatisticsMaintenancePlugin::ColumnGroupMisestimationFactorSetting::ColumnGroupMisestimationFactorSetting(
+    StatisticsMaintenancePlugin& plugin)
+    : AbstractSetting("StatisticsMaintenancePlugin.column_group_misestimation_factor"), _plugin(plugin) {}
+
+const std::string& StatisticsMaintenancePlugin::ColumnGroupMisestimationFactorSetting::description() const {
+  static const auto description = std::string{
+      "Factor by which the selectivity of a cached plan's scan must be underestimated to add column group statistics "
+      "for its predicates (0 disables it)"};
+  return description;
+}
+
+const std::string& StatisticsMaintenancePlugin::ColumnGroupMisestimationFactorSetting::get() {
+  _value = std::to_string(_plugin.column_group_misestimation_factor());
+  return _value;
+}
+
+void StatisticsMaintenancePlugin::ColumnGroupMisestimationFactorSetting::set(const std::string& value) {
+  _plugin.set_column_group_misestimation_factor(parse_non_negative_number(name, value));
+}
+
+EXPORT_PLUGIN(StatisticsMaintenancePlugin);
+
+}  // namespace hyrise
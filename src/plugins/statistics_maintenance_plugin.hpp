@@ -0,0 +1,122 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "utils/abstract_plugin.hpp"
+#include "utils/pausable_loop_thread.hpp"
+#include "utils/settings/abstract_setting.hpp"
+
+namespace hyrise {
+
+/**
+ * The table statistics (i.e., the histograms used for cardinality estimation) are created when a table is added to
+ * the StorageManager and are not updated afterwards. After many Inserts and Deletes, they no longer reflect the data,
+ * and the optimizer makes decisions based on outdated estimates. This plugin periodically checks how many rows of
+ * each table have been inserted or deleted since the table's statistics were last built (see
+ * Table::modified_row_count()). Once this number exceeds a configurable fraction of the row count the statistics were
+ * built for, the statistics are rebuilt from the table in the background and atomically replace the old ones.
+ * Statistics created from sketches are updated incrementally (see TableStatistics::update_from_table()). Thus, rows
+ * deleted from chunks that were already immutable when the statistics were created are not reflected by them.
+ *
+ * Cached plans were optimized using the old statistics. Thus, the entries of the default LQP, PQP, and parameterized
+ * LQP caches that reference the table are evicted so that subsequent executions are optimized again.
+ *
+ * The fraction can be configured via the "StatisticsMaintenancePlugin.refresh_threshold" setting (default: 0.1).
+ *
+ * If the "StatisticsMaintenancePlugin.column_group_misestimation_factor" setting is positive (default: 0, i.e.,
+ * disabled), the plugin also checks the executed plans in the default PQP cache for `column = value` scans whose
+ * selectivity was underestimated by more than this factor because of correlated predicates and adds the suggested
+ * ColumnGroupStatistics to the tables (see suggest_column_group_statistics()).
+ *
+ * Additionally, the plugin generates the pruning statistics of chunks that were filled by Inserts and have been
+ * finalized since (e.g., by the ChunkCompressionPlugin), so that the ChunkPruningRule can prune them.
+ */
+class StatisticsMaintenancePlugin : public AbstractPlugin {
+ public:
+  std::string description() const final;
+
+  void start() final;
+
+  void stop() final;
+
+  void set_refresh_threshold(const double refresh_threshold);
+  double refresh_threshold() const;
+
+  void set_column_group_misestimation_factor(const double misestimation_factor);
+  double column_group_misestimation_factor() const;
+
+  constexpr static std::chrono::milliseconds IDLE_DELAY_STATISTICS_MAINTENANCE = std::chrono::milliseconds(5000);
+  constexpr static double DEFAULT_REFRESH_THRESHOLD = 0.1;
+  constexpr static double DEFAULT_COLUMN_GROUP_MISESTIMATION_FACTOR = 0.0;
+
+ protected:
+  friend class StatisticsMaintenancePluginTest;
+
+  /**
+   * Rebuilds the statistics of all data tables with sufficiently many modified rows and evicts the cached plans that
+   * reference them. Returns the number of tables whose statistics were rebuilt.
+   */
+  size_t _maintain_statistics();
+
+  /**
+   * Adds the column group statistics suggested for the executed plans in the default PQP cache to the tables that do
+   * not have them yet and evicts the cached plans that reference these tables. Returns the number of added statistics.
+   */
+  size_t _add_column_group_statistics();
+
+  // Removes all plans that reference the given table from the default plan caches.
+  static void _evict_cached_plans(const std::string& table_name);
+
+ private:
+  class RefreshThresholdSetting : public AbstractSetting {
+   public:
+    explicit RefreshThresholdSetting(StatisticsMaintenancePlugin& plugin);
+
+    const std::string& description() const final;
+
+    const std::string& get() final;
+
+    void set(const std::string& value) final;
+
+   private:
+    StatisticsMaintenancePlugin& _plugin;
+    std::string _value;
+  };
+
+  class ColumnGroupMisestimationFactorSetting : public AbstractSetting {
+   public:
+    explicit ColumnGroupMisestimationFactorSetting(StatisticsMaintenancePlugin& plugin);
+
+    const std::string& description() const final;
+
+    const std::string& get() final;
+
+    void set(const std::string& value) final;
+
+   private:
+    StatisticsMaintenancePlugin& _plugin;
+    std::string _value;
+  };
+
+  std::unique_ptr<PausableLoopThread> _loop_thread_statistics_maintenance;
+  std::shared_ptr<RefreshThresholdSetting> _refresh_threshold_setting;
+  std::shared_ptr<ColumnGroupMisestimationFactorSetting> _column_group_misestimation_factor_setting;
+
+  std::atomic<double> _refresh_threshold{DEFAULT_REFRESH_THRESHOLD};
+  std::atomic<double> _column_group_misestimation_factor{DEFAULT_COLUMN_GROUP_MISESTIMATION_FACTOR};
+
+  // Table::modified_row_count() of each table at the time its statistics were last rebuilt by this plugin. Tables
+  // without an entry have not been modified since they were added to the StorageManager (where their statistics are
+  // built).
+  std::unordered_map<std::string, uint64_t> _modified_row_counts;
+
+  // Serializes runs triggered by the loop thread and by tests.
+  std::mutex _maintenance_mutex;
+};
+
+}  // namespace hyrise
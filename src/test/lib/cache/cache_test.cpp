@@ -136,6 +136,25 @@ TEST_F(CacheTest, TryGet) {
   ASSERT_EQ(cache.try_get(2), std::nullopt);
 }
 
+TEST_F(CacheTest, Erase) {
+  GDFSCache<int, int> cache(3);
+  cache.set(1, 2);
+  cache.set(2, 4);
+
+  cache.erase(1);
+  cache.erase(3);
+
+  ASSERT_EQ(cache.size(), 1u);
+  ASSERT_FALSE(cache.has(1));
+  ASSERT_EQ(cache.try_get(2), 4);
+
+  // The erased entry does not count towards the capacity anymore.
+  cache.set(3, 6);
+  cache.set(4, 8);
+  ASSERT_EQ(cache.size(), 3u);
+  ASSERT_TRUE(cache.has(2));
+}
+
 TEST_F(CacheTest, ResizeGrow) {
   GDFSCache<int, int> cache(3);
 
@@ -0,0 +1,188 @@
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+
+#include "base_test.hpp"
+
+#include "concurrency/transaction_context.hpp"
+#include "concurrency/write_ahead_log.hpp"
+#include "hyrise.hpp"
+#include "sql/sql_pipeline_builder.hpp"
+#include "storage/table.hpp"
+
+namespace hyrise {
+
+class WriteAheadLogTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    std::remove(log_path.c_str());
+    add_empty_table();
+  }
+
+  void TearDown() override {
+    Hyrise::get().write_ahead_log.close();
+    std::remove(log_path.c_str());
+  }
+
+  // After a restart, the (empty) table is loaded from the "checkpoint" before the log is replayed.
+  static void add_empty_table() {
+    const auto column_definitions =
+        TableColumnDefinitions{{"a", DataType::Int, false}, {"b", DataType::String, true}};
+    Hyrise::get().storage_manager.add_table(
+        "t", std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{3}, UseMvcc::Yes));
+  }
+
+  static std::shared_ptr<const Table> execute(const std::string& sql) {
+    const auto [status, table] = SQLPipelineBuilder{sql}.create_pipeline().get_result_table();
+    EXPECT_EQ(status, SQLPipelineStatus::Success);
+    return table;
+  }
+
+  static void execute(const std::string& sql, const std::shared_ptr<TransactionContext>& transaction_context) {
+    const auto [status, table] =
+        SQLPipelineBuilder{sql}.with_transaction_context(transaction_context).create_pipeline().get_result_table();
+    EXPECT_EQ(status, SQLPipelineStatus::Success);
+  }
+
+  // Simulates a crash: the log is closed without any further action and all tables are lost.
+  void restart() {
+    Hyrise::reset();
+    add_empty_table();
+  }
+
+  const std::string log_path = test_data_path + "write_ahead_log_test.log";
+};
+
+TEST_F(WriteAheadLogTest, RecoverCommittedChanges) {
+  auto& write_ahead_log = Hyrise::get().write_ahead_log;
+  EXPECT_FALSE(write_ahead_log.is_enabled());
+  EXPECT_EQ(write_ahead_log.open(log_path), 0);
+  EXPECT_TRUE(write_ahead_log.is_enabled());
+
+  execute("INSERT INTO t VALUES (1, 'one'), (2, NULL), (3, 'three'), (4, 'four')");
+  // The rolled-back row still occupies a position in the table. Recovery has to reproduce it as an invalid row so that
+  // the following RowIDs match the log.
+  execute("BEGIN; INSERT INTO t VALUES (5, 'five'); ROLLBACK;");
+  execute("INSERT INTO t VALUES (6, 'six')");
+  execute("DELETE FROM t WHERE a = 2");
+  execute("UPDATE t SET a = 30 WHERE a = 3");
+
+  const auto expected_table = execute("SELECT * FROM t");
+  const auto last_commit_id = Hyrise::get().transaction_manager.last_commit_id();
+
+  restart();
+  EXPECT_EQ(Hyrise::get().write_ahead_log.open(log_path), 4);
+  EXPECT_TABLE_EQ_UNORDERED(execute("SELECT * FROM t"), expected_table);
+  EXPECT_EQ(Hyrise::get().transaction_manager.last_commit_id(), last_commit_id);
+
+  // New transactions continue after the replayed ones and are recovered as well.
+  execute("INSERT INTO t VALUES (7, 'seven')");
+  const auto expected_table_after_insert = execute("SELECT * FROM t");
+  EXPECT_EQ(expected_table_after_insert->row_count(), expected_table->row_count() + 1);
+
+  restart();
+  EXPECT_EQ(Hyrise::get().write_ahead_log.open(log_path), 5);
+  EXPECT_TABLE_EQ_UNORDERED(execute("SELECT * FROM t"), expected_table_after_insert);
+}
+
+TEST_F(WriteAheadLogTest, RecoverOutOfOrderCommits) {
+  auto& transaction_manager = Hyrise::get().transaction_manager;
+  Hyrise::get().write_ahead_log.open(log_path);
+
+  // The transactions commit in a different order than they inserted their rows. The row of the rolled-back transaction
+  // lies in between.
+  const auto transaction_context_1 = transaction_manager.new_transaction_context(AutoCommit::No);
+  const auto transaction_context_2 = transaction_manager.new_transaction_context(AutoCommit::No);
+  const auto transaction_context_3 = transaction_manager.new_transaction_context(AutoCommit::No);
+  execute("INSERT INTO t VALUES (1, 'one')", transaction_context_1);
+  execute("INSERT INTO t VALUES (2, 'two')", transaction_context_2);
+  execute("INSERT INTO t VALUES (3, 'three'), (4, 'four')", transaction_context_3);
+  transaction_context_3->commit();
+  transaction_context_2->rollback(RollbackReason::User);
+  transaction_context_1->commit();
+
+  const auto expected_table = execute("SELECT * FROM t");
+  EXPECT_EQ(expected_table->row_count(), 3);
+
+  restart();
+  EXPECT_EQ(Hyrise::get().write_ahead_log.open(log_path), 2);
+  EXPECT_TABLE_EQ_UNORDERED(execute("SELECT * FROM t"), expected_table);
+
+  const auto table = Hyrise::get().storage_manager.get_table("t");
+  EXPECT_EQ(table->row_count(), 4);
+  EXPECT_EQ(table->get_chunk(ChunkID{0})->invalid_row_count(), 1);
+}
+
+TEST_F(WriteAheadLogTest, TruncateCheckpointedTransactions) {
+  auto& write_ahead_log = Hyrise::get().write_ahead_log;
+  write_ahead_log.open(log_path);
+  execute("INSERT INTO t VALUES (1, 'one')");
+  const auto checkpoint_commit_id = Hyrise::get().transaction_manager.last_commit_id();
+  execute("INSERT INTO t VALUES (2, 'two')");
+  const auto expected_table = execute("SELECT * FROM t");
+
+  const auto log_size = std::filesystem::file_size(log_path);
+  write_ahead_log.truncate(checkpoint_commit_id);
+  EXPECT_LT(std::filesystem::file_size(log_path), log_size);
+
+  // Records are appended to the truncated log.
+  execute("INSERT INTO t VALUES (3, 'three')");
+  const auto expected_table_after_insert = execute("SELECT * FROM t");
+  EXPECT_EQ(expected_table_after_insert->row_count(), expected_table->row_count() + 1);
+
+  // Without the "checkpoint", the log does not continue the loaded tables and nothing is replayed.
+  restart();
+  EXPECT_EQ(Hyrise::get().write_ahead_log.open(log_path), 0);
+  EXPECT_EQ(execute("SELECT * FROM t")->row_count(), 0);
+}
+
+TEST_F(WriteAheadLogTest, ReplayAfterCheckpoint) {
+  auto& write_ahead_log = Hyrise::get().write_ahead_log;
+  write_ahead_log.open(log_path);
+  execute("INSERT INTO t VALUES (1, 'one')");
+  const auto checkpoint_commit_id = Hyrise::get().transaction_manager.last_commit_id();
+  execute("INSERT INTO t VALUES (2, 'two')");
+  execute("INSERT INTO t VALUES (3, 'three')");
+  const auto expected_table = execute("SELECT * FROM t");
+  write_ahead_log.truncate(checkpoint_commit_id);
+
+  // The "checkpoint" contains the first transaction with the same commit ID as before.
+  restart();
+  execute("INSERT INTO t VALUES (1, 'one')");
+  EXPECT_EQ(Hyrise::get().transaction_manager.last_commit_id(), checkpoint_commit_id);
+
+  EXPECT_EQ(Hyrise::get().write_ahead_log.open(log_path), 2);
+  EXPECT_TABLE_EQ_UNORDERED(execute("SELECT * FROM t"), expected_table);
+}
+
+TEST_F(WriteAheadLogTest, IgnoreTornWrite) {
+  Hyrise::get().write_ahead_log.open(log_path);
+  execute("INSERT INTO t VALUES (1, 'one')");
+  Hyrise::get().write_ahead_log.close();
+  const auto log_size = std::filesystem::file_size(log_path);
+
+  // A record whose size exceeds the file, as left behind by a crash during the write.
+  {
+    auto log_file = std::ofstream{log_path, std::ios::binary | std::ios::app};
+    const auto payload_size = uint32_t{1'000};
+    log_file.write(reinterpret_cast<const char*>(&payload_size), sizeof(payload_size));
+    log_file << "garbage";
+  }
+
+  restart();
+  EXPECT_EQ(Hyrise::get().write_ahead_log.open(log_path), 1);
+  EXPECT_EQ(execute("SELECT * FROM t")->row_count(), 1);
+  EXPECT_EQ(std::filesystem::file_size(log_path), log_size);
+}
+
+TEST_F(WriteAheadLogTest, UnknownTable) {
+  Hyrise::get().write_ahead_log.open(log_path);
+  execute("INSERT INTO t VALUES (1, 'one')");
+
+  Hyrise::reset();
+  EXPECT_THROW(Hyrise::get().write_ahead_log.open(log_path), std::logic_error);
+}
+
+}  // namespace hyrise
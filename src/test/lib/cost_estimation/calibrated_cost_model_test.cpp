@@ -0,0 +1,146 @@
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "cost_estimation/calibrated_cost_model.hpp"
+#include "expression/expression_functional.hpp"
+#include "hyrise.hpp"
+#include "operators/get_table.hpp"
+#include "operators/table_scan.hpp"
+#include "storage/chunk_encoder.hpp"
+
+namespace hyrise {
+
+using namespace expression_functional;  // NOLINT(build/namespaces)
+
+class CalibratedCostModelTest : public BaseTest {
+ public:
+  void TearDown() override {
+    std::remove(cost_model_file_path.c_str());
+  }
+
+  const std::string cost_model_file_path = test_data_path + "cost_model.json";
+};
+
+TEST_F(CalibratedCostModelTest, EstimateWithCoefficients) {
+  const auto coefficients = CostModelCoefficients{10.0, 1.0, 2.0, 3.0, 0.5, 0.0};
+  const auto row_counts = CostModelRowCounts{4.0, 8.0, 2.0};
+
+  // 10 + 4 * 1 + 8 * 2 + 2 * 3 + (4 * 8) * 0.5
+  EXPECT_FLOAT_EQ(coefficients.estimate(row_counts), 52.0f);
+
+  const auto features = CostModelCoefficients::features(row_counts);
+  EXPECT_DOUBLE_EQ(features[0], 1.0);
+  EXPECT_DOUBLE_EQ(features[4], 32.0);
+  EXPECT_DOUBLE_EQ(features[5], 4.0 * 2.0 + 8.0 * 3.0);
+}
+
+TEST_F(CalibratedCostModelTest, FitRecoversCoefficients) {
+  auto samples = std::vector<CostModelSample>{};
+  for (const auto left_row_count : {100.0, 1'000.0, 10'000.0, 100'000.0}) {
+    for (const auto right_row_count : {50.0, 5'000.0, 500'000.0}) {
+      for (const auto output_row_count : {10.0, 20'000.0}) {
+        const auto runtime = 1'000.0 + 2.0 * left_row_count + 4.0 * right_row_count + 8.0 * output_row_count;
+        samples.emplace_back(CostModelSample{OperatorType::JoinHash,
+                                             std::nullopt,
+                                             {left_row_count, right_row_count, output_row_count},
+                                             std::chrono::nanoseconds{static_cast<int64_t>(runtime)}});
+      }
+    }
+  }
+
+  const auto cost_model = CalibratedCostModel::fit(samples);
+  EXPECT_TRUE(cost_model.has_coefficients(OperatorType::JoinHash));
+  EXPECT_FALSE(cost_model.has_coefficients(OperatorType::JoinSortMerge));
+
+  const auto row_counts = CostModelRowCounts{3'000.0, 7'000.0, 1'000.0};
+  const auto expected_cost = 1'000.0 + 2.0 * 3'000.0 + 4.0 * 7'000.0 + 8.0 * 1'000.0;
+  EXPECT_NEAR(cost_model.estimate_cost(OperatorType::JoinHash, std::nullopt, row_counts), expected_cost,
+              expected_cost * 0.01);
+}
+
+TEST_F(CalibratedCostModelTest, FitNonNegativeCoefficients) {
+  // The runtime decreases with the output row count in these samples. A negative coefficient would lead to negative
+  // costs for large outputs, so the output row count is not used for the estimation.
+  auto samples = std::vector<CostModelSample>{};
+  for (const auto input_row_count : {100.0, 1'000.0, 10'000.0}) {
+    for (const auto output_row_count : {0.0, 50.0, 100.0}) {
+      const auto runtime = 5.0 * input_row_count - output_row_count;
+      samples.emplace_back(CostModelSample{OperatorType::Sort,
+                                           std::nullopt,
+                                           {input_row_count, 0.0, output_row_count},
+                                           std::chrono::nanoseconds{static_cast<int64_t>(runtime)}});
+    }
+  }
+
+  const auto cost_model = CalibratedCostModel::fit(samples);
+  EXPECT_GE(cost_model.estimate_cost(OperatorType::Sort, std::nullopt, {0.0, 0.0, 1'000'000'000.0}), 0.0f);
+}
+
+TEST_F(CalibratedCostModelTest, EncodingAndFallbackCoefficients) {
+  auto cost_model = CalibratedCostModel{};
+  cost_model.fallback_nanoseconds_per_row = 2.0;
+  cost_model.set_coefficients(OperatorType::TableScan, std::nullopt, CostModelCoefficients{0.0, 1.0});
+  cost_model.set_coefficients(OperatorType::TableScan, EncodingType::LZ4, CostModelCoefficients{0.0, 10.0});
+
+  const auto row_counts = CostModelRowCounts{100.0, 0.0, 10.0};
+  EXPECT_FLOAT_EQ(cost_model.estimate_cost(OperatorType::TableScan, EncodingType::LZ4, row_counts), 1'000.0f);
+  EXPECT_FLOAT_EQ(cost_model.estimate_cost(OperatorType::TableScan, EncodingType::Dictionary, row_counts), 100.0f);
+  EXPECT_FLOAT_EQ(cost_model.estimate_cost(OperatorType::TableScan, std::nullopt, row_counts), 100.0f);
+  EXPECT_FLOAT_EQ(cost_model.estimate_cost(OperatorType::Sort, std::nullopt, row_counts), 220.0f);
+}
+
+TEST_F(CalibratedCostModelTest, SaveAndLoad) {
+  auto cost_model = CalibratedCostModel{};
+  cost_model.fallback_nanoseconds_per_row = 3.5;
+  cost_model.set_coefficients(OperatorType::JoinHash, std::nullopt, CostModelCoefficients{1.0, 2.0, 3.0, 4.0, 0.0});
+  cost_model.set_coefficients(OperatorType::TableScan, EncodingType::RunLength,
+                              CostModelCoefficients{0.0, 0.5, 0.0, 0.25, 0.0, 0.125});
+  cost_model.save(cost_model_file_path);
+
+  const auto loaded_cost_model = CalibratedCostModel::load(cost_model_file_path);
+  EXPECT_DOUBLE_EQ(loaded_cost_model.fallback_nanoseconds_per_row, 3.5);
+  EXPECT_TRUE(loaded_cost_model.has_coefficients(OperatorType::JoinHash));
+  EXPECT_TRUE(loaded_cost_model.has_coefficients(OperatorType::TableScan, EncodingType::RunLength));
+  EXPECT_FALSE(loaded_cost_model.has_coefficients(OperatorType::TableScan));
+
+  for (const auto& row_counts : {CostModelRowCounts{1.0, 2.0, 3.0}, CostModelRowCounts{1'000.0, 0.0, 10.0}}) {
+    EXPECT_FLOAT_EQ(loaded_cost_model.estimate_cost(OperatorType::JoinHash, std::nullopt, row_counts),
+                    cost_model.estimate_cost(OperatorType::JoinHash, std::nullopt, row_counts));
+    EXPECT_FLOAT_EQ(loaded_cost_model.estimate_cost(OperatorType::TableScan, EncodingType::RunLength, row_counts),
+                    cost_model.estimate_cost(OperatorType::TableScan, EncodingType::RunLength, row_counts));
+  }
+
+  EXPECT_THROW(CalibratedCostModel::load(test_data_path + "non_existing_cost_model.json"), std::logic_error);
+}
+
+TEST_F(CalibratedCostModelTest, CollectSamples) {
+  const auto table = load_table("resources/test_data/tbl/int_int_float.tbl", ChunkOffset{2});
+  ChunkEncoder::encode_all_chunks(table, SegmentEncodingSpec{EncodingType::RunLength});
+  Hyrise::get().storage_manager.add_table("table_a", table);
+
+  EXPECT_EQ(CalibratedCostModel::stored_column_encoding_type("table_a", ColumnID{1}), EncodingType::RunLength);
+  EXPECT_EQ(CalibratedCostModel::stored_column_encoding_type("table_a", ColumnID{3}), std::nullopt);
+  EXPECT_EQ(CalibratedCostModel::stored_column_encoding_type("table_b", ColumnID{0}), std::nullopt);
+
+  const auto get_table = std::make_shared<GetTable>("table_a");
+  const auto table_scan =
+      std::make_shared<TableScan>(get_table, greater_than_(pqp_column_(ColumnID{0}, DataType::Int, false, "a"), 1000));
+  execute_all({get_table, table_scan});
+
+  const auto samples = CalibratedCostModel::collect_samples(table_scan);
+  ASSERT_EQ(samples.size(), 2);
+
+  EXPECT_EQ(samples[0].operator_type, OperatorType::TableScan);
+  EXPECT_EQ(samples[0].encoding_type, EncodingType::RunLength);
+  EXPECT_DOUBLE_EQ(samples[0].row_counts.left_input, static_cast<double>(table->row_count()));
+  EXPECT_DOUBLE_EQ(samples[0].row_counts.output, static_cast<double>(table_scan->get_output()->row_count()));
+  EXPECT_GT(samples[0].runtime.count(), 0);
+
+  EXPECT_EQ(samples[1].operator_type, OperatorType::GetTable);
+  EXPECT_EQ(samples[1].encoding_type, std::nullopt);
+}
+
+}  // namespace hyrise
@@ -0,0 +1,129 @@
+#include <memory>
+
+#include "base_test.hpp"
+
+#include "cost_estimation/calibrated_cost_model.hpp"
+#include "cost_estimation/cost_estimator_calibrated.hpp"
+#include "expression/expression_functional.hpp"
+#include "hyrise.hpp"
+#include "logical_query_plan/join_node.hpp"
+#include "logical_query_plan/lqp_translator.hpp"
+#include "logical_query_plan/mock_node.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "statistics/cardinality_estimator.hpp"
+#include "storage/chunk_encoder.hpp"
+
+namespace hyrise {
+
+using namespace expression_functional;  // NOLINT(build/namespaces)
+
+class CostEstimatorCalibratedTest : public BaseTest {
+ public:
+  void SetUp() override {
+    node_a = create_mock_node_with_statistics(MockNode::ColumnDefinitions{{DataType::Int, "a"}}, 1'000,
+                                              {GenericHistogram<int32_t>::with_single_bin(1, 100, 1'000, 100)});
+    node_b = create_mock_node_with_statistics(MockNode::ColumnDefinitions{{DataType::Int, "b"}}, 10'000,
+                                              {GenericHistogram<int32_t>::with_single_bin(1, 100, 10'000, 100)});
+    a = node_a->get_column("a");
+    b = node_b->get_column("b");
+
+    // JoinHash is cheaper per row, but it has high constant costs.
+    cost_model = std::make_shared<CalibratedCostModel>();
+    cost_model->set_coefficients(OperatorType::JoinHash, std::nullopt, CostModelCoefficients{1'000'000.0, 1.0, 1.0});
+    cost_model->set_coefficients(OperatorType::JoinSortMerge, std::nullopt, CostModelCoefficients{0.0, 10.0, 10.0});
+    cost_model->set_coefficients(OperatorType::JoinNestedLoop, std::nullopt,
+                                 CostModelCoefficients{0.0, 0.0, 0.0, 0.0, 1.0});
+  }
+
+  CostEstimatorCalibrated cost_estimator() const {
+    return CostEstimatorCalibrated{std::make_shared<CardinalityEstimator>(), cost_model};
+  }
+
+  std::shared_ptr<MockNode> node_a, node_b;
+  std::shared_ptr<LQPColumnExpression> a, b;
+  std::shared_ptr<CalibratedCostModel> cost_model;
+};
+
+TEST_F(CostEstimatorCalibratedTest, CheapestJoinOperator) {
+  const auto join_node = JoinNode::make(JoinMode::Inner, equals_(a, b), node_a, node_b);
+
+  // JoinSortMerge: 11'000 * 10 = 110'000, JoinHash: 1'000'000 + 11'000 = 1'011'000, JoinNestedLoop: 10'000'000.
+  const auto [operator_type, cost] = cost_estimator().cheapest_join_operator(join_node);
+  EXPECT_EQ(operator_type, OperatorType::JoinSortMerge);
+  EXPECT_FLOAT_EQ(cost, 110'000.0f);
+  EXPECT_FLOAT_EQ(cost_estimator().estimate_node_cost(join_node), 110'000.0f);
+
+  cost_model->set_coefficients(OperatorType::JoinHash, std::nullopt, CostModelCoefficients{0.0, 1.0, 1.0});
+  EXPECT_EQ(cost_estimator().cheapest_join_operator(join_node).first, OperatorType::JoinHash);
+}
+
+TEST_F(CostEstimatorCalibratedTest, CheapestJoinOperatorSupportingPredicate) {
+  cost_model->set_coefficients(OperatorType::JoinHash, std::nullopt, CostModelCoefficients{});
+
+  // JoinHash does not support non-equi joins.
+  const auto join_node = JoinNode::make(JoinMode::Inner, less_than_(a, b), node_a, node_b);
+  EXPECT_EQ(cost_estimator().cheapest_join_operator(join_node).first, OperatorType::JoinSortMerge);
+
+  // Only JoinNestedLoop supports predicates that are not column comparisons.
+  const auto complex_join_node = JoinNode::make(JoinMode::Inner, equals_(add_(a, 1), b), node_a, node_b);
+  EXPECT_EQ(cost_estimator().cheapest_join_operator(complex_join_node).first, OperatorType::JoinNestedLoop);
+}
+
+TEST_F(CostEstimatorCalibratedTest, CheapestJoinOperatorCachesStatistics) {
+  const auto join_node_a = JoinNode::make(JoinMode::Inner, equals_(a, b), node_a, node_b);
+  const auto node_c = create_mock_node_with_statistics(MockNode::ColumnDefinitions{{DataType::Int, "c"}}, 100,
+                                                       {GenericHistogram<int32_t>::with_single_bin(1, 100, 100, 100)});
+  const auto join_node_b = JoinNode::make(JoinMode::Inner, equals_(a, node_c->get_column("c")), join_node_a, node_c);
+
+  // The LQPTranslator guarantees the bottom-up construction, so that each join reuses the statistics of its inputs.
+  auto cached_cost_estimator = cost_estimator();
+  cached_cost_estimator.guarantee_bottom_up_construction();
+  const auto& cardinality_estimation_cache = cached_cost_estimator.cardinality_estimator->cardinality_estimation_cache;
+  const auto& statistics_by_lqp = cardinality_estimation_cache.statistics_by_lqp;
+
+  cached_cost_estimator.cheapest_join_operator(join_node_a);
+  ASSERT_TRUE(statistics_by_lqp);
+  EXPECT_EQ(statistics_by_lqp->size(), 3);
+  const auto join_statistics = statistics_by_lqp->at(join_node_a);
+
+  cached_cost_estimator.cheapest_join_operator(join_node_b);
+  EXPECT_EQ(statistics_by_lqp->size(), 5);
+  EXPECT_EQ(statistics_by_lqp->at(join_node_a), join_statistics);
+}
+
+TEST_F(CostEstimatorCalibratedTest, EncodingSpecificTableScan) {
+  const auto table = load_table("resources/test_data/tbl/int_int_float.tbl", ChunkOffset{2});
+  ChunkEncoder::encode_all_chunks(table, SegmentEncodingSpec{EncodingType::LZ4});
+  Hyrise::get().storage_manager.add_table("table_a", table);
+
+  cost_model->set_coefficients(OperatorType::TableScan, std::nullopt, CostModelCoefficients{0.0, 1.0});
+  cost_model->set_coefficients(OperatorType::TableScan, EncodingType::LZ4, CostModelCoefficients{0.0, 100.0});
+
+  const auto stored_table_node = StoredTableNode::make("table_a");
+  const auto predicate_node = PredicateNode::make(greater_than_(stored_table_node->get_column("b"), 0),
+                                                  stored_table_node);
+
+  const auto input_row_count = static_cast<Cost>(table->row_count());
+  EXPECT_FLOAT_EQ(cost_estimator().estimate_node_cost(predicate_node), input_row_count * 100.0f);
+}
+
+TEST_F(CostEstimatorCalibratedTest, LQPTranslatorChoosesCheapestJoinOperator) {
+  Hyrise::get().storage_manager.add_table("table_a", load_table("resources/test_data/tbl/int_int_float.tbl"));
+  Hyrise::get().storage_manager.add_table("table_b", load_table("resources/test_data/tbl/int_int_float.tbl"));
+
+  const auto stored_table_node_a = StoredTableNode::make("table_a");
+  const auto stored_table_node_b = StoredTableNode::make("table_b");
+  const auto join_node = JoinNode::make(JoinMode::Inner,
+                                        equals_(stored_table_node_a->get_column("a"),
+                                                stored_table_node_b->get_column("a")),
+                                        stored_table_node_a, stored_table_node_b);
+
+  // Without a cost model, JoinHash is preferred.
+  EXPECT_EQ(LQPTranslator{}.translate_node(join_node)->type(), OperatorType::JoinHash);
+
+  Hyrise::get().cost_model = cost_model;
+  EXPECT_EQ(LQPTranslator{}.translate_node(join_node)->type(), OperatorType::JoinSortMerge);
+}
+
+}  // namespace hyrise
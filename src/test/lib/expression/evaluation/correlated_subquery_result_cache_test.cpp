@@ -0,0 +1,65 @@
+#include <memory>
+
+#include "base_test.hpp"
+
+#include "expression/evaluation/correlated_subquery_result_cache.hpp"
+#include "storage/table.hpp"
+
+namespace hyrise {
+
+class CorrelatedSubqueryResultCacheTest : public BaseTest {
+ public:
+  void SetUp() override {
+    _table = load_table("resources/test_data/tbl/int_float.tbl");
+  }
+
+ protected:
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(CorrelatedSubqueryResultCacheTest, GetAndSet) {
+  auto cache = CorrelatedSubqueryResultCache{};
+  EXPECT_EQ(cache.size(), 0);
+  EXPECT_FALSE(cache.get({int32_t{1}, pmr_string{"a"}}));
+
+  EXPECT_TRUE(cache.try_set({int32_t{1}, pmr_string{"a"}}, _table));
+  EXPECT_EQ(cache.get({int32_t{1}, pmr_string{"a"}}), _table);
+  EXPECT_FALSE(cache.get({int32_t{1}, pmr_string{"b"}}));
+  EXPECT_FALSE(cache.get({int32_t{1}}));
+  EXPECT_EQ(cache.size(), 1);
+  EXPECT_GT(cache.memory_usage(), 0);
+
+  // An existing entry is not replaced.
+  const auto other_table = load_table("resources/test_data/tbl/int_float2.tbl");
+  EXPECT_FALSE(cache.try_set({int32_t{1}, pmr_string{"a"}}, other_table));
+  EXPECT_EQ(cache.get({int32_t{1}, pmr_string{"a"}}), _table);
+
+  cache.clear();
+  EXPECT_EQ(cache.size(), 0);
+  EXPECT_EQ(cache.memory_usage(), 0);
+  EXPECT_FALSE(cache.get({int32_t{1}, pmr_string{"a"}}));
+}
+
+TEST_F(CorrelatedSubqueryResultCacheTest, NullParameterValues) {
+  auto cache = CorrelatedSubqueryResultCache{};
+  EXPECT_TRUE(cache.try_set({NULL_VALUE, int32_t{2}}, _table));
+
+  EXPECT_EQ(cache.get({NULL_VALUE, int32_t{2}}), _table);
+  EXPECT_FALSE(cache.get({int32_t{0}, int32_t{2}}));
+  EXPECT_FALSE(cache.get({NULL_VALUE, NULL_VALUE}));
+}
+
+TEST_F(CorrelatedSubqueryResultCacheTest, MemoryBudget) {
+  const auto table_memory_usage = _table->memory_usage(MemoryUsageCalculationMode::Sampled);
+  auto cache = CorrelatedSubqueryResultCache{2 * table_memory_usage};
+
+  EXPECT_TRUE(cache.try_set({int32_t{1}}, _table));
+  EXPECT_TRUE(cache.try_set({int32_t{2}}, _table));
+  EXPECT_FALSE(cache.try_set({int32_t{3}}, _table));
+
+  EXPECT_EQ(cache.size(), 2);
+  EXPECT_EQ(cache.memory_usage(), 2 * table_memory_usage);
+  EXPECT_FALSE(cache.get({int32_t{3}}));
+}
+
+}  // namespace hyrise
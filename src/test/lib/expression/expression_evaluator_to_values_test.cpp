@@ -586,6 +586,29 @@ TEST_F(ExpressionEvaluatorToValuesTest, InSubqueryUncorrelatedNotPrecalculated)
   EXPECT_THROW(test_expression<int32_t>(table_a, *in_(4, subquery), {0}), std::logic_error);
 }
 
+TEST_F(ExpressionEvaluatorToValuesTest, CorrelatedSubqueryResultsAreCachedByParameterValues) {
+  // PQP that returns the current value in "c" (33, NULL, 34, NULL) plus one. The subquery is executed only once per
+  // distinct parameter value, i.e., three times.
+  const auto table_wrapper = std::make_shared<TableWrapper>(Projection::dummy_table());
+  const auto add_c = add_(correlated_parameter_(ParameterID{0}, c), 1);
+  const auto pqp = std::make_shared<Projection>(table_wrapper, expression_vector(add_c));
+  const auto subquery = pqp_subquery_(pqp, DataType::Int, true, std::make_pair(ParameterID{0}, ColumnID{2}));
+
+  EXPECT_TRUE(test_expression<int32_t>(table_a, *subquery, {34, std::nullopt, 35, std::nullopt}));
+  EXPECT_EQ(subquery->result_cache->size(), 3);
+
+  // The cached results are reused by other evaluations of the same expression.
+  EXPECT_TRUE(test_expression<int32_t>(table_a, *add_(subquery, 1), {35, std::nullopt, 36, std::nullopt}));
+  EXPECT_EQ(subquery->result_cache->size(), 3);
+
+  // Operators clear the cached results once they have been executed.
+  const auto table_wrapper_a = std::make_shared<TableWrapper>(table_a);
+  const auto table_scan = std::make_shared<TableScan>(table_wrapper_a, greater_than_(subquery, 34));
+  execute_all({table_wrapper_a, table_scan});
+  EXPECT_EQ(table_scan->get_output()->row_count(), 1);
+  EXPECT_EQ(subquery->result_cache->size(), 0);
+}
+
 TEST_F(ExpressionEvaluatorToValuesTest, InSubqueryCorrelated) {
   // PQP that returns the column "b" multiplied with the current value in "a"
   //
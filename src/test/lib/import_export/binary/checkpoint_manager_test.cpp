@@ -0,0 +1,155 @@
+#include <algorithm>
+#include <filesystem>
+#include <iterator>
+#include <memory>
+#include <set>
+#include <string>
+
+#include "base_test.hpp"
+
+#include "concurrency/transaction_context.hpp"
+#include "hyrise.hpp"
+#include "import_export/binary/checkpoint_manager.hpp"
+#include "sql/sql_pipeline_builder.hpp"
+#include "storage/table.hpp"
+
+namespace hyrise {
+
+class CheckpointManagerTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    std::filesystem::remove_all(checkpoint_directory);
+    std::filesystem::remove(log_path);
+
+    const auto column_definitions =
+        TableColumnDefinitions{{"a", DataType::Int, false}, {"b", DataType::String, true}};
+    Hyrise::get().storage_manager.add_table(
+        "t", std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{3}, UseMvcc::Yes));
+  }
+
+  void TearDown() override {
+    Hyrise::get().write_ahead_log.close();
+    std::filesystem::remove_all(checkpoint_directory);
+    std::filesystem::remove(log_path);
+  }
+
+  static std::shared_ptr<const Table> execute(const std::string& sql) {
+    const auto [status, table] = SQLPipelineBuilder{sql}.create_pipeline().get_result_table();
+    EXPECT_EQ(status, SQLPipelineStatus::Success);
+    return table;
+  }
+
+  std::set<std::string> checkpoint_files() const {
+    auto files = std::set<std::string>{};
+    for (const auto& entry : std::filesystem::recursive_directory_iterator{checkpoint_directory}) {
+      if (entry.is_regular_file()) {
+        files.emplace(entry.path().string());
+      }
+    }
+    return files;
+  }
+
+  const std::string checkpoint_directory = test_data_path + "checkpoint_manager_test";
+  const std::string log_path = test_data_path + "checkpoint_manager_test.log";
+};
+
+TEST_F(CheckpointManagerTest, LoadSnapshot) {
+  execute("INSERT INTO t VALUES (1, 'one'), (2, NULL), (3, 'three'), (4, 'four')");
+  execute("DELETE FROM t WHERE a = 2");
+  Hyrise::get().storage_manager.get_table("t")->get_chunk(ChunkID{0})->finalize();
+
+  auto checkpoint_manager = CheckpointManager{checkpoint_directory};
+  const auto snapshot_commit_id = checkpoint_manager.create_checkpoint();
+  EXPECT_EQ(snapshot_commit_id, Hyrise::get().transaction_manager.last_commit_id());
+  const auto expected_table = execute("SELECT * FROM t");
+
+  // Changes after the snapshot are not part of the checkpoint.
+  execute("INSERT INTO t VALUES (5, 'five')");
+  execute("DELETE FROM t WHERE a = 1");
+
+  Hyrise::reset();
+  EXPECT_EQ(CheckpointManager::load_checkpoint(checkpoint_directory), snapshot_commit_id);
+  EXPECT_EQ(Hyrise::get().transaction_manager.last_commit_id(), snapshot_commit_id);
+  EXPECT_TABLE_EQ_UNORDERED(execute("SELECT * FROM t"), expected_table);
+
+  // The physical layout is preserved: the first chunk is finalized, the last one can still be inserted into.
+  const auto table = Hyrise::get().storage_manager.get_table("t");
+  EXPECT_EQ(table->chunk_count(), 2);
+  EXPECT_FALSE(table->get_chunk(ChunkID{0})->is_mutable());
+  EXPECT_TRUE(table->get_chunk(ChunkID{1})->is_mutable());
+  execute("INSERT INTO t VALUES (6, 'six'), (7, 'seven')");
+  EXPECT_EQ(execute("SELECT * FROM t")->row_count(), expected_table->row_count() + 2);
+}
+
+TEST_F(CheckpointManagerTest, NoCheckpoint) {
+  EXPECT_EQ(CheckpointManager::load_checkpoint(checkpoint_directory), std::nullopt);
+}
+
+TEST_F(CheckpointManagerTest, IncrementalCheckpoints) {
+  execute("INSERT INTO t VALUES (1, 'one'), (2, 'two'), (3, 'three'), (4, 'four')");
+  Hyrise::get().storage_manager.get_table("t")->get_chunk(ChunkID{0})->finalize();
+
+  auto checkpoint_manager = CheckpointManager{checkpoint_directory};
+  checkpoint_manager.create_checkpoint();
+  const auto files = checkpoint_files();
+
+  // Nothing changed, so all files are reused.
+  checkpoint_manager.create_checkpoint();
+  EXPECT_EQ(checkpoint_files(), files);
+
+  // A delete in the finalized chunk only requires its MVCC data to be written again.
+  execute("DELETE FROM t WHERE a = 1");
+  checkpoint_manager.create_checkpoint();
+  const auto files_after_delete = checkpoint_files();
+  EXPECT_EQ(files_after_delete.size(), files.size());
+  auto changed_files = std::set<std::string>{};
+  std::set_difference(files_after_delete.begin(), files_after_delete.end(), files.begin(), files.end(),
+                      std::inserter(changed_files, changed_files.end()));
+  ASSERT_EQ(changed_files.size(), 1);
+  EXPECT_EQ(std::filesystem::path{*changed_files.begin()}.extension(), ".mvcc");
+}
+
+TEST_F(CheckpointManagerTest, RecoverWithWriteAheadLog) {
+  Hyrise::get().write_ahead_log.open(log_path);
+  execute("INSERT INTO t VALUES (1, 'one'), (2, NULL), (3, 'three'), (4, 'four')");
+
+  auto checkpoint_manager = CheckpointManager{checkpoint_directory};
+  checkpoint_manager.create_checkpoint();
+
+  execute("INSERT INTO t VALUES (5, 'five')");
+  execute("UPDATE t SET a = 10 WHERE a = 1");
+  const auto expected_table = execute("SELECT * FROM t");
+
+  // Only the transactions after the snapshot are replayed.
+  Hyrise::reset();
+  CheckpointManager::load_checkpoint(checkpoint_directory);
+  EXPECT_EQ(Hyrise::get().write_ahead_log.open(log_path), 2);
+  EXPECT_TABLE_EQ_UNORDERED(execute("SELECT * FROM t"), expected_table);
+}
+
+TEST_F(CheckpointManagerTest, PendingInsert) {
+  Hyrise::get().write_ahead_log.open(log_path);
+  execute("INSERT INTO t VALUES (1, 'one')");
+
+  // The insert has reserved its row when the checkpoint is written, but the transaction has not committed yet. Its
+  // values are not copied. They are restored from the log once the transaction has committed.
+  const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  const auto [status, _] = SQLPipelineBuilder{"INSERT INTO t VALUES (2, 'two')"}
+                               .with_transaction_context(transaction_context)
+                               .create_pipeline()
+                               .get_result_table();
+  EXPECT_EQ(status, SQLPipelineStatus::Success);
+
+  auto checkpoint_manager = CheckpointManager{checkpoint_directory};
+  checkpoint_manager.create_checkpoint();
+  transaction_context->commit();
+  const auto expected_table = execute("SELECT * FROM t");
+
+  Hyrise::reset();
+  CheckpointManager::load_checkpoint(checkpoint_directory);
+  EXPECT_EQ(execute("SELECT * FROM t")->row_count(), 1);
+  EXPECT_EQ(Hyrise::get().write_ahead_log.open(log_path), 1);
+  EXPECT_TABLE_EQ_UNORDERED(execute("SELECT * FROM t"), expected_table);
+}
+
+}  // namespace hyrise
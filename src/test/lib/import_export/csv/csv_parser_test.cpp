@@ -5,6 +5,7 @@
 #include "scheduler/immediate_execution_scheduler.hpp"
 #include "scheduler/node_queue_scheduler.hpp"
 #include "scheduler/operator_task.hpp"
+#include "storage/base_dictionary_segment.hpp"
 #include "storage/table.hpp"
 
 namespace hyrise {
@@ -306,4 +307,41 @@ TEST_F(CsvParserTest, FinalizedChunks) {
   EXPECT_FALSE(table->get_chunk(ChunkID{2})->is_mutable());
 }
 
+TEST_F(CsvParserTest, SmallBlocks) {
+  // Blocks that end within rows and within quoted fields.
+  for (const auto block_size : {size_t{1}, size_t{3}, size_t{16}, size_t{100}}) {
+    const auto table = CsvParser::parse("resources/test_data/csv/float_int_large.csv", ChunkOffset{20}, std::nullopt,
+                                        std::nullopt, block_size);
+    EXPECT_TABLE_EQ_ORDERED(table, CsvParser::parse("resources/test_data/csv/float_int_large.csv", ChunkOffset{20}));
+    EXPECT_EQ(table->chunk_count(), 5);
+    EXPECT_EQ(table->get_chunk(ChunkID{4})->size(), 20);
+
+    const auto escaped_table = CsvParser::parse("resources/test_data/csv/string_escaped.csv", ChunkOffset{3},
+                                                std::nullopt, std::nullopt, block_size);
+    EXPECT_TABLE_EQ_ORDERED(escaped_table, CsvParser::parse("resources/test_data/csv/string_escaped.csv"));
+    EXPECT_EQ(escaped_table->chunk_count(), 2);
+  }
+}
+
+TEST_F(CsvParserTest, WrongNumberOfFields) {
+  auto csv_meta = process_csv_meta_file("resources/test_data/csv/float_int.csv.json");
+  csv_meta.columns.pop_back();
+  EXPECT_THROW(CsvParser::parse("resources/test_data/csv/float_int.csv", Chunk::DEFAULT_SIZE, csv_meta),
+               std::logic_error);
+}
+
+TEST_F(CsvParserTest, EncodeChunks) {
+  const auto table = CsvParser::parse("resources/test_data/csv/float_int_large.csv", ChunkOffset{40}, std::nullopt,
+                                      SegmentEncodingSpec{EncodingType::Dictionary});
+  EXPECT_TABLE_EQ_ORDERED(table, CsvParser::parse("resources/test_data/csv/float_int_large.csv", ChunkOffset{40}));
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+    const auto& chunk = table->get_chunk(chunk_id);
+    EXPECT_FALSE(chunk->is_mutable());
+    for (auto column_id = ColumnID{0}; column_id < table->column_count(); ++column_id) {
+      EXPECT_TRUE(std::dynamic_pointer_cast<BaseDictionarySegment>(chunk->get_segment(column_id)));
+    }
+  }
+}
+
 }  // namespace hyrise
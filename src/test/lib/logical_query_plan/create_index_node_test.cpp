@@ -0,0 +1,51 @@
+#include "base_test.hpp"
+
+#include "logical_query_plan/create_index_node.hpp"
+
+namespace hyrise {
+
+class CreateIndexNodeTest : public BaseTest {
+ public:
+  void SetUp() override {
+    create_index_node = CreateIndexNode::make("some_index", "some_table", ColumnID{1}, false);
+  }
+
+  std::shared_ptr<CreateIndexNode> create_index_node;
+};
+
+TEST_F(CreateIndexNodeTest, Description) {
+  EXPECT_EQ(create_index_node->description(), "[CreateIndex] Name: 'some_index' On: 'some_table' Column: 1");
+
+  const auto create_index_node_if_not_exists = CreateIndexNode::make("some_index", "some_table", ColumnID{1}, true);
+  EXPECT_EQ(create_index_node_if_not_exists->description(),
+            "[CreateIndex] IfNotExists Name: 'some_index' On: 'some_table' Column: 1");
+}
+
+TEST_F(CreateIndexNodeTest, HashingAndEqualityCheck) {
+  EXPECT_EQ(*create_index_node, *create_index_node);
+
+  const auto different_create_index_node_a = CreateIndexNode::make("some_index2", "some_table", ColumnID{1}, false);
+  const auto different_create_index_node_b = CreateIndexNode::make("some_index", "some_table2", ColumnID{1}, false);
+  const auto different_create_index_node_c = CreateIndexNode::make("some_index", "some_table", ColumnID{0}, false);
+  const auto different_create_index_node_d = CreateIndexNode::make("some_index", "some_table", ColumnID{1}, true);
+
+  for (const auto& different_create_index_node : {different_create_index_node_a, different_create_index_node_b,
+                                                  different_create_index_node_c, different_create_index_node_d}) {
+    EXPECT_NE(*different_create_index_node, *create_index_node);
+    EXPECT_NE(different_create_index_node->hash(), create_index_node->hash());
+  }
+}
+
+TEST_F(CreateIndexNodeTest, NodeExpressions) {
+  ASSERT_EQ(create_index_node->node_expressions.size(), 0u);
+}
+
+TEST_F(CreateIndexNodeTest, Copy) {
+  EXPECT_EQ(*create_index_node, *create_index_node->deep_copy());
+}
+
+TEST_F(CreateIndexNodeTest, NoUniqueColumnCombinations) {
+  EXPECT_THROW(create_index_node->unique_column_combinations(), std::logic_error);
+}
+
+}  // namespace hyrise
@@ -80,10 +80,9 @@ TEST_F(IntersectNodeTest, ForwardUniqueColumnCombinations) {
   EXPECT_EQ(unique_column_combinations.size(), 1);
   EXPECT_TRUE(unique_column_combinations.contains({UniqueColumnCombination{{_a}}}));
 
-  if constexpr (HYRISE_DEBUG) {
-    _intersect_node->set_right_input(_mock_node2);
-    EXPECT_THROW(_intersect_node->unique_column_combinations(), std::logic_error);
-  }
+  // The right input only filters the rows of the left input. Its unique column combinations do not matter.
+  _intersect_node->set_right_input(_mock_node2);
+  EXPECT_EQ(_intersect_node->unique_column_combinations(), unique_column_combinations);
 }
 
 }  // namespace hyrise
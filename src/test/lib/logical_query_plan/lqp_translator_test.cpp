@@ -16,8 +16,10 @@
 #include "logical_query_plan/create_table_node.hpp"
 #include "logical_query_plan/drop_table_node.hpp"
 #include "logical_query_plan/dummy_table_node.hpp"
+#include "logical_query_plan/except_node.hpp"
 #include "logical_query_plan/export_node.hpp"
 #include "logical_query_plan/import_node.hpp"
+#include "logical_query_plan/intersect_node.hpp"
 #include "logical_query_plan/join_node.hpp"
 #include "logical_query_plan/limit_node.hpp"
 #include "logical_query_plan/lqp_translator.hpp"
@@ -31,6 +33,7 @@
 #include "logical_query_plan/window_node.hpp"
 #include "operators/aggregate_hash.hpp"
 #include "operators/change_meta_table.hpp"
+#include "operators/chunk_pipeline.hpp"
 #include "operators/export.hpp"
 #include "operators/get_table.hpp"
 #include "operators/import.hpp"
@@ -42,13 +45,19 @@
 #include "operators/maintenance/create_prepared_plan.hpp"
 #include "operators/maintenance/create_table.hpp"
 #include "operators/maintenance/drop_table.hpp"
+#include "operators/primary_key_lookup.hpp"
 #include "operators/product.hpp"
 #include "operators/projection.hpp"
+#include "operators/runtime_filter.hpp"
+#include "operators/set_operation_hash.hpp"
 #include "operators/sort.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
 #include "operators/union_all.hpp"
 #include "operators/union_positions.hpp"
+#include "operators/validate.hpp"
+#include "operators/window_function_evaluator.hpp"
+#include "scheduler/operator_task.hpp"
 #include "storage/chunk_encoder.hpp"
 #include "storage/index/group_key/group_key_index.hpp"
 #include "storage/prepared_plan.hpp"
@@ -592,6 +601,35 @@ TEST_F(LQPTranslatorTest, PredicateNodeIndexScanFailsWhenNotApplicable) {
   EXPECT_THROW(LQPTranslator{}.translate_node(predicate_node2), std::logic_error);
 }
 
+TEST_F(LQPTranslatorTest, PredicateNodePrimaryKeyLookup) {
+  table_int_string->add_soft_key_constraint({{ColumnID{0}}, KeyConstraintType::PRIMARY_KEY});
+  table_int_string->create_primary_key_index();
+
+  // The chain of PredicateNodes is replaced by a lookup. Predicates on other columns are still scanned.
+  // clang-format off
+  const auto lqp =
+  PredicateNode::make(not_equals_(int_string_b, "test"),
+    PredicateNode::make(equals_(int_string_a, 4),
+      ValidateNode::make(
+        int_string_node)));
+  // clang-format on
+  lqp->scan_type = ScanType::IndexScan;
+
+  const auto op = LQPTranslator{}.translate_node(lqp);
+
+  const auto table_scan_op = std::dynamic_pointer_cast<const TableScan>(op);
+  ASSERT_TRUE(table_scan_op);
+  EXPECT_EQ(*table_scan_op->predicate(), *not_equals_(PQPColumnExpression::from_table(*table_int_string, "b"), "test"));
+
+  const auto validate_op = std::dynamic_pointer_cast<const Validate>(op->left_input());
+  ASSERT_TRUE(validate_op);
+
+  const auto primary_key_lookup_op = std::dynamic_pointer_cast<const PrimaryKeyLookup>(validate_op->left_input());
+  ASSERT_TRUE(primary_key_lookup_op);
+  EXPECT_EQ(primary_key_lookup_op->table_name(), "table_int_string");
+  EXPECT_EQ(primary_key_lookup_op->values(), std::vector<AllTypeVariant>{4});
+}
+
 TEST_F(LQPTranslatorTest, ProjectionNode) {
   /**
    * Build LQP and translate to PQP
@@ -625,6 +663,43 @@ TEST_F(LQPTranslatorTest, JoinNodeToJoinHash) {
   EXPECT_EQ(join_op->mode(), JoinMode::Inner);
 }
 
+TEST_F(LQPTranslatorTest, JoinNodeWithRuntimeFilter) {
+  // clang-format off
+  const auto join_node =
+  JoinNode::make(JoinMode::Inner, equals_(int_float_b, int_float2_b),
+    PredicateNode::make(greater_than_(int_float_a, 5),
+      int_float_node),
+    int_float2_node);
+  // clang-format on
+  join_node->runtime_filter_side = LQPInputSide::Right;
+  const auto op = LQPTranslator{}.translate_node(join_node);
+
+  /**
+   * Check PQP - The filter is built from the right input and used by the GetTable and TableScan of the left input.
+   */
+  ASSERT_EQ(op->type(), OperatorType::JoinHash);
+  const auto table_scan_op = op->mutable_left_input();
+  ASSERT_EQ(table_scan_op->type(), OperatorType::TableScan);
+  const auto get_table_op = table_scan_op->mutable_left_input();
+  ASSERT_EQ(get_table_op->type(), OperatorType::GetTable);
+
+  ASSERT_EQ(table_scan_op->runtime_filters.size(), 1);
+  ASSERT_EQ(get_table_op->runtime_filters.size(), 1);
+  const auto& runtime_filter = get_table_op->runtime_filters.front().first;
+  EXPECT_EQ(table_scan_op->runtime_filters.front().first, runtime_filter);
+  EXPECT_EQ(table_scan_op->runtime_filters.front().second, ColumnID{1});
+  EXPECT_EQ(get_table_op->runtime_filters.front().second, ColumnID{1});
+  EXPECT_EQ(runtime_filter->build_operator(), op->mutable_right_input());
+  EXPECT_EQ(runtime_filter->build_column_id(), ColumnID{1});
+  EXPECT_TRUE(op->mutable_right_input()->runtime_filters.empty());
+
+  // Without the annotation of the RuntimeFilterRule, no filters are added.
+  join_node->runtime_filter_side.reset();
+  const auto op_without_filter = LQPTranslator{}.translate_node(join_node);
+  EXPECT_TRUE(op_without_filter->mutable_left_input()->runtime_filters.empty());
+  EXPECT_TRUE(op_without_filter->mutable_left_input()->mutable_left_input()->runtime_filters.empty());
+}
+
 TEST_F(LQPTranslatorTest, JoinNodeToJoinSortMerge) {
   /**
    * Build LQP and translate to PQP
@@ -1153,7 +1228,147 @@ TEST_F(LQPTranslatorTest, WindowNode) {
       rank_(window_(expression_vector(), expression_vector(), std::vector<SortMode>{}, std::move(frame)));
   const auto lqp = WindowNode::make(window_function, int_float_node);
 
-  EXPECT_THROW(LQPTranslator{}.translate_node(lqp), InvalidInputException);
+  const auto pqp = LQPTranslator{}.translate_node(lqp);
+  ASSERT_EQ(pqp->type(), OperatorType::WindowFunction);
+  const auto window_function_evaluator = std::dynamic_pointer_cast<WindowFunctionEvaluator>(pqp);
+  ASSERT_TRUE(window_function_evaluator);
+  EXPECT_TRUE(window_function_evaluator->partition_by_column_ids().empty());
+  EXPECT_TRUE(window_function_evaluator->order_by_column_ids().empty());
+  EXPECT_EQ(window_function_evaluator->function_argument_column_id(), INVALID_COLUMN_ID);
+  EXPECT_EQ(window_function_evaluator->window_function_expression()->window_function, WindowFunction::Rank);
+}
+
+TEST_F(LQPTranslatorTest, WindowNodeWithPartitionAndOrderBy) {
+  auto frame = FrameDescription{FrameType::Rows, FrameBound{1, FrameBoundType::Preceding, false},
+                                FrameBound{0, FrameBoundType::CurrentRow, false}};
+  const auto window = window_(expression_vector(int_float_b), expression_vector(int_float_a),
+                              std::vector<SortMode>{SortMode::Descending}, std::move(frame));
+  const auto lqp = WindowNode::make(sum_(int_float_a, window), int_float_node);
+
+  const auto window_function_evaluator =
+      std::dynamic_pointer_cast<WindowFunctionEvaluator>(LQPTranslator{}.translate_node(lqp));
+  ASSERT_TRUE(window_function_evaluator);
+  EXPECT_EQ(window_function_evaluator->partition_by_column_ids(), std::vector<ColumnID>{ColumnID{1}});
+  EXPECT_EQ(window_function_evaluator->order_by_column_ids(), std::vector<ColumnID>{ColumnID{0}});
+  EXPECT_EQ(window_function_evaluator->function_argument_column_id(), ColumnID{0});
+}
+
+TEST_F(LQPTranslatorTest, ChunkPipeline) {
+  /**
+   * LQP resembles:
+   *   SELECT a + 1 FROM int_float WHERE b < 500 AND a > 5;
+   */
+  // clang-format off
+  const auto lqp =
+  ProjectionNode::make(expression_vector(add_(int_float_a, 1)),
+    PredicateNode::make(greater_than_(int_float_a, 5),
+      PredicateNode::make(less_than_(int_float_b, 500),
+        int_float_node)));
+  // clang-format on
+
+  EXPECT_EQ(LQPTranslator{}.translate_node(lqp)->type(), OperatorType::Projection);
+
+  // By default, the LQPTranslator uses the global setting.
+  Hyrise::get().use_chunk_pipelines = true;
+  EXPECT_EQ(LQPTranslator{}.translate_node(lqp)->type(), OperatorType::ChunkPipeline);
+  Hyrise::get().use_chunk_pipelines = false;
+
+  const auto pqp = LQPTranslator{true}.translate_node(lqp);
+  const auto chunk_pipeline = std::dynamic_pointer_cast<ChunkPipeline>(pqp);
+  ASSERT_TRUE(chunk_pipeline);
+  EXPECT_EQ(chunk_pipeline->lqp_node, lqp);
+  ASSERT_TRUE(pqp->left_input());
+  EXPECT_EQ(pqp->left_input()->type(), OperatorType::GetTable);
+
+  const auto stages = chunk_pipeline->stages();
+  ASSERT_EQ(stages.size(), 3);
+  EXPECT_EQ(stages[0]->type(), OperatorType::TableScan);
+  EXPECT_EQ(stages[0]->lqp_node, lqp->left_input()->left_input());
+  EXPECT_EQ(stages[1]->type(), OperatorType::TableScan);
+  EXPECT_EQ(stages[2]->type(), OperatorType::Projection);
+
+  const auto& [tasks, root_operator_task] = OperatorTask::make_tasks_from_operator(pqp);
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(tasks);
+
+  const auto expected_table = std::make_shared<Table>(
+      TableColumnDefinitions{{"a + 1", DataType::Int, false}}, TableType::Data, ChunkOffset{1}, UseMvcc::No);
+  expected_table->append({12346});
+  expected_table->append({124});
+  expected_table->append({1235});
+  EXPECT_TABLE_EQ_UNORDERED(pqp->get_output(), expected_table);
+}
+
+TEST_F(LQPTranslatorTest, ChunkPipelineBreakers) {
+  /**
+   * The predicate on b is consumed by two nodes. Thus, it is executed only once and ends both pipelines.
+   *
+   *   SELECT a FROM (SELECT * FROM int_float WHERE b < 500) AS t WHERE a > 5
+   *   UNION ALL
+   *   SELECT a FROM (SELECT * FROM int_float WHERE b < 500) AS t WHERE a < 5
+   */
+  const auto shared_predicate_node = PredicateNode::make(less_than_(int_float_b, 500), int_float_node);
+
+  // clang-format off
+  const auto lqp =
+  UnionNode::make(SetOperationMode::All,
+    ProjectionNode::make(expression_vector(int_float_a),
+      PredicateNode::make(greater_than_(int_float_a, 5),
+        shared_predicate_node)),
+    ProjectionNode::make(expression_vector(int_float_a),
+      PredicateNode::make(less_than_(int_float_a, 5),
+        shared_predicate_node)));
+  // clang-format on
+
+  const auto pqp = LQPTranslator{true}.translate_node(lqp);
+  ASSERT_EQ(pqp->type(), OperatorType::UnionAll);
+
+  const auto left_pipeline = std::dynamic_pointer_cast<const ChunkPipeline>(pqp->left_input());
+  const auto right_pipeline = std::dynamic_pointer_cast<const ChunkPipeline>(pqp->right_input());
+  ASSERT_TRUE(left_pipeline);
+  ASSERT_TRUE(right_pipeline);
+  EXPECT_EQ(left_pipeline->stages().size(), 2);
+  EXPECT_EQ(right_pipeline->stages().size(), 2);
+
+  // The TableScan on b is not fused. Its single stage does not form a pipeline either.
+  ASSERT_EQ(left_pipeline->left_input(), right_pipeline->left_input());
+  EXPECT_EQ(left_pipeline->left_input()->type(), OperatorType::TableScan);
+  EXPECT_EQ(left_pipeline->left_input()->left_input()->type(), OperatorType::GetTable);
+}
+
+TEST_F(LQPTranslatorTest, SetOperations) {
+  const auto left_node = ProjectionNode::make(expression_vector(int_float_a), int_float_node);
+  const auto right_node = ProjectionNode::make(expression_vector(int_float2_a), int_float2_node);
+
+  const auto expect_set_operation_hash = [](const std::shared_ptr<AbstractOperator>& pqp,
+                                            const SetOperationType set_operation_type,
+                                            const SetOperationMode set_operation_mode) {
+    const auto set_operation = std::dynamic_pointer_cast<SetOperationHash>(pqp);
+    ASSERT_TRUE(set_operation);
+    EXPECT_EQ(set_operation->set_operation_type(), set_operation_type);
+    EXPECT_EQ(set_operation->set_operation_mode(), set_operation_mode);
+    EXPECT_EQ(set_operation->left_input()->type(), OperatorType::Projection);
+    EXPECT_EQ(set_operation->right_input()->type(), OperatorType::Projection);
+  };
+
+  expect_set_operation_hash(
+      LQPTranslator{}.translate_node(UnionNode::make(SetOperationMode::Unique, left_node, right_node)),
+      SetOperationType::Union, SetOperationMode::Unique);
+  expect_set_operation_hash(
+      LQPTranslator{}.translate_node(IntersectNode::make(SetOperationMode::Unique, left_node, right_node)),
+      SetOperationType::Intersect, SetOperationMode::Unique);
+  expect_set_operation_hash(
+      LQPTranslator{}.translate_node(IntersectNode::make(SetOperationMode::All, left_node, right_node)),
+      SetOperationType::Intersect, SetOperationMode::All);
+  expect_set_operation_hash(
+      LQPTranslator{}.translate_node(ExceptNode::make(SetOperationMode::Unique, left_node, right_node)),
+      SetOperationType::Except, SetOperationMode::Unique);
+  expect_set_operation_hash(
+      LQPTranslator{}.translate_node(ExceptNode::make(SetOperationMode::All, left_node, right_node)),
+      SetOperationType::Except, SetOperationMode::All);
+
+  // UNION ALL does not need to compare rows.
+  const auto union_all = LQPTranslator{}.translate_node(UnionNode::make(SetOperationMode::All, left_node, right_node));
+  EXPECT_EQ(union_all->type(), OperatorType::UnionAll);
 }
 
 }  // namespace hyrise
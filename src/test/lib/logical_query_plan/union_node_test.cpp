@@ -91,10 +91,21 @@ TEST_F(UnionNodeTest, InvalidInputExpressions) {
     const auto union_node = UnionNode::make(SetOperationMode::Positions, _mock_node1, _mock_node2);
     EXPECT_THROW(union_node->output_expressions(), std::logic_error);
   }
+  // The All and Unique modes only require the same number of columns.
   {
     const auto union_node = UnionNode::make(SetOperationMode::All, _mock_node1, _mock_node2);
     EXPECT_THROW(union_node->output_expressions(), std::logic_error);
   }
+  {
+    const auto union_node = UnionNode::make(SetOperationMode::Unique, _mock_node1, _mock_node2);
+    EXPECT_THROW(union_node->output_expressions(), std::logic_error);
+  }
+  {
+    const auto mock_node = MockNode::make(
+        MockNode::ColumnDefinitions{{DataType::Int, "x"}, {DataType::Int, "y"}, {DataType::Int, "z"}}, "t_c");
+    const auto union_node = UnionNode::make(SetOperationMode::Unique, _mock_node1, mock_node);
+    EXPECT_EQ(union_node->output_expressions(), _mock_node1->output_expressions());
+  }
 }
 
 TEST_F(UnionNodeTest, FunctionalDependenciesUnionAllSimple) {
@@ -259,4 +270,16 @@ TEST_F(UnionNodeTest, UniqueColumnCombinationsUnionAll) {
   EXPECT_TRUE(union_node->unique_column_combinations().empty());
 }
 
+TEST_F(UnionNodeTest, UniqueColumnCombinationsAndFunctionalDependenciesUnionUnique) {
+  const auto key_constraint_a = TableKeyConstraint{{ColumnID{0}}, KeyConstraintType::UNIQUE};
+  _mock_node1->set_key_constraints({key_constraint_a});
+  EXPECT_EQ(_mock_node1->unique_column_combinations().size(), 1);
+
+  const auto union_node = UnionNode::make(SetOperationMode::Unique, _mock_node1, _mock_node1);
+
+  // Check that neither UCCs nor FDs are forwarded.
+  EXPECT_TRUE(union_node->unique_column_combinations().empty());
+  EXPECT_TRUE(union_node->non_trivial_functional_dependencies().empty());
+}
+
 }  // namespace hyrise
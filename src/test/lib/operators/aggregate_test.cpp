@@ -10,6 +10,7 @@
 #include "base_test.hpp"
 
 #include "expression/window_function_expression.hpp"
+#include "hyrise.hpp"
 #include "operators/abstract_read_only_operator.hpp"
 #include "operators/aggregate_hash.hpp"
 #include "operators/aggregate_sort.hpp"
@@ -18,6 +19,7 @@
 #include "operators/sort.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
 #include "storage/chunk_encoder.hpp"
 #include "storage/segment_iterate.hpp"
 #include "storage/table.hpp"
@@ -34,6 +36,63 @@ TEST_F(OperatorsAggregateHashTest, EmptyHash) {
   EXPECT_EQ(std::hash<AggregateKeySmallVector>()(AggregateKeySmallVector{}), 0);
 }
 
+// Executes AggregateHash in its parallel mode. As the test tables are tiny, each chunk is pre-aggregated by a task of
+// its own (unless `min_rows_per_task` is set), and the local results are limited to `max_local_group_count` groups.
+// This way, the merge of local results (large limit), the partitioned aggregation (limit of zero), and the combination
+// of both are covered.
+template <size_t max_local_group_count, size_t min_rows_per_task = 1>
+class ParallelAggregateHash : public AggregateHash {
+ public:
+  ParallelAggregateHash(const std::shared_ptr<AbstractOperator>& input_operator,
+                        const std::vector<std::shared_ptr<WindowFunctionExpression>>& aggregates,
+                        const std::vector<ColumnID>& groupby_column_ids)
+      : AggregateHash(input_operator, aggregates, groupby_column_ids, ExecutionMode::Parallel) {
+    _max_local_group_count = max_local_group_count;
+    _min_rows_per_task = min_rows_per_task;
+  }
+};
+
+TEST_F(OperatorsAggregateHashTest, ParallelExecutionMode) {
+  Hyrise::get().topology.use_fake_numa_topology(8, 4);
+  Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+
+  const auto column_definitions = TableColumnDefinitions{
+      {"a", DataType::Int, false}, {"b", DataType::Int, false}, {"c", DataType::Double, true}};
+  const auto table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{100});
+  for (auto row = int32_t{0}; row < 10'000; ++row) {
+    const auto c = row % 7 == 0 ? AllTypeVariant{NullValue{}} : AllTypeVariant{static_cast<double>(row % 13)};
+    table->append({row % 1'000, row % 3, c});
+  }
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->never_clear_output();
+  table_wrapper->execute();
+
+  const auto c = pqp_column_(ColumnID{2}, DataType::Double, true, "c");
+  const auto aggregates = std::vector<std::shared_ptr<WindowFunctionExpression>>{
+      sum_(c), min_(c), max_(c), avg_(c), count_(c), count_distinct_(c), standard_deviation_sample_(c),
+      count_(pqp_column_(INVALID_COLUMN_ID, DataType::Long, false, "*"))};
+
+  // Each task pre-aggregates ten chunks of 100 groups each, but exceeds the limit after four of them. Thus, both the
+  // merge of local results and the partitioned aggregation of the remaining rows are exercised.
+  for (const auto& groupby_column_ids : {std::vector<ColumnID>{}, std::vector<ColumnID>{ColumnID{0}},
+                                         std::vector<ColumnID>{ColumnID{0}, ColumnID{1}}}) {
+    const auto sequential_aggregate = std::make_shared<AggregateHash>(table_wrapper, aggregates, groupby_column_ids);
+    sequential_aggregate->execute();
+
+    const auto parallel_aggregate =
+        std::make_shared<ParallelAggregateHash<300, 1'000>>(table_wrapper, aggregates, groupby_column_ids);
+    parallel_aggregate->execute();
+    EXPECT_TABLE_EQ_UNORDERED(parallel_aggregate->get_output(), sequential_aggregate->get_output());
+
+    if (!groupby_column_ids.empty()) {
+      const auto distinct = std::make_shared<ParallelAggregateHash<300, 1'000>>(
+          table_wrapper, std::vector<std::shared_ptr<WindowFunctionExpression>>{}, groupby_column_ids);
+      distinct->execute();
+      EXPECT_EQ(distinct->get_output()->row_count(), groupby_column_ids.size() == 1 ? 1'000 : 3'000);
+    }
+  }
+}
+
 template <typename T>
 void test_output(const std::shared_ptr<AbstractOperator> in,
                  const std::vector<std::pair<ColumnID, WindowFunction>>& aggregate_definitions,
@@ -198,7 +257,8 @@ class OperatorsAggregateTest : public BaseTest {
       _table_wrapper_int_int;
 };
 
-using AggregateTypes = ::testing::Types<AggregateHash, AggregateSort>;
+using AggregateTypes = ::testing::Types<AggregateHash, ParallelAggregateHash<1'000>, ParallelAggregateHash<1>,
+                                        ParallelAggregateHash<0>, AggregateSort>;
 TYPED_TEST_SUITE(OperatorsAggregateTest, AggregateTypes, );  // NOLINT(whitespace/parens)
 
 TYPED_TEST(OperatorsAggregateTest, OperatorName) {
@@ -209,7 +269,7 @@ TYPED_TEST(OperatorsAggregateTest, OperatorName) {
   auto aggregate =
       std::make_shared<TypeParam>(this->_table_wrapper_1_1, aggregate_expressions, std::vector<ColumnID>{ColumnID{0}});
 
-  if constexpr (std::is_same_v<TypeParam, AggregateHash>) {
+  if constexpr (std::is_base_of_v<AggregateHash, TypeParam>) {
     EXPECT_EQ(aggregate->name(), "AggregateHash");
   } else if constexpr (std::is_same_v<TypeParam, AggregateSort>) {
     EXPECT_EQ(aggregate->name(), "AggregateSort");
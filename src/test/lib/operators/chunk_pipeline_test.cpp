@@ -0,0 +1,179 @@
+#include <memory>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "concurrency/transaction_context.hpp"
+#include "expression/expression_functional.hpp"
+#include "hyrise.hpp"
+#include "operators/chunk_pipeline.hpp"
+#include "operators/projection.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "operators/validate.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+
+namespace hyrise {
+
+using namespace expression_functional;  // NOLINT(build/namespaces)
+
+class OperatorsChunkPipelineTest : public BaseTest {
+ public:
+  void SetUp() override {
+    // 200'000 rows in chunks of 10'000 rows, so that the ChunkPipeline creates multiple morsels. Every tenth value of
+    // b is NULL.
+    const auto column_definitions =
+        TableColumnDefinitions{{"a", DataType::Int, false}, {"b", DataType::Int, true}};
+    _table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{10'000}, UseMvcc::Yes);
+
+    constexpr auto CHUNK_SIZE = 10'000;
+    auto row_id = 0;
+    for (auto chunk_id = 0; chunk_id < 20; ++chunk_id) {
+      auto a_values = pmr_vector<int32_t>(CHUNK_SIZE);
+      auto b_values = pmr_vector<int32_t>(CHUNK_SIZE);
+      auto b_nulls = pmr_vector<bool>(CHUNK_SIZE);
+      for (auto chunk_offset = 0; chunk_offset < CHUNK_SIZE; ++chunk_offset, ++row_id) {
+        a_values[chunk_offset] = row_id % 1'000;
+        b_values[chunk_offset] = row_id / 7;
+        b_nulls[chunk_offset] = row_id % 10 == 0;
+      }
+
+      const auto segments = Segments{std::make_shared<ValueSegment<int32_t>>(std::move(a_values)),
+                                     std::make_shared<ValueSegment<int32_t>>(std::move(b_values), std::move(b_nulls))};
+      _table->append_chunk(segments, std::make_shared<MvccData>(CHUNK_SIZE, CommitID{0}));
+    }
+
+    _table_wrapper = std::make_shared<TableWrapper>(_table);
+    _table_wrapper->never_clear_output();
+    _table_wrapper->execute();
+
+    _a = pqp_column_(ColumnID{0}, DataType::Int, false, "a");
+    _b = pqp_column_(ColumnID{1}, DataType::Int, true, "b");
+  }
+
+  // Creates Validate -> TableScan -> TableScan -> Projection on top of the given input.
+  std::shared_ptr<AbstractOperator> create_stages(const std::shared_ptr<AbstractOperator>& input) const {
+    const auto validate = std::make_shared<Validate>(input);
+    const auto scan_a = std::make_shared<TableScan>(validate, less_than_(_a, 500));
+    const auto scan_b = std::make_shared<TableScan>(scan_a, greater_than_equals_(_b, 3'000));
+    return std::make_shared<Projection>(scan_b, expression_vector(_a, add_(_a, _b)));
+  }
+
+  // Executes the operators of a single-input chain, except for those that have already been executed.
+  static void execute_chain(const std::shared_ptr<AbstractOperator>& root) {
+    auto operators = std::vector<std::shared_ptr<AbstractOperator>>{};
+    for (auto op = root; op && !op->executed(); op = op->mutable_left_input()) {
+      operators.emplace_back(op);
+    }
+
+    for (auto op_iter = operators.rbegin(); op_iter != operators.rend(); ++op_iter) {
+      (*op_iter)->execute();
+    }
+  }
+
+  std::shared_ptr<ChunkPipeline> create_chunk_pipeline(const std::shared_ptr<AbstractOperator>& input) const {
+    const auto pipeline_source = std::make_shared<TableWrapper>(nullptr);
+    return std::make_shared<ChunkPipeline>(input, pipeline_source, create_stages(pipeline_source));
+  }
+
+  std::shared_ptr<Table> _table;
+  std::shared_ptr<TableWrapper> _table_wrapper;
+  std::shared_ptr<PQPColumnExpression> _a, _b;
+};
+
+TEST_F(OperatorsChunkPipelineTest, OperatorName) {
+  const auto chunk_pipeline = create_chunk_pipeline(_table_wrapper);
+
+  EXPECT_EQ(chunk_pipeline->name(), "ChunkPipeline");
+  EXPECT_EQ(chunk_pipeline->type(), OperatorType::ChunkPipeline);
+
+  const auto stages = chunk_pipeline->stages();
+  ASSERT_EQ(stages.size(), 4);
+  EXPECT_EQ(stages[0]->type(), OperatorType::Validate);
+  EXPECT_EQ(stages[1]->type(), OperatorType::TableScan);
+  EXPECT_EQ(stages[2]->type(), OperatorType::TableScan);
+  EXPECT_EQ(stages[3]->type(), OperatorType::Projection);
+}
+
+TEST_F(OperatorsChunkPipelineTest, EqualToUnfusedOperators) {
+  Hyrise::get().topology.use_fake_numa_topology(8, 4);
+  Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+
+  const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+
+  const auto unfused_root = create_stages(_table_wrapper);
+  unfused_root->set_transaction_context_recursively(transaction_context);
+  execute_chain(unfused_root);
+
+  const auto chunk_pipeline = create_chunk_pipeline(_table_wrapper);
+  chunk_pipeline->set_transaction_context(transaction_context);
+  chunk_pipeline->execute();
+
+  const auto& output = chunk_pipeline->get_output();
+  EXPECT_TABLE_EQ_UNORDERED(output, unfused_root->get_output());
+
+  // The forwarded column still references the input table.
+  ASSERT_GT(output->chunk_count(), 0);
+  const auto reference_segment =
+      std::dynamic_pointer_cast<const ReferenceSegment>(output->get_chunk(ChunkID{0})->get_segment(ColumnID{0}));
+  ASSERT_TRUE(reference_segment);
+  EXPECT_EQ(reference_segment->referenced_table(), _table);
+}
+
+TEST_F(OperatorsChunkPipelineTest, ReferenceInput) {
+  const auto input_scan = std::make_shared<TableScan>(_table_wrapper, greater_than_(_a, 100));
+  input_scan->never_clear_output();
+  input_scan->execute();
+
+  const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+
+  const auto unfused_root = create_stages(input_scan);
+  unfused_root->set_transaction_context_recursively(transaction_context);
+  execute_chain(unfused_root);
+
+  const auto chunk_pipeline = create_chunk_pipeline(input_scan);
+  chunk_pipeline->set_transaction_context(transaction_context);
+  chunk_pipeline->execute();
+
+  EXPECT_TABLE_EQ_UNORDERED(chunk_pipeline->get_output(), unfused_root->get_output());
+}
+
+TEST_F(OperatorsChunkPipelineTest, EmptyInput) {
+  const auto empty_table = std::make_shared<Table>(_table->column_definitions(), TableType::Data, std::nullopt,
+                                                   UseMvcc::Yes);
+  const auto empty_table_wrapper = std::make_shared<TableWrapper>(empty_table);
+  empty_table_wrapper->execute();
+
+  const auto chunk_pipeline = create_chunk_pipeline(empty_table_wrapper);
+  chunk_pipeline->set_transaction_context(
+      Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No));
+  chunk_pipeline->execute();
+
+  const auto& output = chunk_pipeline->get_output();
+  EXPECT_EQ(output->row_count(), 0);
+  ASSERT_EQ(output->column_count(), 2);
+  EXPECT_EQ(output->column_name(ColumnID{1}), "a + b");
+}
+
+TEST_F(OperatorsChunkPipelineTest, DeepCopyWithParameters) {
+  const auto pipeline_source = std::make_shared<TableWrapper>(nullptr);
+  const auto scan = std::make_shared<TableScan>(pipeline_source, less_than_(_a, placeholder_(ParameterID{0})));
+  const auto projection = std::make_shared<Projection>(scan, expression_vector(_b));
+  const auto chunk_pipeline = std::make_shared<ChunkPipeline>(_table_wrapper, pipeline_source, projection);
+
+  const auto copied_pipeline = chunk_pipeline->deep_copy();
+  copied_pipeline->set_parameters({{ParameterID{0}, AllTypeVariant{2}}});
+  execute_chain(copied_pipeline);
+
+  // a is 0 or 1 in 400 rows.
+  const auto& output = copied_pipeline->get_output();
+  EXPECT_EQ(output->row_count(), 400);
+  EXPECT_EQ(output->column_count(), 1);
+  EXPECT_TRUE(output->column_is_nullable(ColumnID{0}));
+  EXPECT_FALSE(chunk_pipeline->executed());
+}
+
+}  // namespace hyrise
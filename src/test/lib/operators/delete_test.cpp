@@ -78,6 +78,9 @@ void OperatorsDeleteTest::helper(bool commit) {
   EXPECT_EQ(_table->get_chunk(ChunkID{0})->mvcc_data()->get_tid(ChunkOffset{0}), expected_tid);
   EXPECT_EQ(_table->get_chunk(ChunkID{0})->mvcc_data()->get_tid(ChunkOffset{1}), 0u);
   EXPECT_EQ(_table->get_chunk(ChunkID{0})->mvcc_data()->get_tid(ChunkOffset{2}), expected_tid);
+
+  // Only committed deletes count as modifications.
+  EXPECT_EQ(_table->modified_row_count(), commit ? 2 : 0);
 }
 
 TEST_F(OperatorsDeleteTest, ExecuteAndCommit) {
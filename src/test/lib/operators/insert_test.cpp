@@ -7,12 +7,16 @@
 #include "concurrency/transaction_context.hpp"
 #include "expression/expression_functional.hpp"
 #include "hyrise.hpp"
+#include "operators/delete.hpp"
 #include "operators/get_table.hpp"
 #include "operators/insert.hpp"
 #include "operators/projection.hpp"
+#include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
 #include "operators/validate.hpp"
 #include "storage/chunk_encoder.hpp"
+#include "storage/index/adaptive_radix_tree/primary_key_index.hpp"
+#include "storage/index/partial_hash/partial_hash_index.hpp"
 #include "storage/table.hpp"
 
 namespace hyrise {
@@ -110,6 +114,47 @@ TEST_F(OperatorsInsertTest, MultipleChunks) {
   EXPECT_EQ(table->row_count(), 13u);
 }
 
+TEST_F(OperatorsInsertTest, CompletedChunks) {
+  const auto column_definitions = TableColumnDefinitions{{"a", DataType::Int, false}};
+  const auto table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{3}, UseMvcc::Yes);
+  Hyrise::get().storage_manager.add_table("target_table", table);
+  table->create_table_index(ColumnID{0}, "a_index");
+
+  const auto values_to_insert = std::make_shared<Table>(column_definitions, TableType::Data);
+  for (auto value = int32_t{0}; value < 7; ++value) {
+    values_to_insert->append({value});
+  }
+  const auto table_wrapper = std::make_shared<TableWrapper>(values_to_insert);
+  table_wrapper->execute();
+
+  const auto insert = std::make_shared<Insert>("target_table", table_wrapper);
+  const auto context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  insert->set_transaction_context(context);
+  insert->execute();
+
+  // Rows are only counted as modified once the Insert is committed.
+  ASSERT_EQ(table->chunk_count(), 3);
+  EXPECT_EQ(table->modified_row_count(), 0);
+
+  context->commit();
+  EXPECT_EQ(table->modified_row_count(), 7);
+
+  // The full chunks are completed, but the Insert neither finalizes them nor generates their pruning statistics, which
+  // requires an immutable chunk (see StatisticsMaintenancePlugin).
+  for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+    EXPECT_TRUE(table->get_chunk(chunk_id)->is_mutable());
+    EXPECT_FALSE(table->get_chunk(chunk_id)->pruning_statistics());
+  }
+
+  // The completed chunks are added to the table indexes, though.
+  const auto table_indexes = table->get_table_indexes(ColumnID{0});
+  ASSERT_EQ(table_indexes.size(), 1);
+  const auto indexed_chunk_ids = table_indexes.front()->get_indexed_chunk_ids();
+  EXPECT_EQ(indexed_chunk_ids.size(), 2);
+  EXPECT_TRUE(indexed_chunk_ids.contains(ChunkID{0}));
+  EXPECT_TRUE(indexed_chunk_ids.contains(ChunkID{1}));
+}
+
 TEST_F(OperatorsInsertTest, CompressedChunks) {
   auto table_name = "test1";
   auto table_name2 = "test2";
@@ -320,4 +365,84 @@ TEST_F(OperatorsInsertTest, InsertIntoEmptyTable) {
   EXPECT_TABLE_EQ_ORDERED(target_table, table_int_float);
 }
 
+TEST_F(OperatorsInsertTest, PrimaryKeyIndex) {
+  // Column a of int_int.tbl contains 12345, 123, and 1234.
+  const auto table = load_table("resources/test_data/tbl/int_int.tbl");
+  table->add_soft_key_constraint({{ColumnID{0}}, KeyConstraintType::PRIMARY_KEY});
+  Hyrise::get().storage_manager.add_table("target_table", table);
+  table->create_primary_key_index();
+  const auto& primary_key_index = *table->primary_key_index();
+
+  const auto insert_rows = [&](const std::vector<std::vector<AllTypeVariant>>& rows,
+                               const std::shared_ptr<TransactionContext>& context) {
+    const auto input_table = std::make_shared<Table>(table->column_definitions(), TableType::Data);
+    for (const auto& row : rows) {
+      input_table->append(row);
+    }
+    const auto table_wrapper = std::make_shared<TableWrapper>(input_table);
+    table_wrapper->execute();
+
+    const auto insert = std::make_shared<Insert>("target_table", table_wrapper);
+    insert->set_transaction_context(context);
+    insert->execute();
+    return insert;
+  };
+
+  // New keys are added to the index and removed again on rollback.
+  auto context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  const auto insert = insert_rows({{17, 1}, {18, 2}}, context);
+  EXPECT_FALSE(insert->execute_failed());
+  EXPECT_EQ(primary_key_index.lookup({17}), (std::vector<RowID>{RowID{ChunkID{1}, ChunkOffset{0}}}));
+  EXPECT_EQ(primary_key_index.key_count(), 5);
+  context->rollback(RollbackReason::User);
+  EXPECT_TRUE(primary_key_index.lookup({17}).empty());
+  EXPECT_EQ(primary_key_index.key_count(), 3);
+
+  // Duplicate keys let the Insert fail. The keys of the other inserted rows are removed when rolling back.
+  context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  const auto failed_insert = insert_rows({{19, 1}, {123, 2}}, context);
+  EXPECT_TRUE(failed_insert->execute_failed());
+  context->rollback(RollbackReason::Conflict);
+  EXPECT_TRUE(primary_key_index.lookup({19}).empty());
+  EXPECT_EQ(primary_key_index.lookup({123}), (std::vector<RowID>{RowID{ChunkID{0}, ChunkOffset{1}}}));
+
+  // A row can be replaced by a row with the same key within a transaction, e.g., by an UPDATE. The index holds both
+  // versions.
+  context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  const auto get_table = std::make_shared<GetTable>("target_table");
+  const auto validate = std::make_shared<Validate>(get_table);
+  const auto table_scan =
+      std::make_shared<TableScan>(validate, equals_(pqp_column_(ColumnID{0}, DataType::Int, false, "a"), 123));
+  const auto delete_operator = std::make_shared<Delete>(table_scan);
+  validate->set_transaction_context(context);
+  delete_operator->set_transaction_context(context);
+  get_table->execute();
+  validate->execute();
+  table_scan->execute();
+  delete_operator->execute();
+  EXPECT_FALSE(delete_operator->execute_failed());
+
+  const auto update_insert = insert_rows({{123, 5}}, context);
+  EXPECT_FALSE(update_insert->execute_failed());
+  context->commit();
+  EXPECT_EQ(primary_key_index.lookup({123}).size(), 2);
+
+  // When the next Delete commits, the old version is removed as no active transaction can see it anymore. The row
+  // deleted by this Delete is kept, as the deleting transaction itself is still active.
+  context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  const auto get_table_2 = std::make_shared<GetTable>("target_table");
+  const auto validate_2 = std::make_shared<Validate>(get_table_2);
+  const auto table_scan_2 =
+      std::make_shared<TableScan>(validate_2, equals_(pqp_column_(ColumnID{0}, DataType::Int, false, "a"), 1234));
+  const auto delete_operator_2 = std::make_shared<Delete>(table_scan_2);
+  validate_2->set_transaction_context(context);
+  delete_operator_2->set_transaction_context(context);
+  execute_all({get_table_2, validate_2, table_scan_2, delete_operator_2});
+  context->commit();
+  const auto row_ids = primary_key_index.lookup({123});
+  ASSERT_EQ(row_ids.size(), 1);
+  EXPECT_NE(row_ids.front(), (RowID{ChunkID{0}, ChunkOffset{1}}));
+  EXPECT_EQ(primary_key_index.lookup({1234}).size(), 1);
+}
+
 }  // namespace hyrise
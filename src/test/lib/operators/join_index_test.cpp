@@ -7,6 +7,7 @@
 #include "base_test.hpp"
 
 #include "all_type_variant.hpp"
+#include "magic_enum.hpp"
 #include "operators/join_index.hpp"
 #include "operators/join_verification.hpp"
 #include "operators/table_scan.hpp"
@@ -274,4 +275,46 @@ TEST_F(OperatorsJoinIndexTest, RightJoinPruneInputIsRefIndexInputIsDataIndexSide
                    1, true);
 }
 
+TEST_F(OperatorsJoinIndexTest, TableIndex) {
+  // Both chunks of the right input are complete and covered by the table index.
+  const auto right_table = load_table("resources/test_data/tbl/int_float2.tbl", ChunkOffset{2});
+  right_table->create_table_index(ColumnID{0}, "");
+  const auto right_input = std::make_shared<TableWrapper>(right_table);
+  right_input->execute();
+
+  for (const auto mode : {JoinMode::Inner, JoinMode::Left, JoinMode::Right, JoinMode::FullOuter, JoinMode::Semi,
+                          JoinMode::AntiNullAsFalse}) {
+    SCOPED_TRACE(std::string{magic_enum::enum_name(mode)});
+    test_join_output(_table_wrapper_a, right_input, {{ColumnID{0}, ColumnID{0}}, PredicateCondition::Equals}, mode, 1);
+  }
+
+  // Reference tables on the index side use the table index of the referenced table.
+  const auto scan = create_table_scan(right_input, ColumnID{0}, PredicateCondition::GreaterThanEquals, 0);
+  scan->execute();
+  test_join_output(_table_wrapper_a, scan, {{ColumnID{0}, ColumnID{0}}, PredicateCondition::Equals}, JoinMode::Inner,
+                   1);
+}
+
+TEST_F(OperatorsJoinIndexTest, TableIndexCoveringSomeChunks) {
+  // The second chunk is not complete and thus not indexed. It is joined using the fallback nested loop join.
+  const auto right_table = load_table("resources/test_data/tbl/int_float.tbl", ChunkOffset{2});
+  right_table->create_table_index(ColumnID{0}, "");
+  const auto right_input = std::make_shared<TableWrapper>(right_table);
+  right_input->never_clear_output();
+  right_input->execute();
+
+  const auto primary_predicate = OperatorJoinPredicate{{ColumnID{0}, ColumnID{0}}, PredicateCondition::Equals};
+  const auto join_verification =
+      std::make_shared<JoinVerification>(_table_wrapper_b, right_input, JoinMode::Inner, primary_predicate);
+  join_verification->execute();
+
+  const auto join = std::make_shared<JoinIndex>(_table_wrapper_b, right_input, JoinMode::Inner, primary_predicate);
+  join->execute();
+  EXPECT_TABLE_EQ_UNORDERED(join->get_output(), join_verification->get_output());
+
+  const auto& performance_data = static_cast<const JoinIndex::PerformanceData&>(*join->performance_data);
+  EXPECT_EQ(performance_data.chunks_scanned_with_index, 1);
+  EXPECT_EQ(performance_data.chunks_scanned_without_index, 1);
+}
+
 }  // namespace hyrise
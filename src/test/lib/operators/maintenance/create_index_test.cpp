@@ -0,0 +1,82 @@
+#include <memory>
+
+#include "base_test.hpp"
+
+#include "hyrise.hpp"
+#include "operators/maintenance/create_index.hpp"
+#include "sql/sql_plan_cache.hpp"
+#include "storage/table.hpp"
+
+namespace hyrise {
+
+class CreateIndexTest : public BaseTest {
+ public:
+  void SetUp() override {
+    // Two complete chunks and one mutable chunk that is not full yet.
+    table = load_table("resources/test_data/tbl/int_int_int_null.tbl", ChunkOffset{2});
+    Hyrise::get().storage_manager.add_table("t", table);
+  }
+
+  std::shared_ptr<Table> table;
+};
+
+TEST_F(CreateIndexTest, NameAndDescription) {
+  const auto create_index = std::make_shared<CreateIndex>("idx", "t", ColumnID{1}, false);
+  EXPECT_EQ(create_index->name(), "CreateIndex");
+  EXPECT_EQ(create_index->description(DescriptionMode::SingleLine), "CreateIndex 'idx' on 't'");
+}
+
+TEST_F(CreateIndexTest, Execute) {
+  const auto create_index = std::make_shared<CreateIndex>("idx", "t", ColumnID{1}, false);
+  EXPECT_FALSE(create_index->index_exists());
+  create_index->execute();
+  EXPECT_TRUE(create_index->executed());
+  EXPECT_FALSE(create_index->get_output());
+  EXPECT_TRUE(create_index->index_exists());
+
+  const auto table_indexes_statistics = table->table_indexes_statistics();
+  ASSERT_EQ(table_indexes_statistics.size(), 1);
+  EXPECT_EQ(table_indexes_statistics[0].name, "idx");
+  EXPECT_EQ(table_indexes_statistics[0].column_ids, std::vector<ColumnID>{ColumnID{1}});
+  EXPECT_EQ(table->get_table_indexes(ColumnID{1}).size(), 1);
+
+  // Creating an index with the same name fails.
+  EXPECT_THROW(std::make_shared<CreateIndex>("idx", "t", ColumnID{0}, false)->execute(), std::logic_error);
+}
+
+TEST_F(CreateIndexTest, ExecuteWithIfNotExists) {
+  std::make_shared<CreateIndex>("idx", "t", ColumnID{1}, false)->execute();
+
+  const auto create_index_if_not_exists = std::make_shared<CreateIndex>("idx", "t", ColumnID{0}, true);
+  EXPECT_NO_THROW(create_index_if_not_exists->execute());
+  EXPECT_EQ(table->table_indexes_statistics().size(), 1);
+
+  // Unnamed indexes exist if there is an index on the same column.
+  EXPECT_TRUE(std::make_shared<CreateIndex>("", "t", ColumnID{1}, true)->index_exists());
+  EXPECT_FALSE(std::make_shared<CreateIndex>("", "t", ColumnID{0}, true)->index_exists());
+}
+
+TEST_F(CreateIndexTest, ClearsPlanCaches) {
+  const auto lqp_cache = std::make_shared<SQLLogicalPlanCache>();
+  const auto pqp_cache = std::make_shared<SQLPhysicalPlanCache>();
+  Hyrise::get().default_lqp_cache = lqp_cache;
+  Hyrise::get().default_pqp_cache = pqp_cache;
+  lqp_cache->set("SELECT 1", nullptr);
+  pqp_cache->set("SELECT 1", nullptr);
+
+  std::make_shared<CreateIndex>("idx", "t", ColumnID{1}, false)->execute();
+  EXPECT_EQ(lqp_cache->size(), 0);
+  EXPECT_EQ(pqp_cache->size(), 0);
+}
+
+TEST_F(CreateIndexTest, DeepCopy) {
+  const auto create_index = std::make_shared<CreateIndex>("idx", "t", ColumnID{1}, true);
+  const auto copy = std::dynamic_pointer_cast<CreateIndex>(create_index->deep_copy());
+  ASSERT_TRUE(copy);
+  EXPECT_EQ(copy->index_name, "idx");
+  EXPECT_EQ(copy->table_name, "t");
+  EXPECT_EQ(copy->column_id, ColumnID{1});
+  EXPECT_TRUE(copy->if_not_exists);
+}
+
+}  // namespace hyrise
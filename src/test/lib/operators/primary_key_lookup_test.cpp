@@ -0,0 +1,88 @@
+#include <memory>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "hyrise.hpp"
+#include "operators/primary_key_lookup.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+
+namespace hyrise {
+
+class OperatorsPrimaryKeyLookupTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // The primary key (a, c) is unique, column a alone is not.
+    _table = load_table("resources/test_data/tbl/int_int_int.tbl", ChunkOffset{2});
+    _table->add_soft_key_constraint({{ColumnID{0}, ColumnID{2}}, KeyConstraintType::PRIMARY_KEY});
+    Hyrise::get().storage_manager.add_table("table", _table);
+    _table->create_primary_key_index();
+  }
+
+  std::shared_ptr<const Table> _execute(const std::vector<AllTypeVariant>& values,
+                                        const std::vector<ColumnID>& pruned_column_ids = {}) {
+    const auto primary_key_lookup = std::make_shared<PrimaryKeyLookup>("table", values, pruned_column_ids);
+    primary_key_lookup->execute();
+    return primary_key_lookup->get_output();
+  }
+
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(OperatorsPrimaryKeyLookupTest, LookUpKey) {
+  const auto result = _execute({11, 11});
+  EXPECT_EQ(result->type(), TableType::References);
+
+  const auto expected_table = std::make_shared<Table>(_table->column_definitions(), TableType::Data);
+  expected_table->append({11, 10, 11});
+  EXPECT_TABLE_EQ_ORDERED(result, expected_table);
+
+  ASSERT_EQ(result->chunk_count(), 1);
+  const auto reference_segment =
+      std::dynamic_pointer_cast<const ReferenceSegment>(result->get_chunk(ChunkID{0})->get_segment(ColumnID{0}));
+  ASSERT_TRUE(reference_segment);
+  EXPECT_EQ(reference_segment->referenced_table(), _table);
+  EXPECT_TRUE(reference_segment->pos_list()->references_single_chunk());
+  EXPECT_EQ((*reference_segment->pos_list())[ChunkOffset{0}], (RowID{ChunkID{1}, ChunkOffset{0}}));
+}
+
+TEST_F(OperatorsPrimaryKeyLookupTest, MissingKey) {
+  EXPECT_EQ(_execute({11, 10})->row_count(), 0);
+  EXPECT_EQ(_execute({9.5f, 11})->row_count(), 0);
+  EXPECT_EQ(_execute({NULL_VALUE, 11})->row_count(), 0);
+  EXPECT_EQ(_execute({int64_t{11}, 11})->row_count(), 1);
+}
+
+TEST_F(OperatorsPrimaryKeyLookupTest, PrunedColumns) {
+  const auto result = _execute({11, 11}, {ColumnID{1}});
+  const auto expected_table = std::make_shared<Table>(
+      TableColumnDefinitions{{"a", DataType::Int, false}, {"c", DataType::Int, false}}, TableType::Data);
+  expected_table->append({11, 11});
+  EXPECT_TABLE_EQ_ORDERED(result, expected_table);
+}
+
+TEST_F(OperatorsPrimaryKeyLookupTest, Description) {
+  const auto primary_key_lookup = std::make_shared<PrimaryKeyLookup>("table", std::vector<AllTypeVariant>{11, 11});
+  EXPECT_EQ(primary_key_lookup->description(DescriptionMode::SingleLine), "PrimaryKeyLookup (table) Key: (11, 11)");
+  EXPECT_EQ(primary_key_lookup->description(DescriptionMode::MultiLine), "PrimaryKeyLookup\n(table)\nKey: (11, 11)");
+}
+
+TEST_F(OperatorsPrimaryKeyLookupTest, DeepCopy) {
+  const auto primary_key_lookup =
+      std::make_shared<PrimaryKeyLookup>("table", std::vector<AllTypeVariant>{11, 11}, std::vector{ColumnID{1}});
+  const auto copy = std::static_pointer_cast<PrimaryKeyLookup>(primary_key_lookup->deep_copy());
+  EXPECT_EQ(copy->table_name(), "table");
+  EXPECT_EQ(copy->values(), primary_key_lookup->values());
+  EXPECT_EQ(copy->pruned_column_ids(), std::vector{ColumnID{1}});
+}
+
+TEST_F(OperatorsPrimaryKeyLookupTest, TableWithoutIndex) {
+  Hyrise::get().storage_manager.add_table("table_without_index", load_table("resources/test_data/tbl/int_int.tbl"));
+  const auto primary_key_lookup =
+      std::make_shared<PrimaryKeyLookup>("table_without_index", std::vector<AllTypeVariant>{123});
+  EXPECT_THROW(primary_key_lookup->execute(), std::logic_error);
+}
+
+}  // namespace hyrise
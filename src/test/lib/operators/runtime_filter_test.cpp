@@ -0,0 +1,253 @@
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "concurrency/transaction_context.hpp"
+#include "expression/expression_functional.hpp"
+#include "hyrise.hpp"
+#include "operators/get_table.hpp"
+#include "operators/join_hash.hpp"
+#include "operators/runtime_filter.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "operators/validate.hpp"
+#include "scheduler/operator_task.hpp"
+#include "storage/pos_lists/entire_chunk_pos_list.hpp"
+#include "storage/pos_lists/row_id_pos_list.hpp"
+#include "storage/table.hpp"
+
+namespace hyrise {
+
+using namespace expression_functional;  // NOLINT(build/namespaces)
+
+class RuntimeFilterTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // Three chunks holding 12345, 123, and 1234 in column a.
+    _probe_table = load_table("resources/test_data/tbl/int_float.tbl", ChunkOffset{1});
+    Hyrise::get().storage_manager.add_table("int_float", _probe_table);
+  }
+
+  std::shared_ptr<TableWrapper> create_build_operator(const std::vector<AllTypeVariant>& values) {
+    const auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, true}}, TableType::Data,
+                                               ChunkOffset{2});
+    for (const auto& value : values) {
+      table->append({value});
+    }
+
+    return std::make_shared<TableWrapper>(table);
+  }
+
+  std::vector<int32_t> values_of_column_a(const std::shared_ptr<const Table>& table) {
+    auto values = std::vector<int32_t>{};
+    for (auto row_id = size_t{0}; row_id < table->row_count(); ++row_id) {
+      values.emplace_back(table->get_value<int32_t>(ColumnID{0}, row_id).value());
+    }
+    std::sort(values.begin(), values.end());
+    return values;
+  }
+
+  std::shared_ptr<Table> _probe_table;
+};
+
+TEST_F(RuntimeFilterTest, BlockedBloomFilterSize) {
+  EXPECT_EQ(BlockedBloomFilter{0}.block_count(), 1);
+  EXPECT_EQ(BlockedBloomFilter{32}.block_count(), 1);
+  EXPECT_EQ(BlockedBloomFilter{100}.block_count(), 4);
+  EXPECT_EQ(BlockedBloomFilter{1'000'000'000}.block_count(), BlockedBloomFilter::MAX_BLOCK_COUNT);
+}
+
+TEST_F(RuntimeFilterTest, BlockedBloomFilterContainsInsertedElements) {
+  constexpr auto ELEMENT_COUNT = int32_t{10'000};
+  auto bloom_filter = BlockedBloomFilter{ELEMENT_COUNT};
+  for (auto value = int32_t{0}; value < ELEMENT_COUNT; ++value) {
+    bloom_filter.insert(BlockedBloomFilter::hash(value));
+  }
+
+  for (auto value = int32_t{0}; value < ELEMENT_COUNT; ++value) {
+    EXPECT_TRUE(bloom_filter.might_contain(BlockedBloomFilter::hash(value)));
+  }
+
+  // The false positive rate is about 0.1% for 16 bits per element, allow for a few more.
+  auto false_positive_count = 0;
+  for (auto value = ELEMENT_COUNT; value < 11 * ELEMENT_COUNT; ++value) {
+    false_positive_count += bloom_filter.might_contain(BlockedBloomFilter::hash(value)) ? 1 : 0;
+  }
+  EXPECT_LT(false_positive_count, 10 * ELEMENT_COUNT / 100);
+}
+
+TEST_F(RuntimeFilterTest, HashOfEqualValues) {
+  EXPECT_EQ(BlockedBloomFilter::hash(0.0f), BlockedBloomFilter::hash(-0.0f));
+  EXPECT_EQ(BlockedBloomFilter::hash(0.0), BlockedBloomFilter::hash(-0.0));
+  EXPECT_EQ(BlockedBloomFilter::hash(pmr_string{"abc"}), BlockedBloomFilter::hash(pmr_string{"abc"}));
+  EXPECT_NE(BlockedBloomFilter::hash(pmr_string{"abc"}), BlockedBloomFilter::hash(pmr_string{"abd"}));
+  EXPECT_NE(BlockedBloomFilter::hash(int32_t{1}), BlockedBloomFilter::hash(int32_t{2}));
+}
+
+TEST_F(RuntimeFilterTest, BuildRequiresExecutedBuildOperator) {
+  const auto build_operator = create_build_operator({123, 12345, NULL_VALUE});
+  const auto runtime_filter = std::make_shared<RuntimeFilter>(build_operator, ColumnID{0});
+  EXPECT_FALSE(runtime_filter->try_build());
+
+  build_operator->execute();
+  EXPECT_TRUE(runtime_filter->try_build());
+  EXPECT_TRUE(runtime_filter->try_build());
+  EXPECT_EQ(runtime_filter->build_row_count(), 2);
+}
+
+TEST_F(RuntimeFilterTest, FilterPositions) {
+  const auto build_operator = create_build_operator({123, 12345, NULL_VALUE});
+  build_operator->execute();
+  const auto runtime_filter = std::make_shared<RuntimeFilter>(build_operator, ColumnID{0});
+  ASSERT_TRUE(runtime_filter->try_build());
+
+  const auto table = load_table("resources/test_data/tbl/int_float.tbl", ChunkOffset{3});
+  const auto& segment = *table->get_chunk(ChunkID{0})->get_segment(ColumnID{0});
+
+  // 1234 lies between the minimum and the maximum of the build side and is dropped by the Bloom filter.
+  const auto expected_positions = RowIDPosList{RowID{ChunkID{0}, ChunkOffset{0}}, RowID{ChunkID{0}, ChunkOffset{1}}};
+  {
+    const auto positions = std::make_shared<EntireChunkPosList>(ChunkID{0}, ChunkOffset{3});
+    const auto matches = runtime_filter->filter(segment, positions);
+    ASSERT_TRUE(matches);
+    EXPECT_EQ(*matches, expected_positions);
+    EXPECT_TRUE(matches->references_single_chunk());
+  }
+  {
+    auto positions = std::make_shared<RowIDPosList>(RowIDPosList{
+        RowID{ChunkID{0}, ChunkOffset{0}}, RowID{ChunkID{0}, ChunkOffset{1}}, RowID{ChunkID{0}, ChunkOffset{2}}});
+    positions->guarantee_single_chunk();
+    const auto matches = runtime_filter->filter(segment, positions);
+    ASSERT_TRUE(matches);
+    EXPECT_EQ(*matches, expected_positions);
+  }
+  {
+    // If all positions pass, no new positions are created.
+    auto positions = std::make_shared<RowIDPosList>(RowIDPosList{RowID{ChunkID{0}, ChunkOffset{1}}});
+    positions->guarantee_single_chunk();
+    EXPECT_FALSE(runtime_filter->filter(segment, positions));
+  }
+}
+
+TEST_F(RuntimeFilterTest, EmptyBuildSide) {
+  const auto build_operator = create_build_operator({NULL_VALUE});
+  build_operator->execute();
+  const auto runtime_filter = std::make_shared<RuntimeFilter>(build_operator, ColumnID{0});
+  ASSERT_TRUE(runtime_filter->try_build());
+  EXPECT_EQ(runtime_filter->build_row_count(), 0);
+
+  const auto& chunk = *_probe_table->get_chunk(ChunkID{0});
+  EXPECT_TRUE(runtime_filter->can_prune(*(*chunk.pruning_statistics())[0]));
+
+  const auto positions = std::make_shared<EntireChunkPosList>(ChunkID{0}, ChunkOffset{1});
+  const auto matches = runtime_filter->filter(*chunk.get_segment(ColumnID{0}), positions);
+  ASSERT_TRUE(matches);
+  EXPECT_TRUE(matches->empty());
+}
+
+TEST_F(RuntimeFilterTest, GetTablePrunesChunks) {
+  const auto build_operator = create_build_operator({123, 124});
+  build_operator->execute();
+
+  const auto get_table = std::make_shared<GetTable>("int_float");
+  get_table->runtime_filters.emplace_back(std::make_shared<RuntimeFilter>(build_operator, ColumnID{0}), ColumnID{0});
+  get_table->execute();
+
+  EXPECT_EQ(get_table->get_output()->chunk_count(), 1);
+  EXPECT_EQ(values_of_column_a(get_table->get_output()), std::vector<int32_t>{123});
+}
+
+TEST_F(RuntimeFilterTest, GetTableIgnoresFilterOfUnexecutedBuildOperator) {
+  const auto build_operator = create_build_operator({123, 124});
+
+  const auto get_table = std::make_shared<GetTable>("int_float");
+  get_table->runtime_filters.emplace_back(std::make_shared<RuntimeFilter>(build_operator, ColumnID{0}), ColumnID{0});
+  get_table->execute();
+
+  EXPECT_EQ(get_table->get_output()->chunk_count(), 3);
+}
+
+TEST_F(RuntimeFilterTest, TableScanFiltersRows) {
+  const auto build_operator = create_build_operator({123, 12345});
+  build_operator->execute();
+
+  const auto get_table = std::make_shared<GetTable>("int_float");
+  get_table->execute();
+  const auto a = pqp_column_(ColumnID{0}, DataType::Int, false, "a");
+  const auto table_scan = std::make_shared<TableScan>(get_table, greater_than_(a, 200));
+  table_scan->runtime_filters.emplace_back(std::make_shared<RuntimeFilter>(build_operator, ColumnID{0}), ColumnID{0});
+  table_scan->execute();
+
+  EXPECT_EQ(values_of_column_a(table_scan->get_output()), std::vector<int32_t>{12345});
+}
+
+TEST_F(RuntimeFilterTest, ValidateFiltersRows) {
+  const auto build_operator = create_build_operator({123, 12345});
+  build_operator->execute();
+
+  const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  const auto get_table = std::make_shared<GetTable>("int_float");
+  get_table->set_transaction_context(transaction_context);
+  get_table->execute();
+  const auto validate = std::make_shared<Validate>(get_table);
+  validate->set_transaction_context(transaction_context);
+  validate->runtime_filters.emplace_back(std::make_shared<RuntimeFilter>(build_operator, ColumnID{0}), ColumnID{0});
+  validate->execute();
+
+  EXPECT_EQ(values_of_column_a(validate->get_output()), (std::vector<int32_t>{123, 12345}));
+}
+
+TEST_F(RuntimeFilterTest, JoinWithRuntimeFilter) {
+  // The build operator is scheduled before the operators that use the filter, which thus drop rows without a join
+  // partner. The join result is not affected.
+  const auto build_operator = create_build_operator({123, 1234, 1235});
+  const auto runtime_filter = std::make_shared<RuntimeFilter>(build_operator, ColumnID{0});
+  const auto get_table = std::make_shared<GetTable>("int_float");
+  get_table->runtime_filters.emplace_back(runtime_filter, ColumnID{0});
+  const auto a = pqp_column_(ColumnID{0}, DataType::Int, false, "a");
+  const auto table_scan = std::make_shared<TableScan>(get_table, greater_than_(a, 0));
+  table_scan->runtime_filters.emplace_back(runtime_filter, ColumnID{0});
+  const auto join = std::make_shared<JoinHash>(
+      table_scan, build_operator, JoinMode::Semi,
+      OperatorJoinPredicate{ColumnIDPair(ColumnID{0}, ColumnID{0}), PredicateCondition::Equals});
+  get_table->never_clear_output();
+  table_scan->never_clear_output();
+
+  const auto& [tasks, _] = OperatorTask::make_tasks_from_operator(join);
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(tasks);
+
+  EXPECT_EQ(get_table->get_output()->chunk_count(), 2);
+  EXPECT_EQ(values_of_column_a(table_scan->get_output()), (std::vector<int32_t>{123, 1234}));
+  EXPECT_EQ(values_of_column_a(join->get_output()), (std::vector<int32_t>{123, 1234}));
+}
+
+TEST_F(RuntimeFilterTest, DeepCopy) {
+  const auto build_operator = create_build_operator({123});
+  const auto runtime_filter = std::make_shared<RuntimeFilter>(build_operator, ColumnID{0});
+  const auto get_table = std::make_shared<GetTable>("int_float");
+  get_table->runtime_filters.emplace_back(runtime_filter, ColumnID{0});
+  const auto a = pqp_column_(ColumnID{0}, DataType::Int, false, "a");
+  const auto table_scan = std::make_shared<TableScan>(get_table, greater_than_(a, 0));
+  table_scan->runtime_filters.emplace_back(runtime_filter, ColumnID{0});
+  const auto join = std::make_shared<JoinHash>(
+      table_scan, build_operator, JoinMode::Semi,
+      OperatorJoinPredicate{ColumnIDPair(ColumnID{0}, ColumnID{0}), PredicateCondition::Equals});
+
+  const auto copied_join = join->deep_copy();
+  const auto copied_table_scan = copied_join->mutable_left_input();
+  const auto copied_get_table = copied_table_scan->mutable_left_input();
+  ASSERT_EQ(copied_table_scan->runtime_filters.size(), 1);
+  ASSERT_EQ(copied_get_table->runtime_filters.size(), 1);
+
+  // The copied operators share a copied filter, which is built from the copied build operator.
+  const auto& copied_runtime_filter = copied_table_scan->runtime_filters.front().first;
+  EXPECT_NE(copied_runtime_filter, runtime_filter);
+  EXPECT_EQ(copied_get_table->runtime_filters.front().first, copied_runtime_filter);
+  EXPECT_EQ(copied_runtime_filter->build_operator(), copied_join->mutable_right_input());
+  EXPECT_EQ(copied_runtime_filter->build_column_id(), ColumnID{0});
+  EXPECT_EQ(copied_table_scan->runtime_filters.front().second, ColumnID{0});
+}
+
+}  // namespace hyrise
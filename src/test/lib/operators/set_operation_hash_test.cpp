@@ -0,0 +1,177 @@
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "operators/set_operation_hash.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+
+namespace hyrise {
+
+class OperatorsSetOperationHashTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // Row (1, 'a') occurs three times in the left and twice in the right input, (NULL, 'c') twice and once.
+    _table_wrapper_left = _make_table_wrapper(
+        {{1, "a"}, {1, "a"}, {1, "a"}, {2, "b"}, {NULL_VALUE, "c"}, {NULL_VALUE, "c"}, {3, "d"}});
+    _table_wrapper_right = _make_table_wrapper({{1, "a"}, {1, "a"}, {NULL_VALUE, "c"}, {4, "e"}, {2, "x"}});
+  }
+
+  static std::shared_ptr<Table> _make_table(const std::vector<std::vector<AllTypeVariant>>& rows) {
+    const auto column_definitions =
+        TableColumnDefinitions{{"a", DataType::Int, true}, {"b", DataType::String, false}};
+    const auto table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{2});
+    for (const auto& row : rows) {
+      table->append(row);
+    }
+    return table;
+  }
+
+  static std::shared_ptr<TableWrapper> _make_table_wrapper(const std::vector<std::vector<AllTypeVariant>>& rows) {
+    const auto table_wrapper = std::make_shared<TableWrapper>(_make_table(rows));
+    table_wrapper->never_clear_output();
+    table_wrapper->execute();
+    return table_wrapper;
+  }
+
+  std::shared_ptr<const Table> _execute(const SetOperationType set_operation_type,
+                                        const SetOperationMode set_operation_mode) {
+    const auto set_operation = std::make_shared<SetOperationHash>(_table_wrapper_left, _table_wrapper_right,
+                                                                  set_operation_type, set_operation_mode);
+    set_operation->execute();
+    return set_operation->get_output();
+  }
+
+  std::shared_ptr<TableWrapper> _table_wrapper_left;
+  std::shared_ptr<TableWrapper> _table_wrapper_right;
+};
+
+TEST_F(OperatorsSetOperationHashTest, Union) {
+  const auto expected_table = _make_table({{1, "a"}, {2, "b"}, {NULL_VALUE, "c"}, {3, "d"}, {4, "e"}, {2, "x"}});
+  EXPECT_TABLE_EQ_UNORDERED(_execute(SetOperationType::Union, SetOperationMode::Unique), expected_table);
+}
+
+TEST_F(OperatorsSetOperationHashTest, Intersect) {
+  const auto expected_table = _make_table({{1, "a"}, {NULL_VALUE, "c"}});
+  EXPECT_TABLE_EQ_UNORDERED(_execute(SetOperationType::Intersect, SetOperationMode::Unique), expected_table);
+}
+
+TEST_F(OperatorsSetOperationHashTest, IntersectAll) {
+  const auto expected_table = _make_table({{1, "a"}, {1, "a"}, {NULL_VALUE, "c"}});
+  EXPECT_TABLE_EQ_UNORDERED(_execute(SetOperationType::Intersect, SetOperationMode::All), expected_table);
+}
+
+TEST_F(OperatorsSetOperationHashTest, Except) {
+  const auto expected_table = _make_table({{2, "b"}, {3, "d"}});
+  EXPECT_TABLE_EQ_UNORDERED(_execute(SetOperationType::Except, SetOperationMode::Unique), expected_table);
+}
+
+TEST_F(OperatorsSetOperationHashTest, ExceptAll) {
+  const auto expected_table = _make_table({{1, "a"}, {2, "b"}, {NULL_VALUE, "c"}, {3, "d"}});
+  EXPECT_TABLE_EQ_UNORDERED(_execute(SetOperationType::Except, SetOperationMode::All), expected_table);
+}
+
+TEST_F(OperatorsSetOperationHashTest, EmptyInputs) {
+  const auto empty_table_wrapper = _make_table_wrapper({});
+  const auto empty_table = _make_table({});
+
+  auto set_operation = std::make_shared<SetOperationHash>(_table_wrapper_left, empty_table_wrapper,
+                                                          SetOperationType::Intersect, SetOperationMode::All);
+  set_operation->execute();
+  EXPECT_TABLE_EQ_UNORDERED(set_operation->get_output(), empty_table);
+
+  set_operation = std::make_shared<SetOperationHash>(empty_table_wrapper, _table_wrapper_right,
+                                                     SetOperationType::Except, SetOperationMode::Unique);
+  set_operation->execute();
+  EXPECT_TABLE_EQ_UNORDERED(set_operation->get_output(), empty_table);
+
+  set_operation = std::make_shared<SetOperationHash>(empty_table_wrapper, _table_wrapper_right,
+                                                     SetOperationType::Union, SetOperationMode::Unique);
+  set_operation->execute();
+  EXPECT_TABLE_EQ_UNORDERED(set_operation->get_output(),
+                            _make_table({{1, "a"}, {NULL_VALUE, "c"}, {4, "e"}, {2, "x"}}));
+}
+
+TEST_F(OperatorsSetOperationHashTest, ReferenceInputs) {
+  // Filter the left input to (1, 'a') three times and (2, 'b'), (3, 'd') once. The output references the original
+  // table and keeps the order of the input rows.
+  const auto table_scan = create_table_scan(_table_wrapper_left, ColumnID{0}, PredicateCondition::IsNotNull, 0);
+  table_scan->execute();
+
+  const auto set_operation = std::make_shared<SetOperationHash>(table_scan, _table_wrapper_right,
+                                                                SetOperationType::Except, SetOperationMode::All);
+  set_operation->execute();
+
+  const auto& output_table = set_operation->get_output();
+  EXPECT_EQ(output_table->type(), TableType::References);
+  EXPECT_TABLE_EQ_ORDERED(output_table, _make_table({{1, "a"}, {2, "b"}, {3, "d"}}));
+
+  const auto reference_segment =
+      std::dynamic_pointer_cast<const ReferenceSegment>(output_table->get_chunk(ChunkID{0})->get_segment(ColumnID{0}));
+  ASSERT_TRUE(reference_segment);
+  EXPECT_EQ(reference_segment->referenced_table(), _table_wrapper_left->get_output());
+}
+
+TEST_F(OperatorsSetOperationHashTest, PartitionedInputs) {
+  // The inputs are large enough to be radix-partitioned.
+  const auto make_table_wrapper = [](const int32_t begin, const int32_t end) {
+    const auto column_definitions = TableColumnDefinitions{{"a", DataType::Int, false}};
+    const auto table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{1000});
+    for (auto value = begin; value < end; ++value) {
+      table->append({value});
+    }
+    const auto table_wrapper = std::make_shared<TableWrapper>(table);
+    table_wrapper->never_clear_output();
+    table_wrapper->execute();
+    return table_wrapper;
+  };
+
+  const auto left_input = make_table_wrapper(0, 10'000);
+  const auto right_input = make_table_wrapper(5'000, 15'000);
+
+  for (const auto& [set_operation_type, expected_row_count] :
+       {std::pair{SetOperationType::Union, uint64_t{15'000}}, std::pair{SetOperationType::Intersect, uint64_t{5'000}},
+        std::pair{SetOperationType::Except, uint64_t{5'000}}}) {
+    const auto set_operation =
+        std::make_shared<SetOperationHash>(left_input, right_input, set_operation_type, SetOperationMode::Unique);
+    set_operation->execute();
+    EXPECT_EQ(set_operation->get_output()->row_count(), expected_row_count);
+  }
+}
+
+TEST_F(OperatorsSetOperationHashTest, InvalidInputs) {
+  // Mismatching data types.
+  const auto table_wrapper = std::make_shared<TableWrapper>(load_table("resources/test_data/tbl/int_float.tbl"));
+  table_wrapper->execute();
+  const auto set_operation = std::make_shared<SetOperationHash>(_table_wrapper_left, table_wrapper,
+                                                                SetOperationType::Intersect, SetOperationMode::Unique);
+  EXPECT_THROW(set_operation->execute(), std::logic_error);
+
+  // Unsupported modes.
+  EXPECT_THROW(std::make_shared<SetOperationHash>(_table_wrapper_left, _table_wrapper_right, SetOperationType::Union,
+                                                  SetOperationMode::All),
+               std::logic_error);
+  EXPECT_THROW(std::make_shared<SetOperationHash>(_table_wrapper_left, _table_wrapper_right,
+                                                  SetOperationType::Except, SetOperationMode::Positions),
+               std::logic_error);
+}
+
+TEST_F(OperatorsSetOperationHashTest, DescriptionAndDeepCopy) {
+  const auto set_operation = std::make_shared<SetOperationHash>(_table_wrapper_left, _table_wrapper_right,
+                                                                SetOperationType::Intersect, SetOperationMode::All);
+  EXPECT_EQ(set_operation->name(), "SetOperationHash");
+  EXPECT_EQ(set_operation->description(DescriptionMode::SingleLine), "SetOperationHash (Intersect All)");
+
+  const auto copy = std::dynamic_pointer_cast<SetOperationHash>(set_operation->deep_copy());
+  ASSERT_TRUE(copy);
+  EXPECT_EQ(copy->set_operation_type(), SetOperationType::Intersect);
+  EXPECT_EQ(copy->set_operation_mode(), SetOperationMode::All);
+}
+
+}  // namespace hyrise
@@ -1,8 +1,13 @@
+#include <limits>
+#include <numeric>
+
 #include "base_test.hpp"
 
+#include "hyrise.hpp"
 #include "operators/join_hash.hpp"
 #include "operators/sort.hpp"
 #include "operators/table_wrapper.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
 
 namespace hyrise {
 
@@ -235,4 +240,92 @@ TEST_F(SortTest, InputReferencesDifferentColumns) {
   EXPECT_EQ(sort.get_output()->type(), TableType::Data);
 }
 
+TEST_F(SortTest, NormalizedKeyEdgeCases) {
+  const auto column_definitions = TableColumnDefinitions{
+      {"a", DataType::Int, false}, {"b", DataType::Double, false}, {"c", DataType::String, true}};
+  const auto table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{2});
+  table->append({0, 0.0, pmr_string{"ab"}});
+  table->append({std::numeric_limits<int32_t>::max(), -0.0, pmr_string{"a"}});
+  table->append({-1, -std::numeric_limits<double>::infinity(), NULL_VALUE});
+  table->append({std::numeric_limits<int32_t>::min(), 2.5, pmr_string{"a\0", 2}});
+  table->append({1, -1.5, pmr_string{""}});
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  const auto sorted_row_order = [&](const ColumnID column_id, const SortMode sort_mode) {
+    auto sort = Sort{table_wrapper, {SortColumnDefinition{column_id, sort_mode}}};
+    sort.execute();
+    // The values of column a are unique and identify the input rows.
+    auto row_order = std::vector<int32_t>{};
+    const auto& output_table = sort.get_output();
+    for (auto row_idx = size_t{0}; row_idx < output_table->row_count(); ++row_idx) {
+      row_order.emplace_back(*output_table->get_value<int32_t>(ColumnID{0}, row_idx));
+    }
+    return row_order;
+  };
+
+  const auto min = std::numeric_limits<int32_t>::min();
+  const auto max = std::numeric_limits<int32_t>::max();
+  EXPECT_EQ(sorted_row_order(ColumnID{0}, SortMode::Ascending), std::vector<int32_t>({min, -1, 0, 1, max}));
+  EXPECT_EQ(sorted_row_order(ColumnID{0}, SortMode::Descending), std::vector<int32_t>({max, 1, 0, -1, min}));
+
+  // 0.0 and -0.0 are equal, so their order in the input is retained.
+  EXPECT_EQ(sorted_row_order(ColumnID{1}, SortMode::Ascending), std::vector<int32_t>({-1, 1, 0, max, min}));
+  EXPECT_EQ(sorted_row_order(ColumnID{1}, SortMode::Descending), std::vector<int32_t>({min, 0, max, 1, -1}));
+
+  // NULLs come first in both directions. Embedded zero bytes are not confused with padding.
+  EXPECT_EQ(sorted_row_order(ColumnID{2}, SortMode::Ascending), std::vector<int32_t>({-1, 1, max, min, 0}));
+  EXPECT_EQ(sorted_row_order(ColumnID{2}, SortMode::Descending), std::vector<int32_t>({-1, 0, min, max, 1}));
+}
+
+TEST_F(SortTest, ParallelSortOfLargeInput) {
+  // The input consists of multiple runs and is merged by multiple merge jobs. The strings are longer than
+  // Sort::MAX_STRING_KEY_LENGTH and share a common prefix, so that the normalized keys are truncated and ties have to
+  // be resolved using the full values of the string column and of the int column.
+  Hyrise::get().topology.use_fake_numa_topology(8, 4);
+  Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+
+  const auto row_count = int32_t{150'000};
+  const auto table = std::make_shared<Table>(
+      TableColumnDefinitions{{"id", DataType::Int, false}, {"s", DataType::String, false}, {"i", DataType::Int, true}},
+      TableType::Data, ChunkOffset{5'000});
+  const auto prefix = std::string(Sort::MAX_STRING_KEY_LENGTH, 'x');
+  for (auto row_id = int32_t{0}; row_id < row_count; ++row_id) {
+    const auto int_value = row_id % 17 == 0 ? NULL_VALUE : AllTypeVariant{(row_id * 7) % 13};
+    table->append({row_id, pmr_string{prefix + std::to_string((row_id * 31) % 97)}, int_value});
+  }
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  auto sort = Sort{table_wrapper,
+                   {SortColumnDefinition{ColumnID{1}, SortMode::Ascending},
+                    SortColumnDefinition{ColumnID{2}, SortMode::Descending}}};
+  sort.execute();
+  const auto& output_table = sort.get_output();
+  ASSERT_EQ(output_table->row_count(), row_count);
+
+  auto expected_ids = std::vector<int32_t>(row_count);
+  std::iota(expected_ids.begin(), expected_ids.end(), 0);
+  std::stable_sort(expected_ids.begin(), expected_ids.end(), [&](const auto lhs, const auto rhs) {
+    const auto lhs_string = std::to_string((lhs * 31) % 97);
+    const auto rhs_string = std::to_string((rhs * 31) % 97);
+    if (lhs_string != rhs_string) {
+      return lhs_string < rhs_string;
+    }
+    // NULLs first, then descending.
+    const auto lhs_int = lhs % 17 == 0 ? -1 : (lhs * 7) % 13;
+    const auto rhs_int = rhs % 17 == 0 ? -1 : (rhs * 7) % 13;
+    if (lhs_int == -1 || rhs_int == -1) {
+      return lhs_int == -1 && rhs_int != -1;
+    }
+    return lhs_int > rhs_int;
+  });
+
+  for (auto row_idx = int32_t{0}; row_idx < row_count; ++row_idx) {
+    ASSERT_EQ(*output_table->get_value<int32_t>(ColumnID{0}, row_idx), expected_ids[row_idx]);
+  }
+
+  Hyrise::get().scheduler()->finish();
+}
+
 }  // namespace hyrise
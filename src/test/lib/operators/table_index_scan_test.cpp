@@ -0,0 +1,98 @@
+#include <memory>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "hyrise.hpp"
+#include "operators/table_index_scan.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+
+namespace hyrise {
+
+class OperatorsTableIndexScanTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // Column a contains 9, 10 | 11, 9.
+    _table = load_table("resources/test_data/tbl/int_int_int.tbl", ChunkOffset{2});
+    Hyrise::get().storage_manager.add_table("table", _table);
+    _table->create_table_index(ColumnID{0}, "idx");
+  }
+
+  std::shared_ptr<const Table> _execute(const AllTypeVariant& value, const std::vector<ChunkID>& included_chunk_ids,
+                                        const std::vector<ColumnID>& pruned_column_ids = {}) {
+    const auto table_index_scan = std::make_shared<TableIndexScan>("table", ColumnID{0}, value, pruned_column_ids);
+    table_index_scan->included_chunk_ids = included_chunk_ids;
+    table_index_scan->execute();
+    return table_index_scan->get_output();
+  }
+
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(OperatorsTableIndexScanTest, LookUpValue) {
+  const auto result = _execute(int32_t{9}, {ChunkID{0}, ChunkID{1}});
+  EXPECT_EQ(result->type(), TableType::References);
+
+  const auto expected_table = std::make_shared<Table>(_table->column_definitions(), TableType::Data);
+  expected_table->append({9, 10, 11});
+  expected_table->append({9, 10, 9});
+  EXPECT_TABLE_EQ_ORDERED(result, expected_table);
+
+  // One output chunk per referenced chunk. The segments reference the stored table.
+  ASSERT_EQ(result->chunk_count(), 2);
+  const auto reference_segment =
+      std::dynamic_pointer_cast<const ReferenceSegment>(result->get_chunk(ChunkID{1})->get_segment(ColumnID{0}));
+  ASSERT_TRUE(reference_segment);
+  EXPECT_EQ(reference_segment->referenced_table(), _table);
+  EXPECT_TRUE(reference_segment->pos_list()->references_single_chunk());
+  EXPECT_EQ((*reference_segment->pos_list())[ChunkOffset{0}], (RowID{ChunkID{1}, ChunkOffset{1}}));
+}
+
+TEST_F(OperatorsTableIndexScanTest, OnlyIncludedChunks) {
+  EXPECT_EQ(_execute(int32_t{9}, {ChunkID{1}})->row_count(), 1);
+  EXPECT_EQ(_execute(int32_t{11}, {ChunkID{0}})->row_count(), 0);
+  EXPECT_EQ(_execute(int32_t{9}, {})->row_count(), 0);
+}
+
+TEST_F(OperatorsTableIndexScanTest, PrunedColumns) {
+  const auto result = _execute(int32_t{10}, {ChunkID{0}, ChunkID{1}}, {ColumnID{1}});
+  const auto expected_table = std::make_shared<Table>(
+      TableColumnDefinitions{{"a", DataType::Int, false}, {"c", DataType::Int, false}}, TableType::Data);
+  expected_table->append({10, 10});
+  EXPECT_TABLE_EQ_ORDERED(result, expected_table);
+}
+
+TEST_F(OperatorsTableIndexScanTest, ValueOfDifferentDataType) {
+  EXPECT_EQ(_execute(int64_t{11}, {ChunkID{0}, ChunkID{1}})->row_count(), 1);
+  EXPECT_EQ(_execute(9.5f, {ChunkID{0}, ChunkID{1}})->row_count(), 0);
+  EXPECT_THROW(std::make_shared<TableIndexScan>("table", ColumnID{0}, NULL_VALUE), std::logic_error);
+}
+
+TEST_F(OperatorsTableIndexScanTest, RemovedChunks) {
+  // Physically deleted chunks are removed from the index. We skip invalidating the rows via MVCC for this test.
+  _table->get_chunk(ChunkID{0})->increase_invalid_row_count(ChunkOffset{2});
+  _table->remove_chunk(ChunkID{0});
+
+  EXPECT_EQ(_execute(int32_t{9}, {ChunkID{0}, ChunkID{1}})->row_count(), 1);
+}
+
+TEST_F(OperatorsTableIndexScanTest, DescriptionAndDeepCopy) {
+  const auto table_index_scan =
+      std::make_shared<TableIndexScan>("table", ColumnID{0}, int32_t{9}, std::vector<ColumnID>{ColumnID{2}});
+  table_index_scan->included_chunk_ids = {ChunkID{0}, ChunkID{1}};
+  EXPECT_EQ(table_index_scan->name(), "TableIndexScan");
+  EXPECT_EQ(table_index_scan->description(DescriptionMode::SingleLine),
+            "TableIndexScan (table) Column #0 = 9 included chunks: 2");
+
+  const auto copy = std::dynamic_pointer_cast<TableIndexScan>(table_index_scan->deep_copy());
+  ASSERT_TRUE(copy);
+  EXPECT_EQ(copy->table_name(), "table");
+  EXPECT_EQ(copy->column_id(), ColumnID{0});
+  EXPECT_EQ(copy->value(), AllTypeVariant{int32_t{9}});
+  EXPECT_EQ(copy->pruned_column_ids(), std::vector<ColumnID>{ColumnID{2}});
+  EXPECT_EQ(copy->included_chunk_ids, table_index_scan->included_chunk_ids);
+}
+
+}  // namespace hyrise
@@ -0,0 +1,105 @@
+#include "base_test.hpp"
+
+#include "magic_enum.hpp"
+
+#include "operators/table_scan/value_id_scan_kernels.hpp"
+#include "storage/vector_compression/vector_compression.hpp"
+
+namespace hyrise {
+
+class OperatorsTableScanValueIDScanKernelsTest : public BaseTest {
+ protected:
+  // Creates a compressed vector with `size` value IDs in [0, distinct_value_count]. The largest value ID represents
+  // NULL.
+  static std::unique_ptr<const BaseCompressedVector> create_attribute_vector(
+      const VectorCompressionType vector_compression_type, const uint32_t distinct_value_count, const size_t size) {
+    auto value_ids = pmr_vector<uint32_t>(size);
+    for (auto index = size_t{0}; index < size; ++index) {
+      value_ids[index] = static_cast<uint32_t>((index * 7'919) % (distinct_value_count + 1));
+    }
+    return compress_vector(value_ids, vector_compression_type, {}, UncompressedVectorInfo{distinct_value_count});
+  }
+
+  // Straightforward implementation of the semantics documented in value_id_scan_kernels.hpp.
+  static RowIDPosList expected_matches(const BaseCompressedVector& attribute_vector, const ValueID lower_value_id,
+                                       const ValueID upper_value_id, const bool negate, const ValueID null_value_id,
+                                       const ChunkID chunk_id) {
+    auto matches = RowIDPosList{};
+    const auto decompressor = attribute_vector.create_base_decompressor();
+    const auto size = decompressor->size();
+    for (auto index = size_t{0}; index < size; ++index) {
+      const auto value_id = decompressor->get(index);
+      if (((lower_value_id <= value_id && value_id < upper_value_id) != negate) && value_id < null_value_id) {
+        matches.emplace_back(chunk_id, ChunkOffset{static_cast<ChunkOffset::base_type>(index)});
+      }
+    }
+    return matches;
+  }
+
+  // Instruction sets that can be executed on this CPU.
+  static std::vector<ScanKernelInstructionSet> instruction_sets() {
+    auto instruction_sets = std::vector<ScanKernelInstructionSet>{};
+    for (const auto instruction_set : magic_enum::enum_values<ScanKernelInstructionSet>()) {
+      if (instruction_set <= supported_scan_kernel_instruction_set()) {
+        instruction_sets.emplace_back(instruction_set);
+      }
+    }
+    return instruction_sets;
+  }
+};
+
+TEST_F(OperatorsTableScanValueIDScanKernelsTest, MatchesStraightforwardScan) {
+  // 100 and 1'000 distinct values result in 1- and 2-byte FixedWidthIntegerVectors, 100'000 in 4-byte ones. The sizes
+  // are no multiple of the kernels' block and register sizes.
+  for (const auto vector_compression_type : magic_enum::enum_values<VectorCompressionType>()) {
+    for (const auto distinct_value_count : {uint32_t{100}, uint32_t{1'000}, uint32_t{100'000}}) {
+      for (const auto size : {size_t{0}, size_t{13}, size_t{1'024}, size_t{5'003}}) {
+        const auto attribute_vector = create_attribute_vector(vector_compression_type, distinct_value_count, size);
+        const auto null_value_id = ValueID{distinct_value_count};
+
+        const auto ranges = std::vector<std::pair<ValueID, ValueID>>{{ValueID{0}, ValueID{0}},
+                                                                     {ValueID{0}, ValueID{1}},
+                                                                     {ValueID{17}, ValueID{18}},
+                                                                     {ValueID{0}, ValueID{distinct_value_count / 2}},
+                                                                     {ValueID{distinct_value_count / 3}, null_value_id},
+                                                                     {ValueID{0}, null_value_id}};
+
+        for (const auto& [lower_value_id, upper_value_id] : ranges) {
+          for (const auto negate : {false, true}) {
+            const auto expected = expected_matches(*attribute_vector, lower_value_id, upper_value_id, negate,
+                                                   null_value_id, ChunkID{3});
+
+            for (const auto instruction_set : instruction_sets()) {
+              SCOPED_TRACE(std::string{magic_enum::enum_name(vector_compression_type)} + " " +
+                           std::to_string(distinct_value_count) + " " + std::to_string(size) + " [" +
+                           std::to_string(lower_value_id) + ", " + std::to_string(upper_value_id) + ") " +
+                           (negate ? "negated " : "") + std::string{magic_enum::enum_name(instruction_set)});
+
+              auto matches = RowIDPosList{};
+              scan_value_id_range(*attribute_vector, lower_value_id, upper_value_id, negate, null_value_id,
+                                  ChunkID{3}, matches, instruction_set);
+              EXPECT_EQ(matches, expected);
+            }
+          }
+        }
+      }
+    }
+  }
+}
+
+TEST_F(OperatorsTableScanValueIDScanKernelsTest, AppendsToExistingMatches) {
+  const auto attribute_vector = create_attribute_vector(VectorCompressionType::BitPacking, 10, 100);
+  for (const auto instruction_set : instruction_sets()) {
+    auto matches = RowIDPosList{RowID{ChunkID{0}, ChunkOffset{42}}};
+    scan_value_id_range(*attribute_vector, ValueID{0}, ValueID{1}, false, ValueID{10}, ChunkID{1}, matches,
+                        instruction_set);
+
+    // Value ID 0 is found at every eleventh offset.
+    ASSERT_EQ(matches.size(), 11);
+    EXPECT_EQ(matches[0], (RowID{ChunkID{0}, ChunkOffset{42}}));
+    EXPECT_EQ(matches[1], (RowID{ChunkID{1}, ChunkOffset{0}}));
+    EXPECT_EQ(matches[10], (RowID{ChunkID{1}, ChunkOffset{99}}));
+  }
+}
+
+}  // namespace hyrise
@@ -0,0 +1,110 @@
+#include <memory>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "expression/expression_functional.hpp"
+#include "operators/limit.hpp"
+#include "operators/sort.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "operators/top_k.hpp"
+#include "statistics/generate_pruning_statistics.hpp"
+#include "storage/table.hpp"
+
+namespace hyrise {
+
+using namespace expression_functional;  // NOLINT(build/namespaces)
+
+class OperatorsTopKTest : public BaseTest {
+ public:
+  void SetUp() override {
+    // Columns: a (int), b (int, nullable), c (string). Values of a and b repeat, so that ties have to be resolved.
+    const auto table = load_table("resources/test_data/tbl/sort/input.tbl", ChunkOffset{20});
+    _table_wrapper = std::make_shared<TableWrapper>(table);
+    _table_wrapper->never_clear_output();
+    _table_wrapper->execute();
+  }
+
+  // TopK has to return the same rows in the same order as a Sort followed by a Limit.
+  static void expect_equal_to_sort_and_limit(const std::shared_ptr<AbstractOperator>& input,
+                                             const std::vector<SortColumnDefinition>& sort_definitions,
+                                             const int64_t k) {
+    const auto top_k = std::make_shared<TopK>(input, sort_definitions, value_(k));
+    top_k->execute();
+
+    const auto sort = std::make_shared<Sort>(input, sort_definitions);
+    sort->execute();
+    const auto limit = std::make_shared<Limit>(sort, value_(k));
+    limit->execute();
+
+    EXPECT_TABLE_EQ_ORDERED(top_k->get_output(), limit->get_output());
+  }
+
+  std::shared_ptr<TableWrapper> _table_wrapper;
+};
+
+TEST_F(OperatorsTopKTest, EqualToSortAndLimit) {
+  const auto sort_definition_lists = std::vector<std::vector<SortColumnDefinition>>{
+      {SortColumnDefinition{ColumnID{0}, SortMode::Ascending}},
+      {SortColumnDefinition{ColumnID{0}, SortMode::Descending}},
+      {SortColumnDefinition{ColumnID{1}, SortMode::Descending}},
+      {SortColumnDefinition{ColumnID{2}, SortMode::Ascending}},
+      {SortColumnDefinition{ColumnID{0}, SortMode::Ascending},
+       SortColumnDefinition{ColumnID{1}, SortMode::Descending}},
+      {SortColumnDefinition{ColumnID{1}, SortMode::Ascending},
+       SortColumnDefinition{ColumnID{2}, SortMode::Descending}}};
+
+  for (const auto& sort_definitions : sort_definition_lists) {
+    for (const auto k : {int64_t{1}, int64_t{5}, int64_t{21}, int64_t{100}}) {
+      expect_equal_to_sort_and_limit(_table_wrapper, sort_definitions, k);
+    }
+  }
+}
+
+TEST_F(OperatorsTopKTest, ReferenceInput) {
+  const auto table_scan = create_table_scan(_table_wrapper, ColumnID{0}, PredicateCondition::GreaterThan, 2);
+  table_scan->execute();
+
+  expect_equal_to_sort_and_limit(table_scan, {SortColumnDefinition{ColumnID{1}, SortMode::Ascending}}, 7);
+  expect_equal_to_sort_and_limit(table_scan, {SortColumnDefinition{ColumnID{2}, SortMode::Descending}}, 7);
+}
+
+TEST_F(OperatorsTopKTest, ZeroRows) {
+  const auto top_k =
+      std::make_shared<TopK>(_table_wrapper, std::vector{SortColumnDefinition{ColumnID{0}}}, value_(int64_t{0}));
+  top_k->execute();
+
+  EXPECT_EQ(top_k->get_output()->row_count(), 0);
+  EXPECT_EQ(top_k->get_output()->column_definitions(), _table_wrapper->get_output()->column_definitions());
+}
+
+TEST_F(OperatorsTopKTest, PruneChunks) {
+  // The values of a are ascending, so that each chunk covers a distinct range of values. Once the last chunk (which is
+  // processed first as it contains the largest values) has been processed, all other chunks can be pruned.
+  const auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, false}}, TableType::Data,
+                                             ChunkOffset{10});
+  for (auto value = int32_t{0}; value < 100; ++value) {
+    table->append({value});
+  }
+  table->last_chunk()->finalize();
+  generate_chunk_pruning_statistics(table);
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  const auto top_k = std::make_shared<TopK>(
+      table_wrapper, std::vector{SortColumnDefinition{ColumnID{0}, SortMode::Descending}}, value_(int64_t{3}));
+  top_k->execute();
+
+  const auto& output_table = top_k->get_output();
+  ASSERT_EQ(output_table->row_count(), 3);
+  EXPECT_EQ(output_table->get_value<int32_t>(ColumnID{0}, 0), 99);
+  EXPECT_EQ(output_table->get_value<int32_t>(ColumnID{0}, 1), 98);
+  EXPECT_EQ(output_table->get_value<int32_t>(ColumnID{0}, 2), 97);
+
+  const auto& performance_data = dynamic_cast<const TopK::PerformanceData&>(*top_k->performance_data);
+  EXPECT_EQ(performance_data.num_chunks_pruned, 9);
+}
+
+}  // namespace hyrise
@@ -58,6 +58,43 @@ TEST_F(OperatorsUnionAllTest, UnionOfValueReferenceTables) {
   EXPECT_TABLE_EQ_UNORDERED(union_all->get_output(), expected_result);
 }
 
+TEST_F(OperatorsUnionAllTest, UnionOfDataAndReferenceTables) {
+  std::shared_ptr<Table> expected_result = load_table("resources/test_data/tbl/int_float_union.tbl", ChunkOffset{2});
+
+  // The scan emits all rows of table a as a reference table.
+  const auto table_scan = create_table_scan(_table_wrapper_a, ColumnID{0}, PredicateCondition::GreaterThan, 0);
+  table_scan->execute();
+
+  for (const auto& [left_input, right_input] :
+       {std::pair<std::shared_ptr<AbstractOperator>, std::shared_ptr<AbstractOperator>>{table_scan, _table_wrapper_b},
+        std::pair<std::shared_ptr<AbstractOperator>, std::shared_ptr<AbstractOperator>>{_table_wrapper_b,
+                                                                                        table_scan}}) {
+    auto union_all = std::make_shared<UnionAll>(left_input, right_input);
+    union_all->execute();
+
+    EXPECT_EQ(union_all->get_output()->type(), TableType::References);
+    EXPECT_TABLE_EQ_UNORDERED(union_all->get_output(), expected_result);
+  }
+}
+
+TEST_F(OperatorsUnionAllTest, UnionOfDifferentColumnDefinitions) {
+  // As in SQL, the columns are matched by their position. The output columns are named after the left input's columns
+  // and are nullable if the column of either input is nullable.
+  auto column_definitions = TableColumnDefinitions{{"x", DataType::Int, true}, {"y", DataType::Float, false}};
+  const auto table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{2});
+  table->append({NULL_VALUE, 1.5f});
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  auto union_all = std::make_shared<UnionAll>(_table_wrapper_a, table_wrapper);
+  union_all->execute();
+
+  const auto& output_table = union_all->get_output();
+  EXPECT_EQ(output_table->column_definitions(),
+            TableColumnDefinitions({{"a", DataType::Int, true}, {"b", DataType::Float, false}}));
+  EXPECT_EQ(output_table->row_count(), 4);
+}
+
 TEST_F(OperatorsUnionAllTest, ThrowWrongColumnNumberException) {
   if constexpr (!HYRISE_DEBUG) {
     GTEST_SKIP();
@@ -0,0 +1,173 @@
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "expression/expression_functional.hpp"
+#include "expression/pqp_column_expression.hpp"
+#include "expression/window_expression.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "operators/window_function_evaluator.hpp"
+#include "storage/table.hpp"
+
+namespace hyrise {
+
+using namespace expression_functional;  // NOLINT(build/namespaces)
+
+class OperatorsWindowFunctionEvaluatorTest : public BaseTest {
+ public:
+  void SetUp() override {
+    // a is the partition column, b the order column, and c the argument of aggregates.
+    const auto column_definitions = TableColumnDefinitions{
+        {"a", DataType::Int, false}, {"b", DataType::Int, false}, {"c", DataType::Int, true}};
+    const auto table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{2});
+    table->append({1, 1, 10});
+    table->append({1, 2, 20});
+    table->append({2, 1, 5});
+    table->append({1, 2, 30});
+    table->append({2, 3, 7});
+    table->append({1, 4, NULL_VALUE});
+
+    _table_wrapper = std::make_shared<TableWrapper>(table);
+    _table_wrapper->never_clear_output();
+    _table_wrapper->execute();
+
+    _a = pqp_column_(ColumnID{0}, DataType::Int, false, "a");
+    _b = pqp_column_(ColumnID{1}, DataType::Int, false, "b");
+    _c = pqp_column_(ColumnID{2}, DataType::Int, true, "c");
+  }
+
+  static std::shared_ptr<WindowExpression> partitioned_window(const FrameDescription& frame) {
+    auto frame_copy = frame;
+    return window_(expression_vector(pqp_column_(ColumnID{0}, DataType::Int, false, "a")),
+                   expression_vector(pqp_column_(ColumnID{1}, DataType::Int, false, "b")),
+                   std::vector<SortMode>{SortMode::Ascending}, std::move(frame_copy));
+  }
+
+  // Executes the operator and returns the values of the appended result column in the order of the input rows.
+  template <typename T>
+  std::vector<std::optional<T>> evaluate(const std::shared_ptr<WindowFunctionExpression>& window_function,
+                                         const ColumnID argument_column_id,
+                                         const std::shared_ptr<AbstractOperator>& input = nullptr) {
+    const auto partition_by_column_ids = std::vector<ColumnID>{ColumnID{0}};
+    const auto order_by_column_ids = std::vector<ColumnID>{ColumnID{1}};
+    const auto evaluator = std::make_shared<WindowFunctionEvaluator>(input ? input : _table_wrapper,
+                                                                     partition_by_column_ids, order_by_column_ids,
+                                                                     argument_column_id, window_function);
+    evaluator->execute();
+
+    const auto& output_table = evaluator->get_output();
+    EXPECT_EQ(output_table->column_count(), 4);
+    const auto row_count = output_table->row_count();
+    auto results = std::vector<std::optional<T>>(row_count);
+    for (auto row_idx = size_t{0}; row_idx < row_count; ++row_idx) {
+      results[row_idx] = output_table->get_value<T>(ColumnID{3}, row_idx);
+    }
+    return results;
+  }
+
+  const FrameDescription _default_frame{FrameType::Range, FrameBound{0, FrameBoundType::Preceding, true},
+                                        FrameBound{0, FrameBoundType::CurrentRow, false}};
+  std::shared_ptr<TableWrapper> _table_wrapper;
+  std::shared_ptr<PQPColumnExpression> _a, _b, _c;
+};
+
+TEST_F(OperatorsWindowFunctionEvaluatorTest, RankingFunctions) {
+  const auto window = partitioned_window(_default_frame);
+
+  using Results = std::vector<std::optional<int64_t>>;
+  EXPECT_EQ(evaluate<int64_t>(row_number_(window), INVALID_COLUMN_ID), Results({1, 2, 1, 3, 2, 4}));
+  EXPECT_EQ(evaluate<int64_t>(rank_(window), INVALID_COLUMN_ID), Results({1, 2, 1, 2, 2, 4}));
+  EXPECT_EQ(evaluate<int64_t>(dense_rank_(window), INVALID_COLUMN_ID), Results({1, 2, 1, 2, 2, 3}));
+
+  using DoubleResults = std::vector<std::optional<double>>;
+  EXPECT_EQ(evaluate<double>(percent_rank_(window), INVALID_COLUMN_ID),
+            DoubleResults({0.0, 1.0 / 3.0, 0.0, 1.0 / 3.0, 1.0, 1.0}));
+  EXPECT_EQ(evaluate<double>(cume_dist_(window), INVALID_COLUMN_ID),
+            DoubleResults({0.25, 0.75, 0.5, 0.75, 1.0, 1.0}));
+}
+
+TEST_F(OperatorsWindowFunctionEvaluatorTest, RunningAggregatesIncludePeers) {
+  const auto window = partitioned_window(_default_frame);
+
+  using Results = std::vector<std::optional<int64_t>>;
+  EXPECT_EQ(evaluate<int64_t>(sum_(_c, window), ColumnID{2}), Results({10, 60, 5, 60, 12, 60}));
+  EXPECT_EQ(evaluate<int64_t>(count_(_c, window), ColumnID{2}), Results({1, 3, 1, 3, 2, 3}));
+
+  using IntResults = std::vector<std::optional<int32_t>>;
+  EXPECT_EQ(evaluate<int32_t>(max_(_c, window), ColumnID{2}), IntResults({10, 30, 5, 30, 7, 30}));
+}
+
+TEST_F(OperatorsWindowFunctionEvaluatorTest, SlidingRowsFrames) {
+  const auto sliding_frame = FrameDescription{FrameType::Rows, FrameBound{1, FrameBoundType::Preceding, false},
+                                              FrameBound{1, FrameBoundType::Following, false}};
+  const auto sliding_window = partitioned_window(sliding_frame);
+
+  using Results = std::vector<std::optional<int64_t>>;
+  EXPECT_EQ(evaluate<int64_t>(sum_(_c, sliding_window), ColumnID{2}), Results({30, 60, 12, 50, 12, 30}));
+
+  using IntResults = std::vector<std::optional<int32_t>>;
+  EXPECT_EQ(evaluate<int32_t>(min_(_c, sliding_window), ColumnID{2}), IntResults({10, 10, 5, 20, 5, 30}));
+
+  // Frames that are empty or contain only NULLs yield NULL.
+  const auto following_frame = FrameDescription{FrameType::Rows, FrameBound{1, FrameBoundType::Following, false},
+                                                FrameBound{2, FrameBoundType::Following, false}};
+  const auto following_window = partitioned_window(following_frame);
+
+  using DoubleResults = std::vector<std::optional<double>>;
+  EXPECT_EQ(evaluate<double>(avg_(_c, following_window), ColumnID{2}),
+            DoubleResults({25.0, 30.0, 7.0, std::nullopt, std::nullopt, std::nullopt}));
+}
+
+TEST_F(OperatorsWindowFunctionEvaluatorTest, CountStarWithoutOrderBy) {
+  auto frame = _default_frame;
+  const auto window = window_(expression_vector(_a), expression_vector(), std::vector<SortMode>{}, std::move(frame));
+  const auto count_star = std::make_shared<WindowFunctionExpression>(
+      WindowFunction::Count, pqp_column_(INVALID_COLUMN_ID, DataType::Long, false, "*"), window);
+
+  const auto evaluator = std::make_shared<WindowFunctionEvaluator>(_table_wrapper, std::vector<ColumnID>{ColumnID{0}},
+                                                                   std::vector<ColumnID>{}, INVALID_COLUMN_ID,
+                                                                   count_star);
+  evaluator->execute();
+
+  const auto& output_table = evaluator->get_output();
+  const auto expected = std::vector<int64_t>{4, 4, 2, 4, 2, 4};
+  for (auto row_idx = size_t{0}; row_idx < expected.size(); ++row_idx) {
+    EXPECT_EQ(output_table->get_value<int64_t>(ColumnID{3}, row_idx), expected[row_idx]);
+  }
+  EXPECT_FALSE(output_table->column_is_nullable(ColumnID{3}));
+}
+
+TEST_F(OperatorsWindowFunctionEvaluatorTest, ReferenceInput) {
+  // Filter out the first row. The remaining rows keep their order and the output is a reference table.
+  const auto table_scan = create_table_scan(_table_wrapper, ColumnID{2}, PredicateCondition::NotEquals, 10);
+  table_scan->execute();
+
+  const auto window = partitioned_window(_default_frame);
+  using Results = std::vector<std::optional<int64_t>>;
+  EXPECT_EQ(evaluate<int64_t>(row_number_(window), INVALID_COLUMN_ID, table_scan), Results({1, 1, 2, 2}));
+
+  const auto evaluator = std::make_shared<WindowFunctionEvaluator>(
+      table_scan, std::vector<ColumnID>{ColumnID{0}}, std::vector<ColumnID>{ColumnID{1}}, INVALID_COLUMN_ID,
+      row_number_(window));
+  evaluator->execute();
+  EXPECT_EQ(evaluator->get_output()->type(), TableType::References);
+}
+
+TEST_F(OperatorsWindowFunctionEvaluatorTest, UnsupportedFrames) {
+  const auto range_frame = FrameDescription{FrameType::Range, FrameBound{1, FrameBoundType::Preceding, false},
+                                            FrameBound{0, FrameBoundType::CurrentRow, false}};
+  EXPECT_THROW(std::make_shared<WindowFunctionEvaluator>(_table_wrapper, std::vector<ColumnID>{ColumnID{0}},
+                                                         std::vector<ColumnID>{ColumnID{1}}, ColumnID{2},
+                                                         sum_(_c, partitioned_window(range_frame))),
+               InvalidInputException);
+
+  EXPECT_THROW(std::make_shared<WindowFunctionEvaluator>(
+                   _table_wrapper, std::vector<ColumnID>{ColumnID{0}}, std::vector<ColumnID>{ColumnID{1}}, ColumnID{2},
+                   count_distinct_(_c, partitioned_window(_default_frame))),
+               InvalidInputException);
+}
+
+}  // namespace hyrise
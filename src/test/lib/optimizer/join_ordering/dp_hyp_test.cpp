@@ -0,0 +1,173 @@
+#include "base_test.hpp"
+
+#include "cost_estimation/cost_estimator_logical.hpp"
+#include "expression/expression_functional.hpp"
+#include "logical_query_plan/join_node.hpp"
+#include "logical_query_plan/mock_node.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "optimizer/join_ordering/dp_ccp.hpp"
+#include "optimizer/join_ordering/dp_hyp.hpp"
+#include "optimizer/join_ordering/join_graph.hpp"
+#include "statistics/cardinality_estimator.hpp"
+
+/**
+ * The CsgCmpPair enumeration is covered by the count of candidate joins, the plan construction by the join order and
+ * the treatment of hyperedges and semi join edges.
+ */
+
+namespace hyrise {
+
+using namespace expression_functional;  // NOLINT(build/namespaces)
+
+class DpHypTest : public BaseTest {
+ public:
+  void SetUp() override {
+    cardinality_estimator = std::make_shared<CardinalityEstimator>();
+    cost_estimator = std::make_shared<CostEstimatorLogical>(cardinality_estimator);
+
+    node_a = create_mock_node_with_statistics(MockNode::ColumnDefinitions{{DataType::Int, "a"}}, 20,
+                                              {GenericHistogram<int32_t>::with_single_bin(1, 50, 20, 10)});
+    node_b = create_mock_node_with_statistics(MockNode::ColumnDefinitions{{DataType::Int, "a"}}, 20,
+                                              {GenericHistogram<int32_t>::with_single_bin(40, 100, 20, 10)});
+    node_c = create_mock_node_with_statistics(MockNode::ColumnDefinitions{{DataType::Int, "a"}}, 20,
+                                              {GenericHistogram<int32_t>::with_single_bin(1, 100, 20, 10)});
+    node_d = create_mock_node_with_statistics(MockNode::ColumnDefinitions{{DataType::Int, "a"}}, 200,
+                                              {GenericHistogram<int32_t>::with_single_bin(1, 100, 200, 10)});
+
+    a_a = node_a->get_column("a");
+    b_a = node_b->get_column("a");
+    c_a = node_c->get_column("a");
+    d_a = node_d->get_column("a");
+  }
+
+  // A chain of the four nodes: A - B - C - D.
+  JoinGraph chain_join_graph() const {
+    const auto join_edge_a_b = JoinGraphEdge{JoinGraphVertexSet{4, 0b0011}, expression_vector(equals_(a_a, b_a))};
+    const auto join_edge_b_c = JoinGraphEdge{JoinGraphVertexSet{4, 0b0110}, expression_vector(equals_(b_a, c_a))};
+    const auto join_edge_c_d = JoinGraphEdge{JoinGraphVertexSet{4, 0b1100}, expression_vector(equals_(c_a, d_a))};
+
+    return JoinGraph(std::vector<std::shared_ptr<AbstractLQPNode>>({node_a, node_b, node_c, node_d}),
+                     std::vector<JoinGraphEdge>({join_edge_a_b, join_edge_b_c, join_edge_c_d}));
+  }
+
+  std::shared_ptr<MockNode> node_a, node_b, node_c, node_d;
+  std::shared_ptr<AbstractCardinalityEstimator> cardinality_estimator;
+  std::shared_ptr<AbstractCostEstimator> cost_estimator;
+  std::shared_ptr<LQPColumnExpression> a_a, b_a, c_a, d_a;
+};
+
+TEST_F(DpHypTest, JoinOrderingAsCheapAsDpCcp) {
+  // Both algorithms are optimal. For graphs without hyperedges and semi joins, they find plans of the same cost.
+
+  const auto join_edge_a_b = JoinGraphEdge{JoinGraphVertexSet{3, 0b011}, expression_vector(equals_(a_a, b_a))};
+  const auto join_edge_a_c = JoinGraphEdge{JoinGraphVertexSet{3, 0b101}, expression_vector(equals_(a_a, c_a))};
+  const auto join_edge_b_c = JoinGraphEdge{JoinGraphVertexSet{3, 0b110}, expression_vector(equals_(b_a, c_a))};
+
+  const auto join_graph = JoinGraph(std::vector<std::shared_ptr<AbstractLQPNode>>({node_a, node_b, node_c}),
+                                    std::vector<JoinGraphEdge>({join_edge_a_b, join_edge_a_c, join_edge_b_c}));
+
+  const auto dp_hyp_lqp = DpHyp{}(join_graph, cost_estimator);  // NOLINT
+  const auto dp_ccp_lqp = DpCcp{}(join_graph, cost_estimator);  // NOLINT
+
+  EXPECT_DOUBLE_EQ(cost_estimator->estimate_plan_cost(dp_hyp_lqp), cost_estimator->estimate_plan_cost(dp_ccp_lqp));
+
+  // The most selective join of A and B comes first.
+  ASSERT_EQ(dp_hyp_lqp->type, LQPNodeType::Predicate);
+  const auto& upper_join_node = dp_hyp_lqp->left_input();
+  ASSERT_EQ(upper_join_node->type, LQPNodeType::Join);
+  const auto& lower_join_node = upper_join_node->right_input();
+  ASSERT_EQ(lower_join_node->type, LQPNodeType::Join);
+  EXPECT_EQ(*static_cast<const JoinNode&>(*lower_join_node).join_predicates().front(), *equals_(a_a, b_a));
+}
+
+TEST_F(DpHypTest, HyperEdge) {
+  // The hyperedge connects C to the plan of A and B, no cross join edge is needed.
+
+  const auto join_edge_a_b = JoinGraphEdge{JoinGraphVertexSet{3, 0b011}, expression_vector(equals_(a_a, b_a))};
+  const auto hyper_edge_a_b_c =
+      JoinGraphEdge{JoinGraphVertexSet{3, 0b111}, expression_vector(equals_(add_(a_a, b_a), c_a))};
+
+  const auto join_graph = JoinGraph(std::vector<std::shared_ptr<AbstractLQPNode>>({node_a, node_b, node_c}),
+                                    std::vector<JoinGraphEdge>({join_edge_a_b, hyper_edge_a_b_c}));
+
+  const auto actual_lqp = DpHyp{}(join_graph, cost_estimator);  // NOLINT
+
+  // clang-format off
+  const auto expected_lqp =
+  PredicateNode::make(equals_(add_(a_a, b_a), c_a),
+    JoinNode::make(JoinMode::Cross,
+      node_c,
+      JoinNode::make(JoinMode::Inner, equals_(a_a, b_a),
+        node_a,
+        node_b)));
+  // clang-format on
+
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+}
+
+TEST_F(DpHypTest, SemiJoinEdge) {
+  // D is the right input of a semi join with C. It must not be joined with anything else and remains the right input.
+
+  const auto join_edge_a_b = JoinGraphEdge{JoinGraphVertexSet{4, 0b0011}, expression_vector(equals_(a_a, b_a))};
+  const auto join_edge_b_c = JoinGraphEdge{JoinGraphVertexSet{4, 0b0110}, expression_vector(equals_(b_a, c_a))};
+  const auto semi_join_edge_c_d =
+      JoinGraphEdge{JoinGraphVertexSet{4, 0b1100}, expression_vector(equals_(c_a, d_a)), JoinMode::Semi, 3};
+
+  const auto join_graph = JoinGraph(std::vector<std::shared_ptr<AbstractLQPNode>>({node_a, node_b, node_c, node_d}),
+                                    std::vector<JoinGraphEdge>({join_edge_a_b, join_edge_b_c, semi_join_edge_c_d}));
+
+  const auto plan_table = DpHyp::build_plan_table(join_graph, cost_estimator, 4);
+
+  // D can only be semi-joined to plans containing C.
+  EXPECT_FALSE(plan_table.contains(JoinGraphVertexSet{4, 0b1010}));
+  EXPECT_FALSE(plan_table.contains(JoinGraphVertexSet{4, 0b1001}));
+  EXPECT_FALSE(plan_table.contains(JoinGraphVertexSet{4, 0b1011}));
+
+  // clang-format off
+  const auto expected_c_d_lqp =
+  JoinNode::make(JoinMode::Semi, equals_(c_a, d_a),
+    node_c,
+    node_d);
+  // clang-format on
+
+  ASSERT_TRUE(plan_table.contains(JoinGraphVertexSet{4, 0b1100}));
+  EXPECT_LQP_EQ(plan_table.at(JoinGraphVertexSet{4, 0b1100}).first, expected_c_d_lqp);
+
+  // The complete plan contains the semi join with D as its right input.
+  const auto actual_lqp = DpHyp{}(join_graph, cost_estimator);  // NOLINT
+  auto semi_join_count = size_t{0};
+  visit_lqp(actual_lqp, [&](const auto& node) {
+    if (node->type == LQPNodeType::Join && static_cast<const JoinNode&>(*node).join_mode == JoinMode::Semi) {
+      ++semi_join_count;
+      EXPECT_EQ(node->right_input(), node_d);
+    }
+    return LQPVisitation::VisitInputs;
+  });
+  EXPECT_EQ(semi_join_count, 1u);
+}
+
+TEST_F(DpHypTest, CountCandidateJoins) {
+  const auto join_graph = chain_join_graph();
+
+  // A chain of n vertices has (n^3 - n) / 6 CsgCmpPairs.
+  EXPECT_EQ(DpHyp::count_candidate_joins(join_graph, 4, 100), 10u);
+
+  // Only AB, BC, and CD.
+  EXPECT_EQ(DpHyp::count_candidate_joins(join_graph, 2, 100), 3u);
+
+  // Counting stops once the limit is exceeded.
+  EXPECT_GT(DpHyp::count_candidate_joins(join_graph, 4, 5), 5u);
+  EXPECT_LT(DpHyp::count_candidate_joins(join_graph, 4, 5), 10u);
+}
+
+TEST_F(DpHypTest, PlanTableRespectsMaxVertexSetSize) {
+  const auto plan_table = DpHyp::build_plan_table(chain_join_graph(), cost_estimator, 3);
+
+  // Four single vertices, three pairs, and two triples.
+  EXPECT_EQ(plan_table.size(), 9u);
+  EXPECT_FALSE(plan_table.contains(JoinGraphVertexSet{4, 0b1111}));
+  EXPECT_TRUE(plan_table.contains(JoinGraphVertexSet{4, 0b0111}));
+  EXPECT_TRUE(plan_table.contains(JoinGraphVertexSet{4, 0b1110}));
+}
+
+}  // namespace hyrise
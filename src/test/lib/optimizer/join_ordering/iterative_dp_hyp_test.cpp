@@ -0,0 +1,146 @@
+#include <optional>
+
+#include "base_test.hpp"
+
+#include "cost_estimation/cost_estimator_logical.hpp"
+#include "expression/expression_functional.hpp"
+#include "logical_query_plan/join_node.hpp"
+#include "logical_query_plan/mock_node.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "optimizer/join_ordering/dp_hyp.hpp"
+#include "optimizer/join_ordering/iterative_dp_hyp.hpp"
+#include "optimizer/join_ordering/join_graph.hpp"
+#include "statistics/cardinality_estimator.hpp"
+
+namespace hyrise {
+
+using namespace expression_functional;  // NOLINT(build/namespaces)
+
+class IterativeDpHypTest : public BaseTest {
+ public:
+  void SetUp() override {
+    cardinality_estimator = std::make_shared<CardinalityEstimator>();
+    cost_estimator = std::make_shared<CostEstimatorLogical>(cardinality_estimator);
+
+    for (auto node_idx = size_t{0}; node_idx < 5; ++node_idx) {
+      const auto row_count = size_t{20} * (node_idx + 1);
+      nodes.emplace_back(create_mock_node_with_statistics(
+          MockNode::ColumnDefinitions{{DataType::Int, "a"}}, row_count,
+          {GenericHistogram<int32_t>::with_single_bin(1, 100, static_cast<HistogramCountType>(row_count), 10)}));
+      columns.emplace_back(nodes.back()->get_column("a"));
+    }
+
+    // A clique of the five nodes and a local predicate on the first one.
+    auto edges = std::vector<JoinGraphEdge>{};
+    for (auto node_idx_a = size_t{0}; node_idx_a < 5; ++node_idx_a) {
+      for (auto node_idx_b = node_idx_a + 1; node_idx_b < 5; ++node_idx_b) {
+        auto vertex_set = JoinGraphVertexSet{5};
+        vertex_set.set(node_idx_a);
+        vertex_set.set(node_idx_b);
+        edges.emplace_back(vertex_set, expression_vector(equals_(columns[node_idx_a], columns[node_idx_b])));
+        predicates.emplace_back(edges.back().predicates.front());
+      }
+    }
+
+    edges.emplace_back(JoinGraphVertexSet{5, 0b00001}, expression_vector(less_than_(columns[0], 50)));
+    predicates.emplace_back(edges.back().predicates.front());
+
+    // An uncorrelated predicate is placed on top of the plan.
+    uncorrelated_predicate = equals_(1, 1);
+    edges.emplace_back(JoinGraphVertexSet{5}, expression_vector(uncorrelated_predicate));
+
+    join_graph.emplace(std::vector<std::shared_ptr<AbstractLQPNode>>(nodes.begin(), nodes.end()), edges);
+  }
+
+  // Checks that every node and every predicate of the JoinGraph occurs exactly once in `lqp`.
+  void expect_complete_plan(const std::shared_ptr<AbstractLQPNode>& lqp) const {
+    auto node_occurrences = std::vector<size_t>(nodes.size(), 0);
+    auto predicate_occurrences = std::vector<size_t>(predicates.size(), 0);
+
+    const auto count_predicate = [&](const auto& predicate) {
+      for (auto predicate_idx = size_t{0}; predicate_idx < predicates.size(); ++predicate_idx) {
+        if (*predicates[predicate_idx] == *predicate) {
+          ++predicate_occurrences[predicate_idx];
+        }
+      }
+    };
+
+    visit_lqp(lqp, [&](const auto& node) {
+      for (auto node_idx = size_t{0}; node_idx < nodes.size(); ++node_idx) {
+        if (node == nodes[node_idx]) {
+          ++node_occurrences[node_idx];
+        }
+      }
+
+      if (const auto join_node = std::dynamic_pointer_cast<JoinNode>(node)) {
+        for (const auto& join_predicate : join_node->join_predicates()) {
+          count_predicate(join_predicate);
+        }
+      } else if (const auto predicate_node = std::dynamic_pointer_cast<PredicateNode>(node)) {
+        count_predicate(predicate_node->predicate());
+      }
+      return LQPVisitation::VisitInputs;
+    });
+
+    EXPECT_EQ(node_occurrences, std::vector<size_t>(nodes.size(), 1));
+    EXPECT_EQ(predicate_occurrences, std::vector<size_t>(predicates.size(), 1));
+
+    ASSERT_EQ(lqp->type, LQPNodeType::Predicate);
+    EXPECT_EQ(*static_cast<const PredicateNode&>(*lqp).predicate(), *uncorrelated_predicate);
+  }
+
+  std::vector<std::shared_ptr<MockNode>> nodes;
+  std::vector<std::shared_ptr<LQPColumnExpression>> columns;
+  std::vector<std::shared_ptr<AbstractExpression>> predicates;
+  std::shared_ptr<AbstractExpression> uncorrelated_predicate;
+  std::optional<JoinGraph> join_graph;
+  std::shared_ptr<AbstractCardinalityEstimator> cardinality_estimator;
+  std::shared_ptr<AbstractCostEstimator> cost_estimator;
+};
+
+TEST_F(IterativeDpHypTest, OptimalWithinBudget) {
+  // A clique of five vertices has 90 CsgCmpPairs, the default budget suffices to find the optimal plan.
+  EXPECT_EQ(DpHyp::count_candidate_joins(*join_graph, 5, 1'000), 90u);
+
+  const auto actual_lqp = IterativeDpHyp{}(*join_graph, cost_estimator);  // NOLINT
+  const auto optimal_lqp = DpHyp{}(*join_graph, cost_estimator);          // NOLINT
+
+  EXPECT_LQP_EQ(actual_lqp, optimal_lqp);
+  expect_complete_plan(actual_lqp);
+}
+
+TEST_F(IterativeDpHypTest, ContractsVerticesIfBudgetIsExceeded) {
+  // With a budget of a single candidate join, only pairs of vertices are joined in each iteration. Still, all vertices
+  // and predicates are part of the plan.
+  const auto actual_lqp = IterativeDpHyp{1}(*join_graph, cost_estimator);
+
+  expect_complete_plan(actual_lqp);
+  EXPECT_GE(cost_estimator->estimate_plan_cost(actual_lqp),
+            cost_estimator->estimate_plan_cost(DpHyp{}(*join_graph, cost_estimator)));  // NOLINT
+}
+
+TEST_F(IterativeDpHypTest, SemiJoinEdge) {
+  // The right vertex of a semi join edge remains the right input of the semi join, also when it is joined after
+  // other vertices were contracted.
+  const auto edges = std::vector<JoinGraphEdge>{
+      JoinGraphEdge{JoinGraphVertexSet{4, 0b0011}, expression_vector(equals_(columns[0], columns[1]))},
+      JoinGraphEdge{JoinGraphVertexSet{4, 0b0110}, expression_vector(equals_(columns[1], columns[2]))},
+      JoinGraphEdge{JoinGraphVertexSet{4, 0b1001}, expression_vector(equals_(columns[0], columns[3])), JoinMode::Semi,
+                    3}};
+  const auto semi_join_graph =
+      JoinGraph(std::vector<std::shared_ptr<AbstractLQPNode>>({nodes[0], nodes[1], nodes[2], nodes[3]}), edges);
+
+  const auto actual_lqp = IterativeDpHyp{1}(semi_join_graph, cost_estimator);
+
+  auto semi_join_count = size_t{0};
+  visit_lqp(actual_lqp, [&](const auto& node) {
+    if (node->type == LQPNodeType::Join && static_cast<const JoinNode&>(*node).join_mode == JoinMode::Semi) {
+      ++semi_join_count;
+      EXPECT_EQ(node->right_input(), nodes[3]);
+    }
+    return LQPVisitation::VisitInputs;
+  });
+  EXPECT_EQ(semi_join_count, 1u);
+}
+
+}  // namespace hyrise
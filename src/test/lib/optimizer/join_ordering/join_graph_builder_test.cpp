@@ -185,6 +185,40 @@ TEST_F(JoinGraphBuilderTest, OuterJoin) {
   EXPECT_EQ(*join_graph->edges.at(0).predicates.at(0), *equals_(a_a, b_a));
 }
 
+TEST_F(JoinGraphBuilderTest, SemiJoin) {
+  // Test that the left input of a semi join is traversed and its right input becomes a vertex joined by an edge of its
+  // own
+
+  // clang-format off
+  const auto lqp =
+  JoinNode::make(JoinMode::Semi, equals_(b_b, c_a),
+    JoinNode::make(JoinMode::Inner, equals_(a_a, b_a),
+      node_a,
+      node_b),
+    node_c);
+  // clang-format on
+
+  const auto join_graph = JoinGraphBuilder()(lqp);
+  ASSERT_TRUE(join_graph);
+
+  ASSERT_EQ(join_graph->vertices.size(), 3u);
+  EXPECT_EQ(join_graph->vertices.at(0), node_a);
+  EXPECT_EQ(join_graph->vertices.at(1), node_b);
+  EXPECT_EQ(join_graph->vertices.at(2), node_c);
+
+  ASSERT_EQ(join_graph->edges.size(), 2u);
+
+  EXPECT_EQ(join_graph->edges.at(0).vertex_set, JoinGraphVertexSet(3, 0b011));
+  EXPECT_EQ(join_graph->edges.at(0).join_mode, JoinMode::Inner);
+  EXPECT_FALSE(join_graph->edges.at(0).right_vertex_idx);
+
+  EXPECT_EQ(join_graph->edges.at(1).vertex_set, JoinGraphVertexSet(3, 0b110));
+  EXPECT_EQ(join_graph->edges.at(1).join_mode, JoinMode::Semi);
+  EXPECT_EQ(join_graph->edges.at(1).right_vertex_idx, 2u);
+  ASSERT_EQ(join_graph->edges.at(1).predicates.size(), 1u);
+  EXPECT_EQ(*join_graph->edges.at(1).predicates.at(0), *equals_(b_b, c_a));
+}
+
 TEST_F(JoinGraphBuilderTest, MultipleComponents) {
   // Test that components in the join graph get merged with a cross join
 
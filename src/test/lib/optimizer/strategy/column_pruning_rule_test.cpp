@@ -4,8 +4,10 @@
 #include "logical_query_plan/aggregate_node.hpp"
 #include "logical_query_plan/change_meta_table_node.hpp"
 #include "logical_query_plan/delete_node.hpp"
+#include "logical_query_plan/except_node.hpp"
 #include "logical_query_plan/export_node.hpp"
 #include "logical_query_plan/insert_node.hpp"
+#include "logical_query_plan/intersect_node.hpp"
 #include "logical_query_plan/join_node.hpp"
 #include "logical_query_plan/mock_node.hpp"
 #include "logical_query_plan/predicate_node.hpp"
@@ -124,6 +126,26 @@ TEST_F(ColumnPruningRuleTest, WithUnion) {
   }
 }
 
+TEST_F(ColumnPruningRuleTest, SetOperationsRequireAllColumns) {
+  // Set operations of different inputs compare (Unique, Intersect, Except) or match (All) the columns of both inputs by
+  // their position. Thus, no column may be pruned below them.
+  const auto set_operation_lqps = std::vector<std::shared_ptr<AbstractLQPNode>>{
+      UnionNode::make(SetOperationMode::Unique, node_abc, node_uvw),
+      UnionNode::make(SetOperationMode::All, node_abc, node_uvw),
+      IntersectNode::make(SetOperationMode::Unique, node_abc, node_uvw),
+      ExceptNode::make(SetOperationMode::All, node_abc, node_uvw)};
+
+  for (const auto& set_operation_lqp : set_operation_lqps) {
+    SCOPED_TRACE(set_operation_lqp->description());
+    const auto lqp = ProjectionNode::make(expression_vector(a), set_operation_lqp)->deep_copy();
+    const auto expected_lqp = lqp->deep_copy();
+
+    const auto actual_lqp = apply_rule(rule, lqp);
+
+    EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+  }
+}
+
 TEST_F(ColumnPruningRuleTest, WithMultipleProjections) {
   auto lqp = std::shared_ptr<AbstractLQPNode>{};
 
@@ -11,9 +11,11 @@
 #include "expression/abstract_expression.hpp"
 #include "expression/expression_functional.hpp"
 #include "hyrise.hpp"
+#include "logical_query_plan/join_node.hpp"
 #include "logical_query_plan/mock_node.hpp"
 #include "logical_query_plan/predicate_node.hpp"
 #include "logical_query_plan/stored_table_node.hpp"
+#include "logical_query_plan/validate_node.hpp"
 #include "optimizer/strategy/index_scan_rule.hpp"
 #include "statistics/attribute_statistics.hpp"
 #include "statistics/table_statistics.hpp"
@@ -177,4 +179,89 @@ TEST_F(IndexScanRuleTest, IndexScanOnlyOnOutputOfStoredTableNode) {
   EXPECT_EQ(predicate_node_1->scan_type, ScanType::TableScan);
 }
 
+TEST_F(IndexScanRuleTest, TableIndexScanForEquals) {
+  table->create_table_index(ColumnID{0}, "idx");
+
+  generate_mock_statistics(1'000'000);
+  table->table_statistics()->column_statistics.at(0)->set_statistics_object(
+      GenericHistogram<int32_t>::with_single_bin(0, 1'000'000, 1'000'000, 1'000'000));
+
+  // Predicates directly on the StoredTableNode and predicates above a ValidateNode can use the table index.
+  const auto predicate_node_0 = PredicateNode::make(equals_(a, 19), stored_table_node);
+  StrategyBaseTest::apply_rule(rule, predicate_node_0);
+  EXPECT_EQ(predicate_node_0->scan_type, ScanType::IndexScan);
+
+  const auto predicate_node_1 = PredicateNode::make(equals_(a, 19), ValidateNode::make(stored_table_node));
+  StrategyBaseTest::apply_rule(rule, predicate_node_1);
+  EXPECT_EQ(predicate_node_1->scan_type, ScanType::IndexScan);
+
+  // Table indexes can only be probed for single values.
+  for (const auto& predicate : {greater_than_(a, 19), equals_(a, b), equals_(a, NullValue{}), equals_(b, 19)}) {
+    const auto predicate_node = PredicateNode::make(predicate, stored_table_node);
+    StrategyBaseTest::apply_rule(rule, predicate_node);
+    EXPECT_EQ(predicate_node->scan_type, ScanType::TableScan);
+  }
+}
+
+TEST_F(IndexScanRuleTest, PrimaryKeyLookup) {
+  table->add_soft_key_constraint({{ColumnID{0}, ColumnID{2}}, KeyConstraintType::PRIMARY_KEY});
+  table->create_primary_key_index();
+  generate_mock_statistics();
+
+  // Primary key lookups are used independent of the selectivity if all key columns are bound. Only the topmost
+  // PredicateNode of the chain is marked.
+  const auto lower_predicate_node = PredicateNode::make(
+      equals_(19, a), PredicateNode::make(greater_than_(b, 5), ValidateNode::make(stored_table_node)));
+  const auto predicate_node = PredicateNode::make(equals_(c, 11), lower_predicate_node);
+  StrategyBaseTest::apply_rule(rule, predicate_node);
+  EXPECT_EQ(predicate_node->scan_type, ScanType::IndexScan);
+  EXPECT_EQ(lower_predicate_node->scan_type, ScanType::TableScan);
+
+  // Column c is not bound to a single value.
+  for (const auto& predicate : {equals_(b, 11), less_than_(c, 11), equals_(c, NullValue{}), equals_(c, a)}) {
+    const auto partial_predicate_node =
+        PredicateNode::make(predicate, PredicateNode::make(equals_(a, 19), stored_table_node));
+    StrategyBaseTest::apply_rule(rule, partial_predicate_node);
+    EXPECT_EQ(partial_predicate_node->scan_type, ScanType::TableScan);
+  }
+}
+
+TEST_F(IndexScanRuleTest, JoinIndexSide) {
+  table->create_table_index(ColumnID{0}, "idx");
+  generate_mock_statistics(1'000'000);
+
+  // The other table has four rows.
+  Hyrise::get().storage_manager.add_table("b", load_table("resources/test_data/tbl/int_int_int.tbl"));
+  const auto other_stored_table_node = StoredTableNode::make("b");
+  const auto other_a = other_stored_table_node->get_column("a");
+
+  const auto join_node = JoinNode::make(JoinMode::Inner, equals_(other_a, a), other_stored_table_node,
+                                        ValidateNode::make(stored_table_node));
+  StrategyBaseTest::apply_rule(rule, join_node);
+  EXPECT_EQ(join_node->index_side, LQPInputSide::Right);
+
+  // The index side is the larger input.
+  const auto flipped_join_node =
+      JoinNode::make(JoinMode::Inner, equals_(a, other_a), stored_table_node, other_stored_table_node);
+  StrategyBaseTest::apply_rule(rule, flipped_join_node);
+  EXPECT_EQ(flipped_join_node->index_side, LQPInputSide::Left);
+
+  // Only inner equi-joins on indexed columns are supported.
+  for (const auto& join_node_without_index :
+       {JoinNode::make(JoinMode::Left, equals_(other_a, a), other_stored_table_node, stored_table_node),
+        JoinNode::make(JoinMode::Inner, less_than_(other_a, a), other_stored_table_node, stored_table_node),
+        JoinNode::make(JoinMode::Inner, equals_(other_a, b), other_stored_table_node, stored_table_node)}) {
+    StrategyBaseTest::apply_rule(rule, join_node_without_index);
+    EXPECT_FALSE(join_node_without_index->index_side);
+  }
+
+  // GetTable does not forward the index if a column before the indexed one is pruned.
+  stored_table_node->set_pruned_column_ids({ColumnID{0}});
+  const auto pruned_join_node = JoinNode::make(JoinMode::Inner, equals_(other_a, b), other_stored_table_node,
+                                               stored_table_node);
+  table->create_table_index(ColumnID{1}, "idx_b");
+  StrategyBaseTest::apply_rule(rule, pruned_join_node);
+  EXPECT_FALSE(pruned_join_node->index_side);
+}
+
 }  // namespace hyrise
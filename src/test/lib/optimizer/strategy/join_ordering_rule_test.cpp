@@ -4,6 +4,7 @@
 #include "expression/expression_functional.hpp"
 #include "logical_query_plan/aggregate_node.hpp"
 #include "logical_query_plan/join_node.hpp"
+#include "logical_query_plan/lqp_utils.hpp"
 #include "logical_query_plan/mock_node.hpp"
 #include "logical_query_plan/predicate_node.hpp"
 #include "optimizer/strategy/join_ordering_rule.hpp"
@@ -78,4 +79,39 @@ TEST_F(JoinOrderingRuleTest, MultipleJoinGraphs) {
   EXPECT_LQP_EQ(actual_lqp, expected_lqp);
 }
 
+TEST_F(JoinOrderingRuleTest, OnlySemiAndAntiJoinGraphs) {
+  const auto semi_and_anti_join_rule = std::make_shared<JoinOrderingRule>(true);
+
+  // Graphs without semi or anti joins keep their order.
+  // clang-format off
+  const auto inner_join_lqp =
+  PredicateNode::make(equals_(a_a, b_b),
+    JoinNode::make(JoinMode::Cross,
+      node_a,
+      node_b));
+  // clang-format on
+
+  const auto expected_inner_join_lqp = inner_join_lqp->deep_copy();
+  EXPECT_LQP_EQ(apply_rule(semi_and_anti_join_rule, inner_join_lqp), expected_inner_join_lqp);
+
+  // Graphs with semi joins are ordered, including their inner joins.
+  // clang-format off
+  const auto semi_join_lqp =
+  PredicateNode::make(equals_(a_a, b_b),
+    JoinNode::make(JoinMode::Cross,
+      node_a,
+      JoinNode::make(JoinMode::Semi, equals_(b_b, c_c),
+        node_b,
+        node_c)));
+  // clang-format on
+
+  const auto actual_lqp = apply_rule(semi_and_anti_join_rule, semi_join_lqp);
+  auto join_modes = std::vector<JoinMode>{};
+  for (const auto& node : lqp_find_nodes_by_type(actual_lqp, LQPNodeType::Join)) {
+    join_modes.emplace_back(static_cast<const JoinNode&>(*node).join_mode);
+  }
+  std::sort(join_modes.begin(), join_modes.end());
+  EXPECT_EQ(join_modes, std::vector<JoinMode>({JoinMode::Inner, JoinMode::Semi}));
+}
+
 }  // namespace hyrise
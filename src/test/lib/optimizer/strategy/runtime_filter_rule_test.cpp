@@ -0,0 +1,102 @@
+#include "lib/optimizer/strategy/strategy_base_test.hpp"
+
+#include "logical_query_plan/join_node.hpp"
+#include "optimizer/strategy/runtime_filter_rule.hpp"
+
+namespace hyrise {
+
+using namespace expression_functional;  // NOLINT(build/namespaces)
+
+class RuntimeFilterRuleTest : public StrategyBaseTest {
+ protected:
+  void SetUp() override {
+    {
+      const auto histogram = GenericHistogram<int32_t>::with_single_bin(1, 100'000, 100'000, 100'000);
+      _fact_node = create_mock_node_with_statistics({{DataType::Int, "a"}}, 100'000, {histogram});
+      _fact_a = _fact_node->get_column("a");
+    }
+
+    {
+      const auto histogram = GenericHistogram<int32_t>::with_single_bin(1, 100, 100, 100);
+      _dimension_node = create_mock_node_with_statistics({{DataType::Int, "a"}}, 100, {histogram});
+      _dimension_a = _dimension_node->get_column("a");
+    }
+
+    {
+      const auto histogram = GenericHistogram<int32_t>::with_single_bin(1, 100'000, 80'000, 80'000);
+      _large_dimension_node = create_mock_node_with_statistics({{DataType::Int, "a"}}, 80'000, {histogram});
+      _large_dimension_a = _large_dimension_node->get_column("a");
+    }
+
+    {
+      const auto histogram = GenericHistogram<int32_t>::with_single_bin(1, 100'000, 500, 500);
+      _small_node = create_mock_node_with_statistics({{DataType::Int, "a"}}, 500, {histogram});
+      _small_a = _small_node->get_column("a");
+    }
+  }
+
+  std::optional<LQPInputSide> runtime_filter_side(const std::shared_ptr<AbstractLQPNode>& lqp) {
+    const auto actual_lqp = StrategyBaseTest::apply_rule(_rule, lqp);
+    return std::static_pointer_cast<JoinNode>(actual_lqp)->runtime_filter_side;
+  }
+
+  std::shared_ptr<MockNode> _fact_node, _dimension_node, _large_dimension_node, _small_node;
+  std::shared_ptr<LQPColumnExpression> _fact_a, _dimension_a, _large_dimension_a, _small_a;
+  std::shared_ptr<RuntimeFilterRule> _rule{std::make_shared<RuntimeFilterRule>()};
+};
+
+TEST_F(RuntimeFilterRuleTest, BuildFromSmallerInputOfInnerJoin) {
+  const auto join_node = JoinNode::make(JoinMode::Inner, equals_(_fact_a, _dimension_a), _fact_node, _dimension_node);
+  EXPECT_EQ(runtime_filter_side(join_node), LQPInputSide::Right);
+
+  const auto swapped_join_node =
+      JoinNode::make(JoinMode::Inner, equals_(_dimension_a, _fact_a), _dimension_node, _fact_node);
+  EXPECT_EQ(runtime_filter_side(swapped_join_node), LQPInputSide::Left);
+}
+
+TEST_F(RuntimeFilterRuleTest, BuildFromRightInputOfSemiJoin) {
+  const auto join_node = JoinNode::make(JoinMode::Semi, equals_(_fact_a, _dimension_a), _fact_node, _dimension_node);
+  EXPECT_EQ(runtime_filter_side(join_node), LQPInputSide::Right);
+
+  // Only rows of the left input can be dropped.
+  const auto swapped_join_node =
+      JoinNode::make(JoinMode::Semi, equals_(_dimension_a, _fact_a), _dimension_node, _fact_node);
+  EXPECT_EQ(runtime_filter_side(swapped_join_node), std::nullopt);
+}
+
+TEST_F(RuntimeFilterRuleTest, NoFilterForUnselectiveJoin) {
+  const auto join_node =
+      JoinNode::make(JoinMode::Inner, equals_(_fact_a, _large_dimension_a), _fact_node, _large_dimension_node);
+  EXPECT_EQ(runtime_filter_side(join_node), std::nullopt);
+}
+
+TEST_F(RuntimeFilterRuleTest, NoFilterForSmallProbeInput) {
+  const auto join_node = JoinNode::make(JoinMode::Inner, equals_(_small_a, _dimension_a), _small_node, _dimension_node);
+  EXPECT_EQ(runtime_filter_side(join_node), std::nullopt);
+}
+
+TEST_F(RuntimeFilterRuleTest, NoFilterForUnsupportedJoins) {
+  for (const auto join_mode : {JoinMode::Left, JoinMode::Right, JoinMode::FullOuter, JoinMode::AntiNullAsTrue,
+                               JoinMode::AntiNullAsFalse}) {
+    const auto join_node = JoinNode::make(join_mode, equals_(_fact_a, _dimension_a), _fact_node, _dimension_node);
+    EXPECT_EQ(runtime_filter_side(join_node), std::nullopt);
+  }
+
+  const auto non_equi_join_node =
+      JoinNode::make(JoinMode::Inner, less_than_(_fact_a, _dimension_a), _fact_node, _dimension_node);
+  EXPECT_EQ(runtime_filter_side(non_equi_join_node), std::nullopt);
+
+  const auto index_join_node =
+      JoinNode::make(JoinMode::Inner, equals_(_fact_a, _dimension_a), _fact_node, _dimension_node);
+  index_join_node->index_side = LQPInputSide::Left;
+  EXPECT_EQ(runtime_filter_side(index_join_node), std::nullopt);
+}
+
+TEST_F(RuntimeFilterRuleTest, ResetsPreviousDecision) {
+  const auto join_node =
+      JoinNode::make(JoinMode::Inner, equals_(_fact_a, _large_dimension_a), _fact_node, _large_dimension_node);
+  join_node->runtime_filter_side = LQPInputSide::Right;
+  EXPECT_EQ(runtime_filter_side(join_node), std::nullopt);
+}
+
+}  // namespace hyrise
@@ -0,0 +1,91 @@
+#include <memory>
+
+#include "expression/expression_functional.hpp"
+#include "logical_query_plan/limit_node.hpp"
+#include "logical_query_plan/mock_node.hpp"
+#include "logical_query_plan/sort_node.hpp"
+#include "logical_query_plan/union_node.hpp"
+#include "optimizer/strategy/top_k_rule.hpp"
+#include "strategy_base_test.hpp"
+
+namespace hyrise {
+
+using namespace expression_functional;  // NOLINT(build/namespaces)
+
+class TopKRuleTest : public StrategyBaseTest {
+ public:
+  void SetUp() override {
+    rule = std::make_shared<TopKRule>();
+    node = MockNode::make(MockNode::ColumnDefinitions{{DataType::Int, "a"}, {DataType::Int, "b"}});
+    a = node->get_column("a");
+    b = node->get_column("b");
+  }
+
+  std::shared_ptr<TopKRule> rule;
+  std::shared_ptr<MockNode> node;
+  std::shared_ptr<LQPColumnExpression> a, b;
+};
+
+TEST_F(TopKRuleTest, FusesLimitWithSort) {
+  // clang-format off
+  const auto input_lqp =
+  LimitNode::make(value_(int64_t{10}),
+    SortNode::make(expression_vector(a, b), std::vector<SortMode>{SortMode::Descending, SortMode::Ascending},
+      node));
+
+  const auto expected_limit_node = LimitNode::make(value_(int64_t{10}),
+    SortNode::make(expression_vector(a, b), std::vector<SortMode>{SortMode::Descending, SortMode::Ascending},
+      node));
+  // clang-format on
+  expected_limit_node->fuse_with_sort = true;
+
+  const auto actual_lqp = apply_rule(rule, input_lqp);
+
+  EXPECT_LQP_EQ(actual_lqp, expected_limit_node);
+  EXPECT_TRUE(std::static_pointer_cast<LimitNode>(actual_lqp)->fuse_with_sort);
+}
+
+TEST_F(TopKRuleTest, LimitTooLarge) {
+  const auto sort_node = SortNode::make(expression_vector(a), std::vector<SortMode>{SortMode::Ascending}, node);
+  const auto input_lqp = LimitNode::make(value_(TopKRule::MAX_ROW_COUNT + 1), sort_node);
+  const auto expected_lqp = input_lqp->deep_copy();
+  const auto actual_lqp = apply_rule(rule, input_lqp);
+
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+  EXPECT_FALSE(std::static_pointer_cast<LimitNode>(actual_lqp)->fuse_with_sort);
+}
+
+TEST_F(TopKRuleTest, LimitIsNoLiteral) {
+  // The number of rows of a placeholder is only known when the plan is executed.
+  const auto sort_node = SortNode::make(expression_vector(a), std::vector<SortMode>{SortMode::Ascending}, node);
+  const auto input_lqp = LimitNode::make(placeholder_(ParameterID{0}), sort_node);
+  const auto actual_lqp = apply_rule(rule, input_lqp);
+
+  EXPECT_FALSE(std::static_pointer_cast<LimitNode>(actual_lqp)->fuse_with_sort);
+}
+
+TEST_F(TopKRuleTest, InputIsNoSort) {
+  const auto input_lqp = LimitNode::make(value_(int64_t{10}), node);
+  const auto actual_lqp = apply_rule(rule, input_lqp);
+
+  EXPECT_FALSE(std::static_pointer_cast<LimitNode>(actual_lqp)->fuse_with_sort);
+}
+
+TEST_F(TopKRuleTest, SortHasMultipleOutputs) {
+  // The sorted result is needed by another node, so the SortNode must remain a separate operator.
+  const auto sort_node = SortNode::make(expression_vector(a), std::vector<SortMode>{SortMode::Ascending}, node);
+  const auto limit_node = LimitNode::make(value_(int64_t{10}), sort_node);
+
+  // clang-format off
+  const auto input_lqp =
+  UnionNode::make(SetOperationMode::All,
+    limit_node,
+    sort_node);
+  // clang-format on
+
+  apply_rule(rule, input_lqp);
+
+  EXPECT_FALSE(limit_node->fuse_with_sort);
+}
+
+}  // namespace hyrise
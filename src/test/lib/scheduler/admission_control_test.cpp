@@ -0,0 +1,112 @@
+#include <chrono>
+#include <thread>
+
+#include "base_test.hpp"
+
+#include "hyrise.hpp"
+#include "scheduler/admission_control.hpp"
+#include "scheduler/query_task_group.hpp"
+#include "sql/sql_pipeline_builder.hpp"
+
+namespace hyrise {
+
+class AdmissionControlTest : public BaseTest {};
+
+TEST_F(AdmissionControlTest, AdmitsAllQueriesWithoutLimit) {
+  auto& admission_control = Hyrise::get().admission_control;
+  EXPECT_EQ(admission_control.max_concurrent_queries(), 0);
+
+  const auto query_a = admission_control.admit("a", QueryTaskGroup::DEFAULT_WEIGHT);
+  const auto query_b = admission_control.admit("b", 2 * QueryTaskGroup::DEFAULT_WEIGHT);
+  EXPECT_EQ(query_a->state(), QueryTaskGroupState::Running);
+  EXPECT_EQ(query_b->state(), QueryTaskGroupState::Running);
+  EXPECT_EQ(query_b->description(), "b");
+  EXPECT_EQ(query_b->weight(), 2 * QueryTaskGroup::DEFAULT_WEIGHT);
+  EXPECT_LT(query_a->id(), query_b->id());
+  EXPECT_EQ(admission_control.query_task_groups(), (std::vector<std::shared_ptr<QueryTaskGroup>>{query_a, query_b}));
+
+  admission_control.release(query_a);
+  admission_control.release(query_b);
+  EXPECT_TRUE(admission_control.query_task_groups().empty());
+}
+
+TEST_F(AdmissionControlTest, LimitsConcurrentQueries) {
+  auto& admission_control = Hyrise::get().admission_control;
+  admission_control.set_max_concurrent_queries(1);
+
+  const auto query_a = admission_control.admit("a", QueryTaskGroup::DEFAULT_WEIGHT);
+
+  auto query_b_finished = std::atomic_bool{false};
+  auto thread = std::thread([&]() {
+    const auto admission = AdmissionControl::ScopedAdmission{admission_control, "b", QueryTaskGroup::DEFAULT_WEIGHT};
+    query_b_finished = true;
+  });
+
+  // Query b waits until query a is released.
+  while (admission_control.query_task_groups().size() < 2) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  EXPECT_FALSE(query_b_finished);
+  EXPECT_EQ(admission_control.query_task_groups().back()->state(), QueryTaskGroupState::Waiting);
+
+  admission_control.release(query_a);
+  thread.join();
+  EXPECT_TRUE(query_b_finished);
+  EXPECT_TRUE(admission_control.query_task_groups().empty());
+}
+
+TEST_F(AdmissionControlTest, AdmitsNestedQueriesImmediately) {
+  auto& admission_control = Hyrise::get().admission_control;
+  admission_control.set_max_concurrent_queries(1);
+
+  // A thread that executes an admitted query would wait for itself.
+  const auto query_a = admission_control.admit("a", QueryTaskGroup::DEFAULT_WEIGHT);
+  const auto query_b = admission_control.admit("b", QueryTaskGroup::DEFAULT_WEIGHT);
+  EXPECT_EQ(query_b->state(), QueryTaskGroupState::Running);
+
+  admission_control.release(query_b);
+  admission_control.release(query_a);
+}
+
+TEST_F(AdmissionControlTest, Setting) {
+  const auto& setting = Hyrise::get().settings_manager.get_setting("AdmissionControl.max_concurrent_queries");
+  EXPECT_EQ(setting->get(), "0");
+
+  setting->set("4");
+  EXPECT_EQ(Hyrise::get().admission_control.max_concurrent_queries(), 4);
+  EXPECT_EQ(setting->get(), "4");
+
+  EXPECT_THROW(setting->set("-1"), InvalidInputException);
+  EXPECT_THROW(setting->set("four"), InvalidInputException);
+  EXPECT_THROW(setting->set("99999999999"), InvalidInputException);
+  EXPECT_EQ(Hyrise::get().admission_control.max_concurrent_queries(), 4);
+}
+
+TEST_F(AdmissionControlTest, SQLPipelineIsAdmitted) {
+  auto& admission_control = Hyrise::get().admission_control;
+  const auto running_query = admission_control.admit("SELECT 1", 3 * QueryTaskGroup::DEFAULT_WEIGHT);
+
+  // Meta tables are generated during the translation, i.e., before the query itself is admitted.
+  auto sql_pipeline = SQLPipelineBuilder{"SELECT * FROM meta_queries"}
+                          .with_scheduling_weight(2 * QueryTaskGroup::DEFAULT_WEIGHT)
+                          .create_pipeline();
+  const auto [pipeline_status, table] = sql_pipeline.get_result_table();
+  EXPECT_EQ(pipeline_status, SQLPipelineStatus::Success);
+
+  ASSERT_EQ(table->row_count(), 1);
+  EXPECT_EQ(table->get_value<int64_t>(ColumnID{0}, 0), static_cast<int64_t>(running_query->id()));
+  EXPECT_EQ(table->get_value<pmr_string>(ColumnID{1}, 0), "Running");
+  EXPECT_EQ(table->get_value<int32_t>(ColumnID{2}, 0), static_cast<int32_t>(3 * QueryTaskGroup::DEFAULT_WEIGHT));
+  EXPECT_EQ(table->get_value<pmr_string>(ColumnID{5}, 0), "SELECT 1");
+
+  // The pipeline released its query after the execution.
+  EXPECT_EQ(admission_control.query_task_groups(), (std::vector<std::shared_ptr<QueryTaskGroup>>{running_query}));
+  admission_control.release(running_query);
+
+  EXPECT_THROW(SQLPipelineBuilder{"SELECT 1"}.with_scheduling_weight(0), InvalidInputException);
+  EXPECT_THROW(SQLPipelineBuilder{"SELECT 1"}.with_scheduling_weight(QueryTaskGroup::MAX_WEIGHT + 1),
+               InvalidInputException);
+}
+
+}  // namespace hyrise
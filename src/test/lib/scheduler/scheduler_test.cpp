@@ -14,6 +14,7 @@
 #include "scheduler/job_task.hpp"
 #include "scheduler/node_queue_scheduler.hpp"
 #include "scheduler/operator_task.hpp"
+#include "scheduler/query_task_group.hpp"
 #include "scheduler/task_queue.hpp"
 
 namespace hyrise {
@@ -373,4 +374,90 @@ TEST_F(SchedulerTest, MergeSort) {
   EXPECT_TRUE(std::is_sorted(vector_to_sort.begin(), vector_to_sort.end()));
 }
 
+TEST_F(SchedulerTest, WorkStealingMergeSort) {
+  constexpr auto ITEM_COUNT = size_t{5'000};
+
+  Hyrise::get().topology.use_fake_numa_topology(8, 4);
+  const auto node_queue_scheduler = std::make_shared<NodeQueueScheduler>(NodeQueueSchedulerMode::WorkStealingDeques);
+  Hyrise::get().set_scheduler(node_queue_scheduler);
+  EXPECT_EQ(node_queue_scheduler->mode(), NodeQueueSchedulerMode::WorkStealingDeques);
+  for (const auto& worker : node_queue_scheduler->workers()) {
+    EXPECT_TRUE(worker->uses_local_deque());
+  }
+
+  auto vector_to_sort = std::vector<int64_t>(ITEM_COUNT);
+  for (auto index = size_t{0}; index < ITEM_COUNT; ++index) {
+    vector_to_sort[index] = static_cast<int64_t>((index * 7'919) % ITEM_COUNT);
+  }
+
+  // Start the sort on a worker so that the spawned tasks are pushed to the workers' local deques.
+  const auto sort_task = std::make_shared<JobTask>([&]() { merge_sort(vector_to_sort.begin(), vector_to_sort.end()); });
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks({sort_task});
+  EXPECT_TRUE(std::is_sorted(vector_to_sort.begin(), vector_to_sort.end()));
+
+  Hyrise::get().scheduler()->finish();
+}
+
+TEST_F(SchedulerTest, WorkStealingDependencies) {
+  Hyrise::get().topology.use_fake_numa_topology(8, 4);
+  Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>(NodeQueueSchedulerMode::WorkStealingDeques));
+
+  // Schedule tasks with dependencies, subtasks, and non-stealable tasks from within a worker.
+  auto linear_counter = std::atomic_uint32_t{0};
+  auto multiple_counter = std::atomic_uint32_t{0};
+  auto diamond_counter = std::atomic_uint32_t{0};
+  auto subtask_counter = std::atomic_uint32_t{0};
+  const auto task = std::make_shared<JobTask>([&]() {
+    stress_linear_dependencies(linear_counter);
+    stress_multiple_dependencies(multiple_counter);
+    stress_diamond_dependencies(diamond_counter);
+    increment_counter_in_subtasks(subtask_counter);
+
+    const auto non_stealable_task =
+        std::make_shared<JobTask>([&]() { ++subtask_counter; }, SchedulePriority::Default, false);
+    Hyrise::get().scheduler()->schedule_and_wait_for_tasks({non_stealable_task});
+  });
+  task->schedule();
+
+  Hyrise::get().scheduler()->finish();
+
+  EXPECT_EQ(linear_counter, 3u);
+  EXPECT_EQ(multiple_counter, 4u);
+  EXPECT_EQ(diamond_counter, 7u);
+  EXPECT_EQ(subtask_counter, 31u);
+}
+
+TEST_F(SchedulerTest, QueryTaskGroupIsInherited) {
+  Hyrise::get().topology.use_fake_numa_topology(8, 4);
+  Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+
+  constexpr auto SUBTASK_COUNT = size_t{10};
+  const auto query_task_group = std::make_shared<QueryTaskGroup>(0, "query", QueryTaskGroup::DEFAULT_WEIGHT);
+
+  // Tasks scheduled by a task of the group, even nested ones, belong to the same group.
+  auto subtasks = std::vector<std::shared_ptr<AbstractTask>>{};
+  const auto task = std::make_shared<JobTask>([&]() {
+    for (auto subtask_id = size_t{0}; subtask_id < SUBTASK_COUNT; ++subtask_id) {
+      subtasks.emplace_back(std::make_shared<JobTask>([]() {}));
+    }
+    Hyrise::get().scheduler()->schedule_and_wait_for_tasks(subtasks);
+  });
+  task->set_query_task_group(query_task_group);
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks({task});
+
+  ASSERT_EQ(subtasks.size(), SUBTASK_COUNT);
+  for (const auto& subtask : subtasks) {
+    EXPECT_EQ(subtask->query_task_group(), query_task_group);
+  }
+  EXPECT_EQ(query_task_group->scheduled_task_count(), SUBTASK_COUNT + 1);
+  EXPECT_EQ(query_task_group->finished_task_count(), SUBTASK_COUNT + 1);
+
+  // Tasks scheduled by a thread that does not execute a grouped task do not belong to a group.
+  const auto ungrouped_task = std::make_shared<JobTask>([]() {});
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks({ungrouped_task});
+  EXPECT_FALSE(ungrouped_task->query_task_group());
+
+  Hyrise::get().scheduler()->finish();
+}
+
 }  // namespace hyrise
@@ -1,11 +1,19 @@
 #include "base_test.hpp"
 
 #include "scheduler/job_task.hpp"
+#include "scheduler/query_task_group.hpp"
 #include "scheduler/task_queue.hpp"
 
 namespace hyrise {
 
-class TaskQueueTest : public BaseTest {};
+class TaskQueueTest : public BaseTest {
+ protected:
+  static std::shared_ptr<AbstractTask> create_task(const std::shared_ptr<QueryTaskGroup>& query_task_group) {
+    auto task = std::make_shared<JobTask>([]() { return; });
+    task->set_query_task_group(query_task_group);
+    return task;
+  }
+};
 
 TEST_F(TaskQueueTest, StealableJobs) {
   auto task_queue = TaskQueue{NodeID{0}};
@@ -28,4 +36,92 @@ TEST_F(TaskQueueTest, EstimateLoad) {
   EXPECT_EQ(task_queue.estimate_load(), size_t{3});
 }
 
+TEST_F(TaskQueueTest, FairSchedulingOfQueryTaskGroups) {
+  auto task_queue = TaskQueue{NodeID{0}};
+
+  // The tasks of the second query are pushed after the tasks of the first query. As the second query has twice the
+  // weight, it gets two tasks for every task of the first query.
+  const auto query_a = std::make_shared<QueryTaskGroup>(0, "a", QueryTaskGroup::DEFAULT_WEIGHT);
+  const auto query_b = std::make_shared<QueryTaskGroup>(1, "b", 2 * QueryTaskGroup::DEFAULT_WEIGHT);
+  for (auto task_id = 0; task_id < 4; ++task_id) {
+    task_queue.push(create_task(query_a), SchedulePriority::Default);
+  }
+  for (auto task_id = 0; task_id < 4; ++task_id) {
+    task_queue.push(create_task(query_b), SchedulePriority::Default);
+  }
+
+  const auto high_priority_task = create_task(query_a);
+  task_queue.push(high_priority_task, SchedulePriority::High);
+  EXPECT_EQ(task_queue.estimate_load(), size_t{10});
+
+  // High-priority tasks are pulled first.
+  EXPECT_EQ(task_queue.pull(), high_priority_task);
+
+  auto pulled_queries = std::vector<std::shared_ptr<QueryTaskGroup>>{};
+  while (auto task = task_queue.pull()) {
+    pulled_queries.emplace_back(task->query_task_group());
+  }
+  EXPECT_EQ(pulled_queries,
+            (std::vector<std::shared_ptr<QueryTaskGroup>>{query_a, query_b, query_b, query_b, query_a, query_b,
+                                                          query_a, query_a}));
+  EXPECT_TRUE(task_queue.empty());
+}
+
+TEST_F(TaskQueueTest, FairSchedulingOfQueryTaskGroupsWithSamePass) {
+  auto task_queue = TaskQueue{NodeID{0}};
+
+  // Groups with the same pass are served in the order in which they became active, regardless of their IDs or
+  // addresses.
+  const auto query_a = std::make_shared<QueryTaskGroup>(0, "a", QueryTaskGroup::DEFAULT_WEIGHT);
+  const auto query_b = std::make_shared<QueryTaskGroup>(1, "b", QueryTaskGroup::DEFAULT_WEIGHT);
+  for (auto task_id = 0; task_id < 2; ++task_id) {
+    task_queue.push(create_task(query_b), SchedulePriority::Default);
+  }
+  for (auto task_id = 0; task_id < 2; ++task_id) {
+    task_queue.push(create_task(query_a), SchedulePriority::Default);
+  }
+
+  auto pulled_queries = std::vector<std::shared_ptr<QueryTaskGroup>>{};
+  while (auto task = task_queue.pull()) {
+    pulled_queries.emplace_back(task->query_task_group());
+  }
+  EXPECT_EQ(pulled_queries, (std::vector<std::shared_ptr<QueryTaskGroup>>{query_b, query_a, query_b, query_a}));
+}
+
+TEST_F(TaskQueueTest, FairSchedulingOfUngroupedTasks) {
+  auto task_queue = TaskQueue{NodeID{0}};
+
+  // Ungrouped tasks share the workers with query task groups as if they formed a group with the default weight.
+  const auto query = std::make_shared<QueryTaskGroup>(0, "query", QueryTaskGroup::DEFAULT_WEIGHT);
+  for (auto task_id = 0; task_id < 3; ++task_id) {
+    task_queue.push(create_task(query), SchedulePriority::Default);
+  }
+  for (auto task_id = 0; task_id < 3; ++task_id) {
+    task_queue.push(create_task(nullptr), SchedulePriority::Default);
+  }
+
+  auto pulled_queries = std::vector<std::shared_ptr<QueryTaskGroup>>{};
+  while (auto task = task_queue.pull()) {
+    pulled_queries.emplace_back(task->query_task_group());
+  }
+  EXPECT_EQ(pulled_queries,
+            (std::vector<std::shared_ptr<QueryTaskGroup>>{query, nullptr, query, nullptr, query, nullptr}));
+}
+
+TEST_F(TaskQueueTest, StealGroupedTasks) {
+  auto task_queue = TaskQueue{NodeID{0}};
+  const auto query = std::make_shared<QueryTaskGroup>(0, "query", QueryTaskGroup::DEFAULT_WEIGHT);
+
+  auto non_stealable_task = std::make_shared<JobTask>([]() { return; }, SchedulePriority::Default, false);
+  non_stealable_task->set_query_task_group(query);
+  task_queue.push(non_stealable_task, SchedulePriority::Default);
+  EXPECT_FALSE(task_queue.steal());
+
+  const auto stealable_task = create_task(query);
+  task_queue.push(stealable_task, SchedulePriority::Default);
+  EXPECT_EQ(task_queue.steal(), stealable_task);
+  EXPECT_EQ(task_queue.pull(), non_stealable_task);
+  EXPECT_TRUE(task_queue.empty());
+}
+
 }  // namespace hyrise
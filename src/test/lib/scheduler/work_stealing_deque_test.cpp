@@ -0,0 +1,128 @@
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "scheduler/job_task.hpp"
+#include "scheduler/work_stealing_deque.hpp"
+
+namespace hyrise {
+
+class WorkStealingDequeTest : public BaseTest {
+ protected:
+  static std::shared_ptr<AbstractTask> create_task() {
+    return std::make_shared<JobTask>([]() {});
+  }
+};
+
+TEST_F(WorkStealingDequeTest, PopLIFOStealFIFO) {
+  auto deque = WorkStealingDeque{};
+  EXPECT_FALSE(deque.pop());
+  EXPECT_FALSE(deque.steal());
+
+  const auto task_a = create_task();
+  const auto task_b = create_task();
+  const auto task_c = create_task();
+  deque.push(task_a);
+  deque.push(task_b);
+  deque.push(task_c);
+  EXPECT_EQ(deque.estimate_size(), 3);
+
+  EXPECT_EQ(deque.pop(), task_c);
+  EXPECT_EQ(deque.steal(), task_a);
+  EXPECT_EQ(deque.pop(), task_b);
+  EXPECT_FALSE(deque.pop());
+  EXPECT_FALSE(deque.steal());
+  EXPECT_EQ(deque.estimate_size(), 0);
+}
+
+TEST_F(WorkStealingDequeTest, Grow) {
+  auto deque = WorkStealingDeque{2};
+  auto tasks = std::vector<std::shared_ptr<AbstractTask>>{};
+  for (auto index = 0; index < 100; ++index) {
+    tasks.emplace_back(create_task());
+    deque.push(tasks.back());
+  }
+
+  // Steal some tasks so that the tasks wrap around in the grown buffer.
+  EXPECT_EQ(deque.steal(), tasks[0]);
+  EXPECT_EQ(deque.steal(), tasks[1]);
+  for (auto index = 100; index < 300; ++index) {
+    tasks.emplace_back(create_task());
+    deque.push(tasks.back());
+  }
+
+  for (auto index = 299; index >= 2; --index) {
+    EXPECT_EQ(deque.pop(), tasks[index]);
+  }
+  EXPECT_FALSE(deque.pop());
+}
+
+TEST_F(WorkStealingDequeTest, ReleasesRemainingTasks) {
+  auto task = create_task();
+  {
+    auto deque = WorkStealingDeque{};
+    deque.push(task);
+    EXPECT_EQ(task.use_count(), 2);
+  }
+  EXPECT_EQ(task.use_count(), 1);
+}
+
+TEST_F(WorkStealingDequeTest, ConcurrentStealing) {
+  // The owner pushes and pops tasks while thieves steal them. Each task must be claimed exactly once.
+  constexpr auto TASK_COUNT = 100'000;
+  constexpr auto THIEF_COUNT = 4;
+
+  auto deque = WorkStealingDeque{4};
+  auto claim_counts = std::vector<std::atomic_uint32_t>(TASK_COUNT);
+  auto tasks = std::vector<std::shared_ptr<AbstractTask>>(TASK_COUNT);
+  for (auto& task : tasks) {
+    task = create_task();
+  }
+
+  auto task_ids = std::unordered_map<const AbstractTask*, size_t>{};
+  for (auto task_id = size_t{0}; task_id < TASK_COUNT; ++task_id) {
+    task_ids[tasks[task_id].get()] = task_id;
+  }
+
+  const auto claim = [&](const std::shared_ptr<AbstractTask>& task) {
+    if (task) {
+      ++claim_counts[task_ids.at(task.get())];
+    }
+  };
+
+  auto owner_done = std::atomic_bool{false};
+  auto thieves = std::vector<std::thread>{};
+  for (auto thief_id = 0; thief_id < THIEF_COUNT; ++thief_id) {
+    thieves.emplace_back([&]() {
+      while (!owner_done || deque.estimate_size() > 0) {
+        claim(deque.steal());
+      }
+    });
+  }
+
+  for (auto task_id = size_t{0}; task_id < TASK_COUNT; ++task_id) {
+    deque.push(tasks[task_id]);
+    if (task_id % 3 == 0) {
+      claim(deque.pop());
+    }
+  }
+
+  while (auto task = deque.pop()) {
+    claim(task);
+  }
+  owner_done = true;
+
+  for (auto& thief : thieves) {
+    thief.join();
+  }
+
+  for (auto task_id = size_t{0}; task_id < TASK_COUNT; ++task_id) {
+    EXPECT_EQ(claim_counts[task_id], 1);
+  }
+}
+
+}  // namespace hyrise
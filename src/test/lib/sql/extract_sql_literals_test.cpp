@@ -0,0 +1,49 @@
+#include "base_test.hpp"
+
+#include "sql/extract_sql_literals.hpp"
+
+namespace hyrise {
+
+class ExtractSQLLiteralsTest : public BaseTest {};
+
+TEST_F(ExtractSQLLiteralsTest, NumericLiterals) {
+  const auto parameterized_sql = extract_sql_literals("SELECT a + 1 FROM t WHERE b > 3000000000 AND c < 4.5e1;");
+  ASSERT_TRUE(parameterized_sql);
+  EXPECT_EQ(parameterized_sql->sql, "SELECT a + ? FROM t WHERE b > ? AND c < ?;");
+
+  const auto& literals = parameterized_sql->literals;
+  ASSERT_EQ(literals.size(), 3);
+  EXPECT_EQ(literals[0], AllTypeVariant{int32_t{1}});
+  EXPECT_EQ(literals[1], AllTypeVariant{int64_t{3'000'000'000}});
+  EXPECT_EQ(literals[2], AllTypeVariant{45.0});
+}
+
+TEST_F(ExtractSQLLiteralsTest, StringLiterals) {
+  const auto parameterized_sql = extract_sql_literals("SELECT * FROM t WHERE a = 'it''s' OR a LIKE '%x%'");
+  ASSERT_TRUE(parameterized_sql);
+  EXPECT_EQ(parameterized_sql->sql, "SELECT * FROM t WHERE a = ? OR a LIKE ?");
+
+  const auto& literals = parameterized_sql->literals;
+  ASSERT_EQ(literals.size(), 2);
+  EXPECT_EQ(literals[0], AllTypeVariant{pmr_string{"it's"}});
+  EXPECT_EQ(literals[1], AllTypeVariant{pmr_string{"%x%"}});
+}
+
+TEST_F(ExtractSQLLiteralsTest, KeepsStructuralTokens) {
+  const auto sql = std::string{
+      "SELECT t1.a, \"col 2\" FROM t1 -- a = 1\n"
+      "WHERE d < DATE '2000-01-01' + INTERVAL '3' DAY /* 'b' */ AND e > interval 2 month"};
+  const auto parameterized_sql = extract_sql_literals(sql);
+  ASSERT_TRUE(parameterized_sql);
+  EXPECT_EQ(parameterized_sql->sql, sql);
+  EXPECT_TRUE(parameterized_sql->literals.empty());
+}
+
+TEST_F(ExtractSQLLiteralsTest, Unsupported) {
+  EXPECT_FALSE(extract_sql_literals("SELECT * FROM t WHERE a = ?"));
+  EXPECT_FALSE(extract_sql_literals("SELECT * FROM t WHERE a = 'abc"));
+  EXPECT_FALSE(extract_sql_literals("SELECT * FROM t WHERE a = 'a\\'b'"));
+  EXPECT_FALSE(extract_sql_literals("SELECT * FROM t WHERE a = 1abc"));
+}
+
+}  // namespace hyrise
@@ -17,6 +17,9 @@
 #include "sql/sql_pipeline_builder.hpp"
 #include "sql/sql_pipeline_statement.hpp"
 #include "sql/sql_plan_cache.hpp"
+#include "statistics/generate_pruning_statistics.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/prepared_plan.hpp"
 
 namespace {
 // This function is a slightly hacky way to check whether an LQP was optimized. This relies on JoinOrderingRule and
@@ -634,6 +637,103 @@ TEST_F(SQLPipelineStatementTest, CacheQueryPlan) {
   EXPECT_TRUE(_lqp_cache->has(_select_query_a));
 }
 
+TEST_F(SQLPipelineStatementTest, ParameterizedLQPCache) {
+  const auto parameterized_lqp_cache = std::make_shared<SQLParameterizedPlanCache>();
+
+  auto sql_pipeline_1 = SQLPipelineBuilder{"SELECT * FROM table_a WHERE a > 1000"}
+                            .with_parameterized_lqp_cache(parameterized_lqp_cache)
+                            .create_pipeline();
+  auto statement_1 = get_sql_pipeline_statements(sql_pipeline_1).at(0);
+  const auto [status_1, table_1] = statement_1->get_result_table();
+  EXPECT_EQ(status_1, SQLPipelineStatus::Success);
+  EXPECT_FALSE(statement_1->metrics()->parameterized_lqp_cache_hit);
+  EXPECT_EQ(table_1->row_count(), 2u);
+
+  EXPECT_EQ(parameterized_lqp_cache->size(), 1u);
+  const auto cached_plan = parameterized_lqp_cache->try_get("SELECT * FROM table_a WHERE a > ?");
+  ASSERT_TRUE(cached_plan);
+  ASSERT_TRUE(*cached_plan);
+  EXPECT_EQ((*cached_plan)->parameter_ids.size(), 1u);
+
+  // Different literals share the cached LQP.
+  auto sql_pipeline_2 = SQLPipelineBuilder{"SELECT * FROM table_a WHERE a > 10000"}
+                            .with_parameterized_lqp_cache(parameterized_lqp_cache)
+                            .create_pipeline();
+  auto statement_2 = get_sql_pipeline_statements(sql_pipeline_2).at(0);
+  const auto [status_2, table_2] = statement_2->get_result_table();
+  EXPECT_EQ(status_2, SQLPipelineStatus::Success);
+  EXPECT_TRUE(statement_2->metrics()->parameterized_lqp_cache_hit);
+
+  auto expected_result = std::make_shared<Table>(_int_float_column_definitions, TableType::Data);
+  expected_result->append({12345, 458.7f});
+  EXPECT_TABLE_EQ_UNORDERED(table_2, expected_result);
+  EXPECT_EQ(parameterized_lqp_cache->size(), 1u);
+}
+
+TEST_F(SQLPipelineStatementTest, ParameterizedLQPCacheReevaluatesChunkPruning) {
+  ChunkEncoder::encode_all_chunks(_table_int, SegmentEncodingSpec{EncodingType::Dictionary});
+  generate_chunk_pruning_statistics(_table_int);
+
+  const auto parameterized_lqp_cache = std::make_shared<SQLParameterizedPlanCache>();
+  const auto execute = [&](const std::string& sql, const bool expect_cache_hit, const size_t expected_row_count) {
+    auto sql_pipeline = SQLPipelineBuilder{sql}.with_parameterized_lqp_cache(parameterized_lqp_cache).create_pipeline();
+    auto statement = get_sql_pipeline_statements(sql_pipeline).at(0);
+    const auto [status, table] = statement->get_result_table();
+    EXPECT_EQ(status, SQLPipelineStatus::Success);
+    EXPECT_EQ(statement->metrics()->parameterized_lqp_cache_hit, expect_cache_hit);
+    EXPECT_EQ(table->row_count(), expected_row_count);
+  };
+
+  // The first chunk holds the values 9 and 10 in column a and is pruned.
+  execute("SELECT * FROM table_int WHERE a > 10", false, 1);
+  execute("SELECT * FROM table_int WHERE a > 10", true, 1);
+
+  // No chunk can be pruned. Thus, the cached LQP cannot be reused.
+  execute("SELECT * FROM table_int WHERE a > 9", false, 2);
+  execute("SELECT * FROM table_int WHERE a > 5", true, 4);
+
+  EXPECT_EQ(parameterized_lqp_cache->size(), 1u);
+}
+
+TEST_F(SQLPipelineStatementTest, ParameterizedLQPCacheReevaluatesTopK) {
+  const auto parameterized_lqp_cache = std::make_shared<SQLParameterizedPlanCache>();
+  const auto execute = [&](const std::string& sql, const bool expect_cache_hit, const OperatorType expected_type) {
+    auto sql_pipeline = SQLPipelineBuilder{sql}.with_parameterized_lqp_cache(parameterized_lqp_cache).create_pipeline();
+    auto statement = get_sql_pipeline_statements(sql_pipeline).at(0);
+    const auto [status, table] = statement->get_result_table();
+    EXPECT_EQ(status, SQLPipelineStatus::Success);
+    EXPECT_EQ(statement->metrics()->parameterized_lqp_cache_hit, expect_cache_hit);
+    EXPECT_EQ(statement->get_physical_plan()->type(), expected_type);
+  };
+
+  // The TopKRule only fuses the sort with small limits. Thus, the cached LQP cannot be reused for large ones.
+  execute("SELECT a FROM table_a ORDER BY a LIMIT 1", false, OperatorType::TopK);
+  execute("SELECT a FROM table_a ORDER BY a LIMIT 2", true, OperatorType::TopK);
+  execute("SELECT a FROM table_a ORDER BY a LIMIT 100000", false, OperatorType::Limit);
+  execute("SELECT a FROM table_a ORDER BY a LIMIT 200000", true, OperatorType::Limit);
+
+  EXPECT_EQ(parameterized_lqp_cache->size(), 1u);
+}
+
+TEST_F(SQLPipelineStatementTest, ParameterizedLQPCacheNotCacheable) {
+  const auto parameterized_lqp_cache = std::make_shared<SQLParameterizedPlanCache>();
+  const auto meta_table_query =
+      "SELECT * FROM " + MetaTableManager::META_PREFIX + "tables WHERE table_name = 'table_a'";
+
+  auto sql_pipeline =
+      SQLPipelineBuilder{meta_table_query}.with_parameterized_lqp_cache(parameterized_lqp_cache).create_pipeline();
+  auto statement = get_sql_pipeline_statements(sql_pipeline).at(0);
+  const auto [status, table] = statement->get_result_table();
+  EXPECT_EQ(status, SQLPipelineStatus::Success);
+  EXPECT_EQ(table->row_count(), 1u);
+
+  // The statement is marked as not parameterizable.
+  const auto cached_plan = parameterized_lqp_cache->try_get("SELECT * FROM " + MetaTableManager::META_PREFIX +
+                                                            "tables WHERE table_name = ?");
+  ASSERT_TRUE(cached_plan);
+  EXPECT_FALSE(*cached_plan);
+}
+
 TEST_F(SQLPipelineStatementTest, CopySubselectFromCache) {
   const auto subquery_query = "SELECT * FROM table_int WHERE a = (SELECT MAX(b) FROM table_int)";
 
@@ -10,6 +10,7 @@
 #include "logical_query_plan/aggregate_node.hpp"
 #include "logical_query_plan/alias_node.hpp"
 #include "logical_query_plan/change_meta_table_node.hpp"
+#include "logical_query_plan/create_index_node.hpp"
 #include "logical_query_plan/create_prepared_plan_node.hpp"
 #include "logical_query_plan/create_table_node.hpp"
 #include "logical_query_plan/create_view_node.hpp"
@@ -2517,6 +2518,26 @@ TEST_F(SQLTranslatorTest, DropTableIfExists) {
   EXPECT_LQP_EQ(actual_lqp, expected_lqp);
 }
 
+TEST_F(SQLTranslatorTest, CreateIndex) {
+  const auto [actual_lqp, translation_info] = sql_to_lqp_helper("CREATE INDEX b_index ON int_float (b)");
+
+  const auto expected_lqp = CreateIndexNode::make("b_index", "int_float", ColumnID{1}, false);
+
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+
+  EXPECT_THROW(sql_to_lqp_helper("CREATE INDEX x_index ON no_table (a)"), InvalidInputException);
+  EXPECT_THROW(sql_to_lqp_helper("CREATE INDEX x_index ON int_float (x)"), InvalidInputException);
+  EXPECT_THROW(sql_to_lqp_helper("CREATE INDEX x_index ON int_float (a, b)"), InvalidInputException);
+}
+
+TEST_F(SQLTranslatorTest, CreateIndexIfNotExists) {
+  const auto [actual_lqp, translation_info] = sql_to_lqp_helper("CREATE INDEX IF NOT EXISTS a_index ON int_float (a)");
+
+  const auto expected_lqp = CreateIndexNode::make("a_index", "int_float", ColumnID{0}, true);
+
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+}
+
 TEST_F(SQLTranslatorTest, PrepareWithoutParameters) {
   const auto [actual_lqp, translation_info] =
       sql_to_lqp_helper("PREPARE some_prepared_plan FROM 'SELECT a AS x FROM int_float'");
@@ -2990,6 +3011,38 @@ TEST_F(SQLTranslatorTest, SetOperationSingleIntersect) {
   EXPECT_LQP_EQ(actual_lqp, expected_lqp);
 }
 
+TEST_F(SQLTranslatorTest, SetOperationSingleUnion) {
+  const auto [actual_lqp, translation_info] = sql_to_lqp_helper(
+      "SELECT a FROM int_float "
+      "UNION "
+      "SELECT a FROM int_float2;");
+
+  // clang-format off
+  const auto expected_lqp =
+  UnionNode::make(SetOperationMode::Unique,
+    ProjectionNode::make(expression_vector(int_float_a), stored_table_node_int_float),
+      ProjectionNode::make(expression_vector(int_float2_a), stored_table_node_int_float2));
+  // clang-format on
+
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+}
+
+TEST_F(SQLTranslatorTest, SetOperationSingleUnionAll) {
+  const auto [actual_lqp, translation_info] = sql_to_lqp_helper(
+      "SELECT a FROM int_float "
+      "UNION ALL "
+      "SELECT a FROM int_float2;");
+
+  // clang-format off
+  const auto expected_lqp =
+  UnionNode::make(SetOperationMode::All,
+    ProjectionNode::make(expression_vector(int_float_a), stored_table_node_int_float),
+      ProjectionNode::make(expression_vector(int_float2_a), stored_table_node_int_float2));
+  // clang-format on
+
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+}
+
 TEST_F(SQLTranslatorTest, MultiSetOperations) {
   const auto [actual_lqp, translation_info] = sql_to_lqp_helper(
       "SELECT a FROM int_int_int "
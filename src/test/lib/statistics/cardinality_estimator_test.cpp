@@ -26,6 +26,7 @@
 #include "logical_query_plan/window_node.hpp"
 #include "statistics/attribute_statistics.hpp"
 #include "statistics/cardinality_estimator.hpp"
+#include "statistics/column_group_statistics.hpp"
 #include "statistics/statistics_objects/equal_distinct_count_histogram.hpp"
 #include "statistics/statistics_objects/generic_histogram.hpp"
 #include "statistics/table_statistics.hpp"
@@ -229,6 +230,52 @@ TEST_F(CardinalityEstimatorTest, JoinNumericEquiInnerMultiPredicates) {
   ASSERT_EQ(result_statistics->row_count, 128u);
 }
 
+TEST_F(CardinalityEstimatorTest, JoinNumericEquiInnerMultiPredicatesWithColumnGroups) {
+  const auto left_node = create_mock_node_with_statistics(
+      {{DataType::Int, "a"}, {DataType::Int, "b"}}, 1'000,
+      {GenericHistogram<int32_t>::with_single_bin(1, 10, 1'000, 10),
+       GenericHistogram<int32_t>::with_single_bin(1, 10, 1'000, 10)});
+  const auto right_node = create_mock_node_with_statistics(
+      {{DataType::Int, "a"}, {DataType::Int, "b"}}, 1'000,
+      {GenericHistogram<int32_t>::with_single_bin(1, 10, 1'000, 10),
+       GenericHistogram<int32_t>::with_single_bin(1, 10, 1'000, 10)});
+  const auto left_a = left_node->get_column("a");
+  const auto left_b = left_node->get_column("b");
+  const auto right_a = right_node->get_column("a");
+  const auto right_b = right_node->get_column("b");
+
+  const auto join_node =
+      JoinNode::make(JoinMode::Inner, expression_vector(equals_(left_a, right_a), equals_(left_b, right_b)), left_node,
+                     right_node);
+
+  // Without column group statistics, only the primary predicate is estimated.
+  EXPECT_FLOAT_EQ(CardinalityEstimator{}.estimate_cardinality(join_node), 100'000.0f);
+
+  left_node->table_statistics()->column_group_statistics.emplace_back(
+      std::make_shared<ColumnGroupStatistics>(std::vector<ColumnID>{ColumnID{0}, ColumnID{1}}, 100.0f));
+  EXPECT_FLOAT_EQ(CardinalityEstimator{}.estimate_cardinality(join_node), 100'000.0f);
+
+  // With statistics for both inputs, the join is estimated as |left| * |right| / max(distinct(left), distinct(right)).
+  right_node->table_statistics()->column_group_statistics.emplace_back(
+      std::make_shared<ColumnGroupStatistics>(std::vector<ColumnID>{ColumnID{0}, ColumnID{1}}, 50.0f));
+  const auto result_statistics = CardinalityEstimator{}.estimate_statistics(join_node);
+  ASSERT_EQ(result_statistics->column_statistics.size(), 4u);
+  EXPECT_FLOAT_EQ(result_statistics->row_count, 10'000.0f);
+
+  // Joins with a single predicate are not affected.
+  const auto single_predicate_join_node = JoinNode::make(JoinMode::Inner, equals_(left_a, right_a), left_node,
+                                                         right_node);
+  EXPECT_FLOAT_EQ(CardinalityEstimator{}.estimate_cardinality(single_predicate_join_node), 100'000.0f);
+
+  // Outer joins are estimated based on their primary predicate only.
+  for (const auto join_mode : {JoinMode::Left, JoinMode::Right, JoinMode::FullOuter}) {
+    const auto outer_join_node =
+        JoinNode::make(join_mode, expression_vector(equals_(left_a, right_a), equals_(left_b, right_b)), left_node,
+                       right_node);
+    EXPECT_FLOAT_EQ(CardinalityEstimator{}.estimate_cardinality(outer_join_node), 100'000.0f);
+  }
+}
+
 TEST_F(CardinalityEstimatorTest, JoinNumericNonEquiInner) {
   // Test that joins on with non-equi predicate conditions are estimated as cross joins (for now)
 
@@ -632,6 +679,56 @@ TEST_F(CardinalityEstimatorTest, PredicateTwoOnDifferentColumns) {
   EXPECT_FLOAT_EQ(estimator.estimate_cardinality(input_lqp->left_input()->left_input()), 100.0f);
 }
 
+TEST_F(CardinalityEstimatorTest, PredicateCorrelatedColumnGroup) {
+  // clang-format off
+  const auto input_lqp =
+  PredicateNode::make(equals_(d_b, 55),
+    PredicateNode::make(greater_than_(d_c, 100),
+      PredicateNode::make(equals_(d_a, 50),
+        node_d)));
+  // clang-format on
+
+  // Assuming independence, 1 / 20 * 1 / 5 of the rows qualify.
+  EXPECT_FLOAT_EQ(estimator.estimate_cardinality(input_lqp), 1.0f);
+
+  // The predicates on d_a and d_b are correlated: Only 25 of the 20 * 5 combinations of their values occur. Thus,
+  // 20 / 25 of the rows with d_a = 50 have d_b = 55.
+  node_d->table_statistics()->column_group_statistics.emplace_back(
+      std::make_shared<ColumnGroupStatistics>(std::vector<ColumnID>{ColumnID{0}, ColumnID{1}}, 25.0f));
+  EXPECT_FLOAT_EQ(*CardinalityEstimator::estimate_correlated_equals_selectivity(
+                      static_cast<const PredicateNode&>(*input_lqp)),
+                  0.8f);
+  EXPECT_FLOAT_EQ(estimator.estimate_cardinality(input_lqp), 4.0f);
+  EXPECT_FLOAT_EQ(estimator.estimate_cardinality(input_lqp->left_input()), 5.0f);
+
+  // Predicates that are not preceded by `column = value` predicates on correlated columns are not affected.
+  EXPECT_EQ(CardinalityEstimator::estimate_correlated_equals_selectivity(
+                static_cast<const PredicateNode&>(*input_lqp->left_input()->left_input())),
+            std::nullopt);
+  const auto independent_lqp = PredicateNode::make(equals_(d_c, 110), PredicateNode::make(equals_(d_a, 50), node_d));
+  EXPECT_EQ(CardinalityEstimator::estimate_correlated_equals_selectivity(
+                static_cast<const PredicateNode&>(*independent_lqp)),
+            std::nullopt);
+}
+
+TEST_F(CardinalityEstimatorTest, PredicateFunctionalDependency) {
+  // clang-format off
+  const auto input_lqp =
+  PredicateNode::make(equals_(d_b, 55),
+    PredicateNode::make(equals_(d_a, 50),
+      node_d));
+  // clang-format on
+
+  EXPECT_FLOAT_EQ(estimator.estimate_cardinality(input_lqp), 1.0f);
+
+  // d_a is unique and determines d_b. The predicate on d_b does not filter any further rows.
+  node_d->set_key_constraints({TableKeyConstraint{{ColumnID{0}}, KeyConstraintType::UNIQUE}});
+  EXPECT_FLOAT_EQ(*CardinalityEstimator::estimate_correlated_equals_selectivity(
+                      static_cast<const PredicateNode&>(*input_lqp)),
+                  1.0f);
+  EXPECT_FLOAT_EQ(estimator.estimate_cardinality(input_lqp), 5.0f);
+}
+
 TEST_F(CardinalityEstimatorTest, PredicateMultiple) {
   // clang-format off
   const auto input_lqp =
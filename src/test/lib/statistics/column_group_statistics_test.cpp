@@ -0,0 +1,113 @@
+#include "base_test.hpp"
+
+#include "expression/expression_functional.hpp"
+#include "hyrise.hpp"
+#include "logical_query_plan/lqp_translator.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "scheduler/operator_task.hpp"
+#include "statistics/cardinality_estimator.hpp"
+#include "statistics/column_group_statistics.hpp"
+#include "statistics/table_statistics.hpp"
+#include "storage/table.hpp"
+
+namespace hyrise {
+
+using namespace expression_functional;  // NOLINT(build/namespaces)
+
+class ColumnGroupStatisticsTest : public BaseTest {
+ public:
+  void SetUp() override {
+    // Column a and b are fully correlated, c is independent of both.
+    const auto column_definitions = TableColumnDefinitions{
+        {"a", DataType::Int, false}, {"b", DataType::String, false}, {"c", DataType::Int, true}};
+    table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{100}, UseMvcc::Yes);
+    for (auto row = int32_t{0}; row < 1'000; ++row) {
+      const auto c = row % 7 == 0 ? AllTypeVariant{NULL_VALUE} : AllTypeVariant{row % 7};
+      table->append({row % 20, pmr_string{"value" + std::to_string(row % 20)}, c});
+    }
+  }
+
+  std::shared_ptr<Table> table;
+};
+
+TEST_F(ColumnGroupStatisticsTest, FromTable) {
+  const auto correlated_statistics = ColumnGroupStatistics::from_table(*table, {ColumnID{1}, ColumnID{0}});
+  EXPECT_EQ(correlated_statistics->column_ids, std::vector<ColumnID>({ColumnID{0}, ColumnID{1}}));
+  EXPECT_NEAR(correlated_statistics->distinct_count, 20.0f, 1.0f);
+
+  // NULL is counted as a distinct value. Values of a and c are combined 20 * 7 times.
+  const auto independent_statistics = ColumnGroupStatistics::from_table(*table, {ColumnID{0}, ColumnID{2}});
+  EXPECT_NEAR(independent_statistics->distinct_count, 140.0f, 3.0f);
+
+  EXPECT_THROW(ColumnGroupStatistics::from_table(*table, {ColumnID{0}, ColumnID{0}}), std::logic_error);
+  EXPECT_THROW(ColumnGroupStatistics::from_table(*table, {ColumnID{0}, ColumnID{3}}), std::logic_error);
+}
+
+TEST_F(ColumnGroupStatisticsTest, AddColumnGroupStatistics) {
+  EXPECT_THROW(add_column_group_statistics(*table, {ColumnID{0}, ColumnID{1}}), std::logic_error);
+
+  table->set_table_statistics(TableStatistics::from_table(*table));
+  const auto original_table_statistics = table->table_statistics();
+  EXPECT_EQ(original_table_statistics->distinct_count({ColumnID{0}}), 20.0f);
+  EXPECT_EQ(original_table_statistics->distinct_count({ColumnID{0}, ColumnID{1}}), std::nullopt);
+
+  add_column_group_statistics(*table, {ColumnID{0}, ColumnID{1}});
+  add_column_group_statistics(*table, {ColumnID{1}, ColumnID{0}});
+
+  // The statistics are replaced, not modified.
+  EXPECT_TRUE(original_table_statistics->column_group_statistics.empty());
+
+  const auto table_statistics = table->table_statistics();
+  ASSERT_EQ(table_statistics->column_group_statistics.size(), 1);
+  ASSERT_TRUE(table_statistics->distinct_count({ColumnID{1}, ColumnID{0}}));
+  EXPECT_NEAR(*table_statistics->distinct_count({ColumnID{1}, ColumnID{0}}), 20.0f, 1.0f);
+  EXPECT_EQ(table_statistics->distinct_count({ColumnID{0}, ColumnID{2}}), std::nullopt);
+}
+
+TEST_F(ColumnGroupStatisticsTest, SuggestFromMisestimations) {
+  Hyrise::get().storage_manager.add_table("table_a", table);
+
+  const auto stored_table_node = StoredTableNode::make("table_a");
+  const auto a = stored_table_node->get_column("a");
+  const auto b = stored_table_node->get_column("b");
+  const auto c = stored_table_node->get_column("c");
+
+  // clang-format off
+  const auto lqp =
+  PredicateNode::make(equals_(b, "value3"),
+    PredicateNode::make(greater_than_(c, 0),
+      PredicateNode::make(equals_(a, 3),
+        stored_table_node)));
+  // clang-format on
+
+  EXPECT_EQ(equals_value_predicate_column(static_cast<const PredicateNode&>(*lqp)), b);
+  EXPECT_EQ(equals_value_predicate_column(static_cast<const PredicateNode&>(*lqp->left_input())), nullptr);
+  EXPECT_EQ(equals_value_predicate_columns(lqp->left_input()),
+            std::vector<std::shared_ptr<LQPColumnExpression>>({a}));
+
+  // The independent estimation expects that only 1 / 20 of the rows with a = 3 have b = 'value3', while all of them
+  // qualify.
+  const auto pqp = LQPTranslator{}.translate_node(lqp);
+  const auto& [tasks, root_operator_task] = OperatorTask::make_tasks_from_operator(pqp);
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(tasks);
+
+  const auto suggestions = suggest_column_group_statistics(pqp);
+  ASSERT_EQ(suggestions.size(), 1);
+  EXPECT_EQ(suggestions[0].table_name, "table_a");
+  EXPECT_EQ(suggestions[0].column_ids, std::vector<ColumnID>({ColumnID{0}, ColumnID{1}}));
+  EXPECT_FLOAT_EQ(suggestions[0].actual_selectivity, 1.0f);
+  EXPECT_LT(suggestions[0].estimated_selectivity, 0.1f);
+
+  // Smaller misestimations are not reported.
+  EXPECT_TRUE(suggest_column_group_statistics(pqp, 100.0f).empty());
+
+  // With the suggested statistics, the correlation is taken into account.
+  const auto independent_estimation = CardinalityEstimator{}.estimate_cardinality(lqp);
+  add_column_group_statistics(*table, suggestions[0].column_ids);
+  const auto correlated_estimation = CardinalityEstimator{}.estimate_cardinality(lqp);
+  EXPECT_NEAR(correlated_estimation, CardinalityEstimator{}.estimate_cardinality(lqp->left_input()), 3.0f);
+  EXPECT_GT(correlated_estimation, independent_estimation * 10.0f);
+}
+
+}  // namespace hyrise
@@ -0,0 +1,77 @@
+#include "base_test.hpp"
+
+#include "statistics/attribute_statistics.hpp"
+#include "statistics/sketches/column_sketch.hpp"
+#include "statistics/statistics_objects/abstract_histogram.hpp"
+#include "utils/load_table.hpp"
+
+namespace hyrise {
+
+class ColumnSketchTest : public BaseTest {
+ public:
+  void SetUp() override {
+    table = load_table("resources/test_data/tbl/int_with_nulls_large.tbl", ChunkOffset{20});
+  }
+
+  ColumnSketch<int32_t> sketch_column(const ColumnID column_id, const uint32_t sampling_interval) const {
+    auto column_sketch = ColumnSketch<int32_t>{200, 12, sampling_interval};
+    const auto chunk_count = table->chunk_count();
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      column_sketch.add_segment(*table->get_chunk(chunk_id)->get_segment(column_id));
+    }
+    return column_sketch;
+  }
+
+  std::shared_ptr<Table> table;
+};
+
+TEST_F(ColumnSketchTest, AttributeStatistics) {
+  const auto column_sketch = sketch_column(ColumnID{0}, 1);
+  EXPECT_EQ(column_sketch.non_null_count, 173);
+  EXPECT_EQ(column_sketch.null_count, 27);
+
+  const auto attribute_statistics =
+      std::dynamic_pointer_cast<AttributeStatistics<int32_t>>(column_sketch.attribute_statistics(5));
+  ASSERT_TRUE(attribute_statistics);
+  ASSERT_TRUE(attribute_statistics->null_value_ratio);
+  EXPECT_FLOAT_EQ(attribute_statistics->null_value_ratio->ratio, 27.0f / 200.0f);
+
+  // All values fit into the KLL sketch, so that the heights of the bins are exact.
+  const auto& histogram = attribute_statistics->histogram;
+  ASSERT_TRUE(histogram);
+  EXPECT_EQ(histogram->bin_count(), 5);
+  EXPECT_FLOAT_EQ(histogram->total_count(), 173.0f);
+  EXPECT_NEAR(histogram->total_distinct_count(), 10.0f, 0.5f);
+}
+
+TEST_F(ColumnSketchTest, Sampling) {
+  const auto column_sketch = sketch_column(ColumnID{1}, 4);
+  EXPECT_EQ(column_sketch.quantiles.count(), 48);
+
+  const auto attribute_statistics =
+      std::dynamic_pointer_cast<AttributeStatistics<int32_t>>(column_sketch.attribute_statistics(100));
+  ASSERT_TRUE(attribute_statistics);
+
+  // The heights are scaled to all non-NULL values. The distinct count is estimated from all values.
+  const auto& histogram = attribute_statistics->histogram;
+  ASSERT_TRUE(histogram);
+  EXPECT_NEAR(histogram->total_count(), 191.0f, 1.0f);
+  EXPECT_NEAR(histogram->total_distinct_count(), 190.0f, 10.0f);
+}
+
+TEST_F(ColumnSketchTest, Merge) {
+  auto column_sketch = sketch_column(ColumnID{0}, 1);
+  column_sketch.merge(sketch_column(ColumnID{0}, 1));
+  EXPECT_EQ(column_sketch.non_null_count, 346);
+  EXPECT_EQ(column_sketch.null_count, 54);
+
+  const auto attribute_statistics =
+      std::dynamic_pointer_cast<AttributeStatistics<int32_t>>(column_sketch.attribute_statistics(5));
+  ASSERT_TRUE(attribute_statistics);
+  EXPECT_FLOAT_EQ(attribute_statistics->histogram->total_count(), 346.0f);
+  EXPECT_NEAR(attribute_statistics->histogram->total_distinct_count(), 10.0f, 0.5f);
+
+  EXPECT_THROW(column_sketch.merge(sketch_column(ColumnID{0}, 2)), std::logic_error);
+}
+
+}  // namespace hyrise
@@ -0,0 +1,58 @@
+#include "base_test.hpp"
+
+#include "statistics/sketches/hyper_log_log.hpp"
+
+namespace hyrise {
+
+class HyperLogLogTest : public BaseTest {};
+
+TEST_F(HyperLogLogTest, EmptySketch) {
+  EXPECT_DOUBLE_EQ(HyperLogLog{}.estimate(), 0.0);
+}
+
+TEST_F(HyperLogLogTest, SmallCardinality) {
+  auto hyper_log_log = HyperLogLog{};
+  for (auto repetition = 0; repetition < 3; ++repetition) {
+    for (auto value = int32_t{0}; value < 100; ++value) {
+      hyper_log_log.add(value);
+    }
+  }
+
+  // Duplicates do not change the estimation, which is almost exact for small cardinalities.
+  EXPECT_NEAR(hyper_log_log.estimate(), 100.0, 2.0);
+}
+
+TEST_F(HyperLogLogTest, LargeCardinality) {
+  auto hyper_log_log = HyperLogLog{};
+  for (auto value = int64_t{0}; value < 1'000'000; ++value) {
+    hyper_log_log.add(value);
+  }
+
+  // The standard error with the default precision is 1.6%.
+  EXPECT_NEAR(hyper_log_log.estimate(), 1'000'000.0, 50'000.0);
+}
+
+TEST_F(HyperLogLogTest, Merge) {
+  auto hyper_log_log_a = HyperLogLog{};
+  auto hyper_log_log_b = HyperLogLog{};
+  for (auto value = int32_t{0}; value < 20'000; ++value) {
+    hyper_log_log_a.add(value);
+    hyper_log_log_b.add(value + 10'000);
+  }
+
+  hyper_log_log_a.merge(hyper_log_log_b);
+  EXPECT_NEAR(hyper_log_log_a.estimate(), 30'000.0, 1'500.0);
+
+  EXPECT_THROW(hyper_log_log_a.merge(HyperLogLog{10}), std::logic_error);
+}
+
+TEST_F(HyperLogLogTest, Strings) {
+  auto hyper_log_log = HyperLogLog{};
+  for (auto value = 0; value < 1'000; ++value) {
+    hyper_log_log.add(pmr_string{"value" + std::to_string(value % 500)});
+  }
+
+  EXPECT_NEAR(hyper_log_log.estimate(), 500.0, 25.0);
+}
+
+}  // namespace hyrise
@@ -0,0 +1,78 @@
+#include <algorithm>
+#include <numeric>
+#include <random>
+
+#include "base_test.hpp"
+
+#include "statistics/sketches/kll_sketch.hpp"
+
+namespace hyrise {
+
+class KllSketchTest : public BaseTest {
+ public:
+  // Returns the estimated number of values that are smaller than or equal to @param value.
+  template <typename T>
+  static uint64_t estimated_rank(const KllSketch<T>& sketch, const T& value) {
+    auto rank = uint64_t{0};
+    for (const auto& [sketch_value, weight] : sketch.weighted_values()) {
+      if (sketch_value > value) {
+        break;
+      }
+      rank += weight;
+    }
+    return rank;
+  }
+};
+
+TEST_F(KllSketchTest, ExactWithoutCompaction) {
+  auto sketch = KllSketch<int32_t>{};
+  for (const auto value : {5, 3, 3, 1}) {
+    sketch.update(value);
+  }
+
+  EXPECT_EQ(sketch.count(), 4);
+  const auto expected_weighted_values = std::vector<std::pair<int32_t, uint64_t>>{{1, 1}, {3, 2}, {5, 1}};
+  EXPECT_EQ(sketch.weighted_values(), expected_weighted_values);
+}
+
+TEST_F(KllSketchTest, RankError) {
+  auto values = std::vector<int32_t>(100'000);
+  std::iota(values.begin(), values.end(), 0);
+  std::shuffle(values.begin(), values.end(), std::mt19937{17});
+
+  auto sketch = KllSketch<int32_t>{};
+  for (const auto value : values) {
+    sketch.update(value);
+  }
+
+  EXPECT_EQ(sketch.count(), 100'000);
+
+  // Only a small sample is retained, but the weights account for all values.
+  const auto weighted_values = sketch.weighted_values();
+  EXPECT_LT(weighted_values.size(), 2'000);
+  const auto total_weight = std::accumulate(weighted_values.cbegin(), weighted_values.cend(), uint64_t{0},
+                                            [](const auto sum, const auto& value) { return sum + value.second; });
+  EXPECT_EQ(total_weight, 100'000);
+
+  for (const auto value : {1'000, 25'000, 50'000, 75'000, 99'000}) {
+    EXPECT_NEAR(static_cast<double>(estimated_rank(sketch, value)), static_cast<double>(value + 1), 2'000.0);
+  }
+}
+
+TEST_F(KllSketchTest, Merge) {
+  auto sketch_a = KllSketch<double>{};
+  auto sketch_b = KllSketch<double>{};
+  for (auto value = 0; value < 50'000; ++value) {
+    sketch_a.update(static_cast<double>(value));
+    sketch_b.update(static_cast<double>(value + 50'000));
+  }
+
+  sketch_a.merge(sketch_b);
+  EXPECT_EQ(sketch_a.count(), 100'000);
+  EXPECT_NEAR(static_cast<double>(estimated_rank(sketch_a, 49'999.0)), 50'000.0, 2'000.0);
+  EXPECT_NEAR(static_cast<double>(estimated_rank(sketch_a, 89'999.0)), 90'000.0, 2'000.0);
+
+  EXPECT_THROW(sketch_a.merge(KllSketch<double>{100}), std::logic_error);
+}
+
+}  // namespace hyrise
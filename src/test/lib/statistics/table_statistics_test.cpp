@@ -41,4 +41,74 @@ TEST_F(TableStatisticsTest, FromTable) {
   EXPECT_FLOAT_EQ(histogram_b->total_distinct_count(), 190);
 }
 
+TEST_F(TableStatisticsTest, FromTableWithSketches) {
+  const auto table = load_table("resources/test_data/tbl/int_with_nulls_large.tbl", ChunkOffset{20});
+
+  auto config = StatisticsGenerationConfig{};
+  config.mode = StatisticsGenerationMode::Sketch;
+  const auto table_statistics = TableStatistics::from_table(*table, config);
+
+  ASSERT_EQ(table_statistics->row_count, 200u);
+  ASSERT_EQ(table_statistics->column_statistics.size(), 2u);
+  EXPECT_EQ(table_statistics->column_sketches.size(), 2u);
+  EXPECT_EQ(table_statistics->sketched_chunk_count, table->chunk_count());
+
+  const auto column_statistics_a =
+      std::dynamic_pointer_cast<AttributeStatistics<int32_t>>(table_statistics->column_statistics.at(0));
+  ASSERT_TRUE(column_statistics_a);
+  ASSERT_TRUE(column_statistics_a->null_value_ratio);
+  EXPECT_FLOAT_EQ(column_statistics_a->null_value_ratio->ratio, 27.0f / 200.0f);
+
+  // The sketches retain all values of such a small table, so that the row counts of the histograms are exact. The
+  // distinct counts are estimated.
+  const auto histogram_a = std::dynamic_pointer_cast<AbstractHistogram<int32_t>>(column_statistics_a->histogram);
+  ASSERT_TRUE(histogram_a);
+  EXPECT_FLOAT_EQ(histogram_a->total_count(), 200 - 27);
+  EXPECT_NEAR(histogram_a->total_distinct_count(), 10, 0.5);
+
+  const auto column_statistics_b =
+      std::dynamic_pointer_cast<AttributeStatistics<int32_t>>(table_statistics->column_statistics.at(1));
+  ASSERT_TRUE(column_statistics_b);
+  const auto histogram_b = std::dynamic_pointer_cast<AbstractHistogram<int32_t>>(column_statistics_b->histogram);
+  ASSERT_TRUE(histogram_b);
+  EXPECT_FLOAT_EQ(histogram_b->total_count(), 200 - 9);
+  EXPECT_NEAR(histogram_b->total_distinct_count(), 190, 10);
+}
+
+TEST_F(TableStatisticsTest, UpdateFromTable) {
+  const auto table = load_table("resources/test_data/tbl/int_with_nulls_large.tbl", ChunkOffset{20});
+  const auto chunk_count = table->chunk_count();
+
+  // Without sketches, the statistics are recreated.
+  const auto exact_statistics = TableStatistics::from_table(*table);
+  table->append({int32_t{1000}, int32_t{1000}});
+  EXPECT_EQ(TableStatistics::update_from_table(*table, *exact_statistics)->row_count, 201u);
+  EXPECT_TRUE(TableStatistics::update_from_table(*table, *exact_statistics)->column_sketches.empty());
+
+  auto config = StatisticsGenerationConfig{};
+  config.mode = StatisticsGenerationMode::Sketch;
+  const auto table_statistics = TableStatistics::from_table(*table, config);
+
+  // The appended row is stored in a new, mutable chunk, which is not kept in the sketches.
+  ASSERT_EQ(table->chunk_count(), chunk_count + 1);
+  EXPECT_EQ(table_statistics->sketched_chunk_count, chunk_count);
+  EXPECT_EQ(table_statistics->row_count, 201u);
+
+  table->append({int32_t{1001}, NULL_VALUE});
+  table->append({NULL_VALUE, int32_t{1002}});
+  const auto updated_statistics = TableStatistics::update_from_table(*table, *table_statistics);
+
+  ASSERT_EQ(updated_statistics->row_count, 203u);
+  EXPECT_EQ(updated_statistics->sketched_chunk_count, chunk_count);
+  EXPECT_EQ(updated_statistics->generation_config.mode, StatisticsGenerationMode::Sketch);
+
+  const auto column_statistics_a =
+      std::dynamic_pointer_cast<AttributeStatistics<int32_t>>(updated_statistics->column_statistics.at(0));
+  ASSERT_TRUE(column_statistics_a);
+  const auto histogram_a = std::dynamic_pointer_cast<AbstractHistogram<int32_t>>(column_statistics_a->histogram);
+  ASSERT_TRUE(histogram_a);
+  EXPECT_FLOAT_EQ(histogram_a->total_count(), 200 - 27 + 2);
+  EXPECT_EQ(histogram_a->bin_maximum(histogram_a->bin_count() - 1), 1001);
+}
+
 }  // namespace hyrise
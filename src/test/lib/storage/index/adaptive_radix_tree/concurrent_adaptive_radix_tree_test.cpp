@@ -0,0 +1,175 @@
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <thread>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "storage/index/adaptive_radix_tree/concurrent_adaptive_radix_tree.hpp"
+#include "storage/index/adaptive_radix_tree/epoch_manager.hpp"
+#include "types.hpp"
+
+namespace hyrise {
+
+class ConcurrentAdaptiveRadixTreeTest : public BaseTest {
+ protected:
+  using Key = ConcurrentAdaptiveRadixTree::Key;
+
+  // Encodes the value as four big-endian bytes, so that keys of the same length never are prefixes of each other.
+  static Key key(const uint32_t value) {
+    return Key{static_cast<uint8_t>(value >> 24u), static_cast<uint8_t>(value >> 16u),
+               static_cast<uint8_t>(value >> 8u), static_cast<uint8_t>(value)};
+  }
+
+  static bool insert(ConcurrentAdaptiveRadixTree& tree, const Key& key, const RowID row_id) {
+    return tree.update(key, [&](const auto& row_ids) -> std::optional<std::vector<RowID>> {
+      if (!row_ids.empty()) {
+        return std::nullopt;
+      }
+      return std::vector<RowID>{row_id};
+    });
+  }
+
+  static bool remove(ConcurrentAdaptiveRadixTree& tree, const Key& key) {
+    return tree.update(key, [&](const auto& row_ids) -> std::optional<std::vector<RowID>> {
+      if (row_ids.empty()) {
+        return std::nullopt;
+      }
+      return std::vector<RowID>{};
+    });
+  }
+
+  ConcurrentAdaptiveRadixTree tree;
+};
+
+TEST_F(ConcurrentAdaptiveRadixTreeTest, EmptyTree) {
+  EXPECT_EQ(tree.key_count(), 0);
+  EXPECT_TRUE(tree.lookup(key(17)).empty());
+  EXPECT_FALSE(remove(tree, key(17)));
+}
+
+TEST_F(ConcurrentAdaptiveRadixTreeTest, InsertLookupRemove) {
+  EXPECT_TRUE(insert(tree, key(17), RowID{ChunkID{0}, ChunkOffset{1}}));
+  EXPECT_TRUE(insert(tree, key(18), RowID{ChunkID{0}, ChunkOffset{2}}));
+  EXPECT_FALSE(insert(tree, key(17), RowID{ChunkID{0}, ChunkOffset{3}}));
+  EXPECT_EQ(tree.key_count(), 2);
+
+  EXPECT_EQ(tree.lookup(key(17)), (std::vector<RowID>{RowID{ChunkID{0}, ChunkOffset{1}}}));
+  EXPECT_EQ(tree.lookup(key(18)), (std::vector<RowID>{RowID{ChunkID{0}, ChunkOffset{2}}}));
+  EXPECT_TRUE(tree.lookup(key(19)).empty());
+
+  EXPECT_TRUE(remove(tree, key(17)));
+  EXPECT_TRUE(tree.lookup(key(17)).empty());
+  EXPECT_EQ(tree.lookup(key(18)), (std::vector<RowID>{RowID{ChunkID{0}, ChunkOffset{2}}}));
+  EXPECT_EQ(tree.key_count(), 1);
+
+  EXPECT_TRUE(insert(tree, key(17), RowID{ChunkID{1}, ChunkOffset{0}}));
+  EXPECT_EQ(tree.lookup(key(17)), (std::vector<RowID>{RowID{ChunkID{1}, ChunkOffset{0}}}));
+}
+
+TEST_F(ConcurrentAdaptiveRadixTreeTest, MultipleRowIDs) {
+  const auto append = [&](const RowID row_id) {
+    return tree.update(key(5), [&](const auto& row_ids) -> std::optional<std::vector<RowID>> {
+      auto new_row_ids = row_ids;
+      new_row_ids.emplace_back(row_id);
+      return new_row_ids;
+    });
+  };
+
+  EXPECT_TRUE(append(RowID{ChunkID{0}, ChunkOffset{0}}));
+  EXPECT_TRUE(append(RowID{ChunkID{2}, ChunkOffset{4}}));
+  EXPECT_EQ(tree.lookup(key(5)),
+            (std::vector<RowID>{RowID{ChunkID{0}, ChunkOffset{0}}, RowID{ChunkID{2}, ChunkOffset{4}}}));
+  EXPECT_EQ(tree.key_count(), 1);
+}
+
+TEST_F(ConcurrentAdaptiveRadixTreeTest, SharedPrefixes) {
+  // The keys only differ in their last byte, so that the leaves are expanded to the lowest level.
+  EXPECT_TRUE(insert(tree, Key{1, 2, 3, 4}, RowID{ChunkID{0}, ChunkOffset{0}}));
+  EXPECT_TRUE(insert(tree, Key{1, 2, 3, 5}, RowID{ChunkID{0}, ChunkOffset{1}}));
+  EXPECT_TRUE(insert(tree, Key{1, 2, 4, 4}, RowID{ChunkID{0}, ChunkOffset{2}}));
+
+  EXPECT_EQ(tree.lookup(Key{1, 2, 3, 4}), (std::vector<RowID>{RowID{ChunkID{0}, ChunkOffset{0}}}));
+  EXPECT_EQ(tree.lookup(Key{1, 2, 3, 5}), (std::vector<RowID>{RowID{ChunkID{0}, ChunkOffset{1}}}));
+  EXPECT_EQ(tree.lookup(Key{1, 2, 4, 4}), (std::vector<RowID>{RowID{ChunkID{0}, ChunkOffset{2}}}));
+  EXPECT_TRUE(tree.lookup(Key{1, 2, 3, 6}).empty());
+  EXPECT_TRUE(tree.lookup(Key{1, 3, 3, 4}).empty());
+}
+
+TEST_F(ConcurrentAdaptiveRadixTreeTest, NodeGrowth) {
+  // 600 keys with a common first byte let the nodes below the root grow from 4 to 256 children.
+  constexpr auto KEY_COUNT = uint32_t{600};
+  for (auto value = uint32_t{0}; value < KEY_COUNT; ++value) {
+    EXPECT_TRUE(insert(tree, key(value), RowID{ChunkID{0}, ChunkOffset{value}}));
+  }
+  EXPECT_EQ(tree.key_count(), KEY_COUNT);
+
+  for (auto value = uint32_t{0}; value < KEY_COUNT; ++value) {
+    EXPECT_EQ(tree.lookup(key(value)), (std::vector<RowID>{RowID{ChunkID{0}, ChunkOffset{value}}}));
+  }
+  EXPECT_TRUE(tree.lookup(key(KEY_COUNT)).empty());
+
+  for (auto value = uint32_t{0}; value < KEY_COUNT; value += 2) {
+    EXPECT_TRUE(remove(tree, key(value)));
+  }
+  EXPECT_EQ(tree.key_count(), KEY_COUNT / 2);
+  for (auto value = uint32_t{0}; value < KEY_COUNT; ++value) {
+    EXPECT_EQ(tree.lookup(key(value)).empty(), value % 2 == 0);
+  }
+}
+
+TEST_F(ConcurrentAdaptiveRadixTreeTest, ConcurrentInserts) {
+  // All threads try to insert all keys. Each key must be inserted exactly once.
+  constexpr auto THREAD_COUNT = uint32_t{8};
+  constexpr auto KEY_COUNT = uint32_t{5'000};
+
+  auto successful_inserts = std::vector<uint32_t>(THREAD_COUNT);
+  auto threads = std::vector<std::thread>{};
+  for (auto thread_id = uint32_t{0}; thread_id < THREAD_COUNT; ++thread_id) {
+    threads.emplace_back([&, thread_id]() {
+      for (auto value = uint32_t{0}; value < KEY_COUNT; ++value) {
+        // Spread the keys over several inner nodes and let threads start at different positions.
+        const auto shuffled_value = ((value + thread_id * 997) % KEY_COUNT) * 7919;
+        if (insert(tree, key(shuffled_value), RowID{ChunkID{thread_id}, ChunkOffset{value}})) {
+          ++successful_inserts[thread_id];
+        }
+        EXPECT_EQ(tree.lookup(key(shuffled_value)).size(), 1);
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  auto total_inserts = uint32_t{0};
+  for (const auto inserts : successful_inserts) {
+    total_inserts += inserts;
+  }
+  EXPECT_EQ(total_inserts, KEY_COUNT);
+  EXPECT_EQ(tree.key_count(), KEY_COUNT);
+}
+
+TEST_F(ConcurrentAdaptiveRadixTreeTest, EpochManagerReclamation) {
+  auto epoch_manager = EpochManager{};
+  auto deleted_object = std::weak_ptr<int>{};
+
+  {
+    const auto guard = epoch_manager.pin();
+    auto object = std::make_shared<int>(17);
+    deleted_object = object;
+    epoch_manager.retire(new std::shared_ptr<int>(std::move(object)));
+
+    // The object might still be used by the pinning thread.
+    epoch_manager.reclaim();
+    EXPECT_EQ(epoch_manager.retired_object_count(), 1);
+    EXPECT_FALSE(deleted_object.expired());
+  }
+
+  epoch_manager.reclaim();
+  EXPECT_EQ(epoch_manager.retired_object_count(), 0);
+  EXPECT_TRUE(deleted_object.expired());
+}
+
+}  // namespace hyrise
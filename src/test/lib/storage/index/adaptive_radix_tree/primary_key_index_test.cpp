@@ -0,0 +1,162 @@
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "storage/index/adaptive_radix_tree/primary_key_index.hpp"
+#include "storage/mvcc_data.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+
+namespace hyrise {
+
+class PrimaryKeyIndexTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    table = load_table("resources/test_data/tbl/int_string.tbl", ChunkOffset{2});
+    index = std::make_shared<PrimaryKeyIndex>(*table, std::vector<ColumnID>{ColumnID{0}, ColumnID{1}});
+  }
+
+  // Appends a row that is being inserted by the given transaction, i.e., a row that is not committed yet.
+  RowID append_row(const std::vector<AllTypeVariant>& values, const TransactionID transaction_id) {
+    table->append(values);
+    const auto chunk_id = ChunkID{table->chunk_count() - 1};
+    const auto chunk = table->get_chunk(chunk_id);
+    const auto chunk_offset = ChunkOffset{chunk->size() - 1};
+    chunk->mvcc_data()->set_tid(chunk_offset, transaction_id);
+    return RowID{chunk_id, chunk_offset};
+  }
+
+  std::shared_ptr<Table> table;
+  std::shared_ptr<PrimaryKeyIndex> index;
+};
+
+TEST_F(PrimaryKeyIndexTest, Lookup) {
+  EXPECT_EQ(index->column_ids(), (std::vector<ColumnID>{ColumnID{0}, ColumnID{1}}));
+  EXPECT_EQ(index->key_count(), 12);
+
+  EXPECT_EQ(index->lookup({4, "test4"}), (std::vector<RowID>{RowID{ChunkID{0}, ChunkOffset{1}}}));
+  EXPECT_EQ(index->lookup({6, "test6"}), (std::vector<RowID>{RowID{ChunkID{1}, ChunkOffset{0}}}));
+  EXPECT_TRUE(index->lookup({4, "test2"}).empty());
+  EXPECT_TRUE(index->lookup({5, "test4"}).empty());
+
+  // Values are converted to the column's data type if this is lossless.
+  EXPECT_EQ(index->lookup({int64_t{2}, "test2"}), (std::vector<RowID>{RowID{ChunkID{0}, ChunkOffset{0}}}));
+  EXPECT_EQ(index->lookup({2.0f, "test2"}), (std::vector<RowID>{RowID{ChunkID{0}, ChunkOffset{0}}}));
+  EXPECT_TRUE(index->lookup({2.5f, "test2"}).empty());
+  EXPECT_TRUE(index->lookup({NULL_VALUE, "test2"}).empty());
+
+  EXPECT_THROW(index->lookup({2}), std::logic_error);
+}
+
+TEST_F(PrimaryKeyIndexTest, InvalidCreation) {
+  table->append({4, "test4"});
+  EXPECT_THROW(PrimaryKeyIndex(*table, std::vector<ColumnID>{ColumnID{0}, ColumnID{1}}), std::logic_error);
+
+  // Deleted rows are not indexed and do not cause duplicates.
+  table->last_chunk()->mvcc_data()->set_end_cid(ChunkOffset{0}, CommitID{1});
+  EXPECT_NO_THROW(PrimaryKeyIndex(*table, std::vector<ColumnID>{ColumnID{0}, ColumnID{1}}));
+
+  const auto nullable_table = load_table("resources/test_data/tbl/int_int4_with_null.tbl");
+  EXPECT_THROW(PrimaryKeyIndex(*nullable_table, std::vector<ColumnID>{ColumnID{0}}), std::logic_error);
+}
+
+TEST_F(PrimaryKeyIndexTest, EncodeKey) {
+  const auto expect_ascending = [](const std::vector<AllTypeVariant>& values) {
+    for (auto index = size_t{1}; index < values.size(); ++index) {
+      EXPECT_LT(PrimaryKeyIndex::encode_key({values[index - 1]}), PrimaryKeyIndex::encode_key({values[index]}));
+    }
+  };
+
+  expect_ascending({std::numeric_limits<int32_t>::min(), -5, -1, 0, 3, 256, std::numeric_limits<int32_t>::max()});
+  expect_ascending({int64_t{-5'000'000'000}, int64_t{-1}, int64_t{0}, int64_t{5'000'000'000}});
+  expect_ascending({-std::numeric_limits<double>::infinity(), -2.5, -0.5, 0.0, 0.5, 2.5});
+  expect_ascending({-2.5f, -0.5f, 0.0f, 0.5f, 2.5f});
+  expect_ascending({pmr_string{""}, pmr_string{"a"}, pmr_string{"ab"}, pmr_string{"b"}});
+
+  EXPECT_EQ(PrimaryKeyIndex::encode_key({0.0f}), PrimaryKeyIndex::encode_key({-0.0f}));
+
+  // Encoded strings are never prefixes of each other, even if they contain zero bytes.
+  const auto key = PrimaryKeyIndex::encode_key({pmr_string{"a"}});
+  const auto key_with_zero = PrimaryKeyIndex::encode_key({pmr_string{"a\0b", 3}});
+  EXPECT_FALSE(std::equal(key.cbegin(), key.cend(), key_with_zero.cbegin()));
+}
+
+TEST_F(PrimaryKeyIndexTest, InsertAndErase) {
+  const auto row_id = append_row({100, "test100"}, TransactionID{5});
+  EXPECT_TRUE(index->insert(*table, row_id, TransactionID{5}));
+  EXPECT_EQ(index->lookup({100, "test100"}), std::vector<RowID>{row_id});
+  EXPECT_EQ(index->key_count(), 13);
+
+  index->erase(*table, row_id);
+  EXPECT_TRUE(index->lookup({100, "test100"}).empty());
+  EXPECT_EQ(index->key_count(), 12);
+}
+
+TEST_F(PrimaryKeyIndexTest, InsertConflicts) {
+  // The key is held by a visible row.
+  const auto duplicate_row_id = append_row({4, "test4"}, TransactionID{5});
+  EXPECT_FALSE(index->insert(*table, duplicate_row_id, TransactionID{5}));
+  EXPECT_EQ(index->lookup({4, "test4"}), (std::vector<RowID>{RowID{ChunkID{0}, ChunkOffset{1}}}));
+
+  // The key is held by a row that is being inserted by another transaction.
+  const auto row_id = append_row({100, "test100"}, TransactionID{5});
+  EXPECT_TRUE(index->insert(*table, row_id, TransactionID{5}));
+  const auto concurrent_row_id = append_row({100, "test100"}, TransactionID{6});
+  EXPECT_FALSE(index->insert(*table, concurrent_row_id, TransactionID{6}));
+
+  // The key is held by a row that is being deleted by another transaction.
+  table->get_chunk(ChunkID{0})->mvcc_data()->set_tid(ChunkOffset{1}, TransactionID{6});
+  EXPECT_FALSE(index->insert(*table, duplicate_row_id, TransactionID{5}));
+}
+
+TEST_F(PrimaryKeyIndexTest, InsertAfterDelete) {
+  // Rows deleted by a committed transaction do not conflict, but remain in the index.
+  const auto& mvcc_data = table->get_chunk(ChunkID{0})->mvcc_data();
+  mvcc_data->set_end_cid(ChunkOffset{1}, CommitID{1});
+  const auto row_id = append_row({4, "test4"}, TransactionID{5});
+  EXPECT_TRUE(index->insert(*table, row_id, TransactionID{5}));
+  EXPECT_EQ(index->lookup({4, "test4"}), (std::vector<RowID>{RowID{ChunkID{0}, ChunkOffset{1}}, row_id}));
+
+  // Rows deleted by the inserting transaction itself remain in the index, as other transactions can still see them.
+  mvcc_data->set_tid(ChunkOffset{0}, TransactionID{7});
+  const auto updated_row_id = append_row({2, "test2"}, TransactionID{7});
+  EXPECT_TRUE(index->insert(*table, updated_row_id, TransactionID{7}));
+  EXPECT_EQ(index->lookup({2, "test2"}), (std::vector<RowID>{RowID{ChunkID{0}, ChunkOffset{0}}, updated_row_id}));
+
+  // Rows that were inserted and deleted by the same transaction are ignored (see Delete::_on_execute()).
+  const auto deleted_row_id = append_row({101, "test101"}, TransactionID{8});
+  EXPECT_TRUE(index->insert(*table, deleted_row_id, TransactionID{8}));
+  table->get_chunk(deleted_row_id.chunk_id)->mvcc_data()->set_tid(deleted_row_id.chunk_offset, INVALID_TRANSACTION_ID);
+  const auto new_row_id = append_row({101, "test101"}, TransactionID{9});
+  EXPECT_TRUE(index->insert(*table, new_row_id, TransactionID{9}));
+  EXPECT_EQ(index->lookup({101, "test101"}), std::vector<RowID>{new_row_id});
+}
+
+TEST_F(PrimaryKeyIndexTest, RemoveDeletedRows) {
+  const auto& mvcc_data = table->get_chunk(ChunkID{0})->mvcc_data();
+  mvcc_data->set_end_cid(ChunkOffset{0}, CommitID{2});
+  index->register_deleted_row(*table, RowID{ChunkID{0}, ChunkOffset{0}}, CommitID{2});
+  mvcc_data->set_end_cid(ChunkOffset{1}, CommitID{3});
+  index->register_deleted_row(*table, RowID{ChunkID{0}, ChunkOffset{1}}, CommitID{3});
+  const auto row_id = append_row({4, "test4"}, TransactionID{5});
+  EXPECT_TRUE(index->insert(*table, row_id, TransactionID{5}));
+  EXPECT_EQ(index->key_count(), 12);
+
+  // Rows deleted after the snapshot are still visible to the transaction and are kept.
+  EXPECT_EQ(index->remove_deleted_rows(CommitID{1}), 0);
+  EXPECT_EQ(index->remove_deleted_rows(CommitID{2}), 1);
+  EXPECT_TRUE(index->lookup({2, "test2"}).empty());
+  EXPECT_EQ(index->key_count(), 11);
+  EXPECT_EQ(index->lookup({4, "test4"}), (std::vector<RowID>{RowID{ChunkID{0}, ChunkOffset{1}}, row_id}));
+
+  // Keys that are held by another row remain in the index.
+  EXPECT_EQ(index->remove_deleted_rows(CommitID{5}), 1);
+  EXPECT_EQ(index->lookup({4, "test4"}), std::vector<RowID>{row_id});
+  EXPECT_EQ(index->key_count(), 11);
+  EXPECT_EQ(index->remove_deleted_rows(CommitID{5}), 0);
+}
+
+}  // namespace hyrise
@@ -335,4 +335,67 @@ TEST_F(StorageTableTest, CreatePartialHashIndexOnEmptyChunks) {
   EXPECT_THROW(t->create_partial_hash_index(ColumnID{0}, {}), std::logic_error);
 }
 
+TEST_F(StorageTableTest, CreateTableIndex) {
+  // The index can be created before the table has any complete chunk.
+  t->create_table_index(ColumnID{0}, "idx_empty");
+  EXPECT_TRUE(t->table_indexes_statistics()[0].chunk_ids.empty());
+
+  t->append({4, "Hello"});
+  t->append({3, "World"});
+  t->append({6, "!"});
+
+  // Only complete chunks are indexed.
+  t->create_table_index(ColumnID{1}, "idx");
+  const auto table_indexes_statistics = t->table_indexes_statistics();
+  ASSERT_EQ(table_indexes_statistics.size(), 2);
+  EXPECT_EQ(table_indexes_statistics[1].name, "idx");
+  EXPECT_EQ(table_indexes_statistics[1].column_ids, std::vector<ColumnID>{ColumnID{1}});
+  ASSERT_EQ(table_indexes_statistics[1].chunk_ids.size(), 1);
+  EXPECT_EQ(table_indexes_statistics[1].chunk_ids[0].first, ChunkID{0});
+
+  const auto table_indexes = t->get_table_indexes(ColumnID{1});
+  ASSERT_EQ(table_indexes.size(), 1);
+  EXPECT_EQ(table_indexes[0]->get_indexed_chunk_ids().size(), 1);
+
+  // Names must be unique, unnamed indexes are allowed multiple times.
+  EXPECT_THROW(t->create_table_index(ColumnID{0}, "idx"), std::logic_error);
+  EXPECT_NO_THROW(t->create_table_index(ColumnID{0}, ""));
+  EXPECT_NO_THROW(t->create_table_index(ColumnID{0}, ""));
+  EXPECT_THROW(t->create_table_index(ColumnID{2}, "idx_2"), std::logic_error);
+}
+
+TEST_F(StorageTableTest, MaintainTableIndexes) {
+  t->append({4, "Hello"});
+  t->append({3, "World"});
+  t->append({6, "Hello"});
+  t->create_table_index(ColumnID{1}, "idx");
+  const auto table_index = t->get_table_indexes(ColumnID{1})[0];
+
+  const auto count_matches = [&](const pmr_string& value) {
+    auto match_count = std::ptrdiff_t{0};
+    table_index->range_equals_with_iterators(
+        [&](const auto begin, const auto end) { match_count = std::distance(begin, end); }, value);
+    return match_count;
+  };
+  EXPECT_EQ(count_matches("Hello"), 1);
+
+  // Once the second chunk is complete, it is added to the index.
+  t->append({7, "Hello"});
+  t->add_chunk_to_table_indexes(ChunkID{1});
+  EXPECT_EQ(count_matches("Hello"), 2);
+  EXPECT_EQ(t->table_indexes_statistics()[0].chunk_ids.size(), 2);
+
+  // Adding a chunk again has no effect.
+  t->add_chunk_to_table_indexes(ChunkID{1});
+  EXPECT_EQ(count_matches("Hello"), 2);
+  EXPECT_EQ(t->table_indexes_statistics()[0].chunk_ids.size(), 2);
+
+  // Physically deleted chunks are removed from the index. We skip invalidating the rows via MVCC for this test.
+  t->get_chunk(ChunkID{0})->increase_invalid_row_count(ChunkOffset{2});
+  t->remove_chunk(ChunkID{0});
+  EXPECT_EQ(count_matches("Hello"), 1);
+  ASSERT_EQ(t->table_indexes_statistics()[0].chunk_ids.size(), 1);
+  EXPECT_EQ(t->table_indexes_statistics()[0].chunk_ids[0].first, ChunkID{1});
+}
+
 }  // namespace hyrise
@@ -9,6 +9,7 @@
 #include "operators/get_table.hpp"
 #include "operators/insert.hpp"
 #include "operators/validate.hpp"
+#include "storage/abstract_encoded_segment.hpp"
 #include "storage/chunk_encoder.hpp"
 #include "tasks/chunk_compression_task.hpp"
 
@@ -111,4 +112,74 @@ TEST_F(ChunkCompressionTaskTest, CompressionWithAbortedInsert) {
   EXPECT_EQ(validate->get_output()->row_count(), 12u);
 }
 
+TEST_F(ChunkCompressionTaskTest, PendingInsertPreventsCompletion) {
+  auto table = load_table("resources/test_data/tbl/compression_input.tbl", ChunkOffset{6});
+  Hyrise::get().storage_manager.add_table("table_insert", table);
+
+  auto get_table = std::make_shared<GetTable>("table_insert");
+  get_table->execute();
+
+  auto insert = std::make_shared<Insert>("table_insert", get_table);
+  auto context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  insert->set_transaction_context(context);
+  insert->execute();
+
+  ASSERT_EQ(table->chunk_count(), 4u);
+
+  // The inserted rows fill the chunks 2 and 3, but the Insert did not commit yet.
+  const auto chunk = table->get_chunk(ChunkID{2});
+  EXPECT_TRUE(chunk->is_mutable());
+  EXPECT_EQ(chunk->size(), 6);
+  EXPECT_TRUE(chunk->has_pending_inserts());
+  EXPECT_FALSE(ChunkCompressionTask::chunk_is_completed(chunk, table->target_chunk_size()));
+
+  context->commit();
+  EXPECT_FALSE(chunk->has_pending_inserts());
+  EXPECT_TRUE(ChunkCompressionTask::chunk_is_completed(chunk, table->target_chunk_size()));
+}
+
+TEST_F(ChunkCompressionTaskTest, CompressesCompletedChunksWithEncodingSpec) {
+  auto table = load_table("resources/test_data/tbl/compression_input.tbl", ChunkOffset{6});
+  Hyrise::get().storage_manager.add_table("table_insert", table);
+
+  auto get_table = std::make_shared<GetTable>("table_insert");
+  get_table->execute();
+
+  auto insert = std::make_shared<Insert>("table_insert", get_table);
+  auto context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  insert->set_transaction_context(context);
+  insert->execute();
+  context->commit();
+
+  ASSERT_EQ(table->chunk_count(), 4u);
+
+  const auto chunk_encoding_spec =
+      ChunkEncodingSpec{SegmentEncodingSpec{EncodingType::LZ4}, SegmentEncodingSpec{EncodingType::RunLength}};
+  auto compression = std::make_shared<ChunkCompressionTask>(
+      "table_insert", std::vector<ChunkID>{ChunkID{2}, ChunkID{3}}, chunk_encoding_spec);
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks({compression});
+
+  for (auto chunk_id = ChunkID{2}; chunk_id < table->chunk_count(); ++chunk_id) {
+    const auto chunk = table->get_chunk(chunk_id);
+    EXPECT_FALSE(chunk->is_mutable());
+
+    const auto string_segment =
+        std::dynamic_pointer_cast<const AbstractEncodedSegment>(chunk->get_segment(ColumnID{0}));
+    ASSERT_NE(string_segment, nullptr);
+    EXPECT_EQ(string_segment->encoding_type(), EncodingType::LZ4);
+
+    const auto int_segment = std::dynamic_pointer_cast<const AbstractEncodedSegment>(chunk->get_segment(ColumnID{1}));
+    ASSERT_NE(int_segment, nullptr);
+    EXPECT_EQ(int_segment->encoding_type(), EncodingType::RunLength);
+  }
+
+  // The compressed chunks contain a copy of the original rows.
+  for (auto row_number = size_t{0}; row_number < 12; ++row_number) {
+    EXPECT_EQ(table->get_value<pmr_string>(ColumnID{0}, row_number + 12),
+              table->get_value<pmr_string>(ColumnID{0}, row_number));
+    EXPECT_EQ(table->get_value<int32_t>(ColumnID{1}, row_number + 12),
+              table->get_value<int32_t>(ColumnID{1}, row_number));
+  }
+}
+
 }  // namespace hyrise
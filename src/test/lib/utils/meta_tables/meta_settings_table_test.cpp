@@ -28,6 +28,17 @@ class MetaSettingsTest : public BaseTest {
                                                                     {"description", DataType::String, false}},
                                              TableType::Data, ChunkOffset{5});
 
+    // Hyrise registers the settings of its own components.
+    for (const auto& [setting_name, setting_value] :
+         std::vector<std::pair<std::string, std::string>>{{"AdmissionControl.max_concurrent_queries", "0"},
+                                                          {"TableStatistics.generation_mode", "Exact"},
+                                                          {"TableStatistics.sketch_size", "200"},
+                                                          {"TableStatistics.sampling_interval", "1"}}) {
+      const auto& setting = Hyrise::get().settings_manager.get_setting(setting_name);
+      expected_table->append(
+          {pmr_string{setting_name}, pmr_string{setting_value}, pmr_string{setting->description()}});
+    }
+
     mock_setting = std::make_shared<MockSetting>("mock_setting");
     mock_setting->register_at_settings_manager();
   }
@@ -0,0 +1,125 @@
+#include <memory>
+#include <string>
+
+#include "base_test.hpp"
+#include "lib/utils/plugin_test_utils.hpp"
+
+#include "../../plugins/chunk_compression_plugin.hpp"
+#include "operators/insert.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/abstract_encoded_segment.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "utils/plugin_manager.hpp"
+
+namespace hyrise {
+
+class ChunkCompressionPluginTest : public BaseTest {
+ public:
+  void SetUp() override {
+    const auto column_definitions = TableColumnDefinitions{{"a", DataType::Int, false}, {"b", DataType::String, false}};
+    _table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{3}, UseMvcc::Yes);
+    Hyrise::get().storage_manager.add_table(_table_name, _table);
+
+    // Insert seven rows so that the first two chunks are full and the third one is not.
+    _values_to_insert = std::make_shared<Table>(column_definitions, TableType::Data);
+    for (auto value = int32_t{0}; value < 7; ++value) {
+      _values_to_insert->append({value, pmr_string{"value" + std::to_string(value)}});
+    }
+  }
+
+ protected:
+  void _insert_values() {
+    const auto table_wrapper = std::make_shared<TableWrapper>(_values_to_insert);
+    table_wrapper->execute();
+    const auto insert = std::make_shared<Insert>(_table_name, table_wrapper);
+    const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+    insert->set_transaction_context(transaction_context);
+    insert->execute();
+    transaction_context->commit();
+  }
+
+  static void _compress_loop(ChunkCompressionPlugin& plugin) {
+    plugin._compress_loop();
+  }
+
+  const std::string _table_name{"chunkCompressionTestTable"};
+  std::shared_ptr<Table> _table;
+  std::shared_ptr<Table> _values_to_insert;
+};
+
+TEST_F(ChunkCompressionPluginTest, LoadUnloadPlugin) {
+  auto& plugin_manager = Hyrise::get().plugin_manager;
+  EXPECT_NO_THROW(plugin_manager.load_plugin(build_dylib_path("libhyriseChunkCompressionPlugin")));
+  EXPECT_TRUE(Hyrise::get().settings_manager.has_setting("ChunkCompressionPlugin.encoding"));
+  EXPECT_NO_THROW(plugin_manager.unload_plugin("hyriseChunkCompressionPlugin"));
+  EXPECT_FALSE(Hyrise::get().settings_manager.has_setting("ChunkCompressionPlugin.encoding"));
+}
+
+TEST_F(ChunkCompressionPluginTest, CompressesCompletedChunks) {
+  _insert_values();
+  ASSERT_EQ(_table->chunk_count(), 3);
+
+  auto plugin = ChunkCompressionPlugin{};
+  _compress_loop(plugin);
+  EXPECT_EQ(plugin.compressed_chunk_count(), 2);
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < 2; ++chunk_id) {
+    const auto chunk = _table->get_chunk(chunk_id);
+    EXPECT_FALSE(chunk->is_mutable());
+    EXPECT_TRUE(chunk->pruning_statistics().has_value());
+    for (auto column_id = ColumnID{0}; column_id < _table->column_count(); ++column_id) {
+      const auto segment = std::dynamic_pointer_cast<const AbstractEncodedSegment>(chunk->get_segment(column_id));
+      ASSERT_TRUE(segment);
+      EXPECT_EQ(segment->encoding_type(), EncodingType::Dictionary);
+    }
+  }
+
+  // The last chunk is not full and still receives inserts.
+  const auto last_chunk = _table->get_chunk(ChunkID{2});
+  EXPECT_TRUE(last_chunk->is_mutable());
+  EXPECT_TRUE(std::dynamic_pointer_cast<const ValueSegment<int32_t>>(last_chunk->get_segment(ColumnID{0})));
+
+  EXPECT_TABLE_EQ_ORDERED(_table, _values_to_insert);
+
+  // Already compressed chunks are not compressed again.
+  _compress_loop(plugin);
+  EXPECT_EQ(plugin.compressed_chunk_count(), 2);
+}
+
+TEST_F(ChunkCompressionPluginTest, UsesEncodingConfig) {
+  _insert_values();
+
+  auto plugin = ChunkCompressionPlugin{};
+  auto encoding_config = EncodingConfig{SegmentEncodingSpec{EncodingType::LZ4}};
+  encoding_config.custom_encoding_mapping[_table_name]["a"] = SegmentEncodingSpec{EncodingType::FrameOfReference};
+  plugin.set_encoding_config(encoding_config);
+  _compress_loop(plugin);
+
+  const auto chunk = _table->get_chunk(ChunkID{0});
+  const auto segment_a = std::dynamic_pointer_cast<const AbstractEncodedSegment>(chunk->get_segment(ColumnID{0}));
+  const auto segment_b = std::dynamic_pointer_cast<const AbstractEncodedSegment>(chunk->get_segment(ColumnID{1}));
+  ASSERT_TRUE(segment_a);
+  ASSERT_TRUE(segment_b);
+  EXPECT_EQ(segment_a->encoding_type(), EncodingType::FrameOfReference);
+  EXPECT_EQ(segment_b->encoding_type(), EncodingType::LZ4);
+}
+
+TEST_F(ChunkCompressionPluginTest, EncodingSetting) {
+  auto plugin = ChunkCompressionPlugin{};
+  plugin.start();
+
+  const auto setting = Hyrise::get().settings_manager.get_setting("ChunkCompressionPlugin.encoding");
+  EXPECT_EQ(setting->get(), "Dictionary");
+
+  setting->set("RunLength");
+  EXPECT_EQ(setting->get(), "RunLength");
+  EXPECT_EQ(plugin.encoding_config().default_encoding_spec.encoding_type, EncodingType::RunLength);
+
+  EXPECT_THROW(setting->set("NoEncoding"), InvalidInputException);
+
+  plugin.stop();
+  EXPECT_FALSE(Hyrise::get().settings_manager.has_setting("ChunkCompressionPlugin.encoding"));
+}
+
+}  // namespace hyrise
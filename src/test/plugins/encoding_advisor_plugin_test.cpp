@@ -0,0 +1,279 @@
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base_test.hpp"
+#include "lib/utils/plugin_test_utils.hpp"
+
+#include "../../plugins/encoding_advisor_plugin.hpp"
+#include "storage/segment_encoding_utils.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "utils/plugin_manager.hpp"
+
+namespace hyrise {
+
+class EncodingAdvisorPluginTest : public BaseTest {
+ public:
+  void SetUp() override {
+    const auto column_definitions =
+        TableColumnDefinitions{{"runs", DataType::Int, false}, {"cycle", DataType::String, false}};
+    _table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{1'000});
+    // The first column consists of runs of 100 equal values, the second one repeats four strings.
+    for (auto row_id = int32_t{0}; row_id < 2'000; ++row_id) {
+      _table->append({row_id / 100, pmr_string{"value" + std::to_string(row_id % 4)}});
+    }
+    _table->last_chunk()->finalize();
+    Hyrise::get().storage_manager.add_table(_table_name, _table);
+  }
+
+ protected:
+  static SegmentCharacteristics _sample_segment(const std::shared_ptr<const AbstractSegment>& segment) {
+    return EncodingAdvisorPlugin::_sample_segment(segment);
+  }
+
+  static std::vector<EncodingCandidate> _encoding_candidates(const SegmentCharacteristics& characteristics,
+                                                             const SegmentAccessCounter& access_counter) {
+    return EncodingAdvisorPlugin::_encoding_candidates(characteristics, access_counter);
+  }
+
+  static std::vector<size_t> _select_encodings(const std::vector<std::vector<EncodingCandidate>>& segment_candidates,
+                                               const size_t memory_budget) {
+    return EncodingAdvisorPlugin::_select_encodings(segment_candidates, memory_budget);
+  }
+
+  static size_t _advise_and_encode(EncodingAdvisorPlugin& plugin) {
+    return plugin._advise_and_encode();
+  }
+
+  static std::shared_ptr<ValueSegment<int32_t>> _create_int_segment(const size_t size, const int32_t run_length,
+                                                                    const int32_t distinct_value_count) {
+    auto values = pmr_vector<int32_t>(size);
+    for (auto index = size_t{0}; index < size; ++index) {
+      values[index] = static_cast<int32_t>(index / run_length) % distinct_value_count;
+    }
+    return std::make_shared<ValueSegment<int32_t>>(std::move(values));
+  }
+
+  const std::string _table_name{"encodingAdvisorTestTable"};
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(EncodingAdvisorPluginTest, LoadUnloadPlugin) {
+  auto& plugin_manager = Hyrise::get().plugin_manager;
+  EXPECT_NO_THROW(plugin_manager.load_plugin(build_dylib_path("libhyriseEncodingAdvisorPlugin")));
+  EXPECT_TRUE(Hyrise::get().settings_manager.has_setting("EncodingAdvisorPlugin.memory_budget"));
+  EXPECT_NO_THROW(plugin_manager.unload_plugin("hyriseEncodingAdvisorPlugin"));
+  EXPECT_FALSE(Hyrise::get().settings_manager.has_setting("EncodingAdvisorPlugin.memory_budget"));
+}
+
+TEST_F(EncodingAdvisorPluginTest, DescriptionAndProvidedFunction) {
+  auto plugin = EncodingAdvisorPlugin{};
+  EXPECT_EQ(plugin.description(), "Workload-driven encoding advisor plugin");
+  const auto& provided_functions = plugin.provided_user_executable_functions();
+  ASSERT_EQ(provided_functions.size(), 1);
+  EXPECT_EQ(provided_functions.front().first, "AdviseEncodings");
+}
+
+TEST_F(EncodingAdvisorPluginTest, MemoryBudgetSetting) {
+  auto plugin = EncodingAdvisorPlugin{};
+  plugin.start();
+
+  const auto setting = Hyrise::get().settings_manager.get_setting("EncodingAdvisorPlugin.memory_budget");
+  EXPECT_EQ(setting->get(), "0");
+
+  setting->set("1000000");
+  EXPECT_EQ(plugin.memory_budget(), 1'000'000);
+  EXPECT_EQ(setting->get(), "1000000");
+
+  EXPECT_THROW(setting->set("-1"), InvalidInputException);
+  EXPECT_THROW(setting->set("1MB"), InvalidInputException);
+
+  plugin.stop();
+  EXPECT_FALSE(Hyrise::get().settings_manager.has_setting("EncodingAdvisorPlugin.memory_budget"));
+}
+
+TEST_F(EncodingAdvisorPluginTest, SampleSmallSegment) {
+  // Small segments are sampled completely, so the characteristics are exact.
+  const auto segment = _create_int_segment(1'000, 10, 30);
+  segment->access_counter[SegmentAccessCounter::AccessType::Point] = 5;
+  const auto characteristics = _sample_segment(segment);
+
+  EXPECT_EQ(characteristics.data_type, DataType::Int);
+  EXPECT_EQ(characteristics.row_count, 1'000);
+  EXPECT_EQ(characteristics.null_value_count, 0);
+  EXPECT_EQ(characteristics.distinct_value_count, 30);
+  EXPECT_EQ(characteristics.run_count, 100);
+  EXPECT_EQ(characteristics.value_range, 29);
+  EXPECT_GT(characteristics.lz4_memory_usage, 0);
+
+  // Sampling does not count as an access to the segment, but previous accesses are kept.
+  EXPECT_EQ(segment->access_counter[SegmentAccessCounter::AccessType::Point], 5);
+  EXPECT_EQ(segment->access_counter[SegmentAccessCounter::AccessType::Sequential], 0);
+  EXPECT_EQ(segment->access_counter[SegmentAccessCounter::AccessType::Monotonic], 0);
+  EXPECT_EQ(segment->access_counter[SegmentAccessCounter::AccessType::Random], 0);
+}
+
+TEST_F(EncodingAdvisorPluginTest, SampleLargeSegment) {
+  // Values are spread over the segment, so that the sample contains all distinct values but no runs.
+  auto values = pmr_vector<int32_t>(60'000);
+  for (auto index = size_t{0}; index < values.size(); ++index) {
+    values[index] = static_cast<int32_t>((index * 7'919) % 500);
+  }
+  const auto characteristics = _sample_segment(std::make_shared<ValueSegment<int32_t>>(std::move(values)));
+
+  EXPECT_EQ(characteristics.row_count, 60'000);
+  EXPECT_NEAR(static_cast<double>(characteristics.distinct_value_count), 500.0, 25.0);
+  EXPECT_NEAR(static_cast<double>(characteristics.run_count), 60'000.0, 100.0);
+  EXPECT_EQ(characteristics.value_range, 499);
+
+  const auto run_characteristics = _sample_segment(_create_int_segment(60'000, 20, 500));
+  EXPECT_NEAR(static_cast<double>(run_characteristics.run_count), 3'000.0, 300.0);
+  EXPECT_LE(run_characteristics.value_range, 499);
+}
+
+TEST_F(EncodingAdvisorPluginTest, SampleStringSegmentWithNulls) {
+  auto values = pmr_vector<pmr_string>{"a", "bbb", "", "cc", "bbb", "dddddd"};
+  auto null_values = pmr_vector<bool>{false, false, true, false, false, false};
+  const auto segment = std::make_shared<ValueSegment<pmr_string>>(std::move(values), std::move(null_values));
+  const auto characteristics = _sample_segment(segment);
+
+  EXPECT_EQ(characteristics.data_type, DataType::String);
+  EXPECT_EQ(characteristics.null_value_count, 1);
+  EXPECT_EQ(characteristics.distinct_value_count, 4);
+  EXPECT_EQ(characteristics.run_count, 6);
+  EXPECT_FALSE(characteristics.value_range);
+  EXPECT_DOUBLE_EQ(characteristics.average_string_length, 3.0);
+  EXPECT_EQ(characteristics.max_string_length, 6);
+}
+
+TEST_F(EncodingAdvisorPluginTest, EncodingCandidates) {
+  const auto int_characteristics = _sample_segment(_create_int_segment(1'000, 100, 10));
+  const auto int_candidates = _encoding_candidates(int_characteristics, SegmentAccessCounter{});
+  // Unencoded, RunLength, LZ4, and Dictionary and FrameOfReference with both vector compression types.
+  ASSERT_EQ(int_candidates.size(), 7);
+  for (const auto& candidate : int_candidates) {
+    EXPECT_NE(candidate.encoding_spec.encoding_type, EncodingType::FixedStringDictionary);
+    // Without accesses, there are no scan costs.
+    EXPECT_EQ(candidate.estimated_scan_cost, 0.0);
+    if (candidate.encoding_spec.encoding_type == EncodingType::Unencoded) {
+      EXPECT_EQ(candidate.estimated_memory_usage, 4'000);
+    }
+    if (candidate.encoding_spec.encoding_type == EncodingType::RunLength) {
+      EXPECT_LT(candidate.estimated_memory_usage, 100);
+    }
+  }
+
+  auto access_counter = SegmentAccessCounter{};
+  access_counter[SegmentAccessCounter::AccessType::Random] = 1'000;
+  const auto candidates = _encoding_candidates(int_characteristics, access_counter);
+  const auto most_expensive_candidate =
+      std::max_element(candidates.cbegin(), candidates.cend(), [](const auto& lhs, const auto& rhs) {
+        return lhs.estimated_scan_cost < rhs.estimated_scan_cost;
+      });
+  EXPECT_EQ(most_expensive_candidate->encoding_spec.encoding_type, EncodingType::LZ4);
+
+  const auto string_characteristics = _sample_segment(_table->get_chunk(ChunkID{0})->get_segment(ColumnID{1}));
+  const auto string_candidates = _encoding_candidates(string_characteristics, SegmentAccessCounter{});
+  ASSERT_EQ(string_candidates.size(), 7);
+  for (const auto& candidate : string_candidates) {
+    EXPECT_NE(candidate.encoding_spec.encoding_type, EncodingType::FrameOfReference);
+  }
+}
+
+TEST_F(EncodingAdvisorPluginTest, SelectEncodings) {
+  const auto unencoded = SegmentEncodingSpec{EncodingType::Unencoded};
+  const auto dictionary = SegmentEncodingSpec{EncodingType::Dictionary, VectorCompressionType::FixedWidthInteger};
+  const auto lz4 = SegmentEncodingSpec{EncodingType::LZ4};
+
+  const auto segment_candidates = std::vector<std::vector<EncodingCandidate>>{
+      {{unencoded, 1'000, 10.0}, {dictionary, 500, 12.0}, {lz4, 100, 100.0}},
+      {{unencoded, 1'000, 10.0}, {dictionary, 500, 20.0}, {lz4, 100, 25.0}}};
+
+  // Without memory constraints, the cheapest candidates are selected.
+  EXPECT_EQ(_select_encodings(segment_candidates, std::numeric_limits<size_t>::max()), (std::vector<size_t>{0, 0}));
+
+  // Encoding the first segment with Dictionary saves 500 bytes for an additional cost of 2.0.
+  EXPECT_EQ(_select_encodings(segment_candidates, 1'500), (std::vector<size_t>{1, 0}));
+
+  // Encoding the second segment with LZ4 (cost per saved byte: 15.0 / 900) is cheaper than any other downgrade.
+  EXPECT_EQ(_select_encodings(segment_candidates, 1'000), (std::vector<size_t>{1, 2}));
+
+  // If the budget cannot be met, the smallest candidates are selected.
+  EXPECT_EQ(_select_encodings(segment_candidates, 0), (std::vector<size_t>{2, 2}));
+
+  EXPECT_TRUE(_select_encodings({}, 0).empty());
+}
+
+TEST_F(EncodingAdvisorPluginTest, EncodesAccordingToWorkload) {
+  // Both columns are scanned sequentially. Without memory constraints, the runs are best scanned in RunLength
+  // encoding, the strings without any encoding.
+  for (auto chunk_id = ChunkID{0}; chunk_id < _table->chunk_count(); ++chunk_id) {
+    const auto chunk = _table->get_chunk(chunk_id);
+    for (auto column_id = ColumnID{0}; column_id < _table->column_count(); ++column_id) {
+      chunk->get_segment(column_id)->access_counter[SegmentAccessCounter::AccessType::Sequential] = 10'000;
+    }
+  }
+
+  auto plugin = EncodingAdvisorPlugin{};
+  plugin.set_memory_budget(std::numeric_limits<size_t>::max());
+  EXPECT_EQ(_advise_and_encode(plugin), 2);
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < _table->chunk_count(); ++chunk_id) {
+    const auto chunk = _table->get_chunk(chunk_id);
+    EXPECT_EQ(get_segment_encoding_spec(chunk->get_segment(ColumnID{0})).encoding_type, EncodingType::RunLength);
+    EXPECT_EQ(get_segment_encoding_spec(chunk->get_segment(ColumnID{1})).encoding_type, EncodingType::Unencoded);
+    // The access counters are kept.
+    EXPECT_EQ(chunk->get_segment(ColumnID{0})->access_counter[SegmentAccessCounter::AccessType::Sequential], 10'000);
+  }
+
+  EXPECT_EQ(_table->get_value<int32_t>(ColumnID{0}, 1'234), 12);
+  EXPECT_EQ(_table->get_value<pmr_string>(ColumnID{1}, 1'234), "value2");
+
+  // A second run does not change the encodings.
+  EXPECT_EQ(_advise_and_encode(plugin), 0);
+}
+
+TEST_F(EncodingAdvisorPluginTest, CompressesUnaccessedSegments) {
+  const auto memory_usage = [&]() {
+    auto memory_usage = size_t{0};
+    for (auto chunk_id = ChunkID{0}; chunk_id < _table->chunk_count(); ++chunk_id) {
+      memory_usage += _table->get_chunk(chunk_id)->memory_usage(MemoryUsageCalculationMode::Full);
+    }
+    return memory_usage;
+  };
+
+  const auto initial_memory_usage = memory_usage();
+
+  // Without accesses, all encodings are equally cheap and the smallest ones are selected.
+  auto plugin = EncodingAdvisorPlugin{};
+  EXPECT_EQ(_advise_and_encode(plugin), 4);
+  EXPECT_LT(memory_usage(), initial_memory_usage);
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < _table->chunk_count(); ++chunk_id) {
+    const auto chunk = _table->get_chunk(chunk_id);
+    for (auto column_id = ColumnID{0}; column_id < _table->column_count(); ++column_id) {
+      EXPECT_NE(get_segment_encoding_spec(chunk->get_segment(column_id)).encoding_type, EncodingType::Unencoded);
+    }
+  }
+
+  EXPECT_EQ(_table->get_value<int32_t>(ColumnID{0}, 1'999), 19);
+  EXPECT_EQ(_table->get_value<pmr_string>(ColumnID{1}, 1'999), "value3");
+}
+
+TEST_F(EncodingAdvisorPluginTest, IgnoresMutableChunks) {
+  _table->append({int32_t{20}, pmr_string{"value0"}});
+  ASSERT_EQ(_table->chunk_count(), 3);
+
+  auto plugin = EncodingAdvisorPlugin{};
+  _advise_and_encode(plugin);
+
+  const auto mutable_chunk = _table->get_chunk(ChunkID{2});
+  EXPECT_TRUE(mutable_chunk->is_mutable());
+  EXPECT_EQ(get_segment_encoding_spec(mutable_chunk->get_segment(ColumnID{0})).encoding_type,
+            EncodingType::Unencoded);
+}
+
+}  // namespace hyrise
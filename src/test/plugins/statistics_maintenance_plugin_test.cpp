@@ -0,0 +1,250 @@
+#include <memory>
+#include <string>
+
+#include "base_test.hpp"
+#include "lib/utils/plugin_test_utils.hpp"
+
+#include "../../plugins/statistics_maintenance_plugin.hpp"
+#include "expression/expression_functional.hpp"
+#include "logical_query_plan/lqp_translator.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "operators/insert.hpp"
+#include "operators/table_wrapper.hpp"
+#include "scheduler/operator_task.hpp"
+#include "sql/sql_pipeline_builder.hpp"
+#include "sql/sql_plan_cache.hpp"
+#include "statistics/column_group_statistics.hpp"
+#include "statistics/table_statistics.hpp"
+#include "storage/table.hpp"
+#include "utils/plugin_manager.hpp"
+
+namespace hyrise {
+
+using namespace expression_functional;  // NOLINT(build/namespaces)
+
+class StatisticsMaintenancePluginTest : public BaseTest {
+ public:
+  void SetUp() override {
+    // 10 rows.
+    _table = load_table("resources/test_data/tbl/10_ints.tbl", ChunkOffset{4});
+    Hyrise::get().storage_manager.add_table(_table_name, _table);
+    Hyrise::get().storage_manager.add_table("other_table", load_table("resources/test_data/tbl/int.tbl"));
+  }
+
+ protected:
+  void _insert_rows(const int32_t row_count) {
+    const auto values_to_insert = std::make_shared<Table>(_table->column_definitions(), TableType::Data);
+    for (auto value = int32_t{0}; value < row_count; ++value) {
+      values_to_insert->append({value});
+    }
+
+    const auto table_wrapper = std::make_shared<TableWrapper>(values_to_insert);
+    table_wrapper->execute();
+    const auto insert = std::make_shared<Insert>(_table_name, table_wrapper);
+    const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+    insert->set_transaction_context(transaction_context);
+    insert->execute();
+    transaction_context->commit();
+  }
+
+  static size_t _maintain_statistics(StatisticsMaintenancePlugin& plugin) {
+    return plugin._maintain_statistics();
+  }
+
+  static size_t _add_column_group_statistics(StatisticsMaintenancePlugin& plugin) {
+    return plugin._add_column_group_statistics();
+  }
+
+  const std::string _table_name{"statisticsMaintenanceTestTable"};
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(StatisticsMaintenancePluginTest, LoadUnloadPlugin) {
+  auto& plugin_manager = Hyrise::get().plugin_manager;
+  EXPECT_NO_THROW(plugin_manager.load_plugin(build_dylib_path("libhyriseStatisticsMaintenancePlugin")));
+  EXPECT_TRUE(Hyrise::get().settings_manager.has_setting("StatisticsMaintenancePlugin.refresh_threshold"));
+  EXPECT_TRUE(
+      Hyrise::get().settings_manager.has_setting("StatisticsMaintenancePlugin.column_group_misestimation_factor"));
+  EXPECT_NO_THROW(plugin_manager.unload_plugin("hyriseStatisticsMaintenancePlugin"));
+  EXPECT_FALSE(Hyrise::get().settings_manager.has_setting("StatisticsMaintenancePlugin.refresh_threshold"));
+  EXPECT_FALSE(
+      Hyrise::get().settings_manager.has_setting("StatisticsMaintenancePlugin.column_group_misestimation_factor"));
+}
+
+TEST_F(StatisticsMaintenancePluginTest, RefreshesStatisticsAfterThreshold) {
+  auto plugin = StatisticsMaintenancePlugin{};
+  plugin.set_refresh_threshold(0.5);
+
+  const auto initial_statistics = _table->table_statistics();
+  ASSERT_TRUE(initial_statistics);
+  EXPECT_FLOAT_EQ(initial_statistics->row_count, 10.0f);
+
+  // Nothing changed.
+  EXPECT_EQ(_maintain_statistics(plugin), 0);
+
+  // Three modified rows are below the threshold of five rows.
+  _insert_rows(3);
+  EXPECT_EQ(_maintain_statistics(plugin), 0);
+  EXPECT_EQ(_table->table_statistics(), initial_statistics);
+
+  // Six modified rows exceed it.
+  _insert_rows(3);
+  EXPECT_EQ(_maintain_statistics(plugin), 1);
+  const auto refreshed_statistics = _table->table_statistics();
+  EXPECT_NE(refreshed_statistics, initial_statistics);
+  EXPECT_FLOAT_EQ(refreshed_statistics->row_count, 16.0f);
+
+  // The counter restarts after the refresh.
+  _insert_rows(7);
+  EXPECT_EQ(_maintain_statistics(plugin), 0);
+  _insert_rows(1);
+  EXPECT_EQ(_maintain_statistics(plugin), 1);
+  EXPECT_FLOAT_EQ(_table->table_statistics()->row_count, 24.0f);
+}
+
+TEST_F(StatisticsMaintenancePluginTest, UpdatesSketchStatistics) {
+  auto plugin = StatisticsMaintenancePlugin{};
+  auto config = StatisticsGenerationConfig{};
+  config.mode = StatisticsGenerationMode::Sketch;
+  _table->set_table_statistics(TableStatistics::from_table(*_table, config));
+  ASSERT_EQ(_table->table_statistics()->sketched_chunk_count, 3);
+
+  // The statistics are updated with the configuration they were created with. The new chunks are still mutable.
+  _insert_rows(5);
+  EXPECT_EQ(_maintain_statistics(plugin), 1);
+  const auto updated_statistics = _table->table_statistics();
+  EXPECT_EQ(updated_statistics->generation_config.mode, StatisticsGenerationMode::Sketch);
+  EXPECT_EQ(updated_statistics->sketched_chunk_count, 3);
+  EXPECT_FLOAT_EQ(updated_statistics->row_count, 15.0f);
+
+  // Once a chunk is finalized, it is sketched as well.
+  _table->get_chunk(ChunkID{3})->finalize();
+  _insert_rows(2);
+  EXPECT_EQ(_maintain_statistics(plugin), 1);
+  EXPECT_EQ(_table->table_statistics()->sketched_chunk_count, 4);
+  EXPECT_FLOAT_EQ(_table->table_statistics()->row_count, 17.0f);
+}
+
+TEST_F(StatisticsMaintenancePluginTest, GeneratesPruningStatisticsOfFinalizedChunks) {
+  auto plugin = StatisticsMaintenancePlugin{};
+
+  // The three chunks of the loaded table are immutable. Thus, the Insert fills a new chunk and starts another one.
+  _insert_rows(5);
+  ASSERT_EQ(_table->chunk_count(), 5);
+  const auto full_chunk = _table->get_chunk(ChunkID{3});
+  ASSERT_EQ(full_chunk->size(), 4);
+  ASSERT_TRUE(full_chunk->is_mutable());
+
+  // Mutable chunks do not get pruning statistics, even if they are full.
+  _maintain_statistics(plugin);
+  EXPECT_FALSE(full_chunk->pruning_statistics());
+
+  full_chunk->finalize();
+  _maintain_statistics(plugin);
+  EXPECT_TRUE(full_chunk->pruning_statistics());
+  EXPECT_FALSE(_table->get_chunk(ChunkID{4})->pruning_statistics());
+}
+
+TEST_F(StatisticsMaintenancePluginTest, EvictsCachedPlans) {
+  const auto lqp_cache = std::make_shared<SQLLogicalPlanCache>();
+  const auto pqp_cache = std::make_shared<SQLPhysicalPlanCache>();
+  Hyrise::get().default_lqp_cache = lqp_cache;
+  Hyrise::get().default_pqp_cache = pqp_cache;
+
+  const auto query_table = "SELECT * FROM " + _table_name + " WHERE a > 10;";
+  const auto query_subquery = "SELECT * FROM other_table WHERE a IN (SELECT a FROM " + _table_name + ");";
+  const auto query_other_table = std::string{"SELECT * FROM other_table WHERE a > 10;"};
+  for (const auto& query : {query_table, query_subquery, query_other_table}) {
+    auto pipeline = SQLPipelineBuilder{query}.create_pipeline();
+    pipeline.get_result_table();
+  }
+  ASSERT_EQ(lqp_cache->size(), 3);
+  ASSERT_EQ(pqp_cache->size(), 3);
+
+  auto plugin = StatisticsMaintenancePlugin{};
+  _insert_rows(1);
+  EXPECT_EQ(_maintain_statistics(plugin), 1);
+
+  EXPECT_EQ(lqp_cache->size(), 1);
+  EXPECT_TRUE(lqp_cache->has(query_other_table));
+  EXPECT_EQ(pqp_cache->size(), 1);
+  EXPECT_TRUE(pqp_cache->has(query_other_table));
+}
+
+TEST_F(StatisticsMaintenancePluginTest, RefreshThresholdSetting) {
+  auto plugin = StatisticsMaintenancePlugin{};
+  plugin.start();
+
+  const auto setting = Hyrise::get().settings_manager.get_setting("StatisticsMaintenancePlugin.refresh_threshold");
+  EXPECT_EQ(std::stod(setting->get()), StatisticsMaintenancePlugin::DEFAULT_REFRESH_THRESHOLD);
+
+  setting->set("0.25");
+  EXPECT_EQ(plugin.refresh_threshold(), 0.25);
+
+  EXPECT_THROW(setting->set("-1"), InvalidInputException);
+  EXPECT_THROW(setting->set("abc"), InvalidInputException);
+  EXPECT_THROW(setting->set("0.5x"), InvalidInputException);
+
+  plugin.stop();
+  EXPECT_FALSE(Hyrise::get().settings_manager.has_setting("StatisticsMaintenancePlugin.refresh_threshold"));
+}
+
+TEST_F(StatisticsMaintenancePluginTest, AddsColumnGroupStatistics) {
+  // Column a and b are fully correlated.
+  const auto column_definitions =
+      TableColumnDefinitions{{"a", DataType::Int, false}, {"b", DataType::String, false}};
+  const auto table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{100}, UseMvcc::Yes);
+  for (auto row = int32_t{0}; row < 1'000; ++row) {
+    table->append({row % 20, pmr_string{"value" + std::to_string(row % 20)}});
+  }
+  Hyrise::get().storage_manager.add_table("correlated_table", table);
+
+  // The independent estimation expects that only 1 / 20 of the rows with a = 3 have b = 'value3', while all of them
+  // qualify.
+  const auto stored_table_node = StoredTableNode::make("correlated_table");
+  const auto lqp = PredicateNode::make(equals_(stored_table_node->get_column("b"), "value3"),
+                                       PredicateNode::make(equals_(stored_table_node->get_column("a"), 3),
+                                                           stored_table_node));
+  const auto pqp = LQPTranslator{}.translate_node(lqp);
+  const auto& [tasks, root_operator_task] = OperatorTask::make_tasks_from_operator(pqp);
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(tasks);
+
+  const auto pqp_cache = std::make_shared<SQLPhysicalPlanCache>();
+  Hyrise::get().default_pqp_cache = pqp_cache;
+  pqp_cache->set("correlated_query", pqp);
+
+  // The plugin does not add column group statistics by default.
+  auto plugin = StatisticsMaintenancePlugin{};
+  EXPECT_EQ(_add_column_group_statistics(plugin), 0);
+  EXPECT_TRUE(table->table_statistics()->column_group_statistics.empty());
+
+  // Once enabled, it adds the suggested statistics and evicts the plans that were optimized without them.
+  plugin.set_column_group_misestimation_factor(10.0);
+  EXPECT_EQ(_add_column_group_statistics(plugin), 1);
+  ASSERT_EQ(table->table_statistics()->column_group_statistics.size(), 1);
+  EXPECT_EQ(table->table_statistics()->column_group_statistics.front()->column_ids,
+            std::vector<ColumnID>({ColumnID{0}, ColumnID{1}}));
+  EXPECT_EQ(pqp_cache->size(), 0);
+
+  // Existing statistics are not added again.
+  pqp_cache->set("correlated_query", pqp);
+  EXPECT_EQ(_add_column_group_statistics(plugin), 0);
+}
+
+TEST_F(StatisticsMaintenancePluginTest, ColumnGroupMisestimationFactorSetting) {
+  auto plugin = StatisticsMaintenancePlugin{};
+  plugin.start();
+
+  const auto setting =
+      Hyrise::get().settings_manager.get_setting("StatisticsMaintenancePlugin.column_group_misestimation_factor");
+  EXPECT_EQ(std::stod(setting->get()), StatisticsMaintenancePlugin::DEFAULT_COLUMN_GROUP_MISESTIMATION_FACTOR);
+
+  setting->set("20");
+  EXPECT_EQ(plugin.column_group_misestimation_factor(), 20.0);
+  EXPECT_THROW(setting->set("-1"), InvalidInputException);
+
+  plugin.stop();
+}
+
+}  // namespace hyrise